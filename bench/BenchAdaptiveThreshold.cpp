@@ -30,7 +30,9 @@ try
     int   blockSize = static_cast<int>(state.get_int64("blockSize"));
 
     NVCVThresholdType         threshType = NVCV_THRESH_BINARY;
-    NVCVAdaptiveThresholdType adaptType  = NVCV_ADAPTIVE_THRESH_GAUSSIAN_C;
+    NVCVAdaptiveThresholdType adaptType  = state.get_string("adaptiveMethod") == "mean"
+                                             ? NVCV_ADAPTIVE_THRESH_MEAN_C
+                                             : NVCV_ADAPTIVE_THRESH_GAUSSIAN_C;
 
     double maxValue = 123.;
     double c        = -2.3;
@@ -93,4 +95,5 @@ NVBENCH_BENCH_TYPES(AdaptiveThreshold, NVBENCH_TYPE_AXES(AdaptiveThresholdTypes)
     .set_type_axes_names({"InOutDataType"})
     .add_string_axis("shape", {"1x1080x1920"})
     .add_int64_axis("varShape", {-1, 0})
-    .add_int64_axis("blockSize", {7});
+    .add_string_axis("adaptiveMethod", {"gaussian", "mean"})
+    .add_int64_axis("blockSize", {7, 31, 101});
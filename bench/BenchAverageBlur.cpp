@@ -89,5 +89,5 @@ NVBENCH_BENCH_TYPES(AverageBlur, NVBENCH_TYPE_AXES(AverageBlurTypes))
     .set_type_axes_names({"InOutDataType"})
     .add_string_axis("shape", {"1x1080x1920"})
     .add_int64_axis("varShape", {-1, 0})
-    .add_string_axis("kernelSize", {"7x7"})
+    .add_string_axis("kernelSize", {"7x7", "31x31", "63x63"})
     .add_string_axis("border", {"REPLICATE"});
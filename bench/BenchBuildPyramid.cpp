@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpBuildPyramid.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+template<typename T>
+inline void BuildPyramid(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 shape     = benchutils::GetShape<3>(state.get_string("shape"));
+    long  varShape  = state.get_int64("varShape");
+    int   numLevels = static_cast<int>(state.get_int64("numLevels"));
+    int   numScales = static_cast<int>(state.get_int64("numScales"));
+    float initSigma = static_cast<float>(state.get_float64("initSigma"));
+
+    bool expandInput;
+    int3 baseShape;
+
+    if (state.get_string("expandInput") == "Y")
+    {
+        expandInput = true;
+        baseShape   = int3{(int)shape.z * 2, (int)shape.y * 2, (int)shape.x};
+    }
+    else if (state.get_string("expandInput") == "N")
+    {
+        expandInput = false;
+        baseShape   = int3{(int)shape.z, (int)shape.y, (int)shape.x};
+    }
+    else
+    {
+        throw std::invalid_argument("Invalid expandInput = " + state.get_string("expandInput"));
+    }
+
+    // The Gaussian pyramid has shape approximately (3 + S) * N * (2 HW size) * F32
+    std::size_t pyrSize = (numScales + 3) * shape.x * (baseShape.x * baseShape.y * 2) * sizeof(float);
+
+    // R/W bandwidth rationale:
+    // 1 read of input (U8) and 1 read of the pyramid to blur each layer from the previous one
+    // 1 write of the pyramid
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T) + pyrSize);
+    state.add_global_memory_writes(pyrSize);
+
+    cvcuda::BuildPyramid op(baseShape);
+
+    // clang-format off
+
+    if (varShape < 0) // negative var shape means use Tensor
+    {
+        nvcv::Tensor      src({{shape.x, shape.y, shape.z, 1}, "NHWC"}, nvcv::TYPE_U8);
+        nvcv::TensorBatch dst = cvcuda::BuildPyramid::CreatePyramid(baseShape, numLevels, numScales);
+
+        benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+        state.exec(nvbench::exec_tag::sync, [&op, &src, &dst, &initSigma, &expandInput](nvbench::launch &launch)
+        {
+            op(launch.get_stream(), src, dst, initSigma, expandInput);
+        });
+    }
+    else // zero and positive var shape means use ImageBatchVarShape
+    {
+        throw std::invalid_argument("ImageBatchVarShape not implemented for this operator");
+    }
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using BuildPyramidTypes = nvbench::type_list<uint8_t>;
+
+NVBENCH_BENCH_TYPES(BuildPyramid, NVBENCH_TYPE_AXES(BuildPyramidTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_int64_axis("varShape", {-1})
+    .add_int64_axis("numLevels", {8})
+    .add_int64_axis("numScales", {3})
+    .add_float64_axis("initSigma", {1.6})
+    .add_string_axis("expandInput", {"Y"});
@@ -21,6 +21,8 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <cstdlib>
+
 template<typename T>
 inline void Conv2D(nvbench::state &state, nvbench::type_list<T>)
 try
@@ -81,3 +83,62 @@ NVBENCH_BENCH_TYPES(Conv2D, NVBENCH_TYPE_AXES(Conv2DTypes))
     .add_int64_axis("varShape", {0})
     .add_string_axis("kernelSize", {"7x7"})
     .add_string_axis("border", {"REPLICATE"});
+
+// Direct versus tensor core paths on matched-filter sized kernels, the algorithm is forced through the same
+// environment variable users have, which the operator reads when it is created
+
+template<typename T>
+inline void Conv2DLarge(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3       shape      = benchutils::GetShape<3>(state.get_string("shape"));
+    int2        kernelSize = nvcv::cuda::StaticCast<int>(benchutils::GetShape<2>(state.get_string("kernelSize")));
+    std::string algo       = state.get_string("algo");
+
+    NVCVBorderType borderType = benchutils::GetBorderType(state.get_string("border"));
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T));
+    state.add_global_memory_writes(shape.x * shape.y * shape.z * sizeof(T));
+
+    setenv("CVCUDA_CONV2D_ALGO", algo.c_str(), 1);
+
+    cvcuda::Conv2D op;
+
+    // clang-format off
+
+    nvcv::Tensor kernelAnchor({{shape.x}, "N"}, nvcv::TYPE_2S32);
+
+    benchutils::FillTensor<int2>(kernelAnchor, [](auto &){ return int2{-1, -1}; });
+
+    nvcv::ImageBatchVarShape src(shape.x);
+    nvcv::ImageBatchVarShape dst(shape.x);
+    nvcv::ImageBatchVarShape kernel(shape.x);
+
+    benchutils::FillImageBatch<T>(src, long2{shape.z, shape.y}, long2{0, 0}, benchutils::RandomValues<T>());
+    dst.pushBack(src.begin(), src.end());
+
+    benchutils::FillImageBatch<float>(kernel, long2{kernelSize.x, kernelSize.y}, long2{0, 0},
+                                      benchutils::RandomValues<float>(0.f, 1.f));
+
+    state.exec(nvbench::exec_tag::sync,
+               [&op, &src, &dst, &kernel, &kernelAnchor, &borderType](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), src, dst, kernel, kernelAnchor, borderType);
+    });
+
+    unsetenv("CVCUDA_CONV2D_ALGO");
+}
+catch (const std::exception &err)
+{
+    unsetenv("CVCUDA_CONV2D_ALGO");
+    state.skip(err.what());
+}
+
+// clang-format on
+
+NVBENCH_BENCH_TYPES(Conv2DLarge, NVBENCH_TYPE_AXES(Conv2DTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_string_axis("kernelSize", {"7x7", "15x15", "31x31"})
+    .add_string_axis("algo", {"direct", "tensorcore"})
+    .add_string_axis("border", {"REPLICATE"});
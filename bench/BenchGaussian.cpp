@@ -92,5 +92,5 @@ NVBENCH_BENCH_TYPES(Gaussian, NVBENCH_TYPE_AXES(GaussianTypes))
     .set_type_axes_names({"InOutDataType"})
     .add_string_axis("shape", {"1x1080x1920"})
     .add_int64_axis("varShape", {-1, 0})
-    .add_float64_axis("sigma", {1.2})
+    .add_float64_axis("sigma", {1.2, 4.0, 8.0})
     .add_string_axis("border", {"REFLECT"});
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpImageStats.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+template<typename T>
+inline void ImageStats(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 shape    = benchutils::GetShape<3>(state.get_string("shape"));
+    long  varShape = state.get_int64("varShape");
+    long  numRois  = state.get_int64("numRois");
+
+    int          numBins = 256;
+    nvcv::Tensor mask{nullptr};
+
+    long R = numRois > 0 ? numRois : 1;
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T) + shape.x * numRois * sizeof(int4));
+    state.add_global_memory_writes(shape.x * R * (numBins * sizeof(int) + 2 * sizeof(double) + 2 * sizeof(int2)
+                                                  + 2 * sizeof(double)));
+
+    cvcuda::ImageStats op;
+
+    // clang-format off
+
+    if (varShape < 0) // negative var shape means use Tensor
+    {
+        nvcv::Tensor src({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
+        nvcv::Tensor rois{nullptr};
+
+        nvcv::Tensor hist, minMaxVal, minMaxLoc, sum, sumSq;
+
+        if (numRois > 0)
+        {
+            rois = nvcv::Tensor({{shape.x, numRois}, "NM"}, nvcv::TYPE_4S32);
+
+            // ROIs tile the image in horizontal stripes
+            long stripe = std::max(shape.y / numRois, 1L);
+
+            benchutils::FillTensor<int4>(rois, [&stripe, &shape](const long4_16a &coord){
+                return int4{0, static_cast<int>(coord.y * stripe), static_cast<int>(shape.z),
+                            static_cast<int>(stripe)}; });
+
+            hist      = nvcv::Tensor({{shape.x, numRois, numBins}, "NMC"}, nvcv::TYPE_S32);
+            minMaxVal = nvcv::Tensor({{shape.x, numRois, 2}, "NMC"}, nvcv::TYPE_F64);
+            minMaxLoc = nvcv::Tensor({{shape.x, numRois, 2}, "NMC"}, nvcv::TYPE_2S32);
+            sum       = nvcv::Tensor({{shape.x, numRois}, "NM"}, nvcv::TYPE_F64);
+            sumSq     = nvcv::Tensor({{shape.x, numRois}, "NM"}, nvcv::TYPE_F64);
+        }
+        else
+        {
+            hist      = nvcv::Tensor({{shape.x, numBins}, "NC"}, nvcv::TYPE_S32);
+            minMaxVal = nvcv::Tensor({{shape.x, 2}, "NC"}, nvcv::TYPE_F64);
+            minMaxLoc = nvcv::Tensor({{shape.x, 2}, "NC"}, nvcv::TYPE_2S32);
+            sum       = nvcv::Tensor({{shape.x}, "N"}, nvcv::TYPE_F64);
+            sumSq     = nvcv::Tensor({{shape.x}, "N"}, nvcv::TYPE_F64);
+        }
+
+        benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+        float histLow  = 0.f;
+        float histHigh = static_cast<float>(std::numeric_limits<uint8_t>::max()) + 1.f;
+
+        state.exec(nvbench::exec_tag::sync,
+                   [&op, &src, &mask, &rois, &histLow, &histHigh, &hist, &minMaxVal, &minMaxLoc, &sum, &sumSq]
+                   (nvbench::launch &launch)
+        {
+            op(launch.get_stream(), src, mask, rois, histLow, histHigh, hist, minMaxVal, minMaxLoc, sum, sumSq);
+        });
+    }
+    else // zero and positive var shape means use ImageBatchVarShape
+    {
+        throw std::invalid_argument("ImageBatchVarShape not implemented for this operator");
+    }
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using ImageStatsTypes = nvbench::type_list<uint8_t, uint16_t, float>;
+
+NVBENCH_BENCH_TYPES(ImageStats, NVBENCH_TYPE_AXES(ImageStatsTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920", "16x1080x1920"})
+    .add_int64_axis("varShape", {-1})
+    .add_int64_axis("numRois", {0, 8});
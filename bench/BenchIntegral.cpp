@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpIntegral.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+template<typename T>
+inline void Integral(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 shape    = benchutils::GetShape<3>(state.get_string("shape"));
+    long  varShape = state.get_int64("varShape");
+    bool  useSqSum = state.get_int64("sqsum") != 0;
+
+    // Integer inputs are summed in int32 and floating point inputs in float64, squares always in float64
+    nvcv::DataType    sumType   = std::is_integral_v<T> ? nvcv::TYPE_S32 : nvcv::TYPE_F64;
+    nvcv::ImageFormat sumFormat = std::is_integral_v<T> ? nvcv::FMT_S32 : nvcv::FMT_F64;
+
+    long numOutputs = useSqSum ? 2 : 1;
+    long sumBytes   = std::is_integral_v<T> ? sizeof(int32_t) : sizeof(double);
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T) * numOutputs);
+    state.add_global_memory_writes(shape.x * (shape.y + 1) * (shape.z + 1)
+                                   * (sumBytes + (numOutputs - 1) * sizeof(double)));
+
+    cvcuda::Integral op;
+
+    // clang-format off
+
+    if (varShape < 0) // negative var shape means use Tensor
+    {
+        nvcv::Tensor src({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
+        nvcv::Tensor sum({{shape.x, shape.y + 1, shape.z + 1, 1}, "NHWC"}, sumType);
+        nvcv::Tensor sqsum = useSqSum ? nvcv::Tensor({{shape.x, shape.y + 1, shape.z + 1, 1}, "NHWC"}, nvcv::TYPE_F64)
+                                      : nvcv::Tensor{nullptr};
+
+        benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+        state.exec(nvbench::exec_tag::sync, [&op, &src, &sum, &sqsum](nvbench::launch &launch)
+        {
+            op(launch.get_stream(), src, sum, sqsum);
+        });
+    }
+    else // zero and positive var shape means use ImageBatchVarShape
+    {
+        nvcv::ImageBatchVarShape src(shape.x);
+        nvcv::ImageBatchVarShape sum(shape.x);
+        nvcv::ImageBatchVarShape sqsum(shape.x);
+
+        benchutils::FillImageBatch<T>(src, long2{shape.z, shape.y}, long2{varShape, varShape},
+                                      benchutils::RandomValues<T>());
+
+        for (int i = 0; i < src.numImages(); ++i)
+        {
+            nvcv::Size2D size{src[i].size().w + 1, src[i].size().h + 1};
+
+            sum.pushBack(nvcv::Image(size, sumFormat));
+            sqsum.pushBack(nvcv::Image(size, nvcv::FMT_F64));
+        }
+
+        nvcv::OptionalImageBatchVarShapeConstRef sqsumRef = useSqSum ? nvcv::OptionalImageBatchVarShapeConstRef{sqsum}
+                                                                     : nvcv::NullOpt;
+
+        state.exec(nvbench::exec_tag::sync, [&op, &src, &sum, &sqsumRef](nvbench::launch &launch)
+        {
+            op(launch.get_stream(), src, sum, sqsumRef);
+        });
+    }
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using IntegralTypes = nvbench::type_list<uint8_t, float>;
+
+NVBENCH_BENCH_TYPES(Integral, NVBENCH_TYPE_AXES(IntegralTypes))
+    .set_type_axes_names({"InDataType"})
+    .add_string_axis("shape", {"1x1080x1920", "16x1080x1920"})
+    .add_int64_axis("varShape", {-1, 0})
+    .add_int64_axis("sqsum", {0, 1});
@@ -98,3 +98,64 @@ NVBENCH_BENCH_TYPES(JointBilateralFilter, NVBENCH_TYPE_AXES(JointBilateralFilter
     .add_int64_axis("diameter", {-1})
     .add_float64_axis("sigmaSpace", {1.2})
     .add_string_axis("border", {"REFLECT"});
+
+// Exact filter against the bilateral grid approximation, sampled at the sigmas, with the spatial sigma growing with
+// the diameter as it does in practice
+template<typename T>
+inline void JointBilateralFilterGrid(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3       shape      = benchutils::GetShape<3>(state.get_string("shape"));
+    int         diameter   = static_cast<int>(state.get_int64("diameter"));
+    float       sigmaColor = static_cast<float>(state.get_float64("sigmaColor"));
+    float       sigmaSpace = diameter / 3.f;
+    std::string mode       = state.get_string("mode");
+
+    NVCVBilateralGridParams gridParams{sigmaSpace, sigmaColor};
+
+    state.add_global_memory_reads(2 * shape.x * shape.y * shape.z * sizeof(T));
+    state.add_global_memory_writes(shape.x * shape.y * shape.z * sizeof(T));
+
+    cvcuda::JointBilateralFilter op;
+
+    nvcv::Tensor src({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
+    nvcv::Tensor color({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
+    nvcv::Tensor dst({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
+
+    benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+    benchutils::FillTensor<T>(color, benchutils::RandomValues<T>());
+
+    // clang-format off
+
+    if (mode == "exact")
+    {
+        state.exec(nvbench::exec_tag::sync,
+                   [&op, &src, &color, &dst, &diameter, &sigmaColor, &sigmaSpace](nvbench::launch &launch)
+        {
+            op(launch.get_stream(), src, color, dst, diameter, sigmaColor, sigmaSpace, NVCV_BORDER_REFLECT101);
+        });
+    }
+    else
+    {
+        state.exec(nvbench::exec_tag::sync,
+                   [&op, &src, &color, &dst, &diameter, &sigmaColor, &sigmaSpace, &gridParams](nvbench::launch &launch)
+        {
+            op(launch.get_stream(), src, color, dst, diameter, sigmaColor, sigmaSpace, gridParams);
+        });
+    }
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using JointBilateralFilterGridTypes = nvbench::type_list<uint8_t>;
+
+NVBENCH_BENCH_TYPES(JointBilateralFilterGrid, NVBENCH_TYPE_AXES(JointBilateralFilterGridTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_int64_axis("diameter", {9, 15, 31, 61})
+    .add_float64_axis("sigmaColor", {30})
+    .add_string_axis("mode", {"exact", "grid"});
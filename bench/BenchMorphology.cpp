@@ -50,11 +50,25 @@ try
     {
         morphType = NVCV_CLOSE;
     }
+    else if (state.get_string("morphType") == "GRADIENT")
+    {
+        morphType = NVCV_GRADIENT;
+    }
+    else if (state.get_string("morphType") == "TOPHAT")
+    {
+        morphType = NVCV_TOPHAT;
+    }
+    else if (state.get_string("morphType") == "BLACKHAT")
+    {
+        morphType = NVCV_BLACKHAT;
+    }
 
     nvcv::Size2D mask{kernelSize.x, kernelSize.y};
     int2         anchor{-1, -1};
 
-    int bwIteration = (morphType == NVCV_OPEN || morphType == NVCV_CLOSE || iteration > 1) ? 2 * iteration : iteration;
+    bool needWorkspace = morphType != NVCV_ERODE && morphType != NVCV_DILATE;
+
+    int bwIteration = (needWorkspace || iteration > 1) ? 2 * iteration : iteration;
 
     state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T) * bwIteration);
     state.add_global_memory_writes(shape.x * shape.y * shape.z * sizeof(T) * bwIteration);
@@ -72,7 +86,7 @@ try
 
         nvcv::Tensor workspace{nullptr};
 
-        if (morphType == NVCV_OPEN || morphType == NVCV_CLOSE || iteration > 1)
+        if (needWorkspace || iteration > 1)
         {
             workspace = nvcv::Tensor({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
         }
@@ -101,7 +115,7 @@ try
 
         nvcv::ImageBatchVarShape workspace{nullptr};
 
-        if (morphType == NVCV_OPEN || morphType == NVCV_CLOSE || iteration > 1)
+        if (needWorkspace || iteration > 1)
         {
             workspace = nvcv::ImageBatchVarShape(shape.x);
 
@@ -133,3 +147,18 @@ NVBENCH_BENCH_TYPES(Morphology, NVBENCH_TYPE_AXES(MorphologyTypes))
     .add_string_axis("kernelSize", {"3x3"})
     .add_string_axis("morphType", {"ERODE", "DILATE", "OPEN", "CLOSE"})
     .add_string_axis("border", {"REPLICATE"});
+
+// Large masks and iterations of the document binarization workloads, running as separable passes whose cost does not
+// depend on the mask size
+
+using MorphologyLargeTypes = nvbench::type_list<uint8_t>;
+
+NVBENCH_BENCH_TYPES(Morphology, NVBENCH_TYPE_AXES(MorphologyLargeTypes))
+    .set_name("MorphologyLarge")
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920", "8x1080x1920"})
+    .add_int64_axis("varShape", {-1})
+    .add_int64_axis("iteration", {1, 5})
+    .add_string_axis("kernelSize", {"5x5", "15x15", "31x31", "1x31", "31x1"})
+    .add_string_axis("morphType", {"ERODE", "DILATE", "GRADIENT", "TOPHAT", "BLACKHAT"})
+    .add_string_axis("border", {"CONSTANT", "REFLECT101"});
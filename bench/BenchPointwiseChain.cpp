@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpConvertTo.hpp>
+#include <cvcuda/OpNormalize.hpp>
+#include <cvcuda/OpPointwiseChain.hpp>
+#include <cvcuda/OpReformat.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <limits>
+#include <vector>
+
+// Preprocessing of an interleaved RGB image into a normalized planar float tensor, either fused in a single
+// PointwiseChain pass or unfused as the sequence ConvertTo -> Normalize -> Reformat
+
+template<typename T>
+inline void PointwiseChain(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 shape    = benchutils::GetShape<3>(state.get_string("shape"));
+    long  varShape = state.get_int64("varShape");
+    bool  fused    = state.get_int64("fused") != 0;
+
+    constexpr long kChannels = 3;
+
+    long numElems = shape.x * shape.y * shape.z * kChannels;
+
+    state.add_global_memory_reads(numElems * sizeof(T));
+    state.add_global_memory_writes(numElems * sizeof(float));
+
+    // clang-format off
+
+    if (varShape < 0) // negative var shape means use Tensor
+    {
+        nvcv::Tensor src({{shape.x, shape.y, shape.z, kChannels}, "NHWC"}, benchutils::GetDataType<T>());
+        nvcv::Tensor dst({{shape.x, kChannels, shape.y, shape.z}, "NCHW"}, nvcv::TYPE_F32);
+
+        benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+        float mean[kChannels]{0.485f, 0.456f, 0.406f}, stddev[kChannels]{0.229f, 0.224f, 0.225f};
+        float range = static_cast<float>(std::numeric_limits<T>::max());
+
+        if (fused)
+        {
+            NVCVPointwiseStep step{};
+            step.type = NVCV_POINTWISE_SCALE_SHIFT;
+            for (int c = 0; c < kChannels; ++c)
+            {
+                step.scale[c] = 1.f / (range * stddev[c]);
+                step.shift[c] = -mean[c] / stddev[c];
+            }
+
+            std::vector<NVCVPointwiseStep> steps{step};
+
+            cvcuda::PointwiseChain op;
+
+            state.exec(nvbench::exec_tag::sync, [&op, &src, &dst, &steps](nvbench::launch &launch)
+            {
+                op(launch.get_stream(), src, dst, steps);
+            });
+        }
+        else
+        {
+            nvcv::Tensor tmp1({{shape.x, shape.y, shape.z, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+            nvcv::Tensor tmp2({{shape.x, shape.y, shape.z, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+            nvcv::Tensor base({{1, 1, 1, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+            nvcv::Tensor scale({{1, 1, 1, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+
+            benchutils::FillTensor<float>(base, [&mean](const long4_16a &coord){ return mean[coord.w]; });
+            benchutils::FillTensor<float>(scale, [&stddev](const long4_16a &coord){ return stddev[coord.w]; });
+
+            cvcuda::ConvertTo convertOp;
+            cvcuda::Normalize normalizeOp;
+            cvcuda::Reformat  reformatOp;
+
+            state.exec(nvbench::exec_tag::sync,
+                       [&convertOp, &normalizeOp, &reformatOp, &src, &tmp1, &tmp2, &base, &scale, &dst, &range]
+                       (nvbench::launch &launch)
+            {
+                convertOp(launch.get_stream(), src, tmp1, 1.0 / range, 0.0);
+                normalizeOp(launch.get_stream(), tmp1, base, scale, tmp2, 1.f, 0.f, 0.f,
+                            CVCUDA_NORMALIZE_SCALE_IS_STDDEV);
+                reformatOp(launch.get_stream(), tmp2, dst);
+            });
+        }
+    }
+    else // zero and positive var shape means use ImageBatchVarShape
+    {
+        throw std::invalid_argument("ImageBatchVarShape not implemented for this operator");
+    }
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using PointwiseChainTypes = nvbench::type_list<uint8_t, uint16_t>;
+
+NVBENCH_BENCH_TYPES(PointwiseChain, NVBENCH_TYPE_AXES(PointwiseChainTypes))
+    .set_type_axes_names({"InDataType"})
+    .add_string_axis("shape", {"1x1080x1920", "16x1080x1920"})
+    .add_int64_axis("varShape", {-1})
+    .add_int64_axis("fused", {0, 1});
@@ -97,7 +97,7 @@ using RandomResizedCropTypes = nvbench::type_list<uint8_t, float>;
 
 NVBENCH_BENCH_TYPES(RandomResizedCrop, NVBENCH_TYPE_AXES(RandomResizedCropTypes))
     .set_type_axes_names({"InOutDataType"})
-    .add_string_axis("shape", {"1x1080x1920"})
+    .add_string_axis("shape", {"1x1080x1920", "1024x224x224"})
     .add_int64_axis("varShape", {-1, 0})
     .add_string_axis("resizeType", {"EXPAND"})
     .add_string_axis("interpolation", {"LINEAR"});
@@ -21,6 +21,11 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <map>
+
 template<typename T>
 inline void WarpAffine(nvbench::state &state, nvbench::type_list<T>)
 try
@@ -93,3 +98,70 @@ NVBENCH_BENCH_TYPES(WarpAffine, NVBENCH_TYPE_AXES(WarpAffineTypes))
     .add_string_axis("border", {"REFLECT"})
     .add_string_axis("interpolation", {"CUBIC"})
     .add_string_axis("inverseMap", {"Y"});
+
+// Transforms with a dedicated kernel, compared to the general kernel forced with CVCUDA_WARP_ALGO=general
+
+template<typename T>
+inline void WarpAffineClass(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3       shape     = benchutils::GetShape<3>(state.get_string("shape"));
+    std::string transform = state.get_string("transform");
+    std::string algo      = state.get_string("algo");
+
+    NVCVBorderType        borderType = benchutils::GetBorderType(state.get_string("border"));
+    NVCVInterpolationType interpType = benchutils::GetInterpolationType(state.get_string("interpolation"));
+
+    int flags = interpType | NVCV_WARP_INVERSE_MAP;
+
+    float4 borderValue{0, 0, 0, 0};
+
+    // Maps from destination to source pixels, rotations swap the destination width and height
+    float w = shape.z - 1, h = shape.y - 1;
+    bool  swapSize = transform == "rotate90" || transform == "rotate270";
+
+    const std::map<std::string, std::array<float, 6>> transforms{
+        {"identity", {1.f, 0.f, 0.f, 0.f, 1.f, 0.f}},
+        {"translate", {1.f, 0.f, 16.f, 0.f, 1.f, -8.f}},
+        {"scale", {.5f, 0.f, 0.f, 0.f, .5f, 0.f}},
+        {"rotate90", {0.f, 1.f, 0.f, -1.f, 0.f, h}},
+        {"rotate180", {-1.f, 0.f, w, 0.f, -1.f, h}},
+        {"rotate270", {0.f, -1.f, w, 1.f, 0.f, 0.f}},
+        {"general", {.9f, .1f, 0.f, -.1f, .9f, 0.f}},
+    };
+
+    NVCVAffineTransform transMatrix;
+    std::copy_n(transforms.at(transform).begin(), 6, transMatrix);
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T));
+    state.add_global_memory_writes(shape.x * shape.y * shape.z * sizeof(T));
+
+    setenv("CVCUDA_WARP_ALGO", algo.c_str(), 1);
+
+    cvcuda::WarpAffine op(0);
+
+    nvcv::Tensor src({{shape.x, shape.y, shape.z, 1}, "NHWC"}, benchutils::GetDataType<T>());
+    nvcv::Tensor dst({{shape.x, swapSize ? shape.z : shape.y, swapSize ? shape.y : shape.z, 1}, "NHWC"},
+                     benchutils::GetDataType<T>());
+
+    benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+    state.exec(nvbench::exec_tag::sync,
+               [&op, &src, &dst, &transMatrix, &flags, &borderType, &borderValue](nvbench::launch &launch)
+               { op(launch.get_stream(), src, dst, transMatrix, flags, borderType, borderValue); });
+
+    unsetenv("CVCUDA_WARP_ALGO");
+}
+catch (const std::exception &err)
+{
+    unsetenv("CVCUDA_WARP_ALGO");
+    state.skip(err.what());
+}
+
+NVBENCH_BENCH_TYPES(WarpAffineClass, NVBENCH_TYPE_AXES(WarpAffineTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_string_axis("transform", {"identity", "translate", "scale", "rotate90", "rotate180", "rotate270", "general"})
+    .add_string_axis("algo", {"auto", "general"})
+    .add_string_axis("border", {"CONSTANT"})
+    .add_string_axis("interpolation", {"LINEAR"});
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpAdvCvtColor.hpp>
+#include <cvcuda/OpNormalize.hpp>
+#include <cvcuda/OpReformat.hpp>
+#include <cvcuda/OpResizeCropConvertReformat.hpp>
+#include <cvcuda/OpYUVResizeCropNormalize.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+// Preprocessing of NV12 frames into a normalized planar float tensor, either fused in a single
+// YUVResizeCropNormalize pass or unfused as the sequence AdvCvtColor -> ResizeCropConvertReformat -> Normalize ->
+// Reformat
+
+template<typename T>
+inline void YUVResizeCropNormalize(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 shape    = benchutils::GetShape<3>(state.get_string("shape"));
+    long2 resize   = benchutils::GetShape<2>(state.get_string("resize"));
+    long2 crop     = benchutils::GetShape<2>(state.get_string("crop"));
+    long  varShape = state.get_int64("varShape");
+    bool  fused    = state.get_int64("fused") != 0;
+
+    NVCVInterpolationType interpType = benchutils::GetInterpolationType(state.get_string("interpolation"));
+
+    constexpr long kChannels = 3;
+
+    // resize and crop shapes are given as HxW, the crop is centered in the resized image
+    NVCVSize2D resizeDim{(int)resize.y, (int)resize.x};
+    int2       cropPos{(int)((resize.y - crop.y) / 2), (int)((resize.x - crop.x) / 2)};
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * 3 / 2);
+    state.add_global_memory_writes(shape.x * crop.x * crop.y * kChannels * sizeof(T));
+
+    // clang-format off
+
+    if (varShape < 0) // negative var shape means use Tensor
+    {
+        nvcv::Tensor src({{shape.x, shape.y * 3 / 2, shape.z, 1}, "NHWC"}, nvcv::TYPE_U8);
+        nvcv::Tensor dst({{shape.x, kChannels, crop.x, crop.y}, "NCHW"}, benchutils::GetDataType<T>());
+
+        benchutils::FillTensor<uint8_t>(src, benchutils::RandomValues<uint8_t>());
+
+        float3 mean{123.675f, 116.28f, 103.53f}, stddev{58.395f, 57.12f, 57.375f};
+
+        if (fused)
+        {
+            cvcuda::YUVResizeCropNormalize op;
+
+            state.exec(nvbench::exec_tag::sync,
+                       [&op, &src, &dst, &resizeDim, &interpType, &cropPos, &mean, &stddev](nvbench::launch &launch)
+            {
+                op(launch.get_stream(), src, dst, NVCV_COLOR_YUV2RGB_NV12, NVCV_COLOR_SPEC_BT601, resizeDim,
+                   interpType, cropPos, mean, stddev);
+            });
+        }
+        else
+        {
+            nvcv::Tensor rgb({{shape.x, shape.y, shape.z, kChannels}, "NHWC"}, nvcv::TYPE_U8);
+            nvcv::Tensor tmp1({{shape.x, crop.x, crop.y, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+            nvcv::Tensor tmp2({{shape.x, crop.x, crop.y, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+            nvcv::Tensor base({{1, 1, 1, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+            nvcv::Tensor scale({{1, 1, 1, kChannels}, "NHWC"}, nvcv::TYPE_F32);
+
+            float meanArr[kChannels]{mean.x, mean.y, mean.z}, stddevArr[kChannels]{stddev.x, stddev.y, stddev.z};
+
+            benchutils::FillTensor<float>(base, [&meanArr](const long4_16a &coord){ return meanArr[coord.w]; });
+            benchutils::FillTensor<float>(scale, [&stddevArr](const long4_16a &coord){ return stddevArr[coord.w]; });
+
+            cvcuda::AdvCvtColor               cvtColorOp;
+            cvcuda::ResizeCropConvertReformat resizeOp;
+            cvcuda::Normalize                 normalizeOp;
+            cvcuda::Reformat                  reformatOp;
+
+            state.exec(nvbench::exec_tag::sync,
+                       [&cvtColorOp, &resizeOp, &normalizeOp, &reformatOp, &src, &rgb, &tmp1, &tmp2, &base, &scale,
+                        &dst, &resizeDim, &interpType, &cropPos](nvbench::launch &launch)
+            {
+                cvtColorOp(launch.get_stream(), src, rgb, NVCV_COLOR_YUV2RGB_NV12, NVCV_COLOR_SPEC_BT601);
+                resizeOp(launch.get_stream(), rgb, tmp1, resizeDim, interpType, cropPos);
+                normalizeOp(launch.get_stream(), tmp1, base, scale, tmp2, 1.f, 0.f, 0.f,
+                            CVCUDA_NORMALIZE_SCALE_IS_STDDEV);
+                reformatOp(launch.get_stream(), tmp2, dst);
+            });
+        }
+    }
+    else // zero and positive var shape means use ImageBatchVarShape
+    {
+        throw std::invalid_argument("ImageBatchVarShape not implemented for this benchmark");
+    }
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using YUVResizeCropNormalizeTypes = nvbench::type_list<float>;
+
+NVBENCH_BENCH_TYPES(YUVResizeCropNormalize, NVBENCH_TYPE_AXES(YUVResizeCropNormalizeTypes))
+    .set_type_axes_names({"OutDataType"})
+    .add_string_axis("shape", {"1x1080x1920", "16x1080x1920"})
+    .add_string_axis("resize", {"256x456"})
+    .add_string_axis("crop", {"224x224"})
+    .add_string_axis("interpolation", {"LINEAR"})
+    .add_int64_axis("varShape", {-1})
+    .add_int64_axis("fused", {0, 1});
@@ -0,0 +1,43 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+
+# NOTE: One must import PyCuda driver first, before CVCUDA or VPF otherwise
+# things may throw unexpected errors.
+import pycuda.driver as cuda  # noqa: F401
+from bench_utils import AbstractOpBase
+
+# Measures the Python-side overhead of calling a trivial operator: 1000 flips of a 1x1 image
+# with the same ctor arguments, so every call after the first fetches the same operator instance.
+# The kernels are negligible, calls/sec is n_calls divided by the reported time.
+
+
+class OpOperatorCache(AbstractOpBase):
+    def setup(self, input):
+        super().setup(input)
+
+        self.n_calls = 1000
+        self.src = cvcuda.Tensor((1, 1, 1, 1), cvcuda.Type.U8, "NHWC")
+        self.dst = cvcuda.Tensor((1, 1, 1, 1), cvcuda.Type.U8, "NHWC")
+
+    def run(self, input):
+        stream = cvcuda.Stream.current
+
+        for _ in range(self.n_calls):
+            cvcuda.flip_into(self.dst, self.src, 1, stream=stream)
+
+        stream.sync()
+        return
@@ -0,0 +1,71 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+
+# NOTE: One must import PyCuda driver first, before CVCUDA or VPF otherwise
+# things may throw unexpected errors.
+import pycuda.driver as cuda  # noqa: F401
+from bench_utils import AbstractOpBase
+
+# Measures the per-call host overhead of releasing the resources held by each operator call.
+# A tiny tensor keeps the kernels negligible, and calls alternate between several streams, which
+# is where a single callback stream shared by all of them becomes the bottleneck.
+
+
+class BaseOpResourceRetirement(AbstractOpBase):
+    def setup(self, input, mode):
+        super().setup(input)
+
+        self.mode = mode
+        self.n_calls = 1000
+        self.streams = [cvcuda.Stream() for _ in range(4)]
+        self.src = cvcuda.Tensor((1, 16, 16, 3), cvcuda.Type.U8, "NHWC")
+        self.dst = cvcuda.Tensor((1, 16, 16, 3), cvcuda.Type.U8, "NHWC")
+
+    def run(self, input):
+        # make this benchmark compatible with older cvcuda versions
+        if not hasattr(cvcuda, "set_resource_retirement"):
+            return
+
+        previous = cvcuda.get_resource_retirement()
+        cvcuda.set_resource_retirement(getattr(cvcuda.ResourceRetirement, self.mode))
+
+        for ii in range(self.n_calls):
+            cvcuda.flip_into(
+                self.dst, self.src, 0, stream=self.streams[ii % len(self.streams)]
+            )
+
+        for stream in self.streams:
+            stream.sync()
+
+        cvcuda.set_resource_retirement(previous)
+        return
+
+
+class OpResourceRetirementCallback(BaseOpResourceRetirement):
+    def setup(self, input):
+        super().setup(input, "CALLBACK")
+
+    def run(self, input):
+        super().run(input)
+
+
+class OpResourceRetirementEvent(BaseOpResourceRetirement):
+    def setup(self, input):
+        super().setup(input, "EVENT")
+
+    def run(self, input):
+        super().run(input)
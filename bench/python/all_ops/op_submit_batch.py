@@ -0,0 +1,72 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+
+# NOTE: One must import PyCuda driver first, before CVCUDA or VPF otherwise
+# things may throw unexpected errors.
+import pycuda.driver as cuda  # noqa: F401
+from bench_utils import AbstractOpBase
+
+# Compares submitting 1000 tiny operator calls one by one from Python against submitting
+# them in one cvcuda.submit_batch call, which holds the resources of all calls once.
+# 64x64 crops keep the kernels negligible, so the timing is dominated by the per-call overhead.
+
+
+class BaseOpSubmitBatch(AbstractOpBase):
+    def setup(self, input, batched):
+        super().setup(input)
+
+        self.batched = batched
+        self.n_calls = 1000
+        self.src = cvcuda.Tensor((1, 64, 64, 3), cvcuda.Type.U8, "NHWC")
+        self.dst = [
+            cvcuda.Tensor((1, 64, 64, 3), cvcuda.Type.U8, "NHWC") for _ in range(4)
+        ]
+        self.calls = [
+            (cvcuda.flip_into, (self.dst[ii % len(self.dst)], self.src, ii % 2))
+            for ii in range(self.n_calls)
+        ]
+
+    def run(self, input):
+        stream = cvcuda.Stream.current
+
+        if self.batched:
+            # make this benchmark compatible with older cvcuda versions
+            if not hasattr(cvcuda, "submit_batch"):
+                return
+            cvcuda.submit_batch(self.calls, stream=stream)
+        else:
+            for func, args in self.calls:
+                func(*args, stream=stream)
+
+        stream.sync()
+        return
+
+
+class OpSubmitBatchPerOp(BaseOpSubmitBatch):
+    def setup(self, input):
+        super().setup(input, False)
+
+    def run(self, input):
+        super().run(input)
+
+
+class OpSubmitBatchBatched(BaseOpSubmitBatch):
+    def setup(self, input):
+        super().setup(input, True)
+
+    def run(self, input):
+        super().run(input)
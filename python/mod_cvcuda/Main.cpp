@@ -136,6 +136,9 @@ PYBIND11_MODULE(_cvcuda, m)
         ExportOpSIFT(m);
         ExportOpMinMaxLoc(m);
         ExportOpHistogram(m);
+        ExportOpImageStats(m);
+        ExportOpIntegral(m);
+        ExportOpAdaptiveHistogramEq(m);
         ExportOpMinAreaRect(m);
         ExportOpBndBox(m);
         ExportOpBoxBlur(m);
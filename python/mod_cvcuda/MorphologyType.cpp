@@ -27,7 +27,10 @@ void ExportMorphologyType(py::module &m)
         .value("ERODE", NVCV_ERODE)
         .value("DILATE", NVCV_DILATE)
         .value("OPEN", NVCV_OPEN)
-        .value("CLOSE", NVCV_CLOSE);
+        .value("CLOSE", NVCV_CLOSE)
+        .value("GRADIENT", NVCV_GRADIENT)
+        .value("TOPHAT", NVCV_TOPHAT)
+        .value("BLACKHAT", NVCV_BLACKHAT);
 }
 
 } // namespace cvcudapy
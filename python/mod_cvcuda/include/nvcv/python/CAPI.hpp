@@ -85,6 +85,8 @@ struct CAPI
 
     void (*TensorBatch_Clear)(PyObject *tensorBatch);
 
+    uint64_t (*Cache_GetGeneration)();
+
     // always add new functions at the end, and never change the function prototypes above.
 };
 
@@ -96,6 +96,13 @@ public:
         capi().Cache_RemoveAllNotInUseMatching(&key);
         CheckCAPIError();
     }
+
+    // Returns a counter that changes whenever items are removed from the cache,
+    // e.g. by clear_cache. Items fetched under an older generation might be stale.
+    static uint64_t generation()
+    {
+        return capi().Cache_GetGeneration();
+    }
 };
 
 } // namespace nvcvpy
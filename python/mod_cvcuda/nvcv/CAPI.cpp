@@ -407,6 +407,11 @@ extern "C" void ImplCache_RemoveAllNotInUseMatching(const IKey *pkey)
     CATCH_RETURN_DEFAULT(, "Cache cleanup failed when removing all not in use matching")
 }
 
+extern "C" uint64_t ImplCache_GetGeneration()
+{
+    return Cache::Generation();
+}
+
 } // namespace
 
 // Note these functions will set a PyError if an exception is thrown, this must be then checked by calling
@@ -443,6 +448,7 @@ void ExportCAPI(py::module &m)
         .TensorBatch_PushBack            = &ImplTensorBatch_PushBack,
         .TensorBatch_PopBack             = &ImplTensorBatch_PopBack,
         .TensorBatch_Clear               = &ImplTensorBatch_Clear,
+        .Cache_GetGeneration             = &ImplCache_GetGeneration,
     };
 
     m.add_object("_C_API", py::capsule(&capi, "cvcuda._C_API"));
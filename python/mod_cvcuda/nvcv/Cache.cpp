@@ -89,6 +89,10 @@ struct Cache::Impl
     inline static std::mutex mtx;
     inline static int64_t    cache_limit_inbytes;
     inline static int64_t    current_size_inbytes;
+
+    // Bumped whenever items are dropped from any cache instance, so that
+    // lookaside caches of fetched items know when to invalidate themselves.
+    inline static std::atomic<uint64_t> generation;
 };
 
 Cache::Cache()
@@ -146,6 +150,7 @@ void Cache::add(CacheItem &item)
             // we clear the cache: all pimpl->items will be dtor'ed at the end of scope of savedItems and cache size will be reset to 0
             savedItems                  = std::move(pimpl->items);
             pimpl->current_size_inbytes = 0;
+            ++pimpl->generation;
         }
 
         pimpl->items.emplace(&item.key(), item.shared_from_this());
@@ -188,6 +193,11 @@ void Cache::removeAllNotInUseMatching(const IKey &key)
                 ++it;
             }
         }
+
+        if (!holdItemsUntilMtxUnlocked.empty())
+        {
+            ++pimpl->generation;
+        }
     }
 }
 
@@ -246,6 +256,7 @@ std::shared_ptr<CacheItem> Cache::fetchOne(const IKey &key) const
 void Cache::clear()
 {
     pimpl->items.clear();
+    ++pimpl->generation;
 }
 
 size_t Cache::size() const
@@ -279,6 +290,7 @@ void Cache::setCacheLimit(int64_t new_cache_limit_inbytes)
             // we clear the cache: all pimpl->items will be dtor'ed at the end of scope of savedItems and cache size will be reset to 0
             savedItems                  = std::move(pimpl->items);
             pimpl->current_size_inbytes = 0;
+            ++pimpl->generation;
         }
         pimpl->cache_limit_inbytes = new_cache_limit_inbytes;
     }
@@ -342,9 +354,15 @@ void Cache::ClearAll()
         std::for_each(instances.begin(), instances.end(),
                       [&](Cache *instance) { savedItems.merge(instance->pimpl->items); });
         Cache::Impl::current_size_inbytes = 0;
+        ++Cache::Impl::generation;
     }
 }
 
+uint64_t Cache::Generation()
+{
+    return Cache::Impl::generation.load(std::memory_order_acquire);
+}
+
 size_t Cache::TotalSize()
 {
     std::lock_guard<std::mutex> lk(Cache::Impl::mtx);
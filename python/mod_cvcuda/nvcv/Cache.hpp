@@ -44,7 +44,7 @@ public:
 
     virtual int64_t GetSizeInBytes() const = 0;
 
-    bool isInUse() const;
+    virtual bool isInUse() const;
 
 protected:
     CacheItem();
@@ -77,6 +77,13 @@ public:
         return obj->key();
     }
 
+    bool isInUse() const override
+    {
+        // Operators are referenced by this item only while idle, otherwise they're still needed by pending
+        // work or by whoever fetched them
+        return CacheItem::isInUse() || obj.use_count() > 1;
+    }
+
 private:
     int64_t doComputeSizeInBytes()
     {
@@ -97,6 +104,9 @@ public:
     static void   ClearAll();
     static size_t TotalSize();
 
+    // Counter that changes every time items are removed from the cache.
+    static uint64_t Generation();
+
     void add(CacheItem &container);
     void removeAllNotInUseMatching(const IKey &key);
 
@@ -27,6 +27,10 @@
 #include <common/String.hpp>
 #include <pybind11/operators.h>
 
+#include <algorithm>
+#include <set>
+#include <utility>
+
 namespace nvcvpy::priv {
 
 // Static members initialization
@@ -35,6 +39,45 @@ std::atomic<int> Stream::m_instanceCount = 0;
 std::mutex       Stream::m_auxStreamMutex;
 std::mutex       Stream::m_gcMutex;
 
+std::atomic<ResourceRetirement> Stream::m_retirement = ResourceRetirement::CALLBACK;
+
+namespace {
+
+// Resources held by work submitted to a stream, released once the event recorded after that work completes
+struct RetiredResources
+{
+    cudaEvent_t                   event = nullptr;
+    std::shared_ptr<const Stream> stream;
+    LockResources                 resources;
+};
+
+struct RetirementQueue
+{
+    std::mutex                    mutex;
+    std::vector<RetiredResources> pending;
+    std::vector<cudaEvent_t>      eventPool;
+};
+
+RetirementQueue &GetRetirementQueue()
+{
+    // Defined inside the function for the same reason as the gc bag, see GetGCBag.
+    static RetirementQueue queue;
+    return queue;
+}
+
+// Resources held by the operators submitted to a stream while this thread runs a batch submission on it
+struct BatchSubmission
+{
+    const Stream                                    *stream = nullptr;
+    LockResources                                    resources;
+    std::set<std::pair<LockMode, const Resource *>> seen;
+    BatchSubmission                                 *prev = nullptr;
+};
+
+thread_local BatchSubmission *g_batchSubmission = nullptr;
+
+} // namespace
+
 // Here we define the representation of external cuda streams.
 // It defines pybind11's type casters from the python object
 // to the corresponding ExternalStream<E>.
@@ -336,8 +379,13 @@ intptr_t Stream::pyhandle() const
 
 void Stream::sync()
 {
-    py::gil_scoped_release release;
-    util::CheckThrow(cudaStreamSynchronize(m_handle));
+    {
+        py::gil_scoped_release release;
+        util::CheckThrow(cudaStreamSynchronize(m_handle));
+    }
+
+    // Whatever was retired on this stream is done now
+    PollRetiredResources();
 }
 
 Stream &Stream::Current()
@@ -357,6 +405,55 @@ void Stream::deactivate(py::object exc_type, py::object exc_value, py::object ex
     StreamStack::Instance().pop();
 }
 
+py::list Stream::submitBatch(py::iterable calls)
+{
+    BatchSubmission batch;
+    batch.stream      = this;
+    batch.prev        = g_batchSubmission;
+    g_batchSubmission = &batch;
+
+    // Work submitted before a failing call still needs its resources held
+    auto finish = [this, &batch]()
+    {
+        g_batchSubmission = batch.prev;
+        this->holdResources(std::move(batch.resources));
+    };
+
+    py::object pyStream = py::cast(this->shared_from_this());
+    py::list   results;
+
+    try
+    {
+        for (py::handle call : calls)
+        {
+            py::tuple t = py::cast<py::tuple>(call);
+            if (t.size() != 2 && t.size() != 3)
+            {
+                throw std::invalid_argument("Each batched call must be a (callable, args) or (callable, args, kwargs) "
+                                            "tuple");
+            }
+
+            py::object func = t[0];
+            py::tuple  args(py::object(t[1]));
+            py::dict   kwargs = t.size() == 3 ? py::dict(py::object(t[2])) : py::dict();
+            if (!kwargs.contains("stream"))
+            {
+                kwargs["stream"] = pyStream;
+            }
+
+            results.append(func(*args, **kwargs));
+        }
+    }
+    catch (...)
+    {
+        finish();
+        throw;
+    }
+
+    finish();
+    return results;
+}
+
 // Stores the data held by a cuda host callback function in a cuda stream.
 // It's used for:
 // - Extend the lifetime of the objects it contains until they aren't needed
@@ -368,74 +465,211 @@ struct Stream::HostFunctionClosure
     LockResources                 resources;
 };
 
+void Stream::SetResourceRetirement(ResourceRetirement mode)
+{
+    m_retirement.store(mode, std::memory_order_relaxed);
+}
+
+ResourceRetirement Stream::GetResourceRetirement()
+{
+    return m_retirement.load(std::memory_order_relaxed);
+}
+
 void Stream::holdResources(LockResources usedResources)
 {
-    if (!usedResources.empty())
+    if (usedResources.empty())
+    {
+        return;
+    }
+
+    // Inside a batch submission the resources are held once, after the whole batch is submitted
+    if (BatchSubmission *batch = g_batchSubmission; batch != nullptr && batch->stream == this)
+    {
+        for (auto &[lockMode, res] : usedResources)
+        {
+            if (batch->seen.emplace(lockMode, res.get()).second)
+            {
+                batch->resources.emplace(lockMode, std::move(res));
+            }
+        }
+        return;
+    }
+
+    switch (GetResourceRetirement())
+    {
+    case ResourceRetirement::CALLBACK:
+        holdResourcesWithCallback(std::move(usedResources));
+        break;
+    case ResourceRetirement::EVENT:
+        holdResourcesWithEvent(std::move(usedResources));
+        break;
+    }
+}
+
+void Stream::holdResourcesWithEvent(LockResources usedResources)
+{
+    // Release what earlier submits are done with first, so that the queue only grows with the work in flight.
+    PollRetiredResources();
+
+    RetirementQueue &queue = GetRetirementQueue();
+
+    cudaEvent_t event = nullptr;
     {
-        // Looks like a good place to clear the gc bag, as every time we create
-        // a new closure that eventually gets added to the bag, we empty it.
-        // The bag shouldn't grow unlimited.
-        // Calling it before allocating a new closure just avoid having two
-        // closures not inside a cuda stream that are simultaneously alive, but
-        // in practice it doesn't seem to matter much.
-        ClearGCBag();
+        std::lock_guard lk(queue.mutex);
+        if (!queue.eventPool.empty())
+        {
+            event = queue.eventPool.back();
+            queue.eventPool.pop_back();
+        }
+    }
+
+    if (event == nullptr)
+    {
+        util::CheckThrow(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
 
-        auto closure = std::make_unique<HostFunctionClosure>();
+    if (cudaError_t err = cudaEventRecord(event, m_handle); err != cudaSuccess)
+    {
+        std::lock_guard lk(queue.mutex);
+        queue.eventPool.push_back(event);
+        util::CheckThrow(err);
+    }
+
+    RetiredResources retired;
+    retired.event     = event;
+    retired.stream    = this->shared_from_this();
+    retired.resources = std::move(usedResources);
 
-        closure->stream    = this->shared_from_this();
-        closure->resources = std::move(usedResources);
+    std::lock_guard lk(queue.mutex);
+    queue.pending.push_back(std::move(retired));
+}
+
+int Stream::PollRetiredResources()
+{
+    RetirementQueue &queue = GetRetirementQueue();
 
-        auto fn = [](cudaStream_t stream, cudaError_t error, void *userData) -> void
+    std::vector<RetiredResources> completed;
+    {
+        std::lock_guard lk(queue.mutex);
+
+        // Work submitted to different streams completes out of order, so every entry must be checked.
+        auto itPending = std::stable_partition(queue.pending.begin(), queue.pending.end(),
+                                               [](const RetiredResources &retired)
+                                               {
+                                                   cudaError_t err = cudaEventQuery(retired.event);
+                                                   if (err == cudaErrorNotReady)
+                                                   {
+                                                       return false;
+                                                   }
+                                                   // On errors the work won't run anymore, the resources can go
+                                                   util::CheckLog(err);
+                                                   return true;
+                                               });
+
+        completed.assign(std::make_move_iterator(queue.pending.begin()), std::make_move_iterator(itPending));
+        queue.pending.erase(queue.pending.begin(), itPending);
+
+        for (const RetiredResources &retired : completed)
         {
-            std::unique_ptr<HostFunctionClosure> pclosure(reinterpret_cast<HostFunctionClosure *>(userData));
-            NVCV_ASSERT(pclosure != nullptr);
-            AddToGCBag(std::move(pclosure));
-        };
-
-        // If we naively execute the callback in the main stream (m_handle), the GPU will wait until the callback
-        // is executed (on host). For correctness, GPU doesn't need to wait - it's the CPU that needs
-        // to wait for the work already scheduled to complete.
-        //
-        // Naive timeline:
-        //
-        // stream        GPU_kernel1 | Callback | GPU_kernel2
-        // GPU activity  xxxxxxxxxxx              xxxxxxxxxxx
-        // CPU activity                xxxxxxxx
-        //
-        // Optimized timeline
-        //
-        //
-        //                event -----v
-        // stream        GPU_kernel1 | GPU_kernel2
-        // aux_stream     waitEvent >| Callback
-        //
-        // GPU activity  xxxxxxxxxxx   xxxxxxxxxxx
-        // CPU activity                xxxxxxxx
-
-        util::CheckThrow(cudaEventRecord(m_event, m_handle)); // add async record the event in the main stream
-        util::CheckThrow(
-            cudaStreamWaitEvent(GetAuxStream(), m_event)); // add async wait for the event in the aux stream
-
-        // cudaStreamAddCallback pushes a task to the given stream, which at some point (asynchonously) calls
-        // the given callback (fn), passing to it the closure we created, among other stream states.
-        // When fn is executed, the refcnt of all objects that the closure holds will eventually be decremented, which
-        // will trigger their deletion if refcnt==0. This effectively extends the objects' lifetime until
-        // all tasks that refer to them are finished.
-
-        // The callback will be executed in the singleton aux stream there may be contention with other callbacks and waitEvents from
-        // other streams. However the callback is used to release resources from the cache and should not be a performance bottleneck.
-        // This avoids opening a new aux stream for each stream object.
-
-        // NOTE: cudaStreamAddCallback is slated for deprecation, without a proper replacement (for now).
-        // The other option we could use is cudaLaunchHostFunc, but it doesn't guarantee that the callback
-        // will be called. We need this guarantee to make sure the object's refcount is eventually decremented,
-        // and the closure is freed, avoiding memory leaks.
-        // cudaLaunchHostFunc won't call the callback if the current cuda context is in error state, for instance.
-        // Ref: CUDA SDK docs for both functions.
-        util::CheckThrow(
-            cudaStreamAddCallback(GetAuxStream(), fn, closure.get(), 0)); // add async callback in the aux stream
-        closure.release();
+            queue.eventPool.push_back(retired.event);
+        }
+    }
+
+    // The resources are released with the mutex unlocked, as their destruction might reach the cache.
+    return static_cast<int>(completed.size());
+}
+
+void Stream::DrainRetiredResources()
+{
+    RetirementQueue &queue = GetRetirementQueue();
+
+    std::vector<RetiredResources> pending;
+    std::vector<cudaEvent_t>      eventPool;
+    {
+        std::lock_guard lk(queue.mutex);
+        using std::swap;
+        swap(pending, queue.pending);
+        swap(eventPool, queue.eventPool);
+    }
+
+    for (RetiredResources &retired : pending)
+    {
+        util::CheckLog(cudaEventSynchronize(retired.event));
+        eventPool.push_back(retired.event);
     }
+    pending.clear();
+
+    for (cudaEvent_t event : eventPool)
+    {
+        util::CheckLog(cudaEventDestroy(event));
+    }
+}
+
+void Stream::holdResourcesWithCallback(LockResources usedResources)
+{
+    // Looks like a good place to clear the gc bag, as every time we create
+    // a new closure that eventually gets added to the bag, we empty it.
+    // The bag shouldn't grow unlimited.
+    // Calling it before allocating a new closure just avoid having two
+    // closures not inside a cuda stream that are simultaneously alive, but
+    // in practice it doesn't seem to matter much.
+    ClearGCBag();
+
+    auto closure = std::make_unique<HostFunctionClosure>();
+
+    closure->stream    = this->shared_from_this();
+    closure->resources = std::move(usedResources);
+
+    auto fn = [](cudaStream_t stream, cudaError_t error, void *userData) -> void
+    {
+        std::unique_ptr<HostFunctionClosure> pclosure(reinterpret_cast<HostFunctionClosure *>(userData));
+        NVCV_ASSERT(pclosure != nullptr);
+        AddToGCBag(std::move(pclosure));
+    };
+
+    // If we naively execute the callback in the main stream (m_handle), the GPU will wait until the callback
+    // is executed (on host). For correctness, GPU doesn't need to wait - it's the CPU that needs
+    // to wait for the work already scheduled to complete.
+    //
+    // Naive timeline:
+    //
+    // stream        GPU_kernel1 | Callback | GPU_kernel2
+    // GPU activity  xxxxxxxxxxx              xxxxxxxxxxx
+    // CPU activity                xxxxxxxx
+    //
+    // Optimized timeline
+    //
+    //
+    //                event -----v
+    // stream        GPU_kernel1 | GPU_kernel2
+    // aux_stream     waitEvent >| Callback
+    //
+    // GPU activity  xxxxxxxxxxx   xxxxxxxxxxx
+    // CPU activity                xxxxxxxx
+
+    util::CheckThrow(cudaEventRecord(m_event, m_handle)); // add async record the event in the main stream
+    util::CheckThrow(
+        cudaStreamWaitEvent(GetAuxStream(), m_event)); // add async wait for the event in the aux stream
+
+    // cudaStreamAddCallback pushes a task to the given stream, which at some point (asynchonously) calls
+    // the given callback (fn), passing to it the closure we created, among other stream states.
+    // When fn is executed, the refcnt of all objects that the closure holds will eventually be decremented, which
+    // will trigger their deletion if refcnt==0. This effectively extends the objects' lifetime until
+    // all tasks that refer to them are finished.
+
+    // The callback will be executed in the singleton aux stream there may be contention with other callbacks and waitEvents from
+    // other streams. However the callback is used to release resources from the cache and should not be a performance bottleneck.
+    // This avoids opening a new aux stream for each stream object.
+
+    // NOTE: cudaStreamAddCallback is slated for deprecation, without a proper replacement (for now).
+    // The other option we could use is cudaLaunchHostFunc, but it doesn't guarantee that the callback
+    // will be called. We need this guarantee to make sure the object's refcount is eventually decremented,
+    // and the closure is freed, avoiding memory leaks.
+    // cudaLaunchHostFunc won't call the callback if the current cuda context is in error state, for instance.
+    // Ref: CUDA SDK docs for both functions.
+    util::CheckThrow(
+        cudaStreamAddCallback(GetAuxStream(), fn, closure.get(), 0)); // add async callback in the aux stream
+    closure.release();
 }
 
 Stream::GCBag &Stream::GetGCBag()
@@ -496,6 +730,8 @@ static void ExportExternalStream(py::module &m)
 
 void Stream::Export(py::module &m)
 {
+    using namespace pybind11::literals;
+
     py::class_<Stream, std::shared_ptr<Stream>, CacheItem> stream(m, "Stream");
 
     stream
@@ -507,6 +743,57 @@ void Stream::Export(py::module &m)
     py::module_ internal = m.attr(INTERNAL_SUBMODULE_NAME);
     internal.def("syncAuxStream", &SyncAuxStream);
 
+    py::enum_<ResourceRetirement>(m, "ResourceRetirement")
+        .value("CALLBACK", ResourceRetirement::CALLBACK,
+               "Release resources from a host callback as soon as the work using them completes.")
+        .value("EVENT", ResourceRetirement::EVENT,
+               "Record a pooled event after the work and release the resources when a later operator call, "
+               "stream sync or poll observes it completed.");
+
+    m.def("set_resource_retirement", &SetResourceRetirement, "mode"_a, R"pbdoc(
+        Sets how resources used by submitted operators are released once the operators complete.
+
+        ``cvcuda.ResourceRetirement.EVENT`` avoids a host callback per operator call, which helps when many
+        streams submit at a high rate, at the cost of keeping resources alive until the next operator call,
+        ``Stream.sync()`` or ``poll_retired_resources()``.
+
+        Args:
+            mode (cvcuda.ResourceRetirement): Retirement mode, ``cvcuda.ResourceRetirement.CALLBACK`` by default.
+    )pbdoc");
+    m.def("get_resource_retirement", &GetResourceRetirement, "Returns the current resource retirement mode.");
+    m.def(
+        "submit_batch",
+        [](py::iterable calls, std::shared_ptr<Stream> stream)
+        { return (stream ? *stream : Current()).submitBatch(std::move(calls)); },
+        "calls"_a, py::kw_only(), "stream"_a = nullptr, R"pbdoc(
+        Submits a sequence of operator calls to a CUDA stream in a single call.
+
+        The calls run back to back without returning to the interpreter, and the resources used by all of them
+        are held together once, after the last one is submitted, instead of once per operator call. This pays
+        off when the kernels are tiny and the per-call overhead dominates.
+
+        Args:
+            calls (Iterable[tuple]): The calls, each one a ``(func, args)`` or ``(func, args, kwargs)`` tuple,
+                                     e.g. ``(cvcuda.flip_into, (dst, src, 0))``.
+            stream (cvcuda.Stream, optional): CUDA Stream passed to every call that doesn't specify its own.
+                                              Defaults to the current stream.
+
+        Returns:
+            list: The return value of each call, in order.
+
+        Note:
+            Calls given their own ``stream`` in ``kwargs`` hold their resources separately.
+    )pbdoc");
+    m.def("poll_retired_resources", &PollRetiredResources, R"pbdoc(
+        Releases the event-retired resources whose operators have completed.
+
+        Returns:
+            int: The number of operator calls whose resources were released.
+    )pbdoc");
+
+    // Make sure no resource outlives the script waiting on an event.
+    util::RegisterCleanup(m, &DrainRetiredResources);
+
     // Create the global stream object by wrapping cuda stream 0.
     // It'll be destroyed when python module is deinitialized.
     static priv::ExternalStream<priv::VOIDP> cudaDefaultStream((cudaStream_t)0);
@@ -44,6 +44,15 @@ public:
 
 using LockResources = std::unordered_multimap<LockMode, std::shared_ptr<const Resource>>;
 
+// How resources used by submitted work are released once the work is done
+enum class ResourceRetirement
+{
+    // A host callback on the auxiliary stream releases them as soon as the work completes
+    CALLBACK,
+    // They're stamped with a pooled event and released by the next submit, sync or poll that sees it completed
+    EVENT
+};
+
 class PYBIND11_EXPORT Stream : public CacheItem
 {
 public:
@@ -63,6 +72,15 @@ public:
 
     void holdResources(LockResources usedResources);
 
+    // Runs (func, args[, kwargs]) calls on this stream, holding the resources of all of them together at the end
+    py::list submitBatch(py::iterable calls);
+
+    static void               SetResourceRetirement(ResourceRetirement mode);
+    static ResourceRetirement GetResourceRetirement();
+
+    // Releases the event-retired resources whose work has completed, returns how many holds were released
+    static int PollRetiredResources();
+
     int64_t GetSizeInBytes() const override;
 
     void         sync();
@@ -135,6 +153,14 @@ private:
     static std::mutex m_gcMutex;
 
     static GCBag &GetGCBag();
+
+    void holdResourcesWithCallback(LockResources usedResources);
+    void holdResourcesWithEvent(LockResources usedResources);
+
+    // Waits for all event-retired work, releases its resources and destroys the pooled events
+    static void DrainRetiredResources();
+
+    static std::atomic<ResourceRetirement> m_retirement;
 };
 
 } // namespace nvcvpy::priv
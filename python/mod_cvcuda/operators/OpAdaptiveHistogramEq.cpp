@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpAdaptiveHistogramEq.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor AdaptiveHistogramEqInto(Tensor &output, Tensor &input, const std::tuple<int, int> &tileGrid, float clipLimit,
+                               float temporalAlpha, bool resetState, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::AdaptiveHistogramEq>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_MODE_READ, {input});
+    guard.add(LockMode::LOCK_MODE_WRITE, {output});
+    guard.add(LockMode::LOCK_MODE_READWRITE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, output, NVCVSize2D{std::get<0>(tileGrid), std::get<1>(tileGrid)},
+               clipLimit, temporalAlpha, resetState);
+
+    return std::move(output);
+}
+
+Tensor AdaptiveHistogramEq(Tensor &input, const std::tuple<int, int> &tileGrid, float clipLimit, float temporalAlpha,
+                           bool resetState, std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return AdaptiveHistogramEqInto(output, input, tileGrid, clipLimit, temporalAlpha, resetState, pstream);
+}
+
+} // namespace
+
+void ExportOpAdaptiveHistogramEq(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("adaptive_histogrameq", &AdaptiveHistogramEq, "src"_a, "tile_grid"_a = std::make_tuple(8, 8),
+          "clip_limit"_a = 40.f, "temporal_alpha"_a = 1.f, py::kw_only(), "reset_state"_a = false,
+          "stream"_a = nullptr, R"pbdoc(
+
+        Executes the contrast-limited adaptive histogram equalization (CLAHE) operation on the given cuda stream,
+        with optional temporal smoothing of the equalization across consecutive calls (frames) on the same stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the AdaptiveHistogramEq operator
+            for more details and usage examples.
+
+        Args:
+            src (cvcuda.Tensor): Input tensor containing one or more uint8 images, must be (N)HWC.
+            tile_grid (Tuple[int, int], optional): Number of tiles in width and height, default is (8, 8).
+            clip_limit (float, optional): Contrast limit relative to the average bin count of a tile histogram,
+                                          zero or negative disables clipping, default is 40.
+            temporal_alpha (float, optional): Weight in (0, 1] of the current frame in the exponential moving average
+                                              of the equalization, 1 disables temporal smoothing, default is 1.
+            reset_state (bool, optional): Discard the equalization state of previous frames, default is False.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            cvcuda.Tensor: The output tensor.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+
+    m.def("adaptive_histogrameq_into", &AdaptiveHistogramEqInto, "dst"_a, "src"_a,
+          "tile_grid"_a = std::make_tuple(8, 8), "clip_limit"_a = 40.f, "temporal_alpha"_a = 1.f, py::kw_only(),
+          "reset_state"_a = false, "stream"_a = nullptr, R"pbdoc(
+
+        Executes the contrast-limited adaptive histogram equalization (CLAHE) operation on the given cuda stream,
+        with optional temporal smoothing of the equalization across consecutive calls (frames) on the same stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the AdaptiveHistogramEq operator
+            for more details and usage examples.
+
+        Args:
+            dst (cvcuda.Tensor): Output tensor to store the result of the operation.
+            src (cvcuda.Tensor): Input tensor containing one or more uint8 images, must be (N)HWC.
+            tile_grid (Tuple[int, int], optional): Number of tiles in width and height, default is (8, 8).
+            clip_limit (float, optional): Contrast limit relative to the average bin count of a tile histogram,
+                                          zero or negative disables clipping, default is 40.
+            temporal_alpha (float, optional): Weight in (0, 1] of the current frame in the exponential moving average
+                                              of the equalization, 1 disables temporal smoothing, default is 1.
+            reset_state (bool, optional): Discard the equalization state of previous frames, default is False.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            None
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+}
+
+} // namespace cvcudapy
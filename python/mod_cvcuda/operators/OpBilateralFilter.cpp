@@ -31,8 +31,10 @@
 namespace cvcudapy {
 
 namespace {
+using GridSampling = std::optional<std::tuple<float, float>>;
+
 Tensor BilateralFilterInto(Tensor &output, Tensor &input, int diameter, float sigmaColor, float sigmaSpace,
-                           NVCVBorderType borderMode, std::optional<Stream> pstream)
+                           NVCVBorderType borderMode, GridSampling gridSampling, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -46,22 +48,30 @@ Tensor BilateralFilterInto(Tensor &output, Tensor &input, int diameter, float si
     guard.add(LockMode::LOCK_MODE_WRITE, {output});
     guard.add(LockMode::LOCK_MODE_NONE, {*bilateral_filter});
 
-    bilateral_filter->submit(pstream->cudaHandle(), input, output, diameter, sigmaColor, sigmaSpace, borderMode);
+    if (gridSampling)
+    {
+        NVCVBilateralGridParams gridParams{std::get<0>(*gridSampling), std::get<1>(*gridSampling)};
+        bilateral_filter->submit(pstream->cudaHandle(), input, output, diameter, sigmaColor, sigmaSpace, gridParams);
+    }
+    else
+    {
+        bilateral_filter->submit(pstream->cudaHandle(), input, output, diameter, sigmaColor, sigmaSpace, borderMode);
+    }
 
     return output;
 }
 
 Tensor BilateralFilter(Tensor &input, int diameter, float sigmaColor, float sigmaSpace, NVCVBorderType borderMode,
-                       std::optional<Stream> pstream)
+                       GridSampling gridSampling, std::optional<Stream> pstream)
 {
     Tensor output = Tensor::Create(input.shape(), input.dtype());
 
-    return BilateralFilterInto(output, input, diameter, sigmaColor, sigmaSpace, borderMode, pstream);
+    return BilateralFilterInto(output, input, diameter, sigmaColor, sigmaSpace, borderMode, gridSampling, pstream);
 }
 
 ImageBatchVarShape VarShapeBilateralFilterInto(ImageBatchVarShape &output, ImageBatchVarShape &input, Tensor &diameter,
                                                Tensor &sigmaColor, Tensor &sigmaSpace, NVCVBorderType borderMode,
-                                               std::optional<Stream> pstream)
+                                               GridSampling gridSampling, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -75,13 +85,22 @@ ImageBatchVarShape VarShapeBilateralFilterInto(ImageBatchVarShape &output, Image
     guard.add(LockMode::LOCK_MODE_WRITE, {output});
     guard.add(LockMode::LOCK_MODE_NONE, {*bilateral_filter});
 
-    bilateral_filter->submit(pstream->cudaHandle(), input, output, diameter, sigmaColor, sigmaSpace, borderMode);
+    if (gridSampling)
+    {
+        NVCVBilateralGridParams gridParams{std::get<0>(*gridSampling), std::get<1>(*gridSampling)};
+        bilateral_filter->submit(pstream->cudaHandle(), input, output, diameter, sigmaColor, sigmaSpace, gridParams);
+    }
+    else
+    {
+        bilateral_filter->submit(pstream->cudaHandle(), input, output, diameter, sigmaColor, sigmaSpace, borderMode);
+    }
 
     return output;
 }
 
 ImageBatchVarShape VarShapeBilateralFilter(ImageBatchVarShape &input, Tensor &diameter, Tensor &sigmaColor,
-                                           Tensor &sigmaSpace, NVCVBorderType borderMode, std::optional<Stream> pstream)
+                                           Tensor &sigmaSpace, NVCVBorderType borderMode, GridSampling gridSampling,
+                                           std::optional<Stream> pstream)
 {
     ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
 
@@ -93,7 +112,8 @@ ImageBatchVarShape VarShapeBilateralFilter(ImageBatchVarShape &input, Tensor &di
         output.pushBack(image);
     }
 
-    return VarShapeBilateralFilterInto(output, input, diameter, sigmaColor, sigmaSpace, borderMode, pstream);
+    return VarShapeBilateralFilterInto(output, input, diameter, sigmaColor, sigmaSpace, borderMode, gridSampling,
+                                       pstream);
 }
 
 } // namespace
@@ -106,9 +126,10 @@ void ExportOpBilateralFilter(py::module &m)
     options.disable_function_signatures();
 
     m.def("bilateral_filter", &BilateralFilter, "src"_a, "diameter"_a, "sigma_color"_a, "sigma_space"_a,
-          "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(), "stream"_a = nullptr, R"pbdoc(
+          "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(), "grid_sampling"_a = std::nullopt,
+          "stream"_a = nullptr, R"pbdoc(
 
-        cvcuda.bilateral_filter(src: cvcuda.Tensor, diameter: int, sigma_color: float, sigma_space: float, border:cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None) -> cvcuda.Tensor
+        cvcuda.bilateral_filter(src: cvcuda.Tensor, diameter: int, sigma_color: float, sigma_space: float, border:cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None) -> cvcuda.Tensor
 
         Executes the Bilateral Filter operation on the given cuda stream.
 
@@ -122,6 +143,9 @@ void ExportOpBilateralFilter(py::module &m)
             sigma_color (float): Gaussian exponent for color difference.
             sigma_space (float): Gaussian exponent for position difference.
             border (cvcuda.Border, optional): Border mode to be used when accessing elements outside input image.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -133,10 +157,11 @@ void ExportOpBilateralFilter(py::module &m)
     )pbdoc");
 
     m.def("bilateral_filter_into", &BilateralFilterInto, "dst"_a, "src"_a, "diameter"_a, "sigma_color"_a,
-          "sigma_space"_a, "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(), "stream"_a = nullptr,
+          "sigma_space"_a, "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(),
+          "grid_sampling"_a = std::nullopt, "stream"_a = nullptr,
           R"pbdoc(
 
-        cvcuda.bilateral_filter_into(dst: cvcuda.Tensor, src: cvcuda.Tensor, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None)
+        cvcuda.bilateral_filter_into(dst: cvcuda.Tensor, src: cvcuda.Tensor, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None)
 
         Executes the Bilateral Filter operation on the given cuda stream.
 
@@ -151,6 +176,9 @@ void ExportOpBilateralFilter(py::module &m)
             sigma_color (float): Gaussian exponent for color difference.
             sigma_space (float): Gaussian exponent for position difference.
             border (cvcuda.Border, optional): Border mode to be used when accessing elements outside input image.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -162,9 +190,10 @@ void ExportOpBilateralFilter(py::module &m)
     )pbdoc");
 
     m.def("bilateral_filter", &VarShapeBilateralFilter, "src"_a, "diameter"_a, "sigma_color"_a, "sigma_space"_a,
-          py::kw_only(), "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "stream"_a = nullptr, R"pbdoc(
+          py::kw_only(), "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "grid_sampling"_a = std::nullopt,
+          "stream"_a = nullptr, R"pbdoc(
 
-        cvcuda.bilateral_filter(src: cvcuda.ImageBatchVarShape, diameter:  cvcuda.Tensor, sigma_color:  cvcuda.Tensor, sigma_space:  cvcuda.Tensor, border: cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None) -> cvcuda.ImageBatchVarShape
+        cvcuda.bilateral_filter(src: cvcuda.ImageBatchVarShape, diameter:  cvcuda.Tensor, sigma_color:  cvcuda.Tensor, sigma_space:  cvcuda.Tensor, border: cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None) -> cvcuda.ImageBatchVarShape
 
         Executes the Bilateral Filter operation on the given cuda stream.
 
@@ -178,6 +207,9 @@ void ExportOpBilateralFilter(py::module &m)
             sigma_color (cvcuda.Tensor): Gaussian exponents for color difference in each image.
             sigma_space (cvcuda.Tensor): Gaussian exponents for position difference in each image.
             border (cvcuda.Border, optional): Border mode to be used when accessing elements outside input image.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -189,10 +221,11 @@ void ExportOpBilateralFilter(py::module &m)
     )pbdoc");
 
     m.def("bilateral_filter_into", &VarShapeBilateralFilterInto, "dst"_a, "src"_a, "diameter"_a, "sigma_color"_a,
-          "sigma_space"_a, py::kw_only(), "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "stream"_a = nullptr,
+          "sigma_space"_a, py::kw_only(), "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT,
+          "grid_sampling"_a = std::nullopt, "stream"_a = nullptr,
           R"pbdoc(
 
-        cvcuda.bilateral_filter_into(dst: cvcuda.ImageBatchVarShape, src: cvcuda.ImageBatchVarShape, diameter: cvcuda.Tensor, sigma_color:  cvcuda.Tensor, sigma_space:  cvcuda.Tensor, border: cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None)
+        cvcuda.bilateral_filter_into(dst: cvcuda.ImageBatchVarShape, src: cvcuda.ImageBatchVarShape, diameter: cvcuda.Tensor, sigma_color:  cvcuda.Tensor, sigma_space:  cvcuda.Tensor, border: cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None)
 
         Executes the Bilateral Filter operation on the given cuda stream.
 
@@ -207,6 +240,9 @@ void ExportOpBilateralFilter(py::module &m)
             sigma_color (cvcuda.Tensor): Gaussian exponents for color difference in each image.
             sigma_space (cvcuda.Tensor): Gaussian exponents for position difference in each image.
             border (cvcuda.Border, optional): Border mode to be used when accessing elements outside input image.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpImageStats.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using TupleTensor5 = std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor>;
+
+TupleTensor5 ImageStatsInto(Tensor &histogram, Tensor &minMaxVal, Tensor &minMaxLoc, Tensor &sum, Tensor &sumSq,
+                            Tensor &input, std::optional<Tensor> mask, std::optional<Tensor> rois, float rangeLow,
+                            float rangeHigh, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::ImageStats>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_MODE_READ, {input});
+    guard.add(LockMode::LOCK_MODE_WRITE, {histogram, minMaxVal, minMaxLoc, sum, sumSq});
+    guard.add(LockMode::LOCK_MODE_NONE, {*op});
+
+    if (mask)
+    {
+        guard.add(LockMode::LOCK_MODE_READ, {*mask});
+    }
+    if (rois)
+    {
+        guard.add(LockMode::LOCK_MODE_READ, {*rois});
+    }
+
+    op->submit(pstream->cudaHandle(), input, mask ? *mask : nvcv::Tensor{nullptr}, rois ? *rois : nvcv::Tensor{nullptr},
+               rangeLow, rangeHigh, histogram, minMaxVal, minMaxLoc, sum, sumSq);
+
+    return TupleTensor5(std::move(histogram), std::move(minMaxVal), std::move(minMaxLoc), std::move(sum),
+                        std::move(sumSq));
+}
+
+TupleTensor5 ImageStats(Tensor &input, std::optional<Tensor> mask, std::optional<Tensor> rois, int bins,
+                        float rangeLow, float rangeHigh, std::optional<Stream> pstream)
+{
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(input.exportData());
+    if (!inAccess)
+    {
+        throw std::invalid_argument("Input tensor must be HWC or NHWC");
+    }
+
+    int numSamples = inAccess->numSamples();
+
+    // Outputs have the ROI dimension only when ROIs are given, row align is 1 so dimensions are packed
+
+    // clang-format off
+
+    Tensor histogram, minMaxVal, minMaxLoc, sum, sumSq;
+
+    if (rois)
+    {
+        int numRois = rois->shape()[1];
+
+        histogram = Tensor::Create({{numSamples, numRois, bins}, "NMC"}, nvcv::TYPE_S32, 1);
+        minMaxVal = Tensor::Create({{numSamples, numRois, 2}, "NMC"}, nvcv::TYPE_F64, 1);
+        minMaxLoc = Tensor::Create({{numSamples, numRois, 2}, "NMC"}, nvcv::TYPE_2S32, 1);
+        sum       = Tensor::Create({{numSamples, numRois}, "NM"}, nvcv::TYPE_F64, 1);
+        sumSq     = Tensor::Create({{numSamples, numRois}, "NM"}, nvcv::TYPE_F64, 1);
+    }
+    else
+    {
+        histogram = Tensor::Create({{numSamples, bins}, "NC"}, nvcv::TYPE_S32, 1);
+        minMaxVal = Tensor::Create({{numSamples, 2}, "NC"}, nvcv::TYPE_F64, 1);
+        minMaxLoc = Tensor::Create({{numSamples, 2}, "NC"}, nvcv::TYPE_2S32, 1);
+        sum       = Tensor::Create({{numSamples}, "N"}, nvcv::TYPE_F64, 1);
+        sumSq     = Tensor::Create({{numSamples}, "N"}, nvcv::TYPE_F64, 1);
+    }
+
+    // clang-format on
+
+    return ImageStatsInto(histogram, minMaxVal, minMaxLoc, sum, sumSq, input, mask, rois, rangeLow, rangeHigh,
+                          pstream);
+}
+
+} // namespace
+
+void ExportOpImageStats(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("image_stats", &ImageStats, "src"_a, "mask"_a = nullptr, "rois"_a = nullptr, py::kw_only(), "bins"_a = 256,
+          "range_low"_a = 0.f, "range_high"_a = 256.f, "stream"_a = nullptr, R"pbdoc(
+
+        Computes histogram, minimum/maximum values and locations, sum and sum of squares of the input
+        in a single pass on the given cuda stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the ImageStats operator
+            for more details and usage examples.
+
+        Args:
+            src (cvcuda.Tensor): Input tensor containing one or more single-channel images, must be (N)HWC.
+            mask (cvcuda.Tensor, optional): Input uint8 tensor selecting the pixels considered (non-zero), must be the same shape as src.
+            rois (cvcuda.Tensor, optional): Input tensor with R regions of interest (x, y, width, height) per image, must be NM with int4 data type or NMC with int32 data type and C = 4.
+            bins (int, optional): Number of histogram bins, default is 256.
+            range_low (float, optional): Inclusive lower bound of the histogram range, default is 0.
+            range_high (float, optional): Exclusive upper bound of the histogram range, default is 256.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            Tuple[cvcuda.Tensor, cvcuda.Tensor, cvcuda.Tensor, cvcuda.Tensor, cvcuda.Tensor]: A tuple with histogram,
+            minimum/maximum values, minimum/maximum locations, sum and sum of squares.  Outputs have an extra
+            ROI dimension after the sample dimension when rois is given.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+
+    m.def("image_stats_into", &ImageStatsInto, "histogram"_a, "min_max_val"_a, "min_max_loc"_a, "sum"_a, "sum_sq"_a,
+          "src"_a, "mask"_a = nullptr, "rois"_a = nullptr, py::kw_only(), "range_low"_a = 0.f, "range_high"_a = 256.f,
+          "stream"_a = nullptr, R"pbdoc(
+
+        Computes histogram, minimum/maximum values and locations, sum and sum of squares of the input
+        in a single pass on the given cuda stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the ImageStats operator
+            for more details and usage examples.
+
+        Args:
+            histogram (cvcuda.Tensor): Output int32 tensor with the histogram, the number of bins is its last dimension.
+            min_max_val (cvcuda.Tensor): Output float64 tensor with minimum and maximum values.
+            min_max_loc (cvcuda.Tensor): Output int2 tensor with (x, y) locations of minimum and maximum values.
+            sum (cvcuda.Tensor): Output float64 tensor with the sum of values.
+            sum_sq (cvcuda.Tensor): Output float64 tensor with the sum of squared values.
+            src (cvcuda.Tensor): Input tensor containing one or more single-channel images, must be (N)HWC.
+            mask (cvcuda.Tensor, optional): Input uint8 tensor selecting the pixels considered (non-zero), must be the same shape as src.
+            rois (cvcuda.Tensor, optional): Input tensor with R regions of interest (x, y, width, height) per image.
+            range_low (float, optional): Inclusive lower bound of the histogram range, default is 0.
+            range_high (float, optional): Exclusive upper bound of the histogram range, default is 256.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            Tuple[cvcuda.Tensor, cvcuda.Tensor, cvcuda.Tensor, cvcuda.Tensor, cvcuda.Tensor]: A tuple with histogram,
+            minimum/maximum values, minimum/maximum locations, sum and sum of squares.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+}
+
+} // namespace cvcudapy
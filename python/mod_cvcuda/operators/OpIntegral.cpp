@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpIntegral.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using TupleTensor2 = std::tuple<std::optional<Tensor>, std::optional<Tensor>>;
+
+TupleTensor2 IntegralInto(std::optional<Tensor> sum, std::optional<Tensor> sqsum, Tensor &input,
+                          std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::Integral>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_MODE_READ, {input});
+    guard.add(LockMode::LOCK_MODE_NONE, {*op});
+
+    if (sum)
+    {
+        guard.add(LockMode::LOCK_MODE_WRITE, {*sum});
+    }
+    if (sqsum)
+    {
+        guard.add(LockMode::LOCK_MODE_WRITE, {*sqsum});
+    }
+
+    op->submit(pstream->cudaHandle(), input, sum ? nvcv::OptionalTensorConstRef{*sum} : nvcv::NullOpt,
+               sqsum ? nvcv::OptionalTensorConstRef{*sqsum} : nvcv::NullOpt);
+
+    return TupleTensor2(std::move(sum), std::move(sqsum));
+}
+
+TupleTensor2 Integral(Tensor &input, std::optional<nvcv::DataType> sumType, std::optional<nvcv::DataType> sqsumType,
+                      std::optional<Stream> pstream)
+{
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(input.exportData());
+    if (!inAccess)
+    {
+        throw std::invalid_argument("Input tensor must be HWC or NHWC");
+    }
+
+    // Integral images have one more row and column than the input, with the same layout
+    nvcv::TensorShape shape = input.layout() == nvcv::TENSOR_HWC
+                                ? nvcv::TensorShape({inAccess->numRows() + 1, inAccess->numCols() + 1,
+                                                     inAccess->numChannels()},
+                                                    nvcv::TENSOR_HWC)
+                                : nvcv::TensorShape({inAccess->numSamples(), inAccess->numRows() + 1,
+                                                     inAccess->numCols() + 1, inAccess->numChannels()},
+                                                    nvcv::TENSOR_NHWC);
+
+    // The sum defaults to int32 for uint8 inputs and to float64 otherwise, the sum of squares is optional
+    if (!sumType)
+    {
+        sumType = input.dtype() == nvcv::TYPE_U8 ? nvcv::TYPE_S32 : nvcv::TYPE_F64;
+    }
+
+    std::optional<Tensor> sum = Tensor::Create(shape, *sumType);
+    std::optional<Tensor> sqsum;
+    if (sqsumType)
+    {
+        sqsum = Tensor::Create(shape, *sqsumType);
+    }
+
+    return IntegralInto(std::move(sum), std::move(sqsum), input, pstream);
+}
+
+void IntegralVarShapeInto(std::optional<ImageBatchVarShape> sum, std::optional<ImageBatchVarShape> sqsum,
+                          ImageBatchVarShape &input, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::Integral>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_MODE_READ, {input});
+    guard.add(LockMode::LOCK_MODE_NONE, {*op});
+
+    if (sum)
+    {
+        guard.add(LockMode::LOCK_MODE_WRITE, {*sum});
+    }
+    if (sqsum)
+    {
+        guard.add(LockMode::LOCK_MODE_WRITE, {*sqsum});
+    }
+
+    op->submit(pstream->cudaHandle(), input,
+               sum ? nvcv::OptionalImageBatchVarShapeConstRef{*sum} : nvcv::NullOpt,
+               sqsum ? nvcv::OptionalImageBatchVarShapeConstRef{*sqsum} : nvcv::NullOpt);
+}
+
+} // namespace
+
+void ExportOpIntegral(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("integral", &Integral, "src"_a, "sum_dtype"_a = nullptr, "sqsum_dtype"_a = nullptr, py::kw_only(),
+          "stream"_a = nullptr, R"pbdoc(
+
+        Computes the integral image of the input, and optionally the integral image of its squares, on the given
+        cuda stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the Integral operator
+            for more details and usage examples.
+
+        Args:
+            src (cvcuda.Tensor): Input tensor containing one or more images with 1 to 4 channels, must be (N)HWC.
+            sum_dtype (numpy.dtype, optional): Data type of the integral image, int32, int64, float32 or float64,
+                default is int32 for uint8 inputs and float64 otherwise.  Integer types are only allowed for integer
+                inputs.
+            sqsum_dtype (numpy.dtype, optional): Data type of the integral image of squares, which is only computed
+                when given.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            Tuple[cvcuda.Tensor, Optional[cvcuda.Tensor]]: A tuple with the integral image and the integral image of
+            squares, or None when sqsum_dtype is not given.  Both have one more row and column than the input.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+
+    m.def("integral_into", &IntegralInto, "sum"_a, "sqsum"_a, "src"_a, py::kw_only(), "stream"_a = nullptr, R"pbdoc(
+
+        Computes the integral image of the input, and the integral image of its squares, into the given tensors on
+        the given cuda stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the Integral operator
+            for more details and usage examples.
+
+        Args:
+            sum (cvcuda.Tensor, optional): Output tensor with the integral image, one row and one column larger than
+                src, can be None when sqsum is given.
+            sqsum (cvcuda.Tensor, optional): Output tensor with the integral image of squares, one row and one column
+                larger than src, can be None when sum is given.
+            src (cvcuda.Tensor): Input tensor containing one or more images with 1 to 4 channels, must be (N)HWC.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            Tuple[Optional[cvcuda.Tensor], Optional[cvcuda.Tensor]]: The sum and sqsum outputs.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+
+    m.def("integral_into", &IntegralVarShapeInto, "sum"_a, "sqsum"_a, "src"_a, py::kw_only(), "stream"_a = nullptr,
+          R"pbdoc(
+
+        Computes the integral image of each image of the input batch, and the integral image of its squares, into
+        the given image batches on the given cuda stream.
+
+        See also:
+            Refer to the CV-CUDA C API reference for the Integral operator
+            for more details and usage examples.
+
+        Args:
+            sum (cvcuda.ImageBatchVarShape, optional): Output image batch with the integral images, each one row and
+                one column larger than the corresponding input image, can be None when sqsum is given.
+            sqsum (cvcuda.ImageBatchVarShape, optional): Output image batch with the integral images of squares, can
+                be None when sum is given.
+            src (cvcuda.ImageBatchVarShape): Input image batch, the images must all have the same format with 1 to 4
+                interleaved channels.
+            stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
+
+        Returns:
+            None
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+}
+
+} // namespace cvcudapy
@@ -31,8 +31,11 @@
 namespace cvcudapy {
 
 namespace {
+using GridSampling = std::optional<std::tuple<float, float>>;
+
 Tensor JointBilateralFilterInto(Tensor &output, Tensor &input, Tensor &inputColor, int diameter, float sigmaColor,
-                                float sigmaSpace, NVCVBorderType borderMode, std::optional<Stream> pstream)
+                                float sigmaSpace, NVCVBorderType borderMode, GridSampling gridSampling,
+                                std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -46,24 +49,34 @@ Tensor JointBilateralFilterInto(Tensor &output, Tensor &input, Tensor &inputColo
     guard.add(LockMode::LOCK_MODE_WRITE, {output});
     guard.add(LockMode::LOCK_MODE_NONE, {*joint_bilateral_filter});
 
-    joint_bilateral_filter->submit(pstream->cudaHandle(), input, inputColor, output, diameter, sigmaColor, sigmaSpace,
-                                   borderMode);
+    if (gridSampling)
+    {
+        NVCVBilateralGridParams gridParams{std::get<0>(*gridSampling), std::get<1>(*gridSampling)};
+        joint_bilateral_filter->submit(pstream->cudaHandle(), input, inputColor, output, diameter, sigmaColor,
+                                       sigmaSpace, gridParams);
+    }
+    else
+    {
+        joint_bilateral_filter->submit(pstream->cudaHandle(), input, inputColor, output, diameter, sigmaColor,
+                                       sigmaSpace, borderMode);
+    }
 
     return output;
 }
 
 Tensor JointBilateralFilter(Tensor &input, Tensor &inputColor, int diameter, float sigmaColor, float sigmaSpace,
-                            NVCVBorderType borderMode, std::optional<Stream> pstream)
+                            NVCVBorderType borderMode, GridSampling gridSampling, std::optional<Stream> pstream)
 {
     Tensor output = Tensor::Create(input.shape(), input.dtype());
 
-    return JointBilateralFilterInto(output, input, inputColor, diameter, sigmaColor, sigmaSpace, borderMode, pstream);
+    return JointBilateralFilterInto(output, input, inputColor, diameter, sigmaColor, sigmaSpace, borderMode,
+                                    gridSampling, pstream);
 }
 
 ImageBatchVarShape VarShapeJointBilateralFilterInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
                                                     ImageBatchVarShape &inputColor, Tensor &diameter,
                                                     Tensor &sigmaColor, Tensor &sigmaSpace, NVCVBorderType borderMode,
-                                                    std::optional<Stream> pstream)
+                                                    GridSampling gridSampling, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -77,15 +90,25 @@ ImageBatchVarShape VarShapeJointBilateralFilterInto(ImageBatchVarShape &output,
     guard.add(LockMode::LOCK_MODE_WRITE, {output});
     guard.add(LockMode::LOCK_MODE_NONE, {*joint_bilateral_filter});
 
-    joint_bilateral_filter->submit(pstream->cudaHandle(), input, inputColor, output, diameter, sigmaColor, sigmaSpace,
-                                   borderMode);
+    if (gridSampling)
+    {
+        NVCVBilateralGridParams gridParams{std::get<0>(*gridSampling), std::get<1>(*gridSampling)};
+        joint_bilateral_filter->submit(pstream->cudaHandle(), input, inputColor, output, diameter, sigmaColor,
+                                       sigmaSpace, gridParams);
+    }
+    else
+    {
+        joint_bilateral_filter->submit(pstream->cudaHandle(), input, inputColor, output, diameter, sigmaColor,
+                                       sigmaSpace, borderMode);
+    }
 
     return output;
 }
 
 ImageBatchVarShape VarShapeJointBilateralFilter(ImageBatchVarShape &input, ImageBatchVarShape &inputColor,
                                                 Tensor &diameter, Tensor &sigmaColor, Tensor &sigmaSpace,
-                                                NVCVBorderType borderMode, std::optional<Stream> pstream)
+                                                NVCVBorderType borderMode, GridSampling gridSampling,
+                                                std::optional<Stream> pstream)
 {
     ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
 
@@ -98,7 +121,7 @@ ImageBatchVarShape VarShapeJointBilateralFilter(ImageBatchVarShape &input, Image
     }
 
     return VarShapeJointBilateralFilterInto(output, input, inputColor, diameter, sigmaColor, sigmaSpace, borderMode,
-                                            pstream);
+                                            gridSampling, pstream);
 }
 
 } // namespace
@@ -110,10 +133,11 @@ void ExportOpJointBilateralFilter(py::module &m)
     options.disable_function_signatures();
 
     m.def("joint_bilateral_filter", &JointBilateralFilter, "src"_a, "srcColor"_a, "diameter"_a, "sigma_color"_a,
-          "sigma_space"_a, "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(), "stream"_a = nullptr,
+          "sigma_space"_a, "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(),
+          "grid_sampling"_a = std::nullopt, "stream"_a = nullptr,
           R"pbdoc(
 
-	cvcuda.joint_bilateral_filter(src: cvcuda.Tensor, srcColor: Tensor, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None) -> cvcuda.Tensor
+	cvcuda.joint_bilateral_filter(src: cvcuda.Tensor, srcColor: Tensor, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None) -> cvcuda.Tensor
 
         Executes the Joint Bilateral Filter operation on the given cuda stream.
 
@@ -128,6 +152,9 @@ void ExportOpJointBilateralFilter(py::module &m)
             sigma_color (float): Gaussian exponent for color difference.
             sigma_space (float): Gaussian exponent for position difference.
             border (cvcuda.Border, optional): Border mode for input tensor.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -140,9 +167,9 @@ void ExportOpJointBilateralFilter(py::module &m)
 
     m.def("joint_bilateral_filter_into", &JointBilateralFilterInto, "dst"_a, "src"_a, "srcColor"_a, "diameter"_a,
           "sigma_color"_a, "sigma_space"_a, "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, py::kw_only(),
-          "stream"_a = nullptr, R"pbdoc(
+          "grid_sampling"_a = std::nullopt, "stream"_a = nullptr, R"pbdoc(
 
-	cvcuda.joint_bilateral_filter_into(dst: cvcuda.Tensor, src: cvcuda.Tensor, srcColor: Tensor, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None)
+	cvcuda.joint_bilateral_filter_into(dst: cvcuda.Tensor, src: cvcuda.Tensor, srcColor: Tensor, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None)
 
         Executes the Joint Bilateral Filter operation on the given cuda stream.
 
@@ -158,6 +185,9 @@ void ExportOpJointBilateralFilter(py::module &m)
             sigma_color (float): Gaussian exponent for color difference.
             sigma_space (float): Gaussian exponent for position difference.
             border (cvcuda.Border, optional): Border mode for input tensor.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -169,10 +199,11 @@ void ExportOpJointBilateralFilter(py::module &m)
     )pbdoc");
 
     m.def("joint_bilateral_filter", &VarShapeJointBilateralFilter, "src"_a, "srcColor"_a, "diameter"_a, "sigma_color"_a,
-          "sigma_space"_a, py::kw_only(), "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "stream"_a = nullptr,
+          "sigma_space"_a, py::kw_only(), "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT,
+          "grid_sampling"_a = std::nullopt, "stream"_a = nullptr,
           R"pbdoc(
 
-	cvcuda.joint_bilateral_filter(src: cvcuda.ImageBatchVarShape, srcColor:ImageBatchVarShape,*, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, stream: Optional[cvcuda.Stream] = None) -> cvcuda.ImageBatchVarShape
+	cvcuda.joint_bilateral_filter(src: cvcuda.ImageBatchVarShape, srcColor:ImageBatchVarShape,*, diameter: int, sigma_color: float, sigma_space: float, border: cvcuda.Border = cvcuda.Border.CONSTANT, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None) -> cvcuda.ImageBatchVarShape
 
         Executes the Joint Bilateral operation on the given cuda stream.
 
@@ -187,6 +218,9 @@ void ExportOpJointBilateralFilter(py::module &m)
             sigma_color (cvcuda.Tensor): Gaussian exponent for color difference per image.
             sigma_space (cvcuda.Tensor): Gaussian exponent for position difference per image.
             border (cvcuda.Border, optional): Border mode for input tensor.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -199,9 +233,10 @@ void ExportOpJointBilateralFilter(py::module &m)
 
     m.def("joint_bilateral_filter_into", &VarShapeJointBilateralFilterInto, "dst"_a, "src"_a, "srcColor"_a,
           "diameter"_a, "sigma_color"_a, "sigma_space"_a, py::kw_only(),
-          "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "stream"_a = nullptr, R"pbdoc(
+          "border"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "grid_sampling"_a = std::nullopt, "stream"_a = nullptr,
+          R"pbdoc(
 
-	cvcuda.joint_bilateral_filter_into(dst: cvcuda.ImageBatchVarShape, src: cvcuda.ImageBatchVarShape, srcColor:ImageBatchVarShape,*, diameter: int, sigma_color: float, sigma_space: float, border: border (cvcuda.Border, optional): Border mode for input tensor. = <cvcuda.Border.CONSTANT >, stream: Optional[cvcuda.Stream] = None)
+	cvcuda.joint_bilateral_filter_into(dst: cvcuda.ImageBatchVarShape, src: cvcuda.ImageBatchVarShape, srcColor:ImageBatchVarShape,*, diameter: int, sigma_color: float, sigma_space: float, border: border (cvcuda.Border, optional): Border mode for input tensor. = <cvcuda.Border.CONSTANT >, grid_sampling: Optional[Tuple[float, float]] = None, stream: Optional[cvcuda.Stream] = None)
 
 	Executes the Joint Bilateral operation on the given cuda stream.
 
@@ -216,6 +251,9 @@ void ExportOpJointBilateralFilter(py::module &m)
             sigma_color (cvcuda.Tensor): Gaussian exponent for color difference per image.
             sigma_space (cvcuda.Tensor): Gaussian exponent for position difference per image.
             border (cvcuda.Border, optional): Border mode for input tensor.
+            grid_sampling (Tuple[float, float], optional): Cell sizes (space, color) of the bilateral grid
+                approximation, see the C API reference for its error bounds. The border mode is not used
+                in this mode. Defaults to None, which runs the exact filter.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
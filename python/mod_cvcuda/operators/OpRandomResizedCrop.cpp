@@ -29,8 +29,26 @@
 namespace cvcudapy {
 
 namespace {
+nvcv::OptionalTensorConstRef AsOptionalRef(const std::optional<Tensor> &tensor)
+{
+    return tensor ? nvcv::OptionalTensorConstRef(*tensor) : nvcv::NullOpt;
+}
+
+void AddCropsToGuard(ResourceGuard &guard, const std::optional<Tensor> &crops, const std::optional<Tensor> &out_crops)
+{
+    if (crops)
+    {
+        guard.add(LockMode::LOCK_MODE_READ, {*crops});
+    }
+    if (out_crops)
+    {
+        guard.add(LockMode::LOCK_MODE_WRITE, {*out_crops});
+    }
+}
+
 Tensor RandomResizedCropInto(Tensor &output, Tensor &input, double min_scale, double max_scale, double min_ratio,
                              double max_ratio, NVCVInterpolationType interp, uint32_t seed,
+                             std::optional<Tensor> crops, std::optional<Tensor> out_crops,
                              std::optional<Stream> pstream)
 {
     if (!pstream)
@@ -46,23 +64,28 @@ Tensor RandomResizedCropInto(Tensor &output, Tensor &input, double min_scale, do
     guard.add(LockMode::LOCK_MODE_READ, {input});
     guard.add(LockMode::LOCK_MODE_WRITE, {output});
     guard.add(LockMode::LOCK_MODE_READWRITE, {*randomResizedCrop});
+    AddCropsToGuard(guard, crops, out_crops);
 
-    randomResizedCrop->submit(pstream->cudaHandle(), input, output, interp);
+    randomResizedCrop->submit(pstream->cudaHandle(), input, output, interp, AsOptionalRef(crops),
+                              AsOptionalRef(out_crops));
 
     return std::move(output);
 }
 
 Tensor RandomResizedCrop(Tensor &input, const Shape &out_shape, double min_scale, double max_scale, double min_ratio,
-                         double max_ratio, NVCVInterpolationType interp, uint32_t seed, std::optional<Stream> pstream)
+                         double max_ratio, NVCVInterpolationType interp, uint32_t seed, std::optional<Tensor> crops,
+                         std::optional<Tensor> out_crops, std::optional<Stream> pstream)
 {
     Tensor output = Tensor::Create(out_shape, input.dtype(), input.shape().layout());
 
-    return RandomResizedCropInto(output, input, min_scale, max_scale, min_ratio, max_ratio, interp, seed, pstream);
+    return RandomResizedCropInto(output, input, min_scale, max_scale, min_ratio, max_ratio, interp, seed, crops,
+                                 out_crops, pstream);
 }
 
 ImageBatchVarShape RandomResizedCropVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
                                                  double min_scale, double max_scale, double min_ratio, double max_ratio,
                                                  NVCVInterpolationType interp, uint32_t seed,
+                                                 std::optional<Tensor> crops, std::optional<Tensor> out_crops,
                                                  std::optional<Stream> pstream)
 {
     if (!pstream)
@@ -77,8 +100,10 @@ ImageBatchVarShape RandomResizedCropVarShapeInto(ImageBatchVarShape &output, Ima
     guard.add(LockMode::LOCK_MODE_READ, {input});
     guard.add(LockMode::LOCK_MODE_WRITE, {output});
     guard.add(LockMode::LOCK_MODE_READWRITE, {*randomResizedCrop});
+    AddCropsToGuard(guard, crops, out_crops);
 
-    randomResizedCrop->submit(pstream->cudaHandle(), input, output, interp);
+    randomResizedCrop->submit(pstream->cudaHandle(), input, output, interp, AsOptionalRef(crops),
+                              AsOptionalRef(out_crops));
 
     return output;
 }
@@ -86,7 +111,8 @@ ImageBatchVarShape RandomResizedCropVarShapeInto(ImageBatchVarShape &output, Ima
 ImageBatchVarShape RandomResizedCropVarShape(ImageBatchVarShape                      &input,
                                              const std::vector<std::tuple<int, int>> &out_size, double min_scale,
                                              double max_scale, double min_ratio, double max_ratio,
-                                             NVCVInterpolationType interp, uint32_t seed, std::optional<Stream> pstream)
+                                             NVCVInterpolationType interp, uint32_t seed, std::optional<Tensor> crops,
+                                             std::optional<Tensor> out_crops, std::optional<Stream> pstream)
 {
     if (input.numImages() != (int)out_size.size())
     {
@@ -104,7 +130,7 @@ ImageBatchVarShape RandomResizedCropVarShape(ImageBatchVarShape
     }
 
     return RandomResizedCropVarShapeInto(output, input, min_scale, max_scale, min_ratio, max_ratio, interp, seed,
-                                         pstream);
+                                         crops, out_crops, pstream);
 }
 
 } // namespace
@@ -118,10 +144,10 @@ void ExportOpRandomResizedCrop(py::module &m)
 
     m.def("random_resized_crop", &RandomResizedCrop, "src"_a, "shape"_a, "min_scale"_a = 0.08, "max_scale"_a = 1.0,
           "min_ratio"_a = 0.75, "max_ratio"_a = 1.3333333333333333, "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0,
-          py::kw_only(), "stream"_a = nullptr,
+          py::kw_only(), "crops"_a = nullptr, "out_crops"_a = nullptr, "stream"_a = nullptr,
           R"pbdoc(
 
-	cvcuda.random_resized_crop(src: cvcuda.Tensor, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, stream: Optional[cvcuda.Stream] = None) -> cvcuda.Tensor
+	cvcuda.random_resized_crop(src: cvcuda.Tensor, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, crops: Optional[cvcuda.Tensor] = None, out_crops: Optional[cvcuda.Tensor] = None, stream: Optional[cvcuda.Stream] = None) -> cvcuda.Tensor
 
         Executes the RandomResizedCrop operation on the given cuda stream.
 
@@ -138,6 +164,8 @@ void ExportOpRandomResizedCrop(py::module &m)
             max_ratio (double, optional): Upper bound for the random aspect ratio of the crop, before resizing.
             interp (cvcuda.Interp, optional): Interpolation type used for transform.
             seed (int, optional): Random seed, should be unsigned int32.
+            crops (cvcuda.Tensor, optional): Crops (x, y, width, height) to use instead of random ones, with NC layout and 4 int32 per sample.
+            out_crops (cvcuda.Tensor, optional): Tensor receiving the crops used, with the same shape and type as crops.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -150,9 +178,10 @@ void ExportOpRandomResizedCrop(py::module &m)
 
     m.def("random_resized_crop_into", &RandomResizedCropInto, "dst"_a, "src"_a, "min_scale"_a = 0.08,
           "max_scale"_a = 1.0, "min_ratio"_a = 0.75, "max_ratio"_a = 1.3333333333333333,
-          "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0, py::kw_only(), "stream"_a = nullptr, R"pbdoc(
+          "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0, py::kw_only(), "crops"_a = nullptr, "out_crops"_a = nullptr,
+          "stream"_a = nullptr, R"pbdoc(
 
-	cvcuda.random_resized_crop_into(dst: cvcuda.Tensor, src: cvcuda.Tensor, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, stream: Optional[cvcuda.Stream] = None)
+	cvcuda.random_resized_crop_into(dst: cvcuda.Tensor, src: cvcuda.Tensor, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, crops: Optional[cvcuda.Tensor] = None, out_crops: Optional[cvcuda.Tensor] = None, stream: Optional[cvcuda.Stream] = None)
 
         Executes the RandomResizedCrop operation on the given cuda stream.
 
@@ -169,6 +198,8 @@ void ExportOpRandomResizedCrop(py::module &m)
             max_ratio (double, optional): Upper bound for the random aspect ratio of the crop, before resizing.
             interp (cvcuda.Interp, optional): Interpolation type used for transform.
             seed (int, optional): Random seed, should be unsigned int32.
+            crops (cvcuda.Tensor, optional): Crops (x, y, width, height) to use instead of random ones, with NC layout and 4 int32 per sample.
+            out_crops (cvcuda.Tensor, optional): Tensor receiving the crops used, with the same shape and type as crops.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -181,9 +212,10 @@ void ExportOpRandomResizedCrop(py::module &m)
 
     m.def("random_resized_crop", &RandomResizedCropVarShape, "src"_a, "sizes"_a, "min_scale"_a = 0.08,
           "max_scale"_a = 1.0, "min_ratio"_a = 0.75, "max_ratio"_a = 1.3333333333333333,
-          "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0, py::kw_only(), "stream"_a = nullptr, R"pbdoc(
+          "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0, py::kw_only(), "crops"_a = nullptr, "out_crops"_a = nullptr,
+          "stream"_a = nullptr, R"pbdoc(
 
-	cvcuda.random_resized_crop(src: cvcuda.ImageBatchVarShape, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, stream: Optional[cvcuda.Stream] = None) -> cvcuda.ImageBatchVarShape
+	cvcuda.random_resized_crop(src: cvcuda.ImageBatchVarShape, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, crops: Optional[cvcuda.Tensor] = None, out_crops: Optional[cvcuda.Tensor] = None, stream: Optional[cvcuda.Stream] = None) -> cvcuda.ImageBatchVarShape
 
         Executes the RandomResizedCrop operation on the given cuda stream.
 
@@ -200,6 +232,8 @@ void ExportOpRandomResizedCrop(py::module &m)
             max_ratio (double, optional): Upper bound for the random aspect ratio of the crop, before resizing.
             interp (cvcuda.Interp, optional): Interpolation type used for transform.
             seed (int, optional): Random seed, should be unsigned int32.
+            crops (cvcuda.Tensor, optional): Crops (x, y, width, height) to use instead of random ones, with NC layout and 4 int32 per sample.
+            out_crops (cvcuda.Tensor, optional): Tensor receiving the crops used, with the same shape and type as crops.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -212,9 +246,10 @@ void ExportOpRandomResizedCrop(py::module &m)
 
     m.def("random_resized_crop_into", &RandomResizedCropVarShapeInto, "dst"_a, "src"_a, "min_scale"_a = 0.08,
           "max_scale"_a = 1.0, "min_ratio"_a = 0.75, "max_ratio"_a = 1.3333333333333333,
-          "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0, py::kw_only(), "stream"_a = nullptr, R"pbdoc(
+          "interp"_a = NVCV_INTERP_LINEAR, "seed"_a = 0, py::kw_only(), "crops"_a = nullptr, "out_crops"_a = nullptr,
+          "stream"_a = nullptr, R"pbdoc(
 
-	cvcuda.random_resized_crop_into(dst: cvcuda.ImageBatchVarShape, src: cvcuda.ImageBatchVarShape, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, stream: Optional[cvcuda.Stream] = None)
+	cvcuda.random_resized_crop_into(dst: cvcuda.ImageBatchVarShape, src: cvcuda.ImageBatchVarShape, shape: Tuple, min_scale: double, max_scale: double, min_ratio: double, max_ratio: double, interp: Interp = cvcuda.Interp.LINEAR, seed: int, crops: Optional[cvcuda.Tensor] = None, out_crops: Optional[cvcuda.Tensor] = None, stream: Optional[cvcuda.Stream] = None)
 
         Executes the RandomResizedCrop operation on the given cuda stream.
 
@@ -231,6 +266,8 @@ void ExportOpRandomResizedCrop(py::module &m)
             max_ratio (double, optional): Upper bound for the random aspect ratio of the crop, before resizing.
             interp (cvcuda.Interp, optional): Interpolation type used for transform.
             seed (int, optional): Random seed, should be unsigned int32.
+            crops (cvcuda.Tensor, optional): Crops (x, y, width, height) to use instead of random ones, with NC layout and 4 int32 per sample.
+            out_crops (cvcuda.Tensor, optional): Tensor receiving the crops used, with the same shape and type as crops.
             stream (cvcuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
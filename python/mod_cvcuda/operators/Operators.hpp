@@ -27,6 +27,8 @@
 #include <nvcv/python/TensorBatch.hpp>
 #include <pybind11/pybind11.h>
 
+#include <array>
+
 #include <nvcv/python/Fwd.hpp>
 
 namespace nvcvpy::util {
@@ -93,6 +95,9 @@ void ExportOpSIFT(py::module &m);
 void ExportOpHistogram(py::module &m);
 void ExportOpInpaint(py::module &m);
 void ExportOpHistogramEq(py::module &m);
+void ExportOpImageStats(py::module &m);
+void ExportOpIntegral(py::module &m);
+void ExportOpAdaptiveHistogramEq(py::module &m);
 void ExportOpMinAreaRect(py::module &m);
 void ExportOpAdvCvtColor(py::module &m);
 void ExportOpLabel(py::module &m);
@@ -176,8 +181,76 @@ private:
     OP  m_op;
 };
 
+// Per-thread direct-mapped cache of the operators fetched last, sitting in front of the resource cache.
+// A hit avoids the resource cache mutex and the copy of all matching items, which dominate the cost of
+// creating trivial operators. Slots are indexed by the key hash (operator type and ctor args) and an
+// entry is only returned if its key is compatible with the requested one and the operator isn't in use,
+// e.g. by work still pending on another stream, otherwise the resource cache picks or creates one. Slots
+// only hold weak references so that they neither keep operators alive nor count as a use, and they're
+// all dropped as soon as items are removed from the resource cache, e.g. by clear_cache.
+class OperatorInlineCache
+{
+public:
+    static std::shared_ptr<nvcvpy::ICacheItem> Fetch(const nvcvpy::IKey &key, size_t hash)
+    {
+        Slot &slot = Instance().slot(hash);
+        if (slot.hash != hash)
+        {
+            return {};
+        }
+
+        std::shared_ptr<nvcvpy::ICacheItem> item = slot.item.lock();
+
+        // Apart from us, an idle operator is only referenced by the resource cache
+        if (item && item.use_count() <= 2 && key == item->key())
+        {
+            return item;
+        }
+        return {};
+    }
+
+    static void Store(size_t hash, const std::shared_ptr<nvcvpy::ICacheItem> &item)
+    {
+        Slot &slot = Instance().slot(hash);
+        slot.hash  = hash;
+        slot.item  = item;
+    }
+
+private:
+    static constexpr size_t kNumSlots = 64;
+
+    struct Slot
+    {
+        size_t                            hash = 0;
+        std::weak_ptr<nvcvpy::ICacheItem> item;
+    };
+
+    struct State
+    {
+        uint64_t                    generation = 0;
+        std::array<Slot, kNumSlots> slots;
+
+        Slot &slot(size_t hash)
+        {
+            uint64_t curGeneration = nvcvpy::Cache::generation();
+            if (curGeneration != generation)
+            {
+                slots      = {};
+                generation = curGeneration;
+            }
+            return slots[hash % kNumSlots];
+        }
+    };
+
+    static State &Instance()
+    {
+        thread_local State state;
+        return state;
+    }
+};
+
 // Creates an operator instance.
-// Either gets it from the resource cache or creates one from scratch.
+// Either gets it from the per-thread inline cache, the resource cache or creates one from scratch.
 // When creating, it'll be added to the cache.
 template<class PyOP, class... CTOR_ARGS>
 std::shared_ptr<PyOP> CreateOperatorEx(CTOR_ARGS &&...args)
@@ -186,28 +259,40 @@ std::shared_ptr<PyOP> CreateOperatorEx(CTOR_ARGS &&...args)
     using Key = typename PyOP::Key;
 
     // Creates a key out of the operator's ctor parameters
-    Key key{args...};
+    Key    key{args...};
+    size_t hash = key.hash();
+
+    // Fast path, the same operator was requested recently by this thread
+    if (std::shared_ptr<nvcvpy::ICacheItem> item = OperatorInlineCache::Fetch(key, hash))
+    {
+        if (auto op = std::dynamic_pointer_cast<PyOP>(std::move(item)))
+        {
+            return op;
+        }
+    }
 
     // Try to fetch it from cache
     std::vector<std::shared_ptr<nvcvpy::ICacheItem>> vcont = nvcvpy::Cache::fetch(key);
 
+    std::shared_ptr<PyOP> op;
+
     // None found?
     if (vcont.empty())
     {
         // Creates a new one
-        auto op = std::shared_ptr<PyOP>(new PyOP(std::forward<CTOR_ARGS>(args)...));
+        op = std::shared_ptr<PyOP>(new PyOP(std::forward<CTOR_ARGS>(args)...));
 
         // Adds to the resource cache
         nvcvpy::Cache::add(*op);
-
-        return op;
     }
     else
     {
-        auto op = std::dynamic_pointer_cast<PyOP>(PyOP::fetch(vcont));
+        op = std::dynamic_pointer_cast<PyOP>(PyOP::fetch(vcont));
         assert(op);
-        return op;
     }
+
+    OperatorInlineCache::Store(hash, op);
+    return op;
 }
 
 template<class OP, class... CTOR_ARGS>
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpAdaptiveHistogramEq.hpp"
+
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaAdaptiveHistogramEqCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::AdaptiveHistogramEq());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaAdaptiveHistogramEqSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   NVCVSize2D tileGrid, float clipLimit, float temporalAlpha, int8_t resetState))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::AdaptiveHistogramEq>(handle)(stream, input, output, tileGrid, clipLimit,
+                                                                  temporalAlpha, resetState != 0);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaAdaptiveHistogramEqReleaseState,
+                  (NVCVOperatorHandle handle, cudaStream_t stream))
+{
+    return nvcv::ProtectCall([&] { priv::ToDynamicRef<priv::AdaptiveHistogramEq>(handle).releaseState(stream); });
+}
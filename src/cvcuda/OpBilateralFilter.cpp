@@ -68,3 +68,43 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaBilateralFilterVarShapeSubmit,
                                                               sigmaSpaceData, borderMode);
         });
 }
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaBilateralFilterGridSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   int diameter, float sigmaColor, float sigmaSpace, const NVCVBilateralGridParams *gridParams))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (gridParams == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to bilateral grid parameters must not be NULL");
+            }
+
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::BilateralFilter>(handle)(stream, input, output, diameter, sigmaColor, sigmaSpace,
+                                                              *gridParams);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaBilateralFilterGridVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   NVCVTensorHandle diameter, NVCVTensorHandle sigmaColor, NVCVTensorHandle sigmaSpace,
+                   const NVCVBilateralGridParams *gridParams))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (gridParams == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to bilateral grid parameters must not be NULL");
+            }
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            nvcv::TensorWrapHandle diameterData(diameter), sigmaColorData(sigmaColor), sigmaSpaceData(sigmaSpace);
+            priv::ToDynamicRef<priv::BilateralFilter>(handle)(stream, input, output, diameterData, sigmaColorData,
+                                                              sigmaSpaceData, *gridParams);
+        });
+}
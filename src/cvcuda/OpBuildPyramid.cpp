@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpBuildPyramid.hpp"
+
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
+#include <nvcv/util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaBuildPyramidCreate, (NVCVOperatorHandle * handle, int3 maxShape))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::BuildPyramid(maxShape));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaBuildPyramidSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorBatchHandle pyramid,
+                   float initSigma, bool expandInput, NVCVPyramidInfo *pyramidInfo))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorWrapHandle      _in(in);
+            nvcv::TensorBatchWrapHandle _pyramid(pyramid);
+
+            NVCVPyramidInfo info = priv::ToDynamicRef<priv::BuildPyramid>(handle)(stream, _in, _pyramid, initSigma,
+                                                                                   expandInput);
+            if (pyramidInfo != nullptr)
+            {
+                *pyramidInfo = info;
+            }
+        });
+}
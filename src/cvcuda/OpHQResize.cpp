@@ -137,3 +137,22 @@ CVCUDA_DEFINE_API(0, 6, NVCVStatus, cvcudaHQResizeTensorBatchSubmit,
                                                        antialias, roi);
         });
 }
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaHQResizePyramidSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, const NVCVWorkspace *ws,
+                   NVCVTensorBatchHandle pyramid, const NVCVPyramidInfo *pyramidInfo, NVCVTensorHandle out,
+                   const NVCVInterpolationType minInterpolation, const NVCVInterpolationType magInterpolation,
+                   bool antialias))
+{
+    if (!ws || !pyramidInfo)
+        return NVCV_ERROR_INVALID_ARGUMENT;
+
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorBatchWrapHandle _pyramid(pyramid);
+            nvcv::TensorWrapHandle      _out(out);
+            priv::ToDynamicRef<priv::HQResize>(handle)(stream, *ws, _pyramid, *pyramidInfo, _out, minInterpolation,
+                                                       magInterpolation, antialias);
+        });
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpImageStats.hpp"
+
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaImageStatsCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::ImageStats());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaImageStatsSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle mask,
+                   NVCVTensorHandle rois, float histLow, float histHigh, NVCVTensorHandle histogram,
+                   NVCVTensorHandle minMaxVal, NVCVTensorHandle minMaxLoc, NVCVTensorHandle sum,
+                   NVCVTensorHandle sumSq))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorWrapHandle input(in);
+
+            priv::ToDynamicRef<priv::ImageStats>(handle)(
+                stream, input, nvcv::TensorWrapHandle{mask}, nvcv::TensorWrapHandle{rois}, histLow, histHigh,
+                nvcv::TensorWrapHandle{histogram}, nvcv::TensorWrapHandle{minMaxVal},
+                nvcv::TensorWrapHandle{minMaxLoc}, nvcv::TensorWrapHandle{sum}, nvcv::TensorWrapHandle{sumSq});
+        });
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpIntegral.hpp"
+
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaIntegralCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::Integral());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaIntegralSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle sum,
+                   NVCVTensorHandle sqsum))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorWrapHandle input(in);
+            priv::ToDynamicRef<priv::Integral>(handle)(stream, input, NVCV_TENSOR_HANDLE_TO_OPTIONAL(sum),
+                                                       NVCV_TENSOR_HANDLE_TO_OPTIONAL(sqsum));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaIntegralVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle sum,
+                   NVCVImageBatchHandle sqsum))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+            priv::ToDynamicRef<priv::Integral>(handle)(stream, input, NVCV_IMAGE_BATCH_VAR_SHAPE_HANDLE_TO_OPTIONAL(sum),
+                                                       NVCV_IMAGE_BATCH_VAR_SHAPE_HANDLE_TO_OPTIONAL(sqsum));
+        });
+}
@@ -68,3 +68,44 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaJointBilateralFilterVarShapeSubmit,
                                                                    sigmaColorData, sigmaSpaceData, borderMode);
         });
 }
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaJointBilateralFilterGridSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle inColor,
+                   NVCVTensorHandle out, int diameter, float sigmaColor, float sigmaSpace,
+                   const NVCVBilateralGridParams *gridParams))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (gridParams == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to bilateral grid parameters must not be NULL");
+            }
+
+            nvcv::TensorWrapHandle input(in), inputColor(inColor), output(out);
+            priv::ToDynamicRef<priv::JointBilateralFilter>(handle)(stream, input, inputColor, output, diameter,
+                                                                   sigmaColor, sigmaSpace, *gridParams);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaJointBilateralFilterGridVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in,
+                   NVCVImageBatchHandle inColor, NVCVImageBatchHandle out, NVCVTensorHandle diameter,
+                   NVCVTensorHandle sigmaColor, NVCVTensorHandle sigmaSpace, const NVCVBilateralGridParams *gridParams))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (gridParams == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to bilateral grid parameters must not be NULL");
+            }
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), inputColor(inColor), output(out);
+            nvcv::TensorWrapHandle diameterData(diameter), sigmaColorData(sigmaColor), sigmaSpaceData(sigmaSpace);
+            priv::ToDynamicRef<priv::JointBilateralFilter>(handle)(stream, input, inputColor, output, diameterData,
+                                                                   sigmaColorData, sigmaSpaceData, *gridParams);
+        });
+}
@@ -52,7 +52,8 @@ CVCUDA_DEFINE_API(0, 4, NVCVStatus, cvcudaRandomResizedCropSubmit,
         [&]
         {
             nvcv::TensorWrapHandle input(in), output(out);
-            priv::ToDynamicRef<priv::RandomResizedCrop>(handle)(stream, input, output, interpolation);
+            priv::ToDynamicRef<priv::RandomResizedCrop>(handle)(stream, input, output, interpolation, nvcv::NullOpt,
+                                                                nvcv::NullOpt);
         });
 }
 
@@ -64,6 +65,35 @@ CVCUDA_DEFINE_API(0, 4, NVCVStatus, cvcudaRandomResizedCropVarShapeSubmit,
         [&]
         {
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
-            priv::ToDynamicRef<priv::RandomResizedCrop>(handle)(stream, input, output, interpolation);
+            priv::ToDynamicRef<priv::RandomResizedCrop>(handle)(stream, input, output, interpolation, nvcv::NullOpt,
+                                                                nvcv::NullOpt);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaRandomResizedCropWithCropsSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   const NVCVInterpolationType interpolation, NVCVTensorHandle inCrops, NVCVTensorHandle outCrops))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::RandomResizedCrop>(handle)(stream, input, output, interpolation,
+                                                                NVCV_TENSOR_HANDLE_TO_OPTIONAL(inCrops),
+                                                                NVCV_TENSOR_HANDLE_TO_OPTIONAL(outCrops));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaRandomResizedCropVarShapeWithCropsSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   const NVCVInterpolationType interpolation, NVCVTensorHandle inCrops, NVCVTensorHandle outCrops))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::RandomResizedCrop>(handle)(stream, input, output, interpolation,
+                                                                NVCV_TENSOR_HANDLE_TO_OPTIONAL(inCrops),
+                                                                NVCV_TENSOR_HANDLE_TO_OPTIONAL(outCrops));
         });
 }
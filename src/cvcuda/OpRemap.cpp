@@ -69,3 +69,19 @@ CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRemapVarShapeSubmit,
                                                     static_cast<bool>(alignCorners), border, borderValue);
         });
 }
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaRemapMakeMapSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle map, const NVCVRemapModel *model))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (model == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pointer to remap model must not be NULL");
+            }
+
+            nvcv::TensorWrapHandle _map(map);
+            priv::ToDynamicRef<priv::Remap>(handle).makeMap(stream, _map, *model);
+        });
+}
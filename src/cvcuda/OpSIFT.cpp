@@ -21,6 +21,7 @@
 
 #include <nvcv/Exception.hpp>
 #include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
 #include <nvcv/util/Assert.h>
 
 namespace priv = cvcuda::priv;
@@ -56,3 +57,25 @@ CVCUDA_DEFINE_API(0, 4, NVCVStatus, cvcudaSIFTSubmit,
                                                    initSigma, flags);
         });
 }
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaSIFTPyramidSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorBatchHandle pyramid,
+                   const NVCVPyramidInfo *pyramidInfo, NVCVTensorHandle featCoords, NVCVTensorHandle featMetadata,
+                   NVCVTensorHandle featDescriptors, NVCVTensorHandle numFeatures, float contrastThreshold,
+                   float edgeThreshold))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (pyramidInfo == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pointer to pyramid info must not be NULL");
+            }
+
+            nvcv::TensorBatchWrapHandle _pyramid(pyramid);
+            nvcv::TensorWrapHandle      _featCoords(featCoords), _featMetadata(featMetadata),
+                _featDescriptors(featDescriptors), _numFeatures(numFeatures);
+            priv::ToDynamicRef<priv::SIFT>(handle)(stream, _pyramid, *pyramidInfo, _featCoords, _featMetadata,
+                                                   _featDescriptors, _numFeatures, contrastThreshold, edgeThreshold);
+        });
+}
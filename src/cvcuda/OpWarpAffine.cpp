@@ -69,3 +69,17 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaWarpAffineVarShapeSubmit,
                                                          borderValue);
         });
 }
+
+CVCUDA_DEFINE_API(0, 16, NVCVStatus, cvcudaWarpAffineMatrixTensorSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                   const float4 borderValue))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            nvcv::TensorWrapHandle input(in), output(out), transMatrixWrap(transMatrix);
+            priv::ToDynamicRef<priv::WarpAffine>(handle)(stream, input, output, transMatrixWrap, flags, borderMode,
+                                                   borderValue);
+        });
+}
@@ -0,0 +1,655 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_GRAPH_HPP
+#define CVCUDA_GRAPH_HPP
+
+#include "MemoryPlanner.hpp"
+#include "Workspace.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/alloc/Allocator.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace cvcuda {
+
+/** The tensors and workspace given to a graph node when the graph is executed. */
+struct GraphNodeArgs
+{
+    std::vector<nvcv::Tensor> inputs;
+    std::vector<nvcv::Tensor> outputs;
+
+    /** The node workspace, all empty if the node did not request one */
+    Workspace workspace;
+};
+
+/** A recorded sequence of operator submissions with planned memory.
+ *
+ * Each node of the graph is a callable submitting work (typically one operator call) to a stream. Nodes exchange
+ * data through tensors: graph inputs and outputs are given by the user at execution, while intermediate tensors are
+ * declared with a symbolic shape, where `Graph::kBatch` stands for the batch size given at execution.
+ *
+ * Before executing for a batch size, the graph runs a liveness analysis over its nodes and places all intermediate
+ * tensors and node CUDA workspaces in a single device arena, aliasing the ones that are never live at the same time
+ * (see `PlanMemory`). The plan is replayed as long as the batch size does not change, and the arena only grows.
+ *
+ * With `useCudaGraph`, the node submissions are captured in a CUDA graph the first time the graph runs with a given
+ * batch size and set of user tensors, and later runs launch the captured graph. Nodes must then be capturable: they
+ * cannot synchronize the stream, and their host-side parameters are fixed at capture time.
+ *
+ * @note Executions are stream-ordered; the graph must not be executed concurrently on different streams.
+ */
+class Graph
+{
+public:
+    using TensorId      = int;
+    using NodeFunc      = std::function<void(cudaStream_t stream, const GraphNodeArgs &args)>;
+    using WorkspaceFunc = std::function<WorkspaceRequirements(int batchSize)>;
+
+    /** Shape extent replaced by the batch size given at execution */
+    static constexpr int64_t kBatch = -1;
+
+    explicit Graph(bool useCudaGraph = false, nvcv::Allocator alloc = {});
+
+    Graph(const Graph &)            = delete;
+    Graph &operator=(const Graph &) = delete;
+
+    ~Graph();
+
+    /** Declares a tensor given by the user at execution, in the order of `inputs` in `run`. */
+    TensorId addInput();
+
+    /** Declares a tensor given by the user at execution, in the order of `outputs` in `run`. */
+    TensorId addOutput();
+
+    /** Declares an intermediate tensor living in the graph arena.
+     *
+     * @param [in] shape Tensor shape, where extents equal to `kBatch` are set to the batch size at execution.
+     * @param [in] layout Tensor layout, with the same rank as the shape.
+     * @param [in] dtype Tensor data type.
+     */
+    TensorId addTensor(const nvcv::TensorShape::ShapeType &shape, const nvcv::TensorLayout &layout,
+                       nvcv::DataType dtype);
+
+    /** Appends a node to the graph.
+     *
+     * @param [in] inputs Tensors read by the node; intermediate tensors must be produced by an earlier node.
+     * @param [in] outputs Tensors written by the node.
+     * @param [in] func Callable submitting the node work to the given stream.
+     * @param [in] workspace Optional callable returning the node workspace requirements for a batch size.
+     */
+    void addNode(std::vector<TensorId> inputs, std::vector<TensorId> outputs, NodeFunc func,
+                 WorkspaceFunc workspace = {});
+
+    /** Plans the memory of the graph for a batch size, the plan blocks are the intermediate tensors followed by the
+     * CUDA memory of the node workspaces. */
+    const MemoryPlan &plan(int batchSize);
+
+    /** Executes the graph on a stream, planning and allocating its memory when needed.
+     *
+     * @param [in] stream CUDA stream to run the nodes on.
+     * @param [in] batchSize Batch size replacing `kBatch` in the intermediate tensor shapes.
+     * @param [in] inputs Tensors bound to the graph inputs, in declaration order.
+     * @param [in] outputs Tensors bound to the graph outputs, in declaration order.
+     */
+    void run(cudaStream_t stream, int batchSize, const std::vector<nvcv::Tensor> &inputs,
+             const std::vector<nvcv::Tensor> &outputs);
+
+private:
+    enum class TensorKind
+    {
+        INPUT,
+        OUTPUT,
+        INTERMEDIATE
+    };
+
+    struct TensorDesc
+    {
+        TensorKind                   kind;
+        int                          externalIdx;
+        nvcv::TensorShape::ShapeType shape;
+        nvcv::TensorLayout           layout;
+        nvcv::DataType               dtype;
+    };
+
+    struct Node
+    {
+        std::vector<TensorId> inputs, outputs;
+        NodeFunc              func;
+        WorkspaceFunc         workspace;
+    };
+
+    struct Buffer
+    {
+        void  *data = nullptr;
+        size_t size = 0, alignment = 0;
+    };
+
+    void checkTensorId(TensorId id) const;
+    void invalidate();
+    void allocate();
+    void bind(const std::vector<nvcv::Tensor> &inputs, const std::vector<nvcv::Tensor> &outputs);
+    void submit(cudaStream_t stream, bool capturing);
+    void freeBuffers();
+    void destroyExec();
+
+    static void Check(cudaError_t err, const char *what)
+    {
+        if (err != cudaSuccess)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INTERNAL, "%s failed: %s", what, cudaGetErrorString(err));
+        }
+    }
+
+    bool            m_useCudaGraph;
+    nvcv::Allocator m_alloc;
+
+    std::vector<TensorDesc> m_tensors;
+    std::vector<Node>       m_nodes;
+    int                     m_numInputs = 0, m_numOutputs = 0;
+
+    // Current plan and its memory
+    int                                     m_planBatchSize = -1;
+    MemoryPlan                              m_plan;
+    std::vector<nvcv::TensorShape>          m_shapes;
+    std::vector<nvcv::Tensor::Requirements> m_reqs;
+    std::vector<WorkspaceRequirements>      m_wsReqs;
+    std::vector<size_t>                     m_hostOffsets, m_pinnedOffsets;
+    size_t                                  m_hostSize = 0, m_pinnedSize = 0;
+    bool                                    m_bound    = false;
+
+    Buffer                     m_arena, m_host, m_pinned;
+    std::vector<cudaEvent_t>   m_pinnedReady;
+    std::vector<nvcv::Tensor>  m_boundTensors;
+    std::vector<GraphNodeArgs> m_args;
+
+    // Execution state
+    cudaEvent_t                    m_done = nullptr;
+    cudaGraphExec_t                m_exec = nullptr;
+    std::vector<const void *>      m_execPtrs;
+    std::vector<nvcv::TensorShape> m_execShapes;
+};
+
+inline Graph::Graph(bool useCudaGraph, nvcv::Allocator alloc)
+    : m_useCudaGraph(useCudaGraph)
+    , m_alloc(std::move(alloc))
+{
+    if (!m_alloc)
+    {
+        nvcv::CustomAllocator<> cust{};
+        m_alloc = std::move(cust);
+    }
+    Check(cudaEventCreateWithFlags(&m_done, cudaEventDisableTiming), "cudaEventCreateWithFlags");
+}
+
+inline Graph::~Graph()
+{
+    if (m_done)
+    {
+        cudaEventSynchronize(m_done);
+    }
+    destroyExec();
+    freeBuffers();
+    if (m_done)
+    {
+        cudaEventDestroy(m_done);
+    }
+}
+
+inline Graph::TensorId Graph::addInput()
+{
+    invalidate();
+    m_tensors.push_back(TensorDesc{TensorKind::INPUT, m_numInputs++, {}, nvcv::TensorLayout{}, nvcv::DataType{}});
+    return static_cast<TensorId>(m_tensors.size() - 1);
+}
+
+inline Graph::TensorId Graph::addOutput()
+{
+    invalidate();
+    m_tensors.push_back(TensorDesc{TensorKind::OUTPUT, m_numOutputs++, {}, nvcv::TensorLayout{}, nvcv::DataType{}});
+    return static_cast<TensorId>(m_tensors.size() - 1);
+}
+
+inline Graph::TensorId Graph::addTensor(const nvcv::TensorShape::ShapeType &shape, const nvcv::TensorLayout &layout,
+                                        nvcv::DataType dtype)
+{
+    if (layout.rank() != shape.rank())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Graph tensor layout rank must match its shape rank");
+    }
+    for (int64_t extent : shape)
+    {
+        if (extent < 0 && extent != kBatch)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Graph tensor shape extents must be non-negative or kBatch");
+        }
+    }
+    invalidate();
+    m_tensors.push_back(TensorDesc{TensorKind::INTERMEDIATE, -1, shape, layout, dtype});
+    return static_cast<TensorId>(m_tensors.size() - 1);
+}
+
+inline void Graph::addNode(std::vector<TensorId> inputs, std::vector<TensorId> outputs, NodeFunc func,
+                           WorkspaceFunc workspace)
+{
+    if (!func)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Graph node function must not be empty");
+    }
+    for (TensorId id : inputs)
+    {
+        checkTensorId(id);
+    }
+    for (TensorId id : outputs)
+    {
+        checkTensorId(id);
+        if (m_tensors[id].kind == TensorKind::INPUT)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Graph inputs cannot be written by a node");
+        }
+    }
+    invalidate();
+    m_nodes.push_back(Node{std::move(inputs), std::move(outputs), std::move(func), std::move(workspace)});
+}
+
+inline void Graph::checkTensorId(TensorId id) const
+{
+    if (id < 0 || id >= static_cast<TensorId>(m_tensors.size()))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid graph tensor id %d", id);
+    }
+}
+
+inline void Graph::invalidate()
+{
+    m_planBatchSize = -1;
+    m_bound         = false;
+    destroyExec();
+}
+
+inline const MemoryPlan &Graph::plan(int batchSize)
+{
+    if (batchSize <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Graph batch size must be positive");
+    }
+    if (batchSize == m_planBatchSize)
+    {
+        return m_plan;
+    }
+    invalidate();
+
+    const int numTensors = static_cast<int>(m_tensors.size());
+    const int numNodes   = static_cast<int>(m_nodes.size());
+
+    // Liveness: an intermediate tensor lives from the node producing it to the last node using it
+    std::vector<int> firstUse(numTensors, -1), lastUse(numTensors, -1);
+    for (int n = 0; n < numNodes; ++n)
+    {
+        for (TensorId id : m_nodes[n].inputs)
+        {
+            if (m_tensors[id].kind == TensorKind::INTERMEDIATE && firstUse[id] < 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Graph tensor %d is read by node %d before being written", id, n);
+            }
+            lastUse[id] = n;
+        }
+        for (TensorId id : m_nodes[n].outputs)
+        {
+            if (firstUse[id] < 0)
+            {
+                firstUse[id] = n;
+            }
+            lastUse[id] = n;
+        }
+    }
+
+    std::vector<MemoryBlock> blocks;
+
+    m_shapes.assign(numTensors, nvcv::TensorShape{});
+    m_reqs.assign(numTensors, nvcv::Tensor::Requirements{});
+    for (int t = 0; t < numTensors; ++t)
+    {
+        const TensorDesc &desc = m_tensors[t];
+        if (desc.kind != TensorKind::INTERMEDIATE)
+        {
+            continue;
+        }
+        nvcv::TensorShape::ShapeType shape = desc.shape;
+        for (int64_t &extent : shape)
+        {
+            if (extent == kBatch)
+            {
+                extent = batchSize;
+            }
+        }
+        m_shapes[t] = nvcv::TensorShape(shape, desc.layout);
+        m_reqs[t]   = nvcv::Tensor::CalcRequirements(m_shapes[t], desc.dtype);
+
+        size_t size = shape.rank() > 0 ? static_cast<size_t>(m_reqs[t].strides[0] * m_reqs[t].shape[0]) : 0;
+        if (firstUse[t] < 0) // never written, keep it alive during the whole graph
+        {
+            firstUse[t] = 0;
+            lastUse[t]  = numNodes;
+        }
+        blocks.push_back(MemoryBlock{size, static_cast<size_t>(m_reqs[t].alignBytes), firstUse[t], lastUse[t]});
+    }
+
+    // Node workspaces: CUDA memory is stream-ordered and can be aliased, host and pinned memory are filled by the
+    // host at submission time and get a region of their own
+    m_wsReqs.assign(numNodes, WorkspaceRequirements{});
+    m_hostOffsets.assign(numNodes, 0);
+    m_pinnedOffsets.assign(numNodes, 0);
+    m_hostSize = m_pinnedSize = 0;
+    for (int n = 0; n < numNodes; ++n)
+    {
+        WorkspaceRequirements &req = m_wsReqs[n];
+        req                        = m_nodes[n].workspace ? m_nodes[n].workspace(batchSize) : WorkspaceRequirements{};
+        if (req.hostMem.size)
+        {
+            m_hostOffsets[n] = nvcv::detail::AlignUp(m_hostSize, req.hostMem.alignment);
+            m_hostSize       = m_hostOffsets[n] + req.hostMem.size;
+        }
+        if (req.pinnedMem.size)
+        {
+            m_pinnedOffsets[n] = nvcv::detail::AlignUp(m_pinnedSize, req.pinnedMem.alignment);
+            m_pinnedSize       = m_pinnedOffsets[n] + req.pinnedMem.size;
+        }
+        blocks.push_back(MemoryBlock{req.cudaMem.size, req.cudaMem.alignment ? req.cudaMem.alignment : 1, n, n});
+    }
+
+    m_plan          = PlanMemory(blocks);
+    m_planBatchSize = batchSize;
+    return m_plan;
+}
+
+inline void Graph::freeBuffers()
+{
+    if (m_arena.data)
+    {
+        m_alloc.cudaMem().free(m_arena.data, m_arena.size, m_arena.alignment);
+    }
+    if (m_host.data)
+    {
+        m_alloc.hostMem().free(m_host.data, m_host.size, m_host.alignment);
+    }
+    if (m_pinned.data)
+    {
+        m_alloc.hostPinnedMem().free(m_pinned.data, m_pinned.size, m_pinned.alignment);
+    }
+    m_arena = m_host = m_pinned = Buffer{};
+
+    for (cudaEvent_t ev : m_pinnedReady)
+    {
+        cudaEventDestroy(ev);
+    }
+    m_pinnedReady.clear();
+}
+
+inline void Graph::destroyExec()
+{
+    if (m_exec)
+    {
+        // The last launch may still be running
+        cudaEventSynchronize(m_done);
+        cudaGraphExecDestroy(m_exec);
+        m_exec = nullptr;
+    }
+    m_execPtrs.clear();
+    m_execShapes.clear();
+}
+
+inline void Graph::allocate()
+{
+    const size_t hostAlign = alignof(std::max_align_t), pinnedAlign = 256;
+
+    bool grow = m_plan.arenaSize > m_arena.size || m_plan.alignment > m_arena.alignment || m_hostSize > m_host.size
+             || m_pinnedSize > m_pinned.size || m_pinnedReady.size() < m_nodes.size();
+    for (const WorkspaceRequirements &req : m_wsReqs)
+    {
+        grow = grow || req.hostMem.alignment > hostAlign || req.pinnedMem.alignment > pinnedAlign;
+    }
+    if (!grow)
+    {
+        return;
+    }
+
+    // Previous executions may still use the memory
+    Check(cudaEventSynchronize(m_done), "cudaEventSynchronize");
+    destroyExec();
+    m_bound = false;
+
+    Buffer arena{nullptr, std::max(m_plan.arenaSize, m_arena.size), std::max(m_plan.alignment, m_arena.alignment)};
+    Buffer host{nullptr, std::max(m_hostSize, m_host.size), hostAlign};
+    Buffer pinned{nullptr, std::max(m_pinnedSize, m_pinned.size), pinnedAlign};
+    size_t numEvents = std::max(m_pinnedReady.size(), m_nodes.size());
+    for (const WorkspaceRequirements &req : m_wsReqs)
+    {
+        host.alignment   = std::max(host.alignment, req.hostMem.alignment);
+        pinned.alignment = std::max(pinned.alignment, req.pinnedMem.alignment);
+    }
+    freeBuffers();
+
+    if (arena.size)
+    {
+        arena.data = m_alloc.cudaMem().alloc(arena.size, arena.alignment);
+    }
+    m_arena = arena;
+    if (host.size)
+    {
+        host.data = m_alloc.hostMem().alloc(host.size, host.alignment);
+    }
+    m_host = host;
+    if (pinned.size)
+    {
+        pinned.data = m_alloc.hostPinnedMem().alloc(pinned.size, pinned.alignment);
+    }
+    m_pinned = pinned;
+    for (size_t i = 0; i < numEvents; ++i)
+    {
+        cudaEvent_t ev;
+        Check(cudaEventCreateWithFlags(&ev, cudaEventDisableTiming), "cudaEventCreateWithFlags");
+        m_pinnedReady.push_back(ev);
+    }
+}
+
+inline void Graph::bind(const std::vector<nvcv::Tensor> &inputs, const std::vector<nvcv::Tensor> &outputs)
+{
+    if (static_cast<int>(inputs.size()) != m_numInputs || static_cast<int>(outputs.size()) != m_numOutputs)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Graph expects %d inputs and %d outputs",
+                              m_numInputs, m_numOutputs);
+    }
+
+    const int numTensors = static_cast<int>(m_tensors.size());
+
+    // Intermediate tensors wrap the arena and only change with the plan or the arena
+    if (!m_bound)
+    {
+        m_boundTensors.assign(numTensors, nvcv::Tensor{});
+        for (int t = 0; t < numTensors; ++t)
+        {
+            if (m_tensors[t].kind != TensorKind::INTERMEDIATE)
+            {
+                continue;
+            }
+            nvcv::TensorDataStridedCuda::Buffer buf;
+            for (int d = 0; d < m_reqs[t].rank; ++d)
+            {
+                buf.strides[d] = m_reqs[t].strides[d];
+            }
+            buf.basePtr = reinterpret_cast<NVCVByte *>(static_cast<char *>(m_arena.data) + m_plan.offsets[t]);
+
+            m_boundTensors[t]
+                = nvcv::TensorWrapData(nvcv::TensorDataStridedCuda(m_shapes[t], m_tensors[t].dtype, buf));
+        }
+        m_bound = true;
+    }
+
+    for (int t = 0; t < numTensors; ++t)
+    {
+        const TensorDesc &desc = m_tensors[t];
+        if (desc.kind == TensorKind::INPUT)
+        {
+            m_boundTensors[t] = inputs[desc.externalIdx];
+        }
+        else if (desc.kind == TensorKind::OUTPUT)
+        {
+            m_boundTensors[t] = outputs[desc.externalIdx];
+        }
+    }
+
+    // Intermediate blocks come first in the plan, followed by one CUDA workspace block per node
+    size_t wsBlock = 0;
+    for (const TensorDesc &desc : m_tensors)
+    {
+        wsBlock += desc.kind == TensorKind::INTERMEDIATE ? 1 : 0;
+    }
+
+    m_args.resize(m_nodes.size());
+    for (size_t n = 0; n < m_nodes.size(); ++n, ++wsBlock)
+    {
+        GraphNodeArgs &args = m_args[n];
+        args.inputs.clear();
+        args.outputs.clear();
+        for (TensorId id : m_nodes[n].inputs)
+        {
+            args.inputs.push_back(m_boundTensors[id]);
+        }
+        for (TensorId id : m_nodes[n].outputs)
+        {
+            args.outputs.push_back(m_boundTensors[id]);
+        }
+
+        const WorkspaceRequirements &req = m_wsReqs[n];
+
+        args.workspace               = Workspace{};
+        args.workspace.hostMem.req   = req.hostMem;
+        args.workspace.pinnedMem.req = req.pinnedMem;
+        args.workspace.cudaMem.req   = req.cudaMem;
+        if (req.hostMem.size)
+        {
+            args.workspace.hostMem.data = static_cast<char *>(m_host.data) + m_hostOffsets[n];
+        }
+        if (req.pinnedMem.size)
+        {
+            args.workspace.pinnedMem.data  = static_cast<char *>(m_pinned.data) + m_pinnedOffsets[n];
+            args.workspace.pinnedMem.ready = m_pinnedReady[n];
+        }
+        if (req.cudaMem.size)
+        {
+            args.workspace.cudaMem.data = static_cast<char *>(m_arena.data) + m_plan.offsets[wsBlock];
+        }
+    }
+}
+
+inline void Graph::submit(cudaStream_t stream, bool capturing)
+{
+    for (size_t n = 0; n < m_nodes.size(); ++n)
+    {
+        if (capturing && m_args[n].workspace.pinnedMem.ready)
+        {
+            // The captured graph owns the pinned region, waiting on events outside the capture is not allowed
+            GraphNodeArgs args             = m_args[n];
+            args.workspace.pinnedMem.ready = nullptr;
+            m_nodes[n].func(stream, args);
+        }
+        else
+        {
+            m_nodes[n].func(stream, m_args[n]);
+        }
+    }
+}
+
+inline void Graph::run(cudaStream_t stream, int batchSize, const std::vector<nvcv::Tensor> &inputs,
+                       const std::vector<nvcv::Tensor> &outputs)
+{
+    plan(batchSize);
+    allocate();
+    bind(inputs, outputs);
+
+    if (!m_useCudaGraph)
+    {
+        submit(stream, false);
+        Check(cudaEventRecord(m_done, stream), "cudaEventRecord");
+        return;
+    }
+
+    // A captured graph is bound to the user tensors it was captured with
+    std::vector<const void *>      ptrs;
+    std::vector<nvcv::TensorShape> shapes;
+    for (const std::vector<nvcv::Tensor> *tensors : {&inputs, &outputs})
+    {
+        for (const nvcv::Tensor &t : *tensors)
+        {
+            auto data = t.exportData<nvcv::TensorDataStrided>();
+            if (!data)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Graph inputs and outputs must be strided tensors");
+            }
+            ptrs.push_back(data->basePtr());
+            shapes.push_back(data->shape());
+        }
+    }
+
+    if (!m_exec || ptrs != m_execPtrs || shapes != m_execShapes)
+    {
+        destroyExec();
+
+        Check(cudaStreamBeginCapture(stream, cudaStreamCaptureModeRelaxed), "cudaStreamBeginCapture");
+        cudaGraph_t graph = nullptr;
+        try
+        {
+            submit(stream, true);
+        }
+        catch (...)
+        {
+            cudaStreamEndCapture(stream, &graph);
+            if (graph)
+            {
+                cudaGraphDestroy(graph);
+            }
+            throw;
+        }
+        Check(cudaStreamEndCapture(stream, &graph), "cudaStreamEndCapture");
+
+        cudaError_t err = cudaGraphInstantiateWithFlags(&m_exec, graph, 0);
+        cudaGraphDestroy(graph);
+        Check(err, "cudaGraphInstantiateWithFlags");
+
+        m_execPtrs   = std::move(ptrs);
+        m_execShapes = std::move(shapes);
+    }
+
+    Check(cudaGraphLaunch(m_exec, stream), "cudaGraphLaunch");
+    Check(cudaEventRecord(m_done, stream), "cudaEventRecord");
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_GRAPH_HPP
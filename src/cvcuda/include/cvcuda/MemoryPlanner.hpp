@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_MEMORY_PLANNER_HPP
+#define CVCUDA_MEMORY_PLANNER_HPP
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/detail/Align.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace cvcuda {
+
+/** A memory block requested by one step of a sequence of operations.
+ *
+ * The block is live from the step `firstUse` to the step `lastUse`, both inclusive. Two blocks whose lifetimes do not
+ * overlap may occupy the same memory.
+ */
+struct MemoryBlock
+{
+    size_t size;
+    size_t alignment;
+    int    firstUse;
+    int    lastUse;
+};
+
+/** The result of planning the memory of a set of blocks in a single arena. */
+struct MemoryPlan
+{
+    /** Offset of each block in the arena, in the order the blocks were given */
+    std::vector<size_t> offsets;
+
+    /** Size and alignment of the arena that holds all the blocks */
+    size_t arenaSize = 0;
+    size_t alignment = 1;
+
+    /** Size needed if every block had its own memory, i.e. without aliasing */
+    size_t unaliasedSize = 0;
+
+    /** Largest total size of the blocks live at the same step, a lower bound of the arena size */
+    size_t peakLiveSize = 0;
+};
+
+namespace detail {
+
+inline bool LifetimesOverlap(const MemoryBlock &a, const MemoryBlock &b)
+{
+    return a.firstUse <= b.lastUse && b.firstUse <= a.lastUse;
+}
+
+} // namespace detail
+
+/** Assigns an offset in a single arena to each memory block, aliasing blocks whose lifetimes do not overlap.
+ *
+ * The blocks are placed from the largest to the smallest, each at the lowest suitably aligned offset that does not
+ * collide with an already placed block live at the same time. This is a pure host computation.
+ *
+ * @param [in] blocks Memory blocks to be placed.
+ *                    + Each alignment must be a power of 2.
+ *                    + Each firstUse must not be greater than its lastUse.
+ *
+ * @return The memory plan, with one offset per block.
+ *
+ * @throw nvcv::Exception with ERROR_INVALID_ARGUMENT if a block is not valid.
+ */
+inline MemoryPlan PlanMemory(const std::vector<MemoryBlock> &blocks)
+{
+    MemoryPlan plan;
+    plan.offsets.resize(blocks.size(), 0);
+
+    for (const MemoryBlock &b : blocks)
+    {
+        if (b.alignment == 0 || (b.alignment & (b.alignment - 1)) != 0)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Memory block alignment must be a power of 2");
+        }
+        if (b.firstUse > b.lastUse)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Memory block first use must not be after its last use");
+        }
+        plan.alignment     = std::max(plan.alignment, b.alignment);
+        plan.unaliasedSize = nvcv::detail::AlignUp(plan.unaliasedSize, b.alignment) + b.size;
+    }
+
+    for (const MemoryBlock &b : blocks)
+    {
+        size_t liveSize = 0;
+        for (const MemoryBlock &other : blocks)
+        {
+            if (other.firstUse <= b.firstUse && b.firstUse <= other.lastUse)
+            {
+                liveSize += other.size;
+            }
+        }
+        plan.peakLiveSize = std::max(plan.peakLiveSize, liveSize);
+    }
+
+    std::vector<size_t> order(blocks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&blocks](size_t a, size_t b)
+                     {
+                         if (blocks[a].size != blocks[b].size)
+                         {
+                             return blocks[a].size > blocks[b].size;
+                         }
+                         return blocks[a].firstUse < blocks[b].firstUse;
+                     });
+
+    std::vector<size_t> placed, collisions;
+    placed.reserve(blocks.size());
+
+    for (size_t i : order)
+    {
+        const MemoryBlock &b = blocks[i];
+        if (b.size == 0)
+        {
+            continue;
+        }
+
+        collisions.clear();
+        for (size_t j : placed)
+        {
+            if (detail::LifetimesOverlap(b, blocks[j]))
+            {
+                collisions.push_back(j);
+            }
+        }
+        std::sort(collisions.begin(), collisions.end(),
+                  [&plan](size_t a, size_t b) { return plan.offsets[a] < plan.offsets[b]; });
+
+        // Walk the colliding blocks by offset looking for the first gap that fits
+        size_t offset = 0;
+        for (size_t j : collisions)
+        {
+            if (nvcv::detail::AlignUp(offset, b.alignment) + b.size <= plan.offsets[j])
+            {
+                break;
+            }
+            offset = std::max(offset, plan.offsets[j] + blocks[j].size);
+        }
+        offset = nvcv::detail::AlignUp(offset, b.alignment);
+
+        plan.offsets[i] = offset;
+        plan.arenaSize  = std::max(plan.arenaSize, offset + b.size);
+        placed.push_back(i);
+    }
+
+    plan.arenaSize     = nvcv::detail::AlignUp(plan.arenaSize, plan.alignment);
+    plan.unaliasedSize = nvcv::detail::AlignUp(plan.unaliasedSize, plan.alignment);
+
+    return plan;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_MEMORY_PLANNER_HPP
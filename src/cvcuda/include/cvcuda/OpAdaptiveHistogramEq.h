@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpAdaptiveHistogramEq.h
+ *
+ * @brief Defines types and functions to handle the AdaptiveHistogramEq operation.
+ * @defgroup NVCV_C_ALGORITHM_ADAPTIVE_HISTOGRAM_EQ Adaptive Histogram Eq
+ * @{
+ */
+
+#ifndef CVCUDA_ADAPTIVE_HISTOGRAM_EQ_H
+#define CVCUDA_ADAPTIVE_HISTOGRAM_EQ_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Size.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the AdaptiveHistogramEq operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaAdaptiveHistogramEqCreate(NVCVOperatorHandle *handle);
+
+/** Executes the AdaptiveHistogramEq operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  The AdaptiveHistogramEq operation equalizes each channel of each sample image using contrast-limited adaptive
+ *  histogram equalization (CLAHE): the image is split in a grid of tiles, a histogram is computed per tile,
+ *  clipped at the clip limit with the excess redistributed uniformly among all bins, and turned into a look-up
+ *  table (LUT) mapping a value v to 255 * CDF(v) / tilePixels.  Each output pixel is the bilinear blend of the
+ *  LUTs of its four nearest tiles.  A 1x1 tile grid with no clip limit is a global (non-adaptive) equalization.
+ *
+ *  The operator is meant for video, where consecutive calls on the same CUDA stream process consecutive frames.
+ *  The LUTs of each call are kept in a small device buffer persistent across calls, one buffer per CUDA stream the
+ *  operator is submitted to, and the LUTs used for a frame are the exponential moving average (EMA) of the LUTs
+ *  (i.e. of the normalized CDFs) of the current and past frames:
+ *
+ *      state = temporalAlpha * LUT(frame) + (1 - temporalAlpha) * state
+ *
+ *  The state of a stream is (re)initialized from the current frame LUTs when resetState is true, on the first call
+ *  on that stream or when the number of samples, channels or tiles changes.  Different video streams should be
+ *  processed on different CUDA streams (or with a different operator instance) to keep their states separated.
+ *  States are keyed by the stream ID the driver reports (cuStreamGetId), so a stream created after another one was
+ *  destroyed starts from a fresh state even when it gets the same handle; on drivers without stream IDs they are
+ *  keyed by handle.  A state lives as long as the operator unless released with
+ *  \ref cvcudaAdaptiveHistogramEqReleaseState, which should be called before destroying a stream the operator was
+ *  submitted to when the operator outlives it.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor.
+ *
+ * @param [in] tileGrid Number of tiles in width and height the images are split into.
+ *                      + Both must be in [1, 64] and not greater than the image width and height, respectively.
+ *
+ * @param [in] clipLimit Contrast limit as a multiple of the average bin count (tile pixels / 256), a histogram bin
+ *                       is clipped at max(clipLimit * tilePixels / 256, 1).
+ *                       + Zero or negative disables clipping.
+ *
+ * @param [in] temporalAlpha Weight of the current frame in the EMA of LUTs.
+ *                           + Must be in (0, 1], 1 disables temporal smoothing.
+ *
+ * @param [in] resetState Non-zero to discard the state kept for the stream, e.g. on a scene cut.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaAdaptiveHistogramEqSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                         NVCVTensorHandle in, NVCVTensorHandle out,
+                                                         NVCVSize2D tileGrid, float clipLimit, float temporalAlpha,
+                                                         int8_t resetState);
+
+/** Releases the state kept by the AdaptiveHistogramEq operator for the given cuda stream.
+ *  The stream is synchronized before its look-up tables are freed, the next call on it starts from a fresh state.
+ *  Nothing is done if no state is kept for the stream.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream, not yet destroyed.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_INTERNAL         Failure to synchronize the stream or free its state.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaAdaptiveHistogramEqReleaseState(NVCVOperatorHandle handle, cudaStream_t stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_ADAPTIVE_HISTOGRAM_EQ_H */
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpAdaptiveHistogramEq.hpp
+ *
+ * @brief Defines the public C++ Class for the AdaptiveHistogramEq operation.
+ * @defgroup NVCV_CPP_ALGORITHM_ADAPTIVE_HISTOGRAM_EQ Adaptive Histogram Eq
+ * @{
+ */
+
+#ifndef CVCUDA_ADAPTIVE_HISTOGRAM_EQ_HPP
+#define CVCUDA_ADAPTIVE_HISTOGRAM_EQ_HPP
+
+#include "IOperator.hpp"
+#include "OpAdaptiveHistogramEq.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class AdaptiveHistogramEq final : public IOperator
+{
+public:
+    explicit AdaptiveHistogramEq();
+
+    ~AdaptiveHistogramEq();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, const NVCVSize2D tileGrid,
+                    float clipLimit, float temporalAlpha, bool resetState = false) const;
+
+    void releaseState(cudaStream_t stream) const;
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline AdaptiveHistogramEq::AdaptiveHistogramEq()
+{
+    nvcv::detail::CheckThrow(cvcudaAdaptiveHistogramEqCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline AdaptiveHistogramEq::~AdaptiveHistogramEq()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void AdaptiveHistogramEq::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                            const NVCVSize2D tileGrid, float clipLimit, float temporalAlpha,
+                                            bool resetState) const
+{
+    nvcv::detail::CheckThrow(cvcudaAdaptiveHistogramEqSubmit(m_handle, stream, in.handle(), out.handle(), tileGrid,
+                                                             clipLimit, temporalAlpha, resetState));
+}
+
+inline void AdaptiveHistogramEq::releaseState(cudaStream_t stream) const
+{
+    nvcv::detail::CheckThrow(cvcudaAdaptiveHistogramEqReleaseState(m_handle, stream));
+}
+
+inline NVCVOperatorHandle AdaptiveHistogramEq::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_ADAPTIVE_HISTOGRAM_EQ_HPP
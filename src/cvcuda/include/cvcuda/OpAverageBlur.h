@@ -59,6 +59,8 @@ CVCUDA_PUBLIC NVCVStatus cvcudaAverageBlurCreate(NVCVOperatorHandle *handle, int
                                                  int32_t maxKernelHeight, int32_t maxVarShapeBatchSize);
 
 /** Executes the AverageBlur operation on the given cuda stream.  This operation does not wait for completion.
+ *
+ * The same operator handle can be submitted concurrently from multiple threads on different streams.
  *
  * Limitations:
  *
@@ -52,6 +52,13 @@ public:
                     const nvcv::Tensor &diameterData, const nvcv::Tensor &sigmaColorData,
                     const nvcv::Tensor &sigmaSpace, NVCVBorderType borderMode);
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, int diameter,
+                    float sigmaColor, float sigmaSpace, const NVCVBilateralGridParams &gridParams);
+
+    void operator()(cudaStream_t stream, const nvcv::ImageBatch &in, const nvcv::ImageBatch &out,
+                    const nvcv::Tensor &diameterData, const nvcv::Tensor &sigmaColorData,
+                    const nvcv::Tensor &sigmaSpaceData, const NVCVBilateralGridParams &gridParams);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -86,6 +93,23 @@ inline void BilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBa
                                                                  sigmaSpaceData.handle(), borderMode));
 }
 
+inline void BilateralFilter::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                        int diameter, float sigmaColor, float sigmaSpace,
+                                        const NVCVBilateralGridParams &gridParams)
+{
+    nvcv::detail::CheckThrow(cvcudaBilateralFilterGridSubmit(m_handle, stream, in.handle(), out.handle(), diameter,
+                                                             sigmaColor, sigmaSpace, &gridParams));
+}
+
+inline void BilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBatch &in, const nvcv::ImageBatch &out,
+                                        const nvcv::Tensor &diameterData, const nvcv::Tensor &sigmaColorData,
+                                        const nvcv::Tensor &sigmaSpaceData, const NVCVBilateralGridParams &gridParams)
+{
+    nvcv::detail::CheckThrow(cvcudaBilateralFilterGridVarShapeSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                                     diameterData.handle(), sigmaColorData.handle(),
+                                                                     sigmaSpaceData.handle(), &gridParams));
+}
+
 inline NVCVOperatorHandle BilateralFilter::handle() const noexcept
 {
     return m_handle;
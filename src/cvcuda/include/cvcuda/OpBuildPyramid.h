@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBuildPyramid.h
+ *
+ * @brief Defines types and functions to handle the BuildPyramid operation.
+ * @defgroup NVCV_C_ALGORITHM_BUILD_PYRAMID BuildPyramid
+ * @{
+ */
+
+#ifndef CVCUDA_BUILD_PYRAMID_H
+#define CVCUDA_BUILD_PYRAMID_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+#include <nvcv/TensorBatch.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the BuildPyramid operator.
+ *
+ * @param [out] handle Where the operator instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxShape Maximum shape of the first pyramid level as WxHxN, i.e. x=W y=H z=N of int3, where W=width,
+ *                      H=height and N=samples.  When the input is expanded, the first level is twice the input
+ *                      width and height.  The operator allocates an internal image of this shape.
+ *                      + W and H must be at least 2 and N must be in [1, 65535].
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or maxShape is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBuildPyramidCreate(NVCVOperatorHandle *handle, int3 maxShape);
+
+/** Executes the BuildPyramid operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  The BuildPyramid operation computes the Gaussian scale-space pyramid of the input, the same pyramid computed
+ *  internally by the SIFT operator.  The pyramid is stored in a tensor batch with one tensor per level, see
+ *  \ref NVCVPyramidInfo, which can be passed to the operators accepting a pyramid, e.g. SIFT and HQResize, so the
+ *  levels are computed once per frame instead of once per operator.
+ *
+ *  The pyramid levels must be pre-allocated by the caller: the number of levels is the number of tensors in the
+ *  batch and the number of scales is the first shape of each level minus 3.  Level i must have shape
+ *  (L=numScales+3, N, H>>i, W>>i, C=1), where WxH is the input shape (doubled if expanded) and N the number of
+ *  input samples.  The first layer of the first level is the input (potentially expanded) Gaussian filtered to
+ *  initSigma; each next layer is filtered by 2^(1/numScales) more; the first layer of each next level is the
+ *  previous level layer numScales downscaled 2x.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [LNHWC]
+ *       Channels:       [1]
+ *       Data Type:      32bit Float
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.  The first pyramid level shape must not exceed the maxShape given in the operator
+ *                constructor.
+ *
+ * @param [out] pyramid Tensor batch with the pre-allocated pyramid levels to be computed.
+ *                      + It must have at least one level and the number of scales must be in [1, 16].
+ *
+ * @param [in] initSigma Sigma of the Gaussian filter applied to the first layer of the first level, assuming the
+ *                       input has an initial blur of 0.5.  The suggested value is 1.6.
+ *                       + It must be positive.
+ *
+ * @param [in] expandInput Whether to expand (upscale 2x) the input to build the first level.
+ *
+ * @param [out] pyramidInfo Where the pyramid metadata will be written to, it can be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBuildPyramidSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                  NVCVTensorBatchHandle pyramid, float initSigma, bool expandInput,
+                                                  NVCVPyramidInfo *pyramidInfo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_BUILD_PYRAMID_H */
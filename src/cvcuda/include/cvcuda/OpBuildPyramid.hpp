@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBuildPyramid.hpp
+ *
+ * @brief Defines the public C++ Class for the BuildPyramid operation.
+ * @defgroup NVCV_CPP_ALGORITHM_BUILD_PYRAMID BuildPyramid
+ * @{
+ */
+
+#ifndef CVCUDA_BUILD_PYRAMID_HPP
+#define CVCUDA_BUILD_PYRAMID_HPP
+
+#include "IOperator.hpp"
+#include "OpBuildPyramid.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class BuildPyramid final : public IOperator
+{
+public:
+    explicit BuildPyramid(int3 maxShape);
+
+    ~BuildPyramid();
+
+    NVCVPyramidInfo operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::TensorBatch &pyramid,
+                               float initSigma, bool expandInput);
+
+    // Allocate the levels of a pyramid with first level of shape WxHxN, where x=W y=H z=N of int3
+    static nvcv::TensorBatch CreatePyramid(int3 baseShape, int numLevels, int numScales);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline BuildPyramid::BuildPyramid(int3 maxShape)
+{
+    nvcv::detail::CheckThrow(cvcudaBuildPyramidCreate(&m_handle, maxShape));
+    assert(m_handle);
+}
+
+inline BuildPyramid::~BuildPyramid()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline NVCVPyramidInfo BuildPyramid::operator()(cudaStream_t stream, const nvcv::Tensor &in,
+                                                const nvcv::TensorBatch &pyramid, float initSigma, bool expandInput)
+{
+    NVCVPyramidInfo pyramidInfo;
+    nvcv::detail::CheckThrow(cvcudaBuildPyramidSubmit(m_handle, stream, in.handle(), pyramid.handle(), initSigma,
+                                                      expandInput, &pyramidInfo));
+    return pyramidInfo;
+}
+
+inline nvcv::TensorBatch BuildPyramid::CreatePyramid(int3 baseShape, int numLevels, int numScales)
+{
+    nvcv::TensorBatch pyramid(numLevels);
+
+    for (int level = 0; level < numLevels; level++)
+    {
+        nvcv::TensorShape levelShape(
+            nvcv::TensorShape::ShapeType{numScales + 3, baseShape.z, baseShape.y >> level, baseShape.x >> level, 1},
+            nvcv::TensorLayout{"LNHWC"});
+
+        pyramid.pushBack(nvcv::Tensor(levelShape, nvcv::TYPE_F32));
+    }
+
+    return pyramid;
+}
+
+inline NVCVOperatorHandle BuildPyramid::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_BUILD_PYRAMID_HPP
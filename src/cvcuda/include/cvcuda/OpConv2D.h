@@ -52,6 +52,11 @@ extern "C"
 CVCUDA_PUBLIC NVCVStatus cvcudaConv2DCreate(NVCVOperatorHandle *handle);
 
 /** Executes the Conv2D operation on the given cuda stream.  This operation does not wait for completion.
+ *
+ * On devices with compute capability 8.0 or higher, batches whose largest kernel is at least 13 wide and 169 taps
+ * in area run on tensor cores, with each kernel row applied as a Toeplitz matrix product.  Products use split TF32
+ * operands so results match the direct path up to rounding.  The CVCUDA_CONV2D_ALGO environment variable set to
+ * "direct" or "tensorcore" when the operator is created forces either path when the device supports it.
  *
  * Limitations:
  *
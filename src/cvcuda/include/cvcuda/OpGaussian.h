@@ -60,6 +60,8 @@ CVCUDA_PUBLIC NVCVStatus cvcudaGaussianCreate(NVCVOperatorHandle *handle, int32_
                                               int32_t maxKernelHeight, int32_t maxVarShapeBatchSize);
 
 /** Executes the Gaussian operation on the given cuda stream.  This operation does not wait for completion.
+ *
+ * The same operator handle can be submitted concurrently from multiple threads on different streams.
  *
  * Limitations:
  *
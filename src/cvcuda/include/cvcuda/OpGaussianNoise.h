@@ -127,7 +127,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaGaussianNoiseCreate(NVCVOperatorHandle *handle, i
  *
  * @param [in] per_channel whether to add the same noise for all channels.
  *
- * @param [in] seed for random numbers
+ * @param [in] seed for random numbers. The noise added to a pixel only depends on the seed, the number of
+ *                  previous calls to the operator, the index of its sample in the batch and its position, so
+ *                  successive calls give new noise while a new operator with the same seed reproduces them.
  *
  * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
  * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
@@ -36,6 +36,7 @@
 #include <nvcv/Rect.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
+#include <nvcv/TensorBatch.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -399,6 +400,56 @@ CVCUDA_PUBLIC NVCVStatus cvcudaHQResizeTensorBatchSubmit(NVCVOperatorHandle hand
                                                          const NVCVInterpolationType magInterpolation, bool antialias,
                                                          const HQResizeRoisF roi);
 
+/** Executes the HQ Resize operation on a pre-built Gaussian pyramid on the given cuda stream. This operation does
+ *  not wait for completion.
+ *
+ *  The operation selects the coarsest pyramid level whose width and height are not smaller than the output ones
+ *  and resizes the first layer of that level into the output.  Downscaling by a large factor thus reads a level
+ *  that is already decimated and low-pass filtered by the pyramid, instead of the full-resolution image.  If no
+ *  level is large enough, the first level is upscaled.
+ *
+ *  Note that the first layer of each level is Gaussian filtered with the pyramid initSigma (relative to that
+ *  level), see \ref NVCVPyramidInfo.
+ *
+ *  Limitations:
+ *
+ *  Output:
+ *       Data Layout:    [NHWC]
+ *       Channels:       [1]
+ *       Data Type:      32bit Float
+ *       Samples:        Same as the pyramid levels
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] workspace The workspace with memory for intermediate results. The requirements can be acquired with
+ *                       a call to `cvcudaHQResizeGetMaxWorkspaceRequirements` with the first pyramid level shape.
+ *
+ * @param [in] pyramid Tensor batch with the Gaussian pyramid levels, see \ref NVCVPyramidInfo.
+ *
+ * @param [in] pyramidInfo Pointer to the pyramid metadata, as returned by `cvcudaBuildPyramidSubmit`.
+ *
+ * @param [out] out Output tensor.
+ *
+ * @param [in] minInterpolation The type of interpolation to be used when downsampling an extent,
+ *                              see `cvcudaHQResizeSubmit`.
+ *
+ * @param [in] magInterpolation The type of interpolation to be used when upsampling an extent,
+ *                              see `cvcudaHQResizeSubmit`.
+ *
+ * @param [in] antialias Whether to use antialiasing when downsampling from the selected level.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHQResizePyramidSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                     const NVCVWorkspace *workspace, NVCVTensorBatchHandle pyramid,
+                                                     const NVCVPyramidInfo *pyramidInfo, NVCVTensorHandle out,
+                                                     const NVCVInterpolationType minInterpolation,
+                                                     const NVCVInterpolationType magInterpolation, bool antialias);
+
 #ifdef __cplusplus
 }
 #endif
@@ -72,6 +72,11 @@ public:
                     const NVCVInterpolationType minInterpolation, const NVCVInterpolationType magInterpolation,
                     bool antialias = false, const HQResizeRoisF roi = {});
 
+    void operator()(cudaStream_t stream, const Workspace &ws, const nvcv::TensorBatch &pyramid,
+                    const NVCVPyramidInfo &pyramidInfo, const nvcv::Tensor &out,
+                    const NVCVInterpolationType minInterpolation, const NVCVInterpolationType magInterpolation,
+                    bool antialias = false);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -144,6 +149,15 @@ inline void HQResize::operator()(cudaStream_t stream, const Workspace &ws, const
                                                              minInterpolation, magInterpolation, antialias, roi));
 }
 
+inline void HQResize::operator()(cudaStream_t stream, const Workspace &ws, const nvcv::TensorBatch &pyramid,
+                                 const NVCVPyramidInfo &pyramidInfo, const nvcv::Tensor &out,
+                                 const NVCVInterpolationType minInterpolation,
+                                 const NVCVInterpolationType magInterpolation, bool antialias)
+{
+    nvcv::detail::CheckThrow(cvcudaHQResizePyramidSubmit(m_handle, stream, &ws, pyramid.handle(), &pyramidInfo,
+                                                         out.handle(), minInterpolation, magInterpolation, antialias));
+}
+
 inline NVCVOperatorHandle HQResize::handle() const noexcept
 {
     return m_handle;
@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpImageStats.h
+ *
+ * @brief Defines types and functions to handle the ImageStats operation.
+ * @defgroup NVCV_C_ALGORITHM_IMAGESTATS ImageStats
+ * @{
+ */
+
+#ifndef CVCUDA_IMAGESTATS_H
+#define CVCUDA_IMAGESTATS_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the ImageStats operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaImageStatsCreate(NVCVOperatorHandle *handle);
+
+/** Executes the ImageStats operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  The ImageStats operation computes, in a single read of the input, any subset of the following statistics per
+ *  sample and per region of interest (ROI): histogram with an arbitrary number of bins over an arbitrary value
+ *  range; minimum and maximum values with their locations; sum of values; and sum of squared values.  Which
+ *  statistics are computed is chosen by passing (or not) the corresponding output tensor, a NULL output means the
+ *  statistic is skipped.  It replaces running Histogram and MinMaxLoc (and a separate reduction for the moments)
+ *  on the same input.
+ *
+ *  The minimum and maximum locations are deterministic: the first occurrence in raster order (smallest y, then
+ *  smallest x) is reported.  Input values that are NaN are ignored by the histogram and minimum/maximum.  An ROI
+ *  that is empty (or fully masked out) reports 0 as minimum and maximum with location (-1, -1).
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.  The expected layout is [HWC] or [NHWC], where N is the number of samples, i.e.
+ *                images with height H and width W and channels C, inside the tensor.
+ *                + Number of pixels per sample (W * H) must be less than 2^32.
+ *
+ * @param [in] mask Optional mask tensor with the same shape as the input and U8 data type, pixels with zero mask
+ *                  are not accounted for in any statistic.
+ *                  + It may be NULL to use all pixels.
+ *
+ * @param [in] rois Optional tensor with regions of interest (x, y, width, height) per sample.  The expected layout
+ *                  is [NR] with 4S32 data type or [NRC] with S32 data type and C = 4, where R is the number of
+ *                  ROIs per sample.  Each ROI is clipped to the sample image.
+ *                  + It may be NULL to use the full sample image as a single ROI (R = 1).
+ *
+ * @param [in] histLow Inclusive lower bound of the histogram range.
+ *
+ * @param [in] histHigh Exclusive upper bound of the histogram range, values outside [histLow, histHigh) are not
+ *                      counted in the histogram.
+ *                      + Must be greater than histLow when histogram is not NULL.
+ *
+ * @param [out] histogram Output tensor to store histograms, the number of bins B is the size of the last dimension.
+ *                        The expected layout is [NB] (only when rois is NULL) or [NRB].
+ *                        + It must have S32 data type.
+ *                        + It may be NULL to skip computing histograms.
+ *
+ * @param [out] minMaxVal Output tensor to store minimum (at index 0) and maximum (at index 1) values.  The expected
+ *                        layout is [N2] (only when rois is NULL) or [NR2].
+ *                        + It must have F64 data type.
+ *                        + It must be provided together with minMaxLoc, or both must be NULL.
+ *
+ * @param [out] minMaxLoc Output tensor to store (x, y) locations of the minimum (at index 0) and maximum (at index
+ *                        1) values.  The expected layout is [N2] (only when rois is NULL) or [NR2].
+ *                        + It must have 2S32 data type.
+ *                        + It must be provided together with minMaxVal, or both must be NULL.
+ *
+ * @param [out] sum Output tensor to store the sum of values.  The expected layout is [N] (only when rois is NULL)
+ *                  or [NR].
+ *                  + It must have F64 data type.
+ *                  + It may be NULL to skip computing the sum.
+ *
+ * @param [out] sumSq Output tensor to store the sum of squared values.  The expected layout is [N] (only when rois
+ *                    is NULL) or [NR].
+ *                    + It must have F64 data type.
+ *                    + It may be NULL to skip computing the sum of squares.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaImageStatsSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                NVCVTensorHandle mask, NVCVTensorHandle rois, float histLow,
+                                                float histHigh, NVCVTensorHandle histogram,
+                                                NVCVTensorHandle minMaxVal, NVCVTensorHandle minMaxLoc,
+                                                NVCVTensorHandle sum, NVCVTensorHandle sumSq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_IMAGESTATS_H */
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpImageStats.hpp
+ *
+ * @brief Defines the public C++ Class for the ImageStats operation.
+ * @defgroup NVCV_CPP_ALGORITHM_IMAGESTATS ImageStats
+ * @{
+ */
+
+#ifndef CVCUDA_IMAGESTATS_HPP
+#define CVCUDA_IMAGESTATS_HPP
+
+#include "IOperator.hpp"
+#include "OpImageStats.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class ImageStats final : public IOperator
+{
+public:
+    explicit ImageStats();
+
+    ~ImageStats();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &mask, const nvcv::Tensor &rois,
+                    float histLow, float histHigh, const nvcv::Tensor &histogram, const nvcv::Tensor &minMaxVal,
+                    const nvcv::Tensor &minMaxLoc, const nvcv::Tensor &sum, const nvcv::Tensor &sumSq) const;
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline ImageStats::ImageStats()
+{
+    nvcv::detail::CheckThrow(cvcudaImageStatsCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline ImageStats::~ImageStats()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void ImageStats::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &mask,
+                                   const nvcv::Tensor &rois, float histLow, float histHigh,
+                                   const nvcv::Tensor &histogram, const nvcv::Tensor &minMaxVal,
+                                   const nvcv::Tensor &minMaxLoc, const nvcv::Tensor &sum,
+                                   const nvcv::Tensor &sumSq) const
+{
+    nvcv::detail::CheckThrow(cvcudaImageStatsSubmit(m_handle, stream, in.handle(), mask.handle(), rois.handle(),
+                                                    histLow, histHigh, histogram.handle(), minMaxVal.handle(),
+                                                    minMaxLoc.handle(), sum.handle(), sumSq.handle()));
+}
+
+inline NVCVOperatorHandle ImageStats::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_IMAGESTATS_HPP
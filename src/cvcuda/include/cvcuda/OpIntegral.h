@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpIntegral.h
+ *
+ * @brief Defines types and functions to handle the Integral operation.
+ * @defgroup NVCV_C_ALGORITHM_INTEGRAL Integral
+ * @{
+ */
+
+#ifndef CVCUDA_INTEGRAL_H
+#define CVCUDA_INTEGRAL_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the Integral operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaIntegralCreate(NVCVOperatorHandle *handle);
+
+/** Executes the Integral operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  The Integral operation computes the integral image (summed-area table) of each channel of each input sample,
+ *  and optionally the integral image of the squared values:
+ *
+ *      sum(y, x) = sum of in(j, i) for all j < y and i < x
+ *      sqsum(y, x) = sum of in(j, i)^2 for all j < y and i < x
+ *
+ *  The outputs are one row and one column larger than the input, with zeros in their first row and column, so the
+ *  sum of any rectangle of the input is obtained from 4 output values whatever its size.  This makes box filters,
+ *  local means and local variances cost the same for any window size.
+ *
+ *  Integer accumulators wrap around when the sum of a sample exceeds their range.  Sums of rectangles computed as
+ *  differences of output values, with the same integer type, are still exact as long as the rectangle sum fits.
+ *  Floating-point accumulators are not summed in raster order, results may differ from a sequential sum by
+ *  rounding.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Outputs:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       32bit Signed   | Yes, for integer inputs
+ *       64bit Signed   | Yes, for integer inputs
+ *       32bit Float    | Yes
+ *       64bit Float    | Yes
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Output = Input + 1
+ *       Height        | Output = Input + 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.  The expected layout is [HWC] or [NHWC], where N is the number of samples, i.e.
+ *                images with height H and width W and channels C, inside the tensor.
+ *
+ * @param [out] sum Output tensor with the integral image, with shape [N, H + 1, W + 1, C].
+ *                  + It may be NULL to compute only sqsum.
+ *
+ * @param [out] sqsum Output tensor with the integral image of the squared values, with shape [N, H + 1, W + 1, C].
+ *                    + It may be NULL to compute only sum.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaIntegralSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                              NVCVTensorHandle sum, NVCVTensorHandle sqsum);
+
+/** Executes the Integral operation on a batch of images of different sizes.
+ *
+ *  Each output image must be one row and one column larger than the input image at the same index.  All input
+ *  images must have the same format, and so must the images of each output.  See @ref cvcudaIntegralSubmit for
+ *  the supported formats.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input image batch.
+ *
+ * @param [out] sum Output image batch with the integral images.
+ *                  + It may be NULL to compute only sqsum.
+ *
+ * @param [out] sqsum Output image batch with the integral images of the squared values.
+ *                    + It may be NULL to compute only sum.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaIntegralVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                      NVCVImageBatchHandle in, NVCVImageBatchHandle sum,
+                                                      NVCVImageBatchHandle sqsum);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_INTEGRAL_H */
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpIntegral.hpp
+ *
+ * @brief Defines the public C++ Class for the Integral operation.
+ * @defgroup NVCV_CPP_ALGORITHM_INTEGRAL Integral
+ * @{
+ */
+
+#ifndef CVCUDA_INTEGRAL_HPP
+#define CVCUDA_INTEGRAL_HPP
+
+#include "IOperator.hpp"
+#include "OpIntegral.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Integral final : public IOperator
+{
+public:
+    explicit Integral();
+
+    ~Integral();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef sum,
+                    nvcv::OptionalTensorConstRef sqsum) const;
+
+    void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                    nvcv::OptionalImageBatchVarShapeConstRef sum, nvcv::OptionalImageBatchVarShapeConstRef sqsum) const;
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Integral::Integral()
+{
+    nvcv::detail::CheckThrow(cvcudaIntegralCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Integral::~Integral()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Integral::operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef sum,
+                                 nvcv::OptionalTensorConstRef sqsum) const
+{
+    nvcv::detail::CheckThrow(cvcudaIntegralSubmit(m_handle, stream, in.handle(), NVCV_OPTIONAL_TO_HANDLE(sum),
+                                                  NVCV_OPTIONAL_TO_HANDLE(sqsum)));
+}
+
+inline void Integral::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                                 nvcv::OptionalImageBatchVarShapeConstRef sum,
+                                 nvcv::OptionalImageBatchVarShapeConstRef sqsum) const
+{
+    nvcv::detail::CheckThrow(cvcudaIntegralVarShapeSubmit(m_handle, stream, in.handle(), NVCV_OPTIONAL_TO_HANDLE(sum),
+                                                          NVCV_OPTIONAL_TO_HANDLE(sqsum)));
+}
+
+inline NVCVOperatorHandle Integral::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_INTEGRAL_HPP
@@ -146,6 +146,79 @@ CVCUDA_PUBLIC NVCVStatus cvcudaJointBilateralFilterVarShapeSubmit(
     NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle inColor,
     NVCVImageBatchHandle out, NVCVTensorHandle diameterData, NVCVTensorHandle sigmaColorData,
     NVCVTensorHandle sigmaSpaceData, NVCVBorderType borderMode);
+
+/** Executes the JointBilateralFilter operation in bilateral grid mode on the given cuda stream. This operation does
+ *  not wait for completion.
+ *
+ *  The bilateral grid mode approximates the filter in a time that does not depend on the diameter: the input is
+ *  splatted into a grid with one cell every gridParams.spaceSampling pixels along x and y and one cell every
+ *  gridParams.colorSampling units of the range value (the sum of the channels of the inColor image), the grid is
+ *  blurred with the spatial and color Gaussians, and the output is interpolated from the blurred grid.  Pixels
+ *  outside the image do not contribute, so there is no border mode.
+ *
+ *  Measured against the exact filter on 8-bit images with edges and noise, sampling at (sigmaSpace, sigmaColor)
+ *  gives a mean absolute error below 3 levels and a maximum error below 16 levels, and sampling at half the sigmas
+ *  a mean absolute error below 1.5 levels and a maximum error below 8 levels.  The error is larger on
+ *  multi-channel images whose channels vary independently, as the grid range axis only tracks their sum.
+ *
+ *  Limitations:
+ *
+ *  Input, Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  The grid has (W / spaceSampling + 1) x (H / spaceSampling + 1) x (range / colorSampling + 2) cells per image,
+ *  where range is the number of channels times the range of the data type, and is kept in an internal per-stream
+ *  scratch buffer.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor for image.
+ *
+ * @param [in] inColor input tensor for color distance, same shape and data type as the input.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] diameter bilateral filter diameter, it bounds the spatial Gaussian as in the exact filter.
+ *
+ * @param [in] sigmaColor Gaussian exponent for color difference
+ *
+ * @param [in] sigmaSpace Gaussian exponent for position difference
+ *
+ * @param [in] gridParams Sampling of the bilateral grid, see \ref NVCVBilateralGridParams.
+ *                        + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OVERFLOW         The grid is too large for the given sampling.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaJointBilateralFilterGridSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                              NVCVTensorHandle in, NVCVTensorHandle inColor,
+                                                              NVCVTensorHandle out, int diameter, float sigmaColor,
+                                                              float sigmaSpace,
+                                                              const NVCVBilateralGridParams *gridParams);
+
+/** Var-shape variant of \ref cvcudaJointBilateralFilterGridSubmit, with per-image diameter and sigmas given as S32
+ *  and F32 tensors. The grid is sized for the largest image in the batch.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaJointBilateralFilterGridVarShapeSubmit(
+    NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle inColor,
+    NVCVImageBatchHandle out, NVCVTensorHandle diameterData, NVCVTensorHandle sigmaColorData,
+    NVCVTensorHandle sigmaSpaceData, const NVCVBilateralGridParams *gridParams);
 #ifdef __cplusplus
 }
 #endif
@@ -52,6 +52,13 @@ public:
                     const nvcv::ImageBatch &out, const nvcv::Tensor &diameterData, const nvcv::Tensor &sigmaColorData,
                     const nvcv::Tensor &sigmaSpace, NVCVBorderType borderMode);
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &inColor, const nvcv::Tensor &out,
+                    int diameter, float sigmaColor, float sigmaSpace, const NVCVBilateralGridParams &gridParams);
+
+    void operator()(cudaStream_t stream, const nvcv::ImageBatch &in, const nvcv::ImageBatch &inColor,
+                    const nvcv::ImageBatch &out, const nvcv::Tensor &diameterData, const nvcv::Tensor &sigmaColorData,
+                    const nvcv::Tensor &sigmaSpaceData, const NVCVBilateralGridParams &gridParams);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -88,6 +95,25 @@ inline void JointBilateralFilter::operator()(cudaStream_t stream, const nvcv::Im
         sigmaSpaceData.handle(), borderMode));
 }
 
+inline void JointBilateralFilter::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &inColor,
+                                             const nvcv::Tensor &out, int diameter, float sigmaColor, float sigmaSpace,
+                                             const NVCVBilateralGridParams &gridParams)
+{
+    nvcv::detail::CheckThrow(cvcudaJointBilateralFilterGridSubmit(
+        m_handle, stream, in.handle(), inColor.handle(), out.handle(), diameter, sigmaColor, sigmaSpace, &gridParams));
+}
+
+inline void JointBilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBatch &in,
+                                             const nvcv::ImageBatch &inColor, const nvcv::ImageBatch &out,
+                                             const nvcv::Tensor &diameterData, const nvcv::Tensor &sigmaColorData,
+                                             const nvcv::Tensor &sigmaSpaceData,
+                                             const NVCVBilateralGridParams &gridParams)
+{
+    nvcv::detail::CheckThrow(cvcudaJointBilateralFilterGridVarShapeSubmit(
+        m_handle, stream, in.handle(), inColor.handle(), out.handle(), diameterData.handle(), sigmaColorData.handle(),
+        sigmaSpaceData.handle(), &gridParams));
+}
+
 inline NVCVOperatorHandle JointBilateralFilter::handle() const noexcept
 {
     return m_handle;
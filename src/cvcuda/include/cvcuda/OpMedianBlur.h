@@ -56,6 +56,14 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMedianBlurCreate(NVCVOperatorHandle *handle, cons
 /** Executes the median blur operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  The same operator handle can be submitted concurrently from multiple threads on different streams.
+ *
+ *  For 8-bit and 16-bit tensors with large kernels the median is computed from a sliding histogram, whose cost
+ *  per pixel grows with the kernel width only instead of the kernel area. For 16-bit tensors the low byte
+ *  histogram is rebuilt from the whole kernel area when the high byte of the median changes from one row to the
+ *  next, so the cost per pixel grows with the kernel area in regions of steep vertical gradients. Borders are
+ *  always replicated.
+ *
  *  Limitations:
  *
  *  Input:
@@ -55,6 +55,8 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMinAreaRectCreate(NVCVOperatorHandle *handle, int
 /** Executes the MinAreaRect operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  The same operator handle can be submitted concurrently from multiple threads on different streams.
+ *
  *  Limitations:
  *
  *  Input:
@@ -55,6 +55,10 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMorphologyCreate(NVCVOperatorHandle *handle);
 /**
  * Executes the morphology operation of Dilates/Erodes on images
  *
+ * Large masks, and lines of 1 x N or N x 1 pixels, run as separable van Herk/Gil-Werman passes whose cost per pixel
+ * does not depend on the mask size.  With \ref NVCV_BORDER_CONSTANT and \ref NVCV_BORDER_REPLICATE, the iterations
+ * of Dilate/Erode are computed at once with the equivalent larger mask.
+ *
  * Limitations:
  *
  * Input:
@@ -108,7 +112,10 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMorphologyCreate(NVCVOperatorHandle *handle);
  *
  * @param [in] workspace Workspace tensor, must be the same size as the input tensor; can be null if not calling Dilate/Erode with an iteration of 1
  *
- * @param [in] morphType Type of operation to performs Erode/Dilate. \ref NVCVMorphologyType.
+ * @param [in] morphType Type of operation to perform: Erode, Dilate, Open, Close, or the composite Gradient
+ *                       (dilation minus erosion), TopHat (input minus opening) and BlackHat (closing minus input),
+ *                       each submitted as a single call.  \ref NVCVMorphologyType.
+ *                       + Gradient, TopHat and BlackHat are only supported on tensors and need a workspace.
  *
  * @param [in] maskWidth Width of the mask to use (set heigh/width to -1 for default of 3,3).
  *
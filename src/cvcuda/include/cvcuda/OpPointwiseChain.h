@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpPointwiseChain.h
+ *
+ * @brief Defines types and functions to handle the PointwiseChain operation.
+ * @defgroup NVCV_C_ALGORITHM_POINTWISE_CHAIN Pointwise Chain
+ * @{
+ */
+
+#ifndef CVCUDA_POINTWISE_CHAIN_H
+#define CVCUDA_POINTWISE_CHAIN_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the PointwiseChain operator.
+ *
+ * @param [out] handle Where the operator instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPointwiseChainCreate(NVCVOperatorHandle *handle);
+
+/** Executes the PointwiseChain operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  The PointwiseChain operation evaluates a list of pointwise steps on each pixel in a single pass, replacing chains
+ *  of full-tensor operations such as ConvertTo, Normalize, BrightnessContrast, ColorTwist, GammaContrast and Reformat.
+ *  Each input pixel is loaded into a 4-channel float working pixel (missing channels are zero), the steps are
+ *  applied in order (see \ref NVCVPointwiseStepType), and the first output channels of the working pixel are
+ *  saturate-cast to the output data type and written in the output layout, interleaved or planar.
+ *
+ *  For instance, ConvertTo(alpha, beta) is a SCALE_SHIFT step, per-channel Normalize is a SCALE_SHIFT step with
+ *  scale = 1/stddev and shift = -mean/stddev, ColorTwist is a MATRIX step, GammaContrast is a GAMMA step, and
+ *  reordering or dropping channels is a SWIZZLE step.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [HWC, NHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [HWC, NHWC, CHW, NCHW]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor.
+ *
+ * @param [in] steps Pointwise steps applied in order to each pixel, see \ref NVCVPointwiseStep.
+ *                   + Must not be NULL if numSteps is positive.
+ *
+ * @param [in] numSteps Number of steps.
+ *                      + Must be in [0, 16].
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Input and output tensors are not compatible.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPointwiseChainSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                    NVCVTensorHandle in, NVCVTensorHandle out,
+                                                    const NVCVPointwiseStep *steps, int32_t numSteps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_POINTWISE_CHAIN_H */
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpPointwiseChain.hpp
+ *
+ * @brief Defines the public C++ Class for the PointwiseChain operation.
+ * @defgroup NVCV_CPP_ALGORITHM_POINTWISE_CHAIN Pointwise Chain
+ * @{
+ */
+
+#ifndef CVCUDA_POINTWISE_CHAIN_HPP
+#define CVCUDA_POINTWISE_CHAIN_HPP
+
+#include "IOperator.hpp"
+#include "OpPointwiseChain.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+#include <vector>
+
+namespace cvcuda {
+
+class PointwiseChain final : public IOperator
+{
+public:
+    explicit PointwiseChain();
+
+    ~PointwiseChain();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                    const std::vector<NVCVPointwiseStep> &steps);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline PointwiseChain::PointwiseChain()
+{
+    nvcv::detail::CheckThrow(cvcudaPointwiseChainCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline PointwiseChain::~PointwiseChain()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void PointwiseChain::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                       const std::vector<NVCVPointwiseStep> &steps)
+{
+    nvcv::detail::CheckThrow(cvcudaPointwiseChainSubmit(m_handle, stream, in.handle(), out.handle(), steps.data(),
+                                                        static_cast<int32_t>(steps.size())));
+}
+
+inline NVCVOperatorHandle PointwiseChain::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_POINTWISE_CHAIN_HPP
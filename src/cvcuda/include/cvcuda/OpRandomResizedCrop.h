@@ -57,6 +57,8 @@ extern "C"
  * @param [in] maxBatchSize The maximum batch size that will be used by the operator.
  *                          + Positive value.
  * @param [in] seed The random seed that will be used by the operator. Pass 0 to use std::random_device.
+ *                  The crop of each sample only depends on the seed, the sample index and the number of
+ *                  previous calls to the operator.
  *                  + Positive value.
  *
  * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
@@ -136,6 +138,45 @@ CVCUDA_PUBLIC NVCVStatus cvcudaRandomResizedCropVarShapeSubmit(NVCVOperatorHandl
                                                                const NVCVInterpolationType interpolation);
 /** @} */
 
+/** Executes the random resized crop operation with user-supplied and/or exported crops.
+ *
+ *  The crop of each sample is sampled on the device, unless the crops are given in \p inCrops.  The crops used
+ *  can be written to \p outCrops, e.g. to apply the same transform to labels or bounding boxes.  Each crop is
+ *  (x, y, width, height) in input image coordinates.  The input and output limitations are the same as
+ *  \ref cvcudaRandomResizedCropSubmit.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor or image batch.
+ *
+ * @param [out] out Output tensor or image batch.
+ *
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ *
+ * @param [in] inCrops Optional crops to use instead of random ones.  The expected layout is [N] with 4S32 data type
+ *                     or [NC] with S32 data type and C = 4.  Crops are clipped to their input image.
+ *                     + It may be NULL to sample random crops.
+ *
+ * @param [out] outCrops Optional tensor receiving the crops used, with the same shape and data type as inCrops.
+ *                       + It may be NULL to not export the crops.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+/** @{ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomResizedCropWithCropsSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                                NVCVTensorHandle in, NVCVTensorHandle out,
+                                                                const NVCVInterpolationType interpolation,
+                                                                NVCVTensorHandle inCrops, NVCVTensorHandle outCrops);
+
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomResizedCropVarShapeWithCropsSubmit(
+    NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+    const NVCVInterpolationType interpolation, NVCVTensorHandle inCrops, NVCVTensorHandle outCrops);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -50,6 +50,13 @@ public:
     void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out,
                     const NVCVInterpolationType interpolation);
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                    const NVCVInterpolationType interpolation, nvcv::OptionalTensorConstRef inCrops,
+                    nvcv::OptionalTensorConstRef outCrops);
+    void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out,
+                    const NVCVInterpolationType interpolation, nvcv::OptionalTensorConstRef inCrops,
+                    nvcv::OptionalTensorConstRef outCrops);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -84,6 +91,25 @@ inline void RandomResizedCrop::operator()(cudaStream_t stream, const nvcv::Image
         cvcudaRandomResizedCropVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), interpolation));
 }
 
+inline void RandomResizedCrop::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                          const NVCVInterpolationType interpolation,
+                                          nvcv::OptionalTensorConstRef inCrops, nvcv::OptionalTensorConstRef outCrops)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomResizedCropWithCropsSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                                    interpolation, NVCV_OPTIONAL_TO_HANDLE(inCrops),
+                                                                    NVCV_OPTIONAL_TO_HANDLE(outCrops)));
+}
+
+inline void RandomResizedCrop::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                                          const nvcv::ImageBatchVarShape &out,
+                                          const NVCVInterpolationType     interpolation,
+                                          nvcv::OptionalTensorConstRef inCrops, nvcv::OptionalTensorConstRef outCrops)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomResizedCropVarShapeWithCropsSubmit(
+        m_handle, stream, in.handle(), out.handle(), interpolation, NVCV_OPTIONAL_TO_HANDLE(inCrops),
+        NVCV_OPTIONAL_TO_HANDLE(outCrops)));
+}
+
 inline NVCVOperatorHandle RandomResizedCrop::handle() const noexcept
 {
     return m_handle;
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -96,17 +96,18 @@ CVCUDA_PUBLIC NVCVStatus cvcudaRemapCreate(NVCVOperatorHandle *handle);
  *
  *  Input map:
  *       Data Layout:    [NVCV_TENSOR_NHWC, NVCV_TENSOR_HWC]
- *       Channels:       [2]
+ *       Channels:       [2, 3]
  *
  *       Data Type      | Allowed
  *       -------------- | -------------
  *       8bit  Unsigned | No
  *       8bit  Signed   | No
  *       16bit Unsigned | No
- *       16bit Signed   | No
+ *       16bit Signed   | Yes (only if Channel=3, fixed-point)
+ *       16bit Float    | Yes (only if Channel=2, normalized)
  *       32bit Unsigned | No
  *       32bit Signed   | No
- *       32bit Float    | Yes
+ *       32bit Float    | Yes (only if Channel=2)
  *       64bit Float    | No
  *
  *  Input/Output dependency
@@ -148,7 +149,13 @@ CVCUDA_PUBLIC NVCVStatus cvcudaRemapCreate(NVCVOperatorHandle *handle);
  *                 input, output and map tensors can have different width and height, but the input and output
  *                 tensors must have the same number of samples.  The number of samples of the map can be either
  *                 equal to the input or one.  In case it is one, the same map is applied to all input samples.
- *                 + Must have float2 (2F32) data type.
+ *                 Besides float2, two compact encodings reduce the map memory traffic: a fixed-point 3S16 map
+ *                 stores per element the integer {x, y} position and a fractional index (fy << 5 | fx) with 5
+ *                 fractional bits each, the classic interleaved fixed-point remap layout, and can only be used
+ *                 with \ref NVCV_REMAP_ABSOLUTE; a half-precision 2F16 map stores {x, y} as half floats and can
+ *                 only be used with normalized map value types.  See \ref cvcudaRemapMakeMapSubmit to build such
+ *                 maps once and reuse them across calls.
+ *                 + Must have float2 (2F32), fixed-point (3S16) or half2 (2F16) data type.
  *                 + Must not be NULL.
  *
  * @param [in] inInterp Interpolation type to be used when fetching values from input tensor.
@@ -208,6 +215,38 @@ CVCUDA_PUBLIC NVCVStatus cvcudaRemapVarShapeSubmit(NVCVOperatorHandle handle, cu
                                                    NVCVInterpolationType mapInterp, NVCVRemapMapValueType mapValueType,
                                                    int8_t alignCorners, NVCVBorderType border, float4 borderValue);
 
+/** Builds a remap map from a geometric model on the given cuda stream.  This operation does not wait for completion.
+ *
+ * Building the map is meant to be done once, e.g. for a fixed camera or a fixed warp, and the resulting map reused
+ * on every \ref cvcudaRemapSubmit call, replacing per-call WarpPerspective, WarpAffine or undistortion work by a
+ * single map fetch.  Each map element (x, y) is written with the absolute, denormalized input position that the
+ * model maps the output position (x, y) to, to be used with \ref NVCV_REMAP_ABSOLUTE map value type.  All map
+ * samples are written with the same map.
+ *
+ * The model may be one of:
+ * - \ref NVCV_REMAP_MODEL_PERSPECTIVE: \p matrix is a 3x3 row-major perspective transformation (an affine
+ *   transformation has last row {0, 0, 1}) mapping input to output, or output to input if \p inverseMap is true.
+ * - \ref NVCV_REMAP_MODEL_PINHOLE: \p matrix is the input camera intrinsics, \p newCamera the output camera
+ *   intrinsics and \p distortion the radial-tangential coefficients {k1, k2, p1, p2, k3}.
+ * - \ref NVCV_REMAP_MODEL_FISHEYE: same as pinhole with equidistant fisheye coefficients {k1, k2, k3, k4}.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [out] map Output map tensor.
+ *                  + Must have float2 (2F32) or fixed-point (3S16) data type.
+ *                  + Must not be NULL.
+ *
+ * @param [in] model Geometric model used to build the map.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRemapMakeMapSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle map,
+                                                  const NVCVRemapModel *model);
+
 #ifdef __cplusplus
 }
 #endif
@@ -52,6 +52,8 @@ public:
                     const nvcv::Tensor &map, NVCVInterpolationType inInterp, NVCVInterpolationType mapInterp,
                     NVCVRemapMapValueType mapValueType, bool alignCorners, NVCVBorderType border, float4 borderValue);
 
+    void makeMap(cudaStream_t stream, const nvcv::Tensor &map, const NVCVRemapModel &model);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -89,6 +91,11 @@ inline void Remap::operator()(cudaStream_t stream, const nvcv::ImageBatch &in, c
                                                        static_cast<int8_t>(alignCorners), border, borderValue));
 }
 
+inline void Remap::makeMap(cudaStream_t stream, const nvcv::Tensor &map, const NVCVRemapModel &model)
+{
+    nvcv::detail::CheckThrow(cvcudaRemapMakeMapSubmit(m_handle, stream, map.handle(), &model));
+}
+
 inline NVCVOperatorHandle Remap::handle() const noexcept
 {
     return m_handle;
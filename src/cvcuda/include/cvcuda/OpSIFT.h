@@ -33,6 +33,7 @@
 #include <cuda_runtime.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
+#include <nvcv/TensorBatch.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -186,6 +187,51 @@ CVCUDA_PUBLIC NVCVStatus cvcudaSIFTSubmit(NVCVOperatorHandle handle, cudaStream_
                                           int numOctaveLayers, float contrastThreshold, float edgeThreshold,
                                           float initSigma, NVCVSIFTFlagType flags);
 
+/** Executes the SIFT operation on a pre-built Gaussian pyramid on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  The pyramid is usually built once per frame by the BuildPyramid operator and shared with other multi-scale
+ *  operators, in which case this operation only computes the Difference of Gaussians and finds the features.
+ *  The pyramid levels are the SIFT octaves and its scales are the SIFT octave layers; calling this operation on a
+ *  pyramid built with the same numScales, initSigma and expansion as the \ref cvcudaSIFTSubmit arguments finds the
+ *  same features.
+ *
+ *  The output tensors follow the same requirements as in \ref cvcudaSIFTSubmit, where N is the number of samples
+ *  in each pyramid level.
+ *
+ * @param [in] handle Handle to the operator.
+ *
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] pyramid Tensor batch with the Gaussian pyramid levels, see \ref NVCVPyramidInfo.  The first level
+ *                     width and height must be smaller than or equal to the maxShape, the number of levels must not
+ *                     exceed the number of octaves of the maxShape and the number of scales must not exceed the
+ *                     maxOctaveLayers, both given in the operator constructor.
+ *
+ * @param [in] pyramidInfo Pointer to the pyramid metadata, as returned by \ref cvcudaBuildPyramidSubmit.
+ *
+ * @param [out] featCoords Output tensor with features coordinates, see \ref cvcudaSIFTSubmit.
+ *
+ * @param [out] featMetadata Output tensor with features metadata, see \ref cvcudaSIFTSubmit.
+ *
+ * @param [out] featDescriptors Output tensor with features descriptors, see \ref cvcudaSIFTSubmit.
+ *
+ * @param [out] numFeatures Output tensor with the number of features found, see \ref cvcudaSIFTSubmit.
+ *
+ * @param [in] contrastThreshold The contrast threshold used to remove features with low contrast.
+ *
+ * @param [in] edgeThreshold The edge threshold used to remove features that are similar to edges.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSIFTPyramidSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                 NVCVTensorBatchHandle pyramid, const NVCVPyramidInfo *pyramidInfo,
+                                                 NVCVTensorHandle featCoords, NVCVTensorHandle featMetadata,
+                                                 NVCVTensorHandle featDescriptors, NVCVTensorHandle numFeatures,
+                                                 float contrastThreshold, float edgeThreshold);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,7 @@
 #include <cuda_runtime.h>
 #include <nvcv/ImageFormat.hpp>
 #include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
 #include <nvcv/alloc/Requirements.hpp>
 
 namespace cvcuda {
@@ -48,6 +49,11 @@ public:
                     const nvcv::Tensor &numFeatures, int numOctaveLayers, float contrastThreshold, float edgeThreshold,
                     float initSigma, NVCVSIFTFlagType flags);
 
+    void operator()(cudaStream_t stream, const nvcv::TensorBatch &pyramid, const NVCVPyramidInfo &pyramidInfo,
+                    const nvcv::Tensor &featCoords, const nvcv::Tensor &featMetadata,
+                    const nvcv::Tensor &featDescriptors, const nvcv::Tensor &numFeatures, float contrastThreshold,
+                    float edgeThreshold);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -76,6 +82,17 @@ inline void SIFT::operator()(cudaStream_t stream, const nvcv::Tensor &in, const
                                               contrastThreshold, edgeThreshold, initSigma, flags));
 }
 
+inline void SIFT::operator()(cudaStream_t stream, const nvcv::TensorBatch &pyramid,
+                             const NVCVPyramidInfo &pyramidInfo, const nvcv::Tensor &featCoords,
+                             const nvcv::Tensor &featMetadata, const nvcv::Tensor &featDescriptors,
+                             const nvcv::Tensor &numFeatures, float contrastThreshold, float edgeThreshold)
+{
+    nvcv::detail::CheckThrow(cvcudaSIFTPyramidSubmit(m_handle, stream, pyramid.handle(), &pyramidInfo,
+                                                     featCoords.handle(), featMetadata.handle(),
+                                                     featDescriptors.handle(), numFeatures.handle(),
+                                                     contrastThreshold, edgeThreshold));
+}
+
 inline NVCVOperatorHandle SIFT::handle() const noexcept
 {
     return m_handle;
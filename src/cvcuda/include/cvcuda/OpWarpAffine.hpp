@@ -49,6 +49,10 @@ public:
                     const NVCVAffineTransform xform, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue);
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                    const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue);
+
     void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out,
                     const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue);
@@ -79,6 +83,14 @@ inline void WarpAffine::operator()(cudaStream_t stream, const nvcv::Tensor &in,
         cvcudaWarpAffineSubmit(m_handle, stream, in.handle(), out.handle(), xform, flags, borderMode, borderValue));
 }
 
+inline void WarpAffine::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                   const nvcv::Tensor &transMatrix, const int32_t flags,
+                                   const NVCVBorderType borderMode, const float4 borderValue)
+{
+    nvcv::detail::CheckThrow(cvcudaWarpAffineMatrixTensorSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                                transMatrix.handle(), flags, borderMode, borderValue));
+}
+
 inline void WarpAffine::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
                                    const nvcv::ImageBatchVarShape &out, const nvcv::Tensor &transMatrix,
                                    const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue)
@@ -137,6 +137,43 @@ CVCUDA_PUBLIC NVCVStatus cvcudaWarpPerspectiveVarShapeSubmit(NVCVOperatorHandle
                                                              NVCVTensorHandle transMatrix, const int32_t flags,
                                                              const NVCVBorderType borderMode, const float4 borderValue);
 
+/** Executes the WarpPerspective operation on a tensor with one 3x3 perspective transformation matrix per sample,
+ *  read from device memory. This operation does not wait for completion.
+ *
+ *  Same as \ref cvcudaWarpPerspectiveSubmit, except that the matrices are not copied from the host, so they can be
+ *  produced by a previous operation on the same stream without synchronizing, e.g. the homographies written by
+ *  FindHomography. Each matrix is inverted by the warp kernel itself, no extra launch or buffer is needed.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] transMatrix 3x3 perspective transformation matrices, float tensor of shape [N, 9] or [N, 3, 3]
+ *                         where N is the number of samples in the input.
+ *                         + Matrices are row-major, the elements of a row must be contiguous.
+ *
+ * @param [in] flags Combination of interpolation methods(NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_CUBIC)
+ *                   and the optional flag NVCV_WARP_INVERSE_MAP, that sets transMatrix as the inverse transformation.
+ *
+ * @param [in] borderMode pixel extrapolation method (NVCV_BORDER_CONSTANT, NVCV_BORDER_REPLICATE, NVCV_BORDER_REFLECT,
+ *                        NVCV_BORDER_REFLECT101 or NVCV_BORDER_WRAP).
+ *
+ * @param [in] borderValue Used to specify values for a constant border for each color chanel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWarpPerspectiveMatrixTensorSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                                 NVCVTensorHandle in, NVCVTensorHandle out,
+                                                                 NVCVTensorHandle transMatrix, const int32_t flags,
+                                                                 const NVCVBorderType borderMode,
+                                                                 const float4 borderValue);
+
 #ifdef __cplusplus
 }
 #endif
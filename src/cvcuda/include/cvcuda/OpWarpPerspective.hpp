@@ -49,6 +49,10 @@ public:
                     const NVCVPerspectiveTransform transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue);
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                    const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue);
+
     void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out,
                     const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue);
@@ -79,6 +83,15 @@ inline void WarpPerspective::operator()(cudaStream_t stream, const nvcv::Tensor
                                                          flags, borderMode, borderValue));
 }
 
+inline void WarpPerspective::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                        const nvcv::Tensor &transMatrix, const int32_t flags,
+                                        const NVCVBorderType borderMode, const float4 borderValue)
+{
+    nvcv::detail::CheckThrow(cvcudaWarpPerspectiveMatrixTensorSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                                     transMatrix.handle(), flags, borderMode,
+                                                                     borderValue));
+}
+
 inline void WarpPerspective::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
                                         const nvcv::ImageBatchVarShape &out, const nvcv::Tensor &transMatrix,
                                         const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue)
@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpYUVResizeCropNormalize.h
+ *
+ * @brief Defines functions that fuse YUV420 to RGB conversion, resize, crop, normalization and layout reformat operations to optimize pipelines.
+ * @defgroup NVCV_C_ALGORITHM__YUV_RESIZE_CROP_NORMALIZE YUV Resize Crop Normalize
+ * @{
+ */
+
+#ifndef CVCUDA__YUV_RESIZE_CROP_NORMALIZE_H
+#define CVCUDA__YUV_RESIZE_CROP_NORMALIZE_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ColorSpec.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Size.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the YUVResizeCropNormalize operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaYUVResizeCropNormalizeCreate(NVCVOperatorHandle *handle);
+
+/** Executes the fused YUVResizeCropNormalize operation on the given cuda
+ *  stream. This operation does not wait for completion.
+ *
+ *  YUVResizeCropNormalize reads YUV420 images (e.g. decoder NV12 surfaces)
+ *  and performs the following operations in order, in a single pass:
+ *
+ *    1. Converts the Y, U and V samples to RGB or BGR with the fixed-point
+ *       BT.601, BT.709 or BT.2020 matrix given by the color spec. The result
+ *       is the same as the one of the AdvCvtColor operator.
+ *
+ *    2. Resizes the converted image to the specified width and height. Only
+ *       the source pixels needed by the interpolation are converted, the full
+ *       resolution RGB image is never written to memory.
+ *
+ *    3. Crops a specified region out of the resized image.
+ *
+ *    4. Normalizes each channel: out = (v - mean[c]) / stddev[c], where c is
+ *       the output channel (i.e. after the RGB/BGR ordering is applied).
+ *
+ *    5. Writes the result into the output tensor layout and data type,
+ *       usually planar (NCHW) float or half.
+ *
+ *  The interpolation is done on the converted RGB values in floating point,
+ *  without casting them back to 8 bits.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       + Tensor Data Layout: [NVCV_TENSOR_HWC, NVCV_TENSOR_NHWC], with 1
+ *         channel and 3/2 the image height in rows (the Y plane followed by
+ *         the U and V data), as for the AdvCvtColor operator.
+ *       + ImageBatchVarShape: single plane, 1 channel 8-bit images with the
+ *         same row arrangement as the tensor input.
+ *       + Width must be even, the luma height must be even, and a multiple
+ *         of 4 for the planar (I420, YV12) formats.
+ *       + Number of samples must be at most 65535.
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       + Data Layout: [NVCV_TENSOR_NCHW, NVCV_TENSOR_CHW,
+ *                       NVCV_TENSOR_NHWC, NVCV_TENSOR_HWC]
+ *       + Channels: [3]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       16bit Float    | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency:
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | No
+ *       Height        | No
+ *
+ * @param [in] handle Handle to the operator. Must not be NULL.
+ *
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor or image batch. The images in an image batch
+ *                can be of different sizes.
+ *
+ * @param [out] out Output tensor. Its width and height give the crop size.
+ *
+ * @param [in] code Conversion code of the input format, one of
+ *                  NVCV_COLOR_YUV2RGB_NV12, NVCV_COLOR_YUV2BGR_NV12,
+ *                  NVCV_COLOR_YUV2RGB_NV21, NVCV_COLOR_YUV2BGR_NV21,
+ *                  NVCV_COLOR_YUV2RGB_I420, NVCV_COLOR_YUV2BGR_I420,
+ *                  NVCV_COLOR_YUV2RGB_YV12 and NVCV_COLOR_YUV2BGR_YV12.
+ *
+ * @param [in] spec Color spec of the YUV data, one of NVCV_COLOR_SPEC_BT601,
+ *                  NVCV_COLOR_SPEC_BT709 and NVCV_COLOR_SPEC_BT2020.
+ *
+ * @param [in] resizeDim Dimensions, {width, height}, that the images are
+ *                       resized to prior to cropping.
+ *
+ * @param [in] interpolation Interpolation method to be used. Currently, only
+ *                           NVCV_INTERP_NEAREST and NVCV_INTERP_LINEAR are
+ *                           available.
+ *
+ * @param [in] cropPos Crop position, (x, y), specifying the top-left corner of
+ *                     the crop region. The crop must fall within the resized
+ *                     image, as for the ResizeCropConvertReformat operator.
+ *
+ * @param [in] mean Per-channel value subtracted from the converted values, in
+ *                  the 0 to 255 range of the RGB values.
+ *
+ * @param [in] stddev Per-channel value the centered values are divided by.
+ *                    + Must not be 0.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is invalid or outside valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   The input or output format is not supported.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+/** @{ */
+CVCUDA_PUBLIC NVCVStatus cvcudaYUVResizeCropNormalizeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                            NVCVTensorHandle in, NVCVTensorHandle out,
+                                                            NVCVColorConversionCode code, NVCVColorSpec spec,
+                                                            NVCVSize2D resizeDim, NVCVInterpolationType interpolation,
+                                                            int2 cropPos, float3 mean, float3 stddev);
+
+CVCUDA_PUBLIC NVCVStatus cvcudaYUVResizeCropNormalizeVarShapeSubmit(
+    NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle out,
+    NVCVColorConversionCode code, NVCVColorSpec spec, NVCVSize2D resizeDim, NVCVInterpolationType interpolation,
+    int2 cropPos, float3 mean, float3 stddev);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA__YUV_RESIZE_CROP_NORMALIZE_H */
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpYUVResizeCropNormalize.hpp
+ *
+ * @brief Defines the public C++ class that fuses YUV420 to RGB conversion, resize, crop, normalization and layout reformat operations to optimize pipelines.
+ * @defgroup NVCV_CPP_ALGORITHM__YUV_RESIZE_CROP_NORMALIZE YUVResizeCropNormalize
+ * @{
+ */
+
+#ifndef CVCUDA__YUV_RESIZE_CROP_NORMALIZE_HPP
+#define CVCUDA__YUV_RESIZE_CROP_NORMALIZE_HPP
+
+#include "IOperator.hpp"
+#include "OpYUVResizeCropNormalize.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ColorSpec.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class YUVResizeCropNormalize final : public IOperator
+{
+public:
+    explicit YUVResizeCropNormalize();
+
+    ~YUVResizeCropNormalize();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, NVCVColorConversionCode code,
+                    nvcv::ColorSpec spec, const NVCVSize2D resizeDim, const NVCVInterpolationType interpolation,
+                    const int2 cropPos, const float3 mean, const float3 stddev);
+
+    void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::Tensor &out,
+                    NVCVColorConversionCode code, nvcv::ColorSpec spec, const NVCVSize2D resizeDim,
+                    const NVCVInterpolationType interpolation, const int2 cropPos, const float3 mean,
+                    const float3 stddev);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline YUVResizeCropNormalize::YUVResizeCropNormalize()
+{
+    nvcv::detail::CheckThrow(cvcudaYUVResizeCropNormalizeCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline YUVResizeCropNormalize::~YUVResizeCropNormalize()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void YUVResizeCropNormalize::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                               NVCVColorConversionCode code, nvcv::ColorSpec spec,
+                                               const NVCVSize2D resizeDim, const NVCVInterpolationType interpolation,
+                                               const int2 cropPos, const float3 mean, const float3 stddev)
+{
+    nvcv::detail::CheckThrow(cvcudaYUVResizeCropNormalizeSubmit(m_handle, stream, in.handle(), out.handle(), code, spec,
+                                                                resizeDim, interpolation, cropPos, mean, stddev));
+}
+
+inline void YUVResizeCropNormalize::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                                               const nvcv::Tensor &out, NVCVColorConversionCode code,
+                                               nvcv::ColorSpec spec, const NVCVSize2D resizeDim,
+                                               const NVCVInterpolationType interpolation, const int2 cropPos,
+                                               const float3 mean, const float3 stddev)
+{
+    nvcv::detail::CheckThrow(cvcudaYUVResizeCropNormalizeVarShapeSubmit(
+        m_handle, stream, in.handle(), out.handle(), code, spec, resizeDim, interpolation, cropPos, mean, stddev));
+}
+
+inline NVCVOperatorHandle YUVResizeCropNormalize::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA__YUV_RESIZE_CROP_NORMALIZE_HPP
@@ -52,10 +52,13 @@ typedef enum
 
 typedef enum
 {
-    NVCV_ERODE  = 0,
-    NVCV_DILATE = 1,
-    NVCV_OPEN   = 2,
-    NVCV_CLOSE  = 3,
+    NVCV_ERODE    = 0,
+    NVCV_DILATE   = 1,
+    NVCV_OPEN     = 2,
+    NVCV_CLOSE    = 3,
+    NVCV_GRADIENT = 4, //!< dilation minus erosion
+    NVCV_TOPHAT   = 5, //!< input minus its opening
+    NVCV_BLACKHAT = 6, //!< closing minus the input
 } NVCVMorphologyType;
 
 // clang-format off
@@ -373,6 +376,24 @@ typedef enum
     NVCV_REMAP_RELATIVE_NORMALIZED = 2
 } NVCVRemapMapValueType;
 
+// @brief Flag to choose the geometric model used to build a remap map
+typedef enum
+{
+    NVCV_REMAP_MODEL_PERSPECTIVE = 0, //!< 3x3 perspective (or affine) transformation matrix
+    NVCV_REMAP_MODEL_PINHOLE     = 1, //!< Pinhole camera with radial-tangential distortion k1, k2, p1, p2, k3
+    NVCV_REMAP_MODEL_FISHEYE     = 2  //!< Equidistant fisheye camera with distortion k1, k2, k3, k4
+} NVCVRemapModelType;
+
+// @brief Geometric model used to build a remap map, all matrices are 3x3 row-major
+typedef struct NVCVRemapModelRec
+{
+    NVCVRemapModelType type;
+    float              matrix[9];     //!< Perspective matrix, or input camera intrinsics for lens models
+    float              newCamera[9];  //!< Output camera intrinsics for lens models, unused for perspective
+    float              distortion[5]; //!< Lens distortion coefficients, unused for perspective
+    bool               inverseMap;    //!< Perspective matrix maps output to input instead of input to output
+} NVCVRemapModel;
+
 typedef enum
 {
     NVCV_OSD_NONE         = 0,
@@ -536,6 +557,55 @@ typedef enum
     HHMMSS        = 3
 } NVCVClockFormat;
 
+// @brief Metadata of a Gaussian scale-space pyramid stored in a tensor batch with one tensor per level
+//
+// Each level is a LNHWC F32 tensor with 1 channel, where L = numScales + 3 stacks the Gaussian-filtered layers of
+// that level, and each level has half the width and height of the previous one.  Levels keep the input value range.
+typedef struct NVCVPyramidInfoRec
+{
+    int32_t numLevels;  //!< Number of levels (octaves), equal to the number of tensors in the batch
+    int32_t numScales;  //!< Number of scales (octave layers) per level, each level stores numScales + 3 layers
+    int32_t firstLevel; //!< Index of the first level, -1 if the input was expanded 2x to build the first level
+    float   initSigma;  //!< Sigma of the Gaussian blur in the first layer of the first level
+} NVCVPyramidInfo;
+
+// @brief Type of a step of a fused pointwise chain, see \ref NVCVPointwiseStep
+typedef enum
+{
+    NVCV_POINTWISE_SCALE_SHIFT = 0, //!< x[c] = x[c] * scale[c] + shift[c]
+    NVCV_POINTWISE_CLAMP       = 1, //!< x[c] = min(max(x[c], low), high)
+    NVCV_POINTWISE_SWIZZLE     = 2, //!< x[c] = x[map[c]]
+    NVCV_POINTWISE_MATRIX      = 3, //!< x[r] = sum_k matrix[r * 4 + k] * x[k] + shift[r]
+    NVCV_POINTWISE_GAMMA       = 4  //!< x[c] = range * pow(max(x[c], 0) / range, gamma)
+} NVCVPointwiseStepType;
+
+// @brief One step of a fused pointwise chain, applied to all 4 channels of the float working pixel
+//
+// Only the fields used by the step type are read, see \ref NVCVPointwiseStepType.
+typedef struct NVCVPointwiseStepRec
+{
+    NVCVPointwiseStepType type;
+    float                 scale[4];   //!< Per-channel scale
+    float                 shift[4];   //!< Per-channel shift, also added after the matrix multiplication
+    float                 matrix[16]; //!< 4x4 row-major matrix
+    int32_t               map[4];     //!< Source channel of each channel, in [0, 3]
+    float                 low;        //!< Lower clamp bound
+    float                 high;       //!< Upper clamp bound
+    float                 gamma;      //!< Gamma exponent
+    float                 range;      //!< Value range the gamma curve is normalized to, e.g. 255 for 8-bit data
+} NVCVPointwiseStep;
+
+// @brief Sampling of the bilateral grid used by the approximate bilateral filters
+//
+// The grid has one cell every spaceSampling pixels along x and y, and one cell every colorSampling units of the
+// range value, which is the sum of the pixel channels.  Sampling at sigmaSpace and sigmaColor is a good default,
+// finer sampling lowers the error at the cost of a larger grid.
+typedef struct NVCVBilateralGridParamsRec
+{
+    float spaceSampling; //!< Grid cell size along x and y, in pixels, must be at least 1
+    float colorSampling; //!< Grid cell size along the range axis, in the units of sigmaColor, must be positive
+} NVCVBilateralGridParams;
+
 typedef void *NVCVElements;
 
 #ifdef __cplusplus
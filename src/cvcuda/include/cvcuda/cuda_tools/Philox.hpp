@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Philox.hpp
+ *
+ * @brief Defines a counter-based random number generator usable in host and device.
+ */
+
+#ifndef NVCV_CUDA_PHILOX_HPP
+#define NVCV_CUDA_PHILOX_HPP
+
+#include <cuda_runtime.h> // for __host__, __device__, uint2, uint4, etc.
+
+#include <cmath>   // for logf, sqrtf, etc.
+#include <cstdint> // for uint32_t, etc.
+
+namespace nvcv::cuda {
+
+/**
+ * @defgroup NVCV_CPP_CUDATOOLS_PHILOX Philox random numbers
+ * @{
+ */
+
+namespace detail {
+
+constexpr uint32_t kPhiloxM0 = 0xD2511F53;
+constexpr uint32_t kPhiloxM1 = 0xCD9E8D57;
+constexpr uint32_t kPhiloxW0 = 0x9E3779B9;
+constexpr uint32_t kPhiloxW1 = 0xBB67AE85;
+
+inline __host__ __device__ uint32_t MulHi(uint32_t a, uint32_t b)
+{
+#ifdef __CUDA_ARCH__
+    return __umulhi(a, b);
+#else
+    return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 32);
+#endif
+}
+
+} // namespace detail
+
+/**
+ * Philox4x32-10 block function.
+ *
+ * It maps a 128-bit counter and a 64-bit key to 128 random bits, the same way in host and device.  The result for
+ * a given counter doesn't depend on any other counter, so no state needs to be stored between draws.
+ *
+ * @param[in] ctr Counter to be mapped.
+ * @param[in] key Key selecting the random stream, usually the seed.
+ *
+ * @return Four 32-bit random words.
+ */
+inline __host__ __device__ uint4 Philox4x32(uint4 ctr, uint2 key)
+{
+#pragma unroll
+    for (int i = 0; i < 10; ++i)
+    {
+        uint32_t hi0 = detail::MulHi(detail::kPhiloxM0, ctr.x);
+        uint32_t lo0 = detail::kPhiloxM0 * ctr.x;
+        uint32_t hi1 = detail::MulHi(detail::kPhiloxM1, ctr.z);
+        uint32_t lo1 = detail::kPhiloxM1 * ctr.z;
+
+        ctr = uint4{hi1 ^ ctr.y ^ key.x, lo1, hi0 ^ ctr.w ^ key.y, lo0};
+
+        key.x += detail::kPhiloxW0;
+        key.y += detail::kPhiloxW1;
+    }
+    return ctr;
+}
+
+/**
+ * Random number engine drawing from the Philox4x32-10 stream of one element.
+ *
+ * The stream is identified by the seed, the sample index within the batch and the element index within the sample,
+ * plus an optional epoch to get fresh numbers from repeated calls.  Results are thus reproducible per element no
+ * matter the batch size, launch configuration, stream or whether the draws are done in host or device.
+ *
+ * @code
+ * Philox rng(seed, sampleIdx, y * width + x);
+ * float  n = rng.normal();
+ * @endcode
+ *
+ * Raw words and uniform numbers are bit-exact between host and device, normal numbers may differ in the last bits
+ * due to the accuracy of the transcendental functions.
+ */
+class Philox
+{
+public:
+    /**
+     * Constructs the engine for one element.
+     *
+     * @param[in] seed Seed, used as Philox key.
+     * @param[in] sample Index of the sample within the batch.
+     * @param[in] element Index of the element within the sample.
+     * @param[in] epoch Additional index, e.g. the number of previous calls of a stateful operator.
+     */
+    __host__ __device__ Philox(unsigned long long seed, uint32_t sample, uint32_t element, uint32_t epoch = 0)
+        : m_key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}
+        , m_ctr{0, element, sample, epoch}
+    {
+    }
+
+    /**
+     * Draws 32 random bits.
+     */
+    __host__ __device__ uint32_t operator()()
+    {
+        if (m_idx == 4)
+        {
+            m_block = Philox4x32(m_ctr, m_key);
+            m_ctr.x++;
+            m_idx = 0;
+        }
+
+        // Selecting instead of indexing an array keeps the block in registers
+        uint32_t word = m_idx == 0 ? m_block.x : m_idx == 1 ? m_block.y : m_idx == 2 ? m_block.z : m_block.w;
+        m_idx++;
+        return word;
+    }
+
+    /**
+     * Draws a float uniformly distributed in [0, 1).
+     */
+    __host__ __device__ float uniform()
+    {
+        return ((*this)() >> 8) * (1.f / 16777216.f);
+    }
+
+    /**
+     * Draws a double uniformly distributed in [0, 1).
+     */
+    __host__ __device__ double uniformDouble()
+    {
+        uint64_t hi = (*this)() >> 5;
+        uint64_t lo = (*this)() >> 6;
+        return ((hi << 26) | lo) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * Draws an integer uniformly distributed in [lo, hi].
+     */
+    __host__ __device__ int uniformInt(int lo, int hi)
+    {
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(hi) - lo) + 1;
+        return lo + static_cast<int>((range * (*this)()) >> 32);
+    }
+
+    /**
+     * Draws a float from the standard normal distribution, using the Box-Muller transform.
+     */
+    __host__ __device__ float normal()
+    {
+        if (m_hasNormal)
+        {
+            m_hasNormal = false;
+            return m_normal;
+        }
+
+        // u1 is in (0, 1] so that its log is finite
+        float u1 = (((*this)() >> 8) + 1) * (1.f / 16777216.f);
+        float u2 = uniform();
+
+        float r     = sqrtf(-2.f * logf(u1));
+        float theta = 6.2831853071795864f * u2;
+
+        m_normal    = r * sinf(theta);
+        m_hasNormal = true;
+        return r * cosf(theta);
+    }
+
+private:
+    uint2 m_key;
+    uint4 m_ctr;
+    uint4 m_block{};
+    int   m_idx       = 4;
+    float m_normal    = 0.f;
+    bool  m_hasNormal = false;
+};
+
+/**@}*/
+
+} // namespace nvcv::cuda
+
+#endif // NVCV_CUDA_PHILOX_HPP
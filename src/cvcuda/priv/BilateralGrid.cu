@@ -0,0 +1,541 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BilateralGrid.hpp"
+
+#include <cvcuda/cuda_tools/ImageBatchVarShapeWrap.hpp>
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/MathWrappers.hpp>
+#include <cvcuda/cuda_tools/SaturateCast.hpp>
+#include <cvcuda/cuda_tools/StaticCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <cvcuda/cuda_tools/TypeTraits.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/TensorLayout.hpp>
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <cmath>
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+namespace {
+
+// Filter parameters of one sample
+struct SampleParams
+{
+    int   radius;
+    float sigmaColor;
+    float sigmaSpace;
+};
+
+// Same defaults as the exact bilateral filter kernels
+inline __host__ __device__ SampleParams NormalizeParams(int diameter, float sigmaColor, float sigmaSpace)
+{
+    SampleParams p;
+    p.sigmaColor = sigmaColor <= 0 ? 1.f : sigmaColor;
+    p.sigmaSpace = sigmaSpace <= 0 ? 1.f : sigmaSpace;
+    p.radius     = diameter <= 0 ? static_cast<int>(roundf(p.sigmaSpace * 1.5f)) : diameter / 2;
+    p.radius     = p.radius < 1 ? 1 : p.radius;
+    return p;
+}
+
+struct UniformParams
+{
+    SampleParams params;
+
+    inline __device__ SampleParams operator[](int) const
+    {
+        return params;
+    }
+};
+
+struct TensorParams
+{
+    cuda::Tensor1DWrap<int>   diameter;
+    cuda::Tensor1DWrap<float> sigmaColor;
+    cuda::Tensor1DWrap<float> sigmaSpace;
+
+    inline __device__ SampleParams operator[](int s) const
+    {
+        return NormalizeParams(diameter[s], sigmaColor[s], sigmaSpace[s]);
+    }
+};
+
+// Gives the tensor samples the per-image size interface of the var-shape wraps
+template<typename T>
+struct TensorImages
+{
+    using ValueType = T;
+
+    cuda::Tensor3DWrap<T, int32_t> wrap;
+    int2                           size;
+
+    inline __device__ int width(int) const
+    {
+        return size.x;
+    }
+
+    inline __device__ int height(int) const
+    {
+        return size.y;
+    }
+
+    inline __device__ T &operator[](int3 c) const
+    {
+        return wrap[c];
+    }
+};
+
+// The grid of each sample has width x height x depth cells of K floats: the K - 1 weighted channel sums and the
+// weight sum, stored with the depth (range axis) innermost.  The range value of a pixel is the sum of its guide
+// channels, which matches the L1 color distance of the exact kernels when the channels vary together.
+struct GridShape
+{
+    int   width, height, depth, numSamples;
+    float spaceSampling, colorSampling;
+    float rangeLow;
+};
+
+inline __host__ __device__ int GridIndex(const GridShape &shape, int s, int x, int y, int z)
+{
+    return ((s * shape.height + y) * shape.width + x) * shape.depth + z;
+}
+
+template<typename T>
+inline __device__ float RangeValue(T v)
+{
+    float range = 0;
+#pragma unroll
+    for (int c = 0; c < cuda::NumElements<T>; ++c)
+    {
+        range += cuda::GetElement(v, c);
+    }
+    return range;
+}
+
+template<int K, class SrcImages, class GuideImages>
+__global__ void SplatKernel(SrcImages src, GuideImages guide, float *grid, GridShape shape)
+{
+    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+    if (coord.x >= src.width(coord.z) || coord.y >= src.height(coord.z))
+    {
+        return;
+    }
+
+    // Nearest cell in space, linear interpolation along the range axis
+    int   gx = static_cast<int>(floorf(coord.x / shape.spaceSampling + .5f));
+    int   gy = static_cast<int>(floorf(coord.y / shape.spaceSampling + .5f));
+    float gz = (RangeValue(guide[coord]) - shape.rangeLow) / shape.colorSampling;
+    int   z0 = cuda::clamp(static_cast<int>(floorf(gz)), 0, shape.depth - 2);
+    float f  = cuda::clamp(gz - z0, 0.f, 1.f);
+
+    auto value = cuda::StaticCast<float>(src[coord]);
+
+    float *cell = grid + GridIndex(shape, coord.z, gx, gy, z0) * K;
+#pragma unroll
+    for (int k = 0; k < K; ++k)
+    {
+        float v = k < K - 1 ? cuda::GetElement(value, k) : 1.f;
+        atomicAdd(cell + k, (1 - f) * v);
+        atomicAdd(cell + K + k, f * v);
+    }
+}
+
+// Gaussian blur of the grid along one axis: 0 and 1 for x and y with the spatial sigma truncated at the filter
+// radius, 2 for the range axis with the color sigma truncated at 3 sigmas
+template<int K, class Params>
+__global__ void BlurKernel(const float *src, float *dst, GridShape shape, Params params, int axis)
+{
+    int cellsPerSample = shape.width * shape.height * shape.depth;
+    int cell           = blockIdx.x * blockDim.x + threadIdx.x;
+    int s              = blockIdx.y;
+    if (cell >= cellsPerSample)
+    {
+        return;
+    }
+
+    int z = cell % shape.depth;
+    int x = (cell / shape.depth) % shape.width;
+    int y = cell / (shape.depth * shape.width);
+
+    SampleParams p = params[s];
+
+    float sampling, sigma;
+    int   radius, pos, extent, stride;
+    if (axis == 2)
+    {
+        sampling = shape.colorSampling;
+        sigma    = p.sigmaColor;
+        radius   = static_cast<int>(ceilf(3 * p.sigmaColor / shape.colorSampling));
+        pos      = z;
+        extent   = shape.depth;
+        stride   = 1;
+    }
+    else
+    {
+        sampling = shape.spaceSampling;
+        sigma    = p.sigmaSpace;
+        radius   = static_cast<int>(ceilf(p.radius / shape.spaceSampling));
+        pos      = axis == 0 ? x : y;
+        extent   = axis == 0 ? shape.width : shape.height;
+        stride   = axis == 0 ? shape.depth : shape.depth * shape.width;
+    }
+
+    float coef = -(sampling * sampling) / (2 * sigma * sigma);
+
+    const float *center = src + (s * cellsPerSample + cell) * K;
+
+    float acc[K] = {};
+    for (int j = max(-radius, -pos); j <= min(radius, extent - 1 - pos); ++j)
+    {
+        float        w   = expf(coef * j * j);
+        const float *tap = center + j * stride * K;
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            acc[k] += w * tap[k];
+        }
+    }
+
+    float *out = dst + (s * cellsPerSample + cell) * K;
+#pragma unroll
+    for (int k = 0; k < K; ++k)
+    {
+        out[k] = acc[k];
+    }
+}
+
+template<int K, class SrcImages, class GuideImages, class DstImages>
+__global__ void SliceKernel(SrcImages src, GuideImages guide, DstImages dst, const float *grid, GridShape shape)
+{
+    using T     = typename DstImages::ValueType;
+    using WorkT = cuda::ConvertBaseTypeTo<float, T>;
+
+    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+    if (coord.x >= dst.width(coord.z) || coord.y >= dst.height(coord.z))
+    {
+        return;
+    }
+
+    float fx = coord.x / shape.spaceSampling;
+    float fy = coord.y / shape.spaceSampling;
+    float fz = cuda::clamp((RangeValue(guide[coord]) - shape.rangeLow) / shape.colorSampling, 0.f,
+                           static_cast<float>(shape.depth - 1));
+
+    int x0 = static_cast<int>(fx), y0 = static_cast<int>(fy), z0 = static_cast<int>(fz);
+    int x1 = min(x0 + 1, shape.width - 1), y1 = min(y0 + 1, shape.height - 1), z1 = min(z0 + 1, shape.depth - 1);
+
+    float ax = fx - x0, ay = fy - y0, az = fz - z0;
+
+    float acc[K] = {};
+#pragma unroll
+    for (int i = 0; i < 8; ++i)
+    {
+        float w = ((i & 1) ? ax : 1 - ax) * ((i & 2) ? ay : 1 - ay) * ((i & 4) ? az : 1 - az);
+
+        const float *cell
+            = grid + GridIndex(shape, coord.z, (i & 1) ? x1 : x0, (i & 2) ? y1 : y0, (i & 4) ? z1 : z0) * K;
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            acc[k] += w * cell[k];
+        }
+    }
+
+    if (acc[K - 1] > 0)
+    {
+        WorkT result;
+#pragma unroll
+        for (int k = 0; k < K - 1; ++k)
+        {
+            cuda::GetElement(result, k) = acc[k] / acc[K - 1];
+        }
+        dst[coord] = cuda::SaturateCast<T>(result);
+    }
+    else
+    {
+        dst[coord] = src[coord];
+    }
+}
+
+inline void CheckGridParams(const NVCVBilateralGridParams &gridParams)
+{
+    if (!(gridParams.spaceSampling >= 1))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Bilateral grid space sampling must be at least 1 pixel, got %f",
+                              gridParams.spaceSampling);
+    }
+    if (!(gridParams.colorSampling > 0))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Bilateral grid color sampling must be positive, got %f", gridParams.colorSampling);
+    }
+}
+
+inline bool IsGridDataType(nvcv::DataType dtype)
+{
+    return dtype == nvcv::TYPE_U8 || dtype == nvcv::TYPE_U16 || dtype == nvcv::TYPE_S16;
+}
+
+template<typename T>
+GridShape MakeGridShape(int2 maxSize, int numSamples, const NVCVBilateralGridParams &gridParams)
+{
+    using BT = cuda::BaseType<T>;
+
+    constexpr int numChannels = cuda::NumElements<T>;
+
+    GridShape shape;
+    shape.spaceSampling = gridParams.spaceSampling;
+    shape.colorSampling = gridParams.colorSampling;
+    shape.rangeLow      = numChannels * static_cast<float>(cuda::TypeTraits<BT>::min);
+    shape.numSamples    = numSamples;
+
+    float  rangeHigh = numChannels * static_cast<float>(cuda::TypeTraits<BT>::max);
+    double width     = std::floor((maxSize.x - 1) / shape.spaceSampling + .5f) + 1;
+    double height    = std::floor((maxSize.y - 1) / shape.spaceSampling + .5f) + 1;
+    double depth     = std::floor((rangeHigh - shape.rangeLow) / shape.colorSampling) + 2;
+
+    if (width * height * depth * numSamples * (numChannels + 1) > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW,
+                              "Bilateral grid is too large, increase the space or color sampling");
+    }
+
+    shape.width  = static_cast<int>(width);
+    shape.height = static_cast<int>(height);
+    shape.depth  = static_cast<int>(depth);
+    return shape;
+}
+
+template<int K, class SrcImages, class GuideImages, class DstImages, class Params>
+void RunGrid(cudaStream_t stream, util::PerStreamScratch &scratch, const SrcImages &src, const GuideImages &guide,
+             const DstImages &dst, const Params &params, const GridShape &shape, int2 maxSize)
+{
+    int    cellsPerSample = shape.width * shape.height * shape.depth;
+    size_t gridSize       = static_cast<size_t>(cellsPerSample) * shape.numSamples * K;
+
+    // Two grids to ping-pong between the blur passes, the lease is held until the slice is submitted
+    auto   lease = scratch.acquire(2 * gridSize * sizeof(float), stream);
+    float *gridA = lease.data<float>();
+    float *gridB = gridA + gridSize;
+
+    NVCV_CHECK_THROW(cudaMemsetAsync(gridA, 0, gridSize * sizeof(float), stream));
+
+    dim3 block(32, 8);
+    dim3 grid(util::DivUp(maxSize.x, block.x), util::DivUp(maxSize.y, block.y), shape.numSamples);
+
+    SplatKernel<K><<<grid, block, 0, stream>>>(src, guide, gridA, shape);
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    dim3 blurBlock(256);
+    dim3 blurGrid(util::DivUp(cellsPerSample, blurBlock.x), shape.numSamples);
+
+    BlurKernel<K><<<blurGrid, blurBlock, 0, stream>>>(gridA, gridB, shape, params, 0);
+    BlurKernel<K><<<blurGrid, blurBlock, 0, stream>>>(gridB, gridA, shape, params, 1);
+    BlurKernel<K><<<blurGrid, blurBlock, 0, stream>>>(gridA, gridB, shape, params, 2);
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    SliceKernel<K><<<grid, block, 0, stream>>>(src, guide, dst, gridB, shape);
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+template<typename T>
+void RunTensor(cudaStream_t stream, util::PerStreamScratch &scratch, const nvcv::TensorDataStridedCuda &in,
+               const nvcv::TensorDataStridedCuda &guide, const nvcv::TensorDataStridedCuda &out, int2 size,
+               int numSamples, const SampleParams &params, const NVCVBilateralGridParams &gridParams)
+{
+    TensorImages<const T> src{cuda::CreateTensorWrapNHW<const T, int32_t>(in), size};
+    TensorImages<const T> guideImages{cuda::CreateTensorWrapNHW<const T, int32_t>(guide), size};
+    TensorImages<T>       dst{cuda::CreateTensorWrapNHW<T, int32_t>(out), size};
+
+    GridShape shape = MakeGridShape<T>(size, numSamples, gridParams);
+
+    RunGrid<cuda::NumElements<T> + 1>(stream, scratch, src, guideImages, dst, UniformParams{params}, shape, size);
+}
+
+template<typename T>
+void RunVarShape(cudaStream_t stream, util::PerStreamScratch &scratch,
+                 const nvcv::ImageBatchVarShapeDataStridedCuda &in,
+                 const nvcv::ImageBatchVarShapeDataStridedCuda &guide,
+                 const nvcv::ImageBatchVarShapeDataStridedCuda &out, const TensorParams &params,
+                 const NVCVBilateralGridParams &gridParams)
+{
+    cuda::ImageBatchVarShapeWrap<const T> src(in);
+    cuda::ImageBatchVarShapeWrap<const T> guideImages(guide);
+    cuda::ImageBatchVarShapeWrap<T>       dst(out);
+
+    int2 maxSize{in.maxSize().w, in.maxSize().h};
+
+    GridShape shape = MakeGridShape<T>(maxSize, in.numImages(), gridParams);
+
+    RunGrid<cuda::NumElements<T> + 1>(stream, scratch, src, guideImages, dst, params, shape, maxSize);
+}
+
+inline int TypeIndex(nvcv::DataType dtype)
+{
+    return dtype == nvcv::TYPE_U8 ? 0 : (dtype == nvcv::TYPE_U16 ? 1 : 2);
+}
+
+} // namespace
+
+namespace cvcuda::priv {
+
+void BilateralGridFilter(cudaStream_t stream, nvcv::util::PerStreamScratch &scratch,
+                         const nvcv::TensorDataStridedCuda &in, const nvcv::TensorDataStridedCuda &guide,
+                         const nvcv::TensorDataStridedCuda &out, int diameter, float sigmaColor, float sigmaSpace,
+                         const NVCVBilateralGridParams &gridParams)
+{
+    CheckGridParams(gridParams);
+
+    for (const nvcv::TensorDataStridedCuda *data : {&in, &guide, &out})
+    {
+        if (!(data->layout() == nvcv::TENSOR_NHWC || data->layout() == nvcv::TENSOR_HWC))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Input, guide and output must have NHWC or HWC layout");
+        }
+        if (data->dtype() != in.dtype())
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Input, guide and output must have the same data type");
+        }
+    }
+
+    if (!IsGridDataType(in.dtype()))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Bilateral grid supports only U8, U16 and S16 data types");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(in);
+    NVCV_ASSERT(inAccess);
+
+    int2 size{inAccess->numCols(), inAccess->numRows()};
+    int  numSamples  = inAccess->numSamples();
+    int  numChannels = inAccess->numChannels();
+
+    for (const nvcv::TensorDataStridedCuda *data : {&in, &guide, &out})
+    {
+        auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+        NVCV_ASSERT(access);
+
+        if (access->numCols() != size.x || access->numRows() != size.y || access->numSamples() != numSamples
+            || access->numChannels() != numChannels)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Input, guide and output must have the same shape");
+        }
+        if (access->sampleStride() * numSamples > cuda::TypeTraits<int32_t>::max)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Input or output size exceeds %d. Tensor is too large.",
+                                  cuda::TypeTraits<int32_t>::max);
+        }
+    }
+
+    if (numChannels < 1 || numChannels > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Number of channels must be between 1 and 4");
+    }
+
+    typedef void (*run_t)(cudaStream_t stream, util::PerStreamScratch &scratch, const nvcv::TensorDataStridedCuda &in,
+                          const nvcv::TensorDataStridedCuda &guide, const nvcv::TensorDataStridedCuda &out, int2 size,
+                          int numSamples, const SampleParams &params, const NVCVBilateralGridParams &gridParams);
+
+    // clang-format off
+    static const run_t funcs[3][4] = {
+        { RunTensor<uint8_t>,  RunTensor<uchar2>,  RunTensor<uchar3>,  RunTensor<uchar4>},
+        {RunTensor<uint16_t>, RunTensor<ushort2>, RunTensor<ushort3>, RunTensor<ushort4>},
+        { RunTensor<int16_t>,  RunTensor<short2>,  RunTensor<short3>,  RunTensor<short4>},
+    };
+    // clang-format on
+
+    funcs[TypeIndex(in.dtype())][numChannels - 1](stream, scratch, in, guide, out, size, numSamples,
+                                                  NormalizeParams(diameter, sigmaColor, sigmaSpace), gridParams);
+}
+
+void BilateralGridFilter(cudaStream_t stream, nvcv::util::PerStreamScratch &scratch,
+                         const nvcv::ImageBatchVarShapeDataStridedCuda &in,
+                         const nvcv::ImageBatchVarShapeDataStridedCuda &guide,
+                         const nvcv::ImageBatchVarShapeDataStridedCuda &out, const nvcv::TensorDataStridedCuda &diameter,
+                         const nvcv::TensorDataStridedCuda &sigmaColor, const nvcv::TensorDataStridedCuda &sigmaSpace,
+                         const NVCVBilateralGridParams &gridParams)
+{
+    CheckGridParams(gridParams);
+
+    nvcv::ImageFormat format = in.uniqueFormat();
+    if (!format || format != guide.uniqueFormat() || format != out.uniqueFormat())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input, guide and output images must all have the same format");
+    }
+
+    if (in.numImages() != guide.numImages() || in.numImages() != out.numImages())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input, guide and output must have the same number of images");
+    }
+
+    int numChannels = format.numChannels();
+    if (format.numPlanes() != 1 || numChannels < 1 || numChannels > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Images must have a single plane with 1 to 4 interleaved channels");
+    }
+
+    nvcv::DataType dtype = format.planeDataType(0).channelType(0);
+    if (!IsGridDataType(dtype))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Bilateral grid supports only U8, U16 and S16 data types");
+    }
+
+    if (diameter.dtype() != nvcv::TYPE_S32 || sigmaColor.dtype() != nvcv::TYPE_F32
+        || sigmaSpace.dtype() != nvcv::TYPE_F32)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Diameter must be S32 and sigmaColor and sigmaSpace must be F32 tensors");
+    }
+
+    TensorParams params{cuda::Tensor1DWrap<int>(diameter), cuda::Tensor1DWrap<float>(sigmaColor),
+                        cuda::Tensor1DWrap<float>(sigmaSpace)};
+
+    typedef void (*run_t)(cudaStream_t stream, util::PerStreamScratch &scratch,
+                          const nvcv::ImageBatchVarShapeDataStridedCuda &in,
+                          const nvcv::ImageBatchVarShapeDataStridedCuda &guide,
+                          const nvcv::ImageBatchVarShapeDataStridedCuda &out, const TensorParams &params,
+                          const NVCVBilateralGridParams &gridParams);
+
+    // clang-format off
+    static const run_t funcs[3][4] = {
+        { RunVarShape<uint8_t>,  RunVarShape<uchar2>,  RunVarShape<uchar3>,  RunVarShape<uchar4>},
+        {RunVarShape<uint16_t>, RunVarShape<ushort2>, RunVarShape<ushort3>, RunVarShape<ushort4>},
+        { RunVarShape<int16_t>,  RunVarShape<short2>,  RunVarShape<short3>,  RunVarShape<short4>},
+    };
+    // clang-format on
+
+    funcs[TypeIndex(dtype)][numChannels - 1](stream, scratch, in, guide, out, params, gridParams);
+}
+
+} // namespace cvcuda::priv
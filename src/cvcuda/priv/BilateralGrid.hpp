@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @file BilateralGrid.hpp
+ *
+ * @brief Bilateral grid approximation shared by the BilateralFilter and JointBilateralFilter operators.
+ */
+
+#ifndef CVCUDA_PRIV_BILATERAL_GRID_HPP
+#define CVCUDA_PRIV_BILATERAL_GRID_HPP
+
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h>
+#include <cvcuda/util/PerStreamScratch.hpp>
+#include <nvcv/ImageBatchData.hpp>
+#include <nvcv/TensorData.hpp>
+
+namespace cvcuda::priv {
+
+/** Approximates the joint bilateral filter of @p in, with range weights taken from @p guide, using a bilateral grid.
+ *
+ * The input is splatted into a grid subsampled by gridParams.spaceSampling along x and y and by
+ * gridParams.colorSampling along the range axis, the grid is blurred with the spatial and range Gaussians and the
+ * output is sliced from it at each pixel position and guide value.  The bilateral filter passes @p in as its own
+ * guide.  The grid memory comes from @p scratch.
+ */
+void BilateralGridFilter(cudaStream_t stream, nvcv::util::PerStreamScratch &scratch,
+                         const nvcv::TensorDataStridedCuda &in, const nvcv::TensorDataStridedCuda &guide,
+                         const nvcv::TensorDataStridedCuda &out, int diameter, float sigmaColor, float sigmaSpace,
+                         const NVCVBilateralGridParams &gridParams);
+
+/** Var-shape variant of the bilateral grid filter, with per-image diameter and sigmas read on the device. */
+void BilateralGridFilter(cudaStream_t stream, nvcv::util::PerStreamScratch &scratch,
+                         const nvcv::ImageBatchVarShapeDataStridedCuda &in,
+                         const nvcv::ImageBatchVarShapeDataStridedCuda &guide,
+                         const nvcv::ImageBatchVarShapeDataStridedCuda &out, const nvcv::TensorDataStridedCuda &diameter,
+                         const nvcv::TensorDataStridedCuda &sigmaColor, const nvcv::TensorDataStridedCuda &sigmaSpace,
+                         const NVCVBilateralGridParams &gridParams);
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_BILATERAL_GRID_HPP
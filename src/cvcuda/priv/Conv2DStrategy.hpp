@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv2DStrategy.hpp
+ *
+ * @brief Host side choice between the direct and the tensor core implementations of Conv2D.
+ */
+
+#ifndef CVCUDA_PRIV_CONV2D_STRATEGY_HPP
+#define CVCUDA_PRIV_CONV2D_STRATEGY_HPP
+
+#include <nvcv/Size.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+namespace cvcuda::priv::conv2d {
+
+enum class Algo
+{
+    AUTO,
+    DIRECT,
+    TENSOR_CORE
+};
+
+// Output tile of one thread block in the tensor core path, each warp computes 16x16 outputs of a column of warps
+constexpr int kTileRows = 64;
+constexpr int kTileCols = 16;
+constexpr int kNumWarps = kTileRows / 16;
+
+// TF32 mma is available from compute capability 8.0 on
+constexpr int kMinComputeMajor = 8;
+
+// Each kernel row is applied as a Toeplitz matrix with kTileCols + kernelWidth - 1 rows, narrow kernels waste most
+// of the tensor core work on its zeros and are faster on the direct path
+constexpr int kMinKernelWidth = 13;
+constexpr int kMinKernelArea  = 169;
+
+constexpr size_t kMaxSharedMemBytes = 48 * 1024;
+
+// Input columns read by a tile, padded to the mma k-step of 8
+constexpr int TileInputCols(int kernelWidth)
+{
+    return (kTileCols + kernelWidth - 1 + 7) / 8 * 8;
+}
+
+constexpr int TileInputRows(int kernelHeight)
+{
+    return kTileRows + kernelHeight - 1;
+}
+
+// Row stride of the input tile in shared memory, a multiple of 8 floats for the 256-bit fragment alignment that
+// avoids being a multiple of 32 to spread fragment rows over the banks
+constexpr int TileStride(int kernelWidth)
+{
+    return TileInputCols(kernelWidth) % 32 == 0 ? TileInputCols(kernelWidth) + 8 : TileInputCols(kernelWidth);
+}
+
+// Inputs that are not exact in TF32 (anything wider than 8 bits) keep a high and a low part in the tile
+inline size_t SharedMemBytes(nvcv::Size2D maxKernelSize, bool splitInput)
+{
+    size_t tile = static_cast<size_t>(TileInputRows(maxKernelSize.h)) * TileStride(maxKernelSize.w);
+    return sizeof(float) * ((splitInput ? 2 : 1) * tile + kNumWarps * 16 * 16);
+}
+
+// Parses the CVCUDA_CONV2D_ALGO override, "direct" or "tensorcore", anything else keeps the heuristic
+inline Algo ParseAlgo(const char *value)
+{
+    if (value != nullptr && std::strcmp(value, "direct") == 0)
+    {
+        return Algo::DIRECT;
+    }
+    if (value != nullptr && std::strcmp(value, "tensorcore") == 0)
+    {
+        return Algo::TENSOR_CORE;
+    }
+    return Algo::AUTO;
+}
+
+/**
+ * Selects the Conv2D implementation for a batch.
+ *
+ * @param maxKernelSize   Largest kernel width and height in the batch.
+ * @param elementSize     Size in bytes of one channel of the input.
+ * @param computeMajor    Compute capability major version of the device.
+ * @param request         AUTO to use the heuristic, otherwise the algorithm to force when the device and the kernel
+ *                        size allow it.
+ */
+inline Algo Select(nvcv::Size2D maxKernelSize, int elementSize, int computeMajor, Algo request = Algo::AUTO)
+{
+    bool supported = computeMajor >= kMinComputeMajor
+                  && SharedMemBytes(maxKernelSize, elementSize != 1) <= kMaxSharedMemBytes;
+
+    if (request == Algo::DIRECT || !supported)
+    {
+        return Algo::DIRECT;
+    }
+    if (request == Algo::TENSOR_CORE)
+    {
+        return Algo::TENSOR_CORE;
+    }
+
+    bool large = maxKernelSize.w >= kMinKernelWidth && maxKernelSize.w * maxKernelSize.h >= kMinKernelArea;
+
+    return large ? Algo::TENSOR_CORE : Algo::DIRECT;
+}
+
+} // namespace cvcuda::priv::conv2d
+
+#endif // CVCUDA_PRIV_CONV2D_STRATEGY_HPP
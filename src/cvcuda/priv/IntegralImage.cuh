@@ -0,0 +1,243 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file IntegralImage.cuh
+ *
+ * @brief Integral image kernels shared by the Integral operator and the box filters built on top of it.
+ */
+
+#ifndef CVCUDA_PRIV_INTEGRAL_IMAGE_CUH
+#define CVCUDA_PRIV_INTEGRAL_IMAGE_CUH
+
+#include <cuda_runtime.h>
+#include <cvcuda/cuda_tools/ImageBatchVarShapeWrap.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <type_traits>
+
+namespace cvcuda::priv::integral {
+
+// Rows scanned by a block of the row pass, one warp per row
+constexpr int kRowsPerBlock = 8;
+
+// Columns of a block of the column pass, each column is split in kRowSegments segments scanned by separate threads
+constexpr int kColsPerBlock = 32;
+constexpr int kRowSegments  = 8;
+
+// Integer sums are accumulated unsigned so that they wrap around instead of overflowing: the sum of a rectangle
+// computed as a difference of integral values stays exact as long as the rectangle sum itself fits
+template<typename T>
+using AccumType = std::conditional_t<std::is_integral_v<T>, std::make_unsigned_t<T>, T>;
+
+// Largest window side whose sum of U8 values, plus half its area for rounding the mean, fits in 32 bits
+constexpr int kMaxBoxSizeU8Sum32 = 4099;
+
+// Size of a sample, uniform for tensors and read from the image for var-shape batches
+
+template<class Wrap>
+__device__ inline int2 SampleSize(const Wrap &, int2 size, int)
+{
+    return size;
+}
+
+template<typename T>
+__device__ inline int2 SampleSize(const nvcv::cuda::ImageBatchVarShapeWrapNHWC<T> &wrap, int2, int sample)
+{
+    return int2{wrap.width(sample), wrap.height(sample)};
+}
+
+// Writes the prefix sums along each row of src (of its squares when Squared) to rows and columns 1 and above of dst,
+// and zeros to the first row and column of dst.  Each warp scans one row in chunks of 32 pixels with shuffles.
+template<bool Squared, typename A, class SrcWrap, class DstWrap>
+__global__ void IntegralRows(SrcWrap src, DstWrap dst, int2 maxSize, int numChannels)
+{
+    int  sample = blockIdx.z;
+    int2 size   = SampleSize(src, maxSize, sample);
+    int  y      = blockIdx.y * kRowsPerBlock + threadIdx.y;
+    int  lane   = threadIdx.x;
+
+    if (y > size.y)
+    {
+        return;
+    }
+
+    for (int c = 0; c < numChannels; ++c)
+    {
+        if (lane == 0)
+        {
+            *dst.ptr(sample, y, 0, c) = A{0};
+        }
+
+        A carry = 0;
+        for (int x0 = 0; x0 < size.x; x0 += 32)
+        {
+            int x = x0 + lane;
+            A   v = 0;
+            if (y > 0 && x < size.x)
+            {
+                v = static_cast<A>(*src.ptr(sample, y - 1, x, c));
+                if constexpr (Squared)
+                {
+                    v *= v;
+                }
+            }
+
+#pragma unroll
+            for (int d = 1; d < 32; d *= 2)
+            {
+                A n = __shfl_up_sync(~0u, v, d);
+                if (lane >= d)
+                {
+                    v += n;
+                }
+            }
+            v += carry;
+
+            if (x < size.x)
+            {
+                *dst.ptr(sample, y, x + 1, c) = v;
+            }
+            carry = __shfl_sync(~0u, v, 31);
+        }
+    }
+}
+
+// Adds up the rows of dst in place after the row pass.  Each thread sums a segment of a column, the segment totals
+// are chained through shared memory and each thread then rewrites its segment with the running sum.
+template<typename A, class SrcWrap, class DstWrap>
+__global__ void IntegralCols(SrcWrap src, DstWrap dst, int2 maxSize, int numChannels)
+{
+    __shared__ A totals[kRowSegments][kColsPerBlock];
+
+    int  sample  = blockIdx.z;
+    int2 size    = SampleSize(src, maxSize, sample);
+    int  numCols = size.x * numChannels;
+
+    if (static_cast<int>(blockIdx.x) * kColsPerBlock >= numCols)
+    {
+        return;
+    }
+
+    int  col    = blockIdx.x * kColsPerBlock + threadIdx.x;
+    int  x      = col / numChannels + 1;
+    int  c      = col % numChannels;
+    bool active = col < numCols;
+
+    int segment = nvcv::util::DivUp(size.y, kRowSegments);
+    int y0      = 1 + threadIdx.y * segment;
+    int y1      = min(size.y + 1, y0 + segment);
+
+    A sum = 0;
+    for (int y = y0; active && y < y1; ++y)
+    {
+        sum += *dst.ptr(sample, y, x, c);
+    }
+    totals[threadIdx.y][threadIdx.x] = sum;
+
+    __syncthreads();
+
+    if (!active)
+    {
+        return;
+    }
+
+    A carry = 0;
+    for (int s = 0; s < static_cast<int>(threadIdx.y); ++s)
+    {
+        carry += totals[s][threadIdx.x];
+    }
+    for (int y = y0; y < y1; ++y)
+    {
+        A *p = dst.ptr(sample, y, x, c);
+        carry += *p;
+        *p = carry;
+    }
+}
+
+/**
+ * Computes the integral image of each sample of @p src into @p dst, which is one row and one column larger.
+ *
+ * @tparam Squared  Whether to sum the squares of the source values.
+ * @tparam A        Accumulator type, the type of the @p dst values, see AccumType.
+ *
+ * @param maxSize      Size of the samples, or of the largest sample of a var-shape batch.
+ * @param numChannels  Number of interleaved channels, each is integrated separately.
+ */
+template<bool Squared, typename A, class SrcWrap, class DstWrap>
+inline void Integrate(cudaStream_t stream, const SrcWrap &src, const DstWrap &dst, int2 maxSize, int numChannels,
+                      int numSamples)
+{
+    dim3 rowBlock(32, kRowsPerBlock);
+    dim3 rowGrid(1, nvcv::util::DivUp(maxSize.y + 1, kRowsPerBlock), numSamples);
+
+    IntegralRows<Squared, A><<<rowGrid, rowBlock, 0, stream>>>(src, dst, maxSize, numChannels);
+
+    dim3 colBlock(kColsPerBlock, kRowSegments);
+    dim3 colGrid(nvcv::util::DivUp(maxSize.x * numChannels, kColsPerBlock), 1, numSamples);
+
+    IntegralCols<A><<<colGrid, colBlock, 0, stream>>>(src, dst, maxSize, numChannels);
+}
+
+// Sum of the values in rows [y0, y1] and columns [x0, x1] of channel 0, from its integral image
+template<typename A, class Wrap>
+__device__ inline A RectSum(const Wrap &sum, int sample, int y0, int x0, int y1, int x1)
+{
+    return *sum.ptr(sample, y1 + 1, x1 + 1, 0) - *sum.ptr(sample, y0, x1 + 1, 0) - *sum.ptr(sample, y1 + 1, x0, 0)
+         + *sum.ptr(sample, y0, x0, 0);
+}
+
+// Sum of the (2 * radius + 1)^2 window centered at (x, y) with replicated borders: the window clipped to the image
+// plus the first and last rows and columns, and the corners, each weighted by the number of times it is replicated
+// into the window.  Away from the borders it reads only the 4 corners of the window.
+template<typename A, class Wrap>
+__device__ inline A BoxSumReplicate(const Wrap &sum, int sample, int2 size, int x, int y, int radius)
+{
+    int y0 = max(y - radius, 0), y1 = min(y + radius, size.y - 1);
+    int x0 = max(x - radius, 0), x1 = min(x + radius, size.x - 1);
+
+    A top    = static_cast<A>(y0 - (y - radius));
+    A bottom = static_cast<A>(y + radius - y1);
+    A left   = static_cast<A>(x0 - (x - radius));
+    A right  = static_cast<A>(x + radius - x1);
+
+    A res = RectSum<A>(sum, sample, y0, x0, y1, x1);
+
+    if (top != 0 || bottom != 0)
+    {
+        res += top * RectSum<A>(sum, sample, 0, x0, 0, x1) + bottom * RectSum<A>(sum, sample, y1, x0, y1, x1);
+    }
+    if (left != 0 || right != 0)
+    {
+        res += left * RectSum<A>(sum, sample, y0, 0, y1, 0) + right * RectSum<A>(sum, sample, y0, x1, y1, x1);
+
+        if (top != 0 || bottom != 0)
+        {
+            res += top * (left * RectSum<A>(sum, sample, 0, 0, 0, 0) + right * RectSum<A>(sum, sample, 0, x1, 0, x1))
+                 + bottom
+                       * (left * RectSum<A>(sum, sample, y1, 0, y1, 0)
+                          + right * RectSum<A>(sum, sample, y1, x1, y1, x1));
+        }
+    }
+
+    return res;
+}
+
+} // namespace cvcuda::priv::integral
+
+#endif // CVCUDA_PRIV_INTEGRAL_IMAGE_CUH
@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpAdaptiveHistogramEq.hpp"
+
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/SaturateCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <cvcuda/util/StreamId.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <cub/cub.cuh>
+
+#include <algorithm>
+
+namespace {
+
+// Utilities for AdaptiveHistogramEq operator ----------------------------------
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+constexpr int kNumBins  = 256; // one thread per histogram bin in the tile kernel
+constexpr int kMaxTiles = 64;  // maximum number of tiles in each direction
+
+// Tile tx spans the columns x with floor(x * tilesX / width) == tx, tiles are never empty as long as the number of
+// tiles is not greater than the image size, and differ by at most one pixel in size
+
+__device__ inline int TileBegin(int t, int numTiles, int size)
+{
+    return static_cast<int>((static_cast<int64_t>(t) * size + numTiles - 1) / numTiles);
+}
+
+// CUDA kernels ----------------------------------------------------------------
+
+// Computes the clipped histogram of one tile of one channel of one sample, turns it into a look-up table and
+// blends it into the persistent state; grid is (tilesX * tilesY, C, N) and block is kNumBins threads
+
+template<class SrcWrapper>
+__global__ void ComputeTileLuts(SrcWrapper src, int2 size, int2 tiles, float clipLimit, float alpha, bool init,
+                                float *state)
+{
+    using BlockReduce = cub::BlockReduce<int, kNumBins>;
+    using BlockScan   = cub::BlockScan<int, kNumBins>;
+
+    __shared__ int hist[kNumBins];
+    __shared__ union
+    {
+        typename BlockReduce::TempStorage reduce;
+        typename BlockScan::TempStorage   scan;
+    } temp;
+    __shared__ int totalExcess;
+
+    int tx = blockIdx.x % tiles.x;
+    int ty = blockIdx.x / tiles.x;
+    int c  = blockIdx.y;
+    int n  = blockIdx.z;
+
+    int x0 = TileBegin(tx, tiles.x, size.x), x1 = TileBegin(tx + 1, tiles.x, size.x);
+    int y0 = TileBegin(ty, tiles.y, size.y), y1 = TileBegin(ty + 1, tiles.y, size.y);
+
+    int tileWidth  = x1 - x0;
+    int tilePixels = tileWidth * (y1 - y0);
+
+    int b = threadIdx.x;
+
+    hist[b] = 0;
+
+    __syncthreads();
+
+    for (int i = b; i < tilePixels; i += kNumBins)
+    {
+        int x = x0 + i % tileWidth;
+        int y = y0 + i / tileWidth;
+
+        atomicAdd(&hist[*src.ptr(n, y, x, c)], 1);
+    }
+
+    __syncthreads();
+
+    int count = hist[b];
+
+    if (clipLimit > 0.f)
+    {
+        // Clip the histogram and redistribute the excess uniformly, the residual goes to equally-spaced bins
+        int limit = cuda::max(static_cast<int>(clipLimit * tilePixels / kNumBins), 1);
+
+        int excess = BlockReduce(temp.reduce).Sum(cuda::max(count - limit, 0));
+        if (b == 0)
+        {
+            totalExcess = excess;
+        }
+
+        __syncthreads();
+
+        excess = totalExcess;
+
+        int redistBatch  = excess / kNumBins;
+        int residual     = excess - redistBatch * kNumBins;
+        int residualStep = residual > 0 ? cuda::max(kNumBins / residual, 1) : kNumBins;
+
+        count = cuda::min(count, limit) + redistBatch;
+
+        if (b % residualStep == 0 && b / residualStep < residual)
+        {
+            count++;
+        }
+    }
+
+    int cdf;
+    BlockScan(temp.scan).InclusiveSum(count, cdf);
+
+    float lut = cdf * (255.f / tilePixels);
+
+    float &lutState = state[((((int64_t)n * gridDim.y + c) * tiles.y + ty) * tiles.x + tx) * kNumBins + b];
+
+    lutState = init ? lut : alpha * lut + (1.f - alpha) * lutState;
+}
+
+// Maps each pixel with the bilinear blend of the look-up tables of its four nearest tiles
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void ApplyTileLuts(SrcWrapper src, DstWrapper dst, int2 size, int numChannels, int2 tiles,
+                              const float *state)
+{
+    int x = blockIdx.x * blockDim.x + threadIdx.x;
+    int y = blockIdx.y * blockDim.y + threadIdx.y;
+    int n = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+    {
+        return;
+    }
+
+    // Position in tile units with tile centers at integer coordinates
+    float txf = (x + .5f) * tiles.x / size.x - .5f;
+    float tyf = (y + .5f) * tiles.y / size.y - .5f;
+
+    int tx1 = static_cast<int>(floorf(txf)), ty1 = static_cast<int>(floorf(tyf));
+
+    float xa = txf - tx1, ya = tyf - ty1;
+
+    int tx2 = cuda::min(tx1 + 1, tiles.x - 1), ty2 = cuda::min(ty1 + 1, tiles.y - 1);
+
+    tx1 = cuda::max(tx1, 0);
+    ty1 = cuda::max(ty1, 0);
+
+    for (int c = 0; c < numChannels; ++c)
+    {
+        const float *luts = state + ((int64_t)n * numChannels + c) * tiles.y * tiles.x * kNumBins;
+
+        int v = *src.ptr(n, y, x, c);
+
+        float v11 = luts[(ty1 * tiles.x + tx1) * kNumBins + v];
+        float v12 = luts[(ty1 * tiles.x + tx2) * kNumBins + v];
+        float v21 = luts[(ty2 * tiles.x + tx1) * kNumBins + v];
+        float v22 = luts[(ty2 * tiles.x + tx2) * kNumBins + v];
+
+        float res = (v11 * (1.f - xa) + v12 * xa) * (1.f - ya) + (v21 * (1.f - xa) + v22 * xa) * ya;
+
+        *dst.ptr(n, y, x, c) = cuda::SaturateCast<uint8_t>(res);
+    }
+}
+
+} // anonymous namespace
+
+namespace cvcuda::priv {
+
+// Constructor -----------------------------------------------------------------
+
+AdaptiveHistogramEq::AdaptiveHistogramEq() {}
+
+AdaptiveHistogramEq::~AdaptiveHistogramEq()
+{
+    for (auto &[streamId, state] : m_states)
+    {
+        cudaFree(state.luts);
+    }
+}
+
+void AdaptiveHistogramEq::releaseState(cudaStream_t stream) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_states.find(util::GetCudaStreamIdHint(stream));
+    if (it == m_states.end())
+    {
+        return;
+    }
+
+    // The tables may still be read by work submitted to the stream
+    NVCV_CHECK_THROW(cudaStreamSynchronize(stream));
+    NVCV_CHECK_THROW(cudaFree(it->second.luts));
+    m_states.erase(it);
+}
+
+// Tensor operator -------------------------------------------------------------
+
+void AdaptiveHistogramEq::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                     const NVCVSize2D tileGrid, float clipLimit, float temporalAlpha,
+                                     bool resetState) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto outData = out.exportData<nvcv::TensorDataStridedCuda>();
+    if (!outData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    if (!(inData->layout() == nvcv::TENSOR_HWC || inData->layout() == nvcv::TENSOR_NHWC)
+        || inData->layout() != outData->layout())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output must have the same HWC or NHWC layout");
+    }
+    if (inData->dtype() != nvcv::TYPE_U8 || outData->dtype() != nvcv::TYPE_U8)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output must have U8 data type");
+    }
+    if (inData->shape() != outData->shape())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output must have the same shape");
+    }
+
+    auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*outData);
+    NVCV_ASSERT(inAccess && outAccess);
+
+    int  numSamples  = inAccess->numSamples();
+    int  numChannels = inAccess->numChannels();
+    int2 size{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+    int2 tiles{tileGrid.w, tileGrid.h};
+
+    if (numChannels < 1 || numChannels > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid number of channels %d, must be in [1, 4]",
+                              numChannels);
+    }
+    if (numSamples > 65535)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid number of samples %d, must be <= 65535",
+                              numSamples);
+    }
+    if (tiles.x < 1 || tiles.y < 1 || tiles.x > kMaxTiles || tiles.y > kMaxTiles)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid tile grid %dx%d, must be in [1, %d]",
+                              tiles.x, tiles.y, kMaxTiles);
+    }
+    if (tiles.x > size.x || tiles.y > size.y)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid tile grid %dx%d, must not be greater than image size %dx%d", tiles.x, tiles.y,
+                              size.x, size.y);
+    }
+    if (!(temporalAlpha > 0.f && temporalAlpha <= 1.f))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid temporal alpha %f, must be in (0, 1]",
+                              temporalAlpha);
+    }
+    if (std::max(inAccess->sampleStride() * numSamples, outAccess->sampleStride() * numSamples)
+        > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input or output size is too large");
+    }
+
+    if (numSamples == 0)
+    {
+        return;
+    }
+
+    // Find the state of this stream, (re)allocating its tables when they do not fit the current call
+
+    int4   shape{numSamples, numChannels, tiles.x, tiles.y};
+    size_t numLutValues = static_cast<size_t>(numSamples) * numChannels * tiles.x * tiles.y * kNumBins;
+    bool   init         = resetState;
+    float *luts         = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        StreamState &state = m_states[util::GetCudaStreamIdHint(stream)];
+
+        if (state.capacity < numLutValues)
+        {
+            if (state.luts)
+            {
+                NVCV_CHECK_THROW(cudaStreamSynchronize(stream));
+                NVCV_CHECK_THROW(cudaFree(state.luts));
+                state = StreamState{};
+            }
+            NVCV_CHECK_THROW(cudaMalloc(&state.luts, numLutValues * sizeof(float)));
+            state.capacity = numLutValues;
+        }
+
+        if (state.shape.x != shape.x || state.shape.y != shape.y || state.shape.z != shape.z
+            || state.shape.w != shape.w)
+        {
+            init        = true;
+            state.shape = shape;
+        }
+
+        luts = state.luts;
+    }
+
+    auto src = cuda::CreateTensorWrapNHWC<const uint8_t, int32_t>(*inData);
+    auto dst = cuda::CreateTensorWrapNHWC<uint8_t, int32_t>(*outData);
+
+    dim3 lutGrid(tiles.x * tiles.y, numChannels, numSamples);
+
+    ComputeTileLuts<<<lutGrid, kNumBins, 0, stream>>>(src, size, tiles, clipLimit, temporalAlpha, init, luts);
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    dim3 block(32, 8, 1);
+    dim3 grid(util::DivUp(size.x, (int)block.x), util::DivUp(size.y, (int)block.y), numSamples);
+
+    ApplyTileLuts<<<grid, block, 0, stream>>>(src, dst, size, numChannels, tiles, luts);
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpAdaptiveHistogramEq.hpp
+ *
+ * @brief Defines the private C++ Class for the AdaptiveHistogramEq operation.
+ */
+
+#ifndef CVCUDA_PRIV_ADAPTIVE_HISTOGRAM_EQ_HPP
+#define CVCUDA_PRIV_ADAPTIVE_HISTOGRAM_EQ_HPP
+
+#include "IOperator.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Size.h>
+#include <nvcv/Tensor.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace cvcuda::priv {
+
+class AdaptiveHistogramEq final : public IOperator
+{
+public:
+    explicit AdaptiveHistogramEq();
+
+    ~AdaptiveHistogramEq();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, const NVCVSize2D tileGrid,
+                    float clipLimit, float temporalAlpha, bool resetState) const;
+
+    void releaseState(cudaStream_t stream) const;
+
+private:
+    // Equalization state persistent across calls on one stream: the moving average of the per-tile look-up tables
+    struct StreamState
+    {
+        float *luts     = nullptr; // [N][C][tilesY][tilesX][256] look-up tables
+        size_t capacity = 0;       // number of floats allocated in luts
+        int4   shape{0, 0, 0, 0};  // (N, C, tilesX, tilesY) of the tables stored in luts
+    };
+
+    // States are keyed by the stream ID hint rather than the handle, the driver may give the handle of a destroyed
+    // stream to a new one, which must not inherit its tables
+    mutable std::mutex                                m_mutex;
+    mutable std::unordered_map<uint64_t, StreamState> m_states;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_ADAPTIVE_HISTOGRAM_EQ_HPP
@@ -17,6 +17,7 @@
 
 #include "OpBilateralFilter.hpp"
 
+#include "BilateralGrid.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -99,4 +100,68 @@ void BilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBatchVarS
                                                borderMode, stream));
 }
 
+void BilateralFilter::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, int diameter,
+                                 float sigmaColor, float sigmaSpace, const NVCVBilateralGridParams &gridParams) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto outData = out.exportData<nvcv::TensorDataStridedCuda>();
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    BilateralGridFilter(stream, m_scratch, *inData, *inData, *outData, diameter, sigmaColor, sigmaSpace, gridParams);
+}
+
+void BilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                                 const nvcv::ImageBatchVarShape &out, const nvcv::Tensor &diameter,
+                                 const nvcv::Tensor &sigmaColor, const nvcv::Tensor &sigmaSpace,
+                                 const NVCVBilateralGridParams &gridParams) const
+{
+    auto inData = in.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be device-accessible, varshape image batch");
+    }
+
+    auto outData = out.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be device-accessible, varshape image batch");
+    }
+
+    auto diameterData = diameter.exportData<nvcv::TensorDataStridedCuda>();
+    if (diameterData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Diameter must be device-accessible, pitch-linear tensor");
+    }
+
+    auto sigmaColorData = sigmaColor.exportData<nvcv::TensorDataStridedCuda>();
+    if (sigmaColorData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "sigmaColor must be device-accessible, pitch-linear tensor");
+    }
+
+    auto sigmaSpaceData = sigmaSpace.exportData<nvcv::TensorDataStridedCuda>();
+    if (sigmaSpaceData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "sigmaSpace must be device-accessible, pitch-linear tensor");
+    }
+
+    BilateralGridFilter(stream, m_scratch, *inData, *inData, *outData, *diameterData, *sigmaColorData,
+                        *sigmaSpaceData, gridParams);
+}
+
 } // namespace cvcuda::priv
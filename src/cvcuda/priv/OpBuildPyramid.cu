@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpBuildPyramid.hpp"
+
+#include "PyramidUtil.cuh"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <vector>
+
+namespace cuda = nvcv::cuda;
+
+namespace cvcuda::priv {
+
+// Constructor -----------------------------------------------------------------
+
+BuildPyramid::BuildPyramid(int3 maxShape)
+    : m_maxShape{maxShape}
+{
+    if (maxShape.x < 2 || maxShape.y < 2 || maxShape.z < 1 || maxShape.z > 65535)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Operator constructor arg. maxShape (W=%d H=%d N=%d) must have W and H >= 2 and N in "
+                              "[1, 65535]",
+                              maxShape.x, maxShape.y, maxShape.z);
+    }
+
+    nvcv::TensorShape::ShapeType shapeBase({1, maxShape.z, maxShape.y, maxShape.x, 1});
+
+    m_maxBase = nvcv::Tensor(nvcv::TensorShape{shapeBase, pyramid::TENSOR_LNHWC}, nvcv::TYPE_F32);
+}
+
+// Submit ----------------------------------------------------------------------
+
+NVCVPyramidInfo BuildPyramid::operator()(cudaStream_t stream, const nvcv::Tensor &in,
+                                         const nvcv::TensorBatch &gaussPyramid, float initSigma,
+                                         bool expandInput) const
+{
+    if (!(in.layout() == nvcv::TENSOR_HWC || in.layout() == nvcv::TENSOR_NHWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input tensor layout must be HWC or NHWC");
+    }
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be a valid CUDA strided tensor");
+    }
+    if (inData->dtype() != nvcv::TYPE_U8) // The only supported data type is U8
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input tensor dtype must be U8");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    if (!inAccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be a valid image-based tensor");
+    }
+    if (inAccess->numChannels() > 1 || inAccess->numPlanes() > 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input tensor must have 1 channel and 1 plane");
+    }
+    if (inAccess->sampleStride() * inAccess->numSamples() > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Input size exceeds %d. Tensor is too large.",
+                              cuda::TypeTraits<int32_t>::max);
+    }
+
+    int3 inShape{(int)inAccess->numCols(), (int)inAccess->numRows(), (int)inAccess->numSamples()};
+
+    if (expandInput)
+    {
+        inShape.x *= 2;
+        inShape.y *= 2;
+    }
+
+    if (inShape.x < 2 || inShape.y < 2 || inShape.x > m_maxShape.x || inShape.y > m_maxShape.y
+        || inShape.z > m_maxShape.z)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "First pyramid level shape (W=%d H=%d N=%d) must have W and H >= 2 and be smaller than "
+                              "or equal to maxShape (W=%d H=%d N=%d) defined in operator constructor",
+                              inShape.x, inShape.y, inShape.z, m_maxShape.x, m_maxShape.y, m_maxShape.z);
+    }
+
+    // The number of levels and scales come from the pre-allocated pyramid, which is then checked against them
+
+    if (gaussPyramid.numTensors() < 1 || gaussPyramid.rank() != 5)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Pyramid must have at least one level and each level must have rank 5");
+    }
+
+    NVCVPyramidInfo info;
+
+    info.numLevels  = gaussPyramid.numTensors();
+    info.numScales  = (int)pyramid::ExportLevelData(gaussPyramid[0]).shape(0) - 3;
+    info.firstLevel = expandInput ? -1 : 0;
+    info.initSigma  = initSigma;
+
+    int3 baseShape = pyramid::ValidatePyramid(gaussPyramid, info);
+
+    if (baseShape.x != inShape.x || baseShape.y != inShape.y || baseShape.z != inShape.z)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "First pyramid level shape (W=%d H=%d N=%d) must be the input shape%s (W=%d H=%d N=%d)",
+                              baseShape.x, baseShape.y, baseShape.z, expandInput ? " expanded" : "", inShape.x,
+                              inShape.y, inShape.z);
+    }
+
+    std::vector<nvcv::Tensor> levels;
+    levels.reserve(info.numLevels);
+
+    for (int level = 0; level < info.numLevels; level++)
+    {
+        levels.push_back(gaussPyramid[level]);
+    }
+
+    // The base image is a view of the maximum one, with the shape of the first level
+
+    auto maxBaseData = m_maxBase.exportData<nvcv::TensorDataStridedCuda>();
+    if (!maxBaseData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INTERNAL, "Invalid BuildPyramid internal data");
+    }
+
+    nvcv::TensorShape::ShapeType shapeBase({1, inShape.z, inShape.y, inShape.x, 1});
+
+    nvcv::Tensor base = pyramid::GetViewFrom(*maxBaseData, shapeBase);
+
+    pyramid::ComputeGaussianPyramid<uint8_t>(*inData, base, levels, nullptr, inShape, expandInput, info.numScales,
+                                             initSigma, stream);
+
+    return info;
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBuildPyramid.hpp
+ *
+ * @brief Defines the private C++ Class for the BuildPyramid operation.
+ */
+
+#ifndef CVCUDA_PRIV_BUILD_PYRAMID_HPP
+#define CVCUDA_PRIV_BUILD_PYRAMID_HPP
+
+#include "IOperator.hpp"
+
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
+
+namespace cvcuda::priv {
+
+class BuildPyramid final : public IOperator
+{
+public:
+    explicit BuildPyramid(int3 maxShape);
+
+    NVCVPyramidInfo operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::TensorBatch &pyramid,
+                               float initSigma, bool expandInput) const;
+
+private:
+    int3 m_maxShape;
+
+    // Base image with the input (potentially expanded) converted to F32, the first level is filtered from it
+    nvcv::Tensor m_maxBase;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_BUILD_PYRAMID_HPP
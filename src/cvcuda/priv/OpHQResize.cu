@@ -21,6 +21,7 @@
 
 #include "OpHQResizeBatchWrap.cuh"
 #include "OpHQResizeFilter.cuh"
+#include "PyramidUtil.cuh"
 
 #include <cuda_runtime.h>
 #include <cvcuda/cuda_tools/DropCast.hpp>
@@ -30,6 +31,7 @@
 #include <cvcuda/cuda_tools/SaturateCast.hpp>
 #include <cvcuda/cuda_tools/StaticCast.hpp>
 #include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <cvcuda/util/LruCache.hpp>
 #include <nvcv/DataType.hpp>
 #include <nvcv/Exception.hpp>
 #include <nvcv/ImageData.hpp>
@@ -41,6 +43,9 @@
 #include <nvcv/util/CheckError.hpp>
 #include <nvcv/util/Math.hpp>
 
+#include <array>
+#include <cstring>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 
@@ -1803,6 +1808,42 @@ inline void RunTypedSwitch(nvcv::DataType srcDtype, nvcv::DataType dstDtype, int
 #undef NVCV_RUN_MULTI_STATIC_CHANNEL_HQ_RESIZE
 }
 
+// The sample descriptor depends only on the shapes, number of channels, roi and filter modes. Those are
+// packed into the key, with the roi bit-cast to ints, so that the descriptors can be reused across calls.
+template<int kSpatialNDim>
+struct SampleDescKey
+{
+    static constexpr int kNumFields = 4 * kSpatialNDim + 6;
+
+    std::array<int32_t, kNumFields> fields;
+
+    bool operator==(const SampleDescKey &other) const
+    {
+        return fields == other.fields;
+    }
+};
+
+struct SampleDescKeyHash
+{
+    template<int kSpatialNDim>
+    size_t operator()(const SampleDescKey<kSpatialNDim> &key) const
+    {
+        size_t hash = 0;
+        for (int32_t v : key.fields)
+        {
+            hash = hash * 1000003 ^ std::hash<int32_t>{}(v);
+        }
+        return hash;
+    }
+};
+
+template<int kSpatialNDim>
+using SampleDescCache
+    = nvcv::util::LruCache<SampleDescKey<kSpatialNDim>, resampling::SampleDesc<kSpatialNDim>, SampleDescKeyHash>;
+
+// Bounds the number of distinct geometries remembered by a single operator instance
+constexpr size_t kMaxCachedSampleDescs = 256;
+
 template<int _kSpatialNDim, typename IntermediateBaseT = float>
 class HQResizeRun
 {
@@ -1810,8 +1851,10 @@ public:
     static_assert(_kSpatialNDim == 2 || _kSpatialNDim == 3,
                   "Currently, the resampling operator supports only 2 or 3 spatial dimensions");
 
-    HQResizeRun(const filter::ResamplingFiltersFactory &filtersFactory)
+    HQResizeRun(const filter::ResamplingFiltersFactory &filtersFactory,
+                SampleDescCache<_kSpatialNDim>         &sampleDescCache)
         : m_filtersFactory{filtersFactory}
+        , m_sampleDescCache{sampleDescCache}
     {
     }
 
@@ -2432,8 +2475,40 @@ private:
                          const VecI<kSpatialNDim> &dstShape, int numChannels, const HQResizeRoiF *roi,
                          const filter::FilterMode &minFilter, const filter::FilterMode &magFilter) const
     {
-        SetupSampleDescFilterShapeScale(sampleDesc, srcShape, dstShape, numChannels, minFilter, magFilter, roi);
-        SetupBlockLayout(sampleDesc);
+        SampleDescKey<kSpatialNDim> key;
+        int                         field = 0;
+        for (int d = 0; d < kSpatialNDim; d++)
+        {
+            key.fields[field++] = cuda::GetElement(srcShape, d);
+            key.fields[field++] = cuda::GetElement(dstShape, d);
+            key.fields[field++] = roi != nullptr ? BitCastToInt(roi->lo[d]) : 0;
+            key.fields[field++] = roi != nullptr ? BitCastToInt(roi->hi[d]) : 0;
+        }
+        key.fields[field++] = numChannels;
+        key.fields[field++] = roi != nullptr;
+        key.fields[field++] = static_cast<int32_t>(minFilter.filterType);
+        key.fields[field++] = minFilter.antialias;
+        key.fields[field++] = static_cast<int32_t>(magFilter.filterType);
+        key.fields[field++] = magFilter.antialias;
+        assert(field == SampleDescKey<kSpatialNDim>::kNumFields);
+
+        auto cached = m_sampleDescCache.getOrCreate(
+            key,
+            [&]
+            {
+                auto desc = std::make_unique<SampleDescT>();
+                SetupSampleDescFilterShapeScale(*desc, srcShape, dstShape, numChannels, minFilter, magFilter, roi);
+                SetupBlockLayout(*desc);
+                return desc;
+            });
+        sampleDesc = *cached;
+    }
+
+    static int32_t BitCastToInt(float value)
+    {
+        int32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
     }
 
     void SetupSampleDescFilterShapeScale(SampleDescT &sampleDesc, const VecI<kSpatialNDim> &inShape,
@@ -2653,6 +2728,7 @@ private:
     }
 
     const filter::ResamplingFiltersFactory &m_filtersFactory;
+    SampleDescCache<kSpatialNDim>          &m_sampleDescCache;
 };
 } // namespace
 
@@ -2660,8 +2736,8 @@ namespace cvcuda::priv {
 namespace hq_resize {
 
 // Implements the IHQResizeImpl interface and keeps the filters fatory with initilized
-// supports. The actual implementation is in a stateless HQResizeRun that is parametrized
-// with the number of resampled dimensions.
+// supports and the caches of sample descriptors. The actual implementation is in a stateless
+// HQResizeRun that is parametrized with the number of resampled dimensions.
 class HQResizeImpl final : public IHQResizeImpl
 {
 public:
@@ -2673,13 +2749,13 @@ public:
     {
         if (inputShape.ndim == 2)
         {
-            HQResizeRun<2> resize(m_filtersFactory);
+            HQResizeRun<2> resize(m_filtersFactory, m_sampleDescs2D);
             return resize.getWorkspaceRequirements(numSamples, inputShape, outputShape, minInterpolation,
                                                    magInterpolation, antialias, roi);
         }
         else if (inputShape.ndim == 3)
         {
-            HQResizeRun<3> resize(m_filtersFactory);
+            HQResizeRun<3> resize(m_filtersFactory, m_sampleDescs3D);
             return resize.getWorkspaceRequirements(numSamples, inputShape, outputShape, minInterpolation,
                                                    magInterpolation, antialias, roi);
         }
@@ -2698,13 +2774,13 @@ public:
     {
         if (inputShapes.ndim == 2)
         {
-            HQResizeRun<2> resize(m_filtersFactory);
+            HQResizeRun<2> resize(m_filtersFactory, m_sampleDescs2D);
             return resize.getWorkspaceRequirements(numSamples, inputShapes, outputShapes, minInterpolation,
                                                    magInterpolation, antialias, rois);
         }
         else if (inputShapes.ndim == 3)
         {
-            HQResizeRun<3> resize(m_filtersFactory);
+            HQResizeRun<3> resize(m_filtersFactory, m_sampleDescs3D);
             return resize.getWorkspaceRequirements(numSamples, inputShapes, outputShapes, minInterpolation,
                                                    magInterpolation, antialias, rois);
         }
@@ -2720,12 +2796,12 @@ public:
     {
         if (maxShape.ndim == 2)
         {
-            HQResizeRun<2> resize(m_filtersFactory);
+            HQResizeRun<2> resize(m_filtersFactory, m_sampleDescs2D);
             return resize.getWorkspaceRequirements(maxBatchSize, maxShape);
         }
         else if (maxShape.ndim == 3)
         {
-            HQResizeRun<3> resize(m_filtersFactory);
+            HQResizeRun<3> resize(m_filtersFactory, m_sampleDescs3D);
             return resize.getWorkspaceRequirements(maxBatchSize, maxShape);
         }
         else
@@ -2741,12 +2817,12 @@ public:
     {
         if (src.layout().find('D') < 0)
         {
-            HQResizeRun<2> resize(m_filtersFactory);
+            HQResizeRun<2> resize(m_filtersFactory, m_sampleDescs2D);
             resize(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, roi);
         }
         else
         {
-            HQResizeRun<3> resize(m_filtersFactory);
+            HQResizeRun<3> resize(m_filtersFactory, m_sampleDescs3D);
             resize(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, roi);
         }
     }
@@ -2755,7 +2831,7 @@ public:
                     const nvcv::ImageBatchVarShape &dst, const NVCVInterpolationType minInterpolation,
                     const NVCVInterpolationType magInterpolation, bool antialias, const HQResizeRoisF rois) override
     {
-        HQResizeRun<2> resize(m_filtersFactory);
+        HQResizeRun<2> resize(m_filtersFactory, m_sampleDescs2D);
         resize(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, rois);
     }
 
@@ -2765,18 +2841,22 @@ public:
     {
         if (src.layout().find('D') < 0)
         {
-            HQResizeRun<2> resize(m_filtersFactory);
+            HQResizeRun<2> resize(m_filtersFactory, m_sampleDescs2D);
             resize(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, rois);
         }
         else
         {
-            HQResizeRun<3> resize(m_filtersFactory);
+            HQResizeRun<3> resize(m_filtersFactory, m_sampleDescs3D);
             resize(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, rois);
         }
     }
 
 private:
     filter::ResamplingFiltersFactory m_filtersFactory;
+    // the descriptors are set up on the host, caching them saves the filter and block layout setup for
+    // the geometries that repeat across calls
+    mutable SampleDescCache<2>       m_sampleDescs2D{kMaxCachedSampleDescs};
+    mutable SampleDescCache<3>       m_sampleDescs3D{kMaxCachedSampleDescs};
 };
 
 } // namespace hq_resize
@@ -2846,4 +2926,48 @@ void HQResize::operator()(cudaStream_t stream, const cvcuda::Workspace &ws, cons
     m_impl->operator()(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, rois);
 }
 
+// Pyramid variant
+void HQResize::operator()(cudaStream_t stream, const cvcuda::Workspace &ws, const nvcv::TensorBatch &pyramid,
+                          const NVCVPyramidInfo &pyramidInfo, const nvcv::Tensor &dst,
+                          const NVCVInterpolationType minInterpolation, const NVCVInterpolationType magInterpolation,
+                          bool antialias) const
+{
+    assert(m_impl);
+
+    int3 baseShape = pyramid::ValidatePyramid(pyramid, pyramidInfo);
+
+    auto dstData = dst.exportData<nvcv::TensorDataStridedCuda>();
+    if (!dstData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be a valid CUDA strided tensor");
+    }
+    if (dstData->layout() != nvcv::TENSOR_NHWC || dstData->dtype() != nvcv::TYPE_F32 || dstData->shape(3) != 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output tensor resized from a pyramid must have NHWC layout, 1 channel and F32 data "
+                              "type");
+    }
+    if (dstData->shape(0) != baseShape.z)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output tensor number of samples must match the pyramid, %d != %d",
+                              (int)dstData->shape(0), baseShape.z);
+    }
+
+    int2 dstSize{(int)dstData->shape(2), (int)dstData->shape(1)};
+
+    // Select the coarsest level still not smaller than the output, its decimation and Gaussian filtering replace
+    // most of the work (and memory traffic) the resampling would do reading the first level
+    int level = 0;
+    while (level + 1 < pyramidInfo.numLevels && (baseShape.x >> (level + 1)) >= dstSize.x
+           && (baseShape.y >> (level + 1)) >= dstSize.y)
+    {
+        level++;
+    }
+
+    nvcv::Tensor src = pyramid::GetLayerView(pyramid::ExportLevelData(pyramid[level]), 0);
+
+    m_impl->operator()(stream, ws, src, dst, minInterpolation, magInterpolation, antialias, nullptr);
+}
+
 } // namespace cvcuda::priv
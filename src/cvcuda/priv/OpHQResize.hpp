@@ -106,6 +106,11 @@ public:
                     const nvcv::TensorBatch &dst, const NVCVInterpolationType minInterpolation,
                     const NVCVInterpolationType magInterpolation, bool antialias, const HQResizeRoisF roi) const;
 
+    void operator()(cudaStream_t stream, const Workspace &ws, const nvcv::TensorBatch &pyramid,
+                    const NVCVPyramidInfo &pyramidInfo, const nvcv::Tensor &dst,
+                    const NVCVInterpolationType minInterpolation, const NVCVInterpolationType magInterpolation,
+                    bool antialias) const;
+
 private:
     std::unique_ptr<hq_resize::IHQResizeImpl> m_impl;
 };
@@ -0,0 +1,646 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpImageStats.hpp"
+
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/StaticCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <cub/cub.cuh>
+
+#include <limits>
+
+namespace {
+
+// Utilities for ImageStats operator -------------------------------------------
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+using KeyType = unsigned long long;
+
+constexpr int      kBlockSize      = 256;
+constexpr int      kMaxSharedBins  = 8192; // 32 KB of shared memory for the block-local histogram
+constexpr int      kPixelsPerBlock = kBlockSize * 16;
+constexpr KeyType  kMinKeyInit     = std::numeric_limits<KeyType>::max();
+constexpr KeyType  kMaxKeyInit     = 0;
+constexpr uint32_t kNoIndex        = std::numeric_limits<uint32_t>::max();
+
+// Outputs of the statistics, each is an (N, R, E) view where a zero ROI stride is used for outputs without the
+// R dimension (only allowed when there is a single ROI per sample); nullptr data means the output is not wanted
+
+struct StatsOutputs
+{
+    cuda::Tensor3DWrap<int>     histogram;
+    cuda::Tensor3DWrap<double>  minMaxVal;
+    cuda::Tensor3DWrap<KeyType> minMaxKey; // aliases minMaxLoc, keys are decoded in-place by the finalize kernel
+    cuda::Tensor3DWrap<double>  sum;
+    cuda::Tensor3DWrap<double>  sumSq;
+
+    int   numBins;
+    float histLow, histScale;
+
+    bool hasHistogram, hasMinMax, hasSum, hasSumSq;
+};
+
+// Order-preserving 32-bit key of a value, so that unsigned comparisons on keys match comparisons on values; the
+// key is placed in the high word of a 64-bit key with the pixel index in the low word, that way a single 64-bit
+// atomic min/max selects both the extreme value and its first occurrence in raster order
+
+template<typename T>
+__device__ inline uint32_t EncodeValue(T v)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        uint32_t bits = __float_as_uint(v);
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<uint32_t>(static_cast<int32_t>(v)) ^ 0x80000000u;
+    }
+    else
+    {
+        return static_cast<uint32_t>(v);
+    }
+}
+
+template<typename T>
+__device__ inline double DecodeValue(uint32_t key)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        uint32_t bits = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+        return static_cast<double>(__uint_as_float(bits));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<double>(static_cast<int32_t>(key ^ 0x80000000u));
+    }
+    else
+    {
+        return static_cast<double>(key);
+    }
+}
+
+// Per-thread (and per-block after reduction) accumulated statistics
+
+struct StatsAccum
+{
+    KeyType minKey, maxKey;
+    double  sum, sumSq;
+};
+
+struct StatsReduceOp
+{
+    __device__ inline StatsAccum operator()(const StatsAccum &a, const StatsAccum &b) const
+    {
+        return {a.minKey < b.minKey ? a.minKey : b.minKey, a.maxKey > b.maxKey ? a.maxKey : b.maxKey, a.sum + b.sum,
+                a.sumSq + b.sumSq};
+    }
+};
+
+// CUDA kernels ----------------------------------------------------------------
+
+__global__ void InitImageStats(StatsOutputs out, int numRois)
+{
+    int z = blockIdx.z;
+    int n = z / numRois;
+    int r = z % numRois;
+
+    if (out.hasHistogram)
+    {
+        for (int b = threadIdx.x; b < out.numBins; b += blockDim.x)
+        {
+            *out.histogram.ptr(n, r, b) = 0;
+        }
+    }
+    if (threadIdx.x == 0)
+    {
+        if (out.hasMinMax)
+        {
+            *out.minMaxKey.ptr(n, r, 0) = kMinKeyInit;
+            *out.minMaxKey.ptr(n, r, 1) = kMaxKeyInit;
+        }
+        if (out.hasSum)
+        {
+            *out.sum.ptr(n, r, 0) = 0.0;
+        }
+        if (out.hasSumSq)
+        {
+            *out.sumSq.ptr(n, r, 0) = 0.0;
+        }
+    }
+}
+
+template<typename T, bool HasMask, bool HasRois, bool SharedHist>
+__global__ __launch_bounds__(kBlockSize) void ComputeImageStats(cuda::Tensor3DWrap<const T> in,
+                                                                cuda::Tensor3DWrap<const uint8_t> mask,
+                                                                cuda::Tensor2DWrap<const int4> rois, int numRois,
+                                                                int2 size, StatsOutputs out)
+{
+    extern __shared__ int shist[];
+
+    int z = blockIdx.z;
+    int n = z / numRois;
+    int r = z % numRois;
+
+    int4 roi{0, 0, size.x, size.y};
+    if constexpr (HasRois)
+    {
+        roi = *rois.ptr(n, r);
+
+        // Clip the ROI (x, y, width, height) to the sample image
+        int x0 = cuda::max(roi.x, 0), y0 = cuda::max(roi.y, 0);
+        int x1 = cuda::min(roi.x + roi.z, size.x), y1 = cuda::min(roi.y + roi.w, size.y);
+        roi    = int4{x0, y0, cuda::max(x1 - x0, 0), cuda::max(y1 - y0, 0)};
+    }
+
+    if constexpr (SharedHist)
+    {
+        for (int b = threadIdx.x; b < out.numBins; b += blockDim.x)
+        {
+            shist[b] = 0;
+        }
+        __syncthreads();
+    }
+
+    StatsAccum acc{kMinKeyInit, kMaxKeyInit, 0.0, 0.0};
+
+    int64_t area = static_cast<int64_t>(roi.z) * roi.w;
+
+    for (int64_t p = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x; p < area;
+         p += static_cast<int64_t>(gridDim.x) * blockDim.x)
+    {
+        int x = roi.x + static_cast<int>(p % roi.z);
+        int y = roi.y + static_cast<int>(p / roi.z);
+
+        if constexpr (HasMask)
+        {
+            if (*mask.ptr(n, y, x) == 0)
+            {
+                continue;
+            }
+        }
+
+        T v = *in.ptr(n, y, x);
+
+        if (out.hasSum || out.hasSumSq)
+        {
+            double dv = static_cast<double>(v);
+            acc.sum += dv;
+            acc.sumSq += dv * dv;
+        }
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (v != v)
+            {
+                continue; // NaNs are neither binned nor candidates for min/max
+            }
+        }
+
+        if (out.hasMinMax)
+        {
+            uint32_t idx = static_cast<uint32_t>(y) * static_cast<uint32_t>(size.x) + static_cast<uint32_t>(x);
+            KeyType  key = static_cast<KeyType>(EncodeValue(v)) << 32;
+
+            acc.minKey = cuda::min(acc.minKey, key | idx);
+            acc.maxKey = cuda::max(acc.maxKey, key | (kNoIndex - idx));
+        }
+
+        if (out.hasHistogram)
+        {
+            float bin = (static_cast<float>(v) - out.histLow) * out.histScale;
+            if (bin >= 0.f && bin < out.numBins)
+            {
+                if constexpr (SharedHist)
+                {
+                    atomicAdd(&shist[static_cast<int>(bin)], 1);
+                }
+                else
+                {
+                    atomicAdd(out.histogram.ptr(n, r, static_cast<int>(bin)), 1);
+                }
+            }
+        }
+    }
+
+    if (out.hasMinMax || out.hasSum || out.hasSumSq)
+    {
+        using BlockReduce = cub::BlockReduce<StatsAccum, kBlockSize>;
+
+        __shared__ typename BlockReduce::TempStorage cubTempStorage;
+
+        StatsAccum blockAcc = BlockReduce(cubTempStorage).Reduce(acc, StatsReduceOp{});
+
+        if (threadIdx.x == 0)
+        {
+            if (out.hasMinMax && blockAcc.minKey != kMinKeyInit)
+            {
+                atomicMin(out.minMaxKey.ptr(n, r, 0), blockAcc.minKey);
+                atomicMax(out.minMaxKey.ptr(n, r, 1), blockAcc.maxKey);
+            }
+            if (out.hasSum)
+            {
+                atomicAdd(out.sum.ptr(n, r, 0), blockAcc.sum);
+            }
+            if (out.hasSumSq)
+            {
+                atomicAdd(out.sumSq.ptr(n, r, 0), blockAcc.sumSq);
+            }
+        }
+    }
+
+    if constexpr (SharedHist)
+    {
+        __syncthreads();
+
+        for (int b = threadIdx.x; b < out.numBins; b += blockDim.x)
+        {
+            if (shist[b] > 0)
+            {
+                atomicAdd(out.histogram.ptr(n, r, b), shist[b]);
+            }
+        }
+    }
+}
+
+template<typename T>
+__global__ void FinalizeImageStats(StatsOutputs out, int numRois, int numSamples, int width)
+{
+    int z = blockIdx.x * blockDim.x + threadIdx.x;
+    if (z >= numSamples * numRois)
+    {
+        return;
+    }
+
+    int n = z / numRois;
+    int r = z % numRois;
+
+    KeyType minKey = *out.minMaxKey.ptr(n, r, 0);
+    KeyType maxKey = *out.minMaxKey.ptr(n, r, 1);
+
+    int2 *loc = reinterpret_cast<int2 *>(out.minMaxKey.ptr(n, r, 0));
+
+    if (minKey == kMinKeyInit)
+    {
+        *out.minMaxVal.ptr(n, r, 0) = 0.0;
+        *out.minMaxVal.ptr(n, r, 1) = 0.0;
+        loc[0]                      = int2{-1, -1};
+        loc[1]                      = int2{-1, -1};
+        return;
+    }
+
+    uint32_t minIdx = static_cast<uint32_t>(minKey & kNoIndex);
+    uint32_t maxIdx = kNoIndex - static_cast<uint32_t>(maxKey & kNoIndex);
+
+    *out.minMaxVal.ptr(n, r, 0) = DecodeValue<T>(static_cast<uint32_t>(minKey >> 32));
+    *out.minMaxVal.ptr(n, r, 1) = DecodeValue<T>(static_cast<uint32_t>(maxKey >> 32));
+
+    loc[0] = int2{static_cast<int>(minIdx % width), static_cast<int>(minIdx / width)};
+    loc[1] = int2{static_cast<int>(maxIdx % width), static_cast<int>(maxIdx / width)};
+}
+
+// Run functions in layers -----------------------------------------------------
+
+template<typename T, bool HasMask, bool HasRois>
+inline void LaunchComputeImageStats(cudaStream_t stream, dim3 grid, const nvcv::TensorDataStridedCuda &inData,
+                                    const cuda::Tensor3DWrap<const uint8_t> &maskWrap,
+                                    const cuda::Tensor2DWrap<const int4> &roisWrap, int numRois, int2 size,
+                                    const StatsOutputs &out)
+{
+    auto inWrap = cuda::CreateTensorWrapNHW<const T>(inData);
+
+    if (out.hasHistogram && out.numBins <= kMaxSharedBins)
+    {
+        ComputeImageStats<T, HasMask, HasRois, true>
+            <<<grid, kBlockSize, out.numBins * sizeof(int), stream>>>(inWrap, maskWrap, roisWrap, numRois, size, out);
+    }
+    else
+    {
+        ComputeImageStats<T, HasMask, HasRois, false>
+            <<<grid, kBlockSize, 0, stream>>>(inWrap, maskWrap, roisWrap, numRois, size, out);
+    }
+}
+
+template<typename T>
+inline void RunImageStatsForType(cudaStream_t stream, const nvcv::TensorDataStridedCuda &inData,
+                                 const nvcv::Optional<nvcv::TensorDataStridedCuda> &maskData,
+                                 const nvcv::Optional<nvcv::TensorDataStridedCuda> &roisData, int numSamples,
+                                 int numRois, int2 size, const StatsOutputs &out)
+{
+    int numEntries = numSamples * numRois;
+
+    InitImageStats<<<dim3(1, 1, numEntries), kBlockSize, 0, stream>>>(out, numRois);
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    // Each ROI is processed by enough blocks to cover the full sample, ROIs are at most the size of the sample
+    int64_t numPixels = static_cast<int64_t>(size.x) * size.y;
+    dim3    grid(std::max(1, static_cast<int>(std::min<int64_t>(util::DivUp(numPixels, kPixelsPerBlock), 1024))), 1,
+                 numEntries);
+
+    cuda::Tensor3DWrap<const uint8_t> maskWrap;
+    cuda::Tensor2DWrap<const int4>    roisWrap;
+
+    if (maskData)
+    {
+        maskWrap = cuda::CreateTensorWrapNHW<const uint8_t>(*maskData);
+    }
+    if (roisData)
+    {
+        roisWrap = cuda::Tensor2DWrap<const int4>(roisData->basePtr(), static_cast<int64_t>(roisData->stride(0)));
+    }
+
+    if (maskData && roisData)
+    {
+        LaunchComputeImageStats<T, true, true>(stream, grid, inData, maskWrap, roisWrap, numRois, size, out);
+    }
+    else if (maskData)
+    {
+        LaunchComputeImageStats<T, true, false>(stream, grid, inData, maskWrap, roisWrap, numRois, size, out);
+    }
+    else if (roisData)
+    {
+        LaunchComputeImageStats<T, false, true>(stream, grid, inData, maskWrap, roisWrap, numRois, size, out);
+    }
+    else
+    {
+        LaunchComputeImageStats<T, false, false>(stream, grid, inData, maskWrap, roisWrap, numRois, size, out);
+    }
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    if (out.hasMinMax)
+    {
+        FinalizeImageStats<T>
+            <<<util::DivUp(numEntries, kBlockSize), kBlockSize, 0, stream>>>(out, numRois, numSamples, size.x);
+        NVCV_CHECK_THROW(cudaGetLastError());
+    }
+}
+
+// Export one output tensor and check its shape: [N E] when numRois is 1 and there is no rois tensor, or [N R E];
+// numElems < 0 means the last dimension E is free (e.g. number of bins), numElems = 0 means there is no E dimension
+
+template<typename T>
+inline cuda::Tensor3DWrap<T> ExportOutput(const nvcv::Tensor &tensor, const char *name, nvcv::DataType dtype,
+                                          int numSamples, int numRois, bool hasRois, int numElems, int *lastDim)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    if (!data)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output %s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    if (data->dtype() != dtype)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %s must have %s data type, not %s", name,
+                              nvcvDataTypeGetName(dtype), nvcvDataTypeGetName(data->dtype()));
+    }
+
+    int baseRank = numElems == 0 ? 1 : 2;
+    int rank     = data->rank();
+
+    if (!((rank == baseRank && !hasRois) || rank == baseRank + 1))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %s must have rank %d%s, not %d", name,
+                              baseRank + 1, hasRois ? "" : " (or one less without ROIs)", rank);
+    }
+    if (data->shape(0) != numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output %s number of samples must be the same as input tensor", name);
+    }
+
+    if (reinterpret_cast<uintptr_t>(data->basePtr()) % alignof(T) != 0 || data->stride(0) % alignof(T) != 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %s must be aligned to %zu bytes", name,
+                              alignof(T));
+    }
+
+    bool    withRoiDim = rank == baseRank + 1;
+    int64_t roiStride  = 0;
+    if (withRoiDim)
+    {
+        if (data->shape(1) != numRois)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output %s number of ROIs must be %d, not %ld", name, numRois, data->shape(1));
+        }
+        roiStride = data->stride(1);
+        if (roiStride % alignof(T) != 0)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %s must be aligned to %zu bytes",
+                                  name, alignof(T));
+        }
+    }
+
+    if (numElems != 0)
+    {
+        int64_t elems = data->shape(rank - 1);
+        if ((numElems > 0 && elems != numElems) || elems <= 0)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %s last dimension must be %d, not %ld",
+                                  name, numElems, elems);
+        }
+        if (data->stride(rank - 1) != static_cast<int64_t>(sizeof(T)))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output %s last dimension must be contiguous", name);
+        }
+        if (lastDim)
+        {
+            *lastDim = static_cast<int>(elems);
+        }
+    }
+
+    return cuda::Tensor3DWrap<T>(data->basePtr(), static_cast<int64_t>(data->stride(0)), roiStride);
+}
+
+} // anonymous namespace
+
+namespace cvcuda::priv {
+
+// Constructor -----------------------------------------------------------------
+
+ImageStats::ImageStats() {}
+
+// Tensor operator -------------------------------------------------------------
+
+void ImageStats::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &mask,
+                            const nvcv::Tensor &rois, float histLow, float histHigh, const nvcv::Tensor &histogram,
+                            const nvcv::Tensor &minMaxVal, const nvcv::Tensor &minMaxLoc, const nvcv::Tensor &sum,
+                            const nvcv::Tensor &sumSq) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    if (!inAccess || !(inData->layout() == nvcv::TENSOR_HWC || inData->layout() == nvcv::TENSOR_NHWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must have HWC or NHWC layout");
+    }
+    if (inAccess->numChannels() != 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must have a single channel, not %d",
+                              inAccess->numChannels());
+    }
+
+    int  numSamples = inAccess->numSamples();
+    int2 size       = cuda::StaticCast<int>(long2{inAccess->numCols(), inAccess->numRows()});
+
+    if (static_cast<int64_t>(size.x) * size.y >= static_cast<int64_t>(kNoIndex))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input number of pixels per sample is too big");
+    }
+
+    if ((minMaxVal && !minMaxLoc) || (!minMaxVal && minMaxLoc))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output minMaxVal and minMaxLoc must be provided together");
+    }
+    if (!histogram && !minMaxVal && !sum && !sumSq)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "At least one output (histogram, minMaxVal, sum or sumSq) must be chosen");
+    }
+
+    nvcv::Optional<nvcv::TensorDataStridedCuda> maskData, roisData;
+
+    if (mask)
+    {
+        maskData = mask.exportData<nvcv::TensorDataStridedCuda>();
+        if (!maskData)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Mask must be cuda-accessible, pitch-linear tensor");
+        }
+        if (maskData->dtype() != nvcv::TYPE_U8 || maskData->shape() != inData->shape())
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Mask must have U8 data type and the same shape as input");
+        }
+    }
+
+    int numRois = 1;
+
+    if (rois)
+    {
+        roisData = rois.exportData<nvcv::TensorDataStridedCuda>();
+        if (!roisData)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "ROIs must be cuda-accessible, pitch-linear tensor");
+        }
+        if (!((roisData->rank() == 2 && roisData->dtype() == nvcv::TYPE_4S32)
+              || (roisData->rank() == 3 && roisData->dtype() == nvcv::TYPE_S32 && roisData->shape(2) == 4)))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "ROIs must be a rank-2 4S32 or a rank-3 S32 tensor with 4 elements per ROI");
+        }
+        if (roisData->shape(0) != numSamples)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "ROIs number of samples must be the same as input tensor");
+        }
+        if (roisData->stride(1) != static_cast<int64_t>(sizeof(int4)))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "ROIs must be packed per sample");
+        }
+        numRois = static_cast<int>(roisData->shape(1));
+    }
+
+    if (numSamples == 0 || numRois == 0)
+    {
+        return;
+    }
+    if (static_cast<int64_t>(numSamples) * numRois > 65535)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid number of samples times ROIs %d x %d must be in [1, 65535]", numSamples,
+                              numRois);
+    }
+
+    bool hasRois = static_cast<bool>(rois);
+
+    StatsOutputs out{};
+
+    out.hasHistogram = static_cast<bool>(histogram);
+    out.hasMinMax    = static_cast<bool>(minMaxVal);
+    out.hasSum       = static_cast<bool>(sum);
+    out.hasSumSq     = static_cast<bool>(sumSq);
+
+    if (out.hasHistogram)
+    {
+        if (!(histHigh > histLow))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Histogram range [%f, %f) must not be empty", histLow, histHigh);
+        }
+        out.histogram = ExportOutput<int>(histogram, "histogram", nvcv::TYPE_S32, numSamples, numRois, hasRois, -1,
+                                          &out.numBins);
+        out.histLow   = histLow;
+        out.histScale = out.numBins / (histHigh - histLow);
+    }
+    if (out.hasMinMax)
+    {
+        out.minMaxVal = ExportOutput<double>(minMaxVal, "minMaxVal", nvcv::TYPE_F64, numSamples, numRois, hasRois, 2,
+                                             nullptr);
+        out.minMaxKey = ExportOutput<KeyType>(minMaxLoc, "minMaxLoc", nvcv::TYPE_2S32, numSamples, numRois, hasRois,
+                                              2, nullptr);
+    }
+    if (out.hasSum)
+    {
+        out.sum = ExportOutput<double>(sum, "sum", nvcv::TYPE_F64, numSamples, numRois, hasRois, 0, nullptr);
+    }
+    if (out.hasSumSq)
+    {
+        out.sumSq = ExportOutput<double>(sumSq, "sumSq", nvcv::TYPE_F64, numSamples, numRois, hasRois, 0, nullptr);
+    }
+
+    switch (inData->dtype())
+    {
+#define NVCV_CASE_IMAGESTATS(DT, T)                                                                   \
+    case nvcv::TYPE_##DT:                                                                             \
+        RunImageStatsForType<T>(stream, *inData, maskData, roisData, numSamples, numRois, size, out); \
+        break
+
+        NVCV_CASE_IMAGESTATS(U8, uint8_t);
+        NVCV_CASE_IMAGESTATS(U16, uint16_t);
+        NVCV_CASE_IMAGESTATS(S16, int16_t);
+        NVCV_CASE_IMAGESTATS(S32, int32_t);
+        NVCV_CASE_IMAGESTATS(F32, float);
+
+#undef NVCV_CASE_IMAGESTATS
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type %s",
+                              nvcvDataTypeGetName(inData->dtype()));
+    }
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpImageStats.hpp
+ *
+ * @brief Defines the private C++ Class for the ImageStats operation.
+ */
+
+#ifndef CVCUDA_PRIV_IMAGESTATS_HPP
+#define CVCUDA_PRIV_IMAGESTATS_HPP
+
+#include "IOperator.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Tensor.hpp>
+
+namespace cvcuda::priv {
+
+class ImageStats final : public IOperator
+{
+public:
+    explicit ImageStats();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &mask, const nvcv::Tensor &rois,
+                    float histLow, float histHigh, const nvcv::Tensor &histogram, const nvcv::Tensor &minMaxVal,
+                    const nvcv::Tensor &minMaxLoc, const nvcv::Tensor &sum, const nvcv::Tensor &sumSq) const;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_IMAGESTATS_HPP
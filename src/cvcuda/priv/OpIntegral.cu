@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpIntegral.hpp"
+
+#include "IntegralImage.cuh"
+
+#include <cvcuda/cuda_tools/ImageBatchVarShapeWrap.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/util/CheckError.hpp>
+
+namespace {
+
+// Utilities for Integral operator ---------------------------------------------
+
+namespace cuda     = nvcv::cuda;
+namespace integral = cvcuda::priv::integral;
+
+// Input types are U8, U16, S16, S32 and F32, output types are S32, S64, F32 and F64, integer outputs are only
+// allowed for integer inputs
+
+inline int InputTypeIndex(nvcv::DataType dtype)
+{
+    switch (dtype)
+    {
+    case nvcv::TYPE_U8:
+        return 0;
+    case nvcv::TYPE_U16:
+        return 1;
+    case nvcv::TYPE_S16:
+        return 2;
+    case nvcv::TYPE_S32:
+        return 3;
+    case nvcv::TYPE_F32:
+        return 4;
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type %s",
+                              nvcvDataTypeGetName(dtype));
+    }
+}
+
+inline int OutputTypeIndex(nvcv::DataType dtype, nvcv::DataType inType, const char *name)
+{
+    bool floatInput = inType == nvcv::TYPE_F32;
+
+    switch (dtype)
+    {
+    case nvcv::TYPE_S32:
+        if (!floatInput)
+            return 0;
+        break;
+    case nvcv::TYPE_S64:
+        if (!floatInput)
+            return 1;
+        break;
+    case nvcv::TYPE_F32:
+        return 2;
+    case nvcv::TYPE_F64:
+        return 3;
+    default:
+        break;
+    }
+
+    throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid output %s data type %s for input data type %s",
+                          name, nvcvDataTypeGetName(dtype), nvcvDataTypeGetName(inType));
+}
+
+// Run functions in layers -----------------------------------------------------
+
+template<typename T, typename A>
+void RunTensor(cudaStream_t stream, const nvcv::TensorDataStridedCuda &in, const nvcv::TensorDataStridedCuda &out,
+               bool squared, int2 size, int numChannels, int numSamples)
+{
+    auto src = cuda::CreateTensorWrapNHWC<const T>(in);
+    auto dst = cuda::CreateTensorWrapNHWC<A>(out);
+
+    if (squared)
+    {
+        integral::Integrate<true, A>(stream, src, dst, size, numChannels, numSamples);
+    }
+    else
+    {
+        integral::Integrate<false, A>(stream, src, dst, size, numChannels, numSamples);
+    }
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+template<typename T, typename A>
+void RunVarShape(cudaStream_t stream, const nvcv::ImageBatchVarShapeDataStridedCuda &in,
+                 const nvcv::ImageBatchVarShapeDataStridedCuda &out, bool squared, int numChannels)
+{
+    cuda::ImageBatchVarShapeWrapNHWC<const T> src(in, numChannels);
+    cuda::ImageBatchVarShapeWrapNHWC<A>       dst(out, numChannels);
+
+    int2 maxSize{in.maxSize().w, in.maxSize().h};
+
+    if (squared)
+    {
+        integral::Integrate<true, A>(stream, src, dst, maxSize, numChannels, in.numImages());
+    }
+    else
+    {
+        integral::Integrate<false, A>(stream, src, dst, maxSize, numChannels, in.numImages());
+    }
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+// Integer sums are written through unsigned accumulators of the same size, see integral::AccumType
+
+// clang-format off
+
+#define NVCV_INTEGRAL_FUNCS(RUN, T)                                                    \
+    {RUN<T, uint32_t>, RUN<T, uint64_t>, RUN<T, float>, RUN<T, double>}
+
+#define NVCV_INTEGRAL_FLOAT_FUNCS(RUN, T)                                              \
+    {nullptr, nullptr, RUN<T, float>, RUN<T, double>}
+
+// clang-format on
+
+void CheckTensorOutput(const nvcv::TensorDataStridedCuda &out, const char *name, nvcv::TensorLayout layout, int2 size,
+                       int numSamples, int numChannels)
+{
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(out);
+    if (!access || out.layout() != layout)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %s must have the same layout as the input",
+                              name);
+    }
+    if (access->numSamples() != numSamples || access->numChannels() != numChannels
+        || access->numCols() != size.x + 1 || access->numRows() != size.y + 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output %s must have the input shape with one more row and column", name);
+    }
+}
+
+void CheckVarShapeOutput(const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out, const char *name)
+{
+    if (out.numImages() != in.numImages())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output %s must have the same number of images as the input", name);
+    }
+
+    nvcv::ImageFormat format = out.uniqueFormat();
+    if (!format || format.numPlanes() != 1 || format.numChannels() != in.uniqueFormat().numChannels())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output %s images must all have the same format, with the input number of channels",
+                              name);
+    }
+
+    for (int i = 0; i < in.numImages(); ++i)
+    {
+        nvcv::Size2D inSize = in[i].size(), outSize = out[i].size();
+        if (outSize.w != inSize.w + 1 || outSize.h != inSize.h + 1)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output %s image %d must be one row and one column larger than the input", name, i);
+        }
+    }
+}
+
+} // namespace
+
+namespace cvcuda::priv {
+
+Integral::Integral() {}
+
+// Tensor operator -------------------------------------------------------------
+
+void Integral::operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef sum,
+                          nvcv::OptionalTensorConstRef sqsum) const
+{
+    if (!sum && !sqsum)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "At least one output (sum or sqsum) must be chosen");
+    }
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    if (!inAccess || !(inData->layout() == nvcv::TENSOR_HWC || inData->layout() == nvcv::TENSOR_NHWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must have HWC or NHWC layout");
+    }
+
+    int  numSamples  = inAccess->numSamples();
+    int  numChannels = inAccess->numChannels();
+    int2 size{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+
+    if (numChannels < 1 || numChannels > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Number of channels must be between 1 and 4");
+    }
+
+    typedef void (*run_t)(cudaStream_t stream, const nvcv::TensorDataStridedCuda &in,
+                          const nvcv::TensorDataStridedCuda &out, bool squared, int2 size, int numChannels,
+                          int numSamples);
+
+    static const run_t funcs[5][4] = {
+        NVCV_INTEGRAL_FUNCS(RunTensor, uint8_t),  NVCV_INTEGRAL_FUNCS(RunTensor, uint16_t),
+        NVCV_INTEGRAL_FUNCS(RunTensor, int16_t),  NVCV_INTEGRAL_FUNCS(RunTensor, int32_t),
+        NVCV_INTEGRAL_FLOAT_FUNCS(RunTensor, float),
+    };
+
+    int inIdx = InputTypeIndex(inData->dtype());
+
+    // Validate both outputs before any work is submitted
+    nvcv::Optional<nvcv::TensorDataStridedCuda> outData[2];
+    int                                         outIdx[2] = {0, 0};
+    const char                                 *names[2]  = {"sum", "sqsum"};
+
+    for (int i = 0; i < 2; ++i)
+    {
+        nvcv::OptionalTensorConstRef out = i == 0 ? sum : sqsum;
+        if (!out)
+        {
+            continue;
+        }
+
+        outData[i] = out->get().exportData<nvcv::TensorDataStridedCuda>();
+        if (!outData[i])
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output %s must be cuda-accessible, pitch-linear tensor", names[i]);
+        }
+        CheckTensorOutput(*outData[i], names[i], inData->layout(), size, numSamples, numChannels);
+        outIdx[i] = OutputTypeIndex(outData[i]->dtype(), inData->dtype(), names[i]);
+    }
+
+    for (int i = 0; i < 2; ++i)
+    {
+        if (outData[i])
+        {
+            funcs[inIdx][outIdx[i]](stream, *inData, *outData[i], i == 1, size, numChannels, numSamples);
+        }
+    }
+}
+
+// VarShape operator -----------------------------------------------------------
+
+void Integral::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                          nvcv::OptionalImageBatchVarShapeConstRef sum,
+                          nvcv::OptionalImageBatchVarShapeConstRef sqsum) const
+{
+    if (!sum && !sqsum)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "At least one output (sum or sqsum) must be chosen");
+    }
+
+    nvcv::ImageFormat format = in.uniqueFormat();
+    if (!format)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input images must all have the same format");
+    }
+
+    int numChannels = format.numChannels();
+    if (format.numPlanes() != 1 || numChannels < 1 || numChannels > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input images must have a single plane with 1 to 4 interleaved channels");
+    }
+
+    auto inData = in.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be device-accessible, varshape image batch");
+    }
+
+    typedef void (*run_t)(cudaStream_t stream, const nvcv::ImageBatchVarShapeDataStridedCuda &in,
+                          const nvcv::ImageBatchVarShapeDataStridedCuda &out, bool squared, int numChannels);
+
+    static const run_t funcs[5][4] = {
+        NVCV_INTEGRAL_FUNCS(RunVarShape, uint8_t),  NVCV_INTEGRAL_FUNCS(RunVarShape, uint16_t),
+        NVCV_INTEGRAL_FUNCS(RunVarShape, int16_t),  NVCV_INTEGRAL_FUNCS(RunVarShape, int32_t),
+        NVCV_INTEGRAL_FLOAT_FUNCS(RunVarShape, float),
+    };
+
+    nvcv::DataType inType = format.planeDataType(0).channelType(0);
+    int            inIdx  = InputTypeIndex(inType);
+
+    nvcv::Optional<nvcv::ImageBatchVarShapeDataStridedCuda> outData[2];
+    int                                                     outIdx[2] = {0, 0};
+    const char                                             *names[2]  = {"sum", "sqsum"};
+
+    for (int i = 0; i < 2; ++i)
+    {
+        nvcv::OptionalImageBatchVarShapeConstRef out = i == 0 ? sum : sqsum;
+        if (!out)
+        {
+            continue;
+        }
+
+        CheckVarShapeOutput(in, out->get(), names[i]);
+
+        outData[i] = out->get().exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+        if (!outData[i])
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output %s must be device-accessible, varshape image batch", names[i]);
+        }
+        outIdx[i] = OutputTypeIndex(out->get().uniqueFormat().planeDataType(0).channelType(0), inType, names[i]);
+    }
+
+    if (in.numImages() == 0)
+    {
+        return;
+    }
+
+    for (int i = 0; i < 2; ++i)
+    {
+        if (outData[i])
+        {
+            funcs[inIdx][outIdx[i]](stream, *inData, *outData[i], i == 1, numChannels);
+        }
+    }
+}
+
+#undef NVCV_INTEGRAL_FUNCS
+#undef NVCV_INTEGRAL_FLOAT_FUNCS
+
+} // namespace cvcuda::priv
@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpIntegral.hpp
+ *
+ * @brief Defines the private C++ Class for the Integral operation.
+ */
+
+#ifndef CVCUDA_PRIV_INTEGRAL_HPP
+#define CVCUDA_PRIV_INTEGRAL_HPP
+
+#include "IOperator.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+
+namespace cvcuda::priv {
+
+class Integral final : public IOperator
+{
+public:
+    explicit Integral();
+
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef sum,
+                    nvcv::OptionalTensorConstRef sqsum) const;
+
+    void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                    nvcv::OptionalImageBatchVarShapeConstRef sum, nvcv::OptionalImageBatchVarShapeConstRef sqsum) const;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_INTEGRAL_HPP
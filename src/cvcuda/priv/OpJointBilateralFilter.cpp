@@ -17,6 +17,7 @@
 
 #include "OpJointBilateralFilter.hpp"
 
+#include "BilateralGrid.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -115,4 +116,84 @@ void JointBilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBatc
                                                *sigmaSpaceData, borderMode, stream));
 }
 
+void JointBilateralFilter::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &inColor,
+                                      const nvcv::Tensor &out, int diameter, float sigmaColor, float sigmaSpace,
+                                      const NVCVBilateralGridParams &gridParams) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inColorData = inColor.exportData<nvcv::TensorDataStridedCuda>();
+    if (inColorData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "InputColor must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto outData = out.exportData<nvcv::TensorDataStridedCuda>();
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    BilateralGridFilter(stream, m_scratch, *inData, *inColorData, *outData, diameter, sigmaColor, sigmaSpace,
+                        gridParams);
+}
+
+void JointBilateralFilter::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                                      const nvcv::ImageBatchVarShape &inColor, const nvcv::ImageBatchVarShape &out,
+                                      const nvcv::Tensor &diameter, const nvcv::Tensor &sigmaColor,
+                                      const nvcv::Tensor &sigmaSpace, const NVCVBilateralGridParams &gridParams) const
+{
+    auto inData = in.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "in must be a device-accessible, varshape image batch");
+    }
+
+    auto inColorData = inColor.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (inColorData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "inColor must be device-accessible, varshape image batch");
+    }
+
+    auto outData = out.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be device-accessible, varshape image batch");
+    }
+
+    auto diameterData = diameter.exportData<nvcv::TensorDataStridedCuda>();
+    if (diameterData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Diameter must be device-accessible, pitch-linear tensor");
+    }
+
+    auto sigmaColorData = sigmaColor.exportData<nvcv::TensorDataStridedCuda>();
+    if (sigmaColorData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "sigmaColor must be device-accessible, pitch-linear tensor");
+    }
+
+    auto sigmaSpaceData = sigmaSpace.exportData<nvcv::TensorDataStridedCuda>();
+    if (sigmaSpaceData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "sigmaSpace must be device-accessible, pitch-linear tensor");
+    }
+
+    BilateralGridFilter(stream, m_scratch, *inData, *inColorData, *outData, *diameterData, *sigmaColorData,
+                        *sigmaSpaceData, gridParams);
+}
+
 } // namespace cvcuda::priv
@@ -27,6 +27,7 @@
 #include "IOperator.hpp"
 #include "legacy/CvCudaLegacy.h"
 
+#include <cvcuda/util/PerStreamScratch.hpp>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/Tensor.hpp>
 
@@ -46,9 +47,19 @@ public:
                     const nvcv::ImageBatchVarShape &out, const nvcv::Tensor &diameter, const nvcv::Tensor &sigmaColor,
                     const nvcv::Tensor &sigmaSpace, NVCVBorderType borderMode) const;
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &inColor, const nvcv::Tensor &out,
+                    int diameter, float sigmaColor, float sigmaSpace, const NVCVBilateralGridParams &gridParams) const;
+
+    void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &inColor,
+                    const nvcv::ImageBatchVarShape &out, const nvcv::Tensor &diameter, const nvcv::Tensor &sigmaColor,
+                    const nvcv::Tensor &sigmaSpace, const NVCVBilateralGridParams &gridParams) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::JointBilateralFilter>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::JointBilateralFilterVarShape> m_legacyOpVarShape;
+
+    // Bilateral grid memory
+    mutable nvcv::util::PerStreamScratch m_scratch;
 };
 
 } // namespace cvcuda::priv
@@ -23,6 +23,46 @@
 #include <nvcv/Exception.hpp>
 #include <nvcv/util/CheckError.hpp>
 
+namespace {
+
+// Morphologies whose window covers at least this area run as separable van Herk/Gil-Werman passes, smaller windows
+// are faster with the direct legacy kernel
+constexpr int64_t kMinSeparableArea = 25;
+
+bool IsComposite(NVCVMorphologyType morph_type)
+{
+    return morph_type == NVCV_GRADIENT || morph_type == NVCV_TOPHAT || morph_type == NVCV_BLACKHAT;
+}
+
+bool UseSeparable(NVCVMorphologyType morph_type, nvcv::Size2D mask_size, int32_t iteration,
+                  NVCVBorderType borderMode, bool hasWorkspace)
+{
+    if (IsComposite(morph_type))
+    {
+        return true;
+    }
+
+    if (iteration == 0 || mask_size.w * mask_size.h == 1)
+    {
+        return false; // the legacy operator copies the input
+    }
+
+    int64_t w = mask_size.w, h = mask_size.h;
+
+    // Iterated erosions or dilations fold into one larger window with these borders, see OpMorphology.cu
+    if ((morph_type == NVCV_ERODE || morph_type == NVCV_DILATE)
+        && (borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REPLICATE))
+    {
+        w = iteration * (w - 1) + 1;
+        h = iteration * (h - 1) + 1;
+    }
+
+    // A line needs a single pass, a rectangle needs the workspace to hold its horizontal pass
+    return w * h >= kMinSeparableArea && (w == 1 || h == 1 || hasWorkspace);
+}
+
+} // anonymous namespace
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -56,6 +96,42 @@ void Morphology::operator()(cudaStream_t stream, const nvcv::Tensor &in, const n
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Iteration must be >= 0");
     }
 
+    if (mask_size.w == -1 || mask_size.h == -1)
+    {
+        mask_size = nvcv::Size2D{3, 3};
+    }
+    if (mask_size.w < 1 || mask_size.h < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Mask size must be positive or (-1, -1)");
+    }
+
+    anchor.x = anchor.x < 0 ? mask_size.w / 2 : anchor.x;
+    anchor.y = anchor.y < 0 ? mask_size.h / 2 : anchor.y;
+    if (anchor.x >= mask_size.w || anchor.y >= mask_size.h)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Anchor must be inside the mask");
+    }
+
+    if (UseSeparable(morph_type, mask_size, iteration, borderMode, workspace != nullptr))
+    {
+        if (workspace == nullptr)
+        {
+            RunSeparable(stream, *inData, *outData, nullptr, morph_type, mask_size, anchor, iteration, borderMode);
+        }
+        else
+        {
+            auto workspaceData = workspace->get().exportData<nvcv::TensorDataStridedCuda>();
+            if (workspaceData == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Workspace must be cuda-accessible, pitch-linear tensor");
+            }
+            RunSeparable(stream, *inData, *outData, &*workspaceData, morph_type, mask_size, anchor, iteration,
+                         borderMode);
+        }
+        return;
+    }
+
     switch (morph_type)
     {
     case NVCVMorphologyType::NVCV_DILATE:
@@ -0,0 +1,443 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpMorphology.hpp"
+
+#include <cvcuda/cuda_tools/BorderWrap.hpp>
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/MathWrappers.hpp>
+#include <cvcuda/cuda_tools/SaturateCast.hpp>
+#include <cvcuda/cuda_tools/StaticCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <cvcuda/cuda_tools/TypeTraits.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace {
+
+// Utilities for the separable Morphology ---------------------------------------
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+constexpr int kBlockLines    = 32;
+constexpr int kBlockSegments = 4;
+
+// How the last pass of a morphology combines its result with another image of the same shape
+enum class Combine
+{
+    NONE,
+    AUX_MINUS_RESULT,
+    RESULT_MINUS_AUX,
+};
+
+// One 1D erosion (min) or dilation (max) along the x (axis 0) or y (axis 1) image axis
+struct Pass
+{
+    int  axis;
+    bool dilate;
+    int  size;
+    int  anchor;
+};
+
+// An image with the shape of the output: base pointer and strides in bytes
+struct Buffer
+{
+    nvcv::Byte *base;
+    int32_t     sampleStride;
+    int32_t     rowStride;
+};
+
+// A pass bound to the buffers it reads and writes
+struct Step
+{
+    Pass    pass;
+    Buffer  src;
+    Buffer  dst;
+    Combine combine;
+    Buffer  aux;
+};
+
+// CUDA kernels ----------------------------------------------------------------
+
+// Each thread runs the van Herk/Gil-Werman algorithm on a segment of ksize consecutive outputs of one line: the
+// windows of all outputs in the segment contain the pixel at center, so each window reduces to a suffix ending at
+// center and a prefix starting at it.  Suffixes are stashed in the output and combined with the prefixes on a second
+// sweep, which costs 3 min/max per pixel whatever the window size.  Threads along x cover lines, so that column passes
+// are coalesced.
+
+template<typename T, class SrcWrapper>
+__global__ void MorphologyPass(SrcWrapper src, cuda::Tensor3DWrap<T, int32_t> dst,
+                               cuda::Tensor3DWrap<const T, int32_t> aux, int2 size, Pass pass, Combine combine,
+                               cuda::BaseType<T> maxmin)
+{
+    const int line = blockIdx.x * blockDim.x + threadIdx.x;
+    const int seg  = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n    = blockIdx.z;
+
+    const int length   = pass.axis == 0 ? size.x : size.y;
+    const int numLines = pass.axis == 0 ? size.y : size.x;
+    const int start    = seg * pass.size;
+
+    if (line >= numLines || start >= length)
+    {
+        return;
+    }
+
+    const int count  = min(pass.size, length - start);
+    const int center = start - pass.anchor + pass.size - 1;
+
+    auto coord = [&](int p)
+    {
+        return pass.axis == 0 ? int3{p, line, n} : int3{line, p, n};
+    };
+
+    auto reduce = [&](T a, T b)
+    {
+        return pass.dilate ? cuda::max(a, b) : cuda::min(a, b);
+    };
+
+    T acc = cuda::SetAll<T>(maxmin);
+
+    for (int i = pass.size - 1; i >= 0; --i)
+    {
+        acc = reduce(acc, src[coord(center - pass.size + 1 + i)]);
+
+        if (i < count)
+        {
+            int3 c                  = coord(start + i);
+            *dst.ptr(c.z, c.y, c.x) = acc;
+        }
+    }
+
+    acc = cuda::SetAll<T>(maxmin);
+
+    for (int i = 0; i < count; ++i)
+    {
+        acc = reduce(acc, src[coord(center + i)]);
+
+        int3 c   = coord(start + i);
+        T   *out = dst.ptr(c.z, c.y, c.x);
+        T    res = reduce(*out, acc);
+
+        if (combine == Combine::AUX_MINUS_RESULT)
+        {
+            res = cuda::SaturateCast<cuda::BaseType<T>>(cuda::StaticCast<float>(*aux.ptr(c.z, c.y, c.x))
+                                                        - cuda::StaticCast<float>(res));
+        }
+        else if (combine == Combine::RESULT_MINUS_AUX)
+        {
+            res = cuda::SaturateCast<cuda::BaseType<T>>(cuda::StaticCast<float>(res)
+                                                        - cuda::StaticCast<float>(*aux.ptr(c.z, c.y, c.x)));
+        }
+
+        *out = res;
+    }
+}
+
+// Run functions ---------------------------------------------------------------
+
+template<typename T, NVCVBorderType B>
+void RunSteps(cudaStream_t stream, const std::vector<Step> &steps, int3 shape)
+{
+    using BT = cuda::BaseType<T>;
+
+    for (const Step &step : steps)
+    {
+        // Same border value as the legacy kernels, neutral for the min or max
+        BT maxmin = step.pass.dilate ? std::numeric_limits<BT>::min() : std::numeric_limits<BT>::max();
+
+        cuda::Tensor3DWrap<const T, int32_t> srcWrap(step.src.base, step.src.sampleStride, step.src.rowStride);
+        cuda::Tensor3DWrap<T, int32_t>       dstWrap(step.dst.base, step.dst.sampleStride, step.dst.rowStride);
+        cuda::Tensor3DWrap<const T, int32_t> auxWrap(step.aux.base, step.aux.sampleStride, step.aux.rowStride);
+
+        cuda::BorderWrap<decltype(srcWrap), B, false, true, true> src(srcWrap, cuda::SetAll<T>(maxmin), shape.y,
+                                                                      shape.x);
+
+        int length   = step.pass.axis == 0 ? shape.x : shape.y;
+        int numLines = step.pass.axis == 0 ? shape.y : shape.x;
+
+        dim3 block(kBlockLines, kBlockSegments);
+        dim3 grid(util::DivUp(numLines, kBlockLines), util::DivUp(util::DivUp(length, step.pass.size), kBlockSegments),
+                  shape.z);
+
+        MorphologyPass<T><<<grid, block, 0, stream>>>(src, dstWrap, auxWrap, int2{shape.x, shape.y}, step.pass,
+                                                      step.combine, maxmin);
+        NVCV_CHECK_THROW(cudaGetLastError());
+    }
+}
+
+template<typename T>
+void RunTyped(cudaStream_t stream, const std::vector<Step> &steps, int3 shape, NVCVBorderType borderMode)
+{
+    switch (borderMode)
+    {
+#define CVCUDA_MORPH_CASE(BORDERTYPE)                  \
+    case BORDERTYPE:                                   \
+        RunSteps<T, BORDERTYPE>(stream, steps, shape); \
+        break
+
+        CVCUDA_MORPH_CASE(NVCV_BORDER_CONSTANT);
+        CVCUDA_MORPH_CASE(NVCV_BORDER_REPLICATE);
+        CVCUDA_MORPH_CASE(NVCV_BORDER_REFLECT);
+        CVCUDA_MORPH_CASE(NVCV_BORDER_WRAP);
+        CVCUDA_MORPH_CASE(NVCV_BORDER_REFLECT101);
+
+#undef CVCUDA_MORPH_CASE
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid border mode %d",
+                              static_cast<int>(borderMode));
+    }
+}
+
+// Host helpers ----------------------------------------------------------------
+
+Buffer MakeBuffer(const nvcv::TensorDataStridedCuda &data, const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    if (access.sampleStride() * access.numSamples() > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Input or output size exceeds %d. Tensor is too large.",
+                              cuda::TypeTraits<int32_t>::max);
+    }
+    return Buffer{data.basePtr(), static_cast<int32_t>(access.sampleStride()),
+                  static_cast<int32_t>(access.rowStride())};
+}
+
+// Appends the 1D passes of count erosions or dilations by a size.w x size.h rectangle.  With constant (neutral)
+// or replicate borders only the part of a window inside the image matters, so iterations fold into a single larger
+// rectangle, which is then clipped to the image
+void AppendMorph(std::vector<Pass> &passes, bool dilate, nvcv::Size2D size, int2 anchor, int count, bool fold,
+                 int3 shape)
+{
+    if (fold && count > 1)
+    {
+        auto foldAxis = [count](int ksize, int kanchor, int length, int &outSize, int &outAnchor)
+        {
+            int64_t before = std::min<int64_t>(static_cast<int64_t>(count) * kanchor, length - 1);
+            int64_t after  = std::min<int64_t>(static_cast<int64_t>(count) * (ksize - 1 - kanchor), length - 1);
+
+            outSize   = static_cast<int>(before + after + 1);
+            outAnchor = static_cast<int>(before);
+        };
+
+        foldAxis(size.w, anchor.x, shape.x, size.w, anchor.x);
+        foldAxis(size.h, anchor.y, shape.y, size.h, anchor.y);
+        count = 1;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (size.w > 1)
+        {
+            passes.push_back(Pass{0, dilate, size.w, anchor.x});
+        }
+        if (size.h > 1)
+        {
+            passes.push_back(Pass{1, dilate, size.h, anchor.y});
+        }
+    }
+}
+
+// Binds a chain of passes to buffers: the first pass reads the input and passes alternate between target and spare
+// so that the last one writes target
+void AppendChain(std::vector<Step> &steps, std::vector<Pass> passes, const Buffer &in, const Buffer &target,
+                 const Buffer *spare, Combine combine, const Buffer &aux)
+{
+    if (passes.empty())
+    {
+        passes.push_back(Pass{0, false, 1, 0}); // identity
+    }
+
+    const int numPasses = static_cast<int>(passes.size());
+
+    if (numPasses > 1 && spare == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Workspace must be provided for iterations > 1, NVCV_OPEN, NVCV_CLOSE and composite "
+                              "morphology types");
+    }
+
+    Buffer src = in;
+    for (int i = 0; i < numPasses; ++i)
+    {
+        bool   last = i == numPasses - 1;
+        Buffer dst  = (numPasses - 1 - i) % 2 == 0 ? target : *spare;
+
+        steps.push_back(Step{passes[i], src, dst, last ? combine : Combine::NONE, aux});
+        src = dst;
+    }
+}
+
+} // anonymous namespace
+
+namespace cvcuda::priv {
+
+void Morphology::RunSeparable(cudaStream_t stream, const nvcv::TensorDataStridedCuda &inData,
+                              const nvcv::TensorDataStridedCuda &outData,
+                              const nvcv::TensorDataStridedCuda *workspaceData, NVCVMorphologyType morph_type,
+                              nvcv::Size2D mask_size, int2 anchor, int32_t iteration,
+                              NVCVBorderType borderMode) const
+{
+    if (!(inData.layout() == nvcv::TENSOR_NHWC || inData.layout() == nvcv::TENSOR_HWC)
+        || inData.layout() != outData.layout())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output must have the same layout, either NHWC or HWC");
+    }
+
+    if (inData.dtype() != outData.dtype())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output must have the same data type");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    int3 shape{inAccess->numCols(), inAccess->numRows(), inAccess->numSamples()};
+    int  numChannels = inAccess->numChannels();
+
+    auto sameShape = [&](const nvcv::TensorDataAccessStridedImagePlanar &access)
+    {
+        return access.numCols() == shape.x && access.numRows() == shape.y && access.numSamples() == shape.z
+            && access.numChannels() == numChannels;
+    };
+
+    if (!sameShape(*outAccess))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output must have the same shape");
+    }
+
+    Buffer in  = MakeBuffer(inData, *inAccess);
+    Buffer out = MakeBuffer(outData, *outAccess);
+
+    Buffer ws{};
+    if (workspaceData)
+    {
+        auto wsAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*workspaceData);
+        NVCV_ASSERT(wsAccess);
+
+        if (workspaceData->dtype() != inData.dtype() || !sameShape(*wsAccess))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Workspace must have the same shape and data type as the input");
+        }
+        ws = MakeBuffer(*workspaceData, *wsAccess);
+    }
+    const Buffer *spare = workspaceData ? &ws : nullptr;
+
+    typedef void (*run_t)(cudaStream_t stream, const std::vector<Step> &steps, int3 shape, NVCVBorderType borderMode);
+
+    // clang-format off
+    static const run_t funcs[3][4] = {
+        { RunTyped<uint8_t>, 0,  RunTyped<uchar3>,  RunTyped<uchar4>},
+        {RunTyped<uint16_t>, 0, RunTyped<ushort3>, RunTyped<ushort4>},
+        {   RunTyped<float>, 0,  RunTyped<float3>,  RunTyped<float4>},
+    };
+    // clang-format on
+
+    int typeIdx = inData.dtype() == nvcv::TYPE_U8 ? 0 : inData.dtype() == nvcv::TYPE_U16 ? 1
+                : inData.dtype() == nvcv::TYPE_F32 ? 2 : -1;
+
+    if (typeIdx < 0 || numChannels < 1 || numChannels > 4 || funcs[typeIdx][numChannels - 1] == 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be uchar, ushort or float with 1, 3 or 4 interleaved channels");
+    }
+
+    const bool fold = borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REPLICATE;
+
+    std::vector<Step> steps;
+    std::vector<Pass> passes;
+
+    // Kept until all the passes reading the scratch image are submitted
+    std::optional<nvcv::util::PerStreamScratch::Lease> scratchLease;
+
+    switch (morph_type)
+    {
+    case NVCV_ERODE:
+    case NVCV_DILATE:
+        AppendMorph(passes, morph_type == NVCV_DILATE, mask_size, anchor, iteration, fold, shape);
+        AppendChain(steps, passes, in, out, spare, Combine::NONE, in);
+        break;
+
+    case NVCV_OPEN:
+    case NVCV_CLOSE:
+    case NVCV_TOPHAT:
+    case NVCV_BLACKHAT:
+    {
+        // Opening is an erosion followed by a dilation, closing the reverse, repeated for each iteration
+        bool dilateFirst = morph_type == NVCV_CLOSE || morph_type == NVCV_BLACKHAT;
+        for (int i = 0; i < iteration; ++i)
+        {
+            AppendMorph(passes, dilateFirst, mask_size, anchor, 1, fold, shape);
+            AppendMorph(passes, !dilateFirst, mask_size, anchor, 1, fold, shape);
+        }
+
+        Combine combine = morph_type == NVCV_TOPHAT     ? Combine::AUX_MINUS_RESULT
+                        : morph_type == NVCV_BLACKHAT ? Combine::RESULT_MINUS_AUX
+                                                      : Combine::NONE;
+
+        AppendChain(steps, passes, in, out, spare, combine, in);
+        break;
+    }
+
+    case NVCV_GRADIENT:
+    {
+        // The erosion goes to a scratch image while the output serves as its spare, the dilation then subtracts it
+        size_t rowStride = static_cast<size_t>(shape.x) * outAccess->colStride();
+        size_t numBytes  = rowStride * shape.y * shape.z;
+        if (numBytes > static_cast<size_t>(cuda::TypeTraits<int32_t>::max))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Input or output size exceeds %d. Tensor is too large.",
+                                  cuda::TypeTraits<int32_t>::max);
+        }
+
+        scratchLease.emplace(m_scratch.acquire(numBytes, stream));
+
+        Buffer scratch{scratchLease->data<nvcv::Byte>(),
+                       static_cast<int32_t>(rowStride * shape.y), static_cast<int32_t>(rowStride)};
+
+        AppendMorph(passes, false, mask_size, anchor, iteration, fold, shape);
+        AppendChain(steps, passes, in, scratch, &out, Combine::NONE, in);
+
+        passes.clear();
+        AppendMorph(passes, true, mask_size, anchor, iteration, fold, shape);
+        AppendChain(steps, passes, in, out, spare, Combine::RESULT_MINUS_AUX, scratch);
+        break;
+    }
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Wrong morph_type");
+    }
+
+    funcs[typeIdx][numChannels - 1](stream, steps, shape, borderMode);
+}
+
+} // namespace cvcuda::priv
@@ -27,6 +27,7 @@
 #include "IOperator.hpp"
 #include "legacy/CvCudaLegacy.h"
 
+#include <cvcuda/util/PerStreamScratch.hpp>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/Tensor.hpp>
 
@@ -51,6 +52,16 @@ public:
 protected:
     std::unique_ptr<nvcv::legacy::cuda_op::Morphology>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::MorphologyVarShape> m_legacyOpVarShape;
+
+private:
+    // Runs the morphology as 1D van Herk/Gil-Werman passes, whose cost per pixel does not depend on the mask size
+    void RunSeparable(cudaStream_t stream, const nvcv::TensorDataStridedCuda &inData,
+                      const nvcv::TensorDataStridedCuda &outData, const nvcv::TensorDataStridedCuda *workspaceData,
+                      NVCVMorphologyType morph_type, nvcv::Size2D mask_size, int2 anchor, int32_t iteration,
+                      NVCVBorderType borderMode) const;
+
+    // Holds the erosion of NVCV_GRADIENT
+    mutable nvcv::util::PerStreamScratch m_scratch;
 };
 
 } // namespace cvcuda::priv
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpPointwiseChain.hpp"
+
+#include "PointwiseUtil.hpp"
+
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/SaturateCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+namespace {
+
+// Utilities for PointwiseChain operator ---------------------------------------
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+using cvcuda::priv::pointwise::Chain;
+
+constexpr int kBlockWidth  = 32;
+constexpr int kBlockHeight = 8;
+
+// CUDA kernels ----------------------------------------------------------------
+
+// Each thread reads one pixel, runs the whole chain on it in registers and writes it once; channels missing in the
+// input read as zero and the output keeps only its first channels, that way the chain may add or drop channels
+
+template<typename SrcT, typename DstT, bool DstPlanar>
+__global__ void PointwiseChainKernel(cuda::Tensor4DWrap<const SrcT, int32_t> src,
+                                     cuda::Tensor4DWrap<DstT, int32_t> dst, int2 size, int srcC, int dstC,
+                                     const Chain chain)
+{
+    int x = blockIdx.x * blockDim.x + threadIdx.x;
+    int y = blockIdx.y * blockDim.y + threadIdx.y;
+    int n = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+    {
+        return;
+    }
+
+    float4 v{0.f, 0.f, 0.f, 0.f};
+
+    v.x = static_cast<float>(*src.ptr(n, y, x, 0));
+    if (srcC > 1)
+    {
+        v.y = static_cast<float>(*src.ptr(n, y, x, 1));
+    }
+    if (srcC > 2)
+    {
+        v.z = static_cast<float>(*src.ptr(n, y, x, 2));
+    }
+    if (srcC > 3)
+    {
+        v.w = static_cast<float>(*src.ptr(n, y, x, 3));
+    }
+
+    v = cvcuda::priv::pointwise::Apply(chain, v);
+
+    auto store = [&](int c, float value)
+    {
+        if constexpr (DstPlanar)
+        {
+            *dst.ptr(n, c, y, x) = cuda::SaturateCast<DstT>(value);
+        }
+        else
+        {
+            *dst.ptr(n, y, x, c) = cuda::SaturateCast<DstT>(value);
+        }
+    };
+
+    store(0, v.x);
+    if (dstC > 1)
+    {
+        store(1, v.y);
+    }
+    if (dstC > 2)
+    {
+        store(2, v.z);
+    }
+    if (dstC > 3)
+    {
+        store(3, v.w);
+    }
+}
+
+// Run functions ---------------------------------------------------------------
+
+template<typename SrcT, typename DstT>
+inline void RunPointwiseChain(cudaStream_t stream, const nvcv::TensorDataStridedCuda &inData,
+                              const nvcv::TensorDataStridedCuda &outData, bool dstPlanar, int numSamples, int2 size,
+                              int srcC, int dstC, const Chain &chain)
+{
+    auto src = cuda::CreateTensorWrapNHWC<const SrcT, int32_t>(inData);
+
+    dim3 block(kBlockWidth, kBlockHeight);
+    dim3 grid(util::DivUp(size.x, kBlockWidth), util::DivUp(size.y, kBlockHeight), numSamples);
+
+    if (dstPlanar)
+    {
+        auto dst = cuda::CreateTensorWrapNCHW<DstT, int32_t>(outData);
+
+        PointwiseChainKernel<SrcT, DstT, true><<<grid, block, 0, stream>>>(src, dst, size, srcC, dstC, chain);
+    }
+    else
+    {
+        auto dst = cuda::CreateTensorWrapNHWC<DstT, int32_t>(outData);
+
+        PointwiseChainKernel<SrcT, DstT, false><<<grid, block, 0, stream>>>(src, dst, size, srcC, dstC, chain);
+    }
+
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+template<typename SrcT>
+inline void RunPointwiseChainForType(cudaStream_t stream, const nvcv::TensorDataStridedCuda &inData,
+                                     const nvcv::TensorDataStridedCuda &outData, bool dstPlanar, int numSamples,
+                                     int2 size, int srcC, int dstC, const Chain &chain)
+{
+    switch (outData.dtype())
+    {
+#define NVCV_CASE_POINTWISECHAIN(DT, T)                                                                            \
+    case nvcv::TYPE_##DT:                                                                                          \
+        RunPointwiseChain<SrcT, T>(stream, inData, outData, dstPlanar, numSamples, size, srcC, dstC, chain); \
+        break
+
+        NVCV_CASE_POINTWISECHAIN(U8, uint8_t);
+        NVCV_CASE_POINTWISECHAIN(U16, uint16_t);
+        NVCV_CASE_POINTWISECHAIN(S16, int16_t);
+        NVCV_CASE_POINTWISECHAIN(F32, float);
+
+#undef NVCV_CASE_POINTWISECHAIN
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid output data type %s",
+                              nvcvDataTypeGetName(outData.dtype()));
+    }
+}
+
+inline Chain MakeChain(const NVCVPointwiseStep *steps, int32_t numSteps)
+{
+    if (numSteps < 0 || numSteps > cvcuda::priv::pointwise::kMaxSteps)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Number of steps %d must be in [0, %d]",
+                              numSteps, cvcuda::priv::pointwise::kMaxSteps);
+    }
+    if (numSteps > 0 && steps == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Steps must not be NULL when number of steps is %d",
+                              numSteps);
+    }
+
+    Chain chain{};
+    chain.numSteps = numSteps;
+
+    for (int i = 0; i < numSteps; ++i)
+    {
+        const NVCVPointwiseStep &step = steps[i];
+
+        switch (step.type)
+        {
+        case NVCV_POINTWISE_SCALE_SHIFT:
+        case NVCV_POINTWISE_CLAMP:
+        case NVCV_POINTWISE_MATRIX:
+            break;
+
+        case NVCV_POINTWISE_SWIZZLE:
+            for (int c = 0; c < 4; ++c)
+            {
+                if (step.map[c] < 0 || step.map[c] > 3)
+                {
+                    throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                          "Step %d swizzle map[%d] = %d must be in [0, 3]", i, c, step.map[c]);
+                }
+            }
+            break;
+
+        case NVCV_POINTWISE_GAMMA:
+            if (!(step.range > 0.f))
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Step %d gamma range %f must be positive",
+                                      i, step.range);
+            }
+            break;
+
+        default:
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Step %d has invalid type %d", i,
+                                  static_cast<int>(step.type));
+        }
+
+        chain.steps[i] = step;
+    }
+
+    return chain;
+}
+
+} // anonymous namespace
+
+namespace cvcuda::priv {
+
+// Constructor -----------------------------------------------------------------
+
+PointwiseChain::PointwiseChain() {}
+
+// Tensor operator -------------------------------------------------------------
+
+void PointwiseChain::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                const NVCVPointwiseStep *steps, int32_t numSteps) const
+{
+    Chain chain = MakeChain(steps, numSteps);
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+    auto outData = out.exportData<nvcv::TensorDataStridedCuda>();
+    if (!outData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    if (!inAccess || !(inData->layout() == nvcv::TENSOR_HWC || inData->layout() == nvcv::TENSOR_NHWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must have HWC or NHWC layout");
+    }
+
+    bool dstPlanar = outData->layout() == nvcv::TENSOR_CHW || outData->layout() == nvcv::TENSOR_NCHW;
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*outData);
+    if (!outAccess
+        || !(dstPlanar || outData->layout() == nvcv::TENSOR_HWC || outData->layout() == nvcv::TENSOR_NHWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must have HWC, NHWC, CHW or NCHW layout");
+    }
+
+    int srcC = inAccess->numChannels();
+    int dstC = outAccess->numChannels();
+
+    if (srcC < 1 || srcC > 4 || dstC < 1 || dstC > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output number of channels (%d and %d) must be in [1, 4]", srcC, dstC);
+    }
+    if (inAccess->numSamples() != outAccess->numSamples() || inAccess->numCols() != outAccess->numCols()
+        || inAccess->numRows() != outAccess->numRows())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output must have the same number of samples, width and height");
+    }
+    if (inAccess->numSamples() > 65535)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Number of samples %ld must be at most 65535",
+                              inAccess->numSamples());
+    }
+    if (inAccess->sampleStride() * inAccess->numSamples() > cuda::TypeTraits<int32_t>::max
+        || outAccess->sampleStride() * outAccess->numSamples() > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Input or output size exceeds %d. Tensor is too large.",
+                              cuda::TypeTraits<int32_t>::max);
+    }
+
+    int  numSamples = inAccess->numSamples();
+    int2 size{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+
+    if (numSamples == 0 || size.x == 0 || size.y == 0)
+    {
+        return;
+    }
+
+    switch (inData->dtype())
+    {
+#define NVCV_CASE_POINTWISECHAIN(DT, T)                                                                          \
+    case nvcv::TYPE_##DT:                                                                                        \
+        RunPointwiseChainForType<T>(stream, *inData, *outData, dstPlanar, numSamples, size, srcC, dstC, chain); \
+        break
+
+        NVCV_CASE_POINTWISECHAIN(U8, uint8_t);
+        NVCV_CASE_POINTWISECHAIN(U16, uint16_t);
+        NVCV_CASE_POINTWISECHAIN(S16, int16_t);
+        NVCV_CASE_POINTWISECHAIN(F32, float);
+
+#undef NVCV_CASE_POINTWISECHAIN
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type %s",
+                              nvcvDataTypeGetName(inData->dtype()));
+    }
+}
+
+} // namespace cvcuda::priv
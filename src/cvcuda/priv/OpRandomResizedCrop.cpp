@@ -39,7 +39,8 @@ RandomResizedCrop::RandomResizedCrop(double minScale, double maxScale, double mi
 }
 
 void RandomResizedCrop::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
-                                   const NVCVInterpolationType interpolation) const
+                                   const NVCVInterpolationType interpolation, nvcv::OptionalTensorConstRef inCrops,
+                                   nvcv::OptionalTensorConstRef outCrops) const
 {
     auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
     if (inData == nullptr)
@@ -55,13 +56,14 @@ void RandomResizedCrop::operator()(cudaStream_t stream, const nvcv::Tensor &in,
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, interpolation, stream));
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, interpolation, inCrops, outCrops, stream));
 }
 
 void RandomResizedCrop::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
-                                   const nvcv::ImageBatchVarShape &out, const NVCVInterpolationType interpolation) const
+                                   const nvcv::ImageBatchVarShape &out, const NVCVInterpolationType interpolation,
+                                   nvcv::OptionalTensorConstRef inCrops, nvcv::OptionalTensorConstRef outCrops) const
 {
-    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(in, out, interpolation, stream));
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(in, out, interpolation, inCrops, outCrops, stream));
 }
 
 } // namespace cvcuda::priv
@@ -41,10 +41,12 @@ public:
                                uint32_t seed);
 
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
-                    const NVCVInterpolationType interpolation) const;
+                    const NVCVInterpolationType interpolation, nvcv::OptionalTensorConstRef inCrops,
+                    nvcv::OptionalTensorConstRef outCrops) const;
 
     void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out,
-                    const NVCVInterpolationType interpolation) const;
+                    const NVCVInterpolationType interpolation, nvcv::OptionalTensorConstRef inCrops,
+                    nvcv::OptionalTensorConstRef outCrops) const;
 
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::RandomResizedCrop>         m_legacyOp;
@@ -21,6 +21,8 @@
 #include <cvcuda/cuda_tools/InterpolationVarShapeWrap.hpp>
 #include <cvcuda/cuda_tools/InterpolationWrap.hpp>
 #include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/MathWrappers.hpp>
+#include <cvcuda/cuda_tools/SaturateCast.hpp>
 #include <cvcuda/cuda_tools/StaticCast.hpp>
 #include <cvcuda/cuda_tools/TypeTraits.hpp>
 #include <nvcv/DataType.hpp>
@@ -28,8 +30,13 @@
 #include <nvcv/TensorData.hpp>
 #include <nvcv/TensorLayout.hpp>
 #include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
 #include <nvcv/util/Math.hpp>
 
+#include <cuda_fp16.h>
+
+#include <cmath>
+
 namespace cuda = nvcv::cuda;
 namespace util = nvcv::util;
 
@@ -85,6 +92,250 @@ inline NVCVRemapParams __host__ __device__ GetRemapParams(const int2 &srcSize, c
     return params;
 }
 
+// Compact map formats ---------------------------------------------------------
+
+// Besides full float2 maps, the map may be stored in two compact formats.  The fixed-point format stores, per map
+// element, the integer {x, y} position plus a 5-bit fractional index (fy << 5 | fx) in 3 int16 values, the same
+// layout as the classic interleaved int16 pair plus uint16 fractional table map.  The half format stores {x, y}
+// as two half-precision floats, it is meant for normalized values that stay small in magnitude.
+
+enum class MapFormat
+{
+    FLOAT,
+    FIXED_POINT,
+    HALF
+};
+
+constexpr int kMapFracBits = 5;
+constexpr int kMapFracSize = 1 << kMapFracBits;
+constexpr int kMapFracMask = kMapFracSize - 1;
+
+inline MapFormat GetMapFormat(const nvcv::TensorDataStridedCuda &mapData)
+{
+    auto mapAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(mapData);
+    NVCV_ASSERT(mapAccess);
+
+    nvcv::DataType dtype       = mapData.dtype();
+    int            numChannels = mapAccess->numChannels();
+
+    if ((dtype == nvcv::TYPE_2F32 && numChannels == 1) || (dtype == nvcv::TYPE_F32 && numChannels == 2))
+    {
+        return MapFormat::FLOAT;
+    }
+    else if ((dtype == nvcv::TYPE_3S16 && numChannels == 1) || (dtype == nvcv::TYPE_S16 && numChannels == 3))
+    {
+        return MapFormat::FIXED_POINT;
+    }
+    else if ((dtype == nvcv::TYPE_2F16 && numChannels == 1) || (dtype == nvcv::TYPE_F16 && numChannels == 2))
+    {
+        return MapFormat::HALF;
+    }
+
+    throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                          "Remap map input must have 2F32, 3S16 (fixed-point) or 2F16 (half) data type");
+}
+
+inline void ValidateMapFormat(MapFormat mapFormat, NVCVRemapMapValueType mapValueType)
+{
+    if (mapFormat == MapFormat::FIXED_POINT && mapValueType != NVCV_REMAP_ABSOLUTE)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Fixed-point (3S16) remap map requires NVCV_REMAP_ABSOLUTE map value type");
+    }
+    if (mapFormat == MapFormat::HALF && mapValueType == NVCV_REMAP_ABSOLUTE)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Half-precision (2F16) remap map requires a normalized map value type");
+    }
+}
+
+inline __device__ float2 DecodeMapValue(const short3 &v)
+{
+    return float2{v.x + (v.z & kMapFracMask) * (1.f / kMapFracSize),
+                  v.y + ((v.z >> kMapFracBits) & kMapFracMask) * (1.f / kMapFracSize)};
+}
+
+inline __device__ float2 DecodeMapValue(const ushort2 &v)
+{
+    return float2{__half2float(__ushort_as_half(v.x)), __half2float(__ushort_as_half(v.y))};
+}
+
+inline __device__ void EncodeMapValue(float2 &out, const float2 &v)
+{
+    out = v;
+}
+
+inline __device__ void EncodeMapValue(short3 &out, const float2 &v)
+{
+    int x = __float2int_rn(v.x * kMapFracSize);
+    int y = __float2int_rn(v.y * kMapFracSize);
+
+    out.x = cuda::SaturateCast<short>(x >> kMapFracBits);
+    out.y = cuda::SaturateCast<short>(y >> kMapFracBits);
+    out.z = static_cast<short>(((y & kMapFracMask) << kMapFracBits) | (x & kMapFracMask));
+}
+
+// Map wrapper decoding compact map values to float2 on the fly, with the same interpolation as InterpolationWrap
+// applied on the decoded values.
+template<class BorderWrapper, NVCVInterpolationType MI>
+class DecodedMapWrap
+{
+public:
+    explicit __host__ DecodedMapWrap(BorderWrapper borderWrap)
+        : m_borderWrap(borderWrap)
+    {
+    }
+
+    inline __device__ float2 operator[](const float3 &c) const
+    {
+        const int z = static_cast<int>(c.z);
+
+        if constexpr (MI == NVCV_INTERP_NEAREST)
+        {
+            return fetch(cuda::round<cuda::RoundMode::DOWN, int>(c.x + .5f),
+                         cuda::round<cuda::RoundMode::DOWN, int>(c.y + .5f), z);
+        }
+        else if constexpr (MI == NVCV_INTERP_LINEAR)
+        {
+            const int x1 = cuda::round<cuda::RoundMode::DOWN, int>(c.x);
+            const int y1 = cuda::round<cuda::RoundMode::DOWN, int>(c.y);
+            const int x2 = x1 + 1;
+            const int y2 = y1 + 1;
+
+            float2 out = float2{0.f, 0.f};
+
+            out += fetch(x1, y1, z) * (x2 - c.x) * (y2 - c.y);
+            out += fetch(x2, y1, z) * (c.x - x1) * (y2 - c.y);
+            out += fetch(x1, y2, z) * (x2 - c.x) * (c.y - y1);
+            out += fetch(x2, y2, z) * (c.x - x1) * (c.y - y1);
+
+            return out;
+        }
+        else
+        {
+            static_assert(MI == NVCV_INTERP_CUBIC, "Map interpolation must be NEAREST, LINEAR or CUBIC");
+
+            const int ix = cuda::round<cuda::RoundMode::DOWN, int>(c.x);
+            const int iy = cuda::round<cuda::RoundMode::DOWN, int>(c.y);
+
+            float wx[4];
+            cuda::GetCubicCoeffs(c.x - ix, wx[0], wx[1], wx[2], wx[3]);
+            float wy[4];
+            cuda::GetCubicCoeffs(c.y - iy, wy[0], wy[1], wy[2], wy[3]);
+
+            float2 sum = float2{0.f, 0.f};
+
+#pragma unroll
+            for (int cy = -1; cy <= 2; cy++)
+            {
+#pragma unroll
+                for (int cx = -1; cx <= 2; cx++)
+                {
+                    sum += fetch(ix + cx, iy + cy, z) * (wx[cx + 1] * wy[cy + 1]);
+                }
+            }
+
+            return sum;
+        }
+    }
+
+private:
+    inline __device__ float2 fetch(int x, int y, int z) const
+    {
+        return DecodeMapValue(m_borderWrap[int3{x, y, z}]);
+    }
+
+    BorderWrapper m_borderWrap;
+};
+
+// Map model functions ---------------------------------------------------------
+
+// Returns the input position that the model maps the given output position to.
+inline __device__ float2 ApplyRemapModel(const NVCVRemapModel &model, const float2 &p)
+{
+    const float *M = model.matrix;
+
+    if (model.type == NVCV_REMAP_MODEL_PERSPECTIVE)
+    {
+        float w = M[6] * p.x + M[7] * p.y + M[8];
+        w       = (w != 0.f) ? 1.f / w : 0.f;
+
+        return float2{(M[0] * p.x + M[1] * p.y + M[2]) * w, (M[3] * p.x + M[4] * p.y + M[5]) * w};
+    }
+
+    // Lens models: the output pixel is back-projected with the output (new) camera onto the normalized image
+    // plane, distorted by the lens model and projected with the input camera.
+
+    const float *N = model.newCamera;
+    const float *d = model.distortion;
+
+    const float x  = (p.x - N[2]) / N[0];
+    const float y  = (p.y - N[5]) / N[4];
+    const float r2 = x * x + y * y;
+
+    float2 q;
+
+    if (model.type == NVCV_REMAP_MODEL_PINHOLE)
+    {
+        const float kr = 1.f + r2 * (d[0] + r2 * (d[1] + r2 * d[4]));
+
+        q.x = x * kr + 2.f * d[2] * x * y + d[3] * (r2 + 2.f * x * x);
+        q.y = y * kr + d[2] * (r2 + 2.f * y * y) + 2.f * d[3] * x * y;
+    }
+    else
+    {
+        const float r      = sqrtf(r2);
+        const float theta  = atanf(r);
+        const float t2     = theta * theta;
+        const float thetaD = theta * (1.f + t2 * (d[0] + t2 * (d[1] + t2 * (d[2] + t2 * d[3]))));
+        const float scale  = (r > 1e-8f) ? thetaD / r : 1.f;
+
+        q.x = x * scale;
+        q.y = y * scale;
+    }
+
+    return float2{M[0] * q.x + M[1] * q.y + M[2], M[4] * q.y + M[5]};
+}
+
+template<class MapWrapper>
+__global__ void MakeMap(MapWrapper map, int2 mapSize, NVCVRemapModel model)
+{
+    int3 mapCoord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+
+    if (mapCoord.x >= mapSize.x || mapCoord.y >= mapSize.y)
+    {
+        return;
+    }
+
+    float2 value = ApplyRemapModel(model, cuda::StaticCast<float>(int2{mapCoord.x, mapCoord.y}));
+
+    EncodeMapValue(map[mapCoord], value);
+}
+
+inline void InvertMatrix(const float *M, float *inv)
+{
+    double det = (double)M[0] * ((double)M[4] * M[8] - (double)M[5] * M[7])
+               - (double)M[1] * ((double)M[3] * M[8] - (double)M[5] * M[6])
+               + (double)M[2] * ((double)M[3] * M[7] - (double)M[4] * M[6]);
+
+    if (std::abs(det) < 1e-12)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Remap model perspective matrix is singular");
+    }
+
+    double idet = 1.0 / det;
+
+    inv[0] = static_cast<float>(((double)M[4] * M[8] - (double)M[5] * M[7]) * idet);
+    inv[1] = static_cast<float>(((double)M[2] * M[7] - (double)M[1] * M[8]) * idet);
+    inv[2] = static_cast<float>(((double)M[1] * M[5] - (double)M[2] * M[4]) * idet);
+    inv[3] = static_cast<float>(((double)M[5] * M[6] - (double)M[3] * M[8]) * idet);
+    inv[4] = static_cast<float>(((double)M[0] * M[8] - (double)M[2] * M[6]) * idet);
+    inv[5] = static_cast<float>(((double)M[2] * M[3] - (double)M[0] * M[5]) * idet);
+    inv[6] = static_cast<float>(((double)M[3] * M[7] - (double)M[4] * M[6]) * idet);
+    inv[7] = static_cast<float>(((double)M[1] * M[6] - (double)M[0] * M[7]) * idet);
+    inv[8] = static_cast<float>(((double)M[0] * M[4] - (double)M[1] * M[3]) * idet);
+}
+
 // Do remap kernel -------------------------------------------------------------
 
 template<class SrcWrapper, class DstWrapper, class MapWrapper>
@@ -207,9 +458,32 @@ void RunRemap(cudaStream_t stream, const DataStridedCuda &srcData, const DataStr
 
     if (mapAccess->sampleStride() * mapAccess->numSamples() <= cuda::TypeTraits<int32_t>::max)
     {
-        auto map = cuda::CreateInterpolationWrapNHW<const float2, kMapBorderType, MI, int32_t>(mapData);
-        RunRemap<T, B, SI>(stream, srcData, dstData, map, mapValueType, alignCorners, borderValue, mapSize,
-                           mapNumSamples);
+        switch (GetMapFormat(mapData))
+        {
+        case MapFormat::FLOAT:
+        {
+            auto map = cuda::CreateInterpolationWrapNHW<const float2, kMapBorderType, MI, int32_t>(mapData);
+            RunRemap<T, B, SI>(stream, srcData, dstData, map, mapValueType, alignCorners, borderValue, mapSize,
+                               mapNumSamples);
+            break;
+        }
+        case MapFormat::FIXED_POINT:
+        {
+            auto border = cuda::CreateBorderWrapNHW<const short3, kMapBorderType, int32_t>(mapData);
+            DecodedMapWrap<decltype(border), MI> map(border);
+            RunRemap<T, B, SI>(stream, srcData, dstData, map, mapValueType, alignCorners, borderValue, mapSize,
+                               mapNumSamples);
+            break;
+        }
+        case MapFormat::HALF:
+        {
+            auto border = cuda::CreateBorderWrapNHW<const ushort2, kMapBorderType, int32_t>(mapData);
+            DecodedMapWrap<decltype(border), MI> map(border);
+            RunRemap<T, B, SI>(stream, srcData, dstData, map, mapValueType, alignCorners, borderValue, mapSize,
+                               mapNumSamples);
+            break;
+        }
+        }
     }
     else
     {
@@ -381,11 +655,7 @@ void Remap::operator()(cudaStream_t stream, const nvcv::Tensor &src, const nvcv:
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Map must have 1 or N samples equal to input");
     }
 
-    if (!((mapData->dtype() == nvcv::TYPE_2F32 && mapAccess->numChannels() == 1)
-          || (mapData->dtype() == nvcv::TYPE_F32 && mapAccess->numChannels() == 2)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Remap map input must have 2F32 data type");
-    }
+    ValidateMapFormat(GetMapFormat(*mapData), mapValueType);
 
     if (srcData->dtype() != dstData->dtype())
     {
@@ -442,11 +712,7 @@ void Remap::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &src,
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Map must have 1 or N samples equal to input");
     }
 
-    if (!((mapData->dtype() == nvcv::TYPE_2F32 && mapAccess->numChannels() == 1)
-          || (mapData->dtype() == nvcv::TYPE_F32 && mapAccess->numChannels() == 2)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Remap map input must have 2F32 data type");
-    }
+    ValidateMapFormat(GetMapFormat(*mapData), mapValueType);
 
     if (srcData->uniqueFormat() != dstData->uniqueFormat())
     {
@@ -462,4 +728,71 @@ void Remap::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &src,
              borderValue, dstData->uniqueFormat().planeDataType(0));
 }
 
+// Make map --------------------------------------------------------------------
+
+void Remap::makeMap(cudaStream_t stream, const nvcv::Tensor &map, const NVCVRemapModel &model) const
+{
+    auto mapData = map.exportData<nvcv::TensorDataStridedCuda>();
+    if (!mapData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Remap map output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto mapAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*mapData);
+    NVCV_ASSERT(mapAccess);
+
+    MapFormat mapFormat = GetMapFormat(*mapData);
+    if (mapFormat == MapFormat::HALF)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Remap map built from a model must have 2F32 or 3S16 (fixed-point) data type");
+    }
+
+    if (mapAccess->sampleStride() * mapAccess->numSamples() > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Map size exceeds %d. Tensor is too large.",
+                              cuda::TypeTraits<int32_t>::max);
+    }
+
+    NVCVRemapModel devModel = model;
+
+    switch (model.type)
+    {
+    case NVCV_REMAP_MODEL_PERSPECTIVE:
+        if (!model.inverseMap)
+        {
+            InvertMatrix(model.matrix, devModel.matrix);
+        }
+        break;
+    case NVCV_REMAP_MODEL_PINHOLE:
+    case NVCV_REMAP_MODEL_FISHEYE:
+        if (model.newCamera[0] == 0.f || model.newCamera[4] == 0.f)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Remap model output camera must have non-zero focal lengths");
+        }
+        break;
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid remap model type");
+    }
+
+    int2 mapSize = cuda::StaticCast<int>(long2{mapAccess->numCols(), mapAccess->numRows()});
+
+    dim3 block(32, 4, 1);
+    dim3 grid(util::DivUp(mapSize.x, block.x), util::DivUp(mapSize.y, block.y), mapAccess->numSamples());
+
+    if (mapFormat == MapFormat::FLOAT)
+    {
+        auto mapWrap = cuda::CreateTensorWrapNHW<float2, int32_t>(*mapData);
+        MakeMap<<<grid, block, 0, stream>>>(mapWrap, mapSize, devModel);
+    }
+    else
+    {
+        auto mapWrap = cuda::CreateTensorWrapNHW<short3, int32_t>(*mapData);
+        MakeMap<<<grid, block, 0, stream>>>(mapWrap, mapSize, devModel);
+    }
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
 } // namespace cvcuda::priv
@@ -47,6 +47,8 @@ public:
                     const nvcv::Tensor &map, NVCVInterpolationType srcInterp, NVCVInterpolationType mapInterp,
                     NVCVRemapMapValueType mapValueType, bool alignCorners, NVCVBorderType border,
                     float4 borderValue) const;
+
+    void makeMap(cudaStream_t stream, const nvcv::Tensor &map, const NVCVRemapModel &model) const;
 };
 
 } // namespace cvcuda::priv
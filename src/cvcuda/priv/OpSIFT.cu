@@ -17,6 +17,8 @@
 
 #include "OpSIFT.hpp"
 
+#include "PyramidUtil.cuh"
+
 #include <cvcuda/cuda_tools/InterpolationWrap.hpp>
 #include <cvcuda/cuda_tools/MathOps.hpp>
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
@@ -32,8 +34,9 @@
 
 #include <cmath>
 
-namespace cuda = nvcv::cuda;
-namespace util = nvcv::util;
+namespace cuda    = nvcv::cuda;
+namespace util    = nvcv::util;
+namespace pyramid = cvcuda::priv::pyramid;
 
 namespace {
 
@@ -46,15 +49,8 @@ namespace {
         throw nvcv::Exception(nvcv::Status::ERROR_INTERNAL, "Invalid SIFT internal data"); \
     }
 
-constexpr NVCVBorderType        kBorderGauss{NVCV_BORDER_REFLECT101}; // default border for Gaussian operation
-constexpr NVCVBorderType        kBorderInterp{NVCV_BORDER_REPLICATE}; // default border for interpolation
-constexpr NVCVInterpolationType kInterpUp{NVCV_INTERP_LINEAR};        // default interpolation for up scaling
-
-constexpr float kMinSigma              = 0.01f;      // minimum sigma to be used as base sigma
-constexpr float kPrevSigma             = 0.5f;       // previous sigma before base image
-constexpr int   kMaxKernelSize         = 59;         // maximum Gaussian kernel size
-constexpr int2  kBorderSize            = int2{5, 5}; // ignore keypoints close to the border
-constexpr int   kMaxInterpolationSteps = 5;          // max. steps of keypoint interpolation before failure
+constexpr int2 kBorderSize            = int2{5, 5}; // ignore keypoints close to the border
+constexpr int  kMaxInterpolationSteps = 5;          // max. steps of keypoint interpolation before failure
 
 constexpr float kRadiansToDegrees   = 180.f / M_PI;           // convert from radians to degrees
 constexpr float kDegreesToRadians   = M_PI / 180.f;           // convert from degrees to radians
@@ -78,231 +74,14 @@ constexpr int   kDescF32toU8Ratio  = 512;                              // conver
 constexpr int kDescSize          = kDescWidth * kDescWidth * kDescHistBins;                   // desc. size (=128B)
 constexpr int kDescHistTotalBins = (kDescWidth + 2) * (kDescWidth + 2) * (kDescHistBins + 2); // desc. hist. size
 
-// Tensor wrap for LNHWC tensors with C inside its type
-template<typename T>
-using TensorWrapLNHW = cuda::TensorWrap32<T, -1, -1, -1, sizeof(T)>;
-
-// Border wrap for LNHWC tensors using the corresponding tensor wrap
-template<typename T>
-using BorderWrapLNHW = cuda::BorderWrap<TensorWrapLNHW<T>, kBorderGauss, false, false, true, true>;
+// Tensor wrap for LNHWC tensors, as stored in each pyramid level (octave)
+using pyramid::TensorWrapLNHW;
 
 // Tensor wrap for descriptor has 2 compile-time strides: per 128B descriptor and per 1B within descriptor
 using TensorWrapForDescriptor = cuda::TensorWrap32<uint8_t, -1, kDescSize * sizeof(uint8_t), sizeof(uint8_t)>;
 
-// CPU functions ---------------------------------------------------------------
-
-// Function to get a view from a tensor parent data with given shape
-inline __host__ nvcv::Tensor GetViewFrom(const nvcv::TensorDataStridedCuda  &parentData,
-                                         const nvcv::TensorShape::ShapeType &viewShape)
-{
-    // Get tensor data and create a view of it with given shape instead of its original shape
-    NVCVTensorData viewData = parentData.cdata();
-
-    NVCV_ASSERT(viewData.rank == viewShape.rank());
-
-    for (int r = 0; r < viewData.rank; r++)
-    {
-        NVCV_ASSERT(viewData.shape[r] >= viewShape[r]);
-
-        viewData.shape[r] = viewShape[r];
-    }
-
-    return nvcv::TensorWrapData(viewData);
-}
-
-// Function to compute number of octaves for an WxH image with W=width and H=height
-inline __host__ int ComputeNumberOfOctaves(int width, int height)
-{
-    return std::round((std::log2(std::min(width, height))) - 2) + 1;
-}
-
-// Compute Gaussian filter kernel size for a given sigma
-inline __host__ int ComputeGaussianKernelSize(float sigma)
-{
-    return cuda::min(cuda::round<int>(sigma * 8 + 1) | 1, kMaxKernelSize);
-}
-
 // CUDA functions --------------------------------------------------------------
 
-// Direct (no scale) copy a source 3-rank NHW tensor into a destination 4-rank LNHW tensor
-template<class SrcWrapper>
-__global__ void Copy(TensorWrapLNHW<float> dst, SrcWrapper src, int3 srcShape)
-{
-    int3 srcCoord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
-
-    if (srcCoord.x < srcShape.x && srcCoord.y < srcShape.y && srcCoord.z < srcShape.z)
-    {
-        int4 dstCoord{srcCoord.x, srcCoord.y, srcCoord.z, 0};
-
-        dst[dstCoord] = src[srcCoord];
-    }
-}
-
-// Expand (2x upscale) copy a source 3-rank NHW tensor into a destination 4-rank LNHW tensor
-template<class SrcWrapper>
-__global__ void UpCopy(TensorWrapLNHW<float> dst, SrcWrapper src, int3 dstShape)
-{
-    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
-
-    if (coord.x < dstShape.x && coord.y < dstShape.y && coord.z < dstShape.z)
-    {
-        int4   dstCoord{coord.x, coord.y, coord.z, 0};
-        float3 srcCoord{0, 0, (float)coord.z};
-
-        srcCoord.x = (coord.x + .5f) * .5f - .5f;
-        srcCoord.y = (coord.y + .5f) * .5f - .5f;
-
-        dst[dstCoord] = src[srcCoord];
-    }
-}
-
-// Contract (2x downscale) copy a source 4-rank LNHW tensor into a destination 4-rank LNHW tensor
-template<class SrcWrapper>
-__global__ void DownCopy(TensorWrapLNHW<float> dst, SrcWrapper src, int3 dstShape, int srcLayer)
-{
-    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
-
-    if (coord.x < dstShape.x && coord.y < dstShape.y && coord.z < dstShape.z)
-    {
-        int4 dstCoord{coord.x, coord.y, coord.z, 0};
-        int4 srcCoord{coord.x * 2, coord.y * 2, coord.z, srcLayer};
-
-        dst[dstCoord] = src[srcCoord];
-    }
-}
-
-// Compute Gaussian and DoG (Difference of Gaussians) SIFT pyramids of current octave and layer
-template<int BW, int BH>
-__global__ void DoComputePyramids(BorderWrapLNHW<float> prevGauss, TensorWrapLNHW<float> currGauss,
-                                  TensorWrapLNHW<float> currDoG, int3 currShape, int currLayer, int currKernelSize,
-                                  cuda::math::Vector<float, kMaxKernelSize> gaussSepKernel)
-{
-    constexpr int SW = BW + kMaxKernelSize; // block width with kernel maximum support (halo) for Gaussian filtering
-    constexpr int SH = BH + kMaxKernelSize; // block height with kernel maximum support (halo) for Gaussian filtering
-
-    // Based on kMaxKernelSize = 59 and kDataTile = 32x32x1
-    // Registers used: 40
-    // SMEM usage (max. 48KB): 44772 B = ((32 + 59) * (32 + 59)) * 4 + (32 * (32 + 59)) * 4
-    // CMEM usage (max. 4KB): 688 B = 59 * 4 + 4 + 4 + 4 + 4 * 3 + (4 * 3 + 8) * 2 + (4 * 3 + 4 * 2 + 8) + (360)
-
-    __shared__ float gaussInData[SH * SW];  // plain 1D Gaussian input data in shared memory (SMEM)
-    __shared__ float gaussOutData[SH * BW]; // plain 1D Gaussian output (intermediary) data in SMEM
-
-    // Using TensorWrap with compile-time strides for easy multi-dimensional access of Gaussian data in SMEM
-    cuda::TensorWrap32<float, SW * sizeof(float), sizeof(float)> gaussIn(&gaussInData[0]);
-    cuda::TensorWrap32<float, BW * sizeof(float), sizeof(float)> gaussOut(&gaussOutData[0]);
-
-    int half = currKernelSize / 2; // i.e. the halo or support data outside block to compute Gaussian filter
-
-    int2 tc; // thread (local) coordinates to access SMEM data
-    int2 pc; // previous (local) coordinates to access SMEM data (previous of thread)
-    int2 mc; // mirrored (local) coordinates to access SMEM data (mirror of previous)
-
-    int4 gc{0, 0, (int)blockIdx.z, cuda::max(0, currLayer - 1)}; // current (global) coordinates for GMEM data
-
-    float result; // temporary Gaussian filtering result
-
-    // Threads are defined in a 1D block dimension to be just a count of threads to run this kernel
-    // First loop uses all threads reshaping them to 2D to load block with halo from global memory (GMEM) into SMEM
-    for (int ti = threadIdx.x; ti < (BW + half * 2) * (BH + half * 2); ti += blockDim.x)
-    {
-        tc.x = ti % (BW + half * 2);
-        tc.y = ti / (BW + half * 2);
-        gc.x = blockIdx.x * BW - half + tc.x;
-        gc.y = blockIdx.y * BH - half + tc.y;
-
-        // The prevGauss is a border wrap allowing access to halo outside image with proper border treatment
-        gaussIn[tc] = prevGauss[gc];
-    }
-
-    // Second loop runs all threads in 2D to zero out the block with halo in height for intermediary Gaussian output
-    for (int ti = threadIdx.x; ti < BW * (BH + half * 2); ti += blockDim.x)
-    {
-        tc.x = ti % BW;
-        tc.y = ti / BW;
-
-        gaussOut[tc] = 0.f;
-    }
-
-    __syncthreads(); // wait for the input Gaussian data to be loaded and intermediary Gaussian output to be zeroed
-
-    // SIFT Gaussian pyramid has resolution levels as octaves with scale-space layers, where the first octave
-    // only stores one layer as the base image (octave=0, layer=0) and all next octaves do Gaussian filtering.
-    // [ O=0: [ L=0: base image ] O=1: [ L=0: Gaussian of O=0 L=0; L=1: Gaussian of O=1 L=0; ... ]
-    //   O=2: [ L=0: copy of O=1 L=numOctaveLayers; L=1: Gaussian of O=2 L=0; ... ] ... ] <- Gaussian pyramid
-
-    // Third loop runs all threads in 2D to compute block with halo in height with intermediary Gaussian output
-    for (int ti = threadIdx.x; ti < BW * (BH + half * 2); ti += blockDim.x)
-    {
-        tc.x = ti % BW;
-        tc.y = ti / BW;
-        pc.y = tc.y;
-        pc.x = tc.x + half;
-        mc.x = 0;
-        mc.y = tc.y;
-
-        result = gaussIn[pc] * gaussSepKernel[half];
-
-        for (int kx = 0; kx < half; ++kx)
-        {
-            pc.x = tc.x + kx;
-            mc.x = tc.x + 2 * half - kx;
-
-            result += (gaussIn[pc] + gaussIn[mc]) * gaussSepKernel[kx]; // first separable convolution
-        }
-
-        gaussOut[tc] = result;
-    }
-
-    __syncthreads(); // wait for the intermediary (separable) Gaussian filtering output data to be ready
-
-    // SIFT DoG pyramid is the Difference of Gaussians: next layer - current layer; it uses next octave from
-    // the Gaussian pyramid since it stores the base image without Gaussian in its first octave.
-    // [ O=0: [ L=0: DoG of GaussianPyr (O=1 L=1) - (O=1 L=0); L=1: DoG of GaussianPyr (O=1 L=2) - (O=1 L=1); ... ]
-    //   O=1: [ L=0: DoG of GaussianPyr (O=2 L=1) - (O=2 L=0); ... ] ] <- DoG pyramid
-
-    // Fourth loop runs threads in 2D to compute final block of Gaussian filter and DoG
-    for (int ti = threadIdx.x; ti < BW * BH; ti += blockDim.x)
-    {
-        tc.x = ti % BW;
-        tc.y = ti / BW;
-        gc.x = blockIdx.x * BW + tc.x;
-        gc.y = blockIdx.y * BH + tc.y;
-
-        if (gc.x >= currShape.x || gc.y >= currShape.y)
-        {
-            continue;
-        }
-
-        gc.w = currLayer;
-        pc.x = tc.x;
-        pc.y = tc.y + half;
-        mc.x = tc.x;
-        mc.y = 0;
-
-        result = gaussOut[pc] * gaussSepKernel[half];
-
-        for (int ky = 0; ky < half; ++ky)
-        {
-            pc.y = tc.y + ky;
-            mc.y = tc.y + 2 * half - ky;
-
-            result += (gaussOut[pc] + gaussOut[mc]) * gaussSepKernel[ky]; // second separable convolution
-        }
-
-        currGauss[gc] = result;
-
-        if (gc.w > 0)
-        {
-            gc.w -= 1;
-            pc.x = half + tc.x;
-            pc.y = half + tc.y;
-
-            currDoG[gc] = result - gaussIn[pc];
-        }
-    }
-}
-
 // Get adjacent neighbor coordinates of center coordinates and deltas d* with x=col, y=row
 __forceinline__ __device__ int2 adj(const int2 &center, int dRow, int dCol)
 {
@@ -863,6 +642,166 @@ __global__ void DoFindExtrema(cuda::Tensor2DWrap<float4, int32_t> featCoords,
     }
 }
 
+// CPU functions ---------------------------------------------------------------
+
+// Check each output tensor layout, strides, shape and data type and return the maximum capacity of features
+inline int CheckOutputs(const nvcv::Tensor &featCoords, const nvcv::Tensor &featMetadata,
+                        const nvcv::Tensor &featDescriptors, const nvcv::Tensor &numFeatures, int numSamples)
+{
+    auto featCoordsData = featCoords.exportData<nvcv::TensorDataStridedCuda>();
+    if (!featCoordsData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featCoords must be a valid CUDA strided tensor");
+    }
+    if (!((featCoordsData->rank() == 3
+           && ((featCoordsData->dtype() == nvcv::TYPE_F32 && featCoordsData->shape(2) == 4)
+               || (featCoordsData->dtype() == nvcv::TYPE_4F32 && featCoordsData->shape(2) == 1)))
+          || (featCoordsData->rank() == 2 && featCoordsData->dtype() == nvcv::TYPE_4F32)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featCoords must have rank 2 or 3 and 4xF32 or 4F32 data type");
+    }
+    if (featCoordsData->shape(0) != numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featCoords 1st shape must be the same as input tensor number of samples, "
+                              "%d != %d",
+                              (int)featCoordsData->shape(0), numSamples);
+    }
+    if (!(featCoordsData->stride(1) == sizeof(float4)
+              && (featCoordsData->rank() == 3
+                  && ((featCoordsData->dtype() == nvcv::TYPE_F32 && featCoordsData->stride(2) == sizeof(float))
+                      || (featCoordsData->dtype() == nvcv::TYPE_4F32 && featCoordsData->stride(2) == sizeof(float4))))
+          || (featCoordsData->rank() == 2)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featCoords last strides must be packed for 4xF32 data type, stride1=%d",
+                              (int)featCoordsData->stride(1));
+    }
+
+    int maxCapacity = featCoordsData->shape(1);
+
+    auto featMetadataData = featMetadata.exportData<nvcv::TensorDataStridedCuda>();
+    if (!featMetadataData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featMetadata must be a valid CUDA strided tensor");
+    }
+    if (!((featMetadataData->rank() == 3
+           && ((featMetadataData->dtype() == nvcv::TYPE_F32 && featMetadataData->shape(2) == 3)
+               || (featMetadataData->dtype() == nvcv::TYPE_3F32 && featMetadataData->shape(2) == 1)))
+          || (featMetadataData->rank() == 2 && featMetadataData->dtype() == nvcv::TYPE_3F32)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featMetadata must have rank 2 or 3 and 3xF32 or 3F32 data type");
+    }
+    if (featMetadataData->shape(0) != numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featMetadata 1st shape must be the same as input tensor number of samples, "
+                              "%d != %d",
+                              (int)featMetadataData->shape(0), numSamples);
+    }
+    if (featMetadataData->shape(1) != maxCapacity)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featMetadata 2nd shape must be the same across output tensors, %d != %d",
+                              (int)featMetadataData->shape(1), maxCapacity);
+    }
+    if (!(featMetadataData->stride(1) == sizeof(float3)
+              && (featMetadataData->rank() == 3
+                  && ((featMetadataData->dtype() == nvcv::TYPE_F32 && featMetadataData->stride(2) == sizeof(float))
+                      || (featMetadataData->dtype() == nvcv::TYPE_3F32
+                          && featMetadataData->stride(2) == sizeof(float3))))
+          || (featMetadataData->rank() == 2)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featMetadata last strides must be packed for 3xF32 data type, stride1=%d",
+                              (int)featMetadataData->stride(1));
+    }
+
+    auto featDescriptorsData = featDescriptors.exportData<nvcv::TensorDataStridedCuda>();
+    if (!featDescriptorsData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featDescriptors must be a valid CUDA strided tensor");
+    }
+    if (!(featDescriptorsData->rank() == 3 && featDescriptorsData->dtype() == nvcv::TYPE_U8
+          && featDescriptorsData->shape(2) == kDescSize))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featDescriptors must have rank 3, U8 data type and last shape equals %d",
+                              kDescSize);
+    }
+    if (featDescriptorsData->shape(0) != numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featDescriptors 1st shape must be the same as input tensor number of samples, "
+                              "%d != %d",
+                              (int)featDescriptorsData->shape(0), numSamples);
+    }
+    if (featDescriptorsData->shape(1) != maxCapacity)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featDescriptors 2nd shape must be the same across output tensors, %d != %d",
+                              (int)featDescriptorsData->shape(1), maxCapacity);
+    }
+    if (!(featDescriptorsData->stride(2) == sizeof(uint8_t)
+          && featDescriptorsData->stride(1) == kDescSize * sizeof(uint8_t)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output featDescriptors last strides must be packed with 128 U8 data type, "
+                              "stride1=%d stride2=%d",
+                              (int)featDescriptorsData->stride(1), (int)featDescriptorsData->stride(2));
+    }
+
+    auto numFeaturesData = numFeatures.exportData<nvcv::TensorDataStridedCuda>();
+    if (!numFeaturesData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output numFeatures must be a valid CUDA strided tensor");
+    }
+    if (!(numFeaturesData->dtype() == nvcv::TYPE_S32
+          && ((numFeaturesData->rank() == 2 && numFeaturesData->shape(1) == 1) || (numFeaturesData->rank() == 1))))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output numFeatures must have rank 1 or 2 and 1xS32 or S32 data type");
+    }
+    if (numFeaturesData->shape(0) != numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output numFeatures 1st shape must be the same as input tensor number of samples, "
+                              "%d != %d",
+                              (int)numFeaturesData->shape(0), numSamples);
+    }
+    if (!(numFeaturesData->stride(0) == sizeof(int)
+          && ((numFeaturesData->rank() == 2 && numFeaturesData->stride(1) == sizeof(int))
+              || (numFeaturesData->rank() == 1))))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output numFeatures last strides must be packed for 1xS32 data type, stride0=%d",
+                              (int)numFeaturesData->stride(0));
+    }
+
+    return maxCapacity;
+}
+
+// Check feature thresholds used to find extrema are valid
+inline void CheckThresholds(float contrastThreshold, float edgeThreshold)
+{
+    if (contrastThreshold <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Argument contrastThreshold=%f must be positive",
+                              contrastThreshold);
+    }
+    if (edgeThreshold <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Argument edgeThreshold=%f must be positive",
+                              edgeThreshold);
+    }
+}
+
 } // anonymous namespace
 
 namespace cvcuda::priv {
@@ -871,7 +810,7 @@ namespace cvcuda::priv {
 
 // Find SIFT features as extrema keypoints and compute their metadata, DT is the input data type
 template<typename DT>
-void SIFT::FindExtrema(const nvcv::TensorDataStridedCuda &featCoordsData,
+void SIFT::FindExtrema(const PyramidType &pyramidGaussian, const nvcv::TensorDataStridedCuda &featCoordsData,
                        const nvcv::TensorDataStridedCuda &featMetadataData,
                        const nvcv::TensorDataStridedCuda &featDescriptorsData, int maxCapacity,
                        const nvcv::TensorDataStridedCuda &numFeaturesData, int3 currShape, int firstOctave,
@@ -881,6 +820,9 @@ void SIFT::FindExtrema(const nvcv::TensorDataStridedCuda &featCoordsData,
     constexpr int BW = 32; // data block tile width handled by find extrema kernel
     constexpr int BH = 4;  // data block tile height handled by find extrema kernel
 
+    NVCV_ASSERT(numOctaves <= (int)pyramidGaussian.size());
+    NVCV_ASSERT(numOctaves <= (int)m_runPyramidDoG.size());
+
     // Computational block of threads and grid of blocks used by find extrema (1) and compute descriptors (2) kernels
     dim3 compThreads1{128, 1, 1};
     dim3 compThreads2{256, 1, 1};
@@ -899,10 +841,10 @@ void SIFT::FindExtrema(const nvcv::TensorDataStridedCuda &featCoordsData,
 
     for (int octave = 0; octave < numOctaves; octave++)
     {
-        // The Gaussian pyramid stores at octave=0 the base (potentially expanded) input image, that is why the
-        // current Gaussian data is shifted by 1 while DoG (Difference of Gaussians) data is not
+        // The Gaussian pyramid may be the internal run-time pyramid or a pre-built one, while the DoG (Difference of
+        // Gaussians) pyramid is always the internal one
 
-        auto currGaussData = m_runPyramidGaussian[octave + 1].exportData<nvcv::TensorDataStridedCuda>();
+        auto currGaussData = pyramidGaussian[octave].exportData<nvcv::TensorDataStridedCuda>();
         CVCUDA_SIFT_INTERNAL_DATA_CHECK(currGaussData);
 
         auto currDoGData = m_runPyramidDoG[octave].exportData<nvcv::TensorDataStridedCuda>();
@@ -934,142 +876,6 @@ void SIFT::FindExtrema(const nvcv::TensorDataStridedCuda &featCoordsData,
     }
 }
 
-// Compute run-time pyramids, DT is the input data type
-template<typename DT>
-void SIFT::ComputePyramids(const nvcv::TensorDataStridedCuda &inData, int3 currShape, bool expandInput, int numOctaves,
-                           int numOctaveLayers, float initSigma, cudaStream_t stream) const
-{
-    constexpr int BW = 32; // data block tile width in shared memory (smem) used by compute pyramids kernel
-    constexpr int BH = 32; // data block tile height in shared memory (smem) used by compute pyramids kernel
-
-    // Block of threads and grid of blocks used by copy and compute pyramid kernels
-    dim3 copyThreads{256, 1, 1};
-    dim3 copyBlocks(util::DivUp(currShape.x, copyThreads.x), currShape.y, currShape.z);
-
-    dim3 compThreads{256, 1, 1};
-    dim3 compBlocks;
-
-    NVCV_ASSERT((numOctaves + 1) <= (int)m_runPyramidGaussian.size());
-    NVCV_ASSERT(numOctaves <= (int)m_runPyramidDoG.size());
-
-    // Copy inData into base Gaussian pyramid (octave=0), casting from U8 to F32 (and potentially upscaling it)
-
-    auto dstBaseData = m_runPyramidGaussian[0].exportData<nvcv::TensorDataStridedCuda>();
-    CVCUDA_SIFT_INTERNAL_DATA_CHECK(dstBaseData);
-
-    TensorWrapLNHW<float> dstBaseWrap(*dstBaseData);
-
-    if (expandInput)
-    {
-        auto srcBaseWrap = cuda::CreateInterpolationWrapNHW<const DT, kBorderInterp, kInterpUp, int32_t>(inData);
-
-        UpCopy<<<copyBlocks, copyThreads, 0, stream>>>(dstBaseWrap, srcBaseWrap, currShape); // upscale copy
-    }
-    else
-    {
-        auto srcBaseWrap = cuda::CreateTensorWrapNHW<const DT, int32_t>(inData);
-
-        Copy<<<copyBlocks, copyThreads, 0, stream>>>(dstBaseWrap, srcBaseWrap, currShape); // direct copy
-    }
-
-    // Set sigma scale, current and base sigma for Gaussian filter kernel computation
-
-    int   sigmaScale = (expandInput ? 4 : 1); // due to source scaled up by 2x in each dimension
-    float currSigma  = cuda::sqrt(cuda::max(initSigma * initSigma - kPrevSigma * kPrevSigma * sigmaScale, kMinSigma));
-    float baseSigma  = cuda::pow(2.f, 1.f / numOctaveLayers);
-
-    cuda::math::Vector<float, kMaxKernelSize> gaussSepKernel; // separable Gaussian filter kernel
-
-    for (int octave = 0; octave < numOctaves; octave++)
-    {
-        if (octave > 0)
-        {
-            currSigma = initSigma; // for every octave after first, the current sigma is the initial sigma
-        }
-
-        // Set previous and current octave Gaussian and DoG (Difference of Gaussians) pyramid data
-
-        auto prevGaussData = m_runPyramidGaussian[octave].exportData<nvcv::TensorDataStridedCuda>();
-        CVCUDA_SIFT_INTERNAL_DATA_CHECK(prevGaussData);
-
-        auto currGaussData = m_runPyramidGaussian[octave + 1].exportData<nvcv::TensorDataStridedCuda>();
-        CVCUDA_SIFT_INTERNAL_DATA_CHECK(currGaussData);
-
-        auto currDoGData = m_runPyramidDoG[octave].exportData<nvcv::TensorDataStridedCuda>();
-        CVCUDA_SIFT_INTERNAL_DATA_CHECK(currDoGData);
-
-        // Using BorderWrap (BW) when border handling is needed and TensorWrap (TW) when not
-
-        TensorWrapLNHW<float> prevGaussTW(*prevGaussData);
-        TensorWrapLNHW<float> currGaussTW(*currGaussData);
-        BorderWrapLNHW<float> prevGaussBW(*prevGaussData);
-        BorderWrapLNHW<float> currGaussBW(*currGaussData);
-        TensorWrapLNHW<float> currDoGTW(*currDoGData);
-
-        copyBlocks = dim3(util::DivUp(currShape.x, copyThreads.x), currShape.y, currShape.z);
-        compBlocks = dim3(util::DivUp(currShape.x, BW), util::DivUp(currShape.y, BH), currShape.z);
-
-        // For each layer up to numOctaveLayers +3 to have +1 for DoG and +2 for top/bottom neihbors
-        for (int layer = 0; layer < numOctaveLayers + 3; layer++)
-        {
-            if (layer == 0 && octave > 0)
-            {
-                // First layer of every octave after first skips Gaussian blur and does only a downscale copy
-                DownCopy<<<copyBlocks, copyThreads, 0, stream>>>(currGaussTW, prevGaussTW, currShape, numOctaveLayers);
-            }
-            else
-            {
-                if (layer > 0)
-                {
-                    // Update current sigma for every layer after the first
-                    float prevSigma  = cuda::pow(baseSigma, (float)(layer - 1)) * initSigma;
-                    float totalSigma = baseSigma * prevSigma;
-                    currSigma        = std::sqrt(totalSigma * totalSigma - prevSigma * prevSigma);
-                }
-
-                // Compute the separable Gaussian filter kernel for the Gaussian pyramid
-                int   ksize = ComputeGaussianKernelSize(currSigma);
-                int   half  = ksize / 2;
-                float ss2   = currSigma * currSigma * 2;
-                float sp2   = currSigma * cuda::sqrt(M_PI * 2);
-                float sum   = 0.f;
-
-                for (int kx = -half; kx <= half; ++kx)
-                {
-                    // Compute separable Gaussian function value using its half-equation
-                    float w = cuda::exp(-((kx * kx) / ss2)) / sp2;
-
-                    sum += w;
-
-                    gaussSepKernel[half + kx] = w;
-                }
-                for (int kx = -half; kx <= half; ++kx)
-                {
-                    gaussSepKernel[half + kx] /= sum;
-                }
-
-                // Run the DoComputePyramids kernel to compute the Gaussian and DoG pyramids
-
-                if (octave == 0 && layer == 0)
-                {
-                    // Only for the first octave and first layer the base level previous Gaussian data is used
-                    DoComputePyramids<BW, BH><<<compBlocks, compThreads, 0, stream>>>(
-                        prevGaussBW, currGaussTW, currDoGTW, currShape, layer, ksize, gaussSepKernel);
-                }
-                else
-                {
-                    // For every other octave and layer the current Gaussian data (border-aware) is used
-                    DoComputePyramids<BW, BH><<<compBlocks, compThreads, 0, stream>>>(
-                        currGaussBW, currGaussTW, currDoGTW, currShape, layer, ksize, gaussSepKernel);
-                }
-            }
-        }
-
-        currShape.x /= 2;
-        currShape.y /= 2;
-    }
-}
-
 // Reshape payload-time maxPyramids to submit (or execution) time runPyramids
 void SIFT::ReshapePyramids(const int3 &inShape, int numOctaves, int numOctaveLayers) const
 {
@@ -1078,8 +884,7 @@ void SIFT::ReshapePyramids(const int3 &inShape, int numOctaves, int numOctaveLay
     nvcv::TensorShape::ShapeType shapeDoG{numOctaveLayers + 2, inShape.z, inShape.y, inShape.x, 1};
     nvcv::TensorShape::ShapeType shapeBase({1, inShape.z, inShape.y, inShape.x, 1});
 
-    NVCV_ASSERT((numOctaves + 1) <= (int)m_maxPyramidGaussian.size());
-    NVCV_ASSERT((numOctaves + 1) <= (int)m_runPyramidGaussian.size());
+    NVCV_ASSERT(numOctaves <= (int)m_maxPyramidGaussian.size());
     NVCV_ASSERT(numOctaves <= (int)m_maxPyramidDoG.size());
     NVCV_ASSERT(numOctaves <= (int)m_runPyramidDoG.size());
 
@@ -1088,23 +893,25 @@ void SIFT::ReshapePyramids(const int3 &inShape, int numOctaves, int numOctaveLay
     // view, which also does not deallocate the parent tensor since maxPyramid holds it.
 
     {
-        auto gpData = m_maxPyramidGaussian[0].exportData<nvcv::TensorDataStridedCuda>();
-        CVCUDA_SIFT_INTERNAL_DATA_CHECK(gpData);
+        auto baseData = m_maxBase.exportData<nvcv::TensorDataStridedCuda>();
+        CVCUDA_SIFT_INTERNAL_DATA_CHECK(baseData);
 
-        m_runPyramidGaussian[0] = GetViewFrom(*gpData, shapeBase);
+        m_runBase = pyramid::GetViewFrom(*baseData, shapeBase);
     }
 
+    m_runPyramidGaussian.resize(numOctaves);
+
     for (int octave = 0; octave < numOctaves; octave++)
     {
-        auto gpData = m_maxPyramidGaussian[octave + 1].exportData<nvcv::TensorDataStridedCuda>();
+        auto gpData = m_maxPyramidGaussian[octave].exportData<nvcv::TensorDataStridedCuda>();
         CVCUDA_SIFT_INTERNAL_DATA_CHECK(gpData);
 
-        m_runPyramidGaussian[octave + 1] = GetViewFrom(*gpData, shapeGaussian);
+        m_runPyramidGaussian[octave] = pyramid::GetViewFrom(*gpData, shapeGaussian);
 
         auto dogData = m_maxPyramidDoG[octave].exportData<nvcv::TensorDataStridedCuda>();
         CVCUDA_SIFT_INTERNAL_DATA_CHECK(dogData);
 
-        m_runPyramidDoG[octave] = GetViewFrom(*dogData, shapeDoG);
+        m_runPyramidDoG[octave] = pyramid::GetViewFrom(*dogData, shapeDoG);
 
         shapeGaussian[2] /= 2;
         shapeGaussian[3] /= 2;
@@ -1116,37 +923,31 @@ void SIFT::ReshapePyramids(const int3 &inShape, int numOctaves, int numOctaveLay
 // Allocate (create) the initial SIFT pyramids for maximum shape (run-time is null) (done on operator constructor)
 void SIFT::CreatePyramids()
 {
-    // Tensor LNHWC layout lives within an octave and has L octave levels each of which with NHWC tensors
-    constexpr nvcv::TensorLayout TENSOR_LNHWC(NVCVTensorLayout{"LNHWC", 5});
-
     // Create shapes converting from int3=WHN and L=octaveLayers to LNHWC tensor shapes
 
     // Gaussian pyramid with maxOctaveLayers +3 to have +1 for DoG and +2 for top/bottom neighbors
     // DoG pyramid with maxOctaveLayers +2 for top/bottom neighbors
-    // Base level pyramid with 1 layer to store original image (potentially expanded)
+    // Base level with 1 layer to store original image (potentially expanded)
 
     nvcv::TensorShape::ShapeType shapeGaussian{m_maxOctaveLayers + 3, m_maxShape.z, m_maxShape.y, m_maxShape.x, 1};
     nvcv::TensorShape::ShapeType shapeDoG{m_maxOctaveLayers + 2, m_maxShape.z, m_maxShape.y, m_maxShape.x, 1};
     nvcv::TensorShape::ShapeType shapeBase({1, m_maxShape.z, m_maxShape.y, m_maxShape.x, 1});
 
-    // Gaussian pyramid has +1 in octaves to have original base image (potentially expanded) at octave=0
+    m_maxBase = nvcv::Tensor(nvcv::TensorShape{shapeBase, pyramid::TENSOR_LNHWC}, nvcv::TYPE_F32);
 
-    m_maxPyramidGaussian.reserve(m_maxOctaves + 1);
-    m_runPyramidGaussian.reserve(m_maxOctaves + 1);
+    m_maxPyramidGaussian.reserve(m_maxOctaves);
+    m_runPyramidGaussian.reserve(m_maxOctaves);
     m_maxPyramidDoG.reserve(m_maxOctaves);
     m_runPyramidDoG.reserve(m_maxOctaves);
 
     // runPyramids store null tensors as they will be replaced by a view of maxPyramids tensors later on
 
-    m_maxPyramidGaussian.emplace_back(nvcv::TensorShape{shapeBase, TENSOR_LNHWC}, nvcv::TYPE_F32);
-    m_runPyramidGaussian.emplace_back(nvcv::Tensor{});
-
     for (int octave = 0; octave < m_maxOctaves; octave++)
     {
-        m_maxPyramidGaussian.emplace_back(nvcv::TensorShape{shapeGaussian, TENSOR_LNHWC}, nvcv::TYPE_F32);
+        m_maxPyramidGaussian.emplace_back(nvcv::TensorShape{shapeGaussian, pyramid::TENSOR_LNHWC}, nvcv::TYPE_F32);
         m_runPyramidGaussian.emplace_back(nvcv::Tensor{});
 
-        m_maxPyramidDoG.emplace_back(nvcv::TensorShape{shapeDoG, TENSOR_LNHWC}, nvcv::TYPE_F32);
+        m_maxPyramidDoG.emplace_back(nvcv::TensorShape{shapeDoG, pyramid::TENSOR_LNHWC}, nvcv::TYPE_F32);
         m_runPyramidDoG.emplace_back(nvcv::Tensor{});
 
         shapeGaussian[2] /= 2;
@@ -1160,7 +961,7 @@ void SIFT::CreatePyramids()
 
 SIFT::SIFT(int3 maxShape, int maxOctaveLayers)
     : m_maxShape{maxShape}
-    , m_maxOctaves{ComputeNumberOfOctaves(maxShape.x, maxShape.y)}
+    , m_maxOctaves{pyramid::ComputeNumberOfOctaves(maxShape.x, maxShape.y)}
     , m_maxOctaveLayers{maxOctaveLayers}
 {
     if (maxShape.x < 2 || maxShape.y < 2 || maxShape.z < 1 || maxShape.z > 65535)
@@ -1170,10 +971,11 @@ SIFT::SIFT(int3 maxShape, int maxOctaveLayers)
                               "[1, 65535]",
                               maxShape.x, maxShape.y, maxShape.z);
     }
-    if (maxOctaveLayers < 1 || maxOctaveLayers > 16)
+    if (maxOctaveLayers < 1 || maxOctaveLayers > pyramid::kMaxScales)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Operator constructor arg. maxOctaveLayers=%d must be in [1, 16]", maxOctaveLayers);
+                              "Operator constructor arg. maxOctaveLayers=%d must be in [1, %d]", maxOctaveLayers,
+                              pyramid::kMaxScales);
     }
 
     CreatePyramids();
@@ -1229,7 +1031,7 @@ void SIFT::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::T
         inShape.y *= 2;
     }
 
-    int numOctaves  = ComputeNumberOfOctaves(inShape.x, inShape.y);
+    int numOctaves  = pyramid::ComputeNumberOfOctaves(inShape.x, inShape.y);
     int firstOctave = expandInput ? -1 : 0;
 
     if (inShape.x < 2 || inShape.y < 2 || inShape.z < 1 || inShape.x > m_maxShape.x || inShape.y > m_maxShape.y
@@ -1246,16 +1048,7 @@ void SIFT::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::T
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Operator call arg. initSigma=%f must be positive",
                               initSigma);
     }
-    if (contrastThreshold <= 0)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Argument contrastThreshold=%f must be positive",
-                              contrastThreshold);
-    }
-    if (edgeThreshold <= 0)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Argument edgeThreshold=%f must be positive",
-                              edgeThreshold);
-    }
+    CheckThresholds(contrastThreshold, edgeThreshold);
 
     if (numOctaveLayers < 1 || numOctaveLayers > m_maxOctaveLayers)
     {
@@ -1264,153 +1057,83 @@ void SIFT::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::T
                               m_maxOctaveLayers);
     }
 
-    auto featCoordsData = featCoords.exportData<nvcv::TensorDataStridedCuda>();
-    if (!featCoordsData)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featCoords must be a valid CUDA strided tensor");
-    }
-    if (!((featCoordsData->rank() == 3
-           && ((featCoordsData->dtype() == nvcv::TYPE_F32 && featCoordsData->shape(2) == 4)
-               || (featCoordsData->dtype() == nvcv::TYPE_4F32 && featCoordsData->shape(2) == 1)))
-          || (featCoordsData->rank() == 2 && featCoordsData->dtype() == nvcv::TYPE_4F32)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featCoords must have rank 2 or 3 and 4xF32 or 4F32 data type");
-    }
-    if (featCoordsData->shape(0) != inShape.z)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featCoords 1st shape must be the same as input tensor number of samples, "
-                              "%d != %d",
-                              (int)featCoordsData->shape(0), inShape.z);
-    }
-    if (!(featCoordsData->stride(1) == sizeof(float4)
-              && (featCoordsData->rank() == 3
-                  && ((featCoordsData->dtype() == nvcv::TYPE_F32 && featCoordsData->stride(2) == sizeof(float))
-                      || (featCoordsData->dtype() == nvcv::TYPE_4F32 && featCoordsData->stride(2) == sizeof(float4))))
-          || (featCoordsData->rank() == 2)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featCoords last strides must be packed for 4xF32 data type, stride1=%d",
-                              (int)featCoordsData->stride(1));
-    }
 
-    int maxCapacity = featCoordsData->shape(1);
+    int maxCapacity = CheckOutputs(featCoords, featMetadata, featDescriptors, numFeatures, inShape.z);
 
-    auto featMetadataData = featMetadata.exportData<nvcv::TensorDataStridedCuda>();
-    if (!featMetadataData)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featMetadata must be a valid CUDA strided tensor");
-    }
-    if (!((featMetadataData->rank() == 3
-           && ((featMetadataData->dtype() == nvcv::TYPE_F32 && featMetadataData->shape(2) == 3)
-               || (featMetadataData->dtype() == nvcv::TYPE_3F32 && featMetadataData->shape(2) == 1)))
-          || (featMetadataData->rank() == 2 && featMetadataData->dtype() == nvcv::TYPE_3F32)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featMetadata must have rank 2 or 3 and 3xF32 or 3F32 data type");
-    }
-    if (featMetadataData->shape(0) != inShape.z)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featMetadata 1st shape must be the same as input tensor number of samples, "
-                              "%d != %d",
-                              (int)featMetadataData->shape(0), inShape.z);
-    }
-    if (featMetadataData->shape(1) != maxCapacity)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featMetadata 2nd shape must be the same across output tensors, %d != %d",
-                              (int)featMetadataData->shape(1), maxCapacity);
-    }
-    if (!(featMetadataData->stride(1) == sizeof(float3)
-              && (featMetadataData->rank() == 3
-                  && ((featMetadataData->dtype() == nvcv::TYPE_F32 && featMetadataData->stride(2) == sizeof(float))
-                      || (featMetadataData->dtype() == nvcv::TYPE_3F32
-                          && featMetadataData->stride(2) == sizeof(float3))))
-          || (featMetadataData->rank() == 2)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featMetadata last strides must be packed for 3xF32 data type, stride1=%d",
-                              (int)featMetadataData->stride(1));
-    }
+    // The only supported data type is U8, hence uint8_t in DT templates below.
+    // After all checkings are done, the input and output tensors can be used in executing the operator.
+    // First reshape the pyramids, then compute them and, finally, find extrema points, i.e. features.
 
-    auto featDescriptorsData = featDescriptors.exportData<nvcv::TensorDataStridedCuda>();
-    if (!featDescriptorsData)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featDescriptors must be a valid CUDA strided tensor");
-    }
-    if (!(featDescriptorsData->rank() == 3 && featDescriptorsData->dtype() == nvcv::TYPE_U8
-          && featDescriptorsData->shape(2) == kDescSize))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featDescriptors must have rank 3, U8 data type and last shape equals %d",
-                              kDescSize);
-    }
-    if (featDescriptorsData->shape(0) != inShape.z)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featDescriptors 1st shape must be the same as input tensor number of samples, "
-                              "%d != %d",
-                              (int)featDescriptorsData->shape(0), inShape.z);
-    }
-    if (featDescriptorsData->shape(1) != maxCapacity)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featDescriptors 2nd shape must be the same across output tensors, %d != %d",
-                              (int)featDescriptorsData->shape(1), maxCapacity);
-    }
-    if (!(featDescriptorsData->stride(2) == sizeof(uint8_t)
-          && featDescriptorsData->stride(1) == kDescSize * sizeof(uint8_t)))
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output featDescriptors last strides must be packed with 128 U8 data type, "
-                              "stride1=%d stride2=%d",
-                              (int)featDescriptorsData->stride(1), (int)featDescriptorsData->stride(2));
-    }
+    ReshapePyramids(inShape, numOctaves, numOctaveLayers);
 
-    auto numFeaturesData = numFeatures.exportData<nvcv::TensorDataStridedCuda>();
-    if (!numFeaturesData)
+    pyramid::ComputeGaussianPyramid<uint8_t>(*inData, m_runBase, m_runPyramidGaussian, &m_runPyramidDoG, inShape,
+                                             expandInput, numOctaveLayers, initSigma, stream);
+
+    FindExtrema<uint8_t>(m_runPyramidGaussian, *featCoords.exportData<nvcv::TensorDataStridedCuda>(),
+                         *featMetadata.exportData<nvcv::TensorDataStridedCuda>(),
+                         *featDescriptors.exportData<nvcv::TensorDataStridedCuda>(), maxCapacity,
+                         *numFeatures.exportData<nvcv::TensorDataStridedCuda>(), inShape, firstOctave, numOctaves,
+                         numOctaveLayers, contrastThreshold, edgeThreshold, initSigma, stream);
+}
+
+void SIFT::operator()(cudaStream_t stream, const nvcv::TensorBatch &gaussPyramid, const NVCVPyramidInfo &pyramidInfo,
+                      const nvcv::Tensor &featCoords, const nvcv::Tensor &featMetadata,
+                      const nvcv::Tensor &featDescriptors, const nvcv::Tensor &numFeatures, float contrastThreshold,
+                      float edgeThreshold) const
+{
+    // Check the pre-built pyramid fits in the pyramids allocated at operator constructor, since its DoG (Difference
+    // of Gaussians) pyramid is computed in the internal DoG pyramid
+
+    int3 baseShape = pyramid::ValidatePyramid(gaussPyramid, pyramidInfo);
+
+    if (baseShape.x < 2 || baseShape.y < 2 || baseShape.x > m_maxShape.x || baseShape.y > m_maxShape.y
+        || baseShape.z > m_maxShape.z)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output numFeatures must be a valid CUDA strided tensor");
+                              "Pyramid base level shape (W=%d H=%d N=%d) must have W and H >= 2 and be smaller than "
+                              "or equal to maxShape (W=%d H=%d N=%d) defined in operator constructor",
+                              baseShape.x, baseShape.y, baseShape.z, m_maxShape.x, m_maxShape.y, m_maxShape.z);
     }
-    if (!(numFeaturesData->dtype() == nvcv::TYPE_S32
-          && ((numFeaturesData->rank() == 2 && numFeaturesData->shape(1) == 1) || (numFeaturesData->rank() == 1))))
+    if (pyramidInfo.numLevels > m_maxOctaves)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output numFeatures must have rank 1 or 2 and 1xS32 or S32 data type");
+                              "Pyramid numLevels=%d must be smaller than or equal to %d for the maxShape defined in "
+                              "operator constructor",
+                              pyramidInfo.numLevels, m_maxOctaves);
     }
-    if (numFeaturesData->shape(0) != inShape.z)
+    if (pyramidInfo.numScales > m_maxOctaveLayers)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output numFeatures 1st shape must be the same as input tensor number of samples, "
-                              "%d != %d",
-                              (int)numFeaturesData->shape(0), inShape.z);
+                              "Pyramid numScales=%d must be smaller than or equal to maxOctaveLayers=%d defined in "
+                              "operator constructor",
+                              pyramidInfo.numScales, m_maxOctaveLayers);
     }
-    if (!(numFeaturesData->stride(0) == sizeof(int)
-          && ((numFeaturesData->rank() == 2 && numFeaturesData->stride(1) == sizeof(int))
-              || (numFeaturesData->rank() == 1))))
+
+    CheckThresholds(contrastThreshold, edgeThreshold);
+
+    int maxCapacity = CheckOutputs(featCoords, featMetadata, featDescriptors, numFeatures, baseShape.z);
+
+    // The pyramid levels are the SIFT octaves and its scales the SIFT octave layers, only the DoG pyramid needs to
+    // be computed before finding the extrema points, i.e. features.
+
+    PyramidType pyramidGaussian;
+    pyramidGaussian.reserve(pyramidInfo.numLevels);
+
+    for (int level = 0; level < pyramidInfo.numLevels; level++)
     {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output numFeatures last strides must be packed for 1xS32 data type, stride0=%d",
-                              (int)numFeaturesData->stride(0));
+        pyramidGaussian.push_back(gaussPyramid[level]);
     }
 
-    // The only supported data type is U8, hence uint8_t in DT templates below.
-    // After all checkings are done, the input and output tensors can be used in executing the operator.
-    // First reshape the pyramids, then compute them and, finally, find extrema points, i.e. features.
-
-    ReshapePyramids(inShape, numOctaves, numOctaveLayers);
+    ReshapePyramids(baseShape, pyramidInfo.numLevels, pyramidInfo.numScales);
 
-    ComputePyramids<uint8_t>(*inData, inShape, expandInput, numOctaves, numOctaveLayers, initSigma, stream);
+    pyramid::ComputeDoGPyramid(pyramidGaussian, m_runPyramidDoG, baseShape, pyramidInfo.numScales, stream);
 
-    FindExtrema<uint8_t>(*featCoordsData, *featMetadataData, *featDescriptorsData, maxCapacity, *numFeaturesData,
-                         inShape, firstOctave, numOctaves, numOctaveLayers, contrastThreshold, edgeThreshold, initSigma,
-                         stream);
+    FindExtrema<uint8_t>(pyramidGaussian, *featCoords.exportData<nvcv::TensorDataStridedCuda>(),
+                         *featMetadata.exportData<nvcv::TensorDataStridedCuda>(),
+                         *featDescriptors.exportData<nvcv::TensorDataStridedCuda>(), maxCapacity,
+                         *numFeatures.exportData<nvcv::TensorDataStridedCuda>(), baseShape, pyramidInfo.firstLevel,
+                         pyramidInfo.numLevels, pyramidInfo.numScales, contrastThreshold, edgeThreshold,
+                         pyramidInfo.initSigma, stream);
 }
 
 } // namespace cvcuda::priv
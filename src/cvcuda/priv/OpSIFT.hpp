@@ -29,6 +29,7 @@
 
 #include <cvcuda/OpSIFT.h>
 #include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
 
 #include <memory>
 #include <vector>
@@ -45,20 +46,21 @@ public:
                     const nvcv::Tensor &numFeatures, int numOctaveLayers, float contrastThreshold, float edgeThreshold,
                     float initSigma, NVCVSIFTFlagType flags) const;
 
+    void operator()(cudaStream_t stream, const nvcv::TensorBatch &gaussPyramid, const NVCVPyramidInfo &pyramidInfo,
+                    const nvcv::Tensor &featCoords, const nvcv::Tensor &featMetadata,
+                    const nvcv::Tensor &featDescriptors, const nvcv::Tensor &numFeatures, float contrastThreshold,
+                    float edgeThreshold) const;
+
 private:
     // The pyramid type stores one tensor per octave (SIFT pyramid level) where a single tensor contains all layers
-    // within an octave (Gaussian filtering done) stacked, see OpSIFT.cu comments for more
+    // within an octave (Gaussian filtering done) stacked, see PyramidUtil.cuh comments for more
     using PyramidType = std::vector<nvcv::Tensor>;
 
     void CreatePyramids();
     void ReshapePyramids(const int3 &shape, int numOctaves, int numOctaveLayers) const;
 
     template<typename DT>
-    void ComputePyramids(const nvcv::TensorDataStridedCuda &inData, int3 currShape, bool expandInput, int numOctaves,
-                         int numOctaveLayers, float initSigma, cudaStream_t stream) const;
-
-    template<typename DT>
-    void FindExtrema(const nvcv::TensorDataStridedCuda &featCoordsData,
+    void FindExtrema(const PyramidType &pyramidGaussian, const nvcv::TensorDataStridedCuda &featCoordsData,
                      const nvcv::TensorDataStridedCuda &featMetadaData,
                      const nvcv::TensorDataStridedCuda &featDescriptorsData, int maxCapacity,
                      const nvcv::TensorDataStridedCuda &numFeaturesData, int3 currShape, int firstOctave,
@@ -68,9 +70,11 @@ private:
     int3 m_maxShape;
     int  m_maxOctaves, m_maxOctaveLayers;
 
-    // Maximum allowed pyramids and run (submit) time pyramids
-    PyramidType         m_maxPyramidGaussian, m_maxPyramidDoG;
-    mutable PyramidType m_runPyramidGaussian, m_runPyramidDoG; // mutable as it changes during run-time
+    // Maximum allowed base image and pyramids and run (submit) time base image and pyramids
+    nvcv::Tensor         m_maxBase;
+    mutable nvcv::Tensor m_runBase;
+    PyramidType          m_maxPyramidGaussian, m_maxPyramidDoG;
+    mutable PyramidType  m_runPyramidGaussian, m_runPyramidDoG; // mutable as it changes during run-time
 };
 
 } // namespace cvcuda::priv
@@ -44,6 +44,10 @@ public:
                     const NVCVAffineTransform xform, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValueconst) const;
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                    const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue) const;
+
     void operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in, const nvcv::ImageBatchVarShape &out,
                     const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue) const;
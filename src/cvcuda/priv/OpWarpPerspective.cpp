@@ -56,6 +56,34 @@ void WarpPerspective::operator()(cudaStream_t stream, const nvcv::Tensor &in, co
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, transMatrix, flags, borderMode, borderValue, stream));
 }
 
+void WarpPerspective::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                 const nvcv::Tensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                                 const float4 borderValue) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto outData = out.exportData<nvcv::TensorDataStridedCuda>();
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto transMatrixData = transMatrix.exportData<nvcv::TensorDataStridedCuda>();
+    if (transMatrixData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "transformation matrix must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, *transMatrixData, flags, borderMode, borderValue, stream));
+}
+
 void WarpPerspective::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
                                  const nvcv::ImageBatchVarShape &out, const nvcv::Tensor &transMatrix,
                                  const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue) const
@@ -0,0 +1,524 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpYUVResizeCropNormalize.hpp"
+
+#include "YUVConstants.hpp"
+
+#include <cvcuda/cuda_tools/ImageBatchVarShapeWrap.hpp>
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/MathWrappers.hpp>
+#include <cvcuda/cuda_tools/SaturateCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <nvcv/DataType.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/TensorLayout.hpp>
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <cuda_fp16.h>
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+namespace {
+
+using cvcuda::priv::YUV2RGBConstants;
+using cvcuda::priv::yuv_shift;
+
+// Where the chroma of a YUV420 image is and in which order the converted channels are written
+struct YUVFormat
+{
+    bool semiPlanar; // NV12/NV21 when true, I420/YV12 otherwise
+    int  uidx;       // 1 when the V sample (or plane) comes before the U one
+    int  bidx;       // 0 for BGR output, 2 for RGB output
+};
+
+YUVFormat GetYUVFormat(NVCVColorConversionCode code)
+{
+    switch (code)
+    {
+    case NVCV_COLOR_YUV2RGB_NV12:
+        return {true, 0, 2};
+    case NVCV_COLOR_YUV2BGR_NV12:
+        return {true, 0, 0};
+    case NVCV_COLOR_YUV2RGB_NV21:
+        return {true, 1, 2};
+    case NVCV_COLOR_YUV2BGR_NV21:
+        return {true, 1, 0};
+    case NVCV_COLOR_YUV2RGB_I420:
+        return {false, 0, 2};
+    case NVCV_COLOR_YUV2BGR_I420:
+        return {false, 0, 0};
+    case NVCV_COLOR_YUV2RGB_YV12:
+        return {false, 1, 2};
+    case NVCV_COLOR_YUV2BGR_YV12:
+        return {false, 1, 0};
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Unsupported conversion code %d, only YUV420 (NV12, NV21, I420, YV12) to RGB or BGR "
+                              "conversions are supported",
+                              static_cast<int>(code));
+    }
+}
+
+struct Params
+{
+    YUV2RGBConstants coef;
+    NVCVSize2D       resizeDim;
+    int2             crop;
+    int              uidx, bidx;
+    float3           mean, invStddev; // in output channel order
+};
+
+// Output pointer and strides, in elements. Interleaved outputs have a unit plane stride.
+template<typename T>
+struct DstDesc
+{
+    T      *base;
+    int64_t sampleStride;
+    int64_t planeStride;
+    int64_t rowStride;
+    int     colStride;
+    int2    size;
+};
+
+// Uniform batch, all samples have the luma size given at launch
+struct TensorSrc
+{
+    cuda::Tensor3DWrap<const uint8_t, int32_t> wrap;
+    int2                                        size;
+
+    inline __device__ int2 lumaSize(int) const
+    {
+        return size;
+    }
+
+    inline __device__ int load(int n, int y, int x) const
+    {
+        return *wrap.ptr(n, y, x);
+    }
+};
+
+// Var-shape batch, the luma plane is 2/3 of each image rows
+struct VarShapeSrc
+{
+    cuda::ImageBatchVarShapeWrap<const uint8_t> wrap;
+
+    inline __device__ int2 lumaSize(int n) const
+    {
+        return int2{wrap.width(n), wrap.height(n) * 2 / 3};
+    }
+
+    inline __device__ int load(int n, int y, int x) const
+    {
+        return *wrap.ptr(n, y, x);
+    }
+};
+
+#define CV_DESCALE(x, n) (((x) + (1 << ((n)-1))) >> (n))
+
+// Converts the pixel (x, y) of sample n to RGB, with the same fixed-point math as the AdvCvtColor operator
+template<bool IsSemiPlanar, class SrcAccess>
+inline __device__ float3 LoadRGB(const SrcAccess &src, int n, int2 size, int x, int y, const Params &params)
+{
+    const int Y = src.load(n, y, x);
+    int       U, V;
+    if constexpr (IsSemiPlanar)
+    {
+        // Interleaved U-V rows at half resolution after the Y plane, see load_yuv420 in legacy/cvt_color.cu
+        const int uv_y = size.y + y / 2;
+        const int uv_x = x & ~1;
+
+        U = src.load(n, uv_y, uv_x + params.uidx);
+        V = src.load(n, uv_y, uv_x + (params.uidx ^ 1));
+    }
+    else
+    {
+        // U and V planes after the Y plane, two subsampled rows per full row
+        const int by   = size.y + y / 4;
+        const int h4   = size.y / 4;
+        const int uv_x = (x / 2) + ((size.x / 2) & -((y / 2) & 1));
+
+        U = src.load(n, by + h4 * params.uidx, uv_x);
+        V = src.load(n, by + h4 * (params.uidx ^ 1), uv_x);
+    }
+
+    constexpr int delta = 128;
+
+    const int b = Y + CV_DESCALE((U - delta) * params.coef.U2B, yuv_shift);
+    const int g = Y + CV_DESCALE((U - delta) * params.coef.U2G + (V - delta) * params.coef.V2G, yuv_shift);
+    const int r = Y + CV_DESCALE((V - delta) * params.coef.V2R, yuv_shift);
+
+    return float3{static_cast<float>(cuda::SaturateCast<uint8_t>(r)), static_cast<float>(cuda::SaturateCast<uint8_t>(g)),
+                  static_cast<float>(cuda::SaturateCast<uint8_t>(b))};
+}
+
+#undef CV_DESCALE
+
+inline __device__ void StoreValue(float &dst, float value)
+{
+    dst = value;
+}
+
+inline __device__ void StoreValue(__half &dst, float value)
+{
+    dst = __float2half_rn(value);
+}
+
+template<bool IsSemiPlanar, bool IsLinear, class SrcAccess, typename DstT>
+__global__ void yuvResizeCropNormalize(SrcAccess src, DstDesc<DstT> dst, Params params)
+{
+    const int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n     = blockIdx.z;
+
+    if (dst_x >= dst.size.x || dst_y >= dst.size.y)
+    {
+        return;
+    }
+
+    const int2  size    = src.lumaSize(n);
+    const float scale_x = static_cast<float>(size.x) / params.resizeDim.w;
+    const float scale_y = static_cast<float>(size.y) / params.resizeDim.h;
+
+    // Only the source pixels the interpolation reads are converted to RGB
+    float3 rgb;
+    if constexpr (IsLinear)
+    {
+        float fx = (dst_x + params.crop.x + 0.5f) * scale_x - 0.5f;
+        float fy = (dst_y + params.crop.y + 0.5f) * scale_y - 0.5f;
+
+        int sx0 = __float2int_rd(fx);
+        int sy0 = __float2int_rd(fy);
+
+        const int sx1 = cuda::min(sx0 + 1, size.x - 1);
+        const int sy1 = cuda::min(sy0 + 1, size.y - 1);
+
+        fx -= sx0;
+        fy -= sy0;
+        sx0 = cuda::max(0, sx0);
+        sy0 = cuda::max(0, sy0);
+
+        const float3 p00 = LoadRGB<IsSemiPlanar>(src, n, size, sx0, sy0, params);
+        const float3 p01 = LoadRGB<IsSemiPlanar>(src, n, size, sx1, sy0, params);
+        const float3 p10 = LoadRGB<IsSemiPlanar>(src, n, size, sx0, sy1, params);
+        const float3 p11 = LoadRGB<IsSemiPlanar>(src, n, size, sx1, sy1, params);
+
+        rgb = (1 - fy) * ((1 - fx) * p00 + fx * p01) + fy * ((1 - fx) * p10 + fx * p11);
+    }
+    else
+    {
+        const int sx = __float2int_rd((dst_x + params.crop.x + 0.5f) * scale_x);
+        const int sy = __float2int_rd((dst_y + params.crop.y + 0.5f) * scale_y);
+
+        rgb = LoadRGB<IsSemiPlanar>(src, n, size, sx, sy, params);
+    }
+
+    const float3 val = params.bidx == 0 ? float3{rgb.z, rgb.y, rgb.x} : rgb;
+    const float3 out = (val - params.mean) * params.invStddev;
+
+    DstT *ptr = dst.base + n * dst.sampleStride + dst_y * dst.rowStride + dst_x * dst.colStride;
+    StoreValue(ptr[0], out.x);
+    StoreValue(ptr[dst.planeStride], out.y);
+    StoreValue(ptr[2 * dst.planeStride], out.z);
+}
+
+template<typename DstT>
+DstDesc<DstT> CreateDstDesc(const nvcv::TensorDataAccessStridedImagePlanar &dstAccess)
+{
+    const bool planar = dstAccess.numPlanes() > 1;
+
+    DstDesc<DstT> dst;
+    dst.base         = reinterpret_cast<DstT *>(dstAccess.sampleData(0));
+    dst.sampleStride = dstAccess.sampleStride() / sizeof(DstT);
+    dst.planeStride  = planar ? dstAccess.planeStride() / sizeof(DstT) : 1;
+    dst.rowStride    = dstAccess.rowStride() / sizeof(DstT);
+    dst.colStride    = dstAccess.colStride() / sizeof(DstT);
+    dst.size         = int2{dstAccess.numCols(), dstAccess.numRows()};
+    return dst;
+}
+
+template<class SrcAccess, typename DstT>
+void RunTyped(const SrcAccess &src, const nvcv::TensorDataAccessStridedImagePlanar &dstAccess, bool semiPlanar,
+              NVCVInterpolationType interpolation, const Params &params, cudaStream_t stream)
+{
+    const DstDesc<DstT> dst = CreateDstDesc<DstT>(dstAccess);
+
+    // The kernel is gather bound, a narrow block keeps the luma and chroma reads of a warp within few rows
+    const dim3 block(32, 8, 1);
+    const dim3 grid(util::DivUp(dst.size.x, block.x), util::DivUp(dst.size.y, block.y), dstAccess.numSamples());
+
+    if (semiPlanar)
+    {
+        if (interpolation == NVCV_INTERP_LINEAR)
+        {
+            yuvResizeCropNormalize<true, true><<<grid, block, 0, stream>>>(src, dst, params);
+        }
+        else
+        {
+            yuvResizeCropNormalize<true, false><<<grid, block, 0, stream>>>(src, dst, params);
+        }
+    }
+    else
+    {
+        if (interpolation == NVCV_INTERP_LINEAR)
+        {
+            yuvResizeCropNormalize<false, true><<<grid, block, 0, stream>>>(src, dst, params);
+        }
+        else
+        {
+            yuvResizeCropNormalize<false, false><<<grid, block, 0, stream>>>(src, dst, params);
+        }
+    }
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+template<class SrcAccess>
+void Run(const SrcAccess &src, const nvcv::TensorDataAccessStridedImagePlanar &dstAccess, nvcv::DataType dstDtype,
+         bool semiPlanar, NVCVInterpolationType interpolation, const Params &params, cudaStream_t stream)
+{
+    if (dstDtype == nvcv::TYPE_F32)
+    {
+        RunTyped<SrcAccess, float>(src, dstAccess, semiPlanar, interpolation, params, stream);
+    }
+    else
+    {
+        RunTyped<SrcAccess, __half>(src, dstAccess, semiPlanar, interpolation, params, stream);
+    }
+}
+
+// Validates the arguments shared by the tensor and var-shape variants and packs the kernel parameters
+Params CreateParams(const YUVFormat &format, nvcv::ColorSpec spec, const NVCVSize2D resizeDim,
+                    const NVCVInterpolationType interpolation, const int2 cropPos, const float3 mean,
+                    const float3 stddev, const nvcv::TensorDataAccessStridedImagePlanar &dstAccess)
+{
+    if (spec != NVCV_COLOR_SPEC_BT601 && spec != NVCV_COLOR_SPEC_BT709 && spec != NVCV_COLOR_SPEC_BT2020)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Unsupported color spec, it must be BT601, BT709 or BT2020");
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid interpolation, only NVCV_INTERP_NEAREST and NVCV_INTERP_LINEAR are supported");
+    }
+
+    if (resizeDim.w <= 1 || resizeDim.h <= 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid resize dimensions: width x height = %d x %d, dimensions must be larger than 1",
+                              resizeDim.w, resizeDim.h);
+    }
+
+    const int dst_w = dstAccess.numCols();
+    const int dst_h = dstAccess.numRows();
+    if (cropPos.x < 0 || cropPos.y < 0 || cropPos.x + dst_w > resizeDim.w || cropPos.y + dst_h > resizeDim.h)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid crop region: crop region(x, y, w, h) = (%d, %d, %d, %d) extends beyond bounds "
+                              "of resized image",
+                              cropPos.x, cropPos.y, dst_w, dst_h);
+    }
+
+    if (stddev.x == 0 || stddev.y == 0 || stddev.z == 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Standard deviations must not be zero");
+    }
+
+    return Params{cvcuda::priv::getYUV2RGBCooef(spec),
+                  resizeDim,
+                  cropPos,
+                  format.uidx,
+                  format.bidx,
+                  mean,
+                  float3{1.f / stddev.x, 1.f / stddev.y, 1.f / stddev.z}};
+}
+
+nvcv::TensorDataAccessStridedImagePlanar ValidateOutput(const nvcv::Tensor &dst, int numSamples,
+                                                        nvcv::DataType &dstDtype)
+{
+    auto dstData = dst.exportData<nvcv::TensorDataStridedCuda>();
+    if (!dstData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be a cuda-accessible, pitch-linear tensor");
+    }
+
+    nvcv::TensorLayout dstLayout = dstData->layout();
+    if (!(dstLayout == nvcv::TENSOR_NCHW || dstLayout == nvcv::TENSOR_CHW || dstLayout == nvcv::TENSOR_NHWC
+          || dstLayout == nvcv::TENSOR_HWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE,
+                              "Output tensor must have 'NCHW', 'CHW', 'NHWC' or 'HWC' layout");
+    }
+
+    dstDtype = dstData->dtype();
+    if (dstDtype != nvcv::TYPE_F32 && dstDtype != nvcv::TYPE_F16)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE, "Output must be of data type float or half");
+    }
+
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    NVCV_ASSERT(dstAccess);
+
+    if (dstAccess->numChannels() != 3)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE, "Output must have 3 channels, it has %d",
+                              dstAccess->numChannels());
+    }
+
+    if (dstAccess->numSamples() != numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output must have the same number of samples: %d input and %d output",
+                              numSamples, dstAccess->numSamples());
+    }
+
+    // Samples are on the grid z dimension
+    if (numSamples > 65535)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid number of samples %d, must be <= 65535",
+                              numSamples);
+    }
+
+    return *dstAccess;
+}
+
+// Validates the luma size of a YUV420 image given its number of rows
+int2 LumaSize(int width, int rows, const YUVFormat &format)
+{
+    if (rows % 3 != 0 || width % 2 != 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid YUV420 image size %d x %d, the width must be even and the number of rows "
+                              "3/2 of an even image height",
+                              width, rows);
+    }
+
+    const int2 size{width, rows * 2 / 3};
+    if (size.y % 2 != 0 || (!format.semiPlanar && size.y % 4 != 0))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid YUV420 image height %d, it must be even, and a multiple of 4 for I420 and YV12",
+                              size.y);
+    }
+    return size;
+}
+
+} // anonymous namespace
+
+namespace cvcuda::priv {
+
+YUVResizeCropNormalize::YUVResizeCropNormalize() {}
+
+void YUVResizeCropNormalize::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
+                                        NVCVColorConversionCode code, nvcv::ColorSpec spec,
+                                        const NVCVSize2D resizeDim, const NVCVInterpolationType interpolation,
+                                        const int2 cropPos, const float3 mean, const float3 stddev) const
+{
+    const YUVFormat format = GetYUVFormat(code);
+
+    auto srcData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!srcData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be a cuda-accessible, pitch-linear tensor");
+    }
+
+    if (!(srcData->layout() == nvcv::TENSOR_NHWC || srcData->layout() == nvcv::TENSOR_HWC))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE, "Input tensor must have 'NHWC' or 'HWC' layout");
+    }
+
+    if (srcData->dtype() != nvcv::TYPE_U8)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE, "Input must be of data type uchar");
+    }
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    NVCV_ASSERT(srcAccess);
+
+    if (srcAccess->numChannels() != 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE,
+                              "Input must have a single channel holding the Y, U and V samples");
+    }
+
+    if (srcAccess->sampleStride() * srcAccess->numSamples() > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_OVERFLOW, "Input size exceeds %d. Tensor is too large.",
+                              cuda::TypeTraits<int32_t>::max);
+    }
+
+    const int2 size = LumaSize(srcAccess->numCols(), srcAccess->numRows(), format);
+
+    nvcv::DataType dstDtype;
+    auto           dstAccess = ValidateOutput(out, srcAccess->numSamples(), dstDtype);
+    Params params = CreateParams(format, spec, resizeDim, interpolation, cropPos, mean, stddev, dstAccess);
+
+    TensorSrc src{cuda::CreateTensorWrapNHW<const uint8_t, int32_t>(*srcData), size};
+    Run(src, dstAccess, dstDtype, format.semiPlanar, interpolation, params, stream);
+}
+
+void YUVResizeCropNormalize::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
+                                        const nvcv::Tensor &out, NVCVColorConversionCode code, nvcv::ColorSpec spec,
+                                        const NVCVSize2D resizeDim, const NVCVInterpolationType interpolation,
+                                        const int2 cropPos, const float3 mean, const float3 stddev) const
+{
+    const YUVFormat format = GetYUVFormat(code);
+
+    const nvcv::ImageFormat srcFrmt = in.uniqueFormat();
+    if (!srcFrmt)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "All input images in a batch must have the same format");
+    }
+
+    if (srcFrmt.numPlanes() != 1 || srcFrmt.numChannels() != 1 || srcFrmt.planeDataType(0) != nvcv::TYPE_U8)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE,
+                              "Input images must have a single 8-bit unsigned plane holding the Y, U and V samples");
+    }
+
+    for (int i = 0; i < in.numImages(); ++i)
+    {
+        const nvcv::Size2D imgSize = in[i].size();
+        LumaSize(imgSize.w, imgSize.h, format);
+    }
+
+    auto srcData = in.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+    if (!srcData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be a cuda-accessible, varshape image batch");
+    }
+
+    nvcv::DataType dstDtype;
+    auto           dstAccess = ValidateOutput(out, srcData->numImages(), dstDtype);
+    Params params = CreateParams(format, spec, resizeDim, interpolation, cropPos, mean, stddev, dstAccess);
+
+    VarShapeSrc src{cuda::ImageBatchVarShapeWrap<const uint8_t>(*srcData)};
+    Run(src, dstAccess, dstDtype, format.semiPlanar, interpolation, params, stream);
+}
+
+} // namespace cvcuda::priv
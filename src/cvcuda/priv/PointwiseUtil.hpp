@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file PointwiseUtil.hpp
+ *
+ * @brief Per-pixel evaluation of the fused pointwise chain, shared by the device kernel and host tests.
+ */
+
+#ifndef CVCUDA_PRIV_POINTWISE_UTIL_HPP
+#define CVCUDA_PRIV_POINTWISE_UTIL_HPP
+
+#include <cvcuda/Types.h>
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/MathWrappers.hpp>
+
+namespace cvcuda::priv::pointwise {
+
+namespace cuda = nvcv::cuda;
+
+constexpr int kMaxSteps = 16;
+
+// Chain passed by value to the kernel, it fits in the kernel parameter space
+struct Chain
+{
+    int32_t           numSteps;
+    NVCVPointwiseStep steps[kMaxSteps];
+};
+
+inline __host__ __device__ float4 MakeFloat4(const float (&a)[4])
+{
+    return float4{a[0], a[1], a[2], a[3]};
+}
+
+// Selects a channel with a runtime index without spilling the pixel to local memory
+inline __host__ __device__ float Select(const float4 &v, int c)
+{
+    return c == 0 ? v.x : (c == 1 ? v.y : (c == 2 ? v.z : v.w));
+}
+
+inline __host__ __device__ float Dot(const float *row, const float4 &v)
+{
+    return row[0] * v.x + row[1] * v.y + row[2] * v.z + row[3] * v.w;
+}
+
+inline __host__ __device__ float4 ApplyStep(const NVCVPointwiseStep &step, float4 v)
+{
+    switch (step.type)
+    {
+    case NVCV_POINTWISE_SCALE_SHIFT:
+        return v * MakeFloat4(step.scale) + MakeFloat4(step.shift);
+
+    case NVCV_POINTWISE_CLAMP:
+        return cuda::clamp(v, step.low, step.high);
+
+    case NVCV_POINTWISE_SWIZZLE:
+        return float4{Select(v, step.map[0]), Select(v, step.map[1]), Select(v, step.map[2]), Select(v, step.map[3])};
+
+    case NVCV_POINTWISE_MATRIX:
+        return float4{Dot(&step.matrix[0], v), Dot(&step.matrix[4], v), Dot(&step.matrix[8], v),
+                      Dot(&step.matrix[12], v)}
+             + MakeFloat4(step.shift);
+
+    case NVCV_POINTWISE_GAMMA:
+        return step.range * cuda::pow(cuda::max(v, float4{0, 0, 0, 0}) / step.range, step.gamma);
+    }
+    return v;
+}
+
+// Applies all the steps of the chain to one pixel
+inline __host__ __device__ float4 Apply(const Chain &chain, float4 v)
+{
+    for (int i = 0; i < chain.numSteps; ++i)
+    {
+        v = ApplyStep(chain.steps[i], v);
+    }
+    return v;
+}
+
+} // namespace cvcuda::priv::pointwise
+
+#endif // CVCUDA_PRIV_POINTWISE_UTIL_HPP
@@ -0,0 +1,582 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_PRIV_PYRAMID_UTIL_CUH
+#define CVCUDA_PRIV_PYRAMID_UTIL_CUH
+
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h> // for NVCVPyramidInfo, etc.
+#include <cvcuda/cuda_tools/BorderWrap.hpp>
+#include <cvcuda/cuda_tools/InterpolationWrap.hpp>
+#include <cvcuda/cuda_tools/MathOps.hpp>
+#include <cvcuda/cuda_tools/MathWrappers.hpp>
+#include <cvcuda/cuda_tools/StaticCast.hpp>
+#include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <cvcuda/cuda_tools/math/LinAlg.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
+#include <nvcv/TensorData.hpp>
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <cmath>
+#include <vector>
+
+/* This file implements the Gaussian scale-space pyramid shared by operators working on multiple scales.
+   A pyramid has levels (the SIFT octaves) with scales (the SIFT octave layers), each level is stored in a single
+   LNHWC F32 tensor with 1 channel, where L = numScales + 3 stacks the Gaussian-filtered layers of that level and
+   the level has half the width and height of the previous level.  See NVCVPyramidInfo for its metadata. */
+namespace cvcuda::priv::pyramid {
+
+namespace cuda = nvcv::cuda;
+namespace util = nvcv::util;
+
+// Compile-time definitions ----------------------------------------------------
+
+constexpr NVCVBorderType        kBorderGauss{NVCV_BORDER_REFLECT101}; // default border for Gaussian operation
+constexpr NVCVBorderType        kBorderInterp{NVCV_BORDER_REPLICATE}; // default border for interpolation
+constexpr NVCVInterpolationType kInterpUp{NVCV_INTERP_LINEAR};        // default interpolation for up scaling
+
+constexpr float kMinSigma      = 0.01f; // minimum sigma to be used as base sigma
+constexpr float kPrevSigma     = 0.5f;  // previous sigma before base image
+constexpr int   kMaxKernelSize = 59;    // maximum Gaussian kernel size
+constexpr int   kMaxScales     = 16;    // maximum number of scales per level
+
+// Tensor layout of each pyramid level: L layers each of which with NHWC tensors
+constexpr nvcv::TensorLayout TENSOR_LNHWC(NVCVTensorLayout{"LNHWC", 5});
+
+// Tensor wrap for LNHWC tensors with C inside its type
+template<typename T>
+using TensorWrapLNHW = cuda::TensorWrap32<T, -1, -1, -1, sizeof(T)>;
+
+// Border wrap for LNHWC tensors using the corresponding tensor wrap
+template<typename T>
+using BorderWrapLNHW = cuda::BorderWrap<TensorWrapLNHW<T>, kBorderGauss, false, false, true, true>;
+
+// CPU functions ---------------------------------------------------------------
+
+// Function to get a view from a tensor parent data with given shape
+inline __host__ nvcv::Tensor GetViewFrom(const nvcv::TensorDataStridedCuda  &parentData,
+                                         const nvcv::TensorShape::ShapeType &viewShape)
+{
+    // Get tensor data and create a view of it with given shape instead of its original shape
+    NVCVTensorData viewData = parentData.cdata();
+
+    NVCV_ASSERT(viewData.rank == viewShape.rank());
+
+    for (int r = 0; r < viewData.rank; r++)
+    {
+        NVCV_ASSERT(viewData.shape[r] >= viewShape[r]);
+
+        viewData.shape[r] = viewShape[r];
+    }
+
+    return nvcv::TensorWrapData(viewData);
+}
+
+// Function to get a NHWC view of one layer of a pyramid level
+inline __host__ nvcv::Tensor GetLayerView(const nvcv::TensorDataStridedCuda &levelData, int layer)
+{
+    NVCV_ASSERT(levelData.rank() == 5 && layer >= 0 && layer < levelData.shape(0));
+
+    NVCVTensorData viewData = levelData.cdata();
+
+    viewData.rank = 4;
+    viewData.buffer.strided.basePtr += layer * levelData.stride(0);
+
+    for (int r = 0; r < 4; r++)
+    {
+        viewData.shape[r]                  = levelData.shape(r + 1);
+        viewData.buffer.strided.strides[r] = levelData.stride(r + 1);
+    }
+
+    viewData.layout = NVCV_TENSOR_NHWC;
+
+    return nvcv::TensorWrapData(viewData);
+}
+
+// Function to export the data of a pyramid level tensor
+inline __host__ nvcv::TensorDataStridedCuda ExportLevelData(const nvcv::Tensor &level)
+{
+    auto levelData = level.exportData<nvcv::TensorDataStridedCuda>();
+    if (!levelData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Pyramid level must be a valid CUDA strided tensor");
+    }
+
+    return *levelData;
+}
+
+// Function to compute number of levels (octaves) for an WxH image with W=width and H=height
+inline __host__ int ComputeNumberOfOctaves(int width, int height)
+{
+    return std::round((std::log2(std::min(width, height))) - 2) + 1;
+}
+
+// Compute Gaussian filter kernel size for a given sigma
+inline __host__ int ComputeGaussianKernelSize(float sigma)
+{
+    return cuda::min(cuda::round<int>(sigma * 8 + 1) | 1, kMaxKernelSize);
+}
+
+// Check pyramid levels are conforming to its metadata and return the base level shape as int3=WHN
+inline __host__ int3 ValidatePyramid(const nvcv::TensorBatch &pyramid, const NVCVPyramidInfo &info)
+{
+    if (info.numLevels < 1 || info.numLevels != pyramid.numTensors())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Pyramid info numLevels=%d must be positive and equal to the number of tensors in "
+                              "the pyramid batch, %d",
+                              info.numLevels, pyramid.numTensors());
+    }
+    if (info.numScales < 1 || info.numScales > kMaxScales)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pyramid info numScales=%d must be in [1, %d]",
+                              info.numScales, kMaxScales);
+    }
+    if (info.firstLevel != 0 && info.firstLevel != -1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pyramid info firstLevel=%d must be 0 or -1",
+                              info.firstLevel);
+    }
+    if (!(info.initSigma > 0))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pyramid info initSigma=%f must be positive",
+                              info.initSigma);
+    }
+    if (pyramid.dtype() != nvcv::TYPE_F32 || pyramid.layout() != TENSOR_LNHWC)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Pyramid levels must have LNHWC layout and F32 data type");
+    }
+
+    int3 baseShape{0, 0, 0};
+
+    for (int level = 0; level < info.numLevels; level++)
+    {
+        auto levelData = ExportLevelData(pyramid[level]);
+
+        if (level == 0)
+        {
+            baseShape = int3{(int)levelData.shape(3), (int)levelData.shape(2), (int)levelData.shape(1)};
+        }
+
+        int3 levelShape{baseShape.x >> level, baseShape.y >> level, baseShape.z};
+
+        if (levelData.shape(0) != info.numScales + 3 || levelData.shape(1) != levelShape.z
+            || levelData.shape(2) != levelShape.y || levelData.shape(3) != levelShape.x || levelData.shape(4) != 1)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Pyramid level %d must have shape (L=%d N=%d H=%d W=%d C=1)", level,
+                                  info.numScales + 3, levelShape.z, levelShape.y, levelShape.x);
+        }
+        if (levelShape.x < 1 || levelShape.y < 1)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Pyramid has too many levels, %d, for its base level shape (W=%d H=%d)",
+                                  info.numLevels, baseShape.x, baseShape.y);
+        }
+        if (levelData.stride(4) != sizeof(float) || levelData.stride(0) * levelData.shape(0) > INT32_MAX)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Pyramid level %d must have packed channels and size smaller than %d", level,
+                                  INT32_MAX);
+        }
+    }
+
+    return baseShape;
+}
+
+// CUDA functions --------------------------------------------------------------
+
+// Direct (no scale) copy a source 3-rank NHW tensor into a destination 4-rank LNHW tensor
+template<class SrcWrapper>
+__global__ void Copy(TensorWrapLNHW<float> dst, SrcWrapper src, int3 srcShape)
+{
+    int3 srcCoord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+
+    if (srcCoord.x < srcShape.x && srcCoord.y < srcShape.y && srcCoord.z < srcShape.z)
+    {
+        int4 dstCoord{srcCoord.x, srcCoord.y, srcCoord.z, 0};
+
+        dst[dstCoord] = src[srcCoord];
+    }
+}
+
+// Expand (2x upscale) copy a source 3-rank NHW tensor into a destination 4-rank LNHW tensor
+template<class SrcWrapper>
+__global__ void UpCopy(TensorWrapLNHW<float> dst, SrcWrapper src, int3 dstShape)
+{
+    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+
+    if (coord.x < dstShape.x && coord.y < dstShape.y && coord.z < dstShape.z)
+    {
+        int4   dstCoord{coord.x, coord.y, coord.z, 0};
+        float3 srcCoord{0, 0, (float)coord.z};
+
+        srcCoord.x = (coord.x + .5f) * .5f - .5f;
+        srcCoord.y = (coord.y + .5f) * .5f - .5f;
+
+        dst[dstCoord] = src[srcCoord];
+    }
+}
+
+// Contract (2x downscale) copy a source 4-rank LNHW tensor into a destination 4-rank LNHW tensor
+template<class SrcWrapper>
+__global__ void DownCopy(TensorWrapLNHW<float> dst, SrcWrapper src, int3 dstShape, int srcLayer)
+{
+    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+
+    if (coord.x < dstShape.x && coord.y < dstShape.y && coord.z < dstShape.z)
+    {
+        int4 dstCoord{coord.x, coord.y, coord.z, 0};
+        int4 srcCoord{coord.x * 2, coord.y * 2, coord.z, srcLayer};
+
+        dst[dstCoord] = src[srcCoord];
+    }
+}
+
+// Compute DoG (Difference of Gaussians) of all layers of a Gaussian pyramid level: DoG[l] = Gauss[l+1] - Gauss[l]
+template<class GaussWrapper>
+__global__ void DoComputeDoG(GaussWrapper gauss, TensorWrapLNHW<float> dog, int3 shape, int numDoGLayers)
+{
+    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+
+    if (coord.x < shape.x && coord.y < shape.y && coord.z < shape.z)
+    {
+        int4  gc{coord.x, coord.y, coord.z, 0};
+        float prev = gauss[gc];
+
+        for (int layer = 0; layer < numDoGLayers; layer++)
+        {
+            gc.w       = layer + 1;
+            float curr = gauss[gc];
+            gc.w       = layer;
+
+            dog[gc] = curr - prev;
+            prev    = curr;
+        }
+    }
+}
+
+// Compute Gaussian and (if kWithDoG) DoG (Difference of Gaussians) pyramids of current level and layer
+template<int BW, int BH, bool kWithDoG>
+__global__ void DoComputePyramids(BorderWrapLNHW<float> prevGauss, TensorWrapLNHW<float> currGauss,
+                                  TensorWrapLNHW<float> currDoG, int3 currShape, int currLayer, int currKernelSize,
+                                  cuda::math::Vector<float, kMaxKernelSize> gaussSepKernel)
+{
+    constexpr int SH = BH + kMaxKernelSize; // block height with kernel maximum support (halo) for Gaussian filtering
+
+    // Based on kMaxKernelSize = 59 and kDataTile = 32x32x1
+    // Registers used: 40
+    // SMEM usage (max. 48KB): 44772 B = ((32 + 59) * (32 + 59)) * 4 + (32 * (32 + 59)) * 4
+    // CMEM usage (max. 4KB): 688 B = 59 * 4 + 4 + 4 + 4 + 4 * 3 + (4 * 3 + 8) * 2 + (4 * 3 + 4 * 2 + 8) + (360)
+
+    __shared__ float gaussInData[SH * SW];  // plain 1D Gaussian input data in shared memory (SMEM)
+    __shared__ float gaussOutData[SH * BW]; // plain 1D Gaussian output (intermediary) data in SMEM
+
+    // Using TensorWrap with compile-time strides for easy multi-dimensional access of Gaussian data in SMEM
+    cuda::TensorWrap32<float, SW * sizeof(float), sizeof(float)> gaussIn(&gaussInData[0]);
+    cuda::TensorWrap32<float, BW * sizeof(float), sizeof(float)> gaussOut(&gaussOutData[0]);
+
+    int half = currKernelSize / 2; // i.e. the halo or support data outside block to compute Gaussian filter
+
+    int2 tc; // thread (local) coordinates to access SMEM data
+    int2 pc; // previous (local) coordinates to access SMEM data (previous of thread)
+    int2 mc; // mirrored (local) coordinates to access SMEM data (mirror of previous)
+
+    int4 gc{0, 0, (int)blockIdx.z, cuda::max(0, currLayer - 1)}; // current (global) coordinates for GMEM data
+
+    float result; // temporary Gaussian filtering result
+
+    // Threads are defined in a 1D block dimension to be just a count of threads to run this kernel
+    // First loop uses all threads reshaping them to 2D to load block with halo from global memory (GMEM) into SMEM
+    for (int ti = threadIdx.x; ti < (BW + half * 2) * (BH + half * 2); ti += blockDim.x)
+    {
+        tc.x = ti % (BW + half * 2);
+        tc.y = ti / (BW + half * 2);
+        gc.x = blockIdx.x * BW - half + tc.x;
+        gc.y = blockIdx.y * BH - half + tc.y;
+
+        // The prevGauss is a border wrap allowing access to halo outside image with proper border treatment
+        gaussIn[tc] = prevGauss[gc];
+    }
+
+    // Second loop runs all threads in 2D to zero out the block with halo in height for intermediary Gaussian output
+    for (int ti = threadIdx.x; ti < BW * (BH + half * 2); ti += blockDim.x)
+    {
+        tc.x = ti % BW;
+        tc.y = ti / BW;
+
+        gaussOut[tc] = 0.f;
+    }
+
+    __syncthreads(); // wait for the input Gaussian data to be loaded and intermediary Gaussian output to be zeroed
+
+    // Gaussian pyramid has resolution levels (octaves) with scale-space layers, it is computed from a separate
+    // base image (the input potentially expanded) and every level and layer does Gaussian filtering.
+    // [ O=0: [ L=0: Gaussian of base image; L=1: Gaussian of O=0 L=0; ... ]
+    //   O=1: [ L=0: copy of O=0 L=numScales; L=1: Gaussian of O=1 L=0; ... ] ... ] <- Gaussian pyramid
+
+    // Third loop runs all threads in 2D to compute block with halo in height with intermediary Gaussian output
+    for (int ti = threadIdx.x; ti < BW * (BH + half * 2); ti += blockDim.x)
+    {
+        tc.x = ti % BW;
+        tc.y = ti / BW;
+        pc.y = tc.y;
+        pc.x = tc.x + half;
+        mc.x = 0;
+        mc.y = tc.y;
+
+        result = gaussIn[pc] * gaussSepKernel[half];
+
+        for (int kx = 0; kx < half; ++kx)
+        {
+            pc.x = tc.x + kx;
+            mc.x = tc.x + 2 * half - kx;
+
+            result += (gaussIn[pc] + gaussIn[mc]) * gaussSepKernel[kx]; // first separable convolution
+        }
+
+        gaussOut[tc] = result;
+    }
+
+    __syncthreads(); // wait for the intermediary (separable) Gaussian filtering output data to be ready
+
+    // DoG pyramid is the Difference of Gaussians: next layer - current layer, within the same octave.
+    // [ O=0: [ L=0: DoG of GaussianPyr (O=0 L=1) - (O=0 L=0); L=1: DoG of GaussianPyr (O=0 L=2) - (O=0 L=1); ... ]
+    //   O=1: [ L=0: DoG of GaussianPyr (O=1 L=1) - (O=1 L=0); ... ] ] <- DoG pyramid
+
+    // Fourth loop runs threads in 2D to compute final block of Gaussian filter and DoG
+    for (int ti = threadIdx.x; ti < BW * BH; ti += blockDim.x)
+    {
+        tc.x = ti % BW;
+        tc.y = ti / BW;
+        gc.x = blockIdx.x * BW + tc.x;
+        gc.y = blockIdx.y * BH + tc.y;
+
+        if (gc.x >= currShape.x || gc.y >= currShape.y)
+        {
+            continue;
+        }
+
+        gc.w = currLayer;
+        pc.x = tc.x;
+        pc.y = tc.y + half;
+        mc.x = tc.x;
+        mc.y = 0;
+
+        result = gaussOut[pc] * gaussSepKernel[half];
+
+        for (int ky = 0; ky < half; ++ky)
+        {
+            pc.y = tc.y + ky;
+            mc.y = tc.y + 2 * half - ky;
+
+            result += (gaussOut[pc] + gaussOut[mc]) * gaussSepKernel[ky]; // second separable convolution
+        }
+
+        currGauss[gc] = result;
+
+        if constexpr (kWithDoG)
+        {
+            if (gc.w == 0)
+            {
+                continue;
+            }
+
+            gc.w -= 1;
+            pc.x = half + tc.x;
+            pc.y = half + tc.y;
+
+            currDoG[gc] = result - gaussIn[pc];
+        }
+    }
+}
+
+// Pyramid computation ---------------------------------------------------------
+
+// Compute the Gaussian pyramid (and, if dog is not null, its DoG pyramid) from an input image: the input is first
+// copied into base (casting from DT to F32 and potentially upscaling it), then each level in gauss is filtered, the
+// number of levels is the size of gauss and each level has numScales + 3 layers; DT is the input data type
+template<typename DT>
+inline __host__ void ComputeGaussianPyramid(const nvcv::TensorDataStridedCuda &inData, const nvcv::Tensor &base,
+                                            const std::vector<nvcv::Tensor> &gauss,
+                                            const std::vector<nvcv::Tensor> *dog, int3 currShape, bool expandInput,
+                                            int numScales, float initSigma, cudaStream_t stream)
+{
+    constexpr int BW = 32; // data block tile width in shared memory (smem) used by compute pyramids kernel
+    constexpr int BH = 32; // data block tile height in shared memory (smem) used by compute pyramids kernel
+
+    int numLevels = (int)gauss.size();
+
+    NVCV_ASSERT(dog == nullptr || numLevels <= (int)dog->size());
+
+    // Block of threads and grid of blocks used by copy and compute pyramid kernels
+    dim3 copyThreads{256, 1, 1};
+    dim3 copyBlocks(util::DivUp(currShape.x, copyThreads.x), currShape.y, currShape.z);
+
+    dim3 compThreads{256, 1, 1};
+    dim3 compBlocks;
+
+    // Copy inData into base, casting from U8 to F32 (and potentially upscaling it)
+
+    auto baseData = ExportLevelData(base);
+
+    TensorWrapLNHW<float> dstBaseWrap(baseData);
+
+    if (expandInput)
+    {
+        auto srcBaseWrap = cuda::CreateInterpolationWrapNHW<const DT, kBorderInterp, kInterpUp, int32_t>(inData);
+
+        UpCopy<<<copyBlocks, copyThreads, 0, stream>>>(dstBaseWrap, srcBaseWrap, currShape); // upscale copy
+    }
+    else
+    {
+        auto srcBaseWrap = cuda::CreateTensorWrapNHW<const DT, int32_t>(inData);
+
+        Copy<<<copyBlocks, copyThreads, 0, stream>>>(dstBaseWrap, srcBaseWrap, currShape); // direct copy
+    }
+
+    // Set sigma scale, current and base sigma for Gaussian filter kernel computation
+
+    int   sigmaScale = (expandInput ? 4 : 1); // due to source scaled up by 2x in each dimension
+    float currSigma  = cuda::sqrt(cuda::max(initSigma * initSigma - kPrevSigma * kPrevSigma * sigmaScale, kMinSigma));
+    float baseSigma  = cuda::pow(2.f, 1.f / numScales);
+
+    cuda::math::Vector<float, kMaxKernelSize> gaussSepKernel; // separable Gaussian filter kernel
+
+    for (int level = 0; level < numLevels; level++)
+    {
+        if (level > 0)
+        {
+            currSigma = initSigma; // for every level after first, the current sigma is the initial sigma
+        }
+
+        // Set previous and current level Gaussian and DoG (Difference of Gaussians) pyramid data, the previous
+        // level of the first level is the base image
+
+        auto prevGaussData = (level == 0) ? baseData : ExportLevelData(gauss[level - 1]);
+        auto currGaussData = ExportLevelData(gauss[level]);
+
+        // Using BorderWrap (BW) when border handling is needed and TensorWrap (TW) when not
+
+        TensorWrapLNHW<float> prevGaussTW(prevGaussData);
+        TensorWrapLNHW<float> currGaussTW(currGaussData);
+        BorderWrapLNHW<float> prevGaussBW(prevGaussData);
+        BorderWrapLNHW<float> currGaussBW(currGaussData);
+        TensorWrapLNHW<float> currDoGTW;
+
+        if (dog != nullptr)
+        {
+            currDoGTW = TensorWrapLNHW<float>(ExportLevelData((*dog)[level]));
+        }
+
+        copyBlocks = dim3(util::DivUp(currShape.x, copyThreads.x), currShape.y, currShape.z);
+        compBlocks = dim3(util::DivUp(currShape.x, BW), util::DivUp(currShape.y, BH), currShape.z);
+
+        // For each layer up to numScales +3 to have +1 for DoG and +2 for top/bottom neihbors
+        for (int layer = 0; layer < numScales + 3; layer++)
+        {
+            if (layer == 0 && level > 0)
+            {
+                // First layer of every level after first skips Gaussian blur and does only a downscale copy
+                DownCopy<<<copyBlocks, copyThreads, 0, stream>>>(currGaussTW, prevGaussTW, currShape, numScales);
+                continue;
+            }
+
+            if (layer > 0)
+            {
+                // Update current sigma for every layer after the first
+                float prevSigma  = cuda::pow(baseSigma, (float)(layer - 1)) * initSigma;
+                float totalSigma = baseSigma * prevSigma;
+                currSigma        = std::sqrt(totalSigma * totalSigma - prevSigma * prevSigma);
+            }
+
+            // Compute the separable Gaussian filter kernel for the Gaussian pyramid
+            int   ksize = ComputeGaussianKernelSize(currSigma);
+            int   half  = ksize / 2;
+            float ss2   = currSigma * currSigma * 2;
+            float sp2   = currSigma * cuda::sqrt(M_PI * 2);
+            float sum   = 0.f;
+
+            for (int kx = -half; kx <= half; ++kx)
+            {
+                // Compute separable Gaussian function value using its half-equation
+                float w = cuda::exp(-((kx * kx) / ss2)) / sp2;
+
+                sum += w;
+
+                gaussSepKernel[half + kx] = w;
+            }
+            for (int kx = -half; kx <= half; ++kx)
+            {
+                gaussSepKernel[half + kx] /= sum;
+            }
+
+            // Only for the first level and first layer the base image is used as previous Gaussian data, for every
+            // other level and layer the current Gaussian data (border-aware) is used
+
+            const BorderWrapLNHW<float> &srcGaussBW = (level == 0 && layer == 0) ? prevGaussBW : currGaussBW;
+
+            // Run the DoComputePyramids kernel to compute the Gaussian and DoG pyramids
+
+            if (dog != nullptr)
+            {
+                DoComputePyramids<BW, BH, true><<<compBlocks, compThreads, 0, stream>>>(
+                    srcGaussBW, currGaussTW, currDoGTW, currShape, layer, ksize, gaussSepKernel);
+            }
+            else
+            {
+                DoComputePyramids<BW, BH, false><<<compBlocks, compThreads, 0, stream>>>(
+                    srcGaussBW, currGaussTW, currDoGTW, currShape, layer, ksize, gaussSepKernel);
+            }
+        }
+
+        currShape.x /= 2;
+        currShape.y /= 2;
+    }
+}
+
+// Compute the DoG (Difference of Gaussians) pyramid from a previously computed Gaussian pyramid
+inline __host__ void ComputeDoGPyramid(const std::vector<nvcv::Tensor> &gauss, const std::vector<nvcv::Tensor> &dog,
+                                       int3 currShape, int numScales, cudaStream_t stream)
+{
+    NVCV_ASSERT(gauss.size() <= dog.size());
+
+    dim3 threads{256, 1, 1};
+
+    for (size_t level = 0; level < gauss.size(); level++)
+    {
+        TensorWrapLNHW<const float> gaussWrap(ExportLevelData(gauss[level]));
+        TensorWrapLNHW<float>       dogWrap(ExportLevelData(dog[level]));
+
+        dim3 blocks(util::DivUp(currShape.x, threads.x), currShape.y, currShape.z);
+
+        DoComputeDoG<<<blocks, threads, 0, stream>>>(gaussWrap, dogWrap, currShape, numScales + 2);
+
+        currShape.x /= 2;
+        currShape.y /= 2;
+    }
+}
+
+} // namespace cvcuda::priv::pyramid
+
+#endif // CVCUDA_PRIV_PYRAMID_UTIL_CUH
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file WarpClassifier.hpp
+ *
+ * @brief Host side classification of WarpAffine and WarpPerspective matrices into the cases with dedicated kernels.
+ */
+
+#ifndef CVCUDA_PRIV_WARP_CLASSIFIER_HPP
+#define CVCUDA_PRIV_WARP_CLASSIFIER_HPP
+
+#include <cmath>
+#include <cstring>
+
+namespace cvcuda::priv::warp {
+
+enum class WarpClass
+{
+    GENERAL,    // any other transform, per-pixel matrix product and interpolation
+    IDENTITY,   // copy
+    TRANSLATE,  // shift by whole pixels
+    SCALE,      // axis-aligned scale and any translation, e.g. letterboxing or crop-and-zoom
+    ROTATE_90,  // 90 degrees clockwise as displayed, with a shift by whole pixels
+    ROTATE_180, // 180 degrees, with a shift by whole pixels
+    ROTATE_270  // 90 degrees counter-clockwise as displayed, with a shift by whole pixels
+};
+
+// Linear coefficients are compared with kCoeffTolerance, a residual of 1e-6 moves pixels of an 8K image by less than
+// 1% of a pixel, and cos(90 degrees) in float is 4e-8. Offsets must be within kOffsetTolerance of a whole pixel to be
+// sampled without interpolation, which covers the float error of rotations about the center of large images.
+constexpr double kCoeffTolerance  = 1e-6;
+constexpr double kOffsetTolerance = 1e-3;
+
+/**
+ * Classified transform, as the map from destination to source pixels:
+ *   src.x = xform[0] * x + xform[1] * y + xform[2]
+ *   src.y = xform[3] * x + xform[4] * y + xform[5]
+ * Coefficients are snapped to the exact values of the class, and offsets to whole pixels for all classes but
+ * SCALE and GENERAL.
+ */
+struct WarpMap
+{
+    WarpClass type;
+    float     xform[6];
+};
+
+/**
+ * Classifies a warp matrix.
+ *
+ * @param M            Row-major matrix as given to the operator, 2x3 for affine and 3x3 for perspective.
+ * @param perspective  Whether M is 3x3, only perspective matrices with a last row of (0, 0, w) are classified.
+ * @param invert       Whether M maps source to destination pixels and must be inverted, that is when the
+ *                     NVCV_WARP_INVERSE_MAP flag is not set.
+ */
+inline WarpMap Classify(const float *M, bool perspective, bool invert)
+{
+    WarpMap map{WarpClass::GENERAL, {}};
+
+    double m[6];
+    if (perspective)
+    {
+        if (M[6] != 0.f || M[7] != 0.f || M[8] == 0.f)
+        {
+            return map;
+        }
+        for (int i = 0; i < 6; ++i)
+        {
+            m[i] = static_cast<double>(M[i]) / M[8];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            m[i] = M[i];
+        }
+    }
+
+    if (invert)
+    {
+        double den = m[0] * m[4] - m[1] * m[3];
+        if (std::abs(den) <= 1e-5)
+        {
+            return map;
+        }
+        den = 1. / den;
+
+        double inv[6] = {m[4] * den,  -m[1] * den, (m[1] * m[5] - m[4] * m[2]) * den,
+                         -m[3] * den, m[0] * den,  (m[3] * m[2] - m[0] * m[5]) * den};
+        std::memcpy(m, inv, sizeof(m));
+    }
+
+    for (int i = 0; i < 6; ++i)
+    {
+        map.xform[i] = static_cast<float>(m[i]);
+    }
+
+    auto isCoeff   = [](double v, double ref) { return std::abs(v - ref) <= kCoeffTolerance; };
+    auto isWhole   = [](double v) { return std::abs(v - std::round(v)) <= kOffsetTolerance; };
+    auto setCoeffs = [&map, &m](WarpClass type, float a, float b, float d, float e)
+    {
+        map = {type, {a, b, static_cast<float>(std::round(m[2])), d, e, static_cast<float>(std::round(m[5]))}};
+    };
+
+    bool wholeOffsets = isWhole(m[2]) && isWhole(m[5]);
+
+    if (isCoeff(m[1], 0) && isCoeff(m[3], 0))
+    {
+        if (isCoeff(m[0], 1) && isCoeff(m[4], 1) && wholeOffsets)
+        {
+            setCoeffs(std::round(m[2]) == 0 && std::round(m[5]) == 0 ? WarpClass::IDENTITY : WarpClass::TRANSLATE, 1,
+                      0, 0, 1);
+        }
+        else if (isCoeff(m[0], -1) && isCoeff(m[4], -1) && wholeOffsets)
+        {
+            setCoeffs(WarpClass::ROTATE_180, -1, 0, 0, -1);
+        }
+        else if (!isCoeff(m[0], 0) && !isCoeff(m[4], 0))
+        {
+            map.type     = WarpClass::SCALE;
+            map.xform[1] = map.xform[3] = 0.f;
+        }
+    }
+    else if (isCoeff(m[0], 0) && isCoeff(m[4], 0) && wholeOffsets)
+    {
+        // Transposes (both signs equal) are not rotations and stay on the general path
+        if (isCoeff(m[1], 1) && isCoeff(m[3], -1))
+        {
+            setCoeffs(WarpClass::ROTATE_90, 0, 1, -1, 0);
+        }
+        else if (isCoeff(m[1], -1) && isCoeff(m[3], 1))
+        {
+            setCoeffs(WarpClass::ROTATE_270, 0, -1, 1, 0);
+        }
+    }
+
+    return map;
+}
+
+// Parses the CVCUDA_WARP_ALGO override, "general" disables the dedicated kernels, anything else keeps them
+inline bool FastPathEnabled(const char *value)
+{
+    return value == nullptr || std::strcmp(value, "general") != 0;
+}
+
+} // namespace cvcuda::priv::warp
+
+#endif // CVCUDA_PRIV_WARP_CLASSIFIER_HPP
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file YUVConstants.hpp
+ *
+ * @brief Defines the fixed-point RGB <-> YUV conversion constants of the supported color specs.
+ */
+
+#ifndef CVCUDA_PRIV_YUV_CONSTANTS_HPP
+#define CVCUDA_PRIV_YUV_CONSTANTS_HPP
+
+#include <nvcv/ColorSpec.hpp>
+#include <nvcv/Exception.hpp>
+
+namespace cvcuda::priv {
+
+struct RGB2YUVConstants
+{
+    const int R2Y;
+    const int G2Y;
+    const int B2Y;
+    const int B2U;
+    const int R2V;
+};
+
+struct YUV2RGBConstants
+{
+    const int U2B;
+    const int U2G;
+    const int V2G;
+    const int V2R;
+};
+
+/*
+ * YUV conversion formula
+ * Y  = R2YF * r * + G2YF * g + B2YF * b
+ * U = (B - Y) * B2UF
+ * V = (R - Y) * R2VF
+ *
+ */
+// Values per: https://www.itu.int/rec/R-REC-BT.601
+// RGB->YUV conversion constants
+// static constexpr float R2YF_601 = 0.299f;       //Kr 601
+// static constexpr float G2YF_601 = 0.587f;       //Kg 601
+// static constexpr float B2YF_601 = 0.114f;       //Kb 601
+// static constexpr float B2UF_601 = 0.564334086f; // 1.0f/1.772f Cb/U
+// static constexpr float R2VF_601 = 0.713266762;  // 1.0f/1.402f Cr/V
+
+constexpr int R2Y_601 = 4899;  // = R2YF*16384
+constexpr int G2Y_601 = 9671;  // = G2YF*16384
+constexpr int B2Y_601 = 1868;  // = B2YF*16384
+constexpr int B2U_601 = 9246;  // = B2UF*16384 Cb
+constexpr int R2V_601 = 11686; // = R2VF*16384 Cr
+
+// YUV > RGB conversion (inverse of the forward matrix)
+// static constexpr float V2RF_601 = 1.402f;
+// static constexpr float U2GF_601 = -.344f;
+// static constexpr float V2GF_601 = -.714f;
+// static constexpr float U2BF_601 = 1.772f;
+
+constexpr int V2R_601 = 22970;  // = V2RF*16384
+constexpr int U2G_601 = -5636;  // = U2GF*16384
+constexpr int V2G_601 = -11698; // = V2GF*16384
+constexpr int U2B_601 = 29032;  // = U2BF*16384
+
+// Values per: https://www.itu.int/rec/R-REC-BT.709
+// static constexpr float R2YF_709 = 0.2126f;      //Kr 601
+// static constexpr float G2YF_709 = 0.7152f;      //Kg 601
+// static constexpr float B2YF_709 = 0.0772f;      //Kb 601
+// static constexpr float B2UF_709 = 0.538909248f; //1.0f/1.8556f Cb/U
+// static constexpr float R2VF_709 = 0.63500127f;  // 1.0f/1.5748f Cr/V
+
+constexpr int R2Y_709 = 3483;  // = R2YF*16384
+constexpr int G2Y_709 = 11718; // = G2YF*16384
+constexpr int B2Y_709 = 1265;  // = B2YF*16384
+constexpr int B2U_709 = 8829;  // = B2UF*16384 Cb
+constexpr int R2V_709 = 10404; // = R2VF*16384 Cr
+
+// YUV > RGB conversion (inverse of the forward matrix)
+// static constexpr float V2RF_709 = 1.5748f;
+// static constexpr float U2GF_709 = -.187324f;
+// static constexpr float V2GF_709 = -.468124f;
+// static constexpr float U2BF_709 = 1.8556f;
+
+constexpr int V2R_709 = 25802; // = V2RF*16384
+constexpr int U2G_709 = -3069; // = U2GF*16384
+constexpr int V2G_709 = -7670; // = V2GF*16384
+constexpr int U2B_709 = 30402; // = U2BF*16384
+
+// Values per: https://www.itu.int/rec/R-REC-BT.2020
+// static constexpr float R2YF_2020 = 0.2627f;      //Kr 601
+// static constexpr float G2YF_2020 = 0.6780f;      //Kg 601
+// static constexpr float B2YF_2020 = 0.0593f;      //Kb 601
+// static constexpr float B2UF_2020 = 0.531519082f; //1.0f/1.8814f Cb/U
+// static constexpr float R2VF_2020 = 0.678150007f; //1.0f/1.4746f // Cr/V
+
+constexpr int R2Y_2020 = 4304;  // = R2YF*16384
+constexpr int G2Y_2020 = 11108; // = G2YF*16384
+constexpr int B2Y_2020 = 972;   // = B2YF*16384
+constexpr int B2U_2020 = 8708;  // = B2UF*16384 Cb
+constexpr int R2V_2020 = 11111; // = R2VF*16384 Cr
+
+// YUV > RGB conversion (inverse of the forward matrix)
+// static constexpr float V2RF_2020 = 1.4746f;
+// static constexpr float U2GF_2020 = -0.16455;
+// static constexpr float V2GF_2020 = -0.57135f;
+// static constexpr float U2BF_2020 = 1.8814f;
+
+constexpr int V2R_2020 = 24160; // = V2RF*16384
+constexpr int U2G_2020 = -2696; // = U2GF*16384
+constexpr int V2G_2020 = -9361; // = V2GF*16384
+constexpr int U2B_2020 = 30825; // = U2BF*16384
+
+// struct of conversion constants
+inline constexpr RGB2YUVConstants rgb2yuv_601 = {R2Y_601, G2Y_601, B2Y_601, B2U_601, R2V_601};
+inline constexpr YUV2RGBConstants yuv2rgb_601 = {U2B_601, U2G_601, V2G_601, V2R_601};
+
+inline constexpr RGB2YUVConstants rgb2yuv_709 = {R2Y_709, G2Y_709, B2Y_709, B2U_709, R2V_709};
+inline constexpr YUV2RGBConstants yuv2rgb_709 = {U2B_709, U2G_709, V2G_709, V2R_709};
+
+inline constexpr RGB2YUVConstants rgb2yuv_2020 = {R2Y_2020, G2Y_2020, B2Y_2020, B2U_2020, R2V_2020};
+inline constexpr YUV2RGBConstants yuv2rgb_2020 = {U2B_2020, U2G_2020, V2G_2020, V2R_2020};
+
+constexpr int yuv_shift = 14;
+
+inline const RGB2YUVConstants &getRGB2YUVCooef(nvcv::ColorSpec spec)
+{
+    switch (spec)
+    {
+    case NVCV_COLOR_SPEC_BT601:
+        return rgb2yuv_601;
+    case NVCV_COLOR_SPEC_BT709:
+        return rgb2yuv_709;
+    case NVCV_COLOR_SPEC_BT2020:
+        return rgb2yuv_2020;
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Unknown color spec");
+    }
+}
+
+inline const YUV2RGBConstants &getYUV2RGBCooef(nvcv::ColorSpec spec)
+{
+    switch (spec)
+    {
+    case NVCV_COLOR_SPEC_BT601:
+        return yuv2rgb_601;
+    case NVCV_COLOR_SPEC_BT709:
+        return yuv2rgb_709;
+    case NVCV_COLOR_SPEC_BT2020:
+        return yuv2rgb_2020;
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Unknown color spec");
+    }
+}
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_YUV_CONSTANTS_HPP
@@ -18,12 +18,14 @@
 #ifndef CV_CUDA_LEGACY_H
 #define CV_CUDA_LEGACY_H
 
+#include "../Conv2DStrategy.hpp"
 #include "CvCudaOSD.hpp"
 
 #include <cuda_runtime.h>
-#include <curand_kernel.h>
 #include <cvcuda/Types.h>
 #include <cvcuda/Workspace.hpp>
+#include <cvcuda/util/LruCache.hpp>
+#include <cvcuda/util/PerStreamScratch.hpp>
 #include <nvcv/BorderType.h>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/ImageBatchData.hpp>
@@ -31,6 +33,7 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorData.hpp>
 
+#include <atomic>
 #include <random>
 #include <vector>
 
@@ -444,9 +447,9 @@ public:
                     const TensorDataStridedCuda &numPointsInContour, const int totalContours, cudaStream_t stream);
 
 private:
-    int   mMaxContourNum;
-    void *mRotateCoeffsBufDev = nullptr;
-    void *mRotatedPointsDev   = nullptr;
+    int                          mMaxContourNum;
+    void                        *mRotateCoeffsBufDev = nullptr;
+    nvcv::util::PerStreamScratch mRotatedPointsScratch;
 };
 
 class Flip : public CudaBaseOp
@@ -1373,8 +1376,6 @@ public:
 
     Gaussian(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize);
 
-    ~Gaussian();
-
     /**
      * Limitations:
      *
@@ -1433,10 +1434,8 @@ public:
                     double2 sigma, NVCVBorderType borderMode, cudaStream_t stream);
 
 private:
-    Size2D  m_maxKernelSize = {0, 0};
-    Size2D  m_curKernelSize = {0, 0};
-    double2 m_curSigma      = {-1.0, -1.0};
-    float  *m_kernel        = nullptr;
+    Size2D                       m_maxKernelSize = {0, 0};
+    nvcv::util::PerStreamScratch m_scratch;
 };
 
 class Erase : public CudaBaseOp
@@ -1446,8 +1445,6 @@ public:
 
     Erase(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area);
 
-    ~Erase();
-
     /**
      * @brief erase areas of images. Different images in the same batch can be erased differently.
      * @param inData gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
@@ -1471,10 +1468,7 @@ public:
                     unsigned int seed, bool inplace, cudaStream_t stream);
 
 protected:
-    int3  *d_max_values;
-    void  *temp_storage;
-    size_t storage_bytes;
-    int    max_num_erasing_area;
+    int max_num_erasing_area;
 };
 
 class AverageBlur : public CudaBaseOp
@@ -1484,8 +1478,6 @@ public:
 
     AverageBlur(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize);
 
-    ~AverageBlur();
-
     /**
      * Limitations:
      *
@@ -1541,9 +1533,8 @@ public:
                     int2 kernelAnchor, NVCVBorderType borderMode, cudaStream_t stream);
 
 private:
-    Size2D m_maxKernelSize = {0, 0};
-    Size2D m_curKernelSize = {0, 0};
-    float *m_kernel        = nullptr;
+    Size2D                       m_maxKernelSize = {0, 0};
+    nvcv::util::PerStreamScratch m_scratch;
 };
 
 class Conv2DVarShape : public CudaBaseOp
@@ -1551,10 +1542,7 @@ class Conv2DVarShape : public CudaBaseOp
 public:
     Conv2DVarShape() = delete;
 
-    Conv2DVarShape(DataShape max_input_shape, DataShape max_output_shape)
-        : CudaBaseOp(max_input_shape, max_output_shape)
-    {
-    }
+    Conv2DVarShape(DataShape max_input_shape, DataShape max_output_shape);
 
     /**
      * Limitations:
@@ -1620,6 +1608,10 @@ public:
     ErrorCode infer(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
                     const ImageBatchVarShapeDataStridedCuda &kernelData, const TensorDataStridedCuda &kernelAnchorData,
                     NVCVBorderType borderMode, cudaStream_t stream);
+
+private:
+    nvcv::util::PerStreamScratch m_scratch;
+    cvcuda::priv::conv2d::Algo   m_algoRequest; // CVCUDA_CONV2D_ALGO override, read once at creation
 };
 
 class LaplacianVarShape : public CudaBaseOp
@@ -1735,8 +1727,6 @@ public:
 
     EraseVarShape(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area);
 
-    ~EraseVarShape();
-
     /**
     * @brief erase areas of images. Different images in the same batch can be erased differently.
     * @param inbatch gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
@@ -1757,10 +1747,7 @@ public:
                     unsigned int seed, bool inplace, cudaStream_t stream);
 
 protected:
-    int3  *d_max_values;
-    void  *temp_storage;
-    size_t storage_bytes;
-    int    max_num_erasing_area;
+    int max_num_erasing_area;
 };
 
 class GaussianVarShape : public CudaBaseOp
@@ -1770,8 +1757,6 @@ public:
 
     GaussianVarShape(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize, int maxBatchSize);
 
-    ~GaussianVarShape();
-
     /**
      * Limitations:
      *
@@ -1830,9 +1815,9 @@ public:
                     NVCVBorderType borderMode, cudaStream_t stream);
 
 private:
-    Size2D m_maxKernelSize = {0, 0};
-    int    m_maxBatchSize  = 0;
-    float *m_kernel        = nullptr;
+    Size2D                       m_maxKernelSize = {0, 0};
+    int                          m_maxBatchSize  = 0;
+    nvcv::util::PerStreamScratch m_scratch;
 };
 
 class AverageBlurVarShape : public CudaBaseOp
@@ -1842,8 +1827,6 @@ public:
 
     AverageBlurVarShape(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize, int maxBatchSize);
 
-    ~AverageBlurVarShape();
-
     /**
      * Limitations:
      *
@@ -1904,9 +1887,9 @@ public:
                     NVCVBorderType borderMode, cudaStream_t stream);
 
 private:
-    Size2D m_maxKernelSize = {0, 0};
-    int    m_maxBatchSize  = 0;
-    float *m_kernel        = nullptr;
+    Size2D                       m_maxKernelSize = {0, 0};
+    int                          m_maxBatchSize  = 0;
+    nvcv::util::PerStreamScratch m_scratch;
 };
 
 class MedianBlurVarShape : public CudaBaseOp
@@ -1915,7 +1898,6 @@ public:
     MedianBlurVarShape() = delete;
     MedianBlurVarShape(const int maxVarShapeBatchSize);
 
-    ~MedianBlurVarShape();
     /**
      * @brief Blur an image using a median kernel.
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -1936,8 +1918,7 @@ public:
                     const TensorDataStridedCuda &ksize, cudaStream_t stream);
 
 protected:
-    const int        m_maxBatchSize;
-    std::vector<int> m_kernelSizes;
+    const int m_maxBatchSize;
 };
 
 class BilateralFilter : public CudaBaseOp
@@ -2138,10 +2119,7 @@ class WarpAffine : public CudaBaseOp
 public:
     WarpAffine() = delete;
 
-    WarpAffine(DataShape max_input_shape, DataShape max_output_shape)
-        : CudaBaseOp(max_input_shape, max_output_shape)
-    {
-    }
+    WarpAffine(DataShape max_input_shape, DataShape max_output_shape);
 
     /*
      * @brief Applies an affine transformation to an image. Same function as nvcv::warpAffine.
@@ -2157,6 +2135,16 @@ public:
     ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData, const float *xform,
                     const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue,
                     cudaStream_t stream);
+
+    /*
+     * @brief Same as above with one 2x3 matrix per sample read on the device from a [N, 6] or [N, 2, 3] float tensor.
+     */
+    ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                    const TensorDataStridedCuda &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue, cudaStream_t stream);
+
+private:
+    const bool m_fastPath; // false when CVCUDA_WARP_ALGO=general at creation
 };
 
 class WarpPerspective : public CudaBaseOp
@@ -2164,10 +2152,7 @@ class WarpPerspective : public CudaBaseOp
 public:
     WarpPerspective() = delete;
 
-    WarpPerspective(DataShape max_input_shape, DataShape max_output_shape)
-        : CudaBaseOp(max_input_shape, max_output_shape)
-    {
-    }
+    WarpPerspective(DataShape max_input_shape, DataShape max_output_shape);
 
     /*
      * @brief Applies a perspective transformation to an image. Same function as nvcv::warpPerspective.
@@ -2191,6 +2176,17 @@ public:
     ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData, const float *transMatrix,
                     const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue,
                     cudaStream_t stream);
+
+    /*
+     * @brief Same as above with one 3x3 matrix per sample read on the device from a [N, 9] or [N, 3, 3] float tensor,
+     * e.g. the output of FindHomography.
+     */
+    ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                    const TensorDataStridedCuda &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue, cudaStream_t stream);
+
+private:
+    const bool m_fastPath; // false when CVCUDA_WARP_ALGO=general at creation
 };
 
 class WarpPerspectiveVarShape : public CudaBaseOp
@@ -2200,8 +2196,6 @@ public:
 
     WarpPerspectiveVarShape(const int32_t maxBatchSize);
 
-    ~WarpPerspectiveVarShape();
-
     /**
      * @brief Applies a perspective transformation to an image. Same function as nvcv::warpPerspective.
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -2231,7 +2225,6 @@ public:
 
 protected:
     const int m_maxBatchSize;
-    float    *m_transformationMatrix = nullptr;
 };
 
 class WarpAffineVarShape : public CudaBaseOp
@@ -2241,7 +2234,6 @@ public:
 
     WarpAffineVarShape(const int32_t maxBatchSize);
 
-    ~WarpAffineVarShape();
     /**
      * @brief Applies an affine transformation to an image. Same function as nvcv::warpAffine.
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -2270,7 +2262,6 @@ public:
 
 protected:
     const int m_maxBatchSize;
-    float    *m_transformationMatrix = nullptr;
 };
 
 class CvtColorVarShape : public CudaBaseOp
@@ -2405,6 +2396,34 @@ public:
 
     NVCVWorkspaceRequirements getWorkspaceRequirements(DataShape max_input_shape, DataShape max_output_shape,
                                                        DataType max_data_type);
+
+    /**
+     * @brief Resampling plan: the horizontal and vertical coefficient and bound tables of one geometry and filter,
+     * computed once on the host and kept in device memory.
+     */
+    struct Plan;
+
+    // Identifies a plan: input size and ROI, output size and filter
+    struct PlanKey
+    {
+        int32_t               inWidth, inHeight;
+        int32_t               outWidth, outHeight;
+        NVCVRectI             roi;
+        NVCVInterpolationType interpolation;
+
+        bool operator==(const PlanKey &other) const;
+    };
+
+    struct PlanKeyHash
+    {
+        size_t operator()(const PlanKey &key) const;
+    };
+
+    // Video streams resize the same geometry over and over, a few plans cover them
+    static constexpr size_t kMaxPlans = 32;
+
+private:
+    nvcv::util::LruCache<PlanKey, Plan, PlanKeyHash> m_plans{kMaxPlans};
 };
 
 class PillowResizeVarShape : public CudaBaseOp
@@ -2488,9 +2507,9 @@ public:
                     const int32_t blockSize, const double c, cudaStream_t stream);
 
 private:
-    int   m_blockSize      = -1;
-    int   m_adaptiveMethod = -1;
-    void *m_kernel         = nullptr;
+    int                          m_blockSize = -1; // block size of the Gaussian kernel in m_kernel
+    void                        *m_kernel    = nullptr;
+    nvcv::util::PerStreamScratch m_scratch; // integral image of the MEAN_C path
 };
 
 class AdaptiveThresholdVarShape : public CudaBaseOp
@@ -2522,9 +2541,10 @@ public:
                     const TensorDataStridedCuda &c, cudaStream_t stream);
 
 private:
-    const int m_maxBatchSize;
-    const int m_maxBlockSize;
-    void     *m_kernel = nullptr;
+    const int                    m_maxBatchSize;
+    const int                    m_maxBlockSize;
+    void                        *m_kernel = nullptr;
+    nvcv::util::PerStreamScratch m_scratch; // integral images of the MEAN_C path
 };
 
 class ThresholdVarShape : public CudaBaseOp
@@ -2556,6 +2576,26 @@ private:
     uint32_t m_automatic_thresh;
 };
 
+// Distribution of the random crops of one call, each sample draws from its own Philox stream
+struct CropDistribution
+{
+    double             minScale;
+    double             maxScale;
+    double             minRatio;
+    double             maxRatio;
+    unsigned long long seed;
+    uint32_t           epoch;
+};
+
+// Per-sample parameters consumed by the resize kernels, in device memory
+struct CropParams
+{
+    float *scaleY;
+    float *scaleX;
+    int   *tops;
+    int   *lefts;
+};
+
 class RandomResizedCrop : public CudaBaseOp
 {
 public:
@@ -2565,38 +2605,44 @@ public:
                       const double max_scale, const double min_ratio, const double max_ratio, int32_t maxBatchSize,
                       uint32_t seed);
 
-    ~RandomResizedCrop();
-
     /**
      * @brief Resize and crop images
      * @param inData gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
      * @param outData gpu pointer, outputs[0] are batched output images that have the size dsize and the same type as
      * data_type.
      * @param interpolation the interpolation used in resize implementation
+     * @param inCrops optional crops (x, y, width, height) to use instead of random ones.
+     * @param outCrops optional tensor receiving the crops used.
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                    const NVCVInterpolationType interpolation, cudaStream_t stream);
+                    const NVCVInterpolationType interpolation, OptionalTensorConstRef inCrops,
+                    OptionalTensorConstRef outCrops, cudaStream_t stream);
 
     /**
-     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @brief calculate the gpu buffer size needed by this operator
      * @param batch_size input batch size
      */
     size_t calBufferSize(int batch_size);
 
 protected:
-    void getCropParams(int input_rows, int input_cols, int *top_indices, int *left_indices, int *crop_rows,
-                       int *crop_cols);
+    // Splits a gpu buffer of calBufferSize(batch_size) bytes into the per-sample resize parameters
+    static CropParams getCropParams(void *buffer, int batch_size);
+
+    // Distribution of the crops of the next call, each call gets a new epoch
+    CropDistribution nextCropDistribution();
 
 protected:
-    double       min_scale_;
-    double       max_scale_;
-    double       min_ratio_;
-    double       max_ratio_;
-    std::mt19937 generator_;
-    int32_t      m_maxBatchSize;
-    void        *m_cpuCropParams = nullptr;
-    void        *m_gpuCropParams = nullptr;
+    double                min_scale_;
+    double                max_scale_;
+    double                min_ratio_;
+    double                max_ratio_;
+    uint64_t              m_seed;
+    std::atomic<uint32_t> m_epoch{0}; // bumped every call so crops differ between calls
+    int32_t               m_maxBatchSize;
+
+    // Per-sample resize parameters written by the crop sampling kernel and read by the resize kernel of one call
+    nvcv::util::PerStreamScratch m_scratch;
 };
 
 class RandomResizedCropVarShape : public RandomResizedCrop
@@ -2615,10 +2661,13 @@ public:
      * @param outData gpu pointer, outputs[i] is output image where i ranges from 0 to batch-1, whose size is dsize[i]
      * and type is data_type.
      * @param interpolation the interpolation used in resize implementation
+     * @param inCrops optional crops (x, y, width, height) to use instead of random ones.
+     * @param outCrops optional tensor receiving the crops used.
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const ImageBatchVarShape &inData, const ImageBatchVarShape &outData,
-                    const NVCVInterpolationType interpolation, cudaStream_t stream);
+                    const NVCVInterpolationType interpolation, OptionalTensorConstRef inCrops,
+                    OptionalTensorConstRef outCrops, cudaStream_t stream);
 };
 
 class GaussianNoise : public CudaBaseOp
@@ -2628,8 +2677,6 @@ public:
 
     GaussianNoise(DataShape max_input_shape, DataShape max_output_shape, int maxBatchSize);
 
-    ~GaussianNoise();
-
     /**
      * @brief Add gaussian noise on images.
      * @param inData gpu pointer, batched input images.
@@ -2643,12 +2690,8 @@ public:
     ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                     const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma, bool per_channel,
                     unsigned long long seed, cudaStream_t stream);
-
 private:
-    curandState       *m_states;
-    unsigned long long m_seed;
-    bool               m_setupDone = false;
-    int                m_maxBatchSize;
+    std::atomic<uint32_t> m_epoch{0}; // bumped every call so the noise differs between calls
 };
 
 class GaussianNoiseVarShape : public CudaBaseOp
@@ -2658,8 +2701,6 @@ public:
 
     GaussianNoiseVarShape(DataShape max_input_shape, DataShape max_output_shape, int maxBatchSize);
 
-    ~GaussianNoiseVarShape();
-
     /**
      * @brief Add gaussian noise on images.
      * @param inData gpu pointer, batched input images.
@@ -2673,12 +2714,8 @@ public:
     ErrorCode infer(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
                     const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma, bool per_channel,
                     unsigned long long seed, cudaStream_t stream);
-
 private:
-    curandState       *m_states;
-    unsigned long long m_seed;
-    bool               m_setupDone = false;
-    int                m_maxBatchSize;
+    std::atomic<uint32_t> m_epoch{0}; // bumped every call so the noise differs between calls
 };
 
 class Histogram : public CudaBaseOp
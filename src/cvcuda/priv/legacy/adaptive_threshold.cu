@@ -18,6 +18,7 @@
  * limitations under the License.
 */
 
+#include "../IntegralImage.cuh"
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
@@ -125,6 +126,89 @@ __global__ void adaptive_threshold(SrcWrapper src, DstWrapper dst, Size2D dstSiz
     }
 }
 
+// MEAN_C thresholds against the window mean computed from the integral image of the input, in constant time for any
+// block size.  The window sum is exact so the mean is rounded once, instead of accumulating rounded weights.
+template<typename CMP, typename A, typename SrcWrapper, typename DstWrapper, typename SumWrapper>
+__global__ void adaptive_threshold_mean(SrcWrapper src, DstWrapper dst, SumWrapper sum, Size2D dstSize,
+                                        const uchar maxValue, const int blockSize, const int idelta)
+{
+    const int batch_idx = get_batch_idx();
+    const int out_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int out_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    if (out_x >= dstSize.w || out_y >= dstSize.h)
+        return;
+
+    const A area   = static_cast<A>(blockSize) * blockSize;
+    A       boxSum = cvcuda::priv::integral::BoxSumReplicate<A>(sum, batch_idx, int2{dstSize.w, dstSize.h}, out_x,
+                                                               out_y, blockSize >> 1);
+    // area is odd so the mean is never halfway between two integers, rounding half up matches rounding to nearest
+    int mean = static_cast<int>((boxSum + area / 2) / area);
+
+    CMP cmp;
+    *dst.ptr(batch_idx, out_y, out_x) = cmp(*src.ptr(batch_idx, out_y, out_x) + idelta, mean) ? maxValue : 0;
+}
+
+template<typename CMP, typename A>
+ErrorCode adaptive_threshold_mean_caller(const TensorDataStridedCuda &in, const TensorDataStridedCuda &out,
+                                         const uchar maxValue, const int blockSize, const int idelta,
+                                         nvcv::util::PerStreamScratch &scratch, cudaStream_t stream)
+{
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(out);
+    NVCV_ASSERT(outAccess);
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(in);
+    NVCV_ASSERT(inAccess);
+
+    int64_t inMaxStride  = inAccess->sampleStride() * inAccess->numSamples();
+    int64_t outMaxStride = outAccess->sampleStride() * outAccess->numSamples();
+    if (std::max(inMaxStride, outMaxStride) > cuda::TypeTraits<int32_t>::max)
+    {
+        LOG_ERROR("Input or output size exceeds " << cuda::TypeTraits<int32_t>::max << ". Tensor is too large.");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    Size2D dstSize{outAccess->numCols(), outAccess->numRows()};
+    int    numSamples = outAccess->numSamples();
+
+    // The integral image has one more row and column than the input, with zeros in the first ones
+    int64_t rowStride    = (dstSize.w + 1) * sizeof(A);
+    int64_t sampleStride = (dstSize.h + 1) * rowStride;
+    auto    integral     = scratch.acquire(sampleStride * numSamples, stream);
+
+    auto src = cuda::CreateTensorWrapNHW<const uchar, int32_t>(in);
+    auto dst = cuda::CreateTensorWrapNHW<uchar, int32_t>(out);
+
+    cuda::Tensor4DWrap<A> sum(integral.data<A>(), sampleStride, rowStride, static_cast<int64_t>(sizeof(A)));
+
+    cvcuda::priv::integral::Integrate<false, A>(stream, cuda::CreateTensorWrapNHWC<const uchar>(in), sum,
+                                                int2{dstSize.w, dstSize.h}, 1, numSamples);
+    checkKernelErrors();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(dstSize.w, block.x), divUp(dstSize.h, block.y), numSamples);
+
+    adaptive_threshold_mean<CMP, A><<<grid, block, 0, stream>>>(src, dst, sum, dstSize, maxValue, blockSize, idelta);
+
+    checkKernelErrors();
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+    return ErrorCode::SUCCESS;
+}
+
+template<typename CMP>
+ErrorCode adaptive_threshold_mean_caller(const TensorDataStridedCuda &in, const TensorDataStridedCuda &out,
+                                         const uchar maxValue, const int blockSize, const int idelta,
+                                         nvcv::util::PerStreamScratch &scratch, cudaStream_t stream)
+{
+    if (blockSize <= cvcuda::priv::integral::kMaxBoxSizeU8Sum32)
+    {
+        return adaptive_threshold_mean_caller<CMP, uint32_t>(in, out, maxValue, blockSize, idelta, scratch, stream);
+    }
+    return adaptive_threshold_mean_caller<CMP, uint64_t>(in, out, maxValue, blockSize, idelta, scratch, stream);
+}
+
 template<typename T, NVCVBorderType B, typename CMP, class KernelWrapper>
 ErrorCode adaptive_threshold_caller(const TensorDataStridedCuda &in, const TensorDataStridedCuda &out,
                                     const uchar maxValue, KernelWrapper kernel, const int blockSize, const int idelta,
@@ -253,32 +337,36 @@ ErrorCode AdaptiveThreshold::infer(const TensorDataStridedCuda &in, const Tensor
         return ErrorCode::INVALID_PARAMETER;
     }
 
-    float *kernelPtr = (float *)m_kernel;
-    if (m_adaptiveMethod != adaptiveMethod || m_blockSize != blockSize)
+    uchar imaxval = cuda::SaturateCast<uchar>(maxValue);
+    int   idelta  = thresholdType == NVCV_THRESH_BINARY ? (int)std::ceil(c) : (int)std::floor(c);
+
+    if (adaptiveMethod == NVCV_ADAPTIVE_THRESH_MEAN_C)
     {
-        if (adaptiveMethod == NVCV_ADAPTIVE_THRESH_MEAN_C)
+        if (thresholdType == NVCV_THRESH_BINARY)
         {
-            int kSize = blockSize * blockSize;
-            computeMeanKernel<<<1, kSize, 0, stream>>>(kernelPtr, kSize);
+            return adaptive_threshold_mean_caller<MyGreater<int>>(in, out, imaxval, blockSize, idelta, m_scratch,
+                                                                  stream);
         }
-        else
-        {
-            dim3    block(32, 4);
-            dim3    grid(divUp(blockSize, block.x), divUp(blockSize, block.y));
-            Size2D  kernelSize{blockSize, blockSize};
-            double2 sigma;
-            sigma.x = 0.3 * ((blockSize - 1) * 0.5 - 1) + 0.8;
-            sigma.y = sigma.x;
-
-            computeGaussianKernel<<<grid, block, 0, stream>>>(kernelPtr, kernelSize, sigma);
-        }
-        m_adaptiveMethod = adaptiveMethod;
-        m_blockSize      = blockSize;
+        return adaptive_threshold_mean_caller<MyLessEqual<int>>(in, out, imaxval, blockSize, idelta, m_scratch,
+                                                                stream);
+    }
+
+    float *kernelPtr = (float *)m_kernel;
+    if (m_blockSize != blockSize)
+    {
+        dim3    block(32, 4);
+        dim3    grid(divUp(blockSize, block.x), divUp(blockSize, block.y));
+        Size2D  kernelSize{blockSize, blockSize};
+        double2 sigma;
+        sigma.x = 0.3 * ((blockSize - 1) * 0.5 - 1) + 0.8;
+        sigma.y = sigma.x;
+
+        computeGaussianKernel<<<grid, block, 0, stream>>>(kernelPtr, kernelSize, sigma);
+
+        m_blockSize = blockSize;
     }
     checkKernelErrors();
 
-    uchar imaxval = cuda::SaturateCast<uchar>(maxValue);
-    int   idelta  = thresholdType == NVCV_THRESH_BINARY ? (int)std::ceil(c) : (int)std::floor(c);
     if (thresholdType == NVCV_THRESH_BINARY)
     {
         return adaptive_threshold_caller<uchar, NVCV_BORDER_REPLICATE, MyGreater<int>>(in, out, imaxval, kernelPtr,
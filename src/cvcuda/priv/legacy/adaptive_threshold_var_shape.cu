@@ -18,6 +18,7 @@
  * limitations under the License.
 */
 
+#include "../IntegralImage.cuh"
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
@@ -137,6 +138,99 @@ __global__ void adaptive_threshold(const SrcWrapper src, DstWrapper dst,
     }
 }
 
+// MEAN_C thresholds against the window mean computed from the integral image of the input, in constant time for any
+// block size, see the tensor version
+template<typename CMP, cuda::RoundMode RM, typename A, typename SrcWrapper, typename DstWrapper, typename SumWrapper>
+__global__ void adaptive_threshold_mean(const SrcWrapper src, DstWrapper dst, SumWrapper sum,
+                                        cuda::Tensor1DWrap<double, int32_t> maxValueArr,
+                                        cuda::Tensor1DWrap<int, int32_t>    blockSizeArr,
+                                        cuda::Tensor1DWrap<double, int32_t> cArr)
+{
+    const int batch_idx  = get_batch_idx();
+    const int out_x      = blockIdx.x * blockDim.x + threadIdx.x;
+    const int out_y      = blockIdx.y * blockDim.y + threadIdx.y;
+    const int out_height = dst.height(batch_idx), out_width = dst.width(batch_idx);
+    if (out_x >= out_width || out_y >= out_height)
+        return;
+
+    const int kbs    = blockSizeArr[batch_idx];
+    const A   area   = static_cast<A>(kbs) * kbs;
+    A         boxSum = cvcuda::priv::integral::BoxSumReplicate<A>(sum, batch_idx, int2{out_width, out_height}, out_x,
+                                                               out_y, kbs >> 1);
+    int       mean   = static_cast<int>((boxSum + area / 2) / area);
+
+    CMP         cmp;
+    const uchar maxv  = cuda::SaturateCast<uchar>(maxValueArr[batch_idx]);
+    const int   delta = cuda::round<RM>(cArr[batch_idx]);
+
+    *dst.ptr(batch_idx, out_y, out_x) = cmp(*src.ptr(batch_idx, out_y, out_x) + delta, mean) ? maxv : 0;
+}
+
+template<typename CMP, typename A>
+void adaptive_threshold_mean_caller(const ImageBatchVarShapeDataStridedCuda &in,
+                                    const ImageBatchVarShapeDataStridedCuda &out,
+                                    cuda::Tensor1DWrap<double, int32_t>      maxValueArr,
+                                    NVCVThresholdType thresholdType, cuda::Tensor1DWrap<int, int32_t> blockSizeArr,
+                                    cuda::Tensor1DWrap<double, int32_t> cArr, nvcv::util::PerStreamScratch &scratch,
+                                    cudaStream_t stream)
+{
+    cuda::ImageBatchVarShapeWrap<const uchar> src(in);
+    cuda::ImageBatchVarShapeWrap<uchar>       dst(out);
+
+    int2 maxSize{in.maxSize().w, in.maxSize().h};
+
+    // Each integral image is stored in a slot of the size of the largest one
+    int64_t rowStride    = (maxSize.x + 1) * sizeof(A);
+    int64_t sampleStride = (maxSize.y + 1) * rowStride;
+    auto    integral     = scratch.acquire(sampleStride * in.numImages(), stream);
+
+    cuda::Tensor4DWrap<A> sum(integral.data<A>(), sampleStride, rowStride, static_cast<int64_t>(sizeof(A)));
+
+    cvcuda::priv::integral::Integrate<false, A>(stream, cuda::ImageBatchVarShapeWrapNHWC<const uchar>(in, 1), sum,
+                                                maxSize, 1, in.numImages());
+    checkKernelErrors();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(maxSize.x, block.x), divUp(maxSize.y, block.y), out.numImages());
+
+    if (thresholdType == NVCV_THRESH_BINARY)
+    {
+        adaptive_threshold_mean<CMP, cuda::RoundMode::UP, A>
+            <<<grid, block, 0, stream>>>(src, dst, sum, maxValueArr, blockSizeArr, cArr);
+    }
+    else
+    {
+        adaptive_threshold_mean<CMP, cuda::RoundMode::DOWN, A>
+            <<<grid, block, 0, stream>>>(src, dst, sum, maxValueArr, blockSizeArr, cArr);
+    }
+
+    checkKernelErrors();
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+template<typename CMP>
+void adaptive_threshold_mean_caller(const ImageBatchVarShapeDataStridedCuda &in,
+                                    const ImageBatchVarShapeDataStridedCuda &out,
+                                    cuda::Tensor1DWrap<double, int32_t>      maxValueArr,
+                                    NVCVThresholdType thresholdType, cuda::Tensor1DWrap<int, int32_t> blockSizeArr,
+                                    cuda::Tensor1DWrap<double, int32_t> cArr, int maxBlockSize,
+                                    nvcv::util::PerStreamScratch &scratch, cudaStream_t stream)
+{
+    if (maxBlockSize <= cvcuda::priv::integral::kMaxBoxSizeU8Sum32)
+    {
+        adaptive_threshold_mean_caller<CMP, uint32_t>(in, out, maxValueArr, thresholdType, blockSizeArr, cArr, scratch,
+                                                      stream);
+    }
+    else
+    {
+        adaptive_threshold_mean_caller<CMP, uint64_t>(in, out, maxValueArr, thresholdType, blockSizeArr, cArr, scratch,
+                                                      stream);
+    }
+}
+
 template<typename D, NVCVBorderType B, typename CMP>
 void adaptive_threshold_caller(const ImageBatchVarShapeDataStridedCuda &in,
                                const ImageBatchVarShapeDataStridedCuda &out,
@@ -270,6 +364,21 @@ ErrorCode AdaptiveThresholdVarShape::infer(const ImageBatchVarShapeDataStridedCu
     cuda::Tensor1DWrap<int, int32_t>    blockSizeArr(blockSize);
     cuda::Tensor1DWrap<double, int32_t> cArr(c);
 
+    if (adaptiveMethod == NVCV_ADAPTIVE_THRESH_MEAN_C)
+    {
+        if (thresholdType == NVCV_THRESH_BINARY)
+        {
+            adaptive_threshold_mean_caller<MyGreater<int>>(in, out, maxValueArr, thresholdType, blockSizeArr, cArr,
+                                                           m_maxBlockSize, m_scratch, stream);
+        }
+        else
+        {
+            adaptive_threshold_mean_caller<MyLessEqual<int>>(in, out, maxValueArr, thresholdType, blockSizeArr, cArr,
+                                                             m_maxBlockSize, m_scratch, stream);
+        }
+        return ErrorCode::SUCCESS;
+    }
+
     int kernelPitch2 = static_cast<int>(m_maxBlockSize * sizeof(float));
     int kernelPitch1 = m_maxBlockSize * kernelPitch2;
 
@@ -279,14 +388,7 @@ ErrorCode AdaptiveThresholdVarShape::infer(const ImageBatchVarShapeDataStridedCu
     dim3 block(32, 4);
     dim3 grid(divUp(m_maxBlockSize, block.x), divUp(m_maxBlockSize, block.y), out.numImages());
 
-    if (adaptiveMethod == NVCV_ADAPTIVE_THRESH_MEAN_C)
-    {
-        computeMeanKernelVarShape<<<grid, block, 0, stream>>>(kernelTensor, blockSizeArr);
-    }
-    else
-    {
-        computeGaussianKernelVarShape<<<grid, block, 0, stream>>>(kernelTensor, blockSizeArr);
-    }
+    computeGaussianKernelVarShape<<<grid, block, 0, stream>>>(kernelTensor, blockSizeArr);
     checkKernelErrors();
 
     if (thresholdType == NVCV_THRESH_BINARY)
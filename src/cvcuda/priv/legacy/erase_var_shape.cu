@@ -22,50 +22,58 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
-#include "cub/cub.cuh"
+
+#include <cvcuda/cuda_tools/Philox.hpp>
 
 using namespace nvcv::legacy::helpers;
 
 using namespace nvcv::legacy::cuda_op;
 
-static __device__ int erase_var_shape_hash(unsigned int x)
-{
-    x = ((x >> 16) ^ x) * 0x45d9f3b;
-    x = ((x >> 16) ^ x) * 0x45d9f3b;
-    x = (x >> 16) ^ x;
-    return x;
-}
+// Maximum number of blocks covering one channel of one erasing area, each block loops over the area pixels so
+// the launch configuration does not depend on the erasing sizes, which are only known on the device
+static constexpr int kEraseBlockSize        = 256;
+static constexpr int kEraseMaxBlocksPerArea = 64;
 
 template<typename D>
 __global__ void erase(nvcv::cuda::ImageBatchVarShapeWrapNHWC<D> img, nvcv::cuda::Tensor1DWrap<int2> anchorVec,
                       nvcv::cuda::Tensor1DWrap<int3> erasingVec, nvcv::cuda::Tensor1DWrap<float> valuesVec,
                       nvcv::cuda::Tensor1DWrap<int> imgIdxVec, int channels, int random, unsigned int seed)
 {
-    unsigned int id      = threadIdx.x + blockIdx.x * blockDim.x;
-    int          c       = blockIdx.y;
-    int          eraseId = blockIdx.z;
-    int2         anchor  = anchorVec[eraseId];
-    int3         erasing = erasingVec[eraseId];
-    float        value   = valuesVec[eraseId * channels + c];
-    int          batchId = imgIdxVec[eraseId];
-    if (id < erasing.y * erasing.x && (0x1 & (erasing.z >> c)) == 1)
+    int   c       = blockIdx.y;
+    int   eraseId = blockIdx.z;
+    int2  anchor  = anchorVec[eraseId];
+    int3  erasing = erasingVec[eraseId];
+    float value   = valuesVec[eraseId * channels + c];
+    int   batchId = imgIdxVec[eraseId];
+
+    if ((0x1 & (erasing.z >> c)) == 0)
     {
-        int x = id % erasing.x;
-        int y = id / erasing.x;
-        if ((anchor.x + x) < img.width(batchId) && (anchor.y + y) < img.height(batchId))
+        return;
+    }
+
+    // Erasing area clipped to its image
+    int width  = min(erasing.x, img.width(batchId) - anchor.x);
+    int height = min(erasing.y, img.height(batchId) - anchor.y);
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    unsigned int area = width * height;
+
+    for (unsigned int id = threadIdx.x + blockIdx.x * blockDim.x; id < area; id += blockDim.x * gridDim.x)
+    {
+        int x = id % width;
+        int y = id / width;
+        if (random)
+        {
+            // Each (area, pixel, channel) has its own Philox stream, independent of the launch configuration
+            uint32_t bits = nvcv::cuda::Philox(seed, eraseId, id, c)();
+            *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<D>(bits % 256);
+        }
+        else
         {
-            if (random)
-            {
-                unsigned int hashValue = seed + threadIdx.x
-                                       + 0x26AD0C9 * blockDim.x * blockDim.y * blockDim.z * (blockIdx.x + 1)
-                                             * (blockIdx.y + 1) * (blockIdx.z + 1);
-                *img.ptr(batchId, anchor.y + y, anchor.x + x, c)
-                    = nvcv::cuda::SaturateCast<D>(erase_var_shape_hash(hashValue) % 256);
-            }
-            else
-            {
-                *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<D>(value);
-            }
+            *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<D>(value);
         }
     }
 }
@@ -73,8 +81,8 @@ __global__ void erase(nvcv::cuda::ImageBatchVarShapeWrapNHWC<D> img, nvcv::cuda:
 template<typename D>
 void eraseCaller(const nvcv::ImageBatchVarShapeDataStridedCuda &imgs, const nvcv::TensorDataStridedCuda &anchor,
                  const nvcv::TensorDataStridedCuda &erasing, const nvcv::TensorDataStridedCuda &imgIdx,
-                 const nvcv::TensorDataStridedCuda &values, int max_eh, int max_ew, int num_erasing_area, bool random,
-                 unsigned int seed, cudaStream_t stream)
+                 const nvcv::TensorDataStridedCuda &values, int num_erasing_area, bool random, unsigned int seed,
+                 nvcv::Size2D maxSize, cudaStream_t stream)
 {
     nvcv::cuda::ImageBatchVarShapeWrapNHWC<D> src(imgs, imgs.uniqueFormat().numChannels());
 
@@ -83,71 +91,25 @@ void eraseCaller(const nvcv::ImageBatchVarShapeDataStridedCuda &imgs, const nvcv
     nvcv::cuda::Tensor1DWrap<int>   imgIdxVec(imgIdx);
     nvcv::cuda::Tensor1DWrap<float> valuesVec(values);
 
-    int  channel   = imgs.uniqueFormat().numChannels();
-    int  blockSize = (max_eh * max_ew < 1024) ? max_eh * max_ew : 1024;
-    int  gridSize  = divUp(max_eh * max_ew, 1024);
-    dim3 block(blockSize);
+    // The erasing areas are clipped to their images, so the largest image bounds the number of pixels per area
+    int  channel  = imgs.uniqueFormat().numChannels();
+    int  gridSize = std::min(divUp(maxSize.w * maxSize.h, kEraseBlockSize), kEraseMaxBlocksPerArea);
+    dim3 block(kEraseBlockSize);
     dim3 grid(gridSize, channel, num_erasing_area);
     erase<D><<<grid, block, 0, stream>>>(src, anchorVec, erasingVec, valuesVec, imgIdxVec, channel, random, seed);
 }
 
-namespace {
-struct MaxWH
-{
-    __device__ __forceinline__ int3 operator()(const int3 &a, const int3 &b) const
-    {
-        return int3{max(a.x, b.x), max(a.y, b.y), 0};
-    }
-};
-} // namespace
-
 namespace nvcv::legacy::cuda_op {
 
 EraseVarShape::EraseVarShape(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area)
     : CudaBaseOp(max_input_shape, max_output_shape)
-    , d_max_values(nullptr)
-    , temp_storage(nullptr)
 {
-    cudaError_t err = cudaMalloc(&d_max_values, sizeof(int3));
-    if (err != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory allocation error of size: " << sizeof(int3));
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-
     max_num_erasing_area = num_erasing_area;
     if (max_num_erasing_area < 0)
     {
-        cudaFree(d_max_values);
         LOG_ERROR("Invalid num of erasing area" << max_num_erasing_area);
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "max_num_erasing_area must be >= 0");
     }
-    temp_storage  = NULL;
-    storage_bytes = 0;
-    MaxWH mwh;
-    int3  init = {0, 0, 0};
-    cub::DeviceReduce::Reduce(temp_storage, storage_bytes, (int3 *)nullptr, (int3 *)nullptr, max_num_erasing_area, mwh,
-                              init);
-
-    err = cudaMalloc(&temp_storage, storage_bytes);
-    if (err != cudaSuccess)
-    {
-        cudaFree(d_max_values);
-        LOG_ERROR("CUDA memory allocation error of size: " << storage_bytes);
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-}
-
-EraseVarShape::~EraseVarShape()
-{
-    cudaError_t err0 = cudaFree(d_max_values);
-    cudaError_t err1 = cudaFree(temp_storage);
-    if (err0 != cudaSuccess || err1 != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory free error, possible memory leak!");
-    }
-    d_max_values = nullptr;
-    temp_storage = nullptr;
 }
 
 ErrorCode EraseVarShape::infer(const nvcv::ImageBatchVarShape &inbatch, const nvcv::ImageBatchVarShape &outbatch,
@@ -289,38 +251,19 @@ ErrorCode EraseVarShape::infer(const nvcv::ImageBatchVarShape &inbatch, const nv
         return SUCCESS;
     }
 
-    int3 *d_erasing = (int3 *)erasing.basePtr();
-    int3  h_max_values;
-    MaxWH maxwh;
-    int3  init = {0, 0, 0};
-
-    cub::DeviceReduce::Reduce(temp_storage, storage_bytes, d_erasing, d_max_values, num_erasing_area, maxwh, init,
-                              stream);
-    checkCudaErrors(cudaMemcpyAsync(&h_max_values, d_max_values, sizeof(int3), cudaMemcpyDeviceToHost, stream));
-
-    checkCudaErrors(cudaStreamSynchronize(stream));
-
-    int max_ew = h_max_values.x, max_eh = h_max_values.y;
-
-    // All areas as empty? Weird, but valid nonetheless.
-    if (max_ew == 0 || max_eh == 0)
-    {
-        return SUCCESS;
-    }
-
     typedef void (*erase_t)(const ImageBatchVarShapeDataStridedCuda &imgs, const TensorDataStridedCuda &anchor,
                             const TensorDataStridedCuda &erasing, const TensorDataStridedCuda &imgIdx,
-                            const TensorDataStridedCuda &values, int max_eh, int max_ew, int num_erasing_area,
-                            bool random, unsigned int seed, cudaStream_t stream);
+                            const TensorDataStridedCuda &values, int num_erasing_area, bool random, unsigned int seed,
+                            Size2D maxSize, cudaStream_t stream);
 
     static const erase_t funcs[6] = {eraseCaller<uchar>, eraseCaller<char>, eraseCaller<ushort>,
                                      eraseCaller<short>, eraseCaller<int>,  eraseCaller<float>};
 
     if (inplace)
-        funcs[data_type](*inData, anchor, erasing, imgIdx, values, max_eh, max_ew, num_erasing_area, random, seed,
+        funcs[data_type](*inData, anchor, erasing, imgIdx, values, num_erasing_area, random, seed, inbatch.maxSize(),
                          stream);
     else
-        funcs[data_type](*outData, anchor, erasing, imgIdx, values, max_eh, max_ew, num_erasing_area, random, seed,
+        funcs[data_type](*outData, anchor, erasing, imgIdx, values, num_erasing_area, random, seed, outbatch.maxSize(),
                          stream);
 
     return SUCCESS;
@@ -128,6 +128,309 @@ ErrorCode Filter2D(const TensorDataStridedCuda &inData, const TensorDataStridedC
     return ErrorCode::SUCCESS;
 }
 
+// Separable filters -----------------------------------------------------------
+
+// Kernels with at least this many taps are applied as a row pass followed by a column pass through an intermediate
+// float buffer, instead of evaluating the full 2D kernel per output pixel
+constexpr int kSeparableMinKernelArea = 100;
+
+// Widest kernel whose row-pass tile and weights still fit in the default 48KB of shared memory for float4
+constexpr int kSeparableMaxKernelWidth = 1024;
+
+constexpr int kRowPassTileWidth = 128; // output pixels per block row in the shared-memory row pass
+constexpr int kRowPassTileRows  = 2;   // rows per block in the shared-memory row pass
+constexpr int kRunningSumLength = 32;  // outputs computed by each thread of the box filter passes
+
+// Reads row y of an intermediate plane, where the rows outside the image are the row pass applied to the border
+template<NVCVBorderType B, typename W>
+__device__ __forceinline__ W loadRowWithBorder(const W *plane, int y, int x, Size2D size, W borderValue)
+{
+    if constexpr (B == NVCV_BORDER_CONSTANT)
+    {
+        if (cuda::IsOutside(y, size.h))
+        {
+            return borderValue;
+        }
+    }
+    else
+    {
+        y = cuda::GetIndexWithBorder<B>(y, size.h);
+    }
+    return plane[static_cast<int64_t>(y) * size.w + x];
+}
+
+template<class SrcWrapper, typename W>
+__global__ void separableRowPass(SrcWrapper src, W *tmp, Size2D size, const float *kernelX, int kernelWidth,
+                                 int anchorX)
+{
+    extern __shared__ unsigned char separableSmem[];
+
+    const int tileWidth = kRowPassTileWidth + kernelWidth - 1;
+
+    W     *tile    = reinterpret_cast<W *>(separableSmem) + threadIdx.y * tileWidth;
+    float *weights = reinterpret_cast<float *>(reinterpret_cast<W *>(separableSmem) + blockDim.y * tileWidth);
+
+    const int x0        = blockIdx.x * kRowPassTileWidth;
+    const int x         = x0 + threadIdx.x;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    for (int i = threadIdx.y * blockDim.x + threadIdx.x; i < kernelWidth; i += blockDim.x * blockDim.y)
+    {
+        weights[i] = kernelX[i];
+    }
+
+    if (y < size.h)
+    {
+        int3 coord{0, y, batch_idx};
+
+        for (int i = threadIdx.x; i < tileWidth; i += blockDim.x)
+        {
+            coord.x = x0 - anchorX + i;
+            tile[i] = cuda::StaticCast<float>(src[coord]);
+        }
+    }
+
+    __syncthreads();
+
+    if (x >= size.w || y >= size.h)
+        return;
+
+    W res = cuda::SetAll<W>(0);
+
+    for (int j = 0; j < kernelWidth; ++j)
+    {
+        res = res + tile[threadIdx.x + j] * weights[j];
+    }
+
+    tmp[(static_cast<int64_t>(batch_idx) * size.h + y) * size.w + x] = res;
+}
+
+template<NVCVBorderType B, class DstWrapper, typename W>
+__global__ void separableColPass(const W *tmp, DstWrapper dst, Size2D size, const float *kernelY, int kernelHeight,
+                                 int anchorY, W borderValue)
+{
+    extern __shared__ unsigned char separableSmem[];
+
+    float *weights = reinterpret_cast<float *>(separableSmem);
+
+    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    for (int i = threadIdx.y * blockDim.x + threadIdx.x; i < kernelHeight; i += blockDim.x * blockDim.y)
+    {
+        weights[i] = kernelY[i];
+    }
+
+    __syncthreads();
+
+    if (x >= size.w || y >= size.h)
+        return;
+
+    const W *plane = tmp + static_cast<int64_t>(batch_idx) * size.h * size.w;
+
+    W res = cuda::SetAll<W>(0);
+
+    for (int i = 0; i < kernelHeight; ++i)
+    {
+        res = res + loadRowWithBorder<B>(plane, y - anchorY + i, x, size, borderValue) * weights[i];
+    }
+
+    *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<typename DstWrapper::ValueType>(res);
+}
+
+// The box filter passes keep a running sum over the window, so their cost doesn't depend on the kernel size
+template<class SrcWrapper, typename W>
+__global__ void boxRowPass(SrcWrapper src, W *tmp, Size2D size, int kernelWidth, int anchorX)
+{
+    const int x0        = (blockIdx.x * blockDim.x + threadIdx.x) * kRunningSumLength;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (x0 >= size.w || y >= size.h)
+        return;
+
+    W *row = tmp + (static_cast<int64_t>(batch_idx) * size.h + y) * size.w;
+
+    int3 coord{0, y, batch_idx};
+    W    sum = cuda::SetAll<W>(0);
+
+    for (int j = 0; j < kernelWidth; ++j)
+    {
+        coord.x = x0 - anchorX + j;
+        sum     = sum + cuda::StaticCast<float>(src[coord]);
+    }
+
+    row[x0] = sum;
+
+    const int xEnd = min(x0 + kRunningSumLength, size.w);
+
+    for (int x = x0 + 1; x < xEnd; ++x)
+    {
+        coord.x    = x - anchorX + kernelWidth - 1;
+        W entering = cuda::StaticCast<float>(src[coord]);
+        coord.x    = x - anchorX - 1;
+        W leaving  = cuda::StaticCast<float>(src[coord]);
+
+        sum    = sum + entering - leaving;
+        row[x] = sum;
+    }
+}
+
+template<NVCVBorderType B, class DstWrapper, typename W>
+__global__ void boxColPass(const W *tmp, DstWrapper dst, Size2D size, int kernelHeight, int anchorY, float scale,
+                           W borderValue)
+{
+    using T = typename DstWrapper::ValueType;
+
+    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y0        = (blockIdx.y * blockDim.y + threadIdx.y) * kRunningSumLength;
+    const int batch_idx = get_batch_idx();
+
+    if (x >= size.w || y0 >= size.h)
+        return;
+
+    const W *plane = tmp + static_cast<int64_t>(batch_idx) * size.h * size.w;
+
+    W sum = cuda::SetAll<W>(0);
+
+    for (int i = 0; i < kernelHeight; ++i)
+    {
+        sum = sum + loadRowWithBorder<B>(plane, y0 - anchorY + i, x, size, borderValue);
+    }
+
+    *dst.ptr(batch_idx, y0, x) = cuda::SaturateCast<T>(sum * scale);
+
+    const int yEnd = min(y0 + kRunningSumLength, size.h);
+
+    for (int y = y0 + 1; y < yEnd; ++y)
+    {
+        sum = sum + loadRowWithBorder<B>(plane, y - anchorY + kernelHeight - 1, x, size, borderValue)
+            - loadRowWithBorder<B>(plane, y - anchorY - 1, x, size, borderValue);
+
+        *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(sum * scale);
+    }
+}
+
+// Applies a separable kernel given by its weights along x followed by its weights along y, or a box filter with
+// uniform weights when kernelXY is null.
+template<typename T, NVCVBorderType B>
+ErrorCode SeparableFilterCaller(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                const float *kernelXY, Size2D kernelSize, int2 kernelAnchor, float borderValue,
+                                nvcv::util::PerStreamScratch &scratch, cudaStream_t stream)
+{
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    Size2D size{outAccess->numCols(), outAccess->numRows()};
+    int    numSamples = outAccess->numSamples();
+
+    auto outMaxStride = outAccess->sampleStride() * outAccess->numSamples();
+    auto inMaxStride  = inAccess->sampleStride() * inAccess->numSamples();
+    if (std::max(outMaxStride, inMaxStride) > cuda::TypeTraits<int32_t>::max)
+    {
+        LOG_ERROR("Input or output size exceeds " << cuda::TypeTraits<int32_t>::max << ". Tensor is too large.");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    auto src = cuda::CreateBorderWrapNHW<const T, B, int32_t>(inData, cuda::SetAll<T>(borderValue));
+    auto dst = cuda::CreateTensorWrapNHW<T, int32_t>(outData);
+
+    auto       tmpLease = scratch.acquire(sizeof(work_type) * numSamples * size.h * size.w, stream);
+    work_type *tmp      = tmpLease.data<work_type>();
+
+    if (kernelXY)
+    {
+        const float *kernelX = kernelXY;
+        const float *kernelY = kernelXY + kernelSize.w;
+
+        dim3   rowBlock(kRowPassTileWidth, kRowPassTileRows);
+        dim3   rowGrid(divUp(size.w, kRowPassTileWidth), divUp(size.h, rowBlock.y), numSamples);
+        size_t rowSmem = sizeof(work_type) * rowBlock.y * (kRowPassTileWidth + kernelSize.w - 1)
+                       + sizeof(float) * kernelSize.w;
+
+        separableRowPass<<<rowGrid, rowBlock, rowSmem, stream>>>(src, tmp, size, kernelX, kernelSize.w,
+                                                                 kernelAnchor.x);
+        checkKernelErrors();
+
+        dim3 colBlock(32, 8);
+        dim3 colGrid(divUp(size.w, colBlock.x), divUp(size.h, colBlock.y), numSamples);
+
+        // The Gaussian weights sum up to one, so the row pass maps a constant border row to itself
+        separableColPass<B><<<colGrid, colBlock, sizeof(float) * kernelSize.h, stream>>>(
+            tmp, dst, size, kernelY, kernelSize.h, kernelAnchor.y, cuda::SetAll<work_type>(borderValue));
+        checkKernelErrors();
+    }
+    else
+    {
+        dim3 rowBlock(8, 32);
+        dim3 rowGrid(divUp(divUp(size.w, kRunningSumLength), rowBlock.x), divUp(size.h, rowBlock.y), numSamples);
+
+        boxRowPass<<<rowGrid, rowBlock, 0, stream>>>(src, tmp, size, kernelSize.w, kernelAnchor.x);
+        checkKernelErrors();
+
+        dim3 colBlock(32, 8);
+        dim3 colGrid(divUp(size.w, colBlock.x), divUp(divUp(size.h, kRunningSumLength), colBlock.y), numSamples);
+
+        // The row pass sums kernelSize.w border values
+        boxColPass<B><<<colGrid, colBlock, 0, stream>>>(tmp, dst, size, kernelSize.h, kernelAnchor.y,
+                                                        1.f / (kernelSize.w * kernelSize.h),
+                                                        cuda::SetAll<work_type>(borderValue * kernelSize.w));
+        checkKernelErrors();
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+    return ErrorCode::SUCCESS;
+}
+
+template<typename T>
+ErrorCode SeparableFilter(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                          const float *kernelXY, Size2D kernelSize, int2 kernelAnchor, NVCVBorderType borderMode,
+                          float borderValue, nvcv::util::PerStreamScratch &scratch, cudaStream_t stream)
+{
+    switch (borderMode)
+    {
+#define NVCV_FILTER_CASE(BORDERTYPE)                                                                     \
+    case BORDERTYPE:                                                                                     \
+        return SeparableFilterCaller<T, BORDERTYPE>(inData, outData, kernelXY, kernelSize, kernelAnchor, \
+                                                    borderValue, scratch, stream)
+
+        NVCV_FILTER_CASE(NVCV_BORDER_CONSTANT);
+        NVCV_FILTER_CASE(NVCV_BORDER_REPLICATE);
+        NVCV_FILTER_CASE(NVCV_BORDER_REFLECT);
+        NVCV_FILTER_CASE(NVCV_BORDER_WRAP);
+        NVCV_FILTER_CASE(NVCV_BORDER_REFLECT101);
+
+#undef NVCV_FILTER_CASE
+    default:
+        break;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+typedef ErrorCode (*separableFilter_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                       const float *kernelXY, Size2D kernelSize, int2 kernelAnchor,
+                                       NVCVBorderType borderMode, float borderValue,
+                                       nvcv::util::PerStreamScratch &scratch, cudaStream_t stream);
+
+static const separableFilter_t separableFilterFuncs[6][4] = {
+    { SeparableFilter<uchar>, 0,  SeparableFilter<uchar3>,  SeparableFilter<uchar4>},
+    {                      0, 0,                        0,                        0},
+    {SeparableFilter<ushort>, 0, SeparableFilter<ushort3>, SeparableFilter<ushort4>},
+    { SeparableFilter<short>, 0,  SeparableFilter<short3>,  SeparableFilter<short4>},
+    {   SeparableFilter<int>, 0,    SeparableFilter<int3>,    SeparableFilter<int4>},
+    { SeparableFilter<float>, 0,  SeparableFilter<float3>,  SeparableFilter<float4>},
+};
+
 // Laplacian -------------------------------------------------------------------
 
 // @brief Laplacian 3x3 kernels for ksize == 1 and ksize == 3
@@ -244,12 +547,6 @@ Gaussian::Gaussian(DataShape max_input_shape, DataShape max_output_shape, Size2D
     : CudaBaseOp(max_input_shape, max_output_shape)
     , m_maxKernelSize(maxKernelSize)
 {
-    NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * sizeof(float)));
-}
-
-Gaussian::~Gaussian()
-{
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
 }
 
 ErrorCode Gaussian::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData, Size2D kernelSize,
@@ -317,24 +614,35 @@ ErrorCode Gaussian::infer(const TensorDataStridedCuda &inData, const TensorDataS
     sigma.x = std::max(sigma.x, 0.0);
     sigma.y = std::max(sigma.y, 0.0);
 
-    if (m_curSigma != sigma || m_curKernelSize != kernelSize)
+    const int channels = input_shape.C;
+
+    int2 kernelAnchor{-1, -1};
+    normalizeAnchor(kernelAnchor, kernelSize);
+    float borderValue = .0f;
+
+    if (kernelSize.w * kernelSize.h >= kSeparableMinKernelArea && kernelSize.w <= kSeparableMaxKernelWidth)
     {
-        dim3 block(32, 4);
-        dim3 grid(divUp(kernelSize.w, block.x), divUp(kernelSize.h, block.y));
+        // The kernel weights live in per-stream scratch, so concurrent calls on other streams don't overwrite them
+        auto kernelXY = m_scratch.acquire((kernelSize.w + kernelSize.h) * sizeof(float), stream);
 
-        computeGaussianKernel<<<grid, block, 0, stream>>>(m_kernel, kernelSize, sigma);
+        computeSeparableGaussianKernel<<<1, 256, 0, stream>>>(kernelXY.data<float>(), kernelSize, sigma);
 
         checkKernelErrors();
 
-        m_curKernelSize = kernelSize;
-        m_curSigma      = sigma;
+        return separableFilterFuncs[data_type][channels - 1](inData, outData, kernelXY.data<float>(), kernelSize,
+                                                             kernelAnchor, borderMode, borderValue, m_scratch,
+                                                             stream);
     }
 
-    const int channels = input_shape.C;
+    // The kernel weights live in per-stream scratch, so concurrent calls on other streams don't overwrite them
+    auto kernel = m_scratch.acquire(kernelSize.w * kernelSize.h * sizeof(float), stream);
 
-    int2 kernelAnchor{-1, -1};
-    normalizeAnchor(kernelAnchor, kernelSize);
-    float borderValue = .0f;
+    dim3 block(32, 4);
+    dim3 grid(divUp(kernelSize.w, block.x), divUp(kernelSize.h, block.y));
+
+    computeGaussianKernel<<<grid, block, 0, stream>>>(kernel.data<float>(), kernelSize, sigma);
+
+    checkKernelErrors();
 
     typedef ErrorCode (*filter2D_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                                     float *kernel, Size2D kernelSize, int2 kernelAnchor, NVCVBorderType borderMode,
@@ -349,8 +657,8 @@ ErrorCode Gaussian::infer(const TensorDataStridedCuda &inData, const TensorDataS
         { Filter2D<float>, 0,  Filter2D<float3>,  Filter2D<float4>},
     };
 
-    return funcs[data_type][channels - 1](inData, outData, m_kernel, kernelSize, kernelAnchor, borderMode, borderValue,
-                                          stream);
+    return funcs[data_type][channels - 1](inData, outData, kernel.data<float>(), kernelSize, kernelAnchor, borderMode,
+                                          borderValue, stream);
 }
 
 // Average Blur ----------------------------------------------------------------
@@ -359,12 +667,6 @@ AverageBlur::AverageBlur(DataShape max_input_shape, DataShape max_output_shape,
     : CudaBaseOp(max_input_shape, max_output_shape)
     , m_maxKernelSize(maxKernelSize)
 {
-    NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * sizeof(float)));
-}
-
-AverageBlur::~AverageBlur()
-{
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
 }
 
 ErrorCode AverageBlur::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
@@ -437,6 +739,13 @@ ErrorCode AverageBlur::infer(const TensorDataStridedCuda &inData, const TensorDa
     normalizeAnchor(kernelAnchor, kernelSize);
     float borderValue = .0f;
 
+    if (kernelSize.w * kernelSize.h >= kSeparableMinKernelArea)
+    {
+        // Running sums along rows then columns, no weights needed
+        return separableFilterFuncs[data_type][channels - 1](inData, outData, nullptr, kernelSize, kernelAnchor,
+                                                             borderMode, borderValue, m_scratch, stream);
+    }
+
     typedef ErrorCode (*filter2D_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                                     float *kernel, Size2D kernelSize, int2 kernelAnchor, NVCVBorderType borderMode,
                                     float borderValue, cudaStream_t stream);
@@ -450,19 +759,15 @@ ErrorCode AverageBlur::infer(const TensorDataStridedCuda &inData, const TensorDa
         { Filter2D<float>, 0,  Filter2D<float3>,  Filter2D<float4>},
     };
 
-    if (m_curKernelSize != kernelSize)
-    {
-        int k_size = kernelSize.h * kernelSize.w;
+    int  k_size = kernelSize.h * kernelSize.w;
+    auto kernel = m_scratch.acquire(k_size * sizeof(float), stream);
 
-        computeMeanKernel<<<1, k_size, 0, stream>>>(m_kernel, k_size);
+    computeMeanKernel<<<1, k_size, 0, stream>>>(kernel.data<float>(), k_size);
 
-        checkKernelErrors();
-
-        m_curKernelSize = kernelSize;
-    }
+    checkKernelErrors();
 
-    return funcs[data_type][channels - 1](inData, outData, m_kernel, kernelSize, kernelAnchor, borderMode, borderValue,
-                                          stream);
+    return funcs[data_type][channels - 1](inData, outData, kernel.data<float>(), kernelSize, kernelAnchor, borderMode,
+                                          borderValue, stream);
 }
 
 } // namespace nvcv::legacy::cuda_op
@@ -72,6 +72,26 @@ __global__ void computeGaussianKernel(float *kernel, Size2D kernelSize, double2
     kernel[coord.y * kernelSize.w + coord.x] = computeSingleGaussianValue(coord, half, sigma);
 }
 
+__global__ void computeSeparableGaussianKernel(float *kernel, Size2D kernelSize, double2 sigma)
+{
+    for (int i = threadIdx.x; i < kernelSize.w + kernelSize.h; i += blockDim.x)
+    {
+        bool  alongX = i < kernelSize.w;
+        int   half   = (alongX ? kernelSize.w : kernelSize.h) / 2;
+        float s      = alongX ? 2.f * sigma.x * sigma.x : 2.f * sigma.y * sigma.y;
+        int   x      = (alongX ? i : i - kernelSize.w) - half;
+
+        float sum = 0.f;
+
+        for (int j = -half; j <= half; ++j)
+        {
+            sum += cuda::exp(-(j * j) / s);
+        }
+
+        kernel[i] = cuda::exp(-(x * x) / s) / sum;
+    }
+}
+
 __global__ void computeMeanKernelVarShape(cuda::Tensor3DWrap<float, int32_t> kernel,
                                           cuda::Tensor1DWrap<int2, int32_t>  kernelSizeArr,
                                           cuda::Tensor1DWrap<int2, int32_t>  kernelAnchorArr)
@@ -26,6 +26,10 @@ __global__ void computeMeanKernel(float *kernel_ptr, int k_size);
 
 __global__ void computeGaussianKernel(float *kernel, Size2D kernelSize, double2 sigma);
 
+// Computes the 1D Gaussian weights along x followed by the 1D weights along y, their outer product is the kernel
+// computed by computeGaussianKernel
+__global__ void computeSeparableGaussianKernel(float *kernel, Size2D kernelSize, double2 sigma);
+
 __global__ void computeMeanKernelVarShape(cuda::Tensor3DWrap<float, int32_t> kernel,
                                           cuda::Tensor1DWrap<int2, int32_t>  kernelSizeArr,
                                           cuda::Tensor1DWrap<int2, int32_t>  kernelAnchorArr);
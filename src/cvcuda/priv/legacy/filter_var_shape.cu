@@ -21,12 +21,27 @@
  */
 
 #include "../Assert.h"
+#include "../Conv2DStrategy.hpp"
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
 #include "filter_utils.cuh"
 
+#include <mma.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <optional>
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ < 800
+#    define CONV2D_TF32_MMA 0
+#else
+#    define CONV2D_TF32_MMA 1
+#endif
+
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
@@ -73,10 +88,176 @@ __global__ void filter2D(const SrcWrapper src, DstWrapper dst, cuda::ImageBatchV
     *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<typename DstWrapper::ValueType>(res);
 }
 
+// Tensor core path: every kernel row is a Toeplitz matrix applied to a row of input pixels, so each warp computes
+// its 16x16 outputs as a sum over kernel rows of (16 x inputCols) x (inputCols x 16) TF32 products.  Operands are
+// split in a high and a low TF32 part and the low x low product is dropped, which keeps FP32 accuracy.
+
+// Rounds to the nearest TF32 value (10 bit mantissa), ties away from zero like cvt.rna.tf32.f32
+__device__ __forceinline__ float roundToTF32(float v)
+{
+    unsigned int u = __float_as_uint(v);
+    if ((u & 0x7f800000u) != 0x7f800000u)
+    {
+        u += 0x1000u;
+    }
+    return __uint_as_float(u & 0xffffe000u);
+}
+
+// Per image Toeplitz weights of the tensor core path, block s of kernel row i is the 8x16 matrix
+// B[du][x] = kernel[i][8 * s + du - x], zero outside of the kernel
+struct ToeplitzWeights
+{
+    const float *hi;
+    const float *lo;
+    int          maxKernelHeight;
+    int          maxSteps;
+    int          tileStride;
+};
+
+__global__ void buildConv2DToeplitz(cuda::ImageBatchVarShapeWrap<float> kernel, float *hi, float *lo,
+                                    int maxKernelHeight, int maxSteps)
+{
+    const int idx       = blockIdx.x * blockDim.x + threadIdx.x;
+    const int batch_idx = get_batch_idx();
+    const int imageSize = maxKernelHeight * maxSteps * 128;
+
+    if (idx >= imageSize)
+        return;
+
+    const int i = idx / (maxSteps * 128);
+    const int j = (idx / 128) % maxSteps * 8 + (idx % 128) / 16 - idx % 16;
+
+    float v = 0.f;
+    if (i < kernel.height(batch_idx) && j >= 0 && j < kernel.width(batch_idx))
+    {
+        v = *kernel.ptr(batch_idx, i, j);
+    }
+
+    float  vhi    = roundToTF32(v);
+    size_t offset = static_cast<size_t>(batch_idx) * imageSize + idx;
+    hi[offset]    = vhi;
+    lo[offset]    = roundToTF32(v - vhi);
+}
+
+template<bool SplitInput, class SrcWrapper, class DstWrapper>
+__global__ void filter2DTensorCore(const SrcWrapper src, DstWrapper dst, cuda::ImageBatchVarShapeWrap<float> kernel,
+                                   cuda::Tensor1DWrap<int2, int32_t> kernelAnchor, ToeplitzWeights toeplitz)
+{
+#if CONV2D_TF32_MMA
+    namespace wmma = nvcuda::wmma;
+    namespace cv2d = cvcuda::priv::conv2d;
+
+    using T  = typename DstWrapper::ValueType;
+    using BT = cuda::BaseType<T>;
+
+    extern __shared__ __align__(32) float conv2dTile[];
+
+    const int batch_idx = get_batch_idx();
+    const int x0        = blockIdx.x * cv2d::kTileCols;
+    const int y0        = blockIdx.y * cv2d::kTileRows;
+    const int width     = dst.width(batch_idx);
+    const int height    = dst.height(batch_idx);
+
+    if (x0 >= width || y0 >= height)
+        return;
+
+    int2 anchor = kernelAnchor[batch_idx];
+
+    int2 kernelSize{kernel.width(batch_idx), kernel.height(batch_idx)};
+
+    if (anchor.x < 0)
+        anchor.x = kernelSize.x / 2;
+
+    if (anchor.y < 0)
+        anchor.y = kernelSize.y / 2;
+
+    const int inCols   = cv2d::TileInputCols(kernelSize.x);
+    const int inRows   = cv2d::TileInputRows(kernelSize.y);
+    const int numSteps = inCols / 8;
+    const int stride   = toeplitz.tileStride;
+    const int tileSize = cv2d::TileInputRows(toeplitz.maxKernelHeight) * stride;
+
+    float *tileHi  = conv2dTile;
+    float *tileLo  = tileHi + tileSize;
+    float *staging = tileHi + (SplitInput ? 2 : 1) * tileSize + (threadIdx.x / 32) * 16 * 16;
+
+    const int    warpRow    = (threadIdx.x / 32) * 16;
+    const int    lane       = threadIdx.x % 32;
+    const size_t rowBlocks  = static_cast<size_t>(toeplitz.maxSteps) * 128;
+    const size_t imageBlock = static_cast<size_t>(batch_idx) * toeplitz.maxKernelHeight * rowBlocks;
+
+    for (int c = 0; c < cuda::NumElements<T>; ++c)
+    {
+        // Previous channel is done reading the tile
+        __syncthreads();
+
+        for (int idx = threadIdx.x; idx < inRows * inCols; idx += blockDim.x)
+        {
+            int r = idx / inCols, u = idx % inCols;
+
+            float v = 0.f;
+            if (u < cv2d::kTileCols + kernelSize.x - 1)
+            {
+                T pix = src[int3{x0 - anchor.x + u, y0 - anchor.y + r, batch_idx}];
+                v     = cuda::GetElement(pix, c);
+            }
+
+            float vhi              = roundToTF32(v);
+            tileHi[r * stride + u] = vhi;
+            if constexpr (SplitInput)
+            {
+                tileLo[r * stride + u] = roundToTF32(v - vhi);
+            }
+        }
+        __syncthreads();
+
+        wmma::fragment<wmma::matrix_a, 16, 16, 8, wmma::precision::tf32, wmma::row_major> aHi, aLo;
+        wmma::fragment<wmma::matrix_b, 16, 16, 8, wmma::precision::tf32, wmma::row_major> bHi, bLo;
+        wmma::fragment<wmma::accumulator, 16, 16, 8, float>                               acc;
+        wmma::fill_fragment(acc, 0.f);
+
+        for (int i = 0; i < kernelSize.y; ++i)
+        {
+            const float *rowHi = tileHi + (warpRow + i) * stride;
+            const float *rowLo = tileLo + (warpRow + i) * stride;
+            const float *kHi   = toeplitz.hi + imageBlock + i * rowBlocks;
+            const float *kLo   = toeplitz.lo + imageBlock + i * rowBlocks;
+
+            for (int s = 0; s < numSteps; ++s)
+            {
+                wmma::load_matrix_sync(aHi, rowHi + 8 * s, stride);
+                wmma::load_matrix_sync(bHi, kHi + 128 * s, 16);
+                wmma::load_matrix_sync(bLo, kLo + 128 * s, 16);
+                wmma::mma_sync(acc, aHi, bHi, acc);
+                wmma::mma_sync(acc, aHi, bLo, acc);
+                if constexpr (SplitInput)
+                {
+                    wmma::load_matrix_sync(aLo, rowLo + 8 * s, stride);
+                    wmma::mma_sync(acc, aLo, bHi, acc);
+                }
+            }
+        }
+
+        wmma::store_matrix_sync(staging, acc, 16, wmma::mem_row_major);
+        __syncwarp();
+
+        for (int e = lane; e < 16 * 16; e += 32)
+        {
+            int y = y0 + warpRow + e / 16, x = x0 + e % 16;
+            if (x < width && y < height)
+            {
+                cuda::GetElement(*dst.ptr(batch_idx, y, x), c) = cuda::SaturateCast<BT>(staging[e]);
+            }
+        }
+        __syncwarp();
+    }
+#endif
+}
+
 template<typename D, NVCVBorderType B>
 void Filter2DCaller(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
                     const ImageBatchVarShapeDataStridedCuda &kernelData, const TensorDataStridedCuda &kernelAnchorData,
-                    float borderValue, cudaStream_t stream)
+                    const ToeplitzWeights &toeplitz, float borderValue, cudaStream_t stream)
 {
     cuda::BorderVarShapeWrap<const D, B> src(inData, cuda::SetAll<D>(borderValue));
     cuda::ImageBatchVarShapeWrap<D>      dst(outData);
@@ -93,7 +274,23 @@ void Filter2DCaller(const ImageBatchVarShapeDataStridedCuda &inData, const Image
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    filter2D<<<grid, block, 0, stream>>>(src, dst, kernel, kernelAnchor);
+    if (toeplitz.hi != nullptr)
+    {
+        namespace cv2d = cvcuda::priv::conv2d;
+
+        constexpr bool splitInput = sizeof(cuda::BaseType<D>) != 1;
+
+        dim3   tcBlock(cv2d::kNumWarps * 32);
+        dim3   tcGrid(divUp(outData.maxSize().w, cv2d::kTileCols), divUp(outData.maxSize().h, cv2d::kTileRows),
+                      outData.numImages());
+        size_t smem = cv2d::SharedMemBytes(kernelData.maxSize(), splitInput);
+
+        filter2DTensorCore<splitInput><<<tcGrid, tcBlock, smem, stream>>>(src, dst, kernel, kernelAnchor, toeplitz);
+    }
+    else
+    {
+        filter2D<<<grid, block, 0, stream>>>(src, dst, kernel, kernelAnchor);
+    }
     checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -104,22 +301,62 @@ void Filter2DCaller(const ImageBatchVarShapeDataStridedCuda &inData, const Image
 template<typename D>
 void Filter2D(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
               const ImageBatchVarShapeDataStridedCuda &kernelData, const TensorDataStridedCuda &kernelAnchorData,
-              NVCVBorderType borderMode, float borderValue, cudaStream_t stream)
+              const ToeplitzWeights &toeplitz, NVCVBorderType borderMode, float borderValue, cudaStream_t stream)
 {
     typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &inData,
                            const ImageBatchVarShapeDataStridedCuda &outData,
                            const ImageBatchVarShapeDataStridedCuda &kernelData,
-                           const TensorDataStridedCuda &kernelAnchorData, float borderValue, cudaStream_t stream);
+                           const TensorDataStridedCuda &kernelAnchorData, const ToeplitzWeights &toeplitz,
+                           float borderValue, cudaStream_t stream);
 
     static const func_t funcs[] = {Filter2DCaller<D, NVCV_BORDER_CONSTANT>, Filter2DCaller<D, NVCV_BORDER_REPLICATE>,
                                    Filter2DCaller<D, NVCV_BORDER_REFLECT>, Filter2DCaller<D, NVCV_BORDER_WRAP>,
                                    Filter2DCaller<D, NVCV_BORDER_REFLECT101>};
 
-    funcs[borderMode](inData, outData, kernelData, kernelAnchorData, borderValue, stream);
+    funcs[borderMode](inData, outData, kernelData, kernelAnchorData, toeplitz, borderValue, stream);
+}
+
+// Compute capability major version the tensor core kernels can use on the current device. A build without sm_80
+// code runs the mma kernel from older PTX, where it is compiled out. Querying the kernel attributes is costly, so
+// the result is kept per device.
+static int Conv2DComputeMajor()
+{
+    constexpr int                                    kMaxDevices = 64;
+    static std::array<std::atomic<int>, kMaxDevices> computeMajors{};
+
+    int device = 0;
+    checkCudaErrors(cudaGetDevice(&device));
+
+    if (device < kMaxDevices)
+    {
+        if (int computeMajor = computeMajors[device].load(std::memory_order_relaxed); computeMajor > 0)
+        {
+            return computeMajor;
+        }
+    }
+
+    int computeMajor = 0;
+    checkCudaErrors(cudaDeviceGetAttribute(&computeMajor, cudaDevAttrComputeCapabilityMajor, device));
+
+    cudaFuncAttributes attr;
+    checkCudaErrors(cudaFuncGetAttributes(&attr, buildConv2DToeplitz));
+    computeMajor = std::min(computeMajor, attr.ptxVersion / 10);
+
+    if (device < kMaxDevices)
+    {
+        computeMajors[device].store(computeMajor, std::memory_order_relaxed);
+    }
+    return computeMajor;
 }
 
 // Conv2DVarShape --------------------------------------------------------------
 
+Conv2DVarShape::Conv2DVarShape(DataShape max_input_shape, DataShape max_output_shape)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_algoRequest(cvcuda::priv::conv2d::ParseAlgo(std::getenv("CVCUDA_CONV2D_ALGO")))
+{
+}
+
 ErrorCode Conv2DVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
                                 const ImageBatchVarShapeDataStridedCuda &outData,
                                 const ImageBatchVarShapeDataStridedCuda &kernelData,
@@ -179,10 +416,42 @@ ErrorCode Conv2DVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
 
     float borderValue = .0f;
 
+    // Large kernels run on tensor cores when the device has TF32 mma, CVCUDA_CONV2D_ALGO can force either path
+    namespace cv2d = cvcuda::priv::conv2d;
+
+    Size2D     maxKernelSize = kernelData.maxSize();
+    int        elementSize   = data_type == kCV_8U ? 1 : (data_type == kCV_32S || data_type == kCV_32F ? 4 : 2);
+    cv2d::Algo algo          = cv2d::Select(maxKernelSize, elementSize, Conv2DComputeMajor(), m_algoRequest);
+
+    ToeplitzWeights toeplitz{nullptr, nullptr, maxKernelSize.h, cv2d::TileInputCols(maxKernelSize.w) / 8,
+                             cv2d::TileStride(maxKernelSize.w)};
+
+    std::optional<nvcv::util::PerStreamScratch::Lease> weights;
+    if (algo == cv2d::Algo::TENSOR_CORE)
+    {
+        size_t imageSize = static_cast<size_t>(toeplitz.maxKernelHeight) * toeplitz.maxSteps * 128;
+        size_t numFloats = imageSize * outData.numImages();
+
+        // The weights live in per-stream scratch, so concurrent calls on other streams don't overwrite them
+        weights.emplace(m_scratch.acquire(2 * numFloats * sizeof(float), stream));
+
+        float *hi   = weights->data<float>();
+        float *lo   = hi + numFloats;
+        toeplitz.hi = hi;
+        toeplitz.lo = lo;
+
+        cuda::ImageBatchVarShapeWrap<float> kernel(kernelData);
+
+        dim3 block(256);
+        dim3 grid(divUp(static_cast<int>(imageSize), block.x), 1, outData.numImages());
+        buildConv2DToeplitz<<<grid, block, 0, stream>>>(kernel, hi, lo, toeplitz.maxKernelHeight, toeplitz.maxSteps);
+        checkKernelErrors();
+    }
+
     typedef void (*filter2D_t)(
         const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
         const ImageBatchVarShapeDataStridedCuda &kernelData, const TensorDataStridedCuda &kernelAnchorData,
-        NVCVBorderType borderMode, float borderValue, cudaStream_t stream);
+        const ToeplitzWeights &toeplitz, NVCVBorderType borderMode, float borderValue, cudaStream_t stream);
 
     static const filter2D_t funcs[6][4] = {
         { Filter2D<uchar>, 0,  Filter2D<uchar3>,  Filter2D<uchar4>},
@@ -197,7 +466,7 @@ ErrorCode Conv2DVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
 
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, kernelData, kernelAnchorData, borderMode, borderValue, stream);
+    func(inData, outData, kernelData, kernelAnchorData, toeplitz, borderMode, borderValue, stream);
 
     return ErrorCode::SUCCESS;
 }
@@ -500,15 +769,6 @@ GaussianVarShape::GaussianVarShape(DataShape max_input_shape, DataShape max_outp
     , m_maxKernelSize(maxKernelSize)
     , m_maxBatchSize(maxBatchSize)
 {
-    if (maxBatchSize > 0)
-    {
-        NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * maxBatchSize * sizeof(float)));
-    }
-}
-
-GaussianVarShape::~GaussianVarShape()
-{
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
 }
 
 ErrorCode GaussianVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
@@ -586,7 +846,10 @@ ErrorCode GaussianVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inDat
     int kernelPitch2 = static_cast<int>(m_maxKernelSize.w * sizeof(float));
     int kernelPitch1 = m_maxKernelSize.h * kernelPitch2;
 
-    cuda::Tensor3DWrap<float, int32_t> kernelTensor(m_kernel, kernelPitch1, kernelPitch2);
+    // The kernel weights live in per-stream scratch, so concurrent calls on other streams don't overwrite them
+    auto kernel = m_scratch.acquire(static_cast<size_t>(kernelPitch1) * outData.numImages(), stream);
+
+    cuda::Tensor3DWrap<float, int32_t> kernelTensor(kernel.data<float>(), kernelPitch1, kernelPitch2);
 
     computeGaussianKernelVarShape<<<grid, block, 0, stream>>>(kernelTensor, dataKernelSize, m_maxKernelSize,
                                                               kernelSizeTensor, sigmaTensor);
@@ -714,15 +977,6 @@ AverageBlurVarShape::AverageBlurVarShape(DataShape max_input_shape, DataShape ma
     , m_maxKernelSize(maxKernelSize)
     , m_maxBatchSize(maxBatchSize)
 {
-    if (maxBatchSize > 0)
-    {
-        NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * maxBatchSize * sizeof(float)));
-    }
-}
-
-AverageBlurVarShape::~AverageBlurVarShape()
-{
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
 }
 
 ErrorCode AverageBlurVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
@@ -798,7 +1052,9 @@ ErrorCode AverageBlurVarShape::infer(const ImageBatchVarShapeDataStridedCuda &in
     int kernelPitch2 = static_cast<int>(m_maxKernelSize.w * sizeof(float));
     int kernelPitch1 = m_maxKernelSize.h * kernelPitch2;
 
-    cuda::Tensor3DWrap<float, int32_t> kernelTensor(m_kernel, kernelPitch1, kernelPitch2);
+    auto kernel = m_scratch.acquire(static_cast<size_t>(kernelPitch1) * outData.numImages(), stream);
+
+    cuda::Tensor3DWrap<float, int32_t> kernelTensor(kernel.data<float>(), kernelPitch1, kernelPitch2);
 
     computeMeanKernelVarShape<<<grid, block, 0, stream>>>(kernelTensor, kernelSizeTensor, kernelAnchorTensor);
 
@@ -22,9 +22,9 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
-#include "gaussian_noise_util.cuh"
 
-#include <curand_kernel.h>
+#include <cvcuda/cuda_tools/Philox.hpp>
+
 using namespace nvcv::legacy::helpers;
 
 using namespace nvcv::legacy::cuda_op;
@@ -35,120 +35,113 @@ using namespace nvcv::cuda;
 
 template<typename T, typename StrideType>
 __global__ void gaussian_noise_kernel(const Tensor3DWrap<T, StrideType> src, Tensor3DWrap<T, StrideType> dst,
-                                      curandState *state, Tensor1DWrap<float, int32_t> mu,
+                                      unsigned long long seed, uint32_t epoch, Tensor1DWrap<float, int32_t> mu,
                                       Tensor1DWrap<float, int32_t> sigma, int rows, int cols)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = rows * cols;
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = rows * cols;
     while (offset < total_size)
     {
         int   dst_x                       = offset % cols;
         int   dst_y                       = offset / cols;
-        float rand                        = curand_normal(&localState);
+        float rand                        = Philox(seed, batch_idx, offset, epoch).normal();
         float delta                       = mu[batch_idx] + rand * sigma[batch_idx];
         *dst.ptr(batch_idx, dst_y, dst_x) = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x) + delta);
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T, typename StrideType>
 __global__ void gaussian_noise_per_channel_kernel(const Tensor4DWrap<T, StrideType> src,
-                                                  Tensor4DWrap<T, StrideType> dst, curandState *state,
-                                                  Tensor1DWrap<float, int32_t> mu, Tensor1DWrap<float, int32_t> sigma,
-                                                  int rows, int cols, int channel)
+                                                  Tensor4DWrap<T, StrideType> dst, unsigned long long seed,
+                                                  uint32_t epoch, Tensor1DWrap<float, int32_t> mu,
+                                                  Tensor1DWrap<float, int32_t> sigma, int rows, int cols, int channel)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = rows * cols;
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = rows * cols;
     while (offset < total_size)
     {
         int dst_x = offset % cols;
         int dst_y = offset / cols;
+
+        Philox rng(seed, batch_idx, offset, epoch);
         for (int ch = 0; ch < channel; ch++)
         {
-            float rand                            = curand_normal(&localState);
+            float rand                            = rng.normal();
             float delta                           = mu[batch_idx] + rand * sigma[batch_idx];
             *dst.ptr(batch_idx, dst_y, dst_x, ch) = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x, ch) + delta);
         }
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T, typename StrideType>
 __global__ void gaussian_noise_float_kernel(const Tensor3DWrap<T, StrideType> src, Tensor3DWrap<T, StrideType> dst,
-                                            curandState *state, Tensor1DWrap<float, int32_t> mu,
+                                            unsigned long long seed, uint32_t epoch, Tensor1DWrap<float, int32_t> mu,
                                             Tensor1DWrap<float, int32_t> sigma, int rows, int cols)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = rows * cols;
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = rows * cols;
     while (offset < total_size)
     {
         int   dst_x                       = offset % cols;
         int   dst_y                       = offset / cols;
-        float rand                        = curand_normal(&localState);
+        float rand                        = Philox(seed, batch_idx, offset, epoch).normal();
         float delta                       = mu[batch_idx] + rand * sigma[batch_idx];
         T     out                         = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x) + delta);
         *dst.ptr(batch_idx, dst_y, dst_x) = clamp(StaticCast<float>(out), 0.f, 1.f);
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T, typename StrideType>
 __global__ void gaussian_noise_float_per_channel_kernel(const Tensor4DWrap<T, StrideType> src,
-                                                        Tensor4DWrap<T, StrideType> dst, curandState *state,
-                                                        Tensor1DWrap<float, int32_t> mu,
+                                                        Tensor4DWrap<T, StrideType> dst, unsigned long long seed,
+                                                        uint32_t epoch, Tensor1DWrap<float, int32_t> mu,
                                                         Tensor1DWrap<float, int32_t> sigma, int rows, int cols,
                                                         int channel)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = rows * cols;
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = rows * cols;
     while (offset < total_size)
     {
         int dst_x = offset % cols;
         int dst_y = offset / cols;
+
+        Philox rng(seed, batch_idx, offset, epoch);
         for (int ch = 0; ch < channel; ch++)
         {
-            float rand                            = curand_normal(&localState);
+            float rand                            = rng.normal();
             float delta                           = mu[batch_idx] + rand * sigma[batch_idx];
             T     out                             = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x, ch) + delta);
             *dst.ptr(batch_idx, dst_y, dst_x, ch) = clamp(StaticCast<float>(out), 0.f, 1.f);
         }
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T, typename StrideType = int32_t>
 void gaussian_noise(const nvcv::TensorDataStridedCuda &d_in, const nvcv::TensorDataStridedCuda &d_out, int batch,
-                    int rows, int cols, curandState *m_states, const nvcv::TensorDataStridedCuda &_mu,
-                    const nvcv::TensorDataStridedCuda &_sigma, cudaStream_t stream)
+                    int rows, int cols, unsigned long long seed, uint32_t epoch,
+                    const nvcv::TensorDataStridedCuda &_mu, const nvcv::TensorDataStridedCuda &_sigma,
+                    cudaStream_t stream)
 {
     auto                         src_ptr = CreateTensorWrapNHW<T, StrideType>(d_in);
     auto                         dst_ptr = CreateTensorWrapNHW<T, StrideType>(d_out);
     Tensor1DWrap<float, int32_t> mu(_mu);
     Tensor1DWrap<float, int32_t> sigma(_sigma);
 
-    gaussian_noise_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma, rows, cols);
+    gaussian_noise_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma, rows, cols);
     checkKernelErrors();
 }
 
 template<typename T, typename StrideType = int32_t>
 void gaussian_noise_per_channel(const nvcv::TensorDataStridedCuda &d_in, const nvcv::TensorDataStridedCuda &d_out,
-                                int batch, int channels, int rows, int cols, curandState *m_states,
+                                int batch, int channels, int rows, int cols, unsigned long long seed, uint32_t epoch,
                                 const nvcv::TensorDataStridedCuda &_mu, const nvcv::TensorDataStridedCuda &_sigma,
                                 cudaStream_t stream)
 {
@@ -158,29 +151,31 @@ void gaussian_noise_per_channel(const nvcv::TensorDataStridedCuda &d_in, const n
     Tensor1DWrap<float, int32_t> sigma(_sigma);
 
     gaussian_noise_per_channel_kernel<T>
-        <<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma, rows, cols, channels);
+        <<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma, rows, cols, channels);
     checkKernelErrors();
 }
 
 template<typename T, typename StrideType = int32_t>
 void gaussian_noise_float(const nvcv::TensorDataStridedCuda &d_in, const nvcv::TensorDataStridedCuda &d_out, int batch,
-                          int rows, int cols, curandState *m_states, const nvcv::TensorDataStridedCuda &_mu,
-                          const nvcv::TensorDataStridedCuda &_sigma, cudaStream_t stream)
+                          int rows, int cols, unsigned long long seed, uint32_t epoch,
+                          const nvcv::TensorDataStridedCuda &_mu, const nvcv::TensorDataStridedCuda &_sigma,
+                          cudaStream_t stream)
 {
     auto                         src_ptr = CreateTensorWrapNHW<T, StrideType>(d_in);
     auto                         dst_ptr = CreateTensorWrapNHW<T, StrideType>(d_out);
     Tensor1DWrap<float, int32_t> mu(_mu);
     Tensor1DWrap<float, int32_t> sigma(_sigma);
 
-    gaussian_noise_float_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma, rows, cols);
+    gaussian_noise_float_kernel<T>
+        <<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma, rows, cols);
     checkKernelErrors();
 }
 
 template<typename T, typename StrideType = int32_t>
 void gaussian_noise_float_per_channel(const nvcv::TensorDataStridedCuda &d_in, const nvcv::TensorDataStridedCuda &d_out,
-                                      int batch, int channels, int rows, int cols, curandState *m_states,
-                                      const nvcv::TensorDataStridedCuda &_mu, const nvcv::TensorDataStridedCuda &_sigma,
-                                      cudaStream_t stream)
+                                      int batch, int channels, int rows, int cols, unsigned long long seed,
+                                      uint32_t epoch, const nvcv::TensorDataStridedCuda &_mu,
+                                      const nvcv::TensorDataStridedCuda &_sigma, cudaStream_t stream)
 {
     auto                         src_ptr = CreateTensorWrapNHWC<T, StrideType>(d_in);
     auto                         dst_ptr = CreateTensorWrapNHWC<T, StrideType>(d_out);
@@ -188,7 +183,7 @@ void gaussian_noise_float_per_channel(const nvcv::TensorDataStridedCuda &d_in, c
     Tensor1DWrap<float, int32_t> sigma(_sigma);
 
     gaussian_noise_float_per_channel_kernel<T>
-        <<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma, rows, cols, channels);
+        <<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma, rows, cols, channels);
     checkKernelErrors();
 }
 
@@ -196,29 +191,12 @@ namespace nvcv::legacy::cuda_op {
 
 GaussianNoise::GaussianNoise(DataShape max_input_shape, DataShape max_output_shape, int maxBatchSize)
     : CudaBaseOp(max_input_shape, max_output_shape)
-    , m_states(nullptr)
-    , m_seed(0)
-    , m_maxBatchSize(maxBatchSize)
-    , m_setupDone(false)
 {
     if (maxBatchSize < 0)
     {
         LOG_ERROR("Invalid num of max batch size " << maxBatchSize);
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Parameter error!");
     }
-    cudaError_t err = cudaMalloc((void **)&m_states, sizeof(curandState) * BLOCK * maxBatchSize);
-    if (err != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory allocation error of size: " << sizeof(curandState) * BLOCK * maxBatchSize);
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-}
-
-GaussianNoise::~GaussianNoise()
-{
-    cudaError_t err = cudaFree(m_states);
-    if (err != cudaSuccess)
-        LOG_ERROR("CUDA memory free error, possible memory leak!");
 }
 
 ErrorCode GaussianNoise::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
@@ -305,18 +283,15 @@ ErrorCode GaussianNoise::infer(const TensorDataStridedCuda &inData, const Tensor
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    if (!m_setupDone || m_seed != seed)
-    {
-        m_seed = seed;
-        setup_gaussian_rand_kernel<<<m_maxBatchSize, BLOCK, 0, stream>>>(m_states, m_seed);
-        m_setupDone = true;
-    }
+    // Each call draws from its own Philox subsequence, so the same seed gives new noise on every call
+    uint32_t epoch = m_epoch.fetch_add(1);
 
     if (per_channel)
     {
         typedef void (*func_t)(const TensorDataStridedCuda &d_in, const TensorDataStridedCuda &d_out, int batch,
-                               int channels, int rows, int cols, curandState *m_states, const TensorDataStridedCuda &mu,
-                               const TensorDataStridedCuda &sigma, cudaStream_t stream);
+                               int channels, int rows, int cols, unsigned long long seed, uint32_t epoch,
+                               const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma,
+                               cudaStream_t stream);
 
         static const func_t funcs[5] = {
             gaussian_noise_per_channel<uchar>, 0, gaussian_noise_per_channel<ushort>, gaussian_noise_per_channel<short>,
@@ -331,22 +306,23 @@ ErrorCode GaussianNoise::infer(const TensorDataStridedCuda &inData, const Tensor
         {
             const func_t func = float_funcs[0];
             assert(func != 0);
-            func(inData, outData, inAccess->numSamples(), channels, inAccess->numRows(), inAccess->numCols(), m_states,
-                 mu, sigma, stream);
+            func(inData, outData, inAccess->numSamples(), channels, inAccess->numRows(), inAccess->numCols(), seed,
+                 epoch, mu, sigma, stream);
         }
         else
         {
             const func_t func = funcs[in_data_type];
             assert(func != 0);
-            func(inData, outData, inAccess->numSamples(), channels, inAccess->numRows(), inAccess->numCols(), m_states,
-                 mu, sigma, stream);
+            func(inData, outData, inAccess->numSamples(), channels, inAccess->numRows(), inAccess->numCols(), seed,
+                 epoch, mu, sigma, stream);
         }
     }
     else
     {
         typedef void (*func_t)(const TensorDataStridedCuda &d_in, const TensorDataStridedCuda &d_out, int batch,
-                               int rows, int cols, curandState *m_states, const TensorDataStridedCuda &mu,
-                               const TensorDataStridedCuda &sigma, cudaStream_t stream);
+                               int rows, int cols, unsigned long long seed, uint32_t epoch,
+                               const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma,
+                               cudaStream_t stream);
 
         static const func_t funcs[5][4] = {
             {      gaussian_noise<uchar>,      gaussian_noise<uchar2>,      gaussian_noise<uchar3>,gaussian_noise<uchar4>                                                                                                   },
@@ -364,15 +340,15 @@ ErrorCode GaussianNoise::infer(const TensorDataStridedCuda &inData, const Tensor
         {
             const func_t func = float_funcs[channels - 1];
             assert(func != 0);
-            func(inData, outData, inAccess->numSamples(), inAccess->numRows(), inAccess->numCols(), m_states, mu, sigma,
-                 stream);
+            func(inData, outData, inAccess->numSamples(), inAccess->numRows(), inAccess->numCols(), seed, epoch, mu,
+                 sigma, stream);
         }
         else
         {
             const func_t func = funcs[in_data_type][channels - 1];
             assert(func != 0);
-            func(inData, outData, inAccess->numSamples(), inAccess->numRows(), inAccess->numCols(), m_states, mu, sigma,
-                 stream);
+            func(inData, outData, inAccess->numSamples(), inAccess->numRows(), inAccess->numCols(), seed, epoch, mu,
+                 sigma, stream);
         }
     }
     return SUCCESS;
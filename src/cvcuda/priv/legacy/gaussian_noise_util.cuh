@@ -1,30 +0,0 @@
-/* Copyright (c) 2021-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
- *
- * SPDX-FileCopyrightText: NVIDIA CORPORATION & AFFILIATES
- * SPDX-License-Identifier: Apache-2.0
- *
- * Copyright (C) 2021-2022, Bytedance Inc. All rights reserved.
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *     http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
-*/
-
-#ifndef GAUSSIAN_NOISE_UTILS_CUH
-#define GAUSSIAN_NOISE_UTILS_CUH
-
-#include "CvCudaUtils.cuh"
-
-#include <curand_kernel.h>
-
-__global__ void setup_gaussian_rand_kernel(curandState *state, unsigned long long seed);
-
-#endif // GAUSSIAN_NOISE_UTILS_CUH
@@ -22,9 +22,9 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
-#include "gaussian_noise_util.cuh"
 
-#include <curand_kernel.h>
+#include <cvcuda/cuda_tools/Philox.hpp>
+
 using namespace nvcv::legacy::helpers;
 
 using namespace nvcv::legacy::cuda_op;
@@ -35,103 +35,98 @@ using namespace nvcv::cuda;
 
 template<typename T>
 __global__ void gaussian_noise_kernel(const ImageBatchVarShapeWrap<T> src, ImageBatchVarShapeWrap<T> dst,
-                                      curandState *state, Tensor1DWrap<float> mu, Tensor1DWrap<float> sigma)
+                                      unsigned long long seed, uint32_t epoch, Tensor1DWrap<float> mu,
+                                      Tensor1DWrap<float> sigma)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = dst.height(batch_idx) * dst.width(batch_idx);
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = dst.height(batch_idx) * dst.width(batch_idx);
     while (offset < total_size)
     {
         int   dst_x                       = offset % dst.width(batch_idx);
         int   dst_y                       = offset / dst.width(batch_idx);
-        float rand                        = curand_normal(&localState);
+        float rand                        = Philox(seed, batch_idx, offset, epoch).normal();
         float delta                       = mu[batch_idx] + rand * sigma[batch_idx];
         *dst.ptr(batch_idx, dst_y, dst_x) = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x) + delta);
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T>
 __global__ void gaussian_noise_per_channel_kernel(const ImageBatchVarShapeWrapNHWC<T> src,
-                                                  ImageBatchVarShapeWrapNHWC<T> dst, curandState *state,
-                                                  Tensor1DWrap<float> mu, Tensor1DWrap<float> sigma)
+                                                  ImageBatchVarShapeWrapNHWC<T> dst, unsigned long long seed,
+                                                  uint32_t epoch, Tensor1DWrap<float> mu, Tensor1DWrap<float> sigma)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = dst.height(batch_idx) * dst.width(batch_idx);
-    int         channel    = src.numChannels();
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = dst.height(batch_idx) * dst.width(batch_idx);
+    int channel    = src.numChannels();
     while (offset < total_size)
     {
         int dst_x = offset % dst.width(batch_idx);
         int dst_y = offset / dst.width(batch_idx);
+
+        Philox rng(seed, batch_idx, offset, epoch);
         for (int ch = 0; ch < channel; ch++)
         {
-            float rand                            = curand_normal(&localState);
+            float rand                            = rng.normal();
             float delta                           = mu[batch_idx] + rand * sigma[batch_idx];
             *dst.ptr(batch_idx, dst_y, dst_x, ch) = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x, ch) + delta);
         }
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T>
 __global__ void gaussian_noise_float_kernel(const ImageBatchVarShapeWrap<T> src, ImageBatchVarShapeWrap<T> dst,
-                                            curandState *state, Tensor1DWrap<float> mu, Tensor1DWrap<float> sigma)
+                                            unsigned long long seed, uint32_t epoch, Tensor1DWrap<float> mu,
+                                            Tensor1DWrap<float> sigma)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = dst.height(batch_idx) * dst.width(batch_idx);
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = dst.height(batch_idx) * dst.width(batch_idx);
     while (offset < total_size)
     {
         int   dst_x                       = offset % dst.width(batch_idx);
         int   dst_y                       = offset / dst.width(batch_idx);
-        float rand                        = curand_normal(&localState);
+        float rand                        = Philox(seed, batch_idx, offset, epoch).normal();
         float delta                       = mu[batch_idx] + rand * sigma[batch_idx];
         T     out                         = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x) + delta);
         *dst.ptr(batch_idx, dst_y, dst_x) = clamp(StaticCast<float>(out), 0.f, 1.f);
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T>
 __global__ void gaussian_noise_float_per_channel_kernel(const ImageBatchVarShapeWrapNHWC<T> src,
-                                                        ImageBatchVarShapeWrapNHWC<T> dst, curandState *state,
-                                                        Tensor1DWrap<float> mu, Tensor1DWrap<float> sigma)
+                                                        ImageBatchVarShapeWrapNHWC<T> dst, unsigned long long seed,
+                                                        uint32_t epoch, Tensor1DWrap<float> mu,
+                                                        Tensor1DWrap<float> sigma)
 {
-    int         offset     = threadIdx.x;
-    int         batch_idx  = blockIdx.x;
-    int         id         = threadIdx.x + blockIdx.x * blockDim.x;
-    int         total_size = dst.height(batch_idx) * dst.width(batch_idx);
-    int         channel    = src.numChannels();
-    curandState localState = state[id];
+    int offset     = threadIdx.x;
+    int batch_idx  = blockIdx.x;
+    int total_size = dst.height(batch_idx) * dst.width(batch_idx);
+    int channel    = src.numChannels();
     while (offset < total_size)
     {
         int dst_x = offset % dst.width(batch_idx);
         int dst_y = offset / dst.width(batch_idx);
+
+        Philox rng(seed, batch_idx, offset, epoch);
         for (int ch = 0; ch < channel; ch++)
         {
-            float rand                            = curand_normal(&localState);
+            float rand                            = rng.normal();
             float delta                           = mu[batch_idx] + rand * sigma[batch_idx];
             T     out                             = SaturateCast<T>(*src.ptr(batch_idx, dst_y, dst_x, ch) + delta);
             *dst.ptr(batch_idx, dst_y, dst_x, ch) = clamp(StaticCast<float>(out), 0.f, 1.f);
         }
         offset += blockDim.x;
     }
-    state[id] = localState;
 }
 
 template<typename T>
 void gaussian_noise(const nvcv::ImageBatchVarShapeDataStridedCuda &d_in,
-                    const nvcv::ImageBatchVarShapeDataStridedCuda &d_out, curandState *m_states,
+                    const nvcv::ImageBatchVarShapeDataStridedCuda &d_out, unsigned long long seed, uint32_t epoch,
                     const nvcv::TensorDataStridedCuda &_mu, const nvcv::TensorDataStridedCuda &_sigma,
                     cudaStream_t stream)
 {
@@ -141,14 +136,14 @@ void gaussian_noise(const nvcv::ImageBatchVarShapeDataStridedCuda &d_in,
     Tensor1DWrap<float>       sigma(_sigma);
 
     int batch = d_in.numImages();
-    gaussian_noise_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma);
+    gaussian_noise_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma);
     checkKernelErrors();
 }
 
 template<typename T>
 void gaussian_noise_per_channel(const nvcv::ImageBatchVarShapeDataStridedCuda &d_in,
                                 const nvcv::ImageBatchVarShapeDataStridedCuda &d_out, int channels,
-                                curandState *m_states, const nvcv::TensorDataStridedCuda &_mu,
+                                unsigned long long seed, uint32_t epoch, const nvcv::TensorDataStridedCuda &_mu,
                                 const nvcv::TensorDataStridedCuda &_sigma, cudaStream_t stream)
 {
     ImageBatchVarShapeWrapNHWC<T> src_ptr(d_in, channels);
@@ -157,13 +152,13 @@ void gaussian_noise_per_channel(const nvcv::ImageBatchVarShapeDataStridedCuda &d
     Tensor1DWrap<float>           sigma(_sigma);
 
     int batch = d_in.numImages();
-    gaussian_noise_per_channel_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma);
+    gaussian_noise_per_channel_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma);
     checkKernelErrors();
 }
 
 template<typename T>
 void gaussian_noise_float(const nvcv::ImageBatchVarShapeDataStridedCuda &d_in,
-                          const nvcv::ImageBatchVarShapeDataStridedCuda &d_out, curandState *m_states,
+                          const nvcv::ImageBatchVarShapeDataStridedCuda &d_out, unsigned long long seed, uint32_t epoch,
                           const nvcv::TensorDataStridedCuda &_mu, const nvcv::TensorDataStridedCuda &_sigma,
                           cudaStream_t stream)
 {
@@ -173,14 +168,14 @@ void gaussian_noise_float(const nvcv::ImageBatchVarShapeDataStridedCuda &d_in,
     Tensor1DWrap<float>       sigma(_sigma);
 
     int batch = d_in.numImages();
-    gaussian_noise_float_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma);
+    gaussian_noise_float_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma);
     checkKernelErrors();
 }
 
 template<typename T>
 void gaussian_noise_float_per_channel(const nvcv::ImageBatchVarShapeDataStridedCuda &d_in,
                                       const nvcv::ImageBatchVarShapeDataStridedCuda &d_out, int channels,
-                                      curandState *m_states, const nvcv::TensorDataStridedCuda &_mu,
+                                      unsigned long long seed, uint32_t epoch, const nvcv::TensorDataStridedCuda &_mu,
                                       const nvcv::TensorDataStridedCuda &_sigma, cudaStream_t stream)
 {
     ImageBatchVarShapeWrapNHWC<T> src_ptr(d_in, channels);
@@ -189,7 +184,8 @@ void gaussian_noise_float_per_channel(const nvcv::ImageBatchVarShapeDataStridedC
     Tensor1DWrap<float>           sigma(_sigma);
 
     int batch = d_in.numImages();
-    gaussian_noise_float_per_channel_kernel<T><<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, m_states, mu, sigma);
+    gaussian_noise_float_per_channel_kernel<T>
+        <<<batch, BLOCK, 0, stream>>>(src_ptr, dst_ptr, seed, epoch, mu, sigma);
     checkKernelErrors();
 }
 
@@ -197,29 +193,12 @@ namespace nvcv::legacy::cuda_op {
 
 GaussianNoiseVarShape::GaussianNoiseVarShape(DataShape max_input_shape, DataShape max_output_shape, int maxBatchSize)
     : CudaBaseOp(max_input_shape, max_output_shape)
-    , m_states(nullptr)
-    , m_seed(0)
-    , m_maxBatchSize(maxBatchSize)
-    , m_setupDone(false)
 {
     if (maxBatchSize < 0)
     {
         LOG_ERROR("Invalid num of max batch size " << maxBatchSize);
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "maxBatchSize must be >= 0");
     }
-    cudaError_t err = cudaMalloc((void **)&m_states, sizeof(curandState) * BLOCK * maxBatchSize);
-    if (err != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory allocation error of size: " << sizeof(curandState) * BLOCK * maxBatchSize);
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-}
-
-GaussianNoiseVarShape::~GaussianNoiseVarShape()
-{
-    cudaError_t err = cudaFree(m_states);
-    if (err != cudaSuccess)
-        LOG_ERROR("CUDA memory free error, possible memory leak!");
 }
 
 ErrorCode GaussianNoiseVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
@@ -288,18 +267,14 @@ ErrorCode GaussianNoiseVarShape::infer(const ImageBatchVarShapeDataStridedCuda &
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    if (!m_setupDone || m_seed != seed)
-    {
-        m_seed = seed;
-        setup_gaussian_rand_kernel<<<m_maxBatchSize, BLOCK, 0, stream>>>(m_states, m_seed);
-        m_setupDone = true;
-    }
+    // Each call draws from its own Philox subsequence, so the same seed gives new noise on every call
+    uint32_t epoch = m_epoch.fetch_add(1);
 
     if (per_channel)
     {
         typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &d_in,
-                               const ImageBatchVarShapeDataStridedCuda &d_out, int channels, curandState *m_states,
-                               const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma,
+                               const ImageBatchVarShapeDataStridedCuda &d_out, int channels, unsigned long long seed,
+                               uint32_t epoch, const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma,
                                cudaStream_t stream);
 
         static const func_t funcs[5] = {
@@ -315,19 +290,19 @@ ErrorCode GaussianNoiseVarShape::infer(const ImageBatchVarShapeDataStridedCuda &
         {
             const func_t func = float_funcs[0];
             assert(func != 0);
-            func(inData, outData, channels, m_states, mu, sigma, stream);
+            func(inData, outData, channels, seed, epoch, mu, sigma, stream);
         }
         else
         {
             const func_t func = funcs[in_data_type];
             assert(func != 0);
-            func(inData, outData, channels, m_states, mu, sigma, stream);
+            func(inData, outData, channels, seed, epoch, mu, sigma, stream);
         }
     }
     else
     {
         typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &d_in,
-                               const ImageBatchVarShapeDataStridedCuda &d_out, curandState *m_states,
+                               const ImageBatchVarShapeDataStridedCuda &d_out, unsigned long long seed, uint32_t epoch,
                                const TensorDataStridedCuda &mu, const TensorDataStridedCuda &sigma,
                                cudaStream_t stream);
 
@@ -347,13 +322,13 @@ ErrorCode GaussianNoiseVarShape::infer(const ImageBatchVarShapeDataStridedCuda &
         {
             const func_t func = float_funcs[channels - 1];
             assert(func != 0);
-            func(inData, outData, m_states, mu, sigma, stream);
+            func(inData, outData, seed, epoch, mu, sigma, stream);
         }
         else
         {
             const func_t func = funcs[in_data_type][channels - 1];
             assert(func != 0);
-            func(inData, outData, m_states, mu, sigma, stream);
+            func(inData, outData, seed, epoch, mu, sigma, stream);
         }
     }
     return SUCCESS;
@@ -24,8 +24,8 @@
 #include "CvCudaUtils.cuh"
 #include "cub/cub.cuh"
 #include "inpaint_utils.cuh"
-#include "reduce_kernel_utils.cuh"
 
+#include <cooperative_groups.h>
 #include <cvcuda/cuda_tools/TypeTraits.hpp>
 
 using namespace nvcv::legacy::helpers;
@@ -39,9 +39,8 @@ using namespace nvcv::cuda;
 #define INSIDE 2 //unknown
 #define CHANGE 3 //servise
 
-#define BLOCK            32
-#define BLOCK_S          16
-#define REDUCE_GRID_SIZE 64
+#define BLOCK   32
+#define BLOCK_S 16
 
 template<typename MaskWrapper, typename T>
 __global__ void copy_mask_data(MaskWrapper src, Ptr2dNHWC<T> dst, int row_offset, int col_offset, int value, int2 size)
@@ -62,11 +61,25 @@ __global__ void copy_mask_data(MaskWrapper src, Ptr2dNHWC<T> dst, int row_offset
     }
 }
 
-template<typename OutWrapper>
-__device__ void inpaint(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, OutWrapper out, int i, int j, int range, int ch)
+template<typename InWrapper, typename OutWrapper>
+__global__ void copy_input(InWrapper src, OutWrapper dst, int2 size, int ch)
 {
+    int x = blockIdx.x * blockDim.x + threadIdx.x;
+    int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if (x >= size.x || y >= size.y)
+        return;
     const int batch_idx = get_batch_idx();
 
+    for (int c = 0; c < ch; ++c)
+    {
+        *dst.ptr(batch_idx, y, x, c) = *src.ptr(batch_idx, y, x, c);
+    }
+}
+
+template<typename OutWrapper>
+__device__ void inpaint(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, OutWrapper out, int batch_idx, int i, int j,
+                        int range, int ch)
+{
     for (int color = 0; color < ch; color++)
     {
         float2 gradI, gradT, r;
@@ -206,17 +219,14 @@ __device__ void inpaint(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, OutWrapp
     }
 }
 
+// One narrow band pixel of a fast marching pass, returns whether the band grew
 template<typename OutWrapper>
-__global__ void TeleaInpaintFMM(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, OutWrapper out, int range,
-                                Ptr2dNHWC<unsigned char> band, int ch)
+__device__ bool TeleaInpaintStep(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, OutWrapper out, int range,
+                                 Ptr2dNHWC<unsigned char> band, int ch, int batch_idx, int ii, int jj)
 {
-    int       i = 0, j = 0;
-    float     dist;
-    const int ii        = blockIdx.x * blockDim.x + threadIdx.x; // row
-    const int jj        = blockIdx.y * blockDim.y + threadIdx.y; // col
-    const int batch_idx = get_batch_idx();
-    if (ii >= f.rows || jj >= f.cols)
-        return;
+    int   i = 0, j = 0;
+    float dist;
+    bool  grown = false;
     // method1 all the thread do the computation toghther for iteration times until convergence
     if (*band.ptr(batch_idx, ii, jj) != 0)
     {
@@ -248,18 +258,60 @@ __global__ void TeleaInpaintFMM(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t,
 
             if (*f.ptr(batch_idx, i, j) == INSIDE)
             {
-                dist = min4(FastMarching_solve(i - 1, j, i, j - 1, f, t), FastMarching_solve(i + 1, j, i, j - 1, f, t),
-                            FastMarching_solve(i - 1, j, i, j + 1, f, t), FastMarching_solve(i + 1, j, i, j + 1, f, t));
+                dist = min4(FastMarching_solve(batch_idx, i - 1, j, i, j - 1, f, t),
+                            FastMarching_solve(batch_idx, i + 1, j, i, j - 1, f, t),
+                            FastMarching_solve(batch_idx, i - 1, j, i, j + 1, f, t),
+                            FastMarching_solve(batch_idx, i + 1, j, i, j + 1, f, t));
                 *t.ptr(batch_idx, i, j) = dist;
 
-                inpaint(f, t, out, i, j, range, ch);
+                inpaint(f, t, out, batch_idx, i, j, range, ch);
 
                 *f.ptr(batch_idx, i, j)    = BAND;
                 *band.ptr(batch_idx, i, j) = 1; // non-zero
+                grown                      = true;
             }
         }
         *band.ptr(batch_idx, ii, jj) = 0;
     }
+    return grown;
+}
+
+// Persistent fast marching over all samples, passes are separated by a grid-wide barrier and the loop ends on device
+// once a pass does not grow the band, maxPasses bounds it by the band depth of the largest image
+template<typename OutWrapper>
+__global__ void TeleaInpaintFMM(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, OutWrapper out, int range,
+                                Ptr2dNHWC<unsigned char> band, int ch, int *flags, int maxPasses)
+{
+    namespace cg = cooperative_groups;
+
+    cg::grid_group grid      = cg::this_grid();
+    const int      numPixels = f.batches * f.rows * f.cols;
+
+    for (int pass = 0; pass < maxPasses; ++pass)
+    {
+        volatile int *flag = flags + pass % INPAINT_FLAGS;
+        if (grid.thread_rank() == 0)
+        {
+            flags[(pass + 1) % INPAINT_FLAGS] = 0;
+        }
+
+        for (int idx = grid.thread_rank(); idx < numPixels; idx += grid.size())
+        {
+            int batch_idx = idx / (f.rows * f.cols);
+            int ii        = (idx / f.cols) % f.rows;
+            int jj        = idx % f.cols;
+            if (TeleaInpaintStep(f, t, out, range, band, ch, batch_idx, ii, jj))
+            {
+                *flag = 1;
+            }
+        }
+        grid.sync();
+
+        if (*flag == 0)
+        {
+            break;
+        }
+    }
 }
 
 template<typename Ptr2D, typename T, typename D, typename BrdRd>
@@ -400,51 +452,6 @@ void set_value(Ptr2dNHWC<T> src, Ptr2dNHWC<T2> mask, T value, cudaStream_t strea
     checkKernelErrors();
 }
 
-__global__ void deviceReduceImage(Ptr2dNHWC<unsigned char> src_ptr, int *out)
-{
-    int batch_idx        = get_batch_idx();
-    int block_idx        = get_bid();
-    int grid_size        = get_grid_size();
-    int height           = src_ptr.rows;
-    int width            = src_ptr.cols;
-    int tid              = threadIdx.x;
-    int out_batch_offset = batch_idx * grid_size + block_idx; // xmin, ymin, xmax, ymax intervleaved
-    int sum              = 0;
-    //reduce multiple elements per thread
-    for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < height * width; i += blockDim.x * gridDim.x)
-    {
-        int x = i % width;
-        int y = i / width;
-        sum += *src_ptr.ptr(batch_idx, y, x);
-    }
-
-    sum = blockReduceSum(sum);
-    if (tid == 0)
-    {
-        out[out_batch_offset] = sum;
-    }
-}
-
-inline int finish_flag_reduce(Ptr2dNHWC<unsigned char> src_ptr, int *d_out, int *d_out2, cudaStream_t stream)
-{
-    int  block_size = 256; // maximum threads per block
-    int  g_size     = REDUCE_GRID_SIZE;
-    dim3 grid_size(g_size, 1, src_ptr.batches); // 32 resident blocks per sm
-
-    deviceReduceImage<<<grid_size, block_size, 0, stream>>>(src_ptr, d_out);
-    checkKernelErrors();
-
-    int  block_size2 = g_size;
-    dim3 grid_size2(1, 1, 1);
-    int  points_set_num = g_size * src_ptr.batches;
-    deviceReducePoints<<<grid_size2, block_size2, 0, stream>>>(d_out, d_out2, points_set_num);
-    checkKernelErrors();
-    int rst = 0;
-    checkCudaErrors(cudaMemcpyAsync((void *)&rst, (void *)d_out2, sizeof(int), cudaMemcpyDeviceToHost, stream));
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    return rst;
-}
-
 template<typename T>
 ErrorCode inpaint_helper(const nvcv::TensorDataStridedCuda &inData, const nvcv::TensorDataStridedCuda &mask,
                          const nvcv::TensorDataStridedCuda &outData, void *workspace, unsigned char *kernel_ptr,
@@ -458,11 +465,10 @@ ErrorCode inpaint_helper(const nvcv::TensorDataStridedCuda &inData, const nvcv::
     int ecols = width + 2;
     int erows = height + 2;
 
-    int   *block_reduce_buffer1 = (int *)workspace;
-    int   *block_reduce_buffer2 = (int *)((char *)block_reduce_buffer1 + sizeof(int) * REDUCE_GRID_SIZE * maxBatchSize);
-    float *t_ptr                = (float *)((char *)block_reduce_buffer2 + sizeof(int) * 1);
-    unsigned char *f_ptr        = (unsigned char *)((char *)t_ptr + sizeof(float) * batch * erows * ecols * 1);
-    unsigned char *band_ptr     = (unsigned char *)((char *)f_ptr + sizeof(unsigned char) * batch * erows * ecols * 1);
+    int           *flags    = (int *)workspace;
+    float         *t_ptr    = (float *)((char *)flags + sizeof(int) * INPAINT_FLAGS);
+    unsigned char *f_ptr    = (unsigned char *)((char *)t_ptr + sizeof(float) * batch * erows * ecols * 1);
+    unsigned char *band_ptr = (unsigned char *)((char *)f_ptr + sizeof(unsigned char) * batch * erows * ecols * 1);
     unsigned char *inpaint_mask_ptr
         = (unsigned char *)((char *)band_ptr + sizeof(unsigned char) * batch * erows * ecols * 1);
 
@@ -471,30 +477,34 @@ ErrorCode inpaint_helper(const nvcv::TensorDataStridedCuda &inData, const nvcv::
     Ptr2dNHWC<unsigned char> band(batch, erows, ecols, 1, (unsigned char *)band_ptr);
     Ptr2dNHWC<unsigned char> inpaint_mask(batch, erows, ecols, 1, (unsigned char *)inpaint_mask_ptr);
 
-    // copy input to output
     auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
 
     auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
     NVCV_ASSERT(outAccess);
 
-    for (uint32_t i = 0; i < inAccess->numSamples(); ++i)
+    if (inAccess->sampleStride() * batch > nvcv::cuda::TypeTraits<int32_t>::max
+        || outAccess->sampleStride() * batch > nvcv::cuda::TypeTraits<int32_t>::max)
     {
-        void *inSampData  = inAccess->sampleData(i);
-        void *outSampData = outAccess->sampleData(i);
-
-        checkCudaErrors(cudaMemcpy2DAsync(outSampData, outAccess->rowStride(), inSampData, inAccess->rowStride(),
-                                          inAccess->numCols() * inAccess->colStride(), inAccess->numRows(),
-                                          cudaMemcpyDeviceToDevice, stream));
+        LOG_ERROR("Input or output size exceeds " << nvcv::cuda::TypeTraits<int32_t>::max << ". Tensor is too large.");
+        return ErrorCode::INVALID_PARAMETER;
     }
 
+    auto src = CreateTensorWrapNHWC<const T, int32_t>(inData);
+    auto dst = CreateTensorWrapNHWC<T, int32_t>(outData);
+
+    int2 size = {width, height};
+
+    // copy input to output, all samples at once
+    copy_input<<<gridSize, blockSize, 0, stream>>>(src, dst, size, channel);
+    checkKernelErrors();
+
     // step1 init mask
 
     // set inpaint mask to KNOWN
     checkCudaErrors(cudaMemsetAsync(inpaint_mask_ptr, KNOWN, sizeof(unsigned char) * batch * erows * ecols * 1,
                                     stream)); // cvSet(mask,cvScalar(KNOWN,0,0,0));
     // copy !=0 value to mask
-    int2 size = {width, height};
 
     auto maskAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(mask);
     NVCV_ASSERT(maskAccess);
@@ -546,31 +556,21 @@ ErrorCode inpaint_helper(const nvcv::TensorDataStridedCuda &inData, const nvcv::
     set_value<unsigned char, unsigned char>(f, inpaint_mask, INSIDE, stream); // cvSet(f,cvScalar(INSIDE,0,0,0),mask);
     set_value<float, unsigned char>(t, band, 0, stream);                      // cvSet(t,cvScalar(0,0,0,0),band);
 
-    // step5 FMM
+    // step5 FMM, in one launch with the convergence tracked on device
 
-    int  iteration = 20;
-    dim3 block(BLOCK_S, BLOCK_S);
-    dim3 grid(divUp(f.rows, block.x), divUp(f.cols, block.y), f.batches);
-    int  flag = 1;
+    // a pass grows the band by at least one pixel, so it spans at most the extended image
+    int maxPasses = erows + ecols;
+    int numPixels = batch * erows * ecols;
 
-    if (outAccess->sampleStride() * batch <= nvcv::cuda::TypeTraits<int32_t>::max)
-    {
-        auto dst = CreateTensorWrapNHWC<T, int32_t>(outData);
-        while (flag)
-        {
-            for (int i = 0; i < iteration; i++)
-            {
-                TeleaInpaintFMM<<<grid, block, 0, stream>>>(inpaint_mask, t, dst, range, band, channel);
-                /* icvTeleaInpaintFMM<uchar>(mask,t,output_img,range,Heap); */
-            }
-            flag = finish_flag_reduce(band, block_reduce_buffer1, block_reduce_buffer2, stream);
-        }
-    }
-    else
-    {
-        LOG_ERROR("Output size exceeds " << nvcv::cuda::TypeTraits<int32_t>::max << ". Tensor is too large.");
-        return ErrorCode::INVALID_PARAMETER;
-    }
+    auto fmm   = TeleaInpaintFMM<decltype(dst)>;
+    dim3 block = BLOCK_S * BLOCK_S;
+    dim3 grid  = persistent_grid_size(fmm, block.x, numPixels);
+
+    checkCudaErrors(cudaMemsetAsync(flags, 0, sizeof(int) * INPAINT_FLAGS, stream));
+
+    void *args[] = {&inpaint_mask, &t, &dst, &range, &band, &channel, &flags, &maxPasses};
+    checkCudaErrors(cudaLaunchCooperativeKernel((const void *)fmm, grid, block, args, 0, stream));
+    /* icvTeleaInpaintFMM<uchar>(mask,t,output_img,range,Heap); */
 
     checkKernelErrors();
     return ErrorCode::SUCCESS;
@@ -594,7 +594,7 @@ Inpaint::Inpaint(DataShape max_input_shape, DataShape max_output_shape, int maxB
 
     int    erows      = (maxShape.h + 2);
     int    ecols      = (maxShape.w + 2);
-    size_t buffersize = sizeof(int) * (REDUCE_GRID_SIZE * maxBatchSize + 1)
+    size_t buffersize = sizeof(int) * INPAINT_FLAGS
                       + maxBatchSize * erows * ecols * 1 * (sizeof(float) + sizeof(unsigned char) * 3);
     err = cudaMalloc(&m_workspace, buffersize);
     if (err != cudaSuccess)
@@ -1,39 +0,0 @@
-/* Copyright (c) 2021-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
- *
- * SPDX-FileCopyrightText: NVIDIA CORPORATION & AFFILIATES
- * SPDX-License-Identifier: Apache-2.0
- *
- * Copyright (C) 2021-2022, Bytedance Inc. All rights reserved.
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *     http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
-*/
-
-#include "CvCudaUtils.cuh"
-#include "reduce_kernel_utils.cuh"
-
-using namespace nvcv::legacy::cuda_op;
-
-__global__ void deviceReducePoints(const int *g_in, int *g_out, const int N)
-{
-    int tid = threadIdx.x;
-    int sum = 0;
-    for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < N; i += blockDim.x * gridDim.x)
-    {
-        sum += g_in[i];
-    }
-    sum = blockReduceSum(sum);
-    if (tid == 0)
-    {
-        g_out[tid] = sum;
-    }
-}
@@ -46,12 +46,11 @@ __inline__ __device__ float VectorLength(float2 &v1)
     return v1.x * v1.x + v1.y * v1.y;
 }
 
-__inline__ __device__ float FastMarching_solve(int i1, int j1, int i2, int j2, Ptr2dNHWC<unsigned char> f,
-                                               Ptr2dNHWC<float> t)
+__inline__ __device__ float FastMarching_solve(int batch_idx, int i1, int j1, int i2, int j2,
+                                               Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t)
 {
     // printf("FastMarching_solve: %d %d %d %d\n", i1, j1, i2, j2);
-    const int batch_idx = get_batch_idx();
-    double    sol, a11, a22, m12;
+    double sol, a11, a22, m12;
     a11 = *t.ptr(batch_idx, i1, j1);
     a22 = *t.ptr(batch_idx, i2, j2);
     m12 = ((a11) > (a22) ? (a22) : (a11));
@@ -79,6 +78,21 @@ inline int init_dilate_kernel(unsigned char *cross_kernel, cudaStream_t stream)
     return 0;
 }
 
-__global__ void deviceReducePoints(const int *g_in, int *g_out, const int N);
+// The fast marching runs in a single cooperative launch for the whole batch: each pass over the narrow band raises
+// the flag of its pass when it grows the band, and all threads stop after the first pass that leaves it down.  Flags
+// are triple buffered so a flag can be cleared for the next pass while the previous one is still being read.
+#define INPAINT_FLAGS 3
+
+template<typename Kernel>
+inline dim3 persistent_grid_size(Kernel kernel, int blockSize, int numPixels)
+{
+    int device, numSMs, blocksPerSM;
+    checkCudaErrors(cudaGetDevice(&device));
+    checkCudaErrors(cudaDeviceGetAttribute(&numSMs, cudaDevAttrMultiProcessorCount, device));
+    checkCudaErrors(cudaOccupancyMaxActiveBlocksPerMultiprocessor(&blocksPerSM, kernel, blockSize, 0));
+
+    // all blocks must be resident for the grid-wide barrier between passes
+    return dim3(std::max(std::min(blocksPerSM * numSMs, divUp(numPixels, blockSize)), 1));
+}
 
 #endif // INPAINT_UTILS_CUH
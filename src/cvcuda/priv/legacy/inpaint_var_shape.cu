@@ -24,7 +24,8 @@
 #include "CvCudaUtils.cuh"
 #include "cub/cub.cuh"
 #include "inpaint_utils.cuh"
-#include "reduce_kernel_utils.cuh"
+
+#include <cooperative_groups.h>
 
 using namespace nvcv::legacy::helpers;
 
@@ -37,9 +38,8 @@ using namespace nvcv::cuda;
 #define INSIDE 2 //unknown
 #define CHANGE 3 //servise
 
-#define BLOCK            32
-#define BLOCK_S          16
-#define REDUCE_GRID_SIZE 64
+#define BLOCK   32
+#define BLOCK_S 16
 
 template<typename T>
 __global__ void copy_mask_data(ImageBatchVarShapeWrapNHWC<T> src, Ptr2dNHWC<T> dst, int row_offset, int col_offset,
@@ -62,11 +62,25 @@ __global__ void copy_mask_data(ImageBatchVarShapeWrapNHWC<T> src, Ptr2dNHWC<T> d
 }
 
 template<typename T>
-__device__ void inpaint(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, ImageBatchVarShapeWrapNHWC<T> out, int i, int j,
-                        int range)
+__global__ void copy_input(ImageBatchVarShapeWrapNHWC<const T> src, ImageBatchVarShapeWrapNHWC<T> dst)
 {
+    int       x         = blockIdx.x * blockDim.x + threadIdx.x;
+    int       y         = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
-    int       rows = out.height(batch_idx) + 2, cols = out.width(batch_idx) + 2;
+    if (x >= src.width(batch_idx) || y >= src.height(batch_idx))
+        return;
+
+    for (int c = 0; c < src.numChannels(); ++c)
+    {
+        *dst.ptr(batch_idx, y, x, c) = *src.ptr(batch_idx, y, x, c);
+    }
+}
+
+template<typename T>
+__device__ void inpaint(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, ImageBatchVarShapeWrapNHWC<T> out,
+                        int batch_idx, int i, int j, int range)
+{
+    int rows = out.height(batch_idx) + 2, cols = out.width(batch_idx) + 2;
 
     for (int color = 0; color < out.numChannels(); color++)
     {
@@ -207,18 +221,17 @@ __device__ void inpaint(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, ImageBat
     }
 }
 
+// One narrow band pixel of a fast marching pass, returns whether the band grew
 template<typename T>
-__global__ void TeleaInpaintFMM(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, ImageBatchVarShapeWrapNHWC<T> out,
-                                int range, Ptr2dNHWC<unsigned char> band)
+__device__ bool TeleaInpaintStep(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, ImageBatchVarShapeWrapNHWC<T> out,
+                                 int range, Ptr2dNHWC<unsigned char> band, int batch_idx, int ii, int jj)
 {
-    int       i = 0, j = 0;
-    float     dist;
-    const int ii        = blockIdx.x * blockDim.x + threadIdx.x; // row
-    const int jj        = blockIdx.y * blockDim.y + threadIdx.y; // col
-    const int batch_idx = get_batch_idx();
-    int       row = out.height(batch_idx) + 2, col = out.width(batch_idx) + 2;
+    int   i = 0, j = 0;
+    float dist;
+    bool  grown = false;
+    int   row = out.height(batch_idx) + 2, col = out.width(batch_idx) + 2;
     if (ii >= row || jj >= col)
-        return;
+        return false;
     // method1 all the thread do the computation toghther for iteration times until convergence
     if (*band.ptr(batch_idx, ii, jj) != 0)
     {
@@ -250,18 +263,60 @@ __global__ void TeleaInpaintFMM(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t,
 
             if (*f.ptr(batch_idx, i, j) == INSIDE)
             {
-                dist = min4(FastMarching_solve(i - 1, j, i, j - 1, f, t), FastMarching_solve(i + 1, j, i, j - 1, f, t),
-                            FastMarching_solve(i - 1, j, i, j + 1, f, t), FastMarching_solve(i + 1, j, i, j + 1, f, t));
+                dist = min4(FastMarching_solve(batch_idx, i - 1, j, i, j - 1, f, t),
+                            FastMarching_solve(batch_idx, i + 1, j, i, j - 1, f, t),
+                            FastMarching_solve(batch_idx, i - 1, j, i, j + 1, f, t),
+                            FastMarching_solve(batch_idx, i + 1, j, i, j + 1, f, t));
                 *t.ptr(batch_idx, i, j) = dist;
 
-                inpaint(f, t, out, i, j, range);
+                inpaint(f, t, out, batch_idx, i, j, range);
 
                 *f.ptr(batch_idx, i, j)    = BAND;
                 *band.ptr(batch_idx, i, j) = 1; // non-zero
+                grown                      = true;
             }
         }
         *band.ptr(batch_idx, ii, jj) = 0;
     }
+    return grown;
+}
+
+// Persistent fast marching over all images, passes are separated by a grid-wide barrier and the loop ends on device
+// once a pass does not grow the band, maxPasses bounds it by the band depth of the largest image
+template<typename T>
+__global__ void TeleaInpaintFMM(Ptr2dNHWC<unsigned char> f, Ptr2dNHWC<float> t, ImageBatchVarShapeWrapNHWC<T> out,
+                                int range, Ptr2dNHWC<unsigned char> band, int *flags, int maxPasses)
+{
+    namespace cg = cooperative_groups;
+
+    cg::grid_group grid      = cg::this_grid();
+    const int      numPixels = f.batches * f.rows * f.cols;
+
+    for (int pass = 0; pass < maxPasses; ++pass)
+    {
+        volatile int *flag = flags + pass % INPAINT_FLAGS;
+        if (grid.thread_rank() == 0)
+        {
+            flags[(pass + 1) % INPAINT_FLAGS] = 0;
+        }
+
+        for (int idx = grid.thread_rank(); idx < numPixels; idx += grid.size())
+        {
+            int batch_idx = idx / (f.rows * f.cols);
+            int ii        = (idx / f.cols) % f.rows;
+            int jj        = idx % f.cols;
+            if (TeleaInpaintStep(f, t, out, range, band, batch_idx, ii, jj))
+            {
+                *flag = 1;
+            }
+        }
+        grid.sync();
+
+        if (*flag == 0)
+        {
+            break;
+        }
+    }
 }
 
 template<typename Ptr2D, typename T, typename D, typename BrdRd>
@@ -409,53 +464,6 @@ void set_value(Ptr2dNHWC<T> src, Ptr2dNHWC<T2> mask, T value, nvcv::Size2D maxsi
     checkKernelErrors();
 }
 
-__global__ void deviceReduceImage(Ptr2dNHWC<unsigned char> src_ptr, int *out,
-                                  ImageBatchVarShapeWrapNHWC<unsigned char> size_helper)
-{
-    int batch_idx        = get_batch_idx();
-    int block_idx        = get_bid();
-    int grid_size        = get_grid_size();
-    int height           = size_helper.height(batch_idx) + 2;
-    int width            = src_ptr.cols;
-    int tid              = threadIdx.x;
-    int out_batch_offset = batch_idx * grid_size + block_idx; // xmin, ymin, xmax, ymax intervleaved
-    int sum              = 0;
-    //reduce multiple elements per thread
-    for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < height * width; i += blockDim.x * gridDim.x)
-    {
-        int x = i % width;
-        int y = i / width;
-        sum += *src_ptr.ptr(batch_idx, y, x);
-    }
-
-    sum = blockReduceSum(sum);
-    if (tid == 0)
-    {
-        out[out_batch_offset] = sum;
-    }
-}
-
-inline int finish_flag_reduce(Ptr2dNHWC<unsigned char> src_ptr, int *d_out, int *d_out2,
-                              ImageBatchVarShapeWrapNHWC<unsigned char> size_helper, cudaStream_t stream)
-{
-    int  block_size = 256; // maximum threads per block
-    int  g_size     = REDUCE_GRID_SIZE;
-    dim3 grid_size(g_size, 1, src_ptr.batches); // 32 resident blocks per sm
-
-    deviceReduceImage<<<grid_size, block_size, 0, stream>>>(src_ptr, d_out, size_helper);
-    checkKernelErrors();
-
-    int  block_size2 = g_size;
-    dim3 grid_size2(1, 1, 1);
-    int  points_set_num = g_size * src_ptr.batches;
-    deviceReducePoints<<<grid_size2, block_size2, 0, stream>>>(d_out, d_out2, points_set_num);
-    checkKernelErrors();
-    int rst = 0;
-    checkCudaErrors(cudaMemcpyAsync((void *)&rst, (void *)d_out2, sizeof(int), cudaMemcpyDeviceToHost, stream));
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    return rst;
-}
-
 template<typename T>
 void inpaint_helper(const nvcv::ImageBatchVarShapeDataStridedCuda &inData,
                     const nvcv::ImageBatchVarShapeDataStridedCuda &mask,
@@ -467,6 +475,7 @@ void inpaint_helper(const nvcv::ImageBatchVarShapeDataStridedCuda &inData,
     dim3         blockSize(BLOCK, BLOCK / 4, 1);
     dim3         gridSize(divUp(maxsize.w + 2, blockSize.x), divUp(maxsize.h + 2, blockSize.y), batch);
 
+    ImageBatchVarShapeWrapNHWC<const T>       src(inData, channel);
     ImageBatchVarShapeWrapNHWC<T>             dst(outData, channel);
     // data type for mask is 8UC1
     ImageBatchVarShapeWrapNHWC<unsigned char> org_mask(mask, 1);
@@ -475,11 +484,10 @@ void inpaint_helper(const nvcv::ImageBatchVarShapeDataStridedCuda &inData,
     int ecols = maxsize.w + 2;
     int erows = maxsize.h + 2;
 
-    int   *block_reduce_buffer1 = (int *)workspace;
-    int   *block_reduce_buffer2 = (int *)((char *)block_reduce_buffer1 + sizeof(int) * REDUCE_GRID_SIZE * maxBatchSize);
-    float *t_ptr                = (float *)((char *)block_reduce_buffer2 + sizeof(int) * 1);
-    unsigned char *f_ptr        = (unsigned char *)((char *)t_ptr + sizeof(float) * batch * erows * ecols * 1);
-    unsigned char *band_ptr     = (unsigned char *)((char *)f_ptr + sizeof(unsigned char) * batch * erows * ecols * 1);
+    int           *flags    = (int *)workspace;
+    float         *t_ptr    = (float *)((char *)flags + sizeof(int) * INPAINT_FLAGS);
+    unsigned char *f_ptr    = (unsigned char *)((char *)t_ptr + sizeof(float) * batch * erows * ecols * 1);
+    unsigned char *band_ptr = (unsigned char *)((char *)f_ptr + sizeof(unsigned char) * batch * erows * ecols * 1);
     unsigned char *inpaint_mask_ptr
         = (unsigned char *)((char *)band_ptr + sizeof(unsigned char) * batch * erows * ecols * 1);
 
@@ -488,8 +496,10 @@ void inpaint_helper(const nvcv::ImageBatchVarShapeDataStridedCuda &inData,
     Ptr2dNHWC<unsigned char> band(batch, erows, ecols, 1, (unsigned char *)band_ptr);
     Ptr2dNHWC<unsigned char> inpaint_mask(batch, erows, ecols, 1, (unsigned char *)inpaint_mask_ptr);
 
-    // copy input to output
-    // do this in the infer function
+    // copy input to output, all images in one launch
+    dim3 copyGrid(divUp(maxsize.w, blockSize.x), divUp(maxsize.h, blockSize.y), batch);
+    copy_input<T><<<copyGrid, blockSize, 0, stream>>>(src, dst);
+    checkKernelErrors();
 
     // step1 init mask
 
@@ -542,21 +552,16 @@ void inpaint_helper(const nvcv::ImageBatchVarShapeDataStridedCuda &inData,
 
     // step5 FMM
 
-    int  iteration = 20;
-    dim3 block(BLOCK_S, BLOCK_S);
-    dim3 grid(divUp(erows, block.x), divUp(ecols, block.y), f.batches);
-    int  flag = 1;
-
-    while (flag)
-    {
-        for (int i = 0; i < iteration; i++)
-        {
-            TeleaInpaintFMM<T><<<grid, block, 0, stream>>>(
-                inpaint_mask, t, dst, range, band); // icvTeleaInpaintFMM<uchar>(mask,t,output_img,range,Heap);
-        }
-        flag = finish_flag_reduce(band, block_reduce_buffer1, block_reduce_buffer2, org_mask, stream);
-    }
+    // all passes run in one cooperative launch, convergence is tracked on device so the host never waits
+    int  maxPasses = erows + ecols;
+    int  numPixels = batch * erows * ecols;
+    auto fmm       = TeleaInpaintFMM<T>;
+    dim3 block(BLOCK_S * BLOCK_S);
+    dim3 grid = persistent_grid_size(fmm, block.x, numPixels);
 
+    checkCudaErrors(cudaMemsetAsync(flags, 0, sizeof(int) * INPAINT_FLAGS, stream));
+    void *args[] = {&inpaint_mask, &t, &dst, &range, &band, &flags, &maxPasses};
+    checkCudaErrors(cudaLaunchCooperativeKernel((void *)fmm, grid, block, args, 0, stream));
     checkKernelErrors();
 }
 
@@ -579,7 +584,7 @@ InpaintVarShape::InpaintVarShape(DataShape max_input_shape, DataShape max_output
 
     int    erows      = (maxShape.h + 2);
     int    ecols      = (maxShape.w + 2);
-    size_t buffersize = sizeof(int) * (REDUCE_GRID_SIZE * maxBatchSize + 1)
+    size_t buffersize = sizeof(int) * INPAINT_FLAGS
                       + maxBatchSize * erows * ecols * 1 * (sizeof(float) + sizeof(unsigned char) * 3);
     err = cudaMalloc(&m_workspace, buffersize);
     if (err != cudaSuccess)
@@ -673,20 +678,6 @@ ErrorCode InpaintVarShape::infer(const nvcv::ImageBatchVarShape          &inBatc
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    //copy input to output
-    for (auto init = inBatch.begin(), outit = outBatch.begin(); init != inBatch.end(), outit != outBatch.end();
-         ++init, ++outit)
-    {
-        const Image             &inimg      = *init;
-        const Image             &outimg     = *outit;
-        auto                     inimgdata  = inimg.exportData<ImageDataStridedCuda>();
-        auto                     outimgdata = outimg.exportData<ImageDataStridedCuda>();
-        const ImagePlaneStrided &inplane    = inimgdata->plane(0);
-        const ImagePlaneStrided &outplane   = outimgdata->plane(0);
-        checkCudaErrors(cudaMemcpy2DAsync(outplane.basePtr, outplane.rowStride, inplane.basePtr, inplane.rowStride,
-                                          inplane.rowStride, inplane.height, cudaMemcpyDeviceToDevice, stream));
-    }
-
     typedef void (*inpaint_t)(
         const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &mask,
         const ImageBatchVarShapeDataStridedCuda &outData, void *workspace, unsigned char *kernel_ptr, int range,
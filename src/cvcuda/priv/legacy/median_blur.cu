@@ -23,9 +23,19 @@
 
 #include "CvCudaUtils.cuh"
 
+#include <limits>
+#include <type_traits>
+
 #define GENERAL_KERNEL_BLOCK 32
 #define SMALL_KERNEL_BLOCK   16
 
+#define HISTOGRAM_BLOCK        32  // one warp, each thread owns an output column
+#define HISTOGRAM_SPAN         32  // rows slid over by each thread
+#define HISTOGRAM_COARSE_BINS  16
+#define HISTOGRAM_FINE_BINS    256
+#define HISTOGRAM_MIN_AREA_8U  49  // 7x7
+#define HISTOGRAM_MIN_AREA_16U 121 // 11x11
+
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
@@ -325,6 +335,163 @@ __global__ void medianForSmallKernel(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, c
     }
 }
 
+
+/**
+ * Adds delta to the coarse and fine counters of the given 8-bit bin.
+ * The counters of the threads in a block are interleaved so that each thread accesses its own shared memory bank.
+ */
+__inline__ __device__ void updateHistogram(uint16_t *coarse, uint16_t *fine, int bin, int delta)
+{
+    coarse[(bin >> 4) * HISTOGRAM_BLOCK] += delta;
+    fine[bin * HISTOGRAM_BLOCK] += delta;
+}
+
+/**
+ * Finds the bin holding the element of given rank, first over the coarse counters then over the fine counters
+ * inside the selected coarse bin, and leaves in rank the rank of that element inside the bin.
+ */
+__inline__ __device__ int selectHistogram(const uint16_t *coarse, const uint16_t *fine, int &rank)
+{
+    int c = 0;
+    while (rank >= coarse[c * HISTOGRAM_BLOCK])
+    {
+        rank -= coarse[c * HISTOGRAM_BLOCK];
+        ++c;
+    }
+
+    int f = c * (HISTOGRAM_FINE_BINS / HISTOGRAM_COARSE_BINS);
+    while (rank >= fine[f * HISTOGRAM_BLOCK])
+    {
+        rank -= fine[f * HISTOGRAM_BLOCK];
+        ++f;
+    }
+    return f;
+}
+
+__inline__ __device__ void clearHistogram(uint16_t *coarse, uint16_t *fine)
+{
+    for (int i = 0; i < HISTOGRAM_COARSE_BINS; i++)
+    {
+        coarse[i * HISTOGRAM_BLOCK] = 0;
+    }
+    for (int i = 0; i < HISTOGRAM_FINE_BINS; i++)
+    {
+        fine[i * HISTOGRAM_BLOCK] = 0;
+    }
+}
+
+/**
+ * Perform median filter on the image using a sliding window histogram, for 8-bit and 16-bit pixels.
+ * Each thread processes one column over HISTOGRAM_SPAN rows: moving down one row removes the top row of the
+ * window and adds the new bottom row, so the cost per pixel grows with the kernel width only, and the median
+ * is found with a coarse-to-fine search over the bins.
+ * For 16-bit pixels the histogram tracks the high byte, and a second histogram tracks the low byte of the window
+ * pixels that fall into one high byte bin. It slides along with the first one and is only rebuilt from the whole
+ * window when the high byte of the median changes between rows, as in Perreault and Hebert's two-level histogram.
+ * @tparam T The type of the pixels stored, either uchar or ushort.
+ * @param src a Ptr2dNHWC <T> stored in global memory.
+ * @param dst a Ptr2dNHWC <T> stored in global memory.
+ * @param kWidth width of the kernel.
+ * @param kHeight height of the kernel, kWidth * kHeight must fit in 16 bits.
+ */
+template<typename T>
+__global__ void medianHistogram(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const int kWidth, const int kHeight)
+{
+    constexpr int shift = 8 * (sizeof(T) - 1);
+
+    int x        = blockIdx.x * blockDim.x + threadIdx.x;
+    int y0       = blockIdx.y * HISTOGRAM_SPAN;
+    int channel  = blockIdx.z % dst.ch;
+    int batchIdx = blockIdx.z / dst.ch;
+    int h = src.rows, w = src.cols;
+
+    if (x >= w)
+    {
+        return;
+    }
+
+    extern __shared__ char _arrays[];
+    uint16_t              *coarse    = reinterpret_cast<uint16_t *>(_arrays) + threadIdx.x;
+    uint16_t              *fine      = coarse + HISTOGRAM_COARSE_BINS * HISTOGRAM_BLOCK;
+    uint16_t              *coarseLow = fine + HISTOGRAM_FINE_BINS * HISTOGRAM_BLOCK;
+    uint16_t              *fineLow   = coarseLow + HISTOGRAM_COARSE_BINS * HISTOGRAM_BLOCK;
+
+    int rx = kWidth / 2, ry = kHeight / 2;
+    int yEnd = min(y0 + HISTOGRAM_SPAN, h);
+
+    // High byte bin tracked by the low byte histogram, none yet
+    int lowBin = -1;
+
+    // nvcv::BORDER_REPLICATE, as in fetch
+    auto at = [&](int gx, int gy) -> int
+    {
+        gx = min(max(gx, 0), w - 1);
+        gy = min(max(gy, 0), h - 1);
+        return *src.ptr(batchIdx, gy, gx, channel);
+    };
+
+    clearHistogram(coarse, fine);
+    for (int dy = -ry; dy <= ry; dy++)
+    {
+        for (int dx = -rx; dx <= rx; dx++)
+        {
+            updateHistogram(coarse, fine, at(x + dx, y0 + dy) >> shift, 1);
+        }
+    }
+
+    for (int y = y0; y < yEnd; y++)
+    {
+        if (y > y0)
+        {
+            for (int dx = -rx; dx <= rx; dx++)
+            {
+                int out = at(x + dx, y - ry - 1);
+                int in  = at(x + dx, y + ry);
+                updateHistogram(coarse, fine, out >> shift, -1);
+                updateHistogram(coarse, fine, in >> shift, 1);
+
+                if constexpr (shift > 0)
+                {
+                    if ((out >> shift) == lowBin)
+                    {
+                        updateHistogram(coarseLow, fineLow, out & 0xFF, -1);
+                    }
+                    if ((in >> shift) == lowBin)
+                    {
+                        updateHistogram(coarseLow, fineLow, in & 0xFF, 1);
+                    }
+                }
+            }
+        }
+
+        int rank  = (kWidth * kHeight) / 2;
+        int value = selectHistogram(coarse, fine, rank);
+
+        if constexpr (shift > 0)
+        {
+            if (value != lowBin)
+            {
+                clearHistogram(coarseLow, fineLow);
+                for (int dy = -ry; dy <= ry; dy++)
+                {
+                    for (int dx = -rx; dx <= rx; dx++)
+                    {
+                        int v = at(x + dx, y + dy);
+                        if ((v >> shift) == value)
+                        {
+                            updateHistogram(coarseLow, fineLow, v & 0xFF, 1);
+                        }
+                    }
+                }
+                lowBin = value;
+            }
+            value = (value << 8) | selectHistogram(coarseLow, fineLow, rank);
+        }
+
+        *dst.ptr(batchIdx, y, x, channel) = value;
+    }
+}
+
 #undef fetch_
 #undef fetchAs1d
 
@@ -339,6 +506,30 @@ void median(const nvcv::TensorDataAccessStridedImagePlanar &inData,
     checkCudaErrors(cudaStreamSynchronize(stream));
     checkCudaErrors(cudaGetLastError());
 #endif
+    if constexpr (std::is_same_v<T, uchar> || std::is_same_v<T, ushort>)
+    {
+        // Sorting cost grows with the kernel area, large kernels go to the sliding histogram instead
+        int area    = kWidth * kHeight;
+        int minArea = sizeof(T) == 1 ? HISTOGRAM_MIN_AREA_8U : HISTOGRAM_MIN_AREA_16U;
+        if (area >= minArea && area <= std::numeric_limits<uint16_t>::max())
+        {
+            // 16-bit pixels need a second histogram to resolve the low byte
+            size_t sharedMemSize
+                = sizeof(T) * (HISTOGRAM_COARSE_BINS + HISTOGRAM_FINE_BINS) * HISTOGRAM_BLOCK * sizeof(uint16_t);
+
+            dim3 block(HISTOGRAM_BLOCK);
+            dim3 grid(divUp(dst.cols, block.x), divUp(dst.rows, HISTOGRAM_SPAN), dst.ch * dst.batches);
+            medianHistogram<T><<<grid, block, sharedMemSize, stream>>>(src, dst, kWidth, kHeight);
+            checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+            checkCudaErrors(cudaStreamSynchronize(stream));
+            checkCudaErrors(cudaGetLastError());
+#endif
+            return;
+        }
+    }
+
     long unsigned int sharedMemSize = SMALL_KERNEL_BLOCK * SMALL_KERNEL_BLOCK * kWidth * kHeight * sizeof(T);
     if (sharedMemSize < 48 * 1024)
     {
@@ -428,3 +619,9 @@ ErrorCode MedianBlur::infer(const TensorDataStridedCuda &inData, const TensorDat
 
 #undef GENERAL_KERNEL_BLOCK
 #undef SMALL_KERNEL_BLOCK
+#undef HISTOGRAM_BLOCK
+#undef HISTOGRAM_SPAN
+#undef HISTOGRAM_COARSE_BINS
+#undef HISTOGRAM_FINE_BINS
+#undef HISTOGRAM_MIN_AREA_8U
+#undef HISTOGRAM_MIN_AREA_16U
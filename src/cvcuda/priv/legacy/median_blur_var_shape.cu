@@ -385,23 +385,6 @@ MedianBlurVarShape::MedianBlurVarShape(const int maxBatchSize)
     : CudaBaseOp()
     , m_maxBatchSize(maxBatchSize)
 {
-    if (m_maxBatchSize > 0)
-    {
-        // {Width, Height} per image in var shape
-        size_t totalNumElements = m_maxBatchSize * 2;
-
-        m_kernelSizes.resize(totalNumElements);
-        if (m_kernelSizes.size() != totalNumElements)
-        {
-            LOG_ERROR("Host memory allocation error!!!");
-        }
-    }
-}
-
-MedianBlurVarShape::~MedianBlurVarShape()
-{
-    m_kernelSizes.clear();
-    m_kernelSizes.shrink_to_fit();
 }
 
 ErrorCode MedianBlurVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
@@ -457,8 +440,9 @@ ErrorCode MedianBlurVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inD
     auto ksizeDataAccess = nvcv::TensorDataAccessStrided::Create(ksize);
     NVCV_ASSERT(ksizeDataAccess);
 
-    // Copy the data to host
-    checkCudaErrors(cudaMemcpy2DAsync(m_kernelSizes.data(), sizeof(int) * 2, ksizeDataAccess->sampleData(0),
+    // Copy the data to host, {Width, Height} per image in var shape
+    std::vector<int> kernelSizes(inData.numImages() * 2);
+    checkCudaErrors(cudaMemcpy2DAsync(kernelSizes.data(), sizeof(int) * 2, ksizeDataAccess->sampleData(0),
                                       ksizeDataAccess->sampleStride(), sizeof(int) * 2, inData.numImages(),
                                       cudaMemcpyDeviceToHost, stream));
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -469,21 +453,21 @@ ErrorCode MedianBlurVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inD
     {
         int wIndex = b * 2;
         int hIndex = b * 2 + 1;
-        if (!(m_kernelSizes[wIndex] > 0 && m_kernelSizes[wIndex] % 2 == 1 && m_kernelSizes[hIndex] > 0
-              && m_kernelSizes[hIndex] % 2 == 1))
+        if (!(kernelSizes[wIndex] > 0 && kernelSizes[wIndex] % 2 == 1 && kernelSizes[hIndex] > 0
+              && kernelSizes[hIndex] % 2 == 1))
         {
-            LOG_ERROR("Invalid ksize " << m_kernelSizes[wIndex] << " " << m_kernelSizes[hIndex]);
+            LOG_ERROR("Invalid ksize " << kernelSizes[wIndex] << " " << kernelSizes[hIndex]);
             return ErrorCode::INVALID_PARAMETER;
         }
 
-        if (m_kernelSizes[wIndex] > maxKWidth)
+        if (kernelSizes[wIndex] > maxKWidth)
         {
-            maxKWidth = m_kernelSizes[wIndex];
+            maxKWidth = kernelSizes[wIndex];
         }
 
-        if (m_kernelSizes[hIndex] > maxKHeight)
+        if (kernelSizes[hIndex] > maxKHeight)
         {
-            maxKHeight = m_kernelSizes[hIndex];
+            maxKHeight = kernelSizes[hIndex];
         }
     }
 
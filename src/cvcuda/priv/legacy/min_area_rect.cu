@@ -249,7 +249,6 @@ void minAreaRect(const TensorDataStridedCuda &inData, void *rotatedPointsDev,
     calculateRotateArea<<<grid2, block2, smem_size, stream>>>(inContourPointsData, rotatedPointsTensor,
                                                               rotateCoeffsData, pointsInContourData);
     checkKernelErrors();
-    cudaStreamSynchronize(stream);
 
     dim3 grid3(contourBatch);
 
@@ -261,16 +260,22 @@ void minAreaRect(const TensorDataStridedCuda &inData, void *rotatedPointsDev,
 MinAreaRect::MinAreaRect(DataShape max_input_shape, DataShape max_output_shape, int maxContourNum)
     : mMaxContourNum(maxContourNum)
 {
-    // This needs to be _MAX_ROTATE_DEGREES + 1 since we look at 0-90 degrees inclusive.
-    int rotatedPtsAllocSize = ((maxContourNum * (_MAX_ROTATE_DEGREES + 1) * _MIN_AREA_EACH_ANGLE_STRID) * sizeof(int));
     NVCV_CHECK_THROW(cudaMalloc(&mRotateCoeffsBufDev, _MAX_ROTATE_DEGREES * 2 * sizeof(float)));
-    NVCV_CHECK_THROW(cudaMalloc(&mRotatedPointsDev, rotatedPtsAllocSize));
+
+    // The rotation coefficients don't depend on the input, compute them once and only read them afterwards
+    cuda::Tensor2DWrap<float> rotateCoeffsData(mRotateCoeffsBufDev, static_cast<int>(2 * sizeof(float)));
+    calculateRotateCoefCUDA(rotateCoeffsData, _MAX_ROTATE_DEGREES, 0);
+    cudaError_t err = cudaStreamSynchronize(0);
+    if (err != cudaSuccess)
+    {
+        NVCV_CHECK_LOG(cudaFree(mRotateCoeffsBufDev));
+        NVCV_CHECK_THROW(err);
+    }
 }
 
 MinAreaRect::~MinAreaRect()
 {
     NVCV_CHECK_LOG(cudaFree(mRotateCoeffsBufDev));
-    NVCV_CHECK_LOG(cudaFree(mRotatedPointsDev));
 }
 
 ErrorCode MinAreaRect::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
@@ -304,7 +309,6 @@ ErrorCode MinAreaRect::infer(const TensorDataStridedCuda &inData, const TensorDa
     }
 
     cuda::Tensor2DWrap<float> rotateCoeffsData(mRotateCoeffsBufDev, static_cast<int>(2 * sizeof(float)));
-    calculateRotateCoefCUDA(rotateCoeffsData, _MAX_ROTATE_DEGREES, stream);
 
     typedef void (*minAreaRect_t)(const TensorDataStridedCuda &inData, void *rotatedPointsDev,
                                   const cuda::Tensor2DWrap<float> rotateCoeffsData,
@@ -319,7 +323,12 @@ ErrorCode MinAreaRect::infer(const TensorDataStridedCuda &inData, const TensorDa
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
-    funcs[input_datatype](inData, mRotatedPointsDev, rotateCoeffsData, numPointsInContour, outData, contourBatch,
+    // This needs to be _MAX_ROTATE_DEGREES + 1 since we look at 0-90 degrees inclusive.
+    size_t rotatedPtsSize = static_cast<size_t>(contourBatch) * (_MAX_ROTATE_DEGREES + 1) * _MIN_AREA_EACH_ANGLE_STRID
+                          * sizeof(int);
+    auto rotatedPoints = mRotatedPointsScratch.acquire(rotatedPtsSize, stream);
+
+    funcs[input_datatype](inData, rotatedPoints.data(), rotateCoeffsData, numPointsInContour, outData, contourBatch,
                           maxNumPointsInContour, stream);
 
     return ErrorCode::SUCCESS;
@@ -25,6 +25,12 @@
 #include "CvCudaUtils.cuh"
 
 #include <nvcv/Rect.h>
+#include <nvcv/util/CheckError.hpp>
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 using namespace nvcv;
 using namespace nvcv::legacy::cuda_op;
@@ -35,94 +41,163 @@ using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
-template<class Filter>
-__global__ void _precomputeCoeffs(int in_size, int in0, work_type scale, work_type filterscale, work_type support,
-                                  int out_size, int k_size, Filter filterp, int *bounds_out, work_type *kk_out,
-                                  bool normalize_coeff, bool use_share_mem)
-{
-    const int  xx       = blockIdx.x * blockDim.x + threadIdx.x;
-    const int  local_id = threadIdx.x;
-    const int  x_offset = blockIdx.x * blockDim.x;
-    work_type *kk       = kk_out + x_offset * k_size;
-    if (use_share_mem)
-    {
-        extern __shared__ __align__(sizeof(work_type)) unsigned char smem_raw[];
-        kk = reinterpret_cast<work_type *>(smem_raw);
-    }
+// Resampling plan ------------------------------------------------------------
 
-    if (xx < out_size)
+struct PillowResize::Plan
+{
+    ~Plan()
     {
-        int       x      = 0;
-        int       xmin   = 0;
-        int       xmax   = 0;
-        work_type center = 0;
-        work_type ww     = 0;
-        work_type ss     = 0;
-
-        const work_type half_pixel = 0.5;
-
-        center = in0 + (xx + half_pixel) * scale;
-        ww     = 0.0;
-        ss     = 1.0 / filterscale;
-        // Round the value.
-        xmin = static_cast<int>(center - support + half_pixel);
-        if (xmin < 0)
+        // The tables may still be read by work in flight, wait for it before freeing them
+        if (ready)
         {
-            xmin = 0;
+            NVCV_CHECK_LOG(cudaEventSynchronize(ready.get()));
         }
-        // Round the value.
-        xmax = static_cast<int>(center + support + half_pixel);
-        if (xmax > in_size)
+        for (auto &[stream, event] : uses)
         {
-            xmax = in_size;
+            NVCV_CHECK_LOG(cudaEventSynchronize(event.get()));
         }
-        xmax -= xmin;
-        work_type *k = &kk[local_id * k_size];
-        for (x = 0; x < xmax; ++x)
+        NVCV_CHECK_LOG(cudaFree(data));
+    }
+
+    // Makes the stream wait for the upload of the tables, a no-op once the upload is known to be complete
+    void waitReady(cudaStream_t stream) const
+    {
+        std::lock_guard lg(lock);
+        if (uploaded)
         {
-            work_type w = filterp.filter((x + xmin - center + half_pixel) * ss);
-            k[x]        = w;
-            ww += w;
+            return;
         }
-        for (x = 0; x < xmax; ++x)
+        cudaError_t err = cudaEventQuery(ready.get());
+        if (err == cudaSuccess)
         {
-            if (std::fabs(ww) > 1e-5)
-            {
-                k[x] /= ww;
-            }
+            uploaded = true;
+            return;
         }
-        // Remaining values should stay empty if they are used despite of xmax.
-        for (; x < k_size; ++x)
+        if (err != cudaErrorNotReady)
         {
-            k[x] = .0f;
+            NVCV_CHECK_THROW(err);
         }
-        if (normalize_coeff)
+        NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, ready.get()));
+    }
+
+    // Marks the end of the work submitted to the stream using the tables, one event per stream in flight
+    void recordUse(cudaStream_t stream) const
+    {
+        std::lock_guard lg(lock);
+        for (auto &[useStream, event] : uses)
         {
-            for (int i = 0; i < k_size; i++)
+            if (useStream == stream || cudaEventQuery(event.get()) == cudaSuccess)
             {
-                work_type val = k[i];
-                if (val < 0)
-                {
-                    k[i] = static_cast<int>(-half_pixel + val * (1U << precision_bits));
-                }
-                else
-                {
-                    k[i] = static_cast<int>(half_pixel + val * (1U << precision_bits));
-                }
+                useStream = stream;
+                NVCV_CHECK_THROW(cudaEventRecord(event.get(), stream));
+                return;
             }
         }
+        uses.emplace_back(stream, nvcv::util::CudaEvent::CreateWithFlags(cudaEventDisableTiming));
+        NVCV_CHECK_THROW(cudaEventRecord(uses.back().second.get(), stream));
+    }
+
+    int        h_k_size = 0, v_k_size = 0;
+    work_type *h_kk = nullptr, *v_kk = nullptr;
+    int       *h_bounds = nullptr, *v_bounds = nullptr;
+
+    void                 *data = nullptr; // single device allocation holding all the tables
+    nvcv::util::CudaEvent ready;
 
-        bounds_out[xx * 2]     = xmin;
-        bounds_out[xx * 2 + 1] = xmax;
+    mutable std::mutex                                                   lock;
+    mutable bool                                                         uploaded = false;
+    mutable std::vector<std::pair<cudaStream_t, nvcv::util::CudaEvent>> uses;
+};
+
+bool PillowResize::PlanKey::operator==(const PlanKey &other) const
+{
+    return inWidth == other.inWidth && inHeight == other.inHeight && outWidth == other.outWidth
+        && outHeight == other.outHeight && roi.x == other.roi.x && roi.y == other.roi.y
+        && roi.width == other.roi.width && roi.height == other.roi.height && interpolation == other.interpolation;
+}
+
+size_t PillowResize::PlanKeyHash::operator()(const PlanKey &key) const
+{
+    size_t hash = 0;
+    for (int v : {key.inWidth, key.inHeight, key.outWidth, key.outHeight, key.roi.x, key.roi.y, key.roi.width,
+                  key.roi.height, static_cast<int>(key.interpolation)})
+    {
+        hash = hash * 1000003 ^ std::hash<int>{}(v);
     }
-    if (use_share_mem)
+    return hash;
+}
+
+// Computes the coefficients and bounds of all the output positions of one axis on the host
+template<class Filter>
+int ComputeAxisCoeffs(int in_size, int in0, int roi_size, int out_size, std::vector<work_type> &kk,
+                      std::vector<int> &bounds)
+{
+    Filter    filterp;
+    work_type scale       = static_cast<work_type>(roi_size) / out_size;
+    work_type filterscale = scale < 1.0 ? 1.0 : scale;
+
+    // Determine support size (length of resampling filter).
+    work_type support = filterp.support() * filterscale;
+
+    // Maximum number of coeffs.
+    int k_size = static_cast<int>(ceil(support)) * 2 + 1;
+
+    kk.resize(static_cast<size_t>(out_size) * k_size);
+    bounds.resize(static_cast<size_t>(out_size) * 2);
+
+    for (int xx = 0; xx < out_size; ++xx)
     {
-        __syncthreads();
-        for (int i = local_id; i < (out_size - x_offset) * k_size && i < blockDim.x * k_size; i += blockDim.x)
-        {
-            kk_out[x_offset * k_size + i] = kk[i];
-        }
+        ComputeCoeffs(xx, in_size, in0, scale, filterscale, support, k_size, filterp, false, &kk[xx * k_size],
+                      bounds[xx * 2], bounds[xx * 2 + 1]);
     }
+    return k_size;
+}
+
+template<class Filter>
+std::shared_ptr<const PillowResize::Plan> CreatePlan(const PillowResize::PlanKey &key, cudaStream_t stream)
+{
+    auto plan = std::make_shared<PillowResize::Plan>();
+
+    std::vector<work_type> h_kk, v_kk;
+    std::vector<int>       h_bounds, v_bounds;
+
+    plan->h_k_size = ComputeAxisCoeffs<Filter>(key.inWidth, key.roi.x, key.roi.width, key.outWidth, h_kk, h_bounds);
+    plan->v_k_size = ComputeAxisCoeffs<Filter>(key.inHeight, key.roi.y, key.roi.height, key.outHeight, v_kk, v_bounds);
+
+    // All tables hold 4-byte elements, they are packed in a single buffer uploaded with a single copy
+    static_assert(sizeof(work_type) == sizeof(int));
+    std::vector<int32_t> packed;
+    packed.reserve(h_kk.size() + v_kk.size() + h_bounds.size() + v_bounds.size());
+
+    auto append = [&packed](const auto &table)
+    {
+        size_t offset = packed.size();
+        packed.resize(offset + table.size());
+        std::memcpy(packed.data() + offset, table.data(), table.size() * sizeof(int32_t));
+        return offset;
+    };
+
+    size_t h_kk_offset     = append(h_kk);
+    size_t v_kk_offset     = append(v_kk);
+    size_t h_bounds_offset = append(h_bounds);
+    size_t v_bounds_offset = append(v_bounds);
+
+    plan->ready = nvcv::util::CudaEvent::CreateWithFlags(cudaEventDisableTiming);
+
+    NVCV_CHECK_THROW(cudaMalloc(&plan->data, packed.size() * sizeof(int32_t)));
+
+    int32_t *base  = static_cast<int32_t *>(plan->data);
+    plan->h_kk     = reinterpret_cast<work_type *>(base + h_kk_offset);
+    plan->v_kk     = reinterpret_cast<work_type *>(base + v_kk_offset);
+    plan->h_bounds = base + h_bounds_offset;
+    plan->v_bounds = base + v_bounds_offset;
+
+    // The copy from pageable memory returns once the source is staged, so the host vector may go out of scope
+    NVCV_CHECK_THROW(cudaMemcpyAsync(plan->data, packed.data(), packed.size() * sizeof(int32_t),
+                                     cudaMemcpyHostToDevice, stream));
+    NVCV_CHECK_THROW(cudaEventRecord(plan->ready.get(), stream));
+
+    return plan;
 }
 
 template<class T, class Filter>
@@ -230,44 +305,27 @@ __global__ void vertical_pass(const cuda_op::Ptr2dNHWC<T> src, cuda_op::Ptr2dNHW
 
 template<typename Filter, typename elem_type>
 void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
-                      const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace, bool normalize_coeff,
-                      work_type init_buffer, bool round_up, cudaStream_t stream)
+                      const TensorDataAccessStridedImagePlanar &outData, const PillowResize::Plan &plan,
+                      void *gpu_workspace, work_type init_buffer, bool round_up, cudaStream_t stream)
 {
     cuda_op::DataShape   input_shape = GetLegacyDataShape(inData.infoShape());
     Ptr2dNHWC<elem_type> src_ptr(inData);
     Ptr2dNHWC<elem_type> dst_ptr(outData);
     NVCVRectI            roi = {0, 0, src_ptr.cols, src_ptr.rows};
     Filter               filterp;
-    work_type            h_scale = 0, v_scale = 0;
-    work_type            h_filterscale = 0, v_filterscale = 0;
-    h_filterscale = h_scale = static_cast<work_type>(roi.width) / dst_ptr.cols;
-    v_filterscale = v_scale = static_cast<work_type>(roi.height) / dst_ptr.rows;
 
     int out_width  = dst_ptr.cols;
     int out_height = dst_ptr.rows;
 
-    if (h_filterscale < 1.0)
-    {
-        h_filterscale = 1.0;
-    }
-    if (v_filterscale < 1.0)
-    {
-        v_filterscale = 1.0;
-    }
+    int h_k_size = plan.h_k_size;
+    int v_k_size = plan.v_k_size;
 
-    // Determine support size (length of resampling filter).
-    work_type h_support = filterp.support() * h_filterscale;
-    work_type v_support = filterp.support() * v_filterscale;
-
-    // Maximum number of coeffs.
-    int h_k_size = static_cast<int>(ceil(h_support)) * 2 + 1;
-    int v_k_size = static_cast<int>(ceil(v_support)) * 2 + 1;
-
-    work_type *h_kk     = (work_type *)((char *)gpu_workspace);
-    work_type *v_kk     = (work_type *)((char *)h_kk + dst_ptr.cols * h_k_size * sizeof(work_type));
-    int       *h_bounds = (int *)((char *)v_kk + dst_ptr.rows * v_k_size * sizeof(work_type));
-    int       *v_bounds = (int *)((char *)h_bounds + dst_ptr.cols * 2 * sizeof(int));
-    elem_type *d_h_data = (elem_type *)((char *)v_bounds + dst_ptr.rows * 2 * sizeof(int));
+    // The coefficient tables come from the plan, the workspace only holds the output of the horizontal pass
+    work_type *h_kk     = plan.h_kk;
+    work_type *v_kk     = plan.v_kk;
+    int       *h_bounds = plan.h_bounds;
+    int       *v_bounds = plan.v_bounds;
+    elem_type *d_h_data = (elem_type *)gpu_workspace;
 
     Ptr2dNHWC<elem_type> h_ptr(input_shape.N, input_shape.H, out_width, input_shape.C, (elem_type *)d_h_data);
 
@@ -275,52 +333,14 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
     dim3 gridSizeH(divUp(out_width, blockSize.x), divUp(input_shape.H, blockSize.y), input_shape.N);
     dim3 gridSizeV(divUp(out_width, blockSize.x), divUp(out_height, blockSize.y), input_shape.N);
 
-    dim3 coef_block(BLOCK * 2, 1, 1);
-    dim3 h_coef_grid(divUp(dst_ptr.cols, coef_block.x), 1, 1);
-    dim3 v_coef_grid(divUp(dst_ptr.rows, coef_block.x), 1, 1);
-
-    size_t h_sm_size = coef_block.x * (h_k_size * sizeof(work_type));
-    size_t v_sm_size = coef_block.x * (v_k_size * sizeof(work_type));
-
-    size_t hv_sm_size1     = h_k_size * sizeof(work_type) * blockSize.x;
-    size_t hv_sm_size2     = v_k_size * sizeof(work_type) * blockSize.y;
-    bool   h_use_share_mem = h_sm_size <= SHARE_MEM_LIMIT;
-    if (!h_use_share_mem)
-    {
-        h_sm_size = 0;
-    }
-    bool v_use_share_mem = v_sm_size <= SHARE_MEM_LIMIT;
-    if (!v_use_share_mem)
-    {
-        v_sm_size = 0;
-    }
-    bool hv_use_share_mem = (hv_sm_size1 <= SHARE_MEM_LIMIT) && (hv_sm_size2 <= SHARE_MEM_LIMIT);
+    size_t hv_sm_size1      = h_k_size * sizeof(work_type) * blockSize.x;
+    size_t hv_sm_size2      = v_k_size * sizeof(work_type) * blockSize.y;
+    bool   hv_use_share_mem = (hv_sm_size1 <= SHARE_MEM_LIMIT) && (hv_sm_size2 <= SHARE_MEM_LIMIT);
     if (!hv_use_share_mem)
     {
         hv_sm_size1 = 0;
         hv_sm_size2 = 0;
     }
-    // compute horizental coef
-    _precomputeCoeffs<Filter><<<h_coef_grid, coef_block, h_sm_size, stream>>>(
-        src_ptr.cols, roi.x, h_scale, h_filterscale, h_support, dst_ptr.cols, h_k_size, filterp, h_bounds, h_kk,
-        normalize_coeff, h_use_share_mem);
-
-    checkKernelErrors();
-#ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
-#endif
-
-    // compute vertical coef
-    _precomputeCoeffs<Filter><<<v_coef_grid, coef_block, v_sm_size, stream>>>(
-        src_ptr.rows, roi.y, v_scale, v_filterscale, v_support, dst_ptr.rows, v_k_size, filterp, v_bounds, v_kk,
-        normalize_coeff, v_use_share_mem);
-
-    checkKernelErrors();
-#ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
-#endif
 
     horizontal_pass<elem_type, Filter>
         <<<gridSizeH, blockSize, hv_sm_size1, stream>>>(src_ptr, h_ptr, roi, filterp, h_k_size, v_k_size, h_bounds,
@@ -339,29 +359,29 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
 
 template<typename Filter>
 void pillow_resize_filter(const TensorDataAccessStridedImagePlanar &inData,
-                          const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace,
-                          NVCVInterpolationType interpolation, cudaStream_t stream)
+                          const TensorDataAccessStridedImagePlanar &outData, const PillowResize::Plan &plan,
+                          void *gpu_workspace, cudaStream_t stream)
 {
     cuda_op::DataType data_type = GetLegacyDataType(inData.dtype());
     switch (data_type)
     {
     case kCV_8U:
-        pillow_resize_v2<Filter, unsigned char>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, unsigned char>(inData, outData, plan, gpu_workspace, 0., false, stream);
         break;
     case kCV_8S:
-        pillow_resize_v2<Filter, signed char>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, signed char>(inData, outData, plan, gpu_workspace, 0., true, stream);
         break;
     case kCV_16U:
-        pillow_resize_v2<Filter, std::uint16_t>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, std::uint16_t>(inData, outData, plan, gpu_workspace, 0., false, stream);
         break;
     case kCV_16S:
-        pillow_resize_v2<Filter, std::int16_t>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, std::int16_t>(inData, outData, plan, gpu_workspace, 0., true, stream);
         break;
     case kCV_32S:
-        pillow_resize_v2<Filter, int>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, int>(inData, outData, plan, gpu_workspace, 0., true, stream);
         break;
     case kCV_32F:
-        pillow_resize_v2<Filter, float>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, float>(inData, outData, plan, gpu_workspace, 0., false, stream);
         break;
     default:
         break;
@@ -371,16 +391,9 @@ void pillow_resize_filter(const TensorDataAccessStridedImagePlanar &inData,
 WorkspaceRequirements PillowResize::getWorkspaceRequirements(DataShape max_input_shape, DataShape max_output_shape,
                                                              DataType max_data_type)
 {
-    int    max_support = 1; //3
-    size_t size
-        = std::ceil(
-              max_output_shape.H
-                  * (((1.0 * max_input_shape.H / max_output_shape.H + 1) * max_support * 2 + 1) * sizeof(work_type)
-                     + 2 * sizeof(int))
-              + max_output_shape.W
-                    * (((1.0 * max_input_shape.W / max_output_shape.W + 1) * max_support * 2 + 1) * sizeof(work_type)
-                       + 2 * sizeof(int)))
-        + max_input_shape.N * max_input_shape.C * max_input_shape.H * max_output_shape.W * DataSize(max_data_type);
+    // The coefficient tables live in the cached plans, the workspace only holds the output of the horizontal pass
+    size_t size = static_cast<size_t>(max_input_shape.N) * max_input_shape.C * max_input_shape.H * max_output_shape.W
+                * DataSize(max_data_type);
     WorkspaceRequirements req{};
     req.cudaMem = {size, 256};
     return req;
@@ -414,8 +427,9 @@ ErrorCode PillowResize::infer(const TensorDataStridedCuda &inData, const TensorD
     auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
     NVCV_ASSERT(outAccess);
 
-    cuda_op::DataType  data_type   = GetLegacyDataType(inData.dtype());
-    cuda_op::DataShape input_shape = GetLegacyDataShape(inAccess->infoShape());
+    cuda_op::DataType  data_type    = GetLegacyDataType(inData.dtype());
+    cuda_op::DataShape input_shape  = GetLegacyDataShape(inAccess->infoShape());
+    cuda_op::DataShape output_shape = GetLegacyDataShape(outAccess->infoShape());
 
     int channels = input_shape.C;
 
@@ -432,29 +446,42 @@ ErrorCode PillowResize::infer(const TensorDataStridedCuda &inData, const TensorD
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
+    // Steady-state calls with the same geometry find their coefficient tables in the plan cache
+    PlanKey key{};
+    key.inWidth       = input_shape.W;
+    key.inHeight      = input_shape.H;
+    key.outWidth      = output_shape.W;
+    key.outHeight     = output_shape.H;
+    key.roi           = {0, 0, input_shape.W, input_shape.H};
+    key.interpolation = interpolation;
+
+    std::shared_ptr<const Plan> plan;
+
     switch (interpolation)
     {
-    case NVCV_INTERP_LINEAR:
-        pillow_resize_filter<BilinearFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
-        break;
-    case NVCV_INTERP_CUBIC:
-        pillow_resize_filter<BicubicFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
-        break;
-    case NVCV_INTERP_LANCZOS:
-        pillow_resize_filter<LanczosFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
-        break;
-    case NVCV_INTERP_BOX:
-        pillow_resize_filter<BoxFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
-        break;
-    case NVCV_INTERP_HAMMING:
-        pillow_resize_filter<HammingFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
-        break;
+#define NVCV_CASE_PILLOW_RESIZE(INTERP, FILTER)                                                              \
+    case INTERP:                                                                                             \
+        plan = m_plans.getOrCreate(key, [&key, stream] { return CreatePlan<FILTER>(key, stream); });        \
+        plan->waitReady(stream);                                                                             \
+        pillow_resize_filter<FILTER>(*inAccess, *outAccess, *plan, gpu_workspace, stream);                  \
+        break
+
+        NVCV_CASE_PILLOW_RESIZE(NVCV_INTERP_LINEAR, BilinearFilter);
+        NVCV_CASE_PILLOW_RESIZE(NVCV_INTERP_CUBIC, BicubicFilter);
+        NVCV_CASE_PILLOW_RESIZE(NVCV_INTERP_LANCZOS, LanczosFilter);
+        NVCV_CASE_PILLOW_RESIZE(NVCV_INTERP_BOX, BoxFilter);
+        NVCV_CASE_PILLOW_RESIZE(NVCV_INTERP_HAMMING, HammingFilter);
+
+#undef NVCV_CASE_PILLOW_RESIZE
+
     default:
         LOG_ERROR("Unsupported interpolation method " << interpolation);
         return ErrorCode::INVALID_PARAMETER;
         break;
     }
 
+    plan->recordUse(stream);
+
     if (ws.cudaMem.ready != nullptr)
         checkCudaErrors(cudaEventRecord(ws.cudaMem.ready, stream));
 
@@ -196,4 +196,66 @@ private:
     work_type _support;
 };
 
+// Computes the coefficients of the output position xx of one axis, the same code runs on the device to build
+// the tables per call and on the host to build the cached resampling plans (and to verify them in tests).
+// k receives k_size coefficients, the first xmax of which apply to the inputs starting at xmin.
+template<class Filter>
+__host__ __device__ inline void ComputeCoeffs(int xx, int in_size, int in0, work_type scale, work_type filterscale,
+                                              work_type support, int k_size, Filter &filterp, bool normalize_coeff,
+                                              work_type *k, int &xmin, int &xmax)
+{
+    const work_type half_pixel = 0.5;
+
+    work_type center = in0 + (xx + half_pixel) * scale;
+    work_type ww     = 0.0;
+    work_type ss     = 1.0 / filterscale;
+    // Round the value.
+    xmin = static_cast<int>(center - support + half_pixel);
+    if (xmin < 0)
+    {
+        xmin = 0;
+    }
+    // Round the value.
+    xmax = static_cast<int>(center + support + half_pixel);
+    if (xmax > in_size)
+    {
+        xmax = in_size;
+    }
+    xmax -= xmin;
+    int x = 0;
+    for (x = 0; x < xmax; ++x)
+    {
+        work_type w = filterp.filter((x + xmin - center + half_pixel) * ss);
+        k[x]        = w;
+        ww += w;
+    }
+    for (x = 0; x < xmax; ++x)
+    {
+        if (std::fabs(ww) > 1e-5)
+        {
+            k[x] /= ww;
+        }
+    }
+    // Remaining values should stay empty if they are used despite of xmax.
+    for (; x < k_size; ++x)
+    {
+        k[x] = .0f;
+    }
+    if (normalize_coeff)
+    {
+        for (int i = 0; i < k_size; i++)
+        {
+            work_type val = k[i];
+            if (val < 0)
+            {
+                k[i] = static_cast<int>(-half_pixel + val * (1U << precision_bits));
+            }
+            else
+            {
+                k[i] = static_cast<int>(half_pixel + val * (1U << precision_bits));
+            }
+        }
+    }
+}
+
 } // namespace nvcv::legacy::cuda_op
@@ -34,8 +34,6 @@ using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
-static constexpr unsigned int precision_bits_var_shape = 32 - 8 - 2;
-
 namespace {
 
 template<class Filter>
@@ -69,64 +67,11 @@ __global__ void _precomputeCoeffsVarShape(int *in_size_batch, int *in0_batch, wo
 
     if (xx < out_size)
     {
-        int             x          = 0;
-        int             xmin       = 0;
-        int             xmax       = 0;
-        work_type       center     = 0;
-        work_type       ww         = 0;
-        work_type       ss         = 0;
-        const work_type half_pixel = 0.5;
-
-        center = in0 + (xx + half_pixel) * scale;
-        ww     = 0.0;
-        ss     = 1.0 / filterscale;
-        // Round the value.
-        xmin = static_cast<int>(center - support + half_pixel);
-        if (xmin < 0)
-        {
-            xmin = 0;
-        }
-        // Round the value.
-        xmax = static_cast<int>(center + support + half_pixel);
-        if (xmax > in_size)
-        {
-            xmax = in_size;
-        }
-        xmax -= xmin;
-        work_type *k = &kk[local_id * k_size];
-        for (x = 0; x < xmax; ++x)
-        {
-            work_type w = filterp.filter((x + xmin - center + half_pixel) * ss);
-            k[x]        = w;
-            ww += w;
-        }
-        for (x = 0; x < xmax; ++x)
-        {
-            if (std::fabs(ww) > 1e-5)
-            {
-                k[x] /= ww;
-            }
-        }
-        // Remaining values should stay empty if they are used despite of xmax.
-        for (; x < k_size; ++x)
-        {
-            k[x] = .0f;
-        }
-        if (normalize_coeff)
-        {
-            for (int i = 0; i < k_size; i++)
-            {
-                work_type val = k[i];
-                if (val < 0)
-                {
-                    k[i] = static_cast<int>(-half_pixel + val * (1U << precision_bits_var_shape));
-                }
-                else
-                {
-                    k[i] = static_cast<int>(half_pixel + val * (1U << precision_bits_var_shape));
-                }
-            }
-        }
+        int xmin = 0;
+        int xmax = 0;
+        ComputeCoeffs(xx, in_size, in0, scale, filterscale, support, k_size, filterp, normalize_coeff,
+                      &kk[local_id * k_size], xmin, xmax);
+
         bounds_out[xx * 2]     = xmin;
         bounds_out[xx * 2 + 1] = xmax;
     }
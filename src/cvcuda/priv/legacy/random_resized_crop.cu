@@ -22,6 +22,7 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "random_resized_crop_util.cuh"
 
 #include <cvcuda/cuda_tools/Compat.hpp>
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
@@ -302,96 +303,41 @@ RandomResizedCrop::RandomResizedCrop(DataShape max_input_shape, DataShape max_ou
         LOG_ERROR("Invalid Parameter: scale and ratio should be of kind (min, max)");
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Parameter error!");
     }
-    if (maxBatchSize > 0)
-    {
-        size_t bufferSize = (sizeof(int) * 2 + sizeof(float) * 2) * maxBatchSize;
-        NVCV_CHECK_LOG(cudaMalloc(&m_gpuCropParams, bufferSize));
-        m_cpuCropParams = malloc(bufferSize);
-        if (!m_cpuCropParams)
-        {
-            LOG_ERROR("Memory allocation error of size: " << bufferSize);
-            throw std::runtime_error("Memory allocation error!");
-        }
-    }
     if (seed == 0)
     {
         std::random_device rand_dev;
-        generator_ = std::mt19937(rand_dev());
+        m_seed = rand_dev();
     }
     else
     {
-        generator_ = std::mt19937(seed);
+        m_seed = seed;
     }
 }
 
-RandomResizedCrop::~RandomResizedCrop()
-{
-    NVCV_CHECK_LOG(cudaFree(m_gpuCropParams));
-    free(m_cpuCropParams);
-}
-
 size_t RandomResizedCrop::calBufferSize(int batch_size)
 {
     // buffer size for batch oftop index, left index, scale y, scale x
     return (sizeof(int) * 2 + sizeof(float) * 2) * batch_size;
 }
 
-void RandomResizedCrop::getCropParams(int input_rows, int input_cols, int *top_indices, int *left_indices,
-                                      int *crop_rows, int *crop_cols)
+CropParams RandomResizedCrop::getCropParams(void *buffer, int batch_size)
 {
-    int                                    rows          = input_rows;
-    int                                    cols          = input_cols;
-    double                                 area          = rows * cols;
-    const double                           log_min_ratio = std::log(min_ratio_);
-    const double                           log_max_ratio = std::log(max_ratio_);
-    std::uniform_real_distribution<double> scale_dist(min_scale_, max_scale_);
-    std::uniform_real_distribution<double> ratio_dist(log_min_ratio, log_max_ratio);
-    bool                                   got_params = false;
-    for (int i = 0; i < 10; ++i)
-    {
-        if (got_params)
-            return;
-        int    target_area  = area * scale_dist(generator_);
-        double aspect_ratio = std::exp(ratio_dist(generator_));
-
-        *crop_cols = int(std::round(std::sqrt(target_area * aspect_ratio)));
-        *crop_rows = int(std::round(std::sqrt(target_area / aspect_ratio)));
+    CropParams params;
+    params.scaleY = (float *)(buffer);
+    params.scaleX = (float *)((char *)params.scaleY + sizeof(float) * batch_size);
+    params.tops   = (int *)((char *)params.scaleX + sizeof(float) * batch_size);
+    params.lefts  = (int *)((char *)params.tops + sizeof(int) * batch_size);
+    return params;
+}
 
-        if (*crop_cols > 0 && *crop_cols <= cols && *crop_rows > 0 && *crop_rows <= rows)
-        {
-            std::uniform_int_distribution<int> row_uni(0, rows - *crop_rows);
-            std::uniform_int_distribution<int> col_uni(0, cols - *crop_cols);
-            *top_indices  = row_uni(generator_);
-            *left_indices = col_uni(generator_);
-            got_params    = true;
-        }
-    }
-    // Fallback to central crop
-    if (!got_params)
-    {
-        double in_ratio = double(cols) / double(rows);
-        if (in_ratio < min_ratio_)
-        {
-            *crop_cols = cols;
-            *crop_rows = int(std::round(*crop_cols / min_ratio_));
-        }
-        else if (in_ratio > max_ratio_)
-        {
-            *crop_rows = rows;
-            *crop_cols = int(std::round(*crop_rows * max_ratio_));
-        }
-        else // whole image
-        {
-            *crop_cols = cols;
-            *crop_rows = rows;
-        }
-        *top_indices  = (rows - *crop_rows) / 2;
-        *left_indices = (cols - *crop_cols) / 2;
-    }
+CropDistribution RandomResizedCrop::nextCropDistribution()
+{
+    return CropDistribution{min_scale_, max_scale_, min_ratio_, max_ratio_, m_seed, m_epoch.fetch_add(1)};
 }
 
 ErrorCode RandomResizedCrop::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                                   const NVCVInterpolationType interpolation, cudaStream_t stream)
+                                   const NVCVInterpolationType interpolation, OptionalTensorConstRef inCrops,
+                                   OptionalTensorConstRef outCrops, cudaStream_t stream)
 {
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData.layout());
     DataFormat output_format = helpers::GetLegacyDataFormat(outData.layout());
@@ -454,29 +400,34 @@ ErrorCode RandomResizedCrop::infer(const TensorDataStridedCuda &inData, const Te
     int in_cols = inAccess->numCols();
     int in_rows = inAccess->numRows();
 
-    float *scale_y = (float *)(m_cpuCropParams);
-    float *scale_x = (float *)((char *)scale_y + sizeof(float) * batch);
-    int   *tops    = (int *)((char *)scale_x + sizeof(float) * batch);
-    int   *lefts   = (int *)((char *)tops + sizeof(int) * batch);
-
-    for (int i = 0; i < batch; ++i)
+    if (m_maxBatchSize <= 0 || batch > m_maxBatchSize)
     {
-        int top, left, crop_rows, crop_cols;
-        getCropParams(in_rows, in_cols, &top, &left, &crop_rows, &crop_cols);
-        scale_x[i] = ((float)crop_cols) / out_cols;
-        scale_y[i] = ((float)crop_rows) / out_rows;
-        tops[i]    = top;
-        lefts[i]   = left;
+        LOG_ERROR("Invalid maximum batch size " << m_maxBatchSize);
+        return ErrorCode::INVALID_PARAMETER;
     }
 
-    float *scale_y_gpu = (float *)(m_gpuCropParams);
-    float *scale_x_gpu = (float *)((char *)scale_y_gpu + sizeof(float) * batch);
-    int   *tops_gpu    = (int *)((char *)scale_x_gpu + sizeof(float) * batch);
-    int   *lefts_gpu   = (int *)((char *)tops_gpu + sizeof(int) * batch);
+    cuda::Tensor1DWrap<const int4> inCropsWrap;
+    cuda::Tensor1DWrap<int4>       outCropsWrap;
+
+    ErrorCode err = WrapCrops(inCrops, batch, "Input crops", inCropsWrap);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    err = WrapCrops(outCrops, batch, "Output crops", outCropsWrap);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
 
-    size_t buffer_size = calBufferSize(batch);
-    checkCudaErrors(
-        cudaMemcpyAsync((void *)m_gpuCropParams, (void *)m_cpuCropParams, buffer_size, cudaMemcpyHostToDevice, stream));
+    // Crops are sampled on the device, so nothing is computed on the host or uploaded per call. The parameters are
+    // leased per call, calls on other streams sharing this operator get a different buffer
+    auto            cropParams = m_scratch.acquire(calBufferSize(batch), stream);
+    CropParams      params     = getCropParams(cropParams.data(), batch);
+    TensorCropSizes sizes{int2{in_cols, in_rows}, int2{out_cols, out_rows}};
+    computeCropParams<<<divUp(batch, 128), 128, 0, stream>>>(sizes, nextCropDistribution(), inCropsWrap, outCropsWrap,
+                                                             params, batch);
+    checkKernelErrors();
 
     typedef ErrorCode (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                                 const NVCVInterpolationType interpolation, cudaStream_t stream, const int *top,
@@ -492,7 +443,7 @@ ErrorCode RandomResizedCrop::infer(const TensorDataStridedCuda &inData, const Te
     };
 
     const func_t func = funcs[in_data_type][channels - 1];
-    return func(inData, outData, interpolation, stream, tops_gpu, lefts_gpu, scale_x_gpu, scale_y_gpu);
+    return func(inData, outData, interpolation, stream, params.tops, params.lefts, params.scaleX, params.scaleY);
 }
 
 } // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RANDOM_RESIZED_CROP_UTIL_CUH
+#define RANDOM_RESIZED_CROP_UTIL_CUH
+
+#include "CvCudaLegacy.h"
+#include "CvCudaUtils.cuh"
+
+#include <cvcuda/cuda_tools/Philox.hpp> // for Philox, etc.
+
+namespace nvcv::legacy::cuda_op {
+
+// Draws the crop (x, y, width, height) of one sample of size rows x cols, trying 10 random areas and aspect ratios
+// before falling back to a central crop
+inline __device__ int4 SampleCrop(const CropDistribution &dist, int sample, int rows, int cols)
+{
+    double       area        = rows * cols;
+    const double logMinRatio = log(dist.minRatio);
+    const double logMaxRatio = log(dist.maxRatio);
+
+    cuda::Philox rng(dist.seed, sample, 0, dist.epoch);
+    for (int i = 0; i < 10; ++i)
+    {
+        int    targetArea  = area * (dist.minScale + (dist.maxScale - dist.minScale) * rng.uniformDouble());
+        double aspectRatio = exp(logMinRatio + (logMaxRatio - logMinRatio) * rng.uniformDouble());
+
+        int cropCols = int(round(sqrt(targetArea * aspectRatio)));
+        int cropRows = int(round(sqrt(targetArea / aspectRatio)));
+
+        if (cropCols > 0 && cropCols <= cols && cropRows > 0 && cropRows <= rows)
+        {
+            int top  = rng.uniformInt(0, rows - cropRows);
+            int left = rng.uniformInt(0, cols - cropCols);
+            return int4{left, top, cropCols, cropRows};
+        }
+    }
+
+    // Fallback to central crop
+    int    cropCols = cols, cropRows = rows;
+    double inRatio  = double(cols) / double(rows);
+    if (inRatio < dist.minRatio)
+    {
+        cropRows = int(round(cropCols / dist.minRatio));
+    }
+    else if (inRatio > dist.maxRatio)
+    {
+        cropCols = int(round(cropRows * dist.maxRatio));
+    }
+    return int4{(cols - cropCols) / 2, (rows - cropRows) / 2, cropCols, cropRows};
+}
+
+// Clips a user-supplied crop to the sample image, keeping at least one pixel
+inline __device__ int4 ClipCrop(int4 crop, int rows, int cols)
+{
+    int x0 = cuda::max(0, cuda::min(crop.x, cols - 1));
+    int y0 = cuda::max(0, cuda::min(crop.y, rows - 1));
+    int x1 = cuda::max(x0 + 1, cuda::min(crop.x + crop.z, cols));
+    int y1 = cuda::max(y0 + 1, cuda::min(crop.y + crop.w, rows));
+    return int4{x0, y0, x1 - x0, y1 - y0};
+}
+
+// Input and output sizes are the same for all samples of a tensor
+struct TensorCropSizes
+{
+    int2 in, out;
+
+    __device__ int2 inSize(int) const
+    {
+        return in;
+    }
+
+    __device__ int2 outSize(int) const
+    {
+        return out;
+    }
+};
+
+// Input and output sizes of each sample of a varshape batch
+struct VarShapeCropSizes
+{
+    cuda::ImageBatchVarShapeWrap<const uint8_t> in, out;
+
+    __device__ int2 inSize(int sample) const
+    {
+        return int2{in.width(sample), in.height(sample)};
+    }
+
+    __device__ int2 outSize(int sample) const
+    {
+        return int2{out.width(sample), out.height(sample)};
+    }
+};
+
+// Computes the crop of each sample, either sampled or taken from inCrops, and the resize parameters from it.  The
+// sizes functor gives the input and output sizes (width, height) of a sample.
+template<class SizeGetter>
+__global__ void computeCropParams(SizeGetter sizes, CropDistribution dist, cuda::Tensor1DWrap<const int4> inCrops,
+                                  cuda::Tensor1DWrap<int4> outCrops, CropParams params, int numSamples)
+{
+    int sample = blockIdx.x * blockDim.x + threadIdx.x;
+    if (sample >= numSamples)
+    {
+        return;
+    }
+
+    int2 inSize  = sizes.inSize(sample);
+    int2 outSize = sizes.outSize(sample);
+
+    int4 crop = inCrops.ptr(0) != nullptr ? ClipCrop(inCrops[sample], inSize.y, inSize.x)
+                                          : SampleCrop(dist, sample, inSize.y, inSize.x);
+    if (outCrops.ptr(0) != nullptr)
+    {
+        outCrops[sample] = crop;
+    }
+
+    params.scaleX[sample] = ((float)crop.z) / outSize.x;
+    params.scaleY[sample] = ((float)crop.w) / outSize.y;
+    params.tops[sample]   = crop.y;
+    params.lefts[sample]  = crop.x;
+}
+
+// Checks an optional crops tensor, [N] with 4S32 or [N, 4] with S32 data type, and wraps it when present
+template<typename T>
+inline ErrorCode WrapCrops(OptionalTensorConstRef crops, int numSamples, const char *name, cuda::Tensor1DWrap<T> &wrap)
+{
+    if (!crops)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    auto data = crops->get().exportData<TensorDataStridedCuda>();
+    if (!data)
+    {
+        LOG_ERROR(name << " must be cuda-accessible, pitch-linear tensor");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+    if (!((data->rank() == 1 && data->dtype() == TYPE_4S32)
+          || (data->rank() == 2 && data->dtype() == TYPE_S32 && data->shape(1) == 4
+              && data->stride(1) == static_cast<int64_t>(sizeof(int)))))
+    {
+        LOG_ERROR(name << " must be a rank-1 4S32 or a rank-2 S32 tensor with 4 packed elements per sample");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (data->shape(0) != numSamples)
+    {
+        LOG_ERROR(name << " must have " << numSamples << " samples, but it has " << data->shape(0));
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    wrap = cuda::Tensor1DWrap<T>(*data);
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // RANDOM_RESIZED_CROP_UTIL_CUH
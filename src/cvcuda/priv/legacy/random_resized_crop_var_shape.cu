@@ -22,6 +22,7 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "random_resized_crop_util.cuh"
 
 #include <cvcuda/cuda_tools/Compat.hpp>
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
@@ -283,7 +284,8 @@ RandomResizedCropVarShape::RandomResizedCropVarShape(DataShape max_input_shape,
 }
 
 ErrorCode RandomResizedCropVarShape::infer(const ImageBatchVarShape &in, const ImageBatchVarShape &out,
-                                           const NVCVInterpolationType interpolation, cudaStream_t stream)
+                                           const NVCVInterpolationType interpolation, OptionalTensorConstRef inCrops,
+                                           OptionalTensorConstRef outCrops, cudaStream_t stream)
 {
     auto inDataPtr = in.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
     if (inDataPtr == nullptr)
@@ -366,34 +368,28 @@ ErrorCode RandomResizedCropVarShape::infer(const ImageBatchVarShape &in, const I
 
     int batch = inData.numImages();
 
-    float *scale_y = (float *)(m_cpuCropParams);
-    float *scale_x = (float *)((char *)scale_y + sizeof(float) * batch);
-    int   *tops    = (int *)((char *)scale_x + sizeof(float) * batch);
-    int   *lefts   = (int *)((char *)tops + sizeof(int) * batch);
+    cuda::Tensor1DWrap<const int4> inCropsWrap;
+    cuda::Tensor1DWrap<int4>       outCropsWrap;
 
-    for (int i = 0; i < batch; ++i)
+    ErrorCode err = WrapCrops(inCrops, batch, "Input crops", inCropsWrap);
+    if (err != ErrorCode::SUCCESS)
     {
-        if (channels != in[i].format().numChannels())
-        {
-            LOG_ERROR("Invalid Input");
-            return ErrorCode::INVALID_DATA_SHAPE;
-        }
-        int top, left, crop_rows, crop_cols;
-        getCropParams(in[i].size().h, in[i].size().w, &top, &left, &crop_rows, &crop_cols);
-        scale_x[i] = ((float)crop_cols) / out[i].size().w;
-        scale_y[i] = ((float)crop_rows) / out[i].size().h;
-        tops[i]    = top;
-        lefts[i]   = left;
+        return err;
+    }
+    err = WrapCrops(outCrops, batch, "Output crops", outCropsWrap);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
     }
 
-    float *scale_y_gpu = (float *)(m_gpuCropParams);
-    float *scale_x_gpu = (float *)((char *)scale_y_gpu + sizeof(float) * batch);
-    int   *tops_gpu    = (int *)((char *)scale_x_gpu + sizeof(float) * batch);
-    int   *lefts_gpu   = (int *)((char *)tops_gpu + sizeof(int) * batch);
-
-    size_t buffer_size = calBufferSize(batch);
-    checkCudaErrors(
-        cudaMemcpyAsync((void *)m_gpuCropParams, (void *)m_cpuCropParams, buffer_size, cudaMemcpyHostToDevice, stream));
+    // Crops are sampled on the device from the image sizes in the batch, nothing is read back per image on the host
+    auto              cropParams = m_scratch.acquire(calBufferSize(batch), stream);
+    CropParams        params     = getCropParams(cropParams.data(), batch);
+    VarShapeCropSizes sizes{cuda::ImageBatchVarShapeWrap<const uint8_t>(inData),
+                            cuda::ImageBatchVarShapeWrap<const uint8_t>(outData)};
+    computeCropParams<<<divUp(batch, 128), 128, 0, stream>>>(sizes, nextCropDistribution(), inCropsWrap, outCropsWrap,
+                                                             params, batch);
+    checkKernelErrors();
 
     typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &in, const ImageBatchVarShapeDataStridedCuda &out,
                            const NVCVInterpolationType interpolation, cudaStream_t stream, float *scale_y,
@@ -409,7 +405,7 @@ ErrorCode RandomResizedCropVarShape::infer(const ImageBatchVarShape &in, const I
     };
 
     const func_t func = funcs[in_data_type][channels - 1];
-    func(inData, outData, interpolation, stream, scale_y_gpu, scale_x_gpu, tops_gpu, lefts_gpu);
+    func(inData, outData, interpolation, stream, params.scaleY, params.scaleX, params.tops, params.lefts);
     return SUCCESS;
 }
 
@@ -15,26 +15,33 @@
  * limitations under the License.
  */
 
+#include "../WarpClassifier.hpp"
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "warp_utils.cuh"
+
+#include <cstdlib>
 
 #define BLOCK 32
 
 namespace nvcv::legacy::cuda_op {
 
-template<class Transform, class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void warp(SrcWrapper src, DstWrapper dst, int2 dstSize, Transform transform)
+namespace cls = cvcuda::priv::warp;
+
+template<class Transform, class MatrixWrapper, class SrcWrapper, class DstWrapper,
+         typename T = typename DstWrapper::ValueType>
+__global__ void warp(SrcWrapper src, DstWrapper dst, int2 dstSize, MatrixWrapper matrices, bool invert)
 {
     int3      dstCoord = cuda::StaticCast<int>(blockDim * blockIdx + threadIdx);
     const int lid      = threadIdx.y * blockDim.x + threadIdx.x;
 
-    extern __shared__ float coeff[];
+    __shared__ float coeff[9];
 
-    if (lid < 9)
+    if (lid == 0)
     {
-        coeff[lid] = transform.xform[lid];
+        loadTransform<Transform>(coeff, matrices, dstCoord.z, invert);
     }
 
     __syncthreads();
@@ -48,11 +55,11 @@ __global__ void warp(SrcWrapper src, DstWrapper dst, int2 dstSize, Transform tra
     }
 }
 
-template<class Transform, typename T, NVCVBorderType B, NVCVInterpolationType I>
+template<class Transform, class MatrixWrapper, typename T, NVCVBorderType B, NVCVInterpolationType I>
 struct WarpDispatcher
 {
     static ErrorCode call(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                          Transform transform, const float4 &borderValue, cudaStream_t stream)
+                          MatrixWrapper matrices, bool invert, const float4 &borderValue, cudaStream_t stream)
     {
         auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
         NVCV_ASSERT(outAccess);
@@ -68,8 +75,6 @@ struct WarpDispatcher
 
         auto bVal = cuda::StaticCast<cuda::BaseType<T>>(cuda::DropCast<cuda::NumElements<T>>(borderValue));
 
-        int smem_size = 9 * sizeof(float);
-
         int64_t srcMaxStride = inAccess->sampleStride() * batchSize;
         int64_t dstMaxStride = outAccess->sampleStride() * batchSize;
 
@@ -78,7 +83,7 @@ struct WarpDispatcher
             auto src = cuda::CreateInterpolationWrapNHW<const T, B, I, int32_t>(inData, bVal);
             auto dst = cuda::CreateTensorWrapNHW<T, int32_t>(outData);
 
-            warp<Transform><<<grid, block, smem_size, stream>>>(src, dst, dstSize, transform);
+            warp<Transform><<<grid, block, 0, stream>>>(src, dst, dstSize, matrices, invert);
         }
         else
         {
@@ -90,68 +95,249 @@ struct WarpDispatcher
     }
 };
 
-template<class Transform, typename T>
-ErrorCode warp_caller(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData, Transform transform,
-                      int interpolation, int borderMode, const float4 &borderValue, cudaStream_t stream)
+template<class Transform, class MatrixWrapper, typename T>
+ErrorCode warp_caller(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                      MatrixWrapper matrices, bool invert, int interpolation, int borderMode,
+                      const float4 &borderValue, cudaStream_t stream)
 {
     typedef ErrorCode (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                                Transform transform, const float4 &borderValue, cudaStream_t stream);
+                                MatrixWrapper matrices, bool invert, const float4 &borderValue, cudaStream_t stream);
 
     static const func_t funcs[3][5] = {
-        {WarpDispatcher<Transform, T, NVCV_BORDER_CONSTANT, NVCV_INTERP_NEAREST>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REPLICATE, NVCV_INTERP_NEAREST>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT, NVCV_INTERP_NEAREST>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_WRAP, NVCV_INTERP_NEAREST>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT101, NVCV_INTERP_NEAREST>::call},
-        {WarpDispatcher<Transform, T, NVCV_BORDER_CONSTANT,  NVCV_INTERP_LINEAR>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REPLICATE,  NVCV_INTERP_LINEAR>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT,  NVCV_INTERP_LINEAR>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_WRAP,  NVCV_INTERP_LINEAR>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT101,  NVCV_INTERP_LINEAR>::call},
-        {WarpDispatcher<Transform, T, NVCV_BORDER_CONSTANT,   NVCV_INTERP_CUBIC>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REPLICATE,   NVCV_INTERP_CUBIC>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT,   NVCV_INTERP_CUBIC>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_WRAP,   NVCV_INTERP_CUBIC>::call,
-         WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT101,   NVCV_INTERP_CUBIC>::call},
+        {WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_CONSTANT, NVCV_INTERP_NEAREST>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REPLICATE, NVCV_INTERP_NEAREST>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REFLECT, NVCV_INTERP_NEAREST>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_WRAP, NVCV_INTERP_NEAREST>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REFLECT101, NVCV_INTERP_NEAREST>::call},
+        {WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_CONSTANT,  NVCV_INTERP_LINEAR>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REPLICATE,  NVCV_INTERP_LINEAR>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REFLECT,  NVCV_INTERP_LINEAR>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_WRAP,  NVCV_INTERP_LINEAR>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REFLECT101,  NVCV_INTERP_LINEAR>::call},
+        {WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_CONSTANT,   NVCV_INTERP_CUBIC>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REPLICATE,   NVCV_INTERP_CUBIC>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REFLECT,   NVCV_INTERP_CUBIC>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_WRAP,   NVCV_INTERP_CUBIC>::call,
+         WarpDispatcher<Transform, MatrixWrapper, T, NVCV_BORDER_REFLECT101,   NVCV_INTERP_CUBIC>::call},
     };
 
-    return funcs[interpolation][borderMode](inData, outData, transform, borderValue, stream);
+    return funcs[interpolation][borderMode](inData, outData, matrices, invert, borderValue, stream);
 }
 
-template<typename T>
+template<typename T, class MatrixWrapper>
 ErrorCode warpAffine(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                     WarpAffineTransform transform, const int interpolation, int borderMode, const float4 &borderValue,
-                     cudaStream_t stream)
+                     MatrixWrapper matrices, bool invert, const int interpolation, int borderMode,
+                     const float4 &borderValue, cudaStream_t stream)
 {
-    return warp_caller<WarpAffineTransform, T>(inData, outData, transform, interpolation, borderMode, borderValue,
-                                               stream);
+    return warp_caller<WarpAffineTransform, MatrixWrapper, T>(inData, outData, matrices, invert, interpolation,
+                                                              borderMode, borderValue, stream);
 }
 
-template<typename T>
+template<typename T, class MatrixWrapper>
 ErrorCode warpPerspective(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                          PerspectiveTransform transform, const int interpolation, int borderMode,
+                          MatrixWrapper matrices, bool invert, const int interpolation, int borderMode,
                           const float4 &borderValue, cudaStream_t stream)
 {
-    return warp_caller<PerspectiveTransform, T>(inData, outData, transform, interpolation, borderMode, borderValue,
-                                                stream);
+    return warp_caller<PerspectiveTransform, MatrixWrapper, T>(inData, outData, matrices, invert, interpolation,
+                                                               borderMode, borderValue, stream);
 }
 
-static void invertMat(const float *M, float *h_aCoeffs)
+// Dedicated kernels for the transforms classified by cls::Classify, used with host matrices only
+
+// Identity, whole pixel translations and 180 degree rotations map each destination pixel to a single source pixel,
+// src = (scale.x * x + offset.x, scale.y * y + offset.y) with scale +-1, no interpolation needed
+template<class SrcWrapper, class DstWrapper>
+__global__ void warpWholePixel(SrcWrapper src, DstWrapper dst, int2 dstSize, int2 scale, int2 offset)
 {
-    // M is stored in row-major format M[0,0], M[0,1], M[0,2], M[1,0], M[1,1], M[1,2]
-    float den    = M[0] * M[4] - M[1] * M[3];
-    den          = std::abs(den) > 1e-5 ? 1. / den : .0;
-    h_aCoeffs[0] = (float)M[4] * den;
-    h_aCoeffs[1] = (float)-M[1] * den;
-    h_aCoeffs[2] = (float)(M[1] * M[5] - M[4] * M[2]) * den;
-    h_aCoeffs[3] = (float)-M[3] * den;
-    h_aCoeffs[4] = (float)M[0] * den;
-    h_aCoeffs[5] = (float)(M[3] * M[2] - M[0] * M[5]) * den;
+    int3 dstCoord = cuda::StaticCast<int>(blockDim * blockIdx + threadIdx);
+
+    if (dstCoord.x < dstSize.x && dstCoord.y < dstSize.y)
+    {
+        dst[dstCoord] = src[int3{scale.x * dstCoord.x + offset.x, scale.y * dstCoord.y + offset.y, dstCoord.z}];
+    }
 }
 
-ErrorCode WarpAffine::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                            const float *xform, const int32_t flags, const NVCVBorderType borderMode,
-                            const float4 borderValue, cudaStream_t stream)
+// 90 and 270 degree rotations, src = (sign.x * y + offset.x, sign.y * x + offset.y). A destination column is a
+// source row, so each BLOCK x BLOCK tile is read along source rows and transposed in shared memory to keep both the
+// reads and the writes coalesced.
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void warpRotate90(SrcWrapper src, DstWrapper dst, int2 dstSize, int2 sign, int2 offset)
+{
+    __shared__ T tile[BLOCK][BLOCK + 1];
+
+    const int x0 = blockIdx.x * BLOCK;
+    const int y0 = blockIdx.y * BLOCK;
+    const int z  = blockIdx.z;
+
+    for (int i = threadIdx.y; i < BLOCK; i += blockDim.y)
+    {
+        const int x = x0 + i, y = y0 + threadIdx.x;
+        if (x < dstSize.x && y < dstSize.y)
+        {
+            tile[i][threadIdx.x] = src[int3{sign.x * y + offset.x, sign.y * x + offset.y, z}];
+        }
+    }
+
+    __syncthreads();
+
+    for (int i = threadIdx.y; i < BLOCK; i += blockDim.y)
+    {
+        const int x = x0 + threadIdx.x, y = y0 + i;
+        if (x < dstSize.x && y < dstSize.y)
+        {
+            dst[int3{x, y, z}] = tile[threadIdx.x][i];
+        }
+    }
+}
+
+// Axis-aligned scale with any translation, src = (scale.x * x + offset.x, scale.y * y + offset.y). The coordinates
+// are separable, so there is no matrix to stage in shared memory nor perspective division per pixel.
+template<class SrcWrapper, class DstWrapper>
+__global__ void warpScale(SrcWrapper src, DstWrapper dst, int2 dstSize, float2 scale, float2 offset)
+{
+    int3 dstCoord = cuda::StaticCast<int>(blockDim * blockIdx + threadIdx);
+
+    if (dstCoord.x < dstSize.x && dstCoord.y < dstSize.y)
+    {
+        const float3 srcCoord{scale.x * dstCoord.x + offset.x, scale.y * dstCoord.y + offset.y,
+                              static_cast<float>(dstCoord.z)};
+
+        dst[dstCoord] = src[srcCoord];
+    }
+}
+
+// Whether a + b * i stays in [0, size) for all i in [0, n)
+inline bool inRange(int a, int b, int n, int size)
+{
+    return a >= 0 && a < size && a + b * (n - 1) >= 0 && a + b * (n - 1) < size;
+}
+
+template<typename T, NVCVBorderType B>
+struct WarpFastDispatcher
+{
+    template<class SrcWrapper, class DstWrapper>
+    static void launchWholePixel(SrcWrapper src, DstWrapper dst, const cls::WarpMap &map, int2 dstSize,
+                                 int batchSize, cudaStream_t stream)
+    {
+        const int2 offset{static_cast<int>(map.xform[2]), static_cast<int>(map.xform[5])};
+
+        dim3 block(BLOCK, BLOCK / 4);
+
+        if (map.type == cls::WarpClass::ROTATE_90 || map.type == cls::WarpClass::ROTATE_270)
+        {
+            const int2 sign{static_cast<int>(map.xform[1]), static_cast<int>(map.xform[3])};
+
+            dim3 grid(divUp(dstSize.x, BLOCK), divUp(dstSize.y, BLOCK), batchSize);
+
+            warpRotate90<<<grid, block, 0, stream>>>(src, dst, dstSize, sign, offset);
+        }
+        else
+        {
+            const int2 scale{static_cast<int>(map.xform[0]), static_cast<int>(map.xform[4])};
+
+            dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), batchSize);
+
+            warpWholePixel<<<grid, block, 0, stream>>>(src, dst, dstSize, scale, offset);
+        }
+    }
+
+    static void call(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                     const cls::WarpMap &map, const int interpolation, const float4 &borderValue, cudaStream_t stream)
+    {
+        auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+        NVCV_ASSERT(outAccess);
+
+        auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+        NVCV_ASSERT(inAccess);
+
+        const int2 srcSize{inAccess->numCols(), inAccess->numRows()};
+        const int2 dstSize{outAccess->numCols(), outAccess->numRows()};
+        const int  batchSize{static_cast<int>(outAccess->numSamples())};
+
+        auto bVal = cuda::StaticCast<cuda::BaseType<T>>(cuda::DropCast<cuda::NumElements<T>>(borderValue));
+
+        auto dst = cuda::CreateTensorWrapNHW<T, int32_t>(outData);
+
+        if (map.type == cls::WarpClass::SCALE)
+        {
+            const float2 scale{map.xform[0], map.xform[4]};
+            const float2 offset{map.xform[2], map.xform[5]};
+
+            dim3 block(BLOCK, BLOCK / 4);
+            dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), batchSize);
+
+            switch (interpolation)
+            {
+            case NVCV_INTERP_NEAREST:
+                warpScale<<<grid, block, 0, stream>>>(
+                    cuda::CreateInterpolationWrapNHW<const T, B, NVCV_INTERP_NEAREST, int32_t>(inData, bVal), dst,
+                    dstSize, scale, offset);
+                break;
+            case NVCV_INTERP_LINEAR:
+                warpScale<<<grid, block, 0, stream>>>(
+                    cuda::CreateInterpolationWrapNHW<const T, B, NVCV_INTERP_LINEAR, int32_t>(inData, bVal), dst,
+                    dstSize, scale, offset);
+                break;
+            default:
+                warpScale<<<grid, block, 0, stream>>>(
+                    cuda::CreateInterpolationWrapNHW<const T, B, NVCV_INTERP_CUBIC, int32_t>(inData, bVal), dst,
+                    dstSize, scale, offset);
+                break;
+            }
+            return;
+        }
+
+        // Skip the border handling when every sampled pixel is inside the source, e.g. crops and rotations of the
+        // whole image
+        int c[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            c[i] = static_cast<int>(map.xform[i]);
+        }
+
+        bool inside;
+        if (map.type == cls::WarpClass::ROTATE_90 || map.type == cls::WarpClass::ROTATE_270)
+        {
+            inside = inRange(c[2], c[1], dstSize.y, srcSize.x) && inRange(c[5], c[3], dstSize.x, srcSize.y);
+        }
+        else
+        {
+            inside = inRange(c[2], c[0], dstSize.x, srcSize.x) && inRange(c[5], c[4], dstSize.y, srcSize.y);
+        }
+
+        if (inside)
+        {
+            launchWholePixel(cuda::CreateTensorWrapNHW<const T, int32_t>(inData), dst, map, dstSize, batchSize,
+                             stream);
+        }
+        else
+        {
+            launchWholePixel(cuda::CreateBorderWrapNHW<const T, B, int32_t>(inData, bVal), dst, map, dstSize,
+                             batchSize, stream);
+        }
+    }
+};
+
+template<typename T>
+void warpFast(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData, const cls::WarpMap &map,
+              const int interpolation, const int borderMode, const float4 &borderValue, cudaStream_t stream)
+{
+    typedef void (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                           const cls::WarpMap &map, const int interpolation, const float4 &borderValue,
+                           cudaStream_t stream);
+
+    static const func_t funcs[5] = {
+        WarpFastDispatcher<T, NVCV_BORDER_CONSTANT>::call, WarpFastDispatcher<T, NVCV_BORDER_REPLICATE>::call,
+        WarpFastDispatcher<T, NVCV_BORDER_REFLECT>::call, WarpFastDispatcher<T, NVCV_BORDER_WRAP>::call,
+        WarpFastDispatcher<T, NVCV_BORDER_REFLECT101>::call};
+
+    funcs[borderMode](inData, outData, map, interpolation, borderValue, stream);
+}
+
+// Validation shared by all entry points and by the general and dedicated kernels
+static ErrorCode checkWarpArgs(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                               const int interpolation, const NVCVBorderType borderMode, DataType &data_type,
+                               int &channels)
 {
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData.layout());
     DataFormat output_format = helpers::GetLegacyDataFormat(outData.layout());
@@ -173,11 +359,10 @@ ErrorCode WarpAffine::infer(const TensorDataStridedCuda &inData, const TensorDat
     auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
 
-    DataType  data_type   = helpers::GetLegacyDataType(inData.dtype());
+    data_type             = helpers::GetLegacyDataType(inData.dtype());
     DataShape input_shape = helpers::GetLegacyDataShape(inAccess->infoShape());
 
-    int       channels      = input_shape.C;
-    const int interpolation = flags & NVCV_INTERP_MAX;
+    channels = input_shape.C;
 
     if (channels > 4)
     {
@@ -198,120 +383,225 @@ ErrorCode WarpAffine::infer(const TensorDataStridedCuda &inData, const TensorDat
                 || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT
                 || borderMode == NVCV_BORDER_WRAP);
 
-    typedef ErrorCode (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                                WarpAffineTransform transform, const int interpolation, int borderMode,
-                                const float4 &borderValue, cudaStream_t stream);
+    return ErrorCode::SUCCESS;
+}
+
+// Runs the dedicated kernel of a transform classified on the host, the caller checked it is not GENERAL
+static ErrorCode warpFastInfer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                               const cls::WarpMap &map, const int32_t flags, const NVCVBorderType borderMode,
+                               const float4 borderValue, cudaStream_t stream)
+{
+    DataType  data_type;
+    int       channels;
+    const int interpolation = flags & NVCV_INTERP_MAX;
+
+    if (ErrorCode err = checkWarpArgs(inData, outData, interpolation, borderMode, data_type, channels);
+        err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    auto inAccess  = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && outAccess);
+
+    int64_t srcMaxStride = inAccess->sampleStride() * inAccess->numSamples();
+    int64_t dstMaxStride = outAccess->sampleStride() * outAccess->numSamples();
+
+    if (std::max(srcMaxStride, dstMaxStride) > cuda::TypeTraits<int32_t>::max)
+    {
+        LOG_ERROR("Input or output size exceeds " << cuda::TypeTraits<int32_t>::max << ". Tensor is too large.");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    typedef void (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                           const cls::WarpMap &map, const int interpolation, const int borderMode,
+                           const float4 &borderValue, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
-        { warpAffine<uchar1>, 0,  warpAffine<uchar3>,  warpAffine<uchar4>},
-        {                  0, 0,                   0,                   0},
-        {warpAffine<ushort1>, 0, warpAffine<ushort3>, warpAffine<ushort4>},
-        { warpAffine<short1>, 0,  warpAffine<short3>,  warpAffine<short4>},
-        {                  0, 0,                   0,                   0},
-        { warpAffine<float1>, 0,  warpAffine<float3>,  warpAffine<float4>}
+        { warpFast<uchar1>, 0,  warpFast<uchar3>,  warpFast<uchar4>},
+        {                0, 0,                 0,                 0},
+        {warpFast<ushort1>, 0, warpFast<ushort3>, warpFast<ushort4>},
+        { warpFast<short1>, 0,  warpFast<short3>,  warpFast<short4>},
+        {                0, 0,                 0,                 0},
+        { warpFast<float1>, 0,  warpFast<float3>,  warpFast<float4>}
     };
 
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    WarpAffineTransform transform;
+    func(inData, outData, map, interpolation, borderMode, borderValue, stream);
+    checkKernelErrors();
 
-    if (flags & NVCV_WARP_INVERSE_MAP)
-    {
-        for (int i = 0; i < 9; i++)
-        {
-            transform.xform[i] = i < 6 ? (float)(xform[i]) : 0.0f;
-        }
-    }
-    else
+    return ErrorCode::SUCCESS;
+}
+
+// Shared by the host matrix and the per-sample matrix tensor entry points, the matrix is inverted by the warp
+// kernel itself unless NVCV_WARP_INVERSE_MAP is set
+template<class MatrixWrapper>
+static ErrorCode warpAffineInfer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                 MatrixWrapper matrices, const int32_t flags, const NVCVBorderType borderMode,
+                                 const float4 borderValue, cudaStream_t stream)
+{
+    DataType  data_type;
+    int       channels;
+    const int interpolation = flags & NVCV_INTERP_MAX;
+
+    if (ErrorCode err = checkWarpArgs(inData, outData, interpolation, borderMode, data_type, channels);
+        err != ErrorCode::SUCCESS)
     {
-        invertMat(xform, transform.xform);
+        return err;
     }
 
-    return func(inData, outData, transform, interpolation, borderMode, borderValue, stream);
+    typedef ErrorCode (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                MatrixWrapper matrices, bool invert, const int interpolation, int borderMode,
+                                const float4 &borderValue, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { warpAffine<uchar1, MatrixWrapper>, 0,  warpAffine<uchar3, MatrixWrapper>,  warpAffine<uchar4, MatrixWrapper>},
+        {                                 0, 0,                                  0,                                  0},
+        {warpAffine<ushort1, MatrixWrapper>, 0, warpAffine<ushort3, MatrixWrapper>, warpAffine<ushort4, MatrixWrapper>},
+        { warpAffine<short1, MatrixWrapper>, 0,  warpAffine<short3, MatrixWrapper>,  warpAffine<short4, MatrixWrapper>},
+        {                                 0, 0,                                  0,                                  0},
+        { warpAffine<float1, MatrixWrapper>, 0,  warpAffine<float3, MatrixWrapper>,  warpAffine<float4, MatrixWrapper>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    bool invert = !(flags & NVCV_WARP_INVERSE_MAP);
+
+    return func(inData, outData, matrices, invert, interpolation, borderMode, borderValue, stream);
 }
 
-ErrorCode WarpPerspective::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                                 const float *transMatrix, const int32_t flags, const NVCVBorderType borderMode,
-                                 const float4 borderValue, cudaStream_t stream)
+WarpAffine::WarpAffine(DataShape max_input_shape, DataShape max_output_shape)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_fastPath(cls::FastPathEnabled(std::getenv("CVCUDA_WARP_ALGO")))
 {
-    DataFormat input_format  = helpers::GetLegacyDataFormat(inData.layout());
-    DataFormat output_format = helpers::GetLegacyDataFormat(outData.layout());
+}
 
-    if (input_format != output_format)
+ErrorCode WarpAffine::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                            const float *xform, const int32_t flags, const NVCVBorderType borderMode,
+                            const float4 borderValue, cudaStream_t stream)
+{
+    if (m_fastPath)
     {
-        LOG_ERROR("Invalid DataFormat between input (" << input_format << ") and output (" << output_format << ")");
-        return ErrorCode::INVALID_DATA_FORMAT;
+        cls::WarpMap map = cls::Classify(xform, false, !(flags & NVCV_WARP_INVERSE_MAP));
+        if (map.type != cls::WarpClass::GENERAL)
+        {
+            return warpFastInfer(inData, outData, map, flags, borderMode, borderValue, stream);
+        }
     }
 
-    DataFormat format = input_format;
+    UniformTransformMatrix matrix;
 
-    if (!(format == kNHWC || format == kHWC))
+    for (int i = 0; i < 9; i++)
     {
-        LOG_ERROR("Invalid input DataFormat " << format << ", the valid DataFormats are: \"NHWC\", \"HWC\"");
-        return ErrorCode::INVALID_DATA_FORMAT;
+        matrix.xform[i] = i < 6 ? (float)(xform[i]) : 0.0f;
     }
 
+    return warpAffineInfer(inData, outData, matrix, flags, borderMode, borderValue, stream);
+}
+
+ErrorCode WarpAffine::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                            const TensorDataStridedCuda &transMatrix, const int32_t flags,
+                            const NVCVBorderType borderMode, const float4 borderValue, cudaStream_t stream)
+{
     auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
 
-    DataType  data_type   = helpers::GetLegacyDataType(inData.dtype());
-    DataShape input_shape = helpers::GetLegacyDataShape(inAccess->infoShape());
-
-    int       channels      = input_shape.C;
-    const int interpolation = flags & NVCV_INTERP_MAX;
-
-    if (channels > 4)
+    TransformMatrixWrap matrices;
+    if (!CreateTransformMatrixWrap(transMatrix, inAccess->numSamples(), kTransformSize<WarpAffineTransform>,
+                                   matrices))
     {
-        LOG_ERROR("Invalid channel number " << channels);
-        return ErrorCode::INVALID_DATA_SHAPE;
+        LOG_ERROR("Invalid transformation matrix tensor, it must hold one packed 2x3 float matrix per sample");
+        return ErrorCode::INVALID_PARAMETER;
     }
 
-    if (!(data_type == kCV_8U || data_type == kCV_8S || data_type == kCV_16U || data_type == kCV_16S
-          || data_type == kCV_32S || data_type == kCV_32F))
+    return warpAffineInfer(inData, outData, matrices, flags, borderMode, borderValue, stream);
+}
+
+template<class MatrixWrapper>
+static ErrorCode warpPerspectiveInfer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                      MatrixWrapper matrices, const int32_t flags, const NVCVBorderType borderMode,
+                                      const float4 borderValue, cudaStream_t stream)
+{
+    DataType  data_type;
+    int       channels;
+    const int interpolation = flags & NVCV_INTERP_MAX;
+
+    if (ErrorCode err = checkWarpArgs(inData, outData, interpolation, borderMode, data_type, channels);
+        err != ErrorCode::SUCCESS)
     {
-        LOG_ERROR("Invalid DataType " << data_type);
-        return ErrorCode::INVALID_DATA_TYPE;
+        return err;
     }
 
-    NVCV_ASSERT(interpolation == NVCV_INTERP_NEAREST || interpolation == NVCV_INTERP_LINEAR
-                || interpolation == NVCV_INTERP_CUBIC);
-    NVCV_ASSERT(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
-                || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT
-                || borderMode == NVCV_BORDER_WRAP);
-
     typedef ErrorCode (*func_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                                PerspectiveTransform transform, const int interpolation, int borderMode,
+                                MatrixWrapper matrices, bool invert, const int interpolation, int borderMode,
                                 const float4 &borderValue, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
-        {      warpPerspective<uchar1>,  0 /*warpPerspective<uchar2>*/,      warpPerspective<uchar3>,warpPerspective<uchar4>                                                                                                     },
-        {0 /*warpPerspective<schar1>*/,   0 /*warpPerspective<char2>*/, 0 /*warpPerspective<char3>*/,
-         0 /*warpPerspective<char4>*/                                                                                         },
-        {     warpPerspective<ushort1>, 0 /*warpPerspective<ushort2>*/,     warpPerspective<ushort3>, warpPerspective<ushort4>},
-        {      warpPerspective<short1>,  0 /*warpPerspective<short2>*/,      warpPerspective<short3>,  warpPerspective<short4>},
-        {  0 /*warpPerspective<int1>*/,    0 /*warpPerspective<int2>*/,  0 /*warpPerspective<int3>*/,
-         0 /*warpPerspective<int4>*/                                                                                          },
-        {      warpPerspective<float1>,  0 /*warpPerspective<float2>*/,      warpPerspective<float3>,  warpPerspective<float4>}
+        { warpPerspective<uchar1, MatrixWrapper>, 0,  warpPerspective<uchar3, MatrixWrapper>,  warpPerspective<uchar4, MatrixWrapper>},
+        {                                      0, 0,                                       0,                                       0},
+        {warpPerspective<ushort1, MatrixWrapper>, 0, warpPerspective<ushort3, MatrixWrapper>, warpPerspective<ushort4, MatrixWrapper>},
+        { warpPerspective<short1, MatrixWrapper>, 0,  warpPerspective<short3, MatrixWrapper>,  warpPerspective<short4, MatrixWrapper>},
+        {                                      0, 0,                                       0,                                       0},
+        { warpPerspective<float1, MatrixWrapper>, 0,  warpPerspective<float3, MatrixWrapper>,  warpPerspective<float4, MatrixWrapper>}
     };
 
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    PerspectiveTransform transform(transMatrix);
+    bool invert = !(flags & NVCV_WARP_INVERSE_MAP);
+
+    return func(inData, outData, matrices, invert, interpolation, borderMode, borderValue, stream);
+}
+
+WarpPerspective::WarpPerspective(DataShape max_input_shape, DataShape max_output_shape)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_fastPath(cls::FastPathEnabled(std::getenv("CVCUDA_WARP_ALGO")))
+{
+}
+
+ErrorCode WarpPerspective::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                 const float *transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                                 const float4 borderValue, cudaStream_t stream)
+{
+    if (m_fastPath)
+    {
+        cls::WarpMap map = cls::Classify(transMatrix, true, !(flags & NVCV_WARP_INVERSE_MAP));
+        if (map.type != cls::WarpClass::GENERAL)
+        {
+            return warpFastInfer(inData, outData, map, flags, borderMode, borderValue, stream);
+        }
+    }
+
+    UniformTransformMatrix matrix;
 
-    if (!(flags & NVCV_WARP_INVERSE_MAP))
+    for (int i = 0; i < 9; i++)
     {
-        cuda::math::Matrix<float, 3, 3> tempMatrixForInverse;
+        matrix.xform[i] = transMatrix[i];
+    }
 
-        tempMatrixForInverse.load(transMatrix);
+    return warpPerspectiveInfer(inData, outData, matrix, flags, borderMode, borderValue, stream);
+}
 
-        cuda::math::inv_inplace(tempMatrixForInverse);
+ErrorCode WarpPerspective::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                 const TensorDataStridedCuda &transMatrix, const int32_t flags,
+                                 const NVCVBorderType borderMode, const float4 borderValue, cudaStream_t stream)
+{
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
 
-        tempMatrixForInverse.store(transform.xform);
+    TransformMatrixWrap matrices;
+    if (!CreateTransformMatrixWrap(transMatrix, inAccess->numSamples(), kTransformSize<PerspectiveTransform>,
+                                   matrices))
+    {
+        LOG_ERROR("Invalid transformation matrix tensor, it must hold one packed 3x3 float matrix per sample");
+        return ErrorCode::INVALID_PARAMETER;
     }
 
-    return func(inData, outData, transform, interpolation, borderMode, borderValue, stream);
+    return warpPerspectiveInfer(inData, outData, matrices, flags, borderMode, borderValue, stream);
 }
 
 } // namespace nvcv::legacy::cuda_op
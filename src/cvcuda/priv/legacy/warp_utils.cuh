@@ -0,0 +1,131 @@
+/* Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ *
+ * SPDX-FileCopyrightText: NVIDIA CORPORATION & AFFILIATES
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef WARP_UTILS_CUH
+#define WARP_UTILS_CUH
+
+#include "CvCudaLegacy.h"
+#include "CvCudaUtils.cuh"
+
+#include <type_traits>
+
+namespace nvcv::legacy::cuda_op {
+
+// Number of floats of a transform matrix as stored by the user, 2x3 for affine and 3x3 for perspective
+template<class Transform>
+constexpr int kTransformSize = 9;
+
+template<>
+constexpr int kTransformSize<WarpAffineTransform> = 6;
+
+// Per-sample transform matrices indexed by sample, row and column, either a single host matrix passed by value or
+// one matrix per sample in a device tensor, e.g. the homographies written by FindHomography
+struct UniformTransformMatrix
+{
+    __device__ __forceinline__ const float *ptr(int, int row, int col) const
+    {
+        return &xform[row * 3 + col];
+    }
+
+    float xform[9];
+};
+
+using TransformMatrixWrap = cuda::Tensor3DWrap<const float, int32_t>;
+
+// Checks that a tensor holds numSamples float matrices of numElements each, with 3 columns, either as
+// [N, numElements] or as [N, rows, 3] with any row stride, and wraps it as [N, rows, 3]
+inline bool CreateTransformMatrixWrap(const TensorDataStridedCuda &data, int numSamples, int numElements,
+                                      TransformMatrixWrap &wrap)
+{
+    if (data.dtype() != nvcv::TYPE_F32 || data.shape(0) < numSamples || data.stride(0) > cuda::TypeTraits<int>::max)
+    {
+        return false;
+    }
+
+    int64_t rowStride;
+    if (data.rank() == 2 && data.shape(1) == numElements && data.stride(1) == sizeof(float))
+    {
+        rowStride = 3 * sizeof(float);
+    }
+    else if (data.rank() == 3 && data.shape(1) * 3 == numElements && data.shape(2) == 3
+             && data.stride(2) == sizeof(float))
+    {
+        rowStride = data.stride(1);
+    }
+    else
+    {
+        return false;
+    }
+
+    wrap = TransformMatrixWrap(reinterpret_cast<const float *>(data.basePtr()), static_cast<int>(data.stride(0)),
+                               static_cast<int>(rowStride));
+    return true;
+}
+
+// Loads the inverse map of a sample into coeff, inverting the matrix when it maps source to destination pixels.
+// Every block does this for its own sample so no separate inversion pass or buffer is needed.
+template<class Transform, class MatrixWrapper>
+__device__ __forceinline__ void loadTransform(float *coeff, const MatrixWrapper &matrices, int sample, bool invert)
+{
+    float M[9];
+    for (int i = 0; i < kTransformSize<Transform>; ++i)
+    {
+        M[i] = *matrices.ptr(sample, i / 3, i % 3);
+    }
+
+    if constexpr (std::is_same_v<Transform, WarpAffineTransform>)
+    {
+        if (invert)
+        {
+            // M is stored in row-major format M[0,0], M[0,1], M[0,2], M[1,0], M[1,1], M[1,2]
+            float den = M[0] * M[4] - M[1] * M[3];
+            den       = std::abs(den) > 1e-5 ? 1. / den : .0;
+            coeff[0]  = (float)M[4] * den;
+            coeff[1]  = (float)-M[1] * den;
+            coeff[2]  = (float)(M[1] * M[5] - M[4] * M[2]) * den;
+            coeff[3]  = (float)-M[3] * den;
+            coeff[4]  = (float)M[0] * den;
+            coeff[5]  = (float)(M[3] * M[2] - M[0] * M[5]) * den;
+        }
+        else
+        {
+            for (int i = 0; i < 6; ++i)
+            {
+                coeff[i] = M[i];
+            }
+        }
+        coeff[6] = coeff[7] = coeff[8] = 0.f;
+    }
+    else
+    {
+        cuda::math::Matrix<float, 3, 3> matrix;
+
+        matrix.load(M);
+
+        if (invert)
+        {
+            cuda::math::inv_inplace(matrix);
+        }
+
+        matrix.store(coeff);
+    }
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // WARP_UTILS_CUH
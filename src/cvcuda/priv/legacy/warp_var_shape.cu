@@ -25,68 +25,23 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "warp_utils.cuh"
 
 #define BLOCK 32
 
 namespace nvcv::legacy::cuda_op {
 
-__global__ void inverseMatWarpPerspective(const int numImages, const cuda::Tensor2DWrap<float, int32_t> in,
-                                          cuda::Tensor2DWrap<float, int32_t> out)
-{
-    int index = threadIdx.x + blockIdx.x * blockDim.x;
-    if (index >= numImages)
-    {
-        return;
-    }
-
-    cuda::math::Matrix<float, 3, 3> transMatrix;
-
-    transMatrix.load(in.ptr(index));
-
-    cuda::math::inv_inplace(transMatrix);
-
-    transMatrix.store(out.ptr(index));
-}
-
-__global__ void inverseMatWarpAffine(const int numImages, const cuda::Tensor2DWrap<float, int32_t> in,
-                                     cuda::Tensor2DWrap<float, int32_t> out)
-{
-    int index = threadIdx.x + blockIdx.x * blockDim.x;
-    if (index >= numImages)
-    {
-        return;
-    }
-
-    cuda::math::Matrix<float, 2, 3> M;
-    M[0][0] = (float)(*in.ptr(index, 0));
-    M[0][1] = (float)(*in.ptr(index, 1));
-    M[0][2] = (float)(*in.ptr(index, 2));
-    M[1][0] = (float)(*in.ptr(index, 3));
-    M[1][1] = (float)(*in.ptr(index, 4));
-    M[1][2] = (float)(*in.ptr(index, 5));
-
-    // M is stored in row-major format M[0,0], M[0,1], M[0,2], M[1,0], M[1,1], M[1,2]
-    float den          = M[0][0] * M[1][1] - M[0][1] * M[1][0];
-    den                = std::abs(den) > 1e-5 ? 1. / den : .0;
-    *out.ptr(index, 0) = (float)M[1][1] * den;
-    *out.ptr(index, 1) = (float)-M[0][1] * den;
-    *out.ptr(index, 2) = (float)(M[0][1] * M[1][2] - M[1][1] * M[0][2]) * den;
-    *out.ptr(index, 3) = (float)-M[1][0] * den;
-    *out.ptr(index, 4) = (float)M[0][0] * den;
-    *out.ptr(index, 5) = (float)(M[1][0] * M[0][2] - M[0][0] * M[1][2]) * den;
-}
-
 template<class Transform, class SrcWrapper, class DstWrapper>
-__global__ void warp(SrcWrapper src, DstWrapper dst, const cuda::Tensor2DWrap<float, int32_t> coeffs)
+__global__ void warp(SrcWrapper src, DstWrapper dst, const TransformMatrixWrap matrices, bool invert)
 {
     int3      dstCoord = cuda::StaticCast<int>(blockDim * blockIdx + threadIdx);
     const int lid      = threadIdx.y * blockDim.x + threadIdx.x;
 
-    extern __shared__ float coeff[];
+    __shared__ float coeff[9];
 
-    if (lid < 9)
+    if (lid == 0)
     {
-        coeff[lid] = *coeffs.ptr(dstCoord.z, lid);
+        loadTransform<Transform>(coeff, matrices, dstCoord.z, invert);
     }
 
     __syncthreads();
@@ -104,7 +59,7 @@ template<class Transform, typename T, NVCVBorderType B, NVCVInterpolationType I>
 struct WarpDispatcher
 {
     static void call(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
-                     const cuda::Tensor2DWrap<float, int32_t> transform, const float4 &borderValue, cudaStream_t stream)
+                     const TransformMatrixWrap matrices, bool invert, const float4 &borderValue, cudaStream_t stream)
     {
         Size2D outMaxSize = outData.maxSize();
 
@@ -116,21 +71,19 @@ struct WarpDispatcher
         cuda::InterpolationVarShapeWrap<const T, B, I> src(inData, bVal);
         cuda::ImageBatchVarShapeWrap<T>                dst(outData);
 
-        size_t smem_size = 9 * sizeof(float);
-
-        warp<Transform><<<grid, block, smem_size, stream>>>(src, dst, transform);
+        warp<Transform><<<grid, block, 0, stream>>>(src, dst, matrices, invert);
         checkKernelErrors();
     }
 };
 
 template<class Transform, typename T>
 void warp_caller(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
-                 cuda::Tensor2DWrap<float, int32_t> transform, const int interpolation, const int borderMode,
+                 const TransformMatrixWrap matrices, bool invert, const int interpolation, const int borderMode,
                  const float4 &borderValue, cudaStream_t stream)
 {
-    typedef void (*func_t)(
-        const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
-        cuda::Tensor2DWrap<float, int32_t> transform, const float4 &borderValue, cudaStream_t stream);
+    typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &inData,
+                           const ImageBatchVarShapeDataStridedCuda &outData, const TransformMatrixWrap matrices,
+                           bool invert, const float4 &borderValue, cudaStream_t stream);
 
     static const func_t funcs[3][5] = {
         {WarpDispatcher<Transform, T, NVCV_BORDER_CONSTANT, NVCV_INTERP_NEAREST>::call,
@@ -150,45 +103,31 @@ void warp_caller(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBat
          WarpDispatcher<Transform, T, NVCV_BORDER_REFLECT101,   NVCV_INTERP_CUBIC>::call},
     };
 
-    funcs[interpolation][borderMode](inData, outData, transform, borderValue, stream);
+    funcs[interpolation][borderMode](inData, outData, matrices, invert, borderValue, stream);
 }
 
 template<typename T>
 void warpAffine(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
-                cuda::Tensor2DWrap<float, int32_t> transform, const int interpolation, const int borderMode,
+                const TransformMatrixWrap matrices, bool invert, const int interpolation, const int borderMode,
                 const float4 &borderValue, cudaStream_t stream)
 {
-    warp_caller<WarpAffineTransform, T>(inData, outData, transform, interpolation, borderMode, borderValue, stream);
+    warp_caller<WarpAffineTransform, T>(inData, outData, matrices, invert, interpolation, borderMode, borderValue,
+                                        stream);
 }
 
 template<typename T>
 void warpPerspective(const ImageBatchVarShapeDataStridedCuda &inData, const ImageBatchVarShapeDataStridedCuda &outData,
-                     cuda::Tensor2DWrap<float, int32_t> transform, const int interpolation, const int borderMode,
+                     const TransformMatrixWrap matrices, bool invert, const int interpolation, const int borderMode,
                      const float4 &borderValue, cudaStream_t stream)
 {
-    warp_caller<PerspectiveTransform, T>(inData, outData, transform, interpolation, borderMode, borderValue, stream);
+    warp_caller<PerspectiveTransform, T>(inData, outData, matrices, invert, interpolation, borderMode, borderValue,
+                                         stream);
 }
 
 WarpAffineVarShape::WarpAffineVarShape(const int32_t maxBatchSize)
     : CudaBaseOp()
     , m_maxBatchSize(maxBatchSize)
 {
-    if (m_maxBatchSize > 0)
-    {
-        // Allocating for 9 floats even though only 6 are required because the CUDA kernel
-        // is shared between affine & perspective
-        size_t bufferSize = sizeof(float) * 9 * m_maxBatchSize;
-        NVCV_CHECK_LOG(cudaMalloc(&m_transformationMatrix, bufferSize));
-    }
-}
-
-WarpAffineVarShape::~WarpAffineVarShape()
-{
-    if (m_transformationMatrix != nullptr)
-    {
-        NVCV_CHECK_LOG(cudaFree(m_transformationMatrix));
-    }
-    m_transformationMatrix = nullptr;
 }
 
 ErrorCode WarpAffineVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
@@ -257,29 +196,19 @@ ErrorCode WarpAffineVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inD
                 || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT
                 || borderMode == NVCV_BORDER_WRAP);
 
-    // Check if inverse op is needed
-    bool performInverse = !(flags & NVCV_WARP_INVERSE_MAP);
-
-    // Wrap the matrix in 2D wrappers with proper pitch
-    cuda::Tensor2DWrap<float, int32_t> transMatrixInput(transMatrix);
-    cuda::Tensor2DWrap<float, int32_t> transMatrixOutput(m_transformationMatrix, static_cast<int>(sizeof(float) * 9));
-
-    if (performInverse)
-    {
-        inverseMatWarpAffine<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), transMatrixInput,
-                                                                   transMatrixOutput);
-        checkKernelErrors();
-    }
-    else
+    TransformMatrixWrap matrices;
+    if (!CreateTransformMatrixWrap(transMatrix, inData.numImages(), kTransformSize<WarpAffineTransform>, matrices))
     {
-        NVCV_CHECK_LOG(cudaMemcpy2DAsync(m_transformationMatrix, sizeof(float) * 9, transMatrixInput.ptr(0, 0),
-                                         transMatrixInput.strides()[0], sizeof(float) * 6, inData.numImages(),
-                                         cudaMemcpyDeviceToDevice, stream));
+        LOG_ERROR("Invalid transformation matrix tensor, it must hold one packed 2x3 float matrix per image");
+        return ErrorCode::INVALID_PARAMETER;
     }
 
+    // The warp kernel inverts each image's matrix unless it is already the inverse map
+    bool invert = !(flags & NVCV_WARP_INVERSE_MAP);
+
     typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &inData,
                            const ImageBatchVarShapeDataStridedCuda &outData,
-                           const cuda::Tensor2DWrap<float, int32_t> transform, const int interpolation,
+                           const TransformMatrixWrap matrices, bool invert, const int interpolation,
                            const int borderMode, const float4 &borderValue, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
@@ -294,7 +223,7 @@ ErrorCode WarpAffineVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inD
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, transMatrixOutput, interpolation, borderMode, borderValue, stream);
+    func(inData, outData, matrices, invert, interpolation, borderMode, borderValue, stream);
     return SUCCESS;
 }
 
@@ -302,20 +231,6 @@ WarpPerspectiveVarShape::WarpPerspectiveVarShape(const int32_t maxBatchSize)
     : CudaBaseOp()
     , m_maxBatchSize(maxBatchSize)
 {
-    if (m_maxBatchSize > 0)
-    {
-        size_t bufferSize = sizeof(float) * 9 * m_maxBatchSize;
-        NVCV_CHECK_LOG(cudaMalloc(&m_transformationMatrix, bufferSize));
-    }
-}
-
-WarpPerspectiveVarShape::~WarpPerspectiveVarShape()
-{
-    if (m_transformationMatrix != nullptr)
-    {
-        NVCV_CHECK_LOG(cudaFree(m_transformationMatrix));
-    }
-    m_transformationMatrix = nullptr;
 }
 
 ErrorCode WarpPerspectiveVarShape::infer(const ImageBatchVarShapeDataStridedCuda &inData,
@@ -384,30 +299,20 @@ ErrorCode WarpPerspectiveVarShape::infer(const ImageBatchVarShapeDataStridedCuda
                 || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT
                 || borderMode == NVCV_BORDER_WRAP);
 
-    // Check if inverse op is needed
-    bool performInverse = flags & NVCV_WARP_INVERSE_MAP;
-
-    // Wrap the matrix in 2D wrappers with proper pitch
-    cuda::Tensor2DWrap<float, int32_t> transMatrixInput(transMatrix);
-    cuda::Tensor2DWrap<float, int32_t> transMatrixOutput(m_transformationMatrix, static_cast<int>(sizeof(float) * 9));
-
-    if (!performInverse)
+    TransformMatrixWrap matrices;
+    if (!CreateTransformMatrixWrap(transMatrix, inData.numImages(), kTransformSize<PerspectiveTransform>, matrices))
     {
-        inverseMatWarpPerspective<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), transMatrixInput,
-                                                                        transMatrixOutput);
-        checkKernelErrors();
-    }
-    else
-    {
-        NVCV_CHECK_LOG(cudaMemcpy2DAsync(m_transformationMatrix, sizeof(float) * 9, transMatrixInput.ptr(0, 0),
-                                         transMatrixInput.strides()[0], sizeof(float) * 9, inData.numImages(),
-                                         cudaMemcpyDeviceToDevice, stream));
+        LOG_ERROR("Invalid transformation matrix tensor, it must hold one packed 3x3 float matrix per image");
+        return ErrorCode::INVALID_PARAMETER;
     }
 
+    // The warp kernel inverts each image's matrix unless it is already the inverse map
+    bool invert = !(flags & NVCV_WARP_INVERSE_MAP);
+
     typedef void (*func_t)(const ImageBatchVarShapeDataStridedCuda &inData,
                            const ImageBatchVarShapeDataStridedCuda &outData,
-                           cuda::Tensor2DWrap<float, int32_t> transform, const int interpolation, const int borderMode,
-                           const float4 &borderValue, cudaStream_t stream);
+                           const TransformMatrixWrap matrices, bool invert, const int interpolation,
+                           const int borderMode, const float4 &borderValue, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
         {     warpPerspective<uchar1>,  0 /*warpPerspective<uchar2>*/,      warpPerspective<uchar3>,warpPerspective<uchar4>                                                                                                    },
@@ -423,7 +328,7 @@ ErrorCode WarpPerspectiveVarShape::infer(const ImageBatchVarShapeDataStridedCuda
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, transMatrixOutput, interpolation, borderMode, borderValue, stream);
+    func(inData, outData, matrices, invert, interpolation, borderMode, borderValue, stream);
     return SUCCESS;
 }
 
@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_LRU_CACHE_HPP
+#define NVCV_UTIL_LRU_CACHE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace nvcv::util {
+
+/** A bounded, thread-safe cache that evicts the least recently used entry
+ *
+ * The values are held by `std::shared_ptr`, so an entry that is evicted while a caller still uses it stays alive
+ * until the caller drops its reference. The values are immutable once inserted.
+ *
+ * @tparam Key   The key type, it must be equality comparable
+ * @tparam Value The type of the cached values
+ * @tparam Hash  The hash function of the key
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache
+{
+public:
+    using ValuePtr = std::shared_ptr<const Value>;
+
+    explicit LruCache(size_t capacity)
+        : m_capacity(capacity > 0 ? capacity : 1)
+    {
+    }
+
+    /** Gets the value of @p key, marking it as the most recently used, or nullptr if it's not cached. */
+    ValuePtr get(const Key &key)
+    {
+        std::lock_guard lg(m_lock);
+
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+        {
+            return nullptr;
+        }
+        m_items.splice(m_items.begin(), m_items, it->second);
+        return it->second->second;
+    }
+
+    /** Gets the value of @p key or creates it with @p create if it's not cached.
+     *
+     * The value is created outside of the lock, so that slow creation (e.g. with device memory allocation) does
+     * not block other lookups. If another thread inserts the same key meanwhile, its value is kept and returned.
+     */
+    template<typename CreateFunc>
+    ValuePtr getOrCreate(const Key &key, CreateFunc &&create)
+    {
+        if (ValuePtr value = get(key))
+        {
+            return value;
+        }
+        return put(key, ValuePtr(create()));
+    }
+
+    /** Inserts @p value for @p key unless the key is already cached, returns the cached value. */
+    ValuePtr put(const Key &key, ValuePtr value)
+    {
+        ValuePtr evicted; // released after the lock, its destructor may have to wait for the device
+
+        std::lock_guard lg(m_lock);
+
+        auto it = m_index.find(key);
+        if (it != m_index.end())
+        {
+            m_items.splice(m_items.begin(), m_items, it->second);
+            return it->second->second;
+        }
+
+        if (m_items.size() >= m_capacity)
+        {
+            evicted = std::move(m_items.back().second);
+            m_index.erase(m_items.back().first);
+            m_items.pop_back();
+        }
+
+        m_items.emplace_front(key, std::move(value));
+        m_index.emplace(key, m_items.begin());
+        return m_items.front().second;
+    }
+
+    void clear()
+    {
+        std::list<Item> items;
+        {
+            std::lock_guard lg(m_lock);
+            m_index.clear();
+            items.swap(m_items);
+        }
+    }
+
+    size_t size() const
+    {
+        std::lock_guard lg(m_lock);
+        return m_items.size();
+    }
+
+    size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+    using Item = std::pair<Key, ValuePtr>;
+
+    size_t             m_capacity;
+    std::list<Item>    m_items; // most recently used first
+    mutable std::mutex m_lock;
+
+    std::unordered_map<Key, typename std::list<Item>::iterator, Hash> m_index;
+};
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_LRU_CACHE_HPP
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_PER_STREAM_SCRATCH_HPP
+#define NVCV_UTIL_PER_STREAM_SCRATCH_HPP
+
+#include "Event.hpp"
+#include "PerStreamCache.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/util/CheckError.hpp>
+
+#include <utility>
+
+namespace nvcv::util {
+
+/** A block of device memory handed out by PerStreamScratch.
+ *
+ * The buffer owns its memory and the event that marks the completion of its last use.
+ */
+struct ScratchBuffer
+{
+    static constexpr size_t kAlignment = 256;
+
+    ScratchBuffer() = default;
+
+    ScratchBuffer(ScratchBuffer &&other) noexcept
+    {
+        swap(other);
+    }
+
+    ScratchBuffer &operator=(ScratchBuffer &&other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~ScratchBuffer()
+    {
+        if (data)
+        {
+            NVCV_CHECK_LOG(cudaFree(data));
+        }
+    }
+
+    void swap(ScratchBuffer &other) noexcept
+    {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(alignment, other.alignment);
+        std::swap(event, other.event);
+        ready       = event.get();
+        other.ready = other.event.get();
+    }
+
+    void       *data      = nullptr;
+    size_t      size      = 0;
+    size_t      alignment = kAlignment;
+    cudaEvent_t ready     = nullptr;
+    CudaEvent   event;
+};
+
+/** Device scratch memory shared by all calls to one operator instance.
+ *
+ * A call acquires a buffer for the duration of its submission and releases it once all the work using the buffer
+ * has been enqueued. Released buffers are reused without synchronization by later calls on the same stream and,
+ * once their work has completed, by calls on any stream. This lets a single operator instance be used from many
+ * threads and streams concurrently, while keeping the memory footprint proportional to the number of streams
+ * actually in flight.
+ */
+class PerStreamScratch
+{
+public:
+    class Lease
+    {
+    public:
+        Lease(PerStreamScratch &owner, ScratchBuffer &&buffer, cudaStream_t stream)
+            : m_owner(&owner)
+            , m_buffer(std::move(buffer))
+            , m_stream(stream)
+        {
+        }
+
+        Lease(Lease &&other) noexcept
+            : m_owner(std::exchange(other.m_owner, nullptr))
+            , m_buffer(std::move(other.m_buffer))
+            , m_stream(other.m_stream)
+        {
+        }
+
+        Lease(const Lease &)            = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        ~Lease()
+        {
+            if (m_owner && m_buffer.data)
+            {
+                m_owner->release(std::move(m_buffer), m_stream);
+            }
+        }
+
+        template<typename T = void>
+        T *data() const noexcept
+        {
+            return static_cast<T *>(m_buffer.data);
+        }
+
+        size_t size() const noexcept
+        {
+            return m_buffer.size;
+        }
+
+    private:
+        PerStreamScratch *m_owner;
+        ScratchBuffer     m_buffer;
+        cudaStream_t      m_stream;
+    };
+
+    /** Gets a buffer of at least @p size bytes that can be used by work submitted to @p stream.
+     *
+     * The buffer returns to the cache when the lease goes out of scope; all the work using it must have been
+     * submitted to @p stream by then.
+     */
+    Lease acquire(size_t size, cudaStream_t stream)
+    {
+        size = (size + ScratchBuffer::kAlignment - 1) / ScratchBuffer::kAlignment * ScratchBuffer::kAlignment;
+
+        if (auto cached = m_cache.get(size, ScratchBuffer::kAlignment, stream))
+        {
+            return Lease(*this, std::move(cached).value(), stream);
+        }
+
+        ScratchBuffer buffer;
+        if (size > 0)
+        {
+            NVCV_CHECK_THROW(cudaMalloc(&buffer.data, size));
+        }
+        buffer.size  = size;
+        buffer.event = CudaEvent::CreateWithFlags(cudaEventDisableTiming);
+        buffer.ready = buffer.event.get();
+        return Lease(*this, std::move(buffer), stream);
+    }
+
+    /** Releases all cached buffers, waiting for the work still using them. */
+    void purge()
+    {
+        m_cache.purge();
+    }
+
+private:
+    void release(ScratchBuffer &&buffer, cudaStream_t stream) noexcept
+    {
+        try
+        {
+            NVCV_CHECK_THROW(cudaEventRecord(buffer.ready, stream));
+            m_cache.put(std::move(buffer), stream);
+        }
+        catch (...)
+        {
+            // The buffer may still be in use by the stream, wait for it before it's freed.
+            NVCV_CHECK_LOG(cudaStreamSynchronize(stream));
+        }
+    }
+
+    PerStreamCache<ScratchBuffer> m_cache;
+};
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_PER_STREAM_SCRATCH_HPP
@@ -17,6 +17,8 @@
 
 #include "priv/TensorBatch.hpp"
 
+#include "priv/IContext.hpp"
+#include "priv/PinnedStagingPool.hpp"
 #include "priv/Status.hpp"
 #include "priv/SymbolVersioning.hpp"
 #include "priv/TensorBatchManager.hpp"
@@ -316,3 +318,16 @@ NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorBatchGetUserPointer, (NVCVTensorBatc
             *outUserPointer = tb.userPointer();
         });
 }
+
+NVCV_DEFINE_API(0, 16, NVCVStatus, nvcvTensorBatchGetStagingStats, (NVCVTensorBatchStagingStats * stats))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (stats == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to staging stats must not be NULL");
+            }
+            *stats = priv::GlobalContext().pinnedStaging().stats();
+        });
+}
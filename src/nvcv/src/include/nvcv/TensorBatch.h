@@ -271,6 +271,34 @@ NVCV_PUBLIC NVCVStatus nvcvTensorBatchGetLayout(NVCVTensorBatchHandle handle, NV
  */
 NVCV_PUBLIC NVCVStatus nvcvTensorBatchGetRank(NVCVTensorBatchHandle handle, int32_t *outRankPtr);
 
+/** Statistics of the page-locked host memory used to stage tensor batch descriptors.
+ *
+ * Tensor batches don't own page-locked memory, they draw the staging buffers used by
+ * \ref nvcvTensorBatchExportData from a pool shared by all batches in the process.
+ */
+typedef struct NVCVTensorBatchStagingStatsRec
+{
+    /*< Page-locked memory currently held by the staging pool, in bytes. */
+    int64_t reservedBytes;
+
+    /*< Part of the reserved memory still waiting for uploads to complete, in bytes. */
+    int64_t pendingBytes;
+
+    /*< Largest amount of page-locked memory held by the staging pool so far, in bytes. */
+    int64_t peakReservedBytes;
+} NVCVTensorBatchStagingStats;
+
+/**
+ * Retrieves statistics of the page-locked memory shared by all tensor batches.
+ *
+ * @param[out] stats Where the statistics will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorBatchGetStagingStats(NVCVTensorBatchStagingStats *stats);
+
 #ifdef __cplusplus
 }
 #endif
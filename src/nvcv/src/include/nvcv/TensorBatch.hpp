@@ -44,8 +44,15 @@ public:
     using Requirements = NVCVTensorBatchRequirements;
     using HandleType   = NVCVTensorBatchHandle;
 
+    using StagingStats = NVCVTensorBatchStagingStats;
+
     static Requirements CalcRequirements(int32_t capacity);
 
+    /**
+     * @brief Return statistics of the page-locked memory shared by all tensor batches to stage their data.
+     */
+    static StagingStats GetStagingStats();
+
     NVCV_IMPLEMENT_SHARED_RESOURCE(TensorBatch, Base);
 
     TensorBatch(const Requirements &reqs, const Allocator &alloc = nullptr);
@@ -29,6 +29,13 @@ inline TensorBatch::Requirements TensorBatch::CalcRequirements(int32_t capacity)
     return reqs;
 }
 
+inline TensorBatch::StagingStats TensorBatch::GetStagingStats()
+{
+    TensorBatch::StagingStats stats = {};
+    detail::CheckThrow(nvcvTensorBatchGetStagingStats(&stats));
+    return stats;
+}
+
 inline TensorBatch::TensorBatch(const TensorBatch::Requirements &reqs, const Allocator &alloc)
 {
     NVCVTensorBatchHandle handle = nullptr;
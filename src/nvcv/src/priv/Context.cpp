@@ -30,7 +30,8 @@ IContext &GlobalContext()
 }
 
 Context::Context()
-    : m_allocatorManager("Allocator")
+    : m_pinnedStaging(m_allocDefault)
+    , m_allocatorManager("Allocator")
     , m_imageManager("Image")
     , m_imageBatchManager("ImageBatch")
     , m_tensorManager("Tensor")
@@ -51,6 +52,11 @@ IAllocator &Context::allocDefault()
     return m_allocDefault;
 }
 
+PinnedStagingPool &Context::pinnedStaging()
+{
+    return m_pinnedStaging;
+}
+
 auto Context::managerList() const -> const Managers &
 {
     return m_managerList;
@@ -24,6 +24,7 @@
 #include "IContext.hpp"
 #include "ImageBatchManager.hpp"
 #include "ImageManager.hpp"
+#include "PinnedStagingPool.hpp"
 #include "TensorBatchManager.hpp"
 #include "TensorManager.hpp"
 
@@ -35,12 +36,14 @@ public:
     Context();
     ~Context();
 
-    const Managers &managerList() const override;
-    IAllocator     &allocDefault() override;
+    const Managers    &managerList() const override;
+    IAllocator        &allocDefault() override;
+    PinnedStagingPool &pinnedStaging() override;
 
 private:
     // Order is important due to inter-dependencies
     DefaultAllocator   m_allocDefault;
+    PinnedStagingPool  m_pinnedStaging;
     AllocatorManager   m_allocatorManager;
     ImageManager       m_imageManager;
     ImageBatchManager  m_imageBatchManager;
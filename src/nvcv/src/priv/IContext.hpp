@@ -36,6 +36,7 @@ using ArrayManager       = CoreObjManager<NVCVArrayHandle>;
 using AllocatorManager   = CoreObjManager<NVCVAllocatorHandle>;
 
 class IAllocator;
+class PinnedStagingPool;
 
 class IContext
 {
@@ -49,8 +50,9 @@ public:
         return std::get<CoreObjManager<HandleType> &>(managerList());
     }
 
-    virtual const Managers &managerList() const = 0;
-    virtual IAllocator     &allocDefault()      = 0;
+    virtual const Managers    &managerList() const = 0;
+    virtual IAllocator        &allocDefault()      = 0;
+    virtual PinnedStagingPool &pinnedStaging()     = 0;
 };
 
 // Defined in Context.cpp
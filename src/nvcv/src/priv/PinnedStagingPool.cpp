@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PinnedStagingPool.hpp"
+
+#include "Exception.hpp"
+
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace nvcv::priv {
+
+namespace {
+
+constexpr int64_t kMinBlockSize = 256;
+constexpr int64_t kSlabSize     = 64 << 10;
+
+// Beyond this amount of reserved memory we wait for the oldest upload of
+// the requested size instead of reserving more.
+constexpr int64_t kMaxReservedBytes = 64 << 20;
+
+// How many fenced blocks are checked for completion before growing the pool.
+constexpr int kMaxScan = 16;
+
+} // namespace
+
+PinnedStagingPool::PinnedStagingPool(IAllocator &alloc)
+    : m_alloc(alloc)
+{
+}
+
+PinnedStagingPool::~PinnedStagingPool()
+{
+    for (const std::unique_ptr<Block> &block : m_blocks)
+    {
+        if (block->fence)
+        {
+            if (block->pending)
+            {
+                NVCV_CHECK_LOG(cudaEventSynchronize(block->fence));
+            }
+            NVCV_CHECK_LOG(cudaEventDestroy(block->fence));
+        }
+    }
+
+    for (const Slab &slab : m_slabs)
+    {
+        m_alloc.freeHostPinnedMem(slab.ptr, slab.size, kMinBlockSize);
+    }
+}
+
+auto PinnedStagingPool::findReady(std::deque<Block *> &freeList) -> Block *
+{
+    int numScanned = 0;
+    for (auto it = freeList.begin(); it != freeList.end() && numScanned < kMaxScan; ++it)
+    {
+        Block *block = *it;
+        if (block->pending)
+        {
+            cudaError_t err = cudaEventQuery(block->fence);
+            if (err == cudaErrorNotReady)
+            {
+                ++numScanned;
+                continue;
+            }
+            NVCV_CHECK_THROW(err);
+        }
+
+        freeList.erase(it);
+        return block;
+    }
+    return nullptr;
+}
+
+void PinnedStagingPool::grow(int sizeClass)
+{
+    int64_t blockSize = kMinBlockSize << sizeClass;
+    int64_t slabSize  = std::max(blockSize, kSlabSize);
+
+    void *ptr = m_alloc.allocHostPinnedMem(slabSize, kMinBlockSize);
+    NVCV_ASSERT(ptr != nullptr);
+    m_slabs.push_back({ptr, slabSize});
+
+    m_reservedBytes += slabSize;
+    m_peakReservedBytes = std::max(m_peakReservedBytes, m_reservedBytes);
+
+    for (int64_t offset = 0; offset < slabSize; offset += blockSize)
+    {
+        m_blocks.emplace_back(new Block{static_cast<std::byte *>(ptr) + offset, blockSize, sizeClass});
+        // Fresh blocks go first, they don't have to wait for any fence.
+        m_free[sizeClass].push_front(m_blocks.back().get());
+    }
+}
+
+auto PinnedStagingPool::acquire(int64_t size) -> Block *
+{
+    if (size < 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Staging buffer size must be >= 0, not " << size;
+    }
+
+    int64_t blockSize = util::RoundUpNextPowerOfTwo(std::max(size, kMinBlockSize));
+    int     sizeClass = util::ILog2(blockSize) - util::ILog2(kMinBlockSize);
+
+    std::lock_guard<std::mutex> lk(m_mtx);
+
+    if (sizeClass >= static_cast<int>(m_free.size()))
+    {
+        m_free.resize(sizeClass + 1);
+    }
+    std::deque<Block *> &freeList = m_free[sizeClass];
+
+    Block *block = findReady(freeList);
+    if (block == nullptr)
+    {
+        if (!freeList.empty() && m_reservedBytes + std::max(blockSize, kSlabSize) > kMaxReservedBytes)
+        {
+            NVCV_CHECK_THROW(cudaEventSynchronize(freeList.front()->fence));
+        }
+        else
+        {
+            grow(sizeClass);
+        }
+        block = freeList.front();
+        freeList.pop_front();
+    }
+
+    block->pending = false;
+    m_acquiredBytes += block->size;
+    return block;
+}
+
+void PinnedStagingPool::release(Block *block, cudaStream_t stream)
+{
+    NVCV_ASSERT(block != nullptr);
+
+    std::lock_guard<std::mutex> lk(m_mtx);
+
+    cudaError_t err = cudaSuccess;
+    if (block->fence == nullptr)
+    {
+        err = cudaEventCreateWithFlags(&block->fence, cudaEventDisableTiming);
+    }
+    if (err == cudaSuccess)
+    {
+        err = cudaEventRecord(block->fence, stream);
+    }
+
+    block->pending = err == cudaSuccess;
+    if (!block->pending)
+    {
+        // Without a fence, make sure the upload is done before the block is reused.
+        NVCV_CHECK_LOG(cudaStreamSynchronize(stream));
+    }
+
+    m_acquiredBytes -= block->size;
+    m_free[block->sizeClass].push_back(block);
+
+    NVCV_CHECK_THROW(err);
+}
+
+NVCVTensorBatchStagingStats PinnedStagingPool::stats() const
+{
+    std::lock_guard<std::mutex> lk(m_mtx);
+
+    NVCVTensorBatchStagingStats stats;
+    stats.reservedBytes     = m_reservedBytes;
+    stats.peakReservedBytes = m_peakReservedBytes;
+    stats.pendingBytes      = m_acquiredBytes;
+
+    for (const std::deque<Block *> &freeList : m_free)
+    {
+        for (const Block *block : freeList)
+        {
+            if (block->pending && cudaEventQuery(block->fence) == cudaErrorNotReady)
+            {
+                stats.pendingBytes += block->size;
+            }
+        }
+    }
+    return stats;
+}
+
+} // namespace nvcv::priv
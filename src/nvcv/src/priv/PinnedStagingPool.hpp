@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_PINNEDSTAGINGPOOL_HPP
+#define NVCV_CORE_PRIV_PINNEDSTAGINGPOOL_HPP
+
+#include "IAllocator.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/TensorBatch.h>
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nvcv::priv {
+
+// Page-locked host memory shared by all batch objects to stage the descriptors they upload to
+// the device. Small buffers are carved out of 64 KiB slabs and bucketed by power-of-two size.
+// A released buffer is fenced on the stream that consumes it and handed out again only after
+// that stream has gone past the fence, so staging never blocks on unrelated streams.
+class PinnedStagingPool
+{
+public:
+    struct Block
+    {
+        void   *ptr;
+        int64_t size;
+        int     sizeClass;
+
+        cudaEvent_t fence   = nullptr;
+        bool        pending = false;
+    };
+
+    explicit PinnedStagingPool(IAllocator &alloc);
+    ~PinnedStagingPool();
+
+    PinnedStagingPool(const PinnedStagingPool &)            = delete;
+    PinnedStagingPool &operator=(const PinnedStagingPool &) = delete;
+
+    // Returns a pinned buffer of at least size bytes that can be written to right away.
+    Block *acquire(int64_t size);
+
+    // Gives the buffer back to the pool, it's reused once all work currently
+    // submitted to the stream completes.
+    void release(Block *block, cudaStream_t stream);
+
+    NVCVTensorBatchStagingStats stats() const;
+
+private:
+    IAllocator &m_alloc;
+
+    mutable std::mutex m_mtx;
+
+    std::vector<std::unique_ptr<Block>> m_blocks;
+    std::vector<std::deque<Block *>>    m_free; // indexed by size class
+
+    struct Slab
+    {
+        void   *ptr;
+        int64_t size;
+    };
+
+    std::vector<Slab> m_slabs;
+
+    int64_t m_reservedBytes     = 0;
+    int64_t m_peakReservedBytes = 0;
+    int64_t m_acquiredBytes     = 0;
+
+    Block *findReady(std::deque<Block *> &freeList);
+    void   grow(int sizeClass);
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_PINNEDSTAGINGPOOL_HPP
@@ -17,6 +17,8 @@
 
 #include "TensorBatch.hpp"
 
+#include "IContext.hpp"
+#include "PinnedStagingPool.hpp"
 #include "Requirements.hpp"
 #include "TensorBatchManager.hpp"
 
@@ -35,10 +37,8 @@ TensorBatch::TensorBatch(const NVCVTensorBatchRequirements &reqs, IAllocator &al
     , m_rank(-1)
     , m_userPointer(nullptr)
 {
-    m_evPostFence         = nullptr;
-    m_devTensorsBuffer    = nullptr;
-    m_pinnedTensorsBuffer = nullptr;
-    m_Tensors             = nullptr;
+    m_devTensorsBuffer = nullptr;
+    m_Tensors          = nullptr;
 
     int64_t bufferSize = m_reqs.capacity * sizeof(BatchElement);
 
@@ -47,13 +47,8 @@ TensorBatch::TensorBatch(const NVCVTensorBatchRequirements &reqs, IAllocator &al
         m_devTensorsBuffer = static_cast<BatchElement *>(m_alloc->allocCudaMem(bufferSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_devTensorsBuffer != nullptr);
 
-        m_pinnedTensorsBuffer = static_cast<BatchElement *>(m_alloc->allocHostPinnedMem(bufferSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_pinnedTensorsBuffer != nullptr);
-
         m_Tensors = static_cast<NVCVTensorHandle *>(m_alloc->allocHostMem(bufferSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_Tensors != nullptr);
-
-        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&m_evPostFence, cudaEventDisableTiming));
     }
     catch (...)
     {
@@ -79,7 +74,6 @@ NVCVTensorBatchRequirements TensorBatch::CalcRequirements(int32_t capacity)
     }
 
     AddBuffer(reqs.mem.cudaMem, capacity * sizeof(BatchElement), reqs.alignBytes);
-    AddBuffer(reqs.mem.hostPinnedMem, capacity * sizeof(BatchElement), reqs.alignBytes);
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(BatchElement), reqs.alignBytes);
 
     return reqs;
@@ -92,11 +86,6 @@ TensorBatch::~TensorBatch()
 
 void TensorBatch::cleanUp()
 {
-    if (m_evPostFence)
-    {
-        NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
-    }
-
     for (int i = 0; i < m_numTensors; ++i)
     {
         CoreObjectDecRef(m_Tensors[i]);
@@ -105,7 +94,6 @@ void TensorBatch::cleanUp()
     int64_t bufferSize = m_reqs.capacity * sizeof(BatchElement);
 
     m_alloc->freeCudaMem(m_devTensorsBuffer, bufferSize, m_reqs.alignBytes);
-    m_alloc->freeHostPinnedMem(m_pinnedTensorsBuffer, bufferSize, m_reqs.alignBytes);
     m_alloc->freeHostMem(m_Tensors, bufferSize, m_reqs.alignBytes);
 }
 
@@ -113,29 +101,37 @@ void TensorBatch::exportData(CUstream stream, NVCVTensorBatchData &data)
 {
     if (m_dirtyBegin < m_dirtyEnd)
     {
-        // Block until the previous call to exportData finishes the buffer copy.
-        NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
+        int64_t copySize = (m_dirtyEnd - m_dirtyBegin) * sizeof(BatchElement);
 
-        for (auto i = m_dirtyBegin; i < m_dirtyEnd; ++i)
+        // The staging buffer is handed out again only after the copy below is done on this stream.
+        PinnedStagingPool        &staging = GlobalContext().pinnedStaging();
+        PinnedStagingPool::Block *block   = staging.acquire(copySize);
+        try
         {
-            auto          &t = ToStaticRef<ITensor>(m_Tensors[i]);
-            NVCVTensorData tdata;
-            t.exportData(tdata);
-            auto &element = m_pinnedTensorsBuffer[i];
-            element.data  = tdata.buffer.strided.basePtr;
-            for (int d = 0; d < tdata.rank; ++d)
+            auto *elements = static_cast<BatchElement *>(block->ptr);
+            for (auto i = m_dirtyBegin; i < m_dirtyEnd; ++i)
             {
-                element.shape[d]  = tdata.shape[d];
-                element.stride[d] = tdata.buffer.strided.strides[d];
+                auto          &t = ToStaticRef<ITensor>(m_Tensors[i]);
+                NVCVTensorData tdata;
+                t.exportData(tdata);
+                auto &element = elements[i - m_dirtyBegin];
+                element.data  = tdata.buffer.strided.basePtr;
+                for (int d = 0; d < tdata.rank; ++d)
+                {
+                    element.shape[d]  = tdata.shape[d];
+                    element.stride[d] = tdata.buffer.strided.strides[d];
+                }
             }
-        }
-
-        int64_t copySize = (m_dirtyEnd - m_dirtyBegin) * sizeof(BatchElement);
-        NVCV_CHECK_THROW(cudaMemcpyAsync(m_devTensorsBuffer + m_dirtyBegin, m_pinnedTensorsBuffer + m_dirtyBegin,
-                                         copySize, cudaMemcpyHostToDevice, stream));
 
-        // Signal the buffer copy is finished.
-        NVCV_CHECK_THROW(cudaEventRecord(m_evPostFence, stream));
+            NVCV_CHECK_THROW(cudaMemcpyAsync(m_devTensorsBuffer + m_dirtyBegin, elements, copySize, cudaMemcpyHostToDevice,
+                                             stream));
+        }
+        catch (...)
+        {
+            staging.release(block, stream);
+            throw;
+        }
+        staging.release(block, stream);
         m_dirtyBegin = m_dirtyEnd;
     }
     NVCVTensorBatchBuffer buffer;
@@ -78,21 +78,16 @@ private:
     int32_t m_numTensors = 0;
 
     NVCVTensorHandle              *m_Tensors; // host buffer for tensor handles
-    // Pinned buffer for the tensor data descriptors
-    // It's updated every time the user updates the tensor batch.
-    // Changes are tracked with the m_dirty flags.
-    NVCVTensorBatchElementStrided *m_pinnedTensorsBuffer;
     // Device buffer for the tensor data descriptors.
-    // It's updated and returned when the exportData method is called.
+    // It's updated and returned when the exportData method is called, the
+    // descriptors that changed since the previous call (tracked with the m_dirty
+    // flags) are staged in pinned memory drawn from the context's shared pool.
     NVCVTensorBatchElementStrided *m_devTensorsBuffer;
 
     NVCVDataType     m_dtype;
     NVCVTensorLayout m_layout;
     int32_t          m_rank;
 
-    // TODO: must be retrieved from the resource allocator;
-    cudaEvent_t m_evPostFence;
-
     void *m_userPointer;
 
     void cleanUp();
@@ -198,6 +198,99 @@ def test_cache_negative_cache_limit():
         cvcuda.set_cache_limit_inbytes(-1)
 
 
+def test_cache_operator_reuse():
+    cvcuda.clear_cache()
+    cvcuda.set_cache_limit_inbytes(torch.cuda.mem_get_info()[1] // 2)
+
+    src = cvcuda.as_tensor(
+        torch.arange(16, dtype=torch.uint8).reshape(1, 4, 4, 1).cuda(), "NHWC"
+    )
+    out = cvcuda.Tensor(src.shape, src.dtype, src.layout)
+    ref = torch.flip(torch.as_tensor(src.cuda()), dims=[2])
+
+    # Repeated calls with the same arguments reuse the same operator instance
+    cvcuda.flip_into(out, src, flipCode=1)
+    num_items = cvcuda.cache_size()
+    for _ in range(10):
+        cvcuda.flip_into(out, src, flipCode=1)
+    assert cvcuda.cache_size() == num_items
+    assert torch.equal(torch.as_tensor(out.cuda()), ref)
+
+    # Other ctor arguments still get their own instance
+    cvcuda.gaussian_into(out, src, (3, 3), (1.0, 1.0))
+    assert cvcuda.cache_size() > num_items
+
+    # Cleared operators must not be served by the per-thread fast path anymore
+    cvcuda.clear_cache()
+    assert cvcuda.cache_size() == 0
+    cvcuda.flip_into(out, src, flipCode=1)
+    assert cvcuda.cache_size() > 0
+    assert torch.equal(torch.as_tensor(out.cuda()), ref)
+
+
+
+def test_cache_operator_multi_stream():
+    cvcuda.clear_cache()
+    cvcuda.set_cache_limit_inbytes(torch.cuda.mem_get_info()[1] // 2)
+
+    stream1 = cvcuda.Stream()
+    stream2 = cvcuda.Stream()
+
+    src = cvcuda.as_tensor(
+        torch.arange(16, dtype=torch.uint8).reshape(1, 4, 4, 1).cuda(), "NHWC"
+    )
+    out1 = cvcuda.Tensor(src.shape, src.dtype, src.layout)
+    out2 = cvcuda.Tensor(src.shape, src.dtype, src.layout)
+    ref1 = torch.flip(torch.as_tensor(src.cuda()), dims=[2])
+    ref2 = torch.flip(torch.as_tensor(src.cuda()), dims=[1])
+
+    # An operator submitted to one stream is picked again for the other one through the resource cache
+    cvcuda.flip_into(out1, src, flipCode=1, stream=stream1)
+    num_items = cvcuda.cache_size(cvcuda.ThreadScope.LOCAL)
+    for _ in range(10):
+        cvcuda.flip_into(out1, src, flipCode=1, stream=stream1)
+        cvcuda.flip_into(out2, src, flipCode=0, stream=stream2)
+    assert cvcuda.cache_size(cvcuda.ThreadScope.LOCAL) == num_items
+
+    stream1.sync()
+    stream2.sync()
+    assert torch.equal(torch.as_tensor(out1.cuda()), ref1)
+    assert torch.equal(torch.as_tensor(out2.cuda()), ref2)
+
+
+def test_cache_operator_pruning():
+    cvcuda.clear_cache()
+    cache_limit = torch.cuda.mem_get_info()[1] // 2
+    cvcuda.set_cache_limit_inbytes(cache_limit)
+
+    src = cvcuda.Tensor((1, 32, 32, 3), np.uint8, "NHWC")
+    dst = cvcuda.Tensor((1, 16, 16, 3), np.uint8, "NHWC")
+
+    cvcuda.pillowresize_into(dst, src, cvcuda.Format.RGB8)
+    num_items = cvcuda.cache_size(cvcuda.ThreadScope.LOCAL)
+
+    def overflow_cache():
+        # Overflowing the cache of this thread only drops its own items, but it sends
+        # every thread back to its resource cache for the next operator fetch
+        tensor = cvcuda.Tensor((64, 64), np.uint8)
+        size = cvcuda.internal.nbytes_in_cache(tensor)
+        cvcuda.set_cache_limit_inbytes(cvcuda.current_cache_size_inbytes() + size - 1)
+        other = cvcuda.Tensor((64, 64), np.uint8)  # noqa: F841
+        assert cvcuda.cache_size(cvcuda.ThreadScope.LOCAL) <= 1
+
+    thread = threading.Thread(target=overflow_cache)
+    thread.start()
+    thread.join()
+    cvcuda.set_cache_limit_inbytes(cache_limit)
+
+    # PillowResize prunes all cached operators but the one it picks, which must stay cached
+    # as it's neither in use by the per-thread inline cache nor dropped by its own pruning
+    cvcuda.pillowresize_into(dst, src, cvcuda.Format.RGB8)
+    assert cvcuda.cache_size(cvcuda.ThreadScope.LOCAL) == num_items
+    cvcuda.pillowresize_into(dst, src, cvcuda.Format.RGB8)
+    assert cvcuda.cache_size(cvcuda.ThreadScope.LOCAL) == num_items
+
+
 def test_parallel_cache_size():
     """Check that the cache size is properly synced accross threads."""
 
@@ -162,3 +162,86 @@ def test_operator_changing_stream_loaded():
 
     final_out = torch.as_tensor(outTensor.cuda()).cpu()
     assert torch.equal(final_out, inputTensor_copy.cpu())
+
+
+def test_default_resource_retirement():
+    assert cvcuda.get_resource_retirement() == cvcuda.ResourceRetirement.CALLBACK
+
+
+def test_event_resource_retirement():
+    mode = cvcuda.get_resource_retirement()
+    cvcuda.set_resource_retirement(cvcuda.ResourceRetirement.EVENT)
+    try:
+        stream1 = cvcuda.Stream()
+        stream2 = cvcuda.Stream()
+
+        inputTensor = torch.randint(0, 256, (2, 64, 64, 3), dtype=torch.uint8).cuda()
+        inTensor = cvcuda.as_tensor(inputTensor.data, "NHWC")
+
+        for _ in range(20):
+            out1 = cvcuda.flip(inTensor, 0, stream=stream1)
+            out2 = cvcuda.flip(inTensor, 1, stream=stream2)
+
+        # The last submits are still held, they're released by the first poll that
+        # happens after they complete, and only once.
+        torch.cuda.synchronize()
+        assert cvcuda.poll_retired_resources() >= 1
+        assert cvcuda.poll_retired_resources() == 0
+
+        # Syncing the stream releases its holds
+        cvcuda.flip(inTensor, -1, stream=stream1)
+        stream1.sync()
+        assert cvcuda.poll_retired_resources() == 0
+
+        assert torch.equal(
+            torch.as_tensor(out1.cuda()).cpu(), inputTensor.flip(1).cpu()
+        )
+        assert torch.equal(
+            torch.as_tensor(out2.cuda()).cpu(), inputTensor.flip(2).cpu()
+        )
+    finally:
+        cvcuda.set_resource_retirement(mode)
+
+
+def test_submit_batch():
+    mode = cvcuda.get_resource_retirement()
+    cvcuda.set_resource_retirement(cvcuda.ResourceRetirement.EVENT)
+    try:
+        stream = cvcuda.Stream()
+        stream.sync()
+        cvcuda.poll_retired_resources()
+
+        inputTensor = torch.randint(0, 256, (1, 16, 16, 3), dtype=torch.uint8).cuda()
+        inTensor = cvcuda.as_tensor(inputTensor.data, "NHWC")
+        outs = [cvcuda.Tensor((1, 16, 16, 3), cvcuda.Type.U8, "NHWC") for _ in range(10)]
+
+        calls = [
+            (cvcuda.flip_into, (out, inTensor), {"flipCode": ii % 2})
+            for ii, out in enumerate(outs)
+        ]
+        calls.append((cvcuda.flip, (inTensor, -1)))
+        results = cvcuda.submit_batch(calls, stream=stream)
+        assert len(results) == len(calls)
+
+        # All calls of the batch are held together, once
+        torch.cuda.synchronize()
+        assert cvcuda.poll_retired_resources() == 1
+
+        for ii, out in enumerate(outs):
+            assert torch.equal(
+                torch.as_tensor(out.cuda()).cpu(), inputTensor.flip(1 + ii % 2).cpu()
+            )
+        assert torch.equal(
+            torch.as_tensor(results[-1].cuda()).cpu(), inputTensor.flip(1, 2).cpu()
+        )
+
+        # Calls submitted before a failing one still get their resources held
+        with t.raises(Exception):
+            cvcuda.submit_batch(
+                [(cvcuda.flip_into, (outs[0], inTensor, 0)), (cvcuda.flip,)],
+                stream=stream,
+            )
+        torch.cuda.synchronize()
+        assert cvcuda.poll_retired_resources() == 1
+    finally:
+        cvcuda.set_resource_retirement(mode)
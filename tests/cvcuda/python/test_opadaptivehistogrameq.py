@@ -0,0 +1,91 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+
+import cvcuda
+
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input, tile_grid, clip_limit, temporal_alpha",
+    [
+        (((1, 460, 640, 1), cvcuda.Type.U8, "NHWC"), (8, 8), 40.0, 1.0),
+        (((2, 640, 460, 3), cvcuda.Type.U8, "NHWC"), (4, 2), 2.0, 0.5),
+        (((100, 100, 3), cvcuda.Type.U8, "HWC"), (1, 1), 0.0, 0.1),
+        (((460, 640, 1), cvcuda.Type.U8, "HWC"), (16, 16), 4.0, 1.0),
+    ],
+)
+def test_op_adaptive_histogrameq(input, tile_grid, clip_limit, temporal_alpha):
+
+    inputTensor = cvcuda.Tensor(*input)
+
+    out = cvcuda.adaptive_histogrameq(
+        inputTensor, tile_grid, clip_limit, temporal_alpha, reset_state=True
+    )
+    assert out.layout == inputTensor.layout
+    assert out.shape == inputTensor.shape
+    assert out.dtype == inputTensor.dtype
+
+    out = cvcuda.Tensor(inputTensor.shape, inputTensor.dtype, inputTensor.layout)
+    tmp = cvcuda.adaptive_histogrameq_into(
+        out, inputTensor, tile_grid, clip_limit, temporal_alpha
+    )
+
+    assert tmp is out
+    assert out.layout == inputTensor.layout
+    assert out.shape == inputTensor.shape
+    assert out.dtype == inputTensor.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.adaptive_histogrameq(
+        src=inputTensor,
+        tile_grid=tile_grid,
+        clip_limit=clip_limit,
+        temporal_alpha=temporal_alpha,
+        stream=stream,
+    )
+    assert out.layout == inputTensor.layout
+    assert out.shape == inputTensor.shape
+    assert out.dtype == inputTensor.dtype
+
+
+def test_op_adaptive_histogrameq_temporal_smoothing():
+    # A dark frame followed by a bright one: with smoothing the bright frame output is
+    # pulled towards the equalization of the dark frame, so it differs from a fresh one
+    dark = RNG.integers(0, 64, size=(1, 48, 64, 1), dtype=np.uint8)
+    bright = dark + 160
+
+    darkTensor = util.to_cvcuda_tensor(dark, "NHWC")
+    brightTensor = util.to_cvcuda_tensor(bright, "NHWC")
+
+    stream = cvcuda.Stream()
+
+    cvcuda.adaptive_histogrameq(
+        darkTensor, (2, 2), 0.0, 0.5, reset_state=True, stream=stream
+    )
+    smoothed = cvcuda.adaptive_histogrameq(
+        brightTensor, (2, 2), 0.0, 0.5, stream=stream
+    )
+    fresh = cvcuda.adaptive_histogrameq(
+        brightTensor, (2, 2), 0.0, 0.5, reset_state=True, stream=stream
+    )
+
+    smoothed = util.to_cpu_numpy_buffer(smoothed.cuda())
+    fresh = util.to_cpu_numpy_buffer(fresh.cuda())
+
+    assert not np.array_equal(smoothed, fresh)
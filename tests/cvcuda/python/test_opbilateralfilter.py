@@ -179,3 +179,63 @@ def test_op_bilateral_filtervarshape(
     assert out.capacity == input.capacity
     assert out.uniqueformat == input.uniqueformat
     assert out.maxsize == input.maxsize
+
+
+@t.mark.parametrize(
+    "tensor_args, diameter, sigma_color, sigma_space, grid_sampling",
+    [
+        (((5, 32, 32, 4), np.uint8, "NHWC"), 15, 30, 5, (2.5, 15)),
+        (((33, 21, 1), np.uint16, "HWC"), 31, 3000, 10, (10, 3000)),
+    ],
+)
+def test_op_bilateral_filter_grid(
+    tensor_args, diameter, sigma_color, sigma_space, grid_sampling
+):
+    input = cvcuda.Tensor(*tensor_args)
+    out = cvcuda.bilateral_filter(
+        input, diameter, sigma_color, sigma_space, grid_sampling=grid_sampling
+    )
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.bilateral_filter_into(
+        src=input,
+        dst=out,
+        diameter=diameter,
+        sigma_color=sigma_color,
+        sigma_space=sigma_space,
+        grid_sampling=grid_sampling,
+        stream=stream,
+    )
+    assert tmp is out
+
+
+def test_op_bilateral_filter_grid_varshape():
+    nimages = 4
+    input = util.create_image_batch(
+        nimages, cvcuda.Format.RGB8, max_size=(40, 33), max_random=256.0, rng=RNG
+    )
+    diameter = util.create_tensor((nimages), np.int32, "N", max_random=15, rng=RNG)
+    sigma_color = util.create_tensor((nimages), np.float32, "N", max_random=30, rng=RNG)
+    sigma_space = util.create_tensor((nimages), np.float32, "N", max_random=5, rng=RNG)
+
+    out = cvcuda.bilateral_filter(
+        input, diameter, sigma_color, sigma_space, grid_sampling=(2, 10)
+    )
+    assert len(out) == len(input)
+    assert out.uniqueformat == input.uniqueformat
+    assert out.maxsize == input.maxsize
+
+    out = util.clone_image_batch(input)
+    tmp = cvcuda.bilateral_filter_into(
+        src=input,
+        dst=out,
+        diameter=diameter,
+        sigma_color=sigma_color,
+        sigma_space=sigma_space,
+        grid_sampling=(2, 10),
+    )
+    assert tmp is out
@@ -0,0 +1,99 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+
+import cvcuda
+
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "shape, dtype, layout, bins",
+    [
+        ((3, 16, 23, 1), np.uint8, "NHWC", 256),
+        ((1, 160, 37, 1), np.uint16, "NHWC", 64),
+        ((16, 23, 1), np.int16, "HWC", 16),
+        ((2, 41, 29, 1), np.float32, "NHWC", 32),
+    ],
+)
+def test_op_image_stats(shape, dtype, layout, bins):
+    arr = RNG.integers(0, 200, size=shape).astype(dtype)
+    src = util.to_cvcuda_tensor(arr, layout)
+
+    hist, min_max_val, min_max_loc, sum, sum_sq = cvcuda.image_stats(
+        src, bins=bins, range_low=0, range_high=256
+    )
+
+    samples = arr.reshape(-1, shape[-3], shape[-2]).astype(np.float64)
+
+    assert hist.shape == (samples.shape[0], bins)
+    assert hist.dtype == np.int32
+    assert min_max_val.shape == (samples.shape[0], 2)
+    assert min_max_val.dtype == np.float64
+    assert sum.shape == (samples.shape[0],)
+
+    hist = util.to_cpu_numpy_buffer(hist.cuda())
+    min_max_val = util.to_cpu_numpy_buffer(min_max_val.cuda())
+    sum = util.to_cpu_numpy_buffer(sum.cuda())
+    sum_sq = util.to_cpu_numpy_buffer(sum_sq.cuda())
+
+    for i, sample in enumerate(samples):
+        gold_hist, _ = np.histogram(sample, bins=bins, range=(0, 256))
+        np.testing.assert_array_equal(hist[i], gold_hist)
+        assert min_max_val[i][0] == sample.min()
+        assert min_max_val[i][1] == sample.max()
+        np.testing.assert_allclose(sum[i], sample.sum())
+        np.testing.assert_allclose(sum_sq[i], (sample * sample).sum())
+
+
+def test_op_image_stats_into_rois_mask():
+    shape = (2, 32, 48, 1)
+    arr = RNG.integers(0, 256, size=shape).astype(np.uint8)
+    msk = RNG.integers(0, 2, size=shape).astype(np.uint8)
+    rois = np.array(
+        [[[0, 0, 48, 32], [4, 8, 10, 6]], [[-5, -5, 20, 20], [40, 30, 100, 100]]],
+        dtype=np.int32,
+    )
+
+    src = util.to_cvcuda_tensor(arr, "NHWC")
+    mask = util.to_cvcuda_tensor(msk, "NHWC")
+    rois_t = util.to_cvcuda_tensor(rois, "NMC")
+
+    hist = cvcuda.Tensor((2, 2, 256), np.int32, "NMC")
+    min_max_val = cvcuda.Tensor((2, 2, 2), np.float64, "NMC")
+    min_max_loc = cvcuda.Tensor((2, 2, 2), cvcuda.Type._2S32, "NMC")
+    sum = cvcuda.Tensor((2, 2), np.float64, "NM")
+    sum_sq = cvcuda.Tensor((2, 2), np.float64, "NM")
+
+    out = cvcuda.image_stats_into(
+        hist, min_max_val, min_max_loc, sum, sum_sq, src, mask=mask, rois=rois_t
+    )
+
+    assert out[0] is hist
+    assert out[4] is sum_sq
+
+    sum = util.to_cpu_numpy_buffer(sum.cuda())
+
+    for n in range(shape[0]):
+        for r in range(rois.shape[1]):
+            x, y, w, h = rois[n, r]
+            x0, y0 = max(x, 0), max(y, 0)
+            x1, y1 = min(x + w, shape[2]), min(y + h, shape[1])
+            region = arr[n, y0:y1, x0:x1, 0].astype(np.float64)
+            region_mask = msk[n, y0:y1, x0:x1, 0] != 0
+            np.testing.assert_allclose(sum[n, r], region[region_mask].sum())
@@ -0,0 +1,106 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+
+import cvcuda
+
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+def gold_integral(arr, dtype):
+    """Integral image of the (N)HWC array arr, with a leading row and column of zeros"""
+    acc = arr.astype(np.float64 if np.issubdtype(dtype, np.floating) else np.int64)
+    res = acc.cumsum(axis=-3).cumsum(axis=-2)
+    pad = [(0, 0)] * (arr.ndim - 3) + [(1, 0), (1, 0), (0, 0)]
+    return np.pad(res, pad)
+
+
+@t.mark.parametrize(
+    "shape, dtype, layout, sum_dtype, sqsum_dtype",
+    [
+        ((3, 16, 23, 1), np.uint8, "NHWC", None, None),
+        ((2, 160, 37, 3), np.uint8, "NHWC", np.int64, np.float64),
+        ((16, 23, 2), np.int16, "HWC", np.int32, np.int64),
+        ((1, 41, 29, 4), np.uint16, "NHWC", np.float64, None),
+        ((2, 41, 29, 1), np.float32, "NHWC", None, np.float64),
+    ],
+)
+def test_op_integral(shape, dtype, layout, sum_dtype, sqsum_dtype):
+    arr = RNG.integers(0, 200, size=shape).astype(dtype)
+    src = util.to_cvcuda_tensor(arr, layout)
+
+    sum, sqsum = cvcuda.integral(src, sum_dtype, sqsum_dtype)
+
+    out_shape = shape[:-3] + (shape[-3] + 1, shape[-2] + 1, shape[-1])
+    default_dtype = np.int32 if dtype == np.uint8 else np.float64
+
+    assert sum.shape == out_shape
+    assert sum.dtype == (default_dtype if sum_dtype is None else sum_dtype)
+
+    sum = util.to_cpu_numpy_buffer(sum.cuda())
+    np.testing.assert_allclose(sum, gold_integral(arr, sum.dtype))
+
+    if sqsum_dtype is None:
+        assert sqsum is None
+    else:
+        assert sqsum.shape == out_shape
+        assert sqsum.dtype == sqsum_dtype
+
+        sqsum = util.to_cpu_numpy_buffer(sqsum.cuda())
+        sq = arr.astype(np.float64) ** 2
+        np.testing.assert_allclose(sqsum, gold_integral(sq, np.float64))
+
+
+def test_op_integral_into():
+    shape = (2, 32, 48, 1)
+    arr = RNG.integers(0, 256, size=shape).astype(np.uint8)
+    src = util.to_cvcuda_tensor(arr, "NHWC")
+
+    sqsum = cvcuda.Tensor((2, 33, 49, 1), np.float64, "NHWC")
+
+    out = cvcuda.integral_into(None, sqsum, src)
+
+    assert out[0] is None
+    assert out[1] is sqsum
+
+    sqsum = util.to_cpu_numpy_buffer(sqsum.cuda())
+    np.testing.assert_allclose(
+        sqsum, gold_integral(arr.astype(np.float64) ** 2, np.float64)
+    )
+
+
+def test_op_integral_varshape():
+    src = util.create_image_batch(4, cvcuda.Format.U8, max_size=(70, 50), rng=RNG)
+
+    sum = cvcuda.ImageBatchVarShape(src.capacity)
+    sqsum = cvcuda.ImageBatchVarShape(src.capacity)
+    for image in src:
+        w, h = image.size
+        sum.pushback(cvcuda.Image((w + 1, h + 1), cvcuda.Format.S32))
+        sqsum.pushback(cvcuda.Image((w + 1, h + 1), cvcuda.Format.F64))
+
+    cvcuda.integral_into(sum, sqsum, src)
+
+    for image, image_sum, image_sqsum in zip(src, sum, sqsum):
+        arr = image.cpu().reshape(image.size[1], image.size[0], 1)
+
+        gold_sum = gold_integral(arr, np.int32)[..., 0]
+        gold_sqsum = gold_integral(arr.astype(np.float64) ** 2, np.float64)[..., 0]
+
+        np.testing.assert_array_equal(image_sum.cpu(), gold_sum)
+        np.testing.assert_allclose(image_sqsum.cpu(), gold_sqsum)
@@ -184,3 +184,43 @@ def test_op_joint_bilateral_filtervarshape(
     assert out.capacity == input.capacity
     assert out.uniqueformat == input.uniqueformat
     assert out.maxsize == input.maxsize
+
+
+@t.mark.parametrize(
+    "input_args, diameter, sigma_color, sigma_space, grid_sampling",
+    [
+        (((5, 32, 32, 4), np.uint8, "NHWC"), 15, 30, 5, (2.5, 15)),
+        (((33, 21, 1), np.int16, "HWC"), 31, 3000, 10, (10, 3000)),
+    ],
+)
+def test_op_joint_bilateral_filter_grid(
+    input_args, diameter, sigma_color, sigma_space, grid_sampling
+):
+    input = cvcuda.Tensor(*input_args)
+    input_color = cvcuda.Tensor(*input_args)
+
+    out = cvcuda.joint_bilateral_filter(
+        input,
+        input_color,
+        diameter,
+        sigma_color,
+        sigma_space,
+        grid_sampling=grid_sampling,
+    )
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.joint_bilateral_filter_into(
+        src=input,
+        srcColor=input_color,
+        dst=out,
+        diameter=diameter,
+        sigma_color=sigma_color,
+        sigma_space=sigma_space,
+        grid_sampling=grid_sampling,
+        stream=stream,
+    )
+    assert tmp is out
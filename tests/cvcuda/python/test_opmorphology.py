@@ -114,6 +114,30 @@ RNG = np.random.default_rng(0)
             1,
             cvcuda.Border.REFLECT101,
         ),
+        (
+            ((2, 64, 48, 1), np.uint8, "NHWC"),
+            cvcuda.MorphologyType.GRADIENT,
+            [15, 15],
+            [-1, -1],
+            2,
+            cvcuda.Border.CONSTANT,
+        ),
+        (
+            ((64, 48, 3), np.float32, "HWC"),
+            cvcuda.MorphologyType.TOPHAT,
+            [1, 31],
+            [-1, -1],
+            1,
+            cvcuda.Border.REPLICATE,
+        ),
+        (
+            ((2, 64, 48, 4), np.uint16, "NHWC"),
+            cvcuda.MorphologyType.BLACKHAT,
+            [9, 9],
+            [-1, -1],
+            1,
+            cvcuda.Border.REFLECT101,
+        ),
     ],
 )
 def test_op_morphology(input_args, morphologyType, maskSize, anchor, iteration, border):
@@ -123,7 +147,14 @@ def test_op_morphology(input_args, morphologyType, maskSize, anchor, iteration,
     workspace_param = None if iteration in [0, 1] else workspace
     workspace_param = (
         workspace
-        if morphologyType in [cvcuda.MorphologyType.OPEN, cvcuda.MorphologyType.CLOSE]
+        if morphologyType
+        in [
+            cvcuda.MorphologyType.OPEN,
+            cvcuda.MorphologyType.CLOSE,
+            cvcuda.MorphologyType.GRADIENT,
+            cvcuda.MorphologyType.TOPHAT,
+            cvcuda.MorphologyType.BLACKHAT,
+        ]
         else workspace_param
     )
 
@@ -329,7 +360,14 @@ def test_op_morphology_varshape(
     workspace_param = None if iteration in [0, 1] else workspace
     workspace_param = (
         workspace
-        if morphologyType in [cvcuda.MorphologyType.OPEN, cvcuda.MorphologyType.CLOSE]
+        if morphologyType
+        in [
+            cvcuda.MorphologyType.OPEN,
+            cvcuda.MorphologyType.CLOSE,
+            cvcuda.MorphologyType.GRADIENT,
+            cvcuda.MorphologyType.TOPHAT,
+            cvcuda.MorphologyType.BLACKHAT,
+        ]
         else workspace_param
     )
 
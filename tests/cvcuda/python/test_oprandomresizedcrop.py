@@ -159,3 +159,31 @@ def test_op_random_resized_crop_varshape(max_input_size, max_output_size, interp
     assert out.capacity == input.capacity
     assert out.uniqueformat == input.uniqueformat
     assert out.maxsize <= max_output_size
+
+
+def test_op_random_resized_crop_crops():
+    input = cvcuda.Tensor((3, 40, 60, 3), np.uint8, "NHWC")
+
+    # Exported crops lie within the images
+    out_crops = cvcuda.Tensor((3, 4), np.int32, "NC")
+    cvcuda.random_resized_crop(input, (3, 16, 16, 3), seed=7, out_crops=out_crops)
+    crops = util.to_cpu_numpy_buffer(out_crops.cuda())
+    assert np.all(crops[:, 0] >= 0) and np.all(crops[:, 1] >= 0)
+    assert np.all(crops[:, 0] + crops[:, 2] <= 60)
+    assert np.all(crops[:, 1] + crops[:, 3] <= 40)
+
+    # User-supplied crops are used as given, clipped to the images
+    user_crops = np.array(
+        [[0, 0, 60, 40], [5, 10, 20, 15], [50, 30, 20, 20]], dtype=np.int32
+    )
+    out = cvcuda.random_resized_crop(
+        input,
+        (3, 16, 16, 3),
+        crops=util.to_cvcuda_tensor(user_crops, "NC"),
+        out_crops=out_crops,
+    )
+    assert out.shape == (3, 16, 16, 3)
+    np.testing.assert_array_equal(
+        util.to_cpu_numpy_buffer(out_crops.cuda()),
+        [[0, 0, 60, 40], [5, 10, 20, 15], [50, 30, 10, 10]],
+    )
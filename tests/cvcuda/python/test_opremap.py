@@ -184,6 +184,46 @@ def test_op_remap_content(map_type, map_kind, num_maps, num_imgs, img_size, img_
     np.testing.assert_array_equal(a_dst, a_ref)
 
 
+def to_fixed_point_map(a_map):
+    fixed = np.rint(a_map * 32).astype(np.int32)
+    frac = ((fixed[..., 1] & 31) << 5) | (fixed[..., 0] & 31)
+    return np.stack([fixed[..., 0] >> 5, fixed[..., 1] >> 5, frac], axis=-1).astype(
+        np.int16
+    )
+
+
+@t.mark.parametrize(
+    "map_type, map_kind, img_size",
+    [
+        (cvcuda.Remap.ABSOLUTE, "flipH", (16, 33)),
+        (cvcuda.Remap.ABSOLUTE, "flipB", (13, 13)),
+        (cvcuda.Remap.RELATIVE_NORMALIZED, "flipV", (2, 2)),
+        (cvcuda.Remap.RELATIVE_NORMALIZED, "flipB", (2, 2)),
+    ],
+)
+def test_op_remap_compact_map_content(map_type, map_kind, img_size):
+    a_src = np.stack(
+        [util.create_image_pattern(img_size, cvcuda.Format.RGB8) for _ in range(2)]
+    )
+    a_map = MAPS[map_type][map_kind](img_size[0], img_size[1])[np.newaxis]
+
+    if map_type == cvcuda.Remap.ABSOLUTE:
+        a_map = to_fixed_point_map(a_map)
+    else:
+        a_map = a_map.astype(np.float16)
+
+    t_map = util.to_cvcuda_tensor(a_map, "NHWC")
+    t_src = util.to_cvcuda_tensor(a_src, "NHWC")
+
+    t_dst = cvcuda.remap(t_src, t_map, map_type=map_type)
+
+    a_dst = torch.as_tensor(t_dst.cuda()).cpu().numpy()
+
+    a_ref = CALC_REF[map_kind](a_src)
+
+    np.testing.assert_array_equal(a_dst, a_ref)
+
+
 @t.mark.parametrize(
     "num_images, img_format, max_size",
     [
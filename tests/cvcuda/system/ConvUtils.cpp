@@ -22,6 +22,7 @@
 #include <cvcuda/cuda_tools/MathWrappers.hpp> // for min/max
 #include <cvcuda/cuda_tools/SaturateCast.hpp> // for SaturateCast, etc.
 #include <cvcuda/cuda_tools/TypeTraits.hpp>   // for BaseType, etc.
+#include <gtest/gtest.h>
 #include <nvcv/util/Assert.h>                 // for NVCV_ASSERT, etc.
 
 namespace nvcv::test {
@@ -259,4 +260,20 @@ std::vector<float> ComputeGaussianKernel(nvcv::Size2D kernelSize, double2 sigma)
     return kernel;
 }
 
+void ExpectMatchesGold(const std::vector<uint8_t> &testVec, const std::vector<uint8_t> &goldVec,
+                       nvcv::Size2D kernelSize)
+{
+    if (kernelSize.w * kernelSize.h < 100)
+    {
+        EXPECT_EQ(testVec, goldVec);
+        return;
+    }
+
+    ASSERT_EQ(testVec.size(), goldVec.size());
+    for (size_t i = 0; i < testVec.size(); ++i)
+    {
+        ASSERT_NEAR(testVec[i], goldVec[i], 1) << "at byte " << i;
+    }
+}
+
 } // namespace nvcv::test
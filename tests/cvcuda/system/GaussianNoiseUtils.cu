@@ -18,45 +18,33 @@
 #include "GaussianNoiseUtils.cuh"
 
 #include <cuda_runtime.h>
-#include <curand_kernel.h>
+#include <cvcuda/cuda_tools/Philox.hpp>
 
 #define BLOCK 512
 
-__global__ void setup_states(curandState *state, unsigned long long seed, int batch)
+// The noise is drawn on the device so that it matches the operator bit by bit
+__global__ void rand_kernel(float *rand, unsigned long long seed, int sample, int size, int per_channel)
 {
-    auto id = threadIdx.x + batch * blockDim.x;
-    curand_init(seed, id, 0, &state[threadIdx.x]);
-}
-
-__global__ void rand_kernel(curandState *state, float *rand, int size, int per_channel)
-{
-    int         offset     = threadIdx.x;
-    curandState localState = state[threadIdx.x];
-    while (offset < size)
+    for (int offset = threadIdx.x; offset < size; offset += blockDim.x)
     {
+        nvcv::cuda::Philox rng(seed, sample, offset);
         if (per_channel)
         {
-            for (int i = 0; i < 3; i++) rand[offset * 3 + i] = curand_normal(&localState);
+            for (int i = 0; i < 3; i++) rand[offset * 3 + i] = rng.normal();
         }
         else
-            rand[offset] = curand_normal(&localState);
-        offset += blockDim.x;
+            rand[offset] = rng.normal();
     }
 }
 
 void get_random(float *rand_h, bool per_channel, int batch, int mem_size)
 {
-    curandState *states;
-    cudaMalloc((void **)&states, sizeof(curandState) * BLOCK);
-    setup_states<<<1, BLOCK>>>(states, 12345, batch);
-
     float *rand_d;
     cudaMalloc((void **)&rand_d, sizeof(float) * mem_size);
     int img_size = mem_size;
     if (per_channel)
         img_size /= 3;
-    rand_kernel<<<1, BLOCK>>>(states, rand_d, img_size, per_channel);
+    rand_kernel<<<1, BLOCK>>>(rand_d, 12345, batch, img_size, per_channel);
     cudaMemcpy(rand_h, rand_d, mem_size * sizeof(float), cudaMemcpyDeviceToHost);
-    cudaFree(states);
     cudaFree(rand_d);
 }
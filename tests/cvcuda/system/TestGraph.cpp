@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/Graph.hpp>
+#include <cvcuda/OpConvertTo.hpp>
+#include <cvcuda/OpReformat.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> ReadTensor(const nvcv::Tensor &tensor)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    EXPECT_TRUE(data);
+
+    std::vector<uint8_t> vec(data->stride(0) * data->shape(0));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data->basePtr(), vec.size(), cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+void FillTensor(const nvcv::Tensor &tensor, std::mt19937 &rng)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(data);
+
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t>               vec(data->stride(0) * data->shape(0));
+    std::generate(vec.begin(), vec.end(), [&]() { return static_cast<uint8_t>(dist(rng)); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), vec.data(), vec.size(), cudaMemcpyHostToDevice));
+}
+
+// Compares two NCHW F32 tensors element by element, ignoring any row padding
+void CompareNCHW(const nvcv::Tensor &test, const nvcv::Tensor &gold)
+{
+    auto testData = test.exportData<nvcv::TensorDataStridedCuda>();
+    auto goldData = gold.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(testData && goldData);
+    ASSERT_EQ(testData->shape(), goldData->shape());
+
+    std::vector<uint8_t> testVec = ReadTensor(test), goldVec = ReadTensor(gold);
+
+    const nvcv::TensorShape &shape = testData->shape();
+    for (int64_t n = 0; n < shape[0]; ++n)
+        for (int64_t c = 0; c < shape[1]; ++c)
+            for (int64_t y = 0; y < shape[2]; ++y)
+                for (int64_t x = 0; x < shape[3]; ++x)
+                {
+                    auto at = [&](const std::vector<uint8_t> &vec, const nvcv::TensorDataStridedCuda &data)
+                    {
+                        return *reinterpret_cast<const float *>(&vec[n * data.stride(0) + c * data.stride(1)
+                                                                     + y * data.stride(2) + x * data.stride(3)]);
+                    };
+                    ASSERT_EQ(at(testVec, *testData), at(goldVec, *goldData))
+                        << "At n=" << n << " c=" << c << " y=" << y << " x=" << x;
+                }
+}
+
+} // namespace
+
+class GraphRunTest : public ::testing::TestWithParam<bool>
+{
+};
+
+// resize -> normalize -> reformat, with the resized and normalized images living in the graph arena
+TEST_P(GraphRunTest, matches_eager_operators)
+{
+    const bool useCudaGraph = GetParam();
+    const int  srcW = 97, srcH = 61, dstW = 32, dstH = 24;
+    const int  maxBatch = 5;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Resize    resizeOp;
+    cvcuda::ConvertTo convertOp;
+    cvcuda::Reformat  reformatOp;
+
+    cvcuda::Graph graph(useCudaGraph);
+
+    cvcuda::Graph::TensorId in  = graph.addInput();
+    cvcuda::Graph::TensorId out = graph.addOutput();
+
+    cvcuda::Graph::TensorId resized
+        = graph.addTensor({cvcuda::Graph::kBatch, dstH, dstW, 3}, nvcv::TENSOR_NHWC, nvcv::TYPE_U8);
+    cvcuda::Graph::TensorId normalized
+        = graph.addTensor({cvcuda::Graph::kBatch, dstH, dstW, 3}, nvcv::TENSOR_NHWC, nvcv::TYPE_F32);
+
+    // Counts the times the nodes are submitted, a replayed CUDA graph doesn't call them
+    int numSubmits = 0;
+    graph.addNode({in}, {resized},
+                  [&](cudaStream_t s, const cvcuda::GraphNodeArgs &args)
+                  {
+                      ++numSubmits;
+                      resizeOp(s, args.inputs[0], args.outputs[0], NVCV_INTERP_LINEAR);
+                  });
+    graph.addNode({resized}, {normalized}, [&](cudaStream_t s, const cvcuda::GraphNodeArgs &args)
+                  { convertOp(s, args.inputs[0], args.outputs[0], 1.0 / 255, -0.5); });
+
+    // A node with a workspace only, its CUDA memory is planned in the arena together with the tensors
+    bool gotWorkspace = false;
+    graph.addNode(
+        {normalized}, {},
+        [&](cudaStream_t s, const cvcuda::GraphNodeArgs &args)
+        {
+            gotWorkspace = args.workspace.cudaMem.data != nullptr
+                        && reinterpret_cast<uintptr_t>(args.workspace.cudaMem.data) % 256 == 0;
+            ASSERT_EQ(cudaSuccess, cudaMemsetAsync(args.workspace.cudaMem.data, 0, args.workspace.cudaMem.req.size, s));
+        },
+        [](int batchSize)
+        {
+            cvcuda::WorkspaceRequirements req{};
+            req.cudaMem = {static_cast<size_t>(batchSize) * 4096, 256};
+            return req;
+        });
+
+    graph.addNode({normalized}, {out}, [&](cudaStream_t s, const cvcuda::GraphNodeArgs &args)
+                  { reformatOp(s, args.inputs[0], args.outputs[0]); });
+
+    std::mt19937 rng(42);
+
+    for (int batchSize : {3, maxBatch, 3})
+    {
+        // The first run plans (and captures) the graph, the next ones reuse it on the same tensors with new
+        // input contents
+        nvcv::Tensor src({{batchSize, srcH, srcW, 3}, "NHWC"}, nvcv::TYPE_U8);
+        nvcv::Tensor dst({{batchSize, 3, dstH, dstW}, "NCHW"}, nvcv::TYPE_F32);
+
+        nvcv::Tensor goldResized({{batchSize, dstH, dstW, 3}, "NHWC"}, nvcv::TYPE_U8);
+        nvcv::Tensor goldNormalized({{batchSize, dstH, dstW, 3}, "NHWC"}, nvcv::TYPE_F32);
+        nvcv::Tensor goldDst({{batchSize, 3, dstH, dstW}, "NCHW"}, nvcv::TYPE_F32);
+
+        for (int replay = 0; replay < 3; ++replay)
+        {
+            SCOPED_TRACE("batchSize=" + std::to_string(batchSize) + " replay=" + std::to_string(replay));
+
+            FillTensor(src, rng);
+
+            gotWorkspace             = false;
+            const int prevNumSubmits = numSubmits;
+            ASSERT_NO_THROW(graph.run(stream, batchSize, {src}, {dst}));
+
+            const cvcuda::MemoryPlan &plan = graph.plan(batchSize);
+            EXPECT_LT(plan.arenaSize, plan.unaliasedSize);
+
+            resizeOp(stream, src, goldResized, NVCV_INTERP_LINEAR);
+            convertOp(stream, goldResized, goldNormalized, 1.0 / 255, -0.5);
+            reformatOp(stream, goldNormalized, goldDst);
+
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+            if (useCudaGraph && replay > 0)
+            {
+                EXPECT_EQ(prevNumSubmits, numSubmits);
+            }
+            else
+            {
+                EXPECT_EQ(prevNumSubmits + 1, numSubmits);
+                EXPECT_TRUE(gotWorkspace);
+            }
+            CompareNCHW(dst, goldDst);
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+INSTANTIATE_TEST_SUITE_P(_, GraphRunTest, ::testing::Values(false, true));
+
+TEST(GraphTest, aliases_intermediate_tensors)
+{
+    cvcuda::Graph graph;
+
+    cvcuda::Graph::TensorId in  = graph.addInput();
+    cvcuda::Graph::TensorId out = graph.addOutput();
+
+    // a -> b -> c: a and c are never live together and share memory
+    const nvcv::TensorLayout layout{"NW"};
+
+    cvcuda::Graph::TensorId a = graph.addTensor({cvcuda::Graph::kBatch, 1024}, layout, nvcv::TYPE_F32);
+    cvcuda::Graph::TensorId b = graph.addTensor({cvcuda::Graph::kBatch, 256}, layout, nvcv::TYPE_F32);
+    cvcuda::Graph::TensorId c = graph.addTensor({cvcuda::Graph::kBatch, 512}, layout, nvcv::TYPE_F32);
+
+    auto noop = [](cudaStream_t, const cvcuda::GraphNodeArgs &) {};
+    graph.addNode({in}, {a}, noop);
+    graph.addNode({a}, {b}, noop);
+    graph.addNode({b}, {c}, noop);
+    graph.addNode({c}, {out}, noop);
+
+    const cvcuda::MemoryPlan &plan = graph.plan(8);
+    ASSERT_EQ(plan.offsets.size(), 3u + 4u); // 3 intermediate tensors and one workspace per node
+    EXPECT_EQ(plan.offsets[0], plan.offsets[2]);
+    EXPECT_EQ(plan.arenaSize, 8u * (1024 + 256) * sizeof(float));
+    EXPECT_EQ(plan.unaliasedSize, 8u * (1024 + 256 + 512) * sizeof(float));
+}
+
+TEST(GraphTest_Negative, invalid_graphs)
+{
+    auto noop = [](cudaStream_t, const cvcuda::GraphNodeArgs &) {};
+
+    {
+        cvcuda::Graph           graph;
+        cvcuda::Graph::TensorId in = graph.addInput();
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { graph.addNode({in}, {7}, noop); }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { graph.addNode({in}, {in}, noop); }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { graph.addNode({in}, {}, {}); }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+                  nvcv::ProtectCall([&] { graph.addTensor({-2, 4}, nvcv::TensorLayout{"NW"}, nvcv::TYPE_U8); }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+                  nvcv::ProtectCall([&] { graph.addTensor({1, 4}, nvcv::TENSOR_NHWC, nvcv::TYPE_U8); }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { graph.plan(0); }));
+    }
+    {
+        // intermediate tensor read before being written
+        cvcuda::Graph           graph;
+        cvcuda::Graph::TensorId t = graph.addTensor({4}, nvcv::TensorLayout{"W"}, nvcv::TYPE_U8);
+        graph.addNode({t}, {}, noop);
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { graph.plan(1); }));
+    }
+    {
+        cvcuda::Graph graph;
+        graph.addInput();
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { graph.run(nullptr, 1, {}, {}); }));
+    }
+}
@@ -0,0 +1,361 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpAdaptiveHistogramEq.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+namespace util = nvcv::util;
+
+// Gold (CPU reference) of the adaptive histogram equalization of one sample image, the state holds the per-tile
+// look-up tables [C][tilesY][tilesX][256] of the sample and is updated in-place
+
+static int GoldTileBegin(int t, int numTiles, int size)
+{
+    return static_cast<int>((static_cast<int64_t>(t) * size + numTiles - 1) / numTiles);
+}
+
+static void GoldAdaptiveHistogramEq(const std::vector<uint8_t> &in, std::vector<uint8_t> &out, int width, int height,
+                                    int numChannels, int2 tiles, float clipLimit, float alpha, bool init,
+                                    std::vector<float> &state)
+{
+    state.resize(static_cast<size_t>(numChannels) * tiles.y * tiles.x * 256);
+    out.resize(in.size());
+
+    for (int c = 0; c < numChannels; ++c)
+    {
+        for (int ty = 0; ty < tiles.y; ++ty)
+        {
+            for (int tx = 0; tx < tiles.x; ++tx)
+            {
+                int x0 = GoldTileBegin(tx, tiles.x, width), x1 = GoldTileBegin(tx + 1, tiles.x, width);
+                int y0 = GoldTileBegin(ty, tiles.y, height), y1 = GoldTileBegin(ty + 1, tiles.y, height);
+
+                int tilePixels = (x1 - x0) * (y1 - y0);
+
+                std::array<int, 256> hist{};
+
+                for (int y = y0; y < y1; ++y)
+                    for (int x = x0; x < x1; ++x) hist[in[(y * width + x) * numChannels + c]]++;
+
+                if (clipLimit > 0.f)
+                {
+                    int limit  = std::max(static_cast<int>(clipLimit * tilePixels / 256), 1);
+                    int excess = 0;
+
+                    for (int &h : hist)
+                    {
+                        excess += std::max(h - limit, 0);
+                        h = std::min(h, limit);
+                    }
+
+                    int redistBatch = excess / 256;
+                    int residual    = excess - redistBatch * 256;
+
+                    for (int &h : hist) h += redistBatch;
+
+                    if (residual > 0)
+                    {
+                        int residualStep = std::max(256 / residual, 1);
+                        for (int b = 0; b < 256 && residual > 0; b += residualStep, residual--) hist[b]++;
+                    }
+                }
+
+                float *lut = &state[((c * tiles.y + ty) * tiles.x + tx) * 256];
+                int    cdf = 0;
+
+                for (int b = 0; b < 256; ++b)
+                {
+                    cdf += hist[b];
+                    float v = cdf * (255.f / tilePixels);
+                    lut[b]  = init ? v : alpha * v + (1.f - alpha) * lut[b];
+                }
+            }
+        }
+    }
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            float txf = (x + .5f) * tiles.x / width - .5f;
+            float tyf = (y + .5f) * tiles.y / height - .5f;
+
+            int   tx1 = static_cast<int>(std::floor(txf)), ty1 = static_cast<int>(std::floor(tyf));
+            float xa = txf - tx1, ya = tyf - ty1;
+            int   tx2 = std::min(tx1 + 1, tiles.x - 1), ty2 = std::min(ty1 + 1, tiles.y - 1);
+
+            tx1 = std::max(tx1, 0);
+            ty1 = std::max(ty1, 0);
+
+            for (int c = 0; c < numChannels; ++c)
+            {
+                int          v    = in[(y * width + x) * numChannels + c];
+                const float *luts = &state[c * tiles.y * tiles.x * 256];
+
+                float v11 = luts[(ty1 * tiles.x + tx1) * 256 + v];
+                float v12 = luts[(ty1 * tiles.x + tx2) * 256 + v];
+                float v21 = luts[(ty2 * tiles.x + tx1) * 256 + v];
+                float v22 = luts[(ty2 * tiles.x + tx2) * 256 + v];
+
+                float res = (v11 * (1.f - xa) + v12 * xa) * (1.f - ya) + (v21 * (1.f - xa) + v22 * xa) * ya;
+
+                out[(y * width + x) * numChannels + c] = static_cast<uint8_t>(std::clamp(std::lround(res), 0L, 255L));
+            }
+        }
+    }
+}
+
+// Compares allowing off-by-one differences, due to floating-point rounding of values exactly between two integers
+static void ExpectNearImage(const std::vector<uint8_t> &test, const std::vector<uint8_t> &gold)
+{
+    ASSERT_EQ(test.size(), gold.size());
+    for (size_t i = 0; i < test.size(); ++i)
+    {
+        ASSERT_LE(std::abs(static_cast<int>(test[i]) - static_cast<int>(gold[i])), 1) << "At index " << i;
+    }
+}
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpAdaptiveHistogramEq, test::ValueList<int, int, NVCVImageFormat, int, int, int, float, float>
+{
+    //inWidth, inHeight,                 format, numberInBatch, tilesX, tilesY, clipLimit, temporalAlpha
+    {      20,      428,     NVCV_IMAGE_FORMAT_U8,           1,      1,      1,        0.f,           1.f},
+    {     101,       99,     NVCV_IMAGE_FORMAT_U8,           3,      8,      8,        2.f,           1.f},
+    {     256,      256,   NVCV_IMAGE_FORMAT_RGB8,           1,      4,      4,        4.f,          0.5f},
+    {      12,      512,  NVCV_IMAGE_FORMAT_BGRA8,           2,      3,     16,        0.f,          0.2f},
+    {     640,      480,     NVCV_IMAGE_FORMAT_U8,           2,      8,      6,       40.f,          0.1f},
+    {      10,        7,   NVCV_IMAGE_FORMAT_RGB8,           4,     10,      7,        1.f,          0.7f},
+});
+
+// clang-format on
+
+TEST_P(OpAdaptiveHistogramEq, correct_output_over_frames)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width  = GetParamValue<0>();
+    int               height = GetParamValue<1>();
+    nvcv::ImageFormat format{GetParamValue<2>()};
+    int               batches = GetParamValue<3>();
+    int2              tiles{GetParamValue<4>(), GetParamValue<5>()};
+    float             clipLimit = GetParamValue<6>();
+    float             alpha     = GetParamValue<7>();
+
+    nvcv::Tensor inTensor  = nvcv::util::CreateTensor(batches, width, height, format);
+    nvcv::Tensor outTensor = nvcv::util::CreateTensor(batches, width, height, format);
+
+    int    numChannels    = format.numChannels();
+    size_t imageSizeBytes = width * height * numChannels;
+
+    std::default_random_engine         randEng(0);
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    std::vector<std::vector<float>> goldState(batches);
+
+    cvcuda::AdaptiveHistogramEq op;
+
+    // A sequence of frames where each one is a brightness shifted version of the previous one, the last frame
+    // resets the state
+    constexpr int kNumFrames = 4;
+
+    std::vector<std::vector<uint8_t>> inImages(batches, std::vector<uint8_t>(imageSizeBytes));
+
+    for (int frame = 0; frame < kNumFrames; ++frame)
+    {
+        bool reset = frame == kNumFrames - 1;
+
+        for (int i = 0; i < batches; ++i)
+        {
+            if (frame == 0)
+            {
+                std::generate(inImages[i].begin(), inImages[i].end(), [&]() { return rand(randEng) / 2; });
+            }
+            else
+            {
+                std::transform(inImages[i].begin(), inImages[i].end(), inImages[i].begin(),
+                               [](uint8_t v) { return static_cast<uint8_t>(std::min(v + 20, 255)); });
+            }
+            ASSERT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inTensor.exportData(), inImages[i], i));
+        }
+
+        EXPECT_NO_THROW(op(stream, inTensor, outTensor, NVCVSize2D{tiles.x, tiles.y}, clipLimit, alpha, reset));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        for (int i = 0; i < batches; ++i)
+        {
+            std::vector<uint8_t> outImage, goldImage;
+
+            GoldAdaptiveHistogramEq(inImages[i], goldImage, width, height, numChannels, tiles, clipLimit, alpha,
+                                    frame == 0 || reset, goldState[i]);
+
+            ASSERT_NO_THROW(util::GetImageVectorFromTensor(outTensor.exportData(), i, outImage));
+            ExpectNearImage(outImage, goldImage);
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpAdaptiveHistogramEq, independent_state_per_stream)
+{
+    int width = 64, height = 48;
+
+    cudaStream_t stream1, stream2;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream2));
+
+    nvcv::Tensor inTensor   = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+    nvcv::Tensor outTensor1 = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+    nvcv::Tensor outTensor2 = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+
+    std::default_random_engine         randEng(0);
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    std::vector<uint8_t> dark(width * height), bright(width * height);
+    std::generate(dark.begin(), dark.end(), [&]() { return rand(randEng) / 4; });
+    std::transform(dark.begin(), dark.end(), bright.begin(), [](uint8_t v) { return static_cast<uint8_t>(v + 160); });
+
+    cvcuda::AdaptiveHistogramEq op;
+
+    // Stream 1 sees a dark frame then a bright one, stream 2 only sees the bright one: their outputs must differ
+    // as the state of stream 1 remembers the dark frame, while stream 2 starts from a fresh state
+    ASSERT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inTensor.exportData(), dark, 0));
+    EXPECT_NO_THROW(op(stream1, inTensor, outTensor1, NVCVSize2D{2, 2}, 0.f, 0.5f));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream1));
+
+    ASSERT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inTensor.exportData(), bright, 0));
+    EXPECT_NO_THROW(op(stream1, inTensor, outTensor1, NVCVSize2D{2, 2}, 0.f, 0.5f));
+    EXPECT_NO_THROW(op(stream2, inTensor, outTensor2, NVCVSize2D{2, 2}, 0.f, 0.5f));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream2));
+
+    std::vector<float>   goldState1, goldState2;
+    std::vector<uint8_t> goldImage1, goldImage2, outImage1, outImage2;
+
+    GoldAdaptiveHistogramEq(dark, goldImage1, width, height, 1, int2{2, 2}, 0.f, 0.5f, true, goldState1);
+    GoldAdaptiveHistogramEq(bright, goldImage1, width, height, 1, int2{2, 2}, 0.f, 0.5f, false, goldState1);
+    GoldAdaptiveHistogramEq(bright, goldImage2, width, height, 1, int2{2, 2}, 0.f, 0.5f, true, goldState2);
+
+    ASSERT_NO_THROW(util::GetImageVectorFromTensor(outTensor1.exportData(), 0, outImage1));
+    ASSERT_NO_THROW(util::GetImageVectorFromTensor(outTensor2.exportData(), 0, outImage2));
+
+    ExpectNearImage(outImage1, goldImage1);
+    ExpectNearImage(outImage2, goldImage2);
+    EXPECT_NE(outImage1, outImage2);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream2));
+}
+
+TEST(OpAdaptiveHistogramEq, new_stream_starts_from_fresh_state)
+{
+    int width = 64, height = 48;
+
+    nvcv::Tensor inTensor  = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+    nvcv::Tensor outTensor = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+
+    std::default_random_engine         randEng(0);
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    std::vector<uint8_t> dark(width * height), bright(width * height);
+    std::generate(dark.begin(), dark.end(), [&]() { return rand(randEng) / 4; });
+    std::transform(dark.begin(), dark.end(), bright.begin(), [](uint8_t v) { return static_cast<uint8_t>(v + 160); });
+
+    std::vector<float>   goldState;
+    std::vector<uint8_t> goldImage, outImage;
+    GoldAdaptiveHistogramEq(bright, goldImage, width, height, 1, int2{2, 2}, 0.f, 0.5f, true, goldState);
+
+    cvcuda::AdaptiveHistogramEq op;
+
+    // A stream whose state was released, then a stream created after the first one was destroyed, which may get
+    // the same handle: both must equalize the bright frame as if it were the first one, not blend it with the dark
+    // frame seen before
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    for (int step = 0; step < 2; ++step)
+    {
+        SCOPED_TRACE(step);
+
+        ASSERT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inTensor.exportData(), dark, 0));
+        EXPECT_NO_THROW(op(stream, inTensor, outTensor, NVCVSize2D{2, 2}, 0.f, 0.5f));
+
+        if (step == 0)
+        {
+            EXPECT_NO_THROW(op.releaseState(stream));
+        }
+        else
+        {
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+            ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+            ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+        }
+
+        ASSERT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inTensor.exportData(), bright, 0));
+        EXPECT_NO_THROW(op(stream, inTensor, outTensor, NVCVSize2D{2, 2}, 0.f, 0.5f));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        ASSERT_NO_THROW(util::GetImageVectorFromTensor(outTensor.exportData(), 0, outImage));
+        ExpectNearImage(outImage, goldImage);
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpAdaptiveHistogramEq, invalid_arguments)
+{
+    nvcv::Tensor in     = nvcv::util::CreateTensor(2, 32, 16, nvcv::FMT_U8);
+    nvcv::Tensor out    = nvcv::util::CreateTensor(2, 32, 16, nvcv::FMT_U8);
+    nvcv::Tensor outF32 = nvcv::util::CreateTensor(2, 32, 16, nvcv::FMT_F32);
+    nvcv::Tensor outBig = nvcv::util::CreateTensor(2, 33, 16, nvcv::FMT_U8);
+
+    cvcuda::AdaptiveHistogramEq op;
+
+#define NVCV_TEST_INVALID(...) \
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { op(nullptr, __VA_ARGS__); }))
+
+    NVCV_TEST_INVALID(in, outF32, NVCVSize2D{2, 2}, 0.f, 1.f);
+    NVCV_TEST_INVALID(in, outBig, NVCVSize2D{2, 2}, 0.f, 1.f);
+    NVCV_TEST_INVALID(in, out, NVCVSize2D{0, 2}, 0.f, 1.f);
+    NVCV_TEST_INVALID(in, out, NVCVSize2D{2, 17}, 0.f, 1.f);
+    NVCV_TEST_INVALID(in, out, NVCVSize2D{2, 2}, 0.f, 0.f);
+    NVCV_TEST_INVALID(in, out, NVCVSize2D{2, 2}, 0.f, 1.5f);
+
+#undef NVCV_TEST_INVALID
+}
+
+TEST(OpAdaptiveHistogramEq_Negative, create_null_handle)
+{
+    EXPECT_EQ(cvcudaAdaptiveHistogramEqCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(OpAdaptiveHistogramEq_Negative, release_state_null_handle)
+{
+    EXPECT_EQ(cvcudaAdaptiveHistogramEqReleaseState(nullptr, nullptr), NVCV_ERROR_INVALID_ARGUMENT);
+}
@@ -30,6 +30,7 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <algorithm>
 #include <random>
 
 namespace test = nvcv::test;
@@ -332,6 +333,209 @@ TEST_P(OpAdaptiveThreshold, varshape_correct_output)
     }
 }
 
+// MEAN_C with large blocks is compared against the exactly rounded window mean, the float convolution reference
+// accumulates enough error over large windows to flip the rounding of some means
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpAdaptiveThreshold_LargeBlock, test::ValueList<int, int, int, NVCVThresholdType, int, double>
+{
+    // width, height, batch,      NVCVThresholdType, blockSize,    c
+    {    320,    240,     2,     NVCV_THRESH_BINARY,        51,  3.7},
+    {    640,    360,     1, NVCV_THRESH_BINARY_INV,       101, -2.2},
+    {     97,     41,     3,     NVCV_THRESH_BINARY,       101,  0.0},
+    {   1023,     17,     2, NVCV_THRESH_BINARY_INV,       255,  1.5}
+});
+
+// clang-format on
+
+// Exact MEAN_C adaptive threshold of one sample, with replicated borders and the mean rounded to nearest
+static std::vector<uint8_t> MeanThresholdGold(const std::vector<uint8_t> &src, int width, int height, int blockSize,
+                                              double maxValue, NVCVThresholdType thresholdType, double c)
+{
+    int radius = blockSize / 2;
+    int area   = blockSize * blockSize;
+
+    auto clampX = [&](int x) { return std::clamp(x, 0, width - 1); };
+    auto clampY = [&](int y) { return std::clamp(y, 0, height - 1); };
+
+    std::vector<int64_t> rowSums(width * height, 0);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            for (int d = -radius; d <= radius; ++d)
+                rowSums[y * width + x] += src[y * width + clampX(x + d)];
+
+    uchar iMaxValue = cuda::SaturateCast<uchar>(maxValue);
+    int   idelta    = thresholdType == NVCV_THRESH_BINARY ? (int)std::ceil(c) : (int)std::floor(c);
+
+    std::vector<uint8_t> dst(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            int64_t sum = 0;
+            for (int d = -radius; d <= radius; ++d)
+            {
+                sum += rowSums[clampY(y + d) * width + x];
+            }
+            int  mean  = static_cast<int>((sum + area / 2) / area);
+            bool above = src[y * width + x] + idelta > mean;
+
+            dst[y * width + x] = (thresholdType == NVCV_THRESH_BINARY) == above ? iMaxValue : 0;
+        }
+    }
+    return dst;
+}
+
+TEST_P(OpAdaptiveThreshold_LargeBlock, correct_output)
+{
+    int               width         = GetParamValue<0>();
+    int               height        = GetParamValue<1>();
+    int               batch         = GetParamValue<2>();
+    NVCVThresholdType thresholdType = GetParamValue<3>();
+    int               blockSize     = GetParamValue<4>();
+    double            c             = GetParamValue<5>();
+    double            maxValue      = 255.0;
+
+    nvcv::Tensor imgIn  = nvcv::util::CreateTensor(batch, width, height, nvcv::FMT_U8);
+    nvcv::Tensor imgOut = nvcv::util::CreateTensor(batch, width, height, nvcv::FMT_U8);
+
+    auto inData = imgIn.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, inData);
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    ASSERT_TRUE(inAccess);
+
+    auto outData = imgOut.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, outData);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*outData);
+    ASSERT_TRUE(outAccess);
+
+    // Smooth gradient plus noise, so that many pixels are close to their window mean
+    std::vector<std::vector<uint8_t>>  srcVec(batch);
+    std::default_random_engine         randEng;
+    std::uniform_int_distribution<int> rand(-20, 20);
+
+    for (int i = 0; i < batch; i++)
+    {
+        srcVec[i].resize(width * height);
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                srcVec[i][y * width + x] = cuda::SaturateCast<uchar>((x + y + 40 * i) % 200 + rand(randEng));
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(inAccess->sampleData(i), inAccess->rowStride(), srcVec[i].data(), width,
+                                            width, height, cudaMemcpyHostToDevice));
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::AdaptiveThreshold adaptiveThresholdOp(blockSize, 1);
+
+    EXPECT_NO_THROW(adaptiveThresholdOp(stream, imgIn, imgOut, maxValue, NVCV_ADAPTIVE_THRESH_MEAN_C, thresholdType,
+                                        blockSize, c));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < batch; i++)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(width * height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), width, outAccess->sampleData(i), outAccess->rowStride(),
+                                            width, height, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(testVec, MeanThresholdGold(srcVec[i], width, height, blockSize, maxValue, thresholdType, c));
+    }
+}
+
+TEST_P(OpAdaptiveThreshold_LargeBlock, varshape_correct_output)
+{
+    int               width         = GetParamValue<0>();
+    int               height        = GetParamValue<1>();
+    int               batch         = GetParamValue<2>();
+    NVCVThresholdType thresholdType = GetParamValue<3>();
+    int               maxBlockSize  = GetParamValue<4>();
+    double            c             = GetParamValue<5>();
+    double            maxValue      = 200.0;
+
+    // Images of different sizes with different block sizes, down to the small blocks of the direct path
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udistWidth(width * 0.8, width * 1.1);
+    std::uniform_int_distribution<int> udistHeight(height * 0.8, height * 1.1);
+    std::uniform_int_distribution<int> udistValue(0, 255);
+
+    std::vector<nvcv::Image>          imgSrc, imgDst;
+    std::vector<std::vector<uint8_t>> srcVec(batch);
+    std::vector<int>                  blockSizes(batch);
+
+    for (int i = 0; i < batch; ++i)
+    {
+        blockSizes[i] = std::max(3, (maxBlockSize >> i) | 1);
+
+        imgSrc.emplace_back(nvcv::Size2D{udistWidth(rng), udistHeight(rng)}, nvcv::FMT_U8);
+        imgDst.emplace_back(imgSrc[i].size(), nvcv::FMT_U8);
+
+        int w = imgSrc[i].size().w, h = imgSrc[i].size().h;
+
+        srcVec[i].resize(w * h);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udistValue(rng); });
+
+        auto imgData = imgSrc[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(imgData, nvcv::NullOpt);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(),
+                                            w, w, h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(batch), batchDst(batch);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    nvcv::Tensor maxValueTensor({{batch}, "N"}, nvcv::TYPE_F64);
+    nvcv::Tensor blockSizeTensor({{batch}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor cTensor({{batch}, "N"}, nvcv::TYPE_F64);
+
+    std::vector<double> maxValueVec(batch, maxValue), cVec(batch, c);
+
+    auto copyParam = [&](const nvcv::Tensor &tensor, const void *data, size_t size)
+    {
+        auto dev = tensor.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(dev, nullptr);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(dev->basePtr(), data, size, cudaMemcpyHostToDevice));
+    };
+    copyParam(maxValueTensor, maxValueVec.data(), batch * sizeof(double));
+    copyParam(blockSizeTensor, blockSizes.data(), batch * sizeof(int));
+    copyParam(cTensor, cVec.data(), batch * sizeof(double));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::AdaptiveThreshold adaptiveThresholdOp(maxBlockSize, batch);
+
+    EXPECT_NO_THROW(adaptiveThresholdOp(stream, batchSrc, batchDst, maxValueTensor, NVCV_ADAPTIVE_THRESH_MEAN_C,
+                                        thresholdType, blockSizeTensor, cTensor));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < batch; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        int w = imgSrc[i].size().w, h = imgSrc[i].size().h;
+
+        auto dstData = imgDst[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(dstData, nvcv::NullOpt);
+
+        std::vector<uint8_t> testVec(w * h);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), w, dstData->plane(0).basePtr, dstData->plane(0).rowStride,
+                                            w, h, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(testVec, MeanThresholdGold(srcVec[i], w, h, blockSizes[i], maxValue, thresholdType, c));
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpAdaptiveThresholdVarshape_Negative, test::ValueList<NVCVStatus, nvcv::ImageFormat, nvcv::ImageFormat, int, NVCVAdaptiveThresholdType, NVCVThresholdType>{
     {NVCV_ERROR_INVALID_ARGUMENT, nvcv::FMT_U8, nvcv::FMT_U8, 6, NVCV_ADAPTIVE_THRESH_MEAN_C, NVCV_THRESH_BINARY}, // exceed max batch size
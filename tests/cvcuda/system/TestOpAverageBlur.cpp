@@ -42,7 +42,12 @@ NVCV_TEST_SUITE_P(OpAverageBlur, test::ValueList<int, int, int, NVCVImageFormat,
     {    123,     33,       3,    NVCV_IMAGE_FORMAT_RGB8,      3,      3,        2,        2, NVCV_BORDER_WRAP},
     {     42,     53,       4,   NVCV_IMAGE_FORMAT_RGBA8,      7,      7,        5,        5, NVCV_BORDER_REPLICATE},
     {     13,     42,       3,    NVCV_IMAGE_FORMAT_RGB8,      3,      3,        1,        1, NVCV_BORDER_REFLECT},
-    {     62,    111,       4,   NVCV_IMAGE_FORMAT_RGBA8,      9,      9,        8,        8, NVCV_BORDER_REFLECT101}
+    {     62,    111,       4,   NVCV_IMAGE_FORMAT_RGBA8,      9,      9,        8,        8, NVCV_BORDER_REFLECT101},
+    {    150,     97,       2,      NVCV_IMAGE_FORMAT_U8,     21,     21,       -1,       -1, NVCV_BORDER_CONSTANT},
+    {     83,    121,       2,    NVCV_IMAGE_FORMAT_RGB8,     41,     11,        3,        9, NVCV_BORDER_REFLECT101},
+    {     64,     47,       3,   NVCV_IMAGE_FORMAT_RGBA8,     13,     25,       12,        0, NVCV_BORDER_WRAP},
+    {     52,     71,       1,    NVCV_IMAGE_FORMAT_RGB8,     17,     17,       -1,       -1, NVCV_BORDER_REPLICATE},
+    {     40,     35,       2,      NVCV_IMAGE_FORMAT_U8,     11,     15,        4,       10, NVCV_BORDER_REFLECT}
 });
 
 // clang-format on
@@ -130,7 +135,7 @@ TEST_P(OpAverageBlur, correct_output)
     test::Convolve(goldVec, outStrides, inVec, inStrides, shape, format, kernel, kernelSize, kernelAnchor, borderMode,
                    borderValue);
 
-    EXPECT_EQ(testVec, goldVec);
+    test::ExpectMatchesGold(testVec, goldVec, kernelSize);
 }
 
 TEST_P(OpAverageBlur, varshape_correct_output)
@@ -0,0 +1,327 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/TypedTests.hpp>
+#include <cvcuda/OpBuildPyramid.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorBatch.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+namespace type = nvcv::test::type;
+
+using RawLayerType = std::vector<float>; // one NHW layer of a pyramid level
+
+static std::default_random_engine g_rng(0); // seed 0 to fix pseudo-randomness
+
+// --------------------- Gold (reference) definitions --------------------------
+
+inline int Reflect101(int i, int size)
+{
+    while (i < 0 || i >= size)
+    {
+        i = (i < 0) ? -i : 2 * size - 2 - i;
+    }
+    return i;
+}
+
+inline float &At(RawLayerType &layer, int3 shape, int x, int y, int z)
+{
+    return layer[(z * shape.y + y) * shape.x + x];
+}
+
+inline float At(const RawLayerType &layer, int3 shape, int x, int y, int z)
+{
+    return layer[(z * shape.y + y) * shape.x + x];
+}
+
+// Separable Gaussian filter with the same kernel size and weights as the operator, reflect-101 border
+inline RawLayerType GoldGaussian(const RawLayerType &src, int3 shape, float sigma)
+{
+    int half = std::min((int)std::round(sigma * 8 + 1) | 1, 59) / 2;
+
+    std::vector<float> kernel(half * 2 + 1);
+    float              sum = 0.f;
+
+    for (int k = -half; k <= half; ++k)
+    {
+        kernel[half + k] = std::exp(-(k * k) / (sigma * sigma * 2)) / (sigma * std::sqrt(M_PI * 2));
+        sum += kernel[half + k];
+    }
+    for (float &w : kernel)
+    {
+        w /= sum;
+    }
+
+    RawLayerType tmp(src.size()), dst(src.size());
+
+    for (int z = 0; z < shape.z; ++z)
+        for (int y = 0; y < shape.y; ++y)
+            for (int x = 0; x < shape.x; ++x)
+            {
+                float res = 0.f;
+                for (int k = -half; k <= half; ++k)
+                    res += At(src, shape, Reflect101(x + k, shape.x), y, z) * kernel[half + k];
+                At(tmp, shape, x, y, z) = res;
+            }
+
+    for (int z = 0; z < shape.z; ++z)
+        for (int y = 0; y < shape.y; ++y)
+            for (int x = 0; x < shape.x; ++x)
+            {
+                float res = 0.f;
+                for (int k = -half; k <= half; ++k)
+                    res += At(tmp, shape, x, Reflect101(y + k, shape.y), z) * kernel[half + k];
+                At(dst, shape, x, y, z) = res;
+            }
+
+    return dst;
+}
+
+// Base image: input converted to float, bilinear 2x upscaled with replicate border if expanded
+inline RawLayerType GoldBase(const std::vector<uint8_t> &src, int3 srcShape, bool expandInput)
+{
+    if (!expandInput)
+    {
+        return RawLayerType(src.begin(), src.end());
+    }
+
+    int3         dstShape{srcShape.x * 2, srcShape.y * 2, srcShape.z};
+    RawLayerType dst(dstShape.x * dstShape.y * dstShape.z);
+
+    auto srcAt = [&](int x, int y, int z)
+    {
+        x = std::clamp(x, 0, srcShape.x - 1);
+        y = std::clamp(y, 0, srcShape.y - 1);
+        return (float)src[(z * srcShape.y + y) * srcShape.x + x];
+    };
+
+    for (int z = 0; z < dstShape.z; ++z)
+        for (int y = 0; y < dstShape.y; ++y)
+            for (int x = 0; x < dstShape.x; ++x)
+            {
+                float sx = (x + .5f) * .5f - .5f, sy = (y + .5f) * .5f - .5f;
+                int   x0 = std::floor(sx), y0 = std::floor(sy);
+                float ax = sx - x0, ay = sy - y0;
+
+                At(dst, dstShape, x, y, z)
+                    = (srcAt(x0, y0, z) * (1 - ax) + srcAt(x0 + 1, y0, z) * ax) * (1 - ay)
+                    + (srcAt(x0, y0 + 1, z) * (1 - ax) + srcAt(x0 + 1, y0 + 1, z) * ax) * ay;
+            }
+
+    return dst;
+}
+
+// Gold pyramid as levels of layers, following the SIFT scale-space construction
+inline std::vector<std::vector<RawLayerType>> GoldBuildPyramid(const std::vector<uint8_t> &src, int3 srcShape,
+                                                               int numLevels, int numScales, float initSigma,
+                                                               bool expandInput)
+{
+    std::vector<std::vector<RawLayerType>> pyramid(numLevels, std::vector<RawLayerType>(numScales + 3));
+
+    int3  shape = expandInput ? int3{srcShape.x * 2, srcShape.y * 2, srcShape.z} : srcShape;
+    float k     = std::pow(2.f, 1.f / numScales);
+
+    for (int level = 0; level < numLevels; ++level)
+    {
+        if (level == 0)
+        {
+            float sigma = std::sqrt(std::max(initSigma * initSigma - .25f * (expandInput ? 4 : 1), .01f));
+
+            pyramid[0][0] = GoldGaussian(GoldBase(src, srcShape, expandInput), shape, sigma);
+        }
+        else
+        {
+            int3 prevShape = shape;
+            shape          = int3{prevShape.x / 2, prevShape.y / 2, prevShape.z};
+
+            pyramid[level][0].resize(shape.x * shape.y * shape.z);
+
+            for (int z = 0; z < shape.z; ++z)
+                for (int y = 0; y < shape.y; ++y)
+                    for (int x = 0; x < shape.x; ++x)
+                        At(pyramid[level][0], shape, x, y, z)
+                            = At(pyramid[level - 1][numScales], prevShape, x * 2, y * 2, z);
+        }
+
+        for (int layer = 1; layer < numScales + 3; ++layer)
+        {
+            float prevSigma  = std::pow(k, (float)(layer - 1)) * initSigma;
+            float totalSigma = k * prevSigma;
+
+            pyramid[level][layer] = GoldGaussian(pyramid[level][layer - 1], shape,
+                                                 std::sqrt(totalSigma * totalSigma - prevSigma * prevSigma));
+        }
+    }
+
+    return pyramid;
+}
+
+// ----------------------------- Start tests -----------------------------------
+
+// clang-format off
+
+#define NVCV_SHAPE(w, h, n) (int3{w, h, n})
+
+#define NVCV_TEST_ROW(InShape, NumLevels, NumScales, InitSigma, ExpandInput)                                     \
+    type::Types<type::Value<InShape>, type::Value<NumLevels>, type::Value<NumScales>, type::Value<InitSigma>,     \
+                type::Value<ExpandInput>>
+
+NVCV_TYPED_TEST_SUITE(OpBuildPyramid, type::Types<
+    NVCV_TEST_ROW(NVCV_SHAPE(32, 24, 2), 3, 2, 1.6f, false),
+    NVCV_TEST_ROW(NVCV_SHAPE(17, 21, 1), 2, 3, 1.2f, true),
+    NVCV_TEST_ROW(NVCV_SHAPE(40, 40, 3), 1, 1, .8f, false),
+    NVCV_TEST_ROW(NVCV_SHAPE(99, 67, 1), 4, 5, 2.f, false)
+>);
+
+// clang-format on
+
+TYPED_TEST(OpBuildPyramid, correct_output)
+{
+    int3  inShape     = type::GetValue<TypeParam, 0>;
+    int   numLevels   = type::GetValue<TypeParam, 1>;
+    int   numScales   = type::GetValue<TypeParam, 2>;
+    float initSigma   = type::GetValue<TypeParam, 3>;
+    bool  expandInput = type::GetValue<TypeParam, 4>;
+
+    int3 baseShape = expandInput ? int3{inShape.x * 2, inShape.y * 2, inShape.z} : inShape;
+
+    nvcv::Tensor src = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_U8);
+
+    std::uniform_int_distribution<int> rg(0, 255);
+    std::vector<uint8_t>               srcVec(inShape.x * inShape.y * inShape.z);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return (uint8_t)rg(g_rng); });
+
+    auto srcData = src.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    for (int z = 0; z < inShape.z; ++z)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(z), srcAccess->rowStride(),
+                                            srcVec.data() + z * inShape.x * inShape.y, inShape.x, inShape.x,
+                                            inShape.y, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::TensorBatch pyramid = cvcuda::BuildPyramid::CreatePyramid(baseShape, numLevels, numScales);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::BuildPyramid op(int3{baseShape.x + 3, baseShape.y + 5, baseShape.z + 1});
+
+    NVCVPyramidInfo info;
+    EXPECT_NO_THROW(info = op(stream, src, pyramid, initSigma, expandInput));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    EXPECT_EQ(info.numLevels, numLevels);
+    EXPECT_EQ(info.numScales, numScales);
+    EXPECT_EQ(info.firstLevel, expandInput ? -1 : 0);
+    EXPECT_EQ(info.initSigma, initSigma);
+
+    auto gold = GoldBuildPyramid(srcVec, inShape, numLevels, numScales, initSigma, expandInput);
+
+    for (int level = 0; level < numLevels; ++level)
+    {
+        auto levelData = pyramid[level].exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_TRUE(levelData);
+
+        int3 shape{baseShape.x >> level, baseShape.y >> level, baseShape.z};
+
+        ASSERT_EQ(levelData->shape(0), numScales + 3);
+        ASSERT_EQ(levelData->shape(2), shape.y);
+        ASSERT_EQ(levelData->shape(3), shape.x);
+
+        for (int layer = 0; layer < numScales + 3; ++layer)
+        {
+            RawLayerType test(shape.x * shape.y * shape.z);
+
+            for (int z = 0; z < shape.z; ++z)
+            {
+                const auto *layerPtr = levelData->basePtr() + layer * levelData->stride(0) + z * levelData->stride(1);
+
+                ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data() + z * shape.x * shape.y, shape.x * sizeof(float),
+                                                    layerPtr, levelData->stride(2), shape.x * sizeof(float), shape.y,
+                                                    cudaMemcpyDeviceToHost));
+            }
+
+            for (size_t i = 0; i < test.size(); ++i)
+            {
+                ASSERT_NEAR(test[i], gold[level][layer][i], 1e-2f)
+                    << "at level " << level << " layer " << layer << " index " << i;
+            }
+        }
+    }
+}
+
+TEST(OpBuildPyramid, invalid_arguments)
+{
+    int3 inShape{32, 24, 2};
+
+    nvcv::Tensor in    = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_U8);
+    nvcv::Tensor inRGB = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_RGB8);
+    nvcv::Tensor inF32 = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_F32);
+
+    nvcv::TensorBatch pyramid          = cvcuda::BuildPyramid::CreatePyramid(inShape, 3, 2);
+    nvcv::TensorBatch pyramidNoScales  = cvcuda::BuildPyramid::CreatePyramid(inShape, 3, 0);
+    nvcv::TensorBatch pyramidExpanded  = cvcuda::BuildPyramid::CreatePyramid(int3{64, 48, 2}, 3, 2);
+    nvcv::TensorBatch pyramidWrongSize = cvcuda::BuildPyramid::CreatePyramid(int3{34, 24, 2}, 3, 2);
+    nvcv::TensorBatch pyramidEmpty(3);
+
+    cvcuda::BuildPyramid op(inShape);
+
+#define NVCV_TEST_INVALID(...) \
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { op(nullptr, __VA_ARGS__); }))
+
+    // multi-channel input and unsupported input data type
+    NVCV_TEST_INVALID(inRGB, pyramid, 1.6f, false);
+    NVCV_TEST_INVALID(inF32, pyramid, 1.6f, false);
+    // non-positive sigma
+    NVCV_TEST_INVALID(in, pyramid, 0.f, false);
+    // pyramid without levels or scales
+    NVCV_TEST_INVALID(in, pyramidEmpty, 1.6f, false);
+    NVCV_TEST_INVALID(in, pyramidNoScales, 1.6f, false);
+    // first level not matching the input shape
+    NVCV_TEST_INVALID(in, pyramidWrongSize, 1.6f, false);
+    // expanded input exceeding the maximum shape
+    NVCV_TEST_INVALID(in, pyramidExpanded, 1.6f, true);
+
+#undef NVCV_TEST_INVALID
+}
+
+TEST(OpBuildPyramid_Negative, create_null_handle)
+{
+    EXPECT_EQ(cvcudaBuildPyramidCreate(nullptr, int3{32, 32, 1}), NVCV_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(OpBuildPyramid_Negative, create_invalid_shape)
+{
+    NVCVOperatorHandle handle;
+    EXPECT_EQ(cvcudaBuildPyramidCreate(&handle, int3{1, 32, 1}), NVCV_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(cvcudaBuildPyramidCreate(&handle, int3{32, 32, 0}), NVCV_ERROR_INVALID_ARGUMENT);
+}
@@ -26,6 +26,10 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
 #include <random>
 
 namespace cuda = nvcv::cuda;
@@ -200,6 +204,201 @@ TEST_P(OpConv2D, varshape_correct_output)
     }
 }
 
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpConv2DLarge, test::ValueList<int, int, int, int, int, int, NVCVBorderType, nvcv::ImageFormat, bool>
+{
+    // width, height, numImages, kernelWidth, kernelHeight, kernelAnchor,             borderMode,            format, forceTC
+    {     80,     70,         2,          13,           13,           -1,   NVCV_BORDER_CONSTANT,   nvcv::FMT_RGBA8,   false},
+    {    123,    144,         3,          15,           15,           -1, NVCV_BORDER_REFLECT101,   nvcv::FMT_RGBA8,   false},
+    {    100,    130,         2,          31,           31,           -1,  NVCV_BORDER_REPLICATE,   nvcv::FMT_RGBA8,   false},
+    {     66,     99,         3,          31,            7,            2,    NVCV_BORDER_REFLECT,   nvcv::FMT_RGBA8,   false},
+    {     40,     50,         2,          21,           17,            3,       NVCV_BORDER_WRAP,   nvcv::FMT_RGBA8,   false},
+    {     80,     70,         2,          13,           13,           -1,   NVCV_BORDER_CONSTANT,     nvcv::FMT_U16,    true},
+    {    100,    130,         2,          31,           31,           -1,  NVCV_BORDER_REPLICATE,     nvcv::FMT_U16,    true},
+    {    123,    144,         3,          15,           15,           -1, NVCV_BORDER_REFLECT101,     nvcv::FMT_F32,    true},
+    {     66,     99,         3,          31,           17,            2,    NVCV_BORDER_REFLECT,     nvcv::FMT_F32,    true},
+    {     40,     50,         2,          21,           17,            3,       NVCV_BORDER_WRAP, nvcv::FMT_RGBAf32,    true}
+});
+
+// clang-format on
+
+// Kernels large enough for the tensor core path on devices that have it, every other image uses a kernel two taps
+// smaller to cover per-image kernel sizes.  The 16-bit and float rows force the tensor core path, where inputs that
+// are not exact in TF32 are split into a high and a low part.
+//
+// Split TF32 products are accurate to about 2^-21 relative, and summing up to 31x31 taps in another order than the
+// reference adds about sqrt(961) * 2^-24 relative to the sum of |weight * input|.  Both stay below 1e-5 of that sum,
+// while a single TF32 pass would be off by up to 2^-11.  Integer outputs differ by the final rounding only.
+TEST_P(OpConv2DLarge, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int width        = GetParamValue<0>();
+    int height       = GetParamValue<1>();
+    int numImages    = GetParamValue<2>();
+    int kernelWidth  = GetParamValue<3>();
+    int kernelHeight = GetParamValue<4>();
+    int anchorValue  = GetParamValue<5>();
+
+    NVCVBorderType    borderMode      = GetParamValue<6>();
+    nvcv::ImageFormat imageFormat     = GetParamValue<7>();
+    bool              forceTensorCore = GetParamValue<8>();
+
+    nvcv::ImageFormat kernelFormat = nvcv::FMT_F32;
+
+    float4 borderValue = cuda::SetAll<float4>(0);
+
+    const bool  isFloat   = imageFormat.dataKind() == nvcv::DataKind::FLOAT;
+    const int   elemBits  = imageFormat.planeBitsPerPixel(0) / imageFormat.numChannels();
+    const float maxInput  = isFloat ? 1000.f : (elemBits == 16 ? 65535.f : 255.f);
+    const int   pixelSize = imageFormat.planePixelStrideBytes(0);
+
+    std::default_random_engine rng;
+
+    std::uniform_int_distribution<int>    udistWidth(width * 0.8, width * 1.1);
+    std::uniform_int_distribution<int>    udistHeight(height * 0.8, height * 1.1);
+    std::uniform_int_distribution<int>    udist(0, static_cast<int>(maxInput));
+    std::uniform_real_distribution<float> fdist(0.f, maxInput);
+
+    std::vector<nvcv::Image>          imgSrc, imgDst, kernel;
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    std::vector<std::vector<float>>   kernelVec(numImages);
+    std::vector<nvcv::Size2D>         kernelSizes(numImages);
+    std::vector<float>                sumAbsWeights(numImages);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        imgSrc.emplace_back(nvcv::Size2D{udistWidth(rng), udistHeight(rng)}, imageFormat);
+        imgDst.emplace_back(imgSrc[i].size(), imageFormat);
+
+        int srcRowStride = imgSrc[i].size().w * pixelSize;
+
+        srcVec[i].resize(imgSrc[i].size().h * srcRowStride);
+        for (size_t k = 0; k < srcVec[i].size(); k += elemBits / 8)
+        {
+            if (isFloat)
+            {
+                *reinterpret_cast<float *>(&srcVec[i][k]) = fdist(rng);
+            }
+            else if (elemBits == 16)
+            {
+                *reinterpret_cast<uint16_t *>(&srcVec[i][k]) = udist(rng);
+            }
+            else
+            {
+                srcVec[i][k] = udist(rng);
+            }
+        }
+
+        auto imgData = imgSrc[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(imgData, nvcv::NullOpt);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2DAsync(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(),
+                                    srcRowStride, srcRowStride, imgSrc[i].size().h, cudaMemcpyHostToDevice, stream));
+
+        // Normalized weights keep the outputs away from saturation
+        kernelSizes[i] = nvcv::Size2D{kernelWidth - 2 * (i % 2), kernelHeight - 2 * (i % 2)};
+        kernel.emplace_back(kernelSizes[i], kernelFormat);
+
+        std::uniform_real_distribution<float> wdist(-0.5f, 1.f);
+
+        kernelVec[i].resize(kernelSizes[i].w * kernelSizes[i].h);
+        std::generate(kernelVec[i].begin(), kernelVec[i].end(), [&]() { return wdist(rng); });
+
+        float sum = std::accumulate(kernelVec[i].begin(), kernelVec[i].end(), 0.f);
+        std::transform(kernelVec[i].begin(), kernelVec[i].end(), kernelVec[i].begin(),
+                       [sum](float w) { return w / sum; });
+
+        sumAbsWeights[i] = std::accumulate(kernelVec[i].begin(), kernelVec[i].end(), 0.f,
+                                           [](float acc, float w) { return acc + std::abs(w); });
+
+        int rowStride = kernelSizes[i].w * sizeof(float);
+
+        auto data = kernel[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(data, nvcv::NullOpt);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2DAsync(data->plane(0).basePtr, data->plane(0).rowStride, kernelVec[i].data(), rowStride,
+                                    rowStride, kernelSizes[i].h, cudaMemcpyHostToDevice, stream));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages), batchDst(numImages), batchKernel(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+    batchKernel.pushBack(kernel.begin(), kernel.end());
+
+    int2         kernelAnchor{anchorValue, anchorValue};
+    nvcv::Tensor kernelAnchorTensor({{numImages}, "N"}, nvcv::TYPE_2S32);
+    {
+        auto dev = kernelAnchorTensor.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(dev, nullptr);
+
+        std::vector<int2> vec(numImages, kernelAnchor);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(dev->basePtr(), vec.data(), vec.size() * sizeof(int2),
+                                               cudaMemcpyHostToDevice, stream));
+    }
+
+    // The override is read when the operator is created, devices without TF32 mma fall back to the direct path
+    if (forceTensorCore)
+    {
+        setenv("CVCUDA_CONV2D_ALGO", "tensorcore", 1);
+    }
+    cvcuda::Conv2D conv2dOp;
+    unsetenv("CVCUDA_CONV2D_ALGO");
+
+    EXPECT_NO_THROW(conv2dOp(stream, batchSrc, batchDst, batchKernel, kernelAnchorTensor, borderMode));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto dstData = imgDst[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_EQ(dstData->numPlanes(), 1);
+
+        int rowStride = imgSrc[i].size().w * pixelSize;
+
+        int3  shape{imgSrc[i].size().w, imgSrc[i].size().h, 1};
+        long3 pitches{shape.y * rowStride, rowStride, pixelSize};
+
+        std::vector<uint8_t> testVec(shape.y * pitches.y);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, rowStride, shape.y, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(shape.y * pitches.y);
+        int2                 anchor = kernelAnchor;
+        test::Convolve(goldVec, pitches, srcVec[i], pitches, shape, imageFormat, kernelVec[i], kernelSizes[i], anchor,
+                       borderMode, borderValue);
+
+        const float tolerance = isFloat ? 1e-5f * sumAbsWeights[i] * maxInput : 1.f;
+
+        for (size_t k = 0; k < testVec.size(); k += elemBits / 8)
+        {
+            float testValue, goldValue;
+            if (isFloat)
+            {
+                testValue = *reinterpret_cast<const float *>(&testVec[k]);
+                goldValue = *reinterpret_cast<const float *>(&goldVec[k]);
+            }
+            else if (elemBits == 16)
+            {
+                testValue = *reinterpret_cast<const uint16_t *>(&testVec[k]);
+                goldValue = *reinterpret_cast<const uint16_t *>(&goldVec[k]);
+            }
+            else
+            {
+                testValue = testVec[k];
+                goldValue = goldVec[k];
+            }
+            ASSERT_NEAR(testValue, goldValue, tolerance) << "at byte " << k;
+        }
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpConv2D_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat, NVCVBorderType>{
     {nvcv::FMT_RGB8, nvcv::FMT_RGB8p, NVCV_BORDER_CONSTANT},
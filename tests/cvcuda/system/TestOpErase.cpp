@@ -160,6 +160,68 @@ TEST_P(OpErase, correct_output)
     EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
 
+TEST(OpErase, area_clipped_to_image)
+{
+    constexpr int width = 32, height = 16;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor imgIn  = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+    nvcv::Tensor imgOut = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_U8);
+
+    std::vector<uint8_t> zeros(width * height, 0);
+    nvcv::util::SetImageTensorFromVector<uint8_t>(imgIn.exportData(), zeros, 0);
+
+    // A single area starting inside the image and extending well past its right and bottom borders
+    nvcv::Tensor anchor({{1}, "N"}, nvcv::TYPE_2S32);
+    nvcv::Tensor erasing({{1}, "N"}, nvcv::TYPE_3S32);
+    nvcv::Tensor values({{1}, "N"}, nvcv::TYPE_F32);
+    nvcv::Tensor imgIdx({{1}, "N"}, nvcv::TYPE_S32);
+
+    int2  anchorVal  = {24, 10};
+    int3  erasingVal = {1000, 1000, 0x1};
+    float valuesVal  = 7.f;
+    int   imgIdxVal  = 0;
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(anchor.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), &anchorVal,
+                                      sizeof(int2), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(erasing.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), &erasingVal,
+                                      sizeof(int3), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(values.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), &valuesVal,
+                                      sizeof(float), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(imgIdx.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), &imgIdxVal,
+                                      sizeof(int), cudaMemcpyHostToDevice));
+
+    cvcuda::Erase eraseOp(1);
+    EXPECT_NO_THROW(eraseOp(stream, imgIn, imgOut, anchor, erasing, values, imgIdx, false, 0));
+
+    std::vector<uint8_t> test;
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    nvcv::util::GetImageVectorFromTensor(imgOut.exportData(), 0, test);
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            uint8_t gold = (x >= anchorVal.x && y >= anchorVal.y) ? 7 : 0;
+            ASSERT_EQ(gold, test[y * width + x]) << "at x=" << x << " y=" << y;
+        }
+    }
+
+    // Random filling only depends on the seed and the pixel within the area
+    std::vector<uint8_t> random0, random1;
+    EXPECT_NO_THROW(eraseOp(stream, imgIn, imgOut, anchor, erasing, values, imgIdx, true, 42));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    nvcv::util::GetImageVectorFromTensor(imgOut.exportData(), 0, random0);
+    EXPECT_NO_THROW(eraseOp(stream, imgIn, imgOut, anchor, erasing, values, imgIdx, true, 42));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    nvcv::util::GetImageVectorFromTensor(imgOut.exportData(), 0, random1);
+    EXPECT_EQ(random0, random1);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST(OpErase, OpErase_Varshape)
 {
     cudaStream_t stream;
@@ -29,6 +29,7 @@
 #include <nvcv/TensorDataAccess.hpp>
 
 #include <random>
+#include <thread>
 
 namespace test = nvcv::test;
 namespace cuda = nvcv::cuda;
@@ -45,7 +46,12 @@ NVCV_TEST_SUITE_P(OpGaussian, test::ValueList<int, int, int, NVCVImageFormat, in
     {     42,     53,       4,   NVCV_IMAGE_FORMAT_RGBA8,      7,      7,    0.4,    0.4, NVCV_BORDER_REPLICATE},
     {     13,     42,       3,    NVCV_IMAGE_FORMAT_RGB8,      3,      3,    0.9,    0.9, NVCV_BORDER_REFLECT},
     {     62,    111,       4,   NVCV_IMAGE_FORMAT_RGBA8,      9,      9,    0.8,    0.8, NVCV_BORDER_REFLECT101},
-    {    128,    128,       1,      NVCV_IMAGE_FORMAT_U8,     -1,     -1,    0.5,    0.5, NVCV_BORDER_CONSTANT}
+    {    128,    128,       1,      NVCV_IMAGE_FORMAT_U8,     -1,     -1,    0.5,    0.5, NVCV_BORDER_CONSTANT},
+    {    150,     97,       2,      NVCV_IMAGE_FORMAT_U8,     21,     21,    3.5,    3.5, NVCV_BORDER_CONSTANT},
+    {     83,    121,       2,    NVCV_IMAGE_FORMAT_RGB8,     31,     11,    5.0,    2.0, NVCV_BORDER_REFLECT101},
+    {     64,     47,       3,   NVCV_IMAGE_FORMAT_RGBA8,     13,     25,    2.0,    4.0, NVCV_BORDER_WRAP},
+    {     52,     71,       1,    NVCV_IMAGE_FORMAT_RGB8,     17,     17,    3.0,    3.0, NVCV_BORDER_REFLECT},
+    {    128,    128,       1,      NVCV_IMAGE_FORMAT_U8,     -1,     -1,    4.0,    4.0, NVCV_BORDER_REPLICATE}
 });
 
 // clang-format on
@@ -149,7 +155,109 @@ TEST_P(OpGaussian, correct_output)
     test::Convolve(goldVec, outStrides, inVec, inStrides, shape, format, kernel, newKernelSize, kernelAnchor,
                    borderMode, borderValue);
 
-    EXPECT_EQ(testVec, goldVec);
+    test::ExpectMatchesGold(testVec, goldVec, newKernelSize);
+}
+
+TEST(OpGaussian, concurrent_submit_from_threads)
+{
+    // One operator instance shared by all threads, each one submitting with its own kernel on its own stream
+    constexpr int kNumThreads = 32;
+    constexpr int kNumIters   = 4;
+
+    int               width = 97, height = 61, batches = 2;
+    nvcv::ImageFormat format{NVCV_IMAGE_FORMAT_U8};
+    int3              shape{width, height, batches};
+    nvcv::Size2D      maxKernelSize{15, 15};
+    NVCVBorderType    borderMode = NVCV_BORDER_REFLECT101;
+
+    cvcuda::Gaussian gaussianOp(maxKernelSize, batches);
+
+    nvcv::Tensor inTensor = nvcv::util::CreateTensor(batches, width, height, format);
+
+    auto inData = inTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(inData, nullptr);
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    ASSERT_TRUE(inAccess);
+
+    long3 strides{inAccess->sampleStride(), inAccess->rowStride(), inAccess->colStride()};
+    long  bufSize = strides.x * inAccess->numSamples();
+
+    std::vector<uint8_t> inVec(bufSize);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), bufSize, cudaMemcpyHostToDevice));
+
+    std::vector<nvcv::Tensor>         outTensors;
+    std::vector<std::vector<uint8_t>> testVecs(kNumThreads);
+    std::vector<std::string>          errors(kNumThreads);
+
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        outTensors.push_back(nvcv::util::CreateTensor(batches, width, height, format));
+        ASSERT_EQ(outTensors.back().exportData<nvcv::TensorDataStridedCuda>()->stride(0), strides.x);
+    }
+
+    auto check = [](cudaError_t err)
+    {
+        if (err != cudaSuccess)
+        {
+            throw std::runtime_error(cudaGetErrorString(err));
+        }
+    };
+
+    auto kernelSizeOf = [](int t) { return nvcv::Size2D{3 + 2 * (t % 7), 3 + 2 * ((t / 7) % 7)}; };
+    auto sigmaOf      = [](int t) { return double2{0.4 + 0.1 * t, 0.3 + 0.05 * t}; };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                try
+                {
+                    cudaStream_t stream;
+                    check(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+                    for (int i = 0; i < kNumIters; ++i)
+                    {
+                        gaussianOp(stream, inTensor, outTensors[t], kernelSizeOf(t), sigmaOf(t), borderMode);
+                    }
+                    check(cudaStreamSynchronize(stream));
+                    check(cudaStreamDestroy(stream));
+
+                    auto outData = outTensors[t].exportData<nvcv::TensorDataStridedCuda>();
+                    testVecs[t].resize(bufSize);
+                    check(cudaMemcpy(testVecs[t].data(), outData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+                }
+                catch (const std::exception &e)
+                {
+                    errors[t] = e.what();
+                }
+            });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        ASSERT_EQ(errors[t], "") << "thread " << t;
+
+        std::vector<uint8_t> goldVec(bufSize);
+        std::vector<float>   kernel       = test::ComputeGaussianKernel(kernelSizeOf(t), sigmaOf(t));
+        int2                 kernelAnchor = {-1, -1};
+
+        test::Convolve(goldVec, strides, inVec, strides, shape, format, kernel, kernelSizeOf(t), kernelAnchor,
+                       borderMode, cuda::SetAll<float4>(0));
+
+        SCOPED_TRACE("thread " + std::to_string(t));
+        test::ExpectMatchesGold(testVecs[t], goldVec, kernelSizeOf(t));
+    }
 }
 
 TEST_P(OpGaussian, varshape_correct_output)
@@ -241,6 +241,63 @@ TEST_P(OpGaussianNoise, tensor_correct_output_float)
     tensor_correct_output_test<float>(batch, height, width, mu, sigma, per_channel);
 }
 
+TEST(OpGaussianNoise, noise_independent_of_batch_and_new_per_call)
+{
+    // The first sample of a batch of 3 gets the same noise as a batch of 1, successive calls give new noise and a new
+    // operator with the same seed reproduces the calls of the first one
+    int width = 67, height = 45;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor in3  = nvcv::util::CreateTensor(3, width, height, nvcv::FMT_RGB8);
+    nvcv::Tensor out3 = nvcv::util::CreateTensor(3, width, height, nvcv::FMT_RGB8);
+    nvcv::Tensor in1  = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_RGB8);
+    nvcv::Tensor outA = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_RGB8);
+    nvcv::Tensor outB = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_RGB8);
+    nvcv::Tensor outC = nvcv::util::CreateTensor(1, width, height, nvcv::FMT_RGB8);
+
+    auto in3Access = nvcv::TensorDataAccessStridedImagePlanar::Create(*in3.exportData<nvcv::TensorDataStridedCuda>());
+    auto in1Access = nvcv::TensorDataAccessStridedImagePlanar::Create(*in1.exportData<nvcv::TensorDataStridedCuda>());
+    ASSERT_TRUE(in3Access && in1Access);
+
+    ASSERT_EQ(cudaSuccess, cudaMemset2D(in3Access->sampleData(0), in3Access->rowStride(), 100, width * 3, height * 3));
+    ASSERT_EQ(cudaSuccess, cudaMemset2D(in1Access->sampleData(0), in1Access->rowStride(), 100, width * 3, height));
+
+    nvcv::Tensor muval({{3}, "N"}, nvcv::TYPE_F32);
+    nvcv::Tensor sigmaval({{3}, "N"}, nvcv::TYPE_F32);
+
+    std::vector<float> muVec(3, 0.f), sigmaVec(3, 20.f);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(muval.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), muVec.data(),
+                                      3 * sizeof(float), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(sigmaval.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), sigmaVec.data(),
+                                      3 * sizeof(float), cudaMemcpyHostToDevice));
+
+    cvcuda::GaussianNoise op3(3), op1(1);
+    EXPECT_NO_THROW(op3(stream, in3, out3, muval, sigmaval, true, 777));
+    EXPECT_NO_THROW(op1(stream, in1, outA, muval, sigmaval, true, 777));
+    EXPECT_NO_THROW(op1(stream, in1, outB, muval, sigmaval, true, 777));
+    EXPECT_NO_THROW(op3(stream, in1, outC, muval, sigmaval, true, 777));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    auto readSample0 = [&](const nvcv::Tensor &t)
+    {
+        auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*t.exportData<nvcv::TensorDataStridedCuda>());
+        std::vector<uint8_t> vec(width * 3 * height);
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(vec.data(), width * 3, access->sampleData(0), access->rowStride(),
+                                            width * 3, height, cudaMemcpyDeviceToHost));
+        return vec;
+    };
+
+    std::vector<uint8_t> noise = readSample0(outA);
+    EXPECT_NE(noise, std::vector<uint8_t>(noise.size(), 100));
+    EXPECT_EQ(readSample0(out3), noise);
+    EXPECT_NE(readSample0(outB), noise);
+    EXPECT_EQ(readSample0(outC), readSample0(outB));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 template<typename datatype>
 static void varshape_correct_output_test(int batch, int height, int width, float mu, float sigma, bool per_channel)
 {
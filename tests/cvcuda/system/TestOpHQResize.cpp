@@ -18,6 +18,7 @@
 #include <common/InterpUtils.hpp>
 #include <common/TensorDataUtils.hpp>
 #include <common/TypedTests.hpp>
+#include <cvcuda/OpBuildPyramid.hpp>
 #include <cvcuda/OpHQResize.hpp>
 #include <cvcuda/cuda_tools/DropCast.hpp>
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
@@ -30,6 +31,7 @@
 #include <nvcv/TensorDataAccess.hpp>
 #include <nvcv/util/Math.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <random>
@@ -1420,6 +1422,100 @@ TEST(OpHQResizeImageBatch, test_multi_run_single_workspace)
     TestImageBatch<SecondRun>(numSamples1, inShapes1, outShapes1, ws, false);
 }
 
+TEST(OpHQResizePyramid, resize_from_selected_level)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int  numSamples = 2, width = 128, height = 96, numLevels = 4, numScales = 3;
+    const int3 baseShape{width, height, numSamples};
+
+    nvcv::Tensor      in({{numSamples, height, width, 1}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::TensorBatch pyramid = cvcuda::BuildPyramid::CreatePyramid(baseShape, numLevels, numScales);
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(inData);
+
+    std::default_random_engine         rng(12345);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t>               inVec(inData->stride(0) * numSamples);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return static_cast<uint8_t>(dist(rng)); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::BuildPyramid buildOp(baseShape);
+    NVCVPyramidInfo      info = buildOp(stream, in, pyramid, 1.6f, false);
+
+    // The output matches level 2 in size, so the resize reduces to a copy of that level's first layer
+    const int    level = 2;
+    nvcv::Tensor out({{numSamples, height >> level, width >> level, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    HQResizeTensorShapeI maxShape;
+    maxShape.extent[0]   = height;
+    maxShape.extent[1]   = width;
+    maxShape.ndim        = 2;
+    maxShape.numChannels = 1;
+
+    cvcuda::HQResize        op;
+    cvcuda::UniqueWorkspace ws;
+    ASSERT_NO_THROW(ws = cvcuda::AllocateWorkspace(op.getWorkspaceRequirements(numSamples, maxShape)));
+    ASSERT_NO_THROW(op(stream, ws.get(), pyramid, info, out, NVCV_INTERP_LINEAR, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    auto levelData = pyramid[level].exportData<nvcv::TensorDataStridedCuda>();
+    auto outData   = out.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(levelData && outData);
+
+    // The first layer of a pyramid level is laid out as an NHWC tensor at the start of the level
+    const int            levelW = width >> level, levelH = height >> level;
+    std::vector<uint8_t> levelVec(levelData->stride(1) * numSamples);
+    std::vector<uint8_t> outVec(outData->stride(0) * numSamples);
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(levelVec.data(), levelData->basePtr(), levelVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(outVec.data(), outData->basePtr(), outVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int z = 0; z < numSamples; z++)
+    {
+        for (int y = 0; y < levelH; y++)
+        {
+            for (int x = 0; x < levelW; x++)
+            {
+                float gold = *reinterpret_cast<const float *>(&levelVec[z * levelData->stride(1)
+                                                                        + y * levelData->stride(2)
+                                                                        + x * levelData->stride(3)]);
+                float test = *reinterpret_cast<const float *>(
+                    &outVec[z * outData->stride(0) + y * outData->stride(1) + x * outData->stride(2)]);
+                ASSERT_NEAR(gold, test, 1e-3f) << "At z=" << z << " y=" << y << " x=" << x;
+            }
+        }
+    }
+
+    // Outputs that are not single-channel F32 NHWC or do not match the number of samples are rejected
+    nvcv::Tensor outU8({{numSamples, levelH, levelW, 1}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor outRGB({{numSamples, levelH, levelW, 3}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor outOneSample({{1, levelH, levelW, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    auto submit = [&](const NVCVPyramidInfo &pyramidInfo, const nvcv::Tensor &dst)
+    {
+        return nvcv::ProtectCall(
+            [&] { op(stream, ws.get(), pyramid, pyramidInfo, dst, NVCV_INTERP_LINEAR, NVCV_INTERP_LINEAR); });
+    };
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(info, outU8));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(info, outRGB));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(info, outOneSample));
+
+    NVCVPyramidInfo badInfo = info;
+    badInfo.numLevels       = numLevels + 1;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(badInfo, out));
+
+    NVCVWorkspace wsC = ws.get();
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaHQResizePyramidSubmit(op.handle(), stream, &wsC, pyramid.handle(), nullptr, out.handle(),
+                                          NVCV_INTERP_LINEAR, NVCV_INTERP_LINEAR, false));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST(OpHQResizeNegative, createWithNullHandle)
 {
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaHQResizeCreate(nullptr));
@@ -0,0 +1,401 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/InterpUtils.hpp>
+#include <common/TensorDataUtils.hpp>
+#include <common/TypedTests.hpp>
+#include <cvcuda/OpImageStats.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+namespace type = nvcv::test::type;
+
+static std::default_random_engine g_rng(std::random_device{}());
+
+// Integral types are drawn as int, since uniform_int_distribution does not accept 8-bit types
+template<typename T>
+using uniform_distribution
+    = std::conditional_t<std::is_integral_v<T>, std::uniform_int_distribution<int>, std::uniform_real_distribution<T>>;
+
+// Gold (CPU reference) statistics of one ROI ----------------------------------
+
+struct GoldStats
+{
+    std::vector<int> histogram;
+    double           minVal = 0, maxVal = 0;
+    int2             minLoc{-1, -1}, maxLoc{-1, -1};
+    double           sum = 0, sumSq = 0;
+};
+
+template<typename T>
+GoldStats ComputeGoldStats(std::vector<uint8_t> &inVec, long3 inStrides, std::vector<uint8_t> &maskVec,
+                           long3 maskStrides, bool hasMask, int z, int2 size, int4 roi, int numBins, float histLow,
+                           float histHigh)
+{
+    GoldStats gold;
+    gold.histogram.resize(numBins, 0);
+
+    int x0 = std::max(roi.x, 0), y0 = std::max(roi.y, 0);
+    int x1 = std::min(roi.x + roi.z, size.x), y1 = std::min(roi.y + roi.w, size.y);
+
+    float scale = numBins / (histHigh - histLow);
+    bool  found = false;
+
+    // Raster order visit, so the first occurrence of min/max is kept by using strict comparisons
+    for (int y = y0; y < y1; ++y)
+    {
+        for (int x = x0; x < x1; ++x)
+        {
+            if (hasMask && test::ValueAt<uint8_t>(maskVec, maskStrides, int3{x, y, z}) == 0)
+            {
+                continue;
+            }
+
+            T      v  = test::ValueAt<T>(inVec, inStrides, int3{x, y, z});
+            double dv = static_cast<double>(v);
+
+            gold.sum += dv;
+            gold.sumSq += dv * dv;
+
+            if (!found || dv < gold.minVal)
+            {
+                gold.minVal = dv;
+                gold.minLoc = int2{x, y};
+            }
+            if (!found || dv > gold.maxVal)
+            {
+                gold.maxVal = dv;
+                gold.maxLoc = int2{x, y};
+            }
+            found = true;
+
+            float bin = (static_cast<float>(v) - histLow) * scale;
+            if (bin >= 0.f && bin < numBins)
+            {
+                gold.histogram[static_cast<int>(bin)]++;
+            }
+        }
+    }
+
+    return gold;
+}
+
+static std::vector<uint8_t> CopyToHost(const nvcv::Tensor &tensor)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    EXPECT_TRUE(data);
+
+    std::vector<uint8_t> vec(data->shape(0) * data->stride(0));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data->basePtr(), vec.size(), cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+// clang-format off
+
+#define NVCV_SHAPE(w, h, n) (int3{w, h, n})
+
+#define NVCV_TEST_ROW(InShape, ValueType, InFormat, NumBins, NumRois, UseMask)                                  \
+    type::Types<type::Value<InShape>, ValueType, type::Value<InFormat>, type::Value<NumBins>, type::Value<NumRois>, \
+                type::Value<UseMask>>
+
+NVCV_TYPED_TEST_SUITE(OpImageStats, type::Types<
+    NVCV_TEST_ROW(NVCV_SHAPE(44, 33, 1), uint8_t, NVCV_IMAGE_FORMAT_U8, 256, 0, false),
+    NVCV_TEST_ROW(NVCV_SHAPE(421, 292, 2), uint8_t, NVCV_IMAGE_FORMAT_U8, 64, 3, true),
+    NVCV_TEST_ROW(NVCV_SHAPE(1920, 1080, 1), uint8_t, NVCV_IMAGE_FORMAT_U8, 256, 0, true),
+    NVCV_TEST_ROW(NVCV_SHAPE(98, 39, 3), uint16_t, NVCV_IMAGE_FORMAT_U16, 10000, 2, false),
+    NVCV_TEST_ROW(NVCV_SHAPE(43, 32, 4), int16_t, NVCV_IMAGE_FORMAT_S16, 100, 1, false),
+    NVCV_TEST_ROW(NVCV_SHAPE(42, 30, 5), int32_t, NVCV_IMAGE_FORMAT_S32, 33, 4, true),
+    NVCV_TEST_ROW(NVCV_SHAPE(641, 480, 2), float, NVCV_IMAGE_FORMAT_F32, 17, 0, false),
+    NVCV_TEST_ROW(NVCV_SHAPE(39, 18, 8), float, NVCV_IMAGE_FORMAT_F32, 1, 5, true)
+>);
+
+// clang-format on
+
+TYPED_TEST(OpImageStats, correct_output)
+{
+    int3 inShape = type::GetValue<TypeParam, 0>;
+
+    using T = type::GetType<TypeParam, 1>;
+
+    nvcv::ImageFormat inFormat{type::GetValue<TypeParam, 2>};
+
+    int  numBins = type::GetValue<TypeParam, 3>;
+    int  numRois = type::GetValue<TypeParam, 4>; // 0 means no ROIs tensor
+    bool useMask = type::GetValue<TypeParam, 5>;
+
+    // Random values are generated in a small range so that min/max values are repeated, testing first occurrence
+    T lo = std::is_unsigned_v<T> ? T{0} : static_cast<T>(-50);
+    T hi = T{200};
+
+    float histLow  = std::is_unsigned_v<T> ? 0.f : -50.f;
+    float histHigh = 180.f; // values in [180, 200] are outside of the histogram range
+
+    nvcv::Tensor in   = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, inFormat);
+    nvcv::Tensor mask = useMask ? nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_U8)
+                                : nvcv::Tensor{nullptr};
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(inData);
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    ASSERT_TRUE(inAccess);
+
+    long3  inStrides{inAccess->sampleStride(), inAccess->rowStride(), inAccess->colStride()};
+    size_t inBufSize = inStrides.x * inAccess->numSamples();
+
+    std::vector<uint8_t> inVec(inBufSize, uint8_t{0});
+
+    uniform_distribution<T> rg(lo, hi);
+
+    for (int z = 0; z < inShape.z; ++z)
+        for (int y = 0; y < inShape.y; ++y)
+            for (int x = 0; x < inShape.x; ++x)
+                test::ValueAt<T>(inVec, inStrides, int3{x, y, z}) = static_cast<T>(rg(g_rng));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inBufSize, cudaMemcpyHostToDevice));
+
+    std::vector<uint8_t> maskVec;
+    long3                maskStrides{0, 0, 0};
+
+    if (useMask)
+    {
+        auto maskData = mask.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_TRUE(maskData);
+        auto maskAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*maskData);
+        ASSERT_TRUE(maskAccess);
+
+        maskStrides = long3{maskAccess->sampleStride(), maskAccess->rowStride(), maskAccess->colStride()};
+        maskVec.resize(maskStrides.x * maskAccess->numSamples(), uint8_t{0});
+
+        std::uniform_int_distribution<int> rgMask(0, 3);
+
+        for (int z = 0; z < inShape.z; ++z)
+            for (int y = 0; y < inShape.y; ++y)
+                for (int x = 0; x < inShape.x; ++x)
+                    test::ValueAt<uint8_t>(maskVec, maskStrides, int3{x, y, z}) = rgMask(g_rng);
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy(maskData->basePtr(), maskVec.data(), maskVec.size(), cudaMemcpyHostToDevice));
+    }
+
+    // ROIs are partially outside the image on purpose, to test clipping; the last ROI is empty
+
+    int               R = std::max(numRois, 1);
+    std::vector<int4> roisVec(inShape.z * R);
+    nvcv::Tensor      rois{nullptr};
+
+    std::uniform_int_distribution<int> rgX(-5, inShape.x - 1), rgY(-5, inShape.y - 1);
+
+    for (int z = 0; z < inShape.z; ++z)
+    {
+        for (int r = 0; r < R; ++r)
+        {
+            if (numRois == 0)
+            {
+                roisVec[z * R + r] = int4{0, 0, inShape.x, inShape.y};
+            }
+            else if (r == R - 1 && R > 1)
+            {
+                roisVec[z * R + r] = int4{inShape.x, 0, 10, 10};
+            }
+            else
+            {
+                int x = rgX(g_rng), y = rgY(g_rng);
+                roisVec[z * R + r] = int4{x, y, inShape.x / 2 + 3, inShape.y / 2 + 3};
+            }
+        }
+    }
+
+    if (numRois > 0)
+    {
+        rois = nvcv::Tensor({{inShape.z, numRois}, "NM"}, nvcv::TYPE_4S32);
+
+        auto roisData = rois.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_TRUE(roisData);
+        ASSERT_EQ(roisData->stride(0), static_cast<int64_t>(numRois * sizeof(int4)));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(roisData->basePtr(), roisVec.data(), roisVec.size() * sizeof(int4),
+                                          cudaMemcpyHostToDevice));
+    }
+
+    // clang-format off
+
+    nvcv::Tensor histogram = numRois > 0 ? nvcv::Tensor({{inShape.z, R, numBins}, "NMC"}, nvcv::TYPE_S32)
+                                         : nvcv::Tensor({{inShape.z, numBins}, "NC"}, nvcv::TYPE_S32);
+    nvcv::Tensor minMaxVal = numRois > 0 ? nvcv::Tensor({{inShape.z, R, 2}, "NMC"}, nvcv::TYPE_F64)
+                                         : nvcv::Tensor({{inShape.z, 2}, "NC"}, nvcv::TYPE_F64);
+    nvcv::Tensor minMaxLoc = numRois > 0 ? nvcv::Tensor({{inShape.z, R, 2}, "NMC"}, nvcv::TYPE_2S32)
+                                         : nvcv::Tensor({{inShape.z, 2}, "NC"}, nvcv::TYPE_2S32);
+    nvcv::Tensor sum       = numRois > 0 ? nvcv::Tensor({{inShape.z, R}, "NM"}, nvcv::TYPE_F64)
+                                         : nvcv::Tensor({{inShape.z}, "N"}, nvcv::TYPE_F64);
+    nvcv::Tensor sumSq     = numRois > 0 ? nvcv::Tensor({{inShape.z, R}, "NM"}, nvcv::TYPE_F64)
+                                         : nvcv::Tensor({{inShape.z}, "N"}, nvcv::TYPE_F64);
+
+    // clang-format on
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::ImageStats op;
+    EXPECT_NO_THROW(op(stream, in, mask, rois, histLow, histHigh, histogram, minMaxVal, minMaxLoc, sum, sumSq));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> histVec   = CopyToHost(histogram);
+    std::vector<uint8_t> valVec    = CopyToHost(minMaxVal);
+    std::vector<uint8_t> locVec    = CopyToHost(minMaxLoc);
+    std::vector<uint8_t> sumVec    = CopyToHost(sum);
+    std::vector<uint8_t> sumSqVec  = CopyToHost(sumSq);
+    auto                 histData  = histogram.exportData<nvcv::TensorDataStridedCuda>();
+    auto                 valData   = minMaxVal.exportData<nvcv::TensorDataStridedCuda>();
+    auto                 locData   = minMaxLoc.exportData<nvcv::TensorDataStridedCuda>();
+    auto                 sumData   = sum.exportData<nvcv::TensorDataStridedCuda>();
+    auto                 sumSqData = sumSq.exportData<nvcv::TensorDataStridedCuda>();
+
+    // Outputs without the ROI dimension are addressed with a zero ROI stride
+    auto roiStride = [&](const nvcv::Optional<nvcv::TensorDataStridedCuda> &data)
+    {
+        return numRois > 0 ? data->stride(1) : 0;
+    };
+
+    int2 size{inShape.x, inShape.y};
+
+    for (int z = 0; z < inShape.z; ++z)
+    {
+        for (int r = 0; r < R; ++r)
+        {
+            GoldStats gold = ComputeGoldStats<T>(inVec, inStrides, maskVec, maskStrides, useMask, z, size,
+                                                 roisVec[z * R + r], numBins, histLow, histHigh);
+
+            long3 histStrides{histData->stride(0), roiStride(histData), sizeof(int)};
+            long3 valStrides{valData->stride(0), roiStride(valData), sizeof(double)};
+            long3 locStrides{locData->stride(0), roiStride(locData), sizeof(int2)};
+            long3 sumStrides{sumData->stride(0), roiStride(sumData), 0};
+            long3 sumSqStrides{sumSqData->stride(0), roiStride(sumSqData), 0};
+
+            for (int b = 0; b < numBins; ++b)
+            {
+                EXPECT_EQ(test::ValueAt<int>(histVec, histStrides, int3{b, r, z}), gold.histogram[b])
+                    << "sample " << z << " roi " << r << " bin " << b;
+            }
+
+            EXPECT_EQ(test::ValueAt<double>(valVec, valStrides, int3{0, r, z}), gold.minVal);
+            EXPECT_EQ(test::ValueAt<double>(valVec, valStrides, int3{1, r, z}), gold.maxVal);
+
+            int2 minLoc = test::ValueAt<int2>(locVec, locStrides, int3{0, r, z});
+            int2 maxLoc = test::ValueAt<int2>(locVec, locStrides, int3{1, r, z});
+
+            EXPECT_EQ(minLoc.x, gold.minLoc.x) << "sample " << z << " roi " << r;
+            EXPECT_EQ(minLoc.y, gold.minLoc.y) << "sample " << z << " roi " << r;
+            EXPECT_EQ(maxLoc.x, gold.maxLoc.x) << "sample " << z << " roi " << r;
+            EXPECT_EQ(maxLoc.y, gold.maxLoc.y) << "sample " << z << " roi " << r;
+
+            double sumTest   = test::ValueAt<double>(sumVec, sumStrides, int3{0, r, z});
+            double sumSqTest = test::ValueAt<double>(sumSqVec, sumSqStrides, int3{0, r, z});
+
+            EXPECT_NEAR(sumTest, gold.sum, std::abs(gold.sum) * 1e-9 + 1e-6);
+            EXPECT_NEAR(sumSqTest, gold.sumSq, std::abs(gold.sumSq) * 1e-9 + 1e-6);
+        }
+    }
+}
+
+TEST(OpImageStats, subset_of_outputs)
+{
+    int3 inShape{128, 64, 2};
+
+    nvcv::Tensor in = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_U8);
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(inData);
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    ASSERT_TRUE(inAccess);
+
+    ASSERT_EQ(cudaSuccess, cudaMemset2D(inData->basePtr(), inAccess->rowStride(), 7, inShape.x,
+                                        inShape.y * inShape.z));
+
+    nvcv::Tensor sum({{inShape.z}, "N"}, nvcv::TYPE_F64);
+
+    cvcuda::ImageStats op;
+    EXPECT_NO_THROW(op(nullptr, in, nullptr, nullptr, 0.f, 256.f, nullptr, nullptr, nullptr, sum, nullptr));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<uint8_t> sumVec = CopyToHost(sum);
+    auto                 sumData = sum.exportData<nvcv::TensorDataStridedCuda>();
+
+    for (int z = 0; z < inShape.z; ++z)
+    {
+        EXPECT_EQ(test::ValueAt<double>(sumVec, long1{sumData->stride(0)}, int1{z}), 7.0 * inShape.x * inShape.y);
+    }
+}
+
+TEST(OpImageStats, invalid_arguments)
+{
+    int3 inShape{16, 16, 2};
+
+    nvcv::Tensor in    = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_U8);
+    nvcv::Tensor inRGB = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_RGB8);
+    nvcv::Tensor inF64 = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_F64);
+
+    nvcv::Tensor histogram({{inShape.z, 256}, "NC"}, nvcv::TYPE_S32);
+    nvcv::Tensor histogramWrongType({{inShape.z, 256}, "NC"}, nvcv::TYPE_F32);
+    nvcv::Tensor histogramWrongSamples({{inShape.z + 1, 256}, "NC"}, nvcv::TYPE_S32);
+    nvcv::Tensor minMaxVal({{inShape.z, 2}, "NC"}, nvcv::TYPE_F64);
+    nvcv::Tensor minMaxLoc({{inShape.z, 2}, "NC"}, nvcv::TYPE_2S32);
+    nvcv::Tensor minMaxLocWrongSize({{inShape.z, 3}, "NC"}, nvcv::TYPE_2S32);
+    nvcv::Tensor rois({{inShape.z, 2}, "NM"}, nvcv::TYPE_4S32);
+    nvcv::Tensor roisWrongType({{inShape.z, 2}, "NM"}, nvcv::TYPE_2S32);
+
+    cvcuda::ImageStats op;
+
+#define NVCV_TEST_INVALID(...) \
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { op(nullptr, __VA_ARGS__); }))
+
+    // no outputs
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 0.f, 256.f, nullptr, nullptr, nullptr, nullptr, nullptr);
+    // multi-channel input
+    NVCV_TEST_INVALID(inRGB, nullptr, nullptr, 0.f, 256.f, histogram, nullptr, nullptr, nullptr, nullptr);
+    // unsupported input data type
+    NVCV_TEST_INVALID(inF64, nullptr, nullptr, 0.f, 256.f, histogram, nullptr, nullptr, nullptr, nullptr);
+    // empty histogram range
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 10.f, 10.f, histogram, nullptr, nullptr, nullptr, nullptr);
+    // histogram with wrong data type or number of samples
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 0.f, 256.f, histogramWrongType, nullptr, nullptr, nullptr, nullptr);
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 0.f, 256.f, histogramWrongSamples, nullptr, nullptr, nullptr, nullptr);
+    // minMaxVal without minMaxLoc and vice-versa
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 0.f, 256.f, nullptr, minMaxVal, nullptr, nullptr, nullptr);
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 0.f, 256.f, nullptr, nullptr, minMaxLoc, nullptr, nullptr);
+    NVCV_TEST_INVALID(in, nullptr, nullptr, 0.f, 256.f, nullptr, minMaxVal, minMaxLocWrongSize, nullptr, nullptr);
+    // outputs without ROI dimension when ROIs are given, and ROIs with wrong data type
+    NVCV_TEST_INVALID(in, nullptr, rois, 0.f, 256.f, histogram, nullptr, nullptr, nullptr, nullptr);
+    NVCV_TEST_INVALID(in, nullptr, roisWrongType, 0.f, 256.f, histogram, nullptr, nullptr, nullptr, nullptr);
+    // mask with wrong shape
+    NVCV_TEST_INVALID(in, inRGB, nullptr, 0.f, 256.f, histogram, nullptr, nullptr, nullptr, nullptr);
+
+#undef NVCV_TEST_INVALID
+}
+
+TEST(OpImageStats_Negative, create_null_handle)
+{
+    EXPECT_EQ(cvcudaImageStatsCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
+}
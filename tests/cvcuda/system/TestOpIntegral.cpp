@@ -0,0 +1,390 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/InterpUtils.hpp>
+#include <common/TensorDataUtils.hpp>
+#include <common/TypedTests.hpp>
+#include <cvcuda/OpIntegral.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+namespace type = nvcv::test::type;
+
+static std::default_random_engine g_rng(std::random_device{}());
+
+// Integral types are drawn as int64_t, since uniform_int_distribution does not accept 8-bit types
+template<typename T>
+using uniform_distribution = std::conditional_t<std::is_integral_v<T>, std::uniform_int_distribution<int64_t>,
+                                                std::uniform_real_distribution<T>>;
+
+template<typename T>
+nvcv::DataType DataTypeOf()
+{
+    if constexpr (std::is_same_v<T, uint8_t>)
+        return nvcv::TYPE_U8;
+    else if constexpr (std::is_same_v<T, uint16_t>)
+        return nvcv::TYPE_U16;
+    else if constexpr (std::is_same_v<T, int16_t>)
+        return nvcv::TYPE_S16;
+    else if constexpr (std::is_same_v<T, int32_t>)
+        return nvcv::TYPE_S32;
+    else if constexpr (std::is_same_v<T, int64_t>)
+        return nvcv::TYPE_S64;
+    else if constexpr (std::is_same_v<T, float>)
+        return nvcv::TYPE_F32;
+    else
+        return nvcv::TYPE_F64;
+}
+
+// Gold (CPU reference) integral image of one channel of one sample --------------------------------------------------
+
+// Integer sums are computed modulo 2^64, which gives the expected wrapped around values of 32-bit outputs, floating
+// point sums in double along with the sum of absolute values used for the tolerance of float outputs
+template<typename T, typename G>
+std::vector<G> ComputeGoldIntegral(std::vector<uint8_t> &inVec, long3 inStrides, int2 size, int numChannels,
+                                   int c, bool squared, bool absolute)
+{
+    int            W = size.x + 1;
+    std::vector<G> gold(W * (size.y + 1), G{0});
+
+    for (int y = 0; y < size.y; ++y)
+    {
+        G rowSum = 0;
+        for (int x = 0; x < size.x; ++x)
+        {
+            T v = test::ValueAt<T>(inVec, inStrides, int3{x * numChannels + c, y, 0});
+            G g = static_cast<G>(v);
+            if constexpr (std::is_floating_point_v<G>)
+            {
+                if (absolute)
+                {
+                    g = std::abs(g);
+                }
+            }
+            if (squared)
+            {
+                g *= g;
+            }
+            rowSum += g;
+            gold[(y + 1) * W + x + 1] = gold[y * W + x + 1] + rowSum;
+        }
+    }
+
+    return gold;
+}
+
+// Compares one channel of one sample of an integral image, given as a host buffer addressed by strides
+template<typename T, typename S>
+void CompareIntegral(std::vector<uint8_t> &inVec, long3 inStrides, std::vector<uint8_t> &outVec,
+                     long3 outStrides, int2 size, int numChannels, int c, bool squared)
+{
+    int W = size.x + 1;
+
+    if constexpr (std::is_integral_v<S>)
+    {
+        std::vector<uint64_t> gold = ComputeGoldIntegral<T, uint64_t>(inVec, inStrides, size, numChannels, c, squared,
+                                                                      false);
+        for (int y = 0; y <= size.y; ++y)
+        {
+            for (int x = 0; x <= size.x; ++x)
+            {
+                S val = test::ValueAt<S>(outVec, outStrides, int3{x * numChannels + c, y, 0});
+                ASSERT_EQ(val, static_cast<S>(gold[y * W + x])) << "at (" << x << ", " << y << ") channel " << c;
+            }
+        }
+    }
+    else
+    {
+        std::vector<double> gold = ComputeGoldIntegral<T, double>(inVec, inStrides, size, numChannels, c, squared,
+                                                                  false);
+        std::vector<double> mag  = ComputeGoldIntegral<T, double>(inVec, inStrides, size, numChannels, c, squared,
+                                                                  true);
+
+        // Single precision sums lose bits as they grow, relative to the magnitude of the summed values
+        double relTol = std::is_same_v<S, float> ? 1e-5 : 1e-12;
+
+        for (int y = 0; y <= size.y; ++y)
+        {
+            for (int x = 0; x <= size.x; ++x)
+            {
+                double val = test::ValueAt<S>(outVec, outStrides, int3{x * numChannels + c, y, 0});
+                ASSERT_NEAR(val, gold[y * W + x], mag[y * W + x] * relTol + 1e-3)
+                    << "at (" << x << ", " << y << ") channel " << c;
+            }
+        }
+    }
+}
+
+static std::vector<uint8_t> CopyToHost(const nvcv::Tensor &tensor)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    EXPECT_TRUE(data);
+
+    std::vector<uint8_t> vec(data->shape(0) * data->stride(0));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data->basePtr(), vec.size(), cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+// Sample strides of an NHWC tensor, with the channels folded into the columns
+static long3 SampleStrides(const nvcv::Tensor &tensor)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    EXPECT_TRUE(data);
+
+    return long3{data->stride(0), data->stride(1), data->stride(3)};
+}
+
+template<typename S>
+nvcv::Tensor CreateOutput(int3 inShape, int numChannels)
+{
+    if constexpr (std::is_void_v<S>)
+    {
+        return nvcv::Tensor{nullptr};
+    }
+    else
+    {
+        return nvcv::Tensor({{inShape.z, inShape.y + 1, inShape.x + 1, numChannels}, "NHWC"}, DataTypeOf<S>());
+    }
+}
+
+template<typename T, typename S>
+void CompareOutput(const nvcv::Tensor &out, std::vector<uint8_t> &inVec, long3 inStrides, int3 inShape,
+                   int numChannels, bool squared)
+{
+    if constexpr (!std::is_void_v<S>)
+    {
+        std::vector<uint8_t> outVec     = CopyToHost(out);
+        long3                outStrides = SampleStrides(out);
+
+        for (int z = 0; z < inShape.z; ++z)
+        {
+            SCOPED_TRACE(std::string(squared ? "sqsum" : "sum") + " sample " + std::to_string(z));
+
+            // Each sample is compared as the first sample of a buffer starting at its offset
+            std::vector<uint8_t> inSample(inVec.begin() + z * inStrides.x, inVec.begin() + (z + 1) * inStrides.x);
+            std::vector<uint8_t> outSample(outVec.begin() + z * outStrides.x, outVec.begin() + (z + 1) * outStrides.x);
+
+            for (int c = 0; c < numChannels; ++c)
+            {
+                CompareIntegral<T, S>(inSample, inStrides, outSample, outStrides, int2{inShape.x, inShape.y},
+                                      numChannels, c, squared);
+            }
+        }
+    }
+}
+
+// clang-format off
+
+#define NVCV_SHAPE(w, h, n) (int3{w, h, n})
+
+#define NVCV_TEST_ROW(InShape, NumChannels, ValueType, SumType, SqSumType) \
+    type::Types<type::Value<InShape>, type::Value<NumChannels>, ValueType, SumType, SqSumType>
+
+NVCV_TYPED_TEST_SUITE(OpIntegral, type::Types<
+    NVCV_TEST_ROW(NVCV_SHAPE(44, 33, 1), 1, uint8_t, int32_t, double),
+    NVCV_TEST_ROW(NVCV_SHAPE(1920, 1080, 1), 1, uint8_t, int32_t, int64_t),
+    NVCV_TEST_ROW(NVCV_SHAPE(421, 292, 2), 3, uint8_t, float, void),
+    NVCV_TEST_ROW(NVCV_SHAPE(97, 41, 3), 3, uint16_t, int64_t, double),
+    NVCV_TEST_ROW(NVCV_SHAPE(55, 70, 2), 4, int16_t, int32_t, int64_t),
+    NVCV_TEST_ROW(NVCV_SHAPE(33, 257, 2), 2, int32_t, int32_t, int64_t),
+    NVCV_TEST_ROW(NVCV_SHAPE(300, 200, 2), 1, float, float, double),
+    NVCV_TEST_ROW(NVCV_SHAPE(31, 1, 4), 1, float, void, float)
+>);
+
+// clang-format on
+
+TYPED_TEST(OpIntegral, correct_output)
+{
+    int3 inShape     = type::GetValue<TypeParam, 0>;
+    int  numChannels = type::GetValue<TypeParam, 1>;
+
+    using T      = type::GetType<TypeParam, 2>;
+    using SumT   = type::GetType<TypeParam, 3>;
+    using SqSumT = type::GetType<TypeParam, 4>;
+
+    // Integer inputs cover their whole range, so that S32 sums of S32 inputs wrap around
+    T lo = std::numeric_limits<T>::lowest(), hi = std::numeric_limits<T>::max();
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        lo = -100;
+        hi = 100;
+    }
+
+    nvcv::Tensor in({{inShape.z, inShape.y, inShape.x, numChannels}, "NHWC"}, DataTypeOf<T>());
+
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(inData);
+
+    long3  inStrides = SampleStrides(in);
+    size_t inBufSize = inStrides.x * inShape.z;
+
+    std::vector<uint8_t> inVec(inBufSize, uint8_t{0});
+
+    uniform_distribution<T> rg(lo, hi);
+
+    for (int z = 0; z < inShape.z; ++z)
+        for (int y = 0; y < inShape.y; ++y)
+            for (int x = 0; x < inShape.x * numChannels; ++x)
+                test::ValueAt<T>(inVec, inStrides, int3{x, y, z}) = static_cast<T>(rg(g_rng));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inBufSize, cudaMemcpyHostToDevice));
+
+    nvcv::Tensor sum   = CreateOutput<SumT>(inShape, numChannels);
+    nvcv::Tensor sqsum = CreateOutput<SqSumT>(inShape, numChannels);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Integral op;
+    EXPECT_NO_THROW(op(stream, in, sum, sqsum));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    CompareOutput<T, SumT>(sum, inVec, inStrides, inShape, numChannels, false);
+    CompareOutput<T, SqSumT>(sqsum, inVec, inStrides, inShape, numChannels, true);
+}
+
+TEST(OpIntegral, varshape_correct_output)
+{
+    int batch = 4;
+
+    std::uniform_int_distribution<int> rgWidth(1, 700), rgHeight(1, 300);
+    std::uniform_int_distribution<int> rgValue(0, 255);
+
+    std::vector<nvcv::Image>          imgSrc, imgSum, imgSqSum;
+    std::vector<std::vector<uint8_t>> srcVec(batch);
+
+    for (int i = 0; i < batch; ++i)
+    {
+        nvcv::Size2D size{rgWidth(g_rng), rgHeight(g_rng)};
+
+        imgSrc.emplace_back(size, nvcv::FMT_U8);
+        imgSum.emplace_back(nvcv::Size2D{size.w + 1, size.h + 1}, nvcv::FMT_S32);
+        imgSqSum.emplace_back(nvcv::Size2D{size.w + 1, size.h + 1}, nvcv::FMT_F64);
+
+        srcVec[i].resize(size.w * size.h);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rgValue(g_rng); });
+
+        auto imgData = imgSrc[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(imgData, nvcv::NullOpt);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(),
+                                            size.w, size.w, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(batch), batchSum(batch), batchSqSum(batch);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchSum.pushBack(imgSum.begin(), imgSum.end());
+    batchSqSum.pushBack(imgSqSum.begin(), imgSqSum.end());
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Integral op;
+    EXPECT_NO_THROW(op(stream, batchSrc, batchSum, batchSqSum));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < batch; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        nvcv::Size2D size = imgSrc[i].size();
+        long3        inStrides{0, size.w, 1};
+
+        auto copyOut = [&](const nvcv::Image &img, int elemSize)
+        {
+            auto data = img.exportData<nvcv::ImageDataStridedCuda>();
+            EXPECT_NE(data, nvcv::NullOpt);
+
+            int                  rowStride = (size.w + 1) * elemSize;
+            std::vector<uint8_t> vec(rowStride * (size.h + 1));
+            EXPECT_EQ(cudaSuccess, cudaMemcpy2D(vec.data(), rowStride, data->plane(0).basePtr,
+                                                data->plane(0).rowStride, rowStride, size.h + 1,
+                                                cudaMemcpyDeviceToHost));
+            return vec;
+        };
+
+        std::vector<uint8_t> sumVec   = copyOut(imgSum[i], sizeof(int32_t));
+        std::vector<uint8_t> sqSumVec = copyOut(imgSqSum[i], sizeof(double));
+
+        int2  size2{size.w, size.h};
+        long3 sumStrides{0, (size.w + 1) * 4, 4};
+        long3 sqSumStrides{0, (size.w + 1) * 8, 8};
+
+        CompareIntegral<uint8_t, int32_t>(srcVec[i], inStrides, sumVec, sumStrides, size2, 1, 0, false);
+        CompareIntegral<uint8_t, double>(srcVec[i], inStrides, sqSumVec, sqSumStrides, size2, 1, 0, true);
+    }
+}
+
+TEST(OpIntegral, invalid_arguments)
+{
+    int3 inShape{16, 16, 2};
+
+    nvcv::Tensor in    = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_U8);
+    nvcv::Tensor inF32 = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_F32);
+    nvcv::Tensor inF64 = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, nvcv::FMT_F64);
+    nvcv::Tensor inNCHW({{inShape.z, 1, inShape.y, inShape.x}, "NCHW"}, nvcv::TYPE_U8);
+
+    nvcv::Tensor sum({{inShape.z, inShape.y + 1, inShape.x + 1, 1}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor sumF32({{inShape.z, inShape.y + 1, inShape.x + 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor sumU8({{inShape.z, inShape.y + 1, inShape.x + 1, 1}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor sumSameSize({{inShape.z, inShape.y, inShape.x, 1}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor sumWrongSamples({{inShape.z + 1, inShape.y + 1, inShape.x + 1, 1}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor sumWrongChannels({{inShape.z, inShape.y + 1, inShape.x + 1, 2}, "NHWC"}, nvcv::TYPE_S32);
+
+    cvcuda::Integral op;
+
+#define NVCV_TEST_INVALID(...) \
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { op(nullptr, __VA_ARGS__); }))
+
+    // no outputs
+    NVCV_TEST_INVALID(in, nvcv::NullOpt, nvcv::NullOpt);
+    // unsupported input data type or layout
+    NVCV_TEST_INVALID(inF64, sumF32, nvcv::NullOpt);
+    NVCV_TEST_INVALID(inNCHW, sum, nvcv::NullOpt);
+    // integer output of a floating point input
+    NVCV_TEST_INVALID(inF32, sum, nvcv::NullOpt);
+    NVCV_TEST_INVALID(inF32, sumF32, sum);
+    // unsupported output data type
+    NVCV_TEST_INVALID(in, sumU8, nvcv::NullOpt);
+    // outputs with wrong shape
+    NVCV_TEST_INVALID(in, sumSameSize, nvcv::NullOpt);
+    NVCV_TEST_INVALID(in, sum, sumWrongSamples);
+    NVCV_TEST_INVALID(in, sumWrongChannels, nvcv::NullOpt);
+
+#undef NVCV_TEST_INVALID
+}
+
+TEST(OpIntegral_Negative, create_null_handle)
+{
+    EXPECT_EQ(cvcudaIntegralCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
+}
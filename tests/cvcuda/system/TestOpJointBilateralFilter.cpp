@@ -25,6 +25,8 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -770,3 +772,294 @@ TEST(OpJointBilateralFilter_Negative, create_null_handle)
 {
     EXPECT_EQ(cvcudaJointBilateralFilterCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
 }
+
+// Flat regions, a disc and a ramp with gaussian noise, all channels equal, so the grid range axis tracks the color
+// distance of the exact filter.
+static void FillGridTestImage(uint8_t *pData, int columns, int rows, int rowStride, int channels, std::mt19937 &rng)
+{
+    std::normal_distribution<float> noise(0.f, 8.f);
+    for (int j = 0; j < rows; j++)
+    {
+        for (int k = 0; k < columns; k++)
+        {
+            float dx = k - columns * 0.7f, dy = j - rows * 0.3f;
+            float v  = k < columns * 5 / 12 ? 60.f : 180.f;
+            if (dx * dx + dy * dy < 150.f)
+            {
+                v = 110.f;
+            }
+            if (j > rows * 0.7f)
+            {
+                v = 30.f + 2 * k;
+            }
+            uint8_t value = static_cast<uint8_t>(std::clamp(std::round(v + noise(rng)), 0.f, 255.f));
+            for (int c = 0; c < channels; ++c)
+            {
+                pData[j * rowStride + k * channels + c] = value;
+            }
+        }
+    }
+}
+
+struct GridErrorStats
+{
+    double sum   = 0;
+    size_t count = 0;
+    int    max   = 0;
+
+    void add(const uint8_t *pTest, const uint8_t *pGold, int columns, int rows, int rowStride, int channels)
+    {
+        for (int j = 0; j < rows; j++)
+        {
+            for (int k = 0; k < columns * channels; k++)
+            {
+                int diff = std::abs(pTest[j * rowStride + k] - pGold[j * rowStride + k]);
+                sum += diff;
+                max = std::max(max, diff);
+                count++;
+            }
+        }
+    }
+
+    double mean() const
+    {
+        return count ? sum / count : 0;
+    }
+};
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpJointBilateralFilterGrid, test::ValueList<int, int, int, float, float, float, int, float, int>
+{
+    // Sampling factor scales both sigmas into grid cell sizes, the tolerances are the documented error bounds
+    //width, height, d, sigmaColor, sigmaSpace, factor, numberImages, maxMeanError, maxError
+    {    72,     64,  9,        20,          3,    0.5,            1,          1.5,        8},
+    {    72,     64, 15,        30,          5,    0.5,            2,          1.5,        8},
+    {    72,     64, 15,        30,          5,    1.0,            2,          3.0,       16},
+    {    72,     64, 31,        30,         10,    1.0,            3,          3.0,       16},
+});
+
+// clang-format on
+
+TEST_P(OpJointBilateralFilterGrid, JointBilateralFilterGrid_packed)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    int   width          = GetParamValue<0>();
+    int   height         = GetParamValue<1>();
+    int   d              = GetParamValue<2>();
+    float sigmaColor     = GetParamValue<3>();
+    float sigmaSpace     = GetParamValue<4>();
+    float factor         = GetParamValue<5>();
+    int   numberOfImages = GetParamValue<6>();
+    float maxMeanError   = GetParamValue<7>();
+    int   maxError       = GetParamValue<8>();
+
+    for (nvcv::ImageFormat fmt : {nvcv::FMT_U8, nvcv::FMT_RGB8})
+    {
+        const int channels = fmt.numChannels();
+
+        nvcv::Tensor imgIn      = nvcv::util::CreateTensor(numberOfImages, width, height, fmt);
+        nvcv::Tensor imgInColor = nvcv::util::CreateTensor(numberOfImages, width, height, fmt);
+        nvcv::Tensor imgExact   = nvcv::util::CreateTensor(numberOfImages, width, height, fmt);
+        nvcv::Tensor imgGrid    = nvcv::util::CreateTensor(numberOfImages, width, height, fmt);
+
+        auto inData      = imgIn.exportData<nvcv::TensorDataStridedCuda>();
+        auto inColorData = imgInColor.exportData<nvcv::TensorDataStridedCuda>();
+        auto exactData   = imgExact.exportData<nvcv::TensorDataStridedCuda>();
+        auto gridData    = imgGrid.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(nullptr, inData);
+        ASSERT_NE(nullptr, inColorData);
+        ASSERT_NE(nullptr, exactData);
+        ASSERT_NE(nullptr, gridData);
+
+        auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+        ASSERT_TRUE(inAccess);
+
+        int sampleStride = inAccess->numRows() * inAccess->rowStride();
+        int bufSize      = sampleStride * inAccess->numSamples();
+
+        // image and guide share the pattern but not the noise
+        std::mt19937         rng(12345);
+        std::vector<uint8_t> vIn(bufSize, 0), vInColor(bufSize, 0);
+        for (int i = 0; i < numberOfImages; i++)
+        {
+            FillGridTestImage(vIn.data() + i * sampleStride, width, height, inAccess->rowStride(), channels, rng);
+            FillGridTestImage(vInColor.data() + i * sampleStride, width, height, inAccess->rowStride(), channels,
+                              rng);
+        }
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), vIn.data(), bufSize, cudaMemcpyHostToDevice));
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(inColorData->basePtr(), vInColor.data(), bufSize, cudaMemcpyHostToDevice));
+
+        // run the exact filter as reference and the grid approximation
+        cvcuda::JointBilateralFilter  jointBilateralFilterOp;
+        const NVCVBilateralGridParams gridParams{factor * sigmaSpace, factor * sigmaColor};
+
+        EXPECT_NO_THROW(jointBilateralFilterOp(stream, imgIn, imgInColor, imgExact, d, sigmaColor, sigmaSpace,
+                                               NVCV_BORDER_REFLECT101));
+        EXPECT_NO_THROW(
+            jointBilateralFilterOp(stream, imgIn, imgInColor, imgGrid, d, sigmaColor, sigmaSpace, gridParams));
+
+        std::vector<uint8_t> vExact(bufSize), vGrid(bufSize);
+
+        EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(vExact.data(), exactData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(vGrid.data(), gridData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+
+        GridErrorStats stats;
+        for (int i = 0; i < numberOfImages; i++)
+        {
+            stats.add(vGrid.data() + i * sampleStride, vExact.data() + i * sampleStride, width, height,
+                      inAccess->rowStride(), channels);
+        }
+        EXPECT_LE(stats.mean(), maxMeanError) << "format " << fmt;
+        EXPECT_LE(stats.max, maxError) << "format " << fmt;
+    }
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST_P(OpJointBilateralFilterGrid, JointBilateralFilterGrid_VarShape)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    int   width          = GetParamValue<0>();
+    int   height         = GetParamValue<1>();
+    int   diameter       = GetParamValue<2>();
+    float sigmaColor     = GetParamValue<3>();
+    float sigmaSpace     = GetParamValue<4>();
+    float factor         = GetParamValue<5>();
+    int   numberOfImages = GetParamValue<6>();
+    float maxMeanError   = GetParamValue<7>();
+    int   maxError       = GetParamValue<8>();
+
+    nvcv::ImageFormat fmt = nvcv::FMT_U8;
+
+    std::mt19937                       rng(12345);
+    std::uniform_int_distribution<int> udistWidth(width * 0.8, width * 1.1);
+    std::uniform_int_distribution<int> udistHeight(height * 0.8, height * 1.1);
+
+    std::vector<nvcv::Image> imgSrc, imgSrcColor, imgExact, imgGrid;
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        nvcv::Size2D size{udistWidth(rng), udistHeight(rng)};
+        imgSrc.emplace_back(size, fmt);
+        imgSrcColor.emplace_back(size, fmt);
+        imgExact.emplace_back(size, fmt);
+        imgGrid.emplace_back(size, fmt);
+
+        for (nvcv::Image *img : {&imgSrc[i], &imgSrcColor[i]})
+        {
+            std::vector<uint8_t> vSrc(size.w * size.h);
+            FillGridTestImage(vSrc.data(), size.w, size.h, size.w, 1, rng);
+
+            auto imgData = img->exportData<nvcv::ImageDataStridedCuda>();
+            ASSERT_NE(imgData, nvcv::NullOpt);
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, vSrc.data(),
+                                                size.w, size.w, size.h, cudaMemcpyHostToDevice));
+        }
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numberOfImages), batchSrcColor(numberOfImages), batchExact(numberOfImages),
+        batchGrid(numberOfImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchSrcColor.pushBack(imgSrcColor.begin(), imgSrcColor.end());
+    batchExact.pushBack(imgExact.begin(), imgExact.end());
+    batchGrid.pushBack(imgGrid.begin(), imgGrid.end());
+
+    std::vector<int>   vDiameter(numberOfImages, diameter);
+    std::vector<float> vSigmaColor(numberOfImages, sigmaColor);
+    std::vector<float> vSigmaSpace(numberOfImages, sigmaSpace);
+    nvcv::Tensor       diameterTensor({{numberOfImages}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor       sigmaColorTensor({{numberOfImages}, "N"}, nvcv::TYPE_F32);
+    nvcv::Tensor       sigmaSpaceTensor({{numberOfImages}, "N"}, nvcv::TYPE_F32);
+    {
+        auto diameterDev   = diameterTensor.exportData<nvcv::TensorDataStridedCuda>();
+        auto sigmaColorDev = sigmaColorTensor.exportData<nvcv::TensorDataStridedCuda>();
+        auto sigmaSpaceDev = sigmaSpaceTensor.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(diameterDev, nullptr);
+        ASSERT_NE(sigmaColorDev, nullptr);
+        ASSERT_NE(sigmaSpaceDev, nullptr);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(diameterDev->basePtr(), vDiameter.data(), numberOfImages * sizeof(int),
+                                               cudaMemcpyHostToDevice, stream));
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(sigmaColorDev->basePtr(), vSigmaColor.data(),
+                                               numberOfImages * sizeof(float), cudaMemcpyHostToDevice, stream));
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(sigmaSpaceDev->basePtr(), vSigmaSpace.data(),
+                                               numberOfImages * sizeof(float), cudaMemcpyHostToDevice, stream));
+    }
+
+    cvcuda::JointBilateralFilter  jointBilateralFilterOp;
+    const NVCVBilateralGridParams gridParams{factor * sigmaSpace, factor * sigmaColor};
+
+    EXPECT_NO_THROW(jointBilateralFilterOp(stream, batchSrc, batchSrcColor, batchExact, diameterTensor,
+                                           sigmaColorTensor, sigmaSpaceTensor, NVCV_BORDER_REFLECT101));
+    EXPECT_NO_THROW(jointBilateralFilterOp(stream, batchSrc, batchSrcColor, batchGrid, diameterTensor,
+                                           sigmaColorTensor, sigmaSpaceTensor, gridParams));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    GridErrorStats stats;
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        nvcv::Size2D         size = imgSrc[i].size();
+        std::vector<uint8_t> vExact(size.w * size.h), vGrid(size.w * size.h);
+
+        auto exactData = imgExact[i].exportData<nvcv::ImageDataStridedCuda>();
+        auto gridData  = imgGrid[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(vExact.data(), size.w, exactData->plane(0).basePtr,
+                                            exactData->plane(0).rowStride, size.w, size.h, cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(vGrid.data(), size.w, gridData->plane(0).basePtr,
+                                            gridData->plane(0).rowStride, size.w, size.h, cudaMemcpyDeviceToHost));
+        stats.add(vGrid.data(), vExact.data(), size.w, size.h, size.w, 1);
+    }
+    EXPECT_LE(stats.mean(), maxMeanError);
+    EXPECT_LE(stats.max, maxError);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpJointBilateralFilterGrid_Negative, nvcv::test::ValueList<NVCVStatus, nvcv::ImageFormat, nvcv::ImageFormat, float, float>{
+    {NVCV_ERROR_INVALID_ARGUMENT, nvcv::FMT_U8,     nvcv::FMT_U8,     0.5f, 5.f}, // space sampling below one pixel
+    {NVCV_ERROR_INVALID_ARGUMENT, nvcv::FMT_U8,     nvcv::FMT_U8,     2.f,  0.f}, // color sampling not positive
+    {NVCV_ERROR_INVALID_ARGUMENT, nvcv::FMT_U8,     nvcv::FMT_U16,    2.f,  5.f}, // in/inColor datatype not same
+    {NVCV_ERROR_INVALID_ARGUMENT, nvcv::FMT_RGBf32, nvcv::FMT_RGBf32, 2.f,  5.f}, // float data type not supported by the grid
+    {NVCV_ERROR_OVERFLOW,         nvcv::FMT_U16,    nvcv::FMT_U16,    1.f,  1e-4f}, // grid too large
+});
+
+// clang-format on
+
+TEST_P(OpJointBilateralFilterGrid_Negative, op)
+{
+    NVCVStatus        expectedReturnCode = GetParamValue<0>();
+    nvcv::ImageFormat fmt                = GetParamValue<1>();
+    nvcv::ImageFormat colorFmt           = GetParamValue<2>();
+    float             spaceSampling      = GetParamValue<3>();
+    float             colorSampling      = GetParamValue<4>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor imgIn      = nvcv::util::CreateTensor(1, 64, 48, fmt);
+    nvcv::Tensor imgInColor = nvcv::util::CreateTensor(1, 64, 48, colorFmt);
+    nvcv::Tensor imgOut     = nvcv::util::CreateTensor(1, 64, 48, fmt);
+
+    cvcuda::JointBilateralFilter  jointBilateralFilterOp;
+    const NVCVBilateralGridParams gridParams{spaceSampling, colorSampling};
+    EXPECT_EQ(expectedReturnCode,
+              nvcv::ProtectCall(
+                  [&] { jointBilateralFilterOp(stream, imgIn, imgInColor, imgOut, 9, 30.f, 5.f, gridParams); }));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpJointBilateralFilterGrid_Negative, null_grid_params)
+{
+    nvcv::Tensor imgIn  = nvcv::util::CreateTensor(1, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgOut = nvcv::util::CreateTensor(1, 64, 48, nvcv::FMT_U8);
+
+    cvcuda::JointBilateralFilter jointBilateralFilterOp;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaJointBilateralFilterGridSubmit(jointBilateralFilterOp.handle(), nullptr, imgIn.handle(),
+                                                   imgIn.handle(), imgOut.handle(), 9, 30.f, 5.f, nullptr));
+}
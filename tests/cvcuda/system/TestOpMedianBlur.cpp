@@ -24,7 +24,9 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <random>
 
 namespace test = nvcv::test;
@@ -462,6 +464,134 @@ TEST_P(OpMedianBlur, varshape_correct_output)
     }
 }
 
+template<typename T>
+static std::vector<T> ComputeMedianBlurReplicate(const std::vector<T> &src, int width, int height, int numChannels,
+                                                 nvcv::Size2D ksize)
+{
+    std::vector<T> dst(src.size());
+    std::vector<T> samples(ksize.w * ksize.h);
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            for (int k = 0; k < numChannels; k++)
+            {
+                int n = 0;
+                for (int j = -ksize.h / 2; j <= ksize.h / 2; j++)
+                {
+                    for (int i = -ksize.w / 2; i <= ksize.w / 2; i++)
+                    {
+                        int yP = std::clamp(y + j, 0, height - 1);
+                        int xP = std::clamp(x + i, 0, width - 1);
+
+                        samples[n++] = src[(yP * width + xP) * numChannels + k];
+                    }
+                }
+                std::nth_element(samples.begin(), samples.begin() + n / 2, samples.end());
+                dst[(y * width + x) * numChannels + k] = samples[n / 2];
+            }
+        }
+    }
+    return dst;
+}
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpMedianBlurLargeKernel, test::ValueList<int, int, nvcv::Size2D, int, nvcv::ImageFormat>
+{
+    // width, height, kernel size, numberImages,         format
+    {     40,     37,       {7,7},            2,   nvcv::FMT_U8}, // smallest kernel for 8-bit histogram path
+    {     40,     37,       {9,5},            1, nvcv::FMT_RGB8},
+    {     64,     70,     {15,15},            2,   nvcv::FMT_U8},
+    {     53,     90,     {31,31},            1, nvcv::FMT_RGB8}, // radius 15
+    {     31,     23,      {61,3},            1, nvcv::FMT_RGBA8}, // window larger than the image
+    {     40,     37,       {9,9},            1,  nvcv::FMT_U16}, // below 16-bit histogram path
+    {     40,     37,     {11,11},            2,  nvcv::FMT_U16},
+    {     64,     70,     {31,31},            1,  nvcv::FMT_U16},
+    {     50,    150,     {41,41},            1,  nvcv::FMT_U16}, // low byte histogram slides over many rows
+});
+
+// clang-format on
+
+TEST_P(OpMedianBlurLargeKernel, tensor_correct_output)
+{
+    int               width          = GetParamValue<0>();
+    int               height         = GetParamValue<1>();
+    nvcv::Size2D      ksize          = GetParamValue<2>();
+    int               numberOfImages = GetParamValue<3>();
+    nvcv::ImageFormat fmt            = GetParamValue<4>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor imgSrc(numberOfImages, {width, height}, fmt);
+    nvcv::Tensor imgDst(numberOfImages, {width, height}, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(srcData && dstData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess && dstAccess);
+
+    int numChannels = fmt.numChannels();
+    int rowBytes    = width * fmt.planePixelStrideBytes(0);
+
+    // Few distinct values to exercise ties, and for 16-bit values that share their high byte
+    std::default_random_engine         randEng{0};
+    std::uniform_int_distribution<int> rand(0, 1023);
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        if (fmt == nvcv::FMT_U16)
+        {
+            std::vector<uint16_t> values(width * height);
+            std::generate(values.begin(), values.end(), [&]() { return static_cast<uint16_t>(32000 + rand(randEng) * 7); });
+            srcVec[i].resize(values.size() * sizeof(uint16_t));
+            std::memcpy(srcVec[i].data(), values.data(), srcVec[i].size());
+        }
+        else
+        {
+            srcVec[i].resize(height * rowBytes);
+            std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return static_cast<uint8_t>(rand(randEng) % 64 * 4); });
+        }
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            rowBytes, rowBytes, height, cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::MedianBlur medianBlurOp(0);
+    EXPECT_NO_THROW(medianBlurOp(stream, imgSrc, imgDst, ksize));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(height * rowBytes);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowBytes, dstAccess->sampleData(i), dstAccess->rowStride(),
+                                            rowBytes, height, cudaMemcpyDeviceToHost));
+
+        if (fmt == nvcv::FMT_U16)
+        {
+            std::vector<uint16_t> src(width * height), test(width * height);
+            std::memcpy(src.data(), srcVec[i].data(), srcVec[i].size());
+            std::memcpy(test.data(), testVec.data(), testVec.size());
+
+            EXPECT_EQ(ComputeMedianBlurReplicate(src, width, height, numChannels, ksize), test);
+        }
+        else
+        {
+            EXPECT_EQ(ComputeMedianBlurReplicate(srcVec[i], width, height, numChannels, ksize), testVec);
+        }
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpMedianBlur_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat, nvcv::Size2D>{
     // inFmt, outFmt, kernelSize
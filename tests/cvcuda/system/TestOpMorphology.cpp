@@ -56,6 +56,15 @@ static void hostMorphDilateErode(std::vector<uint8_t> &hDst, const long3 &dstStr
     }
 }
 
+// Saturated a - b of 8-bit images with the same strides, composite morphologies are only tested on 8-bit formats
+static void hostSubtract(std::vector<uint8_t> &hDst, const std::vector<uint8_t> &a, const std::vector<uint8_t> &b)
+{
+    for (size_t i = 0; i < hDst.size(); ++i)
+    {
+        hDst[i] = a[i] > b[i] ? a[i] - b[i] : 0;
+    }
+}
+
 static void hostMorph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
                       const long3 &srcStrides, const int3 &shape, const nvcv::ImageFormat &format,
                       const nvcv::Size2D &kernelSize, int2 &kernelAnchor, int iterations,
@@ -97,6 +106,31 @@ static void hostMorph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const
         break;
     }
 
+    case NVCVMorphologyType::NVCV_GRADIENT:
+    {
+        std::vector<uint8_t> eroded(hDst.size());
+        hostMorphDilateErode(hDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, iterations,
+                             borderMode, NVCVMorphologyType::NVCV_DILATE);
+        hostMorphDilateErode(eroded, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, iterations,
+                             borderMode, NVCVMorphologyType::NVCV_ERODE);
+        hostSubtract(hDst, hDst, eroded);
+        break;
+    }
+    case NVCVMorphologyType::NVCV_TOPHAT:
+    {
+        hostMorph(hDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, iterations, borderMode,
+                  NVCVMorphologyType::NVCV_OPEN);
+        hostSubtract(hDst, hSrc, hDst);
+        break;
+    }
+    case NVCVMorphologyType::NVCV_BLACKHAT:
+    {
+        hostMorph(hDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, iterations, borderMode,
+                  NVCVMorphologyType::NVCV_CLOSE);
+        hostSubtract(hDst, hDst, hSrc);
+        break;
+    }
+
     default:
         throw std::runtime_error("Unsupported morph type");
         break;
@@ -461,7 +495,24 @@ NVCV_TEST_SUITE_P(OpMorphology, test::ValueList<int, int, int, NVCVImageFormat,
     {      5,      5,       1, NVCV_IMAGE_FORMAT_U8,          2,          2,   NVCV_BORDER_REFLECT101, NVCV_ERODE,          3},
     {     25,     45,       2, NVCV_IMAGE_FORMAT_U8,          3,          3,   NVCV_BORDER_REFLECT101, NVCV_DILATE,         2},
     {     25,     45,       2, NVCV_IMAGE_FORMAT_U8,          3,          3,   NVCV_BORDER_REFLECT101, NVCV_OPEN,           3},
-    {     25,     44,       2, NVCV_IMAGE_FORMAT_U8,          3,          3,   NVCV_BORDER_REFLECT101, NVCV_CLOSE,          2}
+    {     25,     44,       2, NVCV_IMAGE_FORMAT_U8,          3,          3,   NVCV_BORDER_REFLECT101, NVCV_CLOSE,          2},
+    {    200,    120,       1, NVCV_IMAGE_FORMAT_U8,         31,         31,   NVCV_BORDER_CONSTANT, NVCV_ERODE,            5},
+    {    181,     97,       1, NVCV_IMAGE_FORMAT_RGBA8,      15,         15,   NVCV_BORDER_REPLICATE, NVCV_DILATE,          3},
+    {     57,     43,       1, NVCV_IMAGE_FORMAT_U8,          4,          6,   NVCV_BORDER_CONSTANT, NVCV_DILATE,           4},
+    {     57,     43,       1, NVCV_IMAGE_FORMAT_U8,          6,          4,   NVCV_BORDER_REPLICATE, NVCV_ERODE,           3},
+    {     90,     60,       2, NVCV_IMAGE_FORMAT_RGBAf32,     9,          9,   NVCV_BORDER_CONSTANT, NVCV_ERODE,            4},
+    {     64,     48,       1, NVCV_IMAGE_FORMAT_U16,         7,          7,   NVCV_BORDER_REFLECT, NVCV_DILATE,            3},
+    {    160,    100,       2, NVCV_IMAGE_FORMAT_U8,          1,         41,   NVCV_BORDER_REFLECT101, NVCV_ERODE,          2},
+    {    150,     90,       1, NVCV_IMAGE_FORMAT_RGB8,       25,          1,   NVCV_BORDER_WRAP, NVCV_DILATE,               1},
+    {     40,     30,       1, NVCV_IMAGE_FORMAT_U8,         61,         45,   NVCV_BORDER_REPLICATE, NVCV_DILATE,          2},
+    {    120,     80,       1, NVCV_IMAGE_FORMAT_U8,         11,          7,   NVCV_BORDER_REPLICATE, NVCV_OPEN,            2},
+    {    120,     80,       1, NVCV_IMAGE_FORMAT_U8,          9,          9,   NVCV_BORDER_REFLECT101, NVCV_CLOSE,          1},
+    {    100,     70,       2, NVCV_IMAGE_FORMAT_U8,          7,          5,   NVCV_BORDER_CONSTANT, NVCV_GRADIENT,         1},
+    {    100,     70,       1, NVCV_IMAGE_FORMAT_RGBA8,       3,          3,   NVCV_BORDER_REFLECT, NVCV_GRADIENT,          2},
+    {     80,     64,       2, NVCV_IMAGE_FORMAT_U8,          9,          9,   NVCV_BORDER_REPLICATE, NVCV_TOPHAT,          1},
+    {     80,     64,       1, NVCV_IMAGE_FORMAT_RGB8,        5,          1,   NVCV_BORDER_WRAP, NVCV_TOPHAT,               2},
+    {     80,     64,       2, NVCV_IMAGE_FORMAT_U8,          9,          9,   NVCV_BORDER_CONSTANT, NVCV_BLACKHAT,         1},
+    {     80,     64,       1, NVCV_IMAGE_FORMAT_U8,          1,         15,   NVCV_BORDER_REFLECT101, NVCV_BLACKHAT,       3}
 });
 
 // clang-format on
@@ -477,8 +528,10 @@ TEST_P(OpMorphology, morph_noop)
     NVCVBorderType     borderMode = GetParamValue<6>();
     NVCVMorphologyType morphType  = GetParamValue<7>();
 
-    // do not check noop on open/close since it needs workspace.
-    if (morphType == NVCVMorphologyType::NVCV_OPEN || morphType == NVCVMorphologyType::NVCV_CLOSE)
+    // do not check noop on open/close since it needs workspace, nor on composite types that are not identities.
+    if (morphType == NVCVMorphologyType::NVCV_OPEN || morphType == NVCVMorphologyType::NVCV_CLOSE
+        || morphType == NVCVMorphologyType::NVCV_GRADIENT || morphType == NVCVMorphologyType::NVCV_TOPHAT
+        || morphType == NVCVMorphologyType::NVCV_BLACKHAT)
         return;
 
     nvcv::ImageFormat format{NVCV_IMAGE_FORMAT_U8};
@@ -38,6 +38,7 @@ using uchar = unsigned char;
 #include <array>
 #include <cstdint>
 #include <limits>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -1083,6 +1084,90 @@ TEST_P(OpPillowResize, tensor_correct_output)
         StartTest<uint16_t>(srcWidth, srcHeight, dstWidth, dstHeight, interpolation, numberOfImages, fmt);
 }
 
+// Cycles through more geometries than the operator keeps resampling plans for, on two streams, so that the plans
+// are created, reused and evicted. Every call must produce the same output as the first call with the geometry.
+TEST(OpPillowResizePlans, tensor_cached_plans_reuse)
+{
+    const int               srcWidth = 64, srcHeight = 48;
+    const nvcv::ImageFormat fmt      = nvcv::FMT_RGB8;
+
+    const NVCVInterpolationType interps[] = {NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_LANCZOS};
+
+    std::vector<std::tuple<int, int, NVCVInterpolationType>> geometries;
+    for (int i = 0; i < 40; ++i)
+    {
+        geometries.emplace_back(8 + 3 * i, 100 - 2 * i, interps[i % 3]);
+    }
+    const int maxDstWidth = 8 + 3 * 39, maxDstHeight = 100;
+
+    cudaStream_t streams[2];
+    for (cudaStream_t &stream : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    }
+
+    nvcv::Tensor imgSrc(1, {srcWidth, srcHeight}, fmt);
+    auto         srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    int                                    srcRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    std::vector<uint8_t>                   srcVec(srcRowStride * srcHeight);
+    std::default_random_engine             randEng{0};
+    std::uniform_int_distribution<uint8_t> srcRand{0u, 255u};
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return srcRand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(0), srcAccess->rowStride(), srcVec.data(), srcRowStride,
+                                        srcRowStride, srcHeight, cudaMemcpyHostToDevice));
+
+    cvcuda::PillowResize    pillowResizeOp;
+    cvcuda::UniqueWorkspace ws[2];
+    for (auto &w : ws)
+    {
+        w = cvcuda::AllocateWorkspace(
+            pillowResizeOp.getWorkspaceRequirements(1, {srcWidth, srcHeight}, {maxDstWidth, maxDstHeight}, fmt));
+    }
+
+    std::vector<std::vector<uint8_t>> gold(geometries.size());
+    for (int round = 0; round < 2; ++round)
+    {
+        for (size_t g = 0; g < geometries.size(); ++g)
+        {
+            SCOPED_TRACE(g);
+            auto [dstWidth, dstHeight, interpolation] = geometries[g];
+
+            int          s = static_cast<int>((round + g) % 2);
+            nvcv::Tensor imgDst(1, {dstWidth, dstHeight}, fmt);
+            ASSERT_NO_THROW(pillowResizeOp(streams[s], ws[s].get(), imgSrc, imgDst, interpolation));
+
+            auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+            ASSERT_NE(nullptr, dstData);
+            auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+            ASSERT_TRUE(dstAccess);
+
+            int                  dstRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+            std::vector<uint8_t> testVec(dstRowStride * dstHeight);
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(streams[s]));
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), dstRowStride, dstAccess->sampleData(0),
+                                                dstAccess->rowStride(), dstRowStride, dstHeight,
+                                                cudaMemcpyDeviceToHost));
+            if (round == 0)
+            {
+                gold[g] = std::move(testVec);
+            }
+            else
+            {
+                EXPECT_EQ(gold[g], testVec);
+            }
+        }
+    }
+
+    for (cudaStream_t stream : streams)
+    {
+        EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    }
+}
+
 template<typename T>
 void StartVarShapeTest(int srcWidthBase, int srcHeightBase, int dstWidthBase, int dstHeightBase,
                        NVCVInterpolationType interpolation, int numberOfImages, nvcv::ImageFormat fmt)
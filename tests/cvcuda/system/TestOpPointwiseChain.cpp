@@ -0,0 +1,389 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/OpPointwiseChain.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace util = nvcv::util;
+
+using GoldPixel = std::array<double, 4>;
+using GoldImage = std::vector<GoldPixel>;
+using GoldStage = std::function<void(GoldImage &)>;
+
+static std::default_random_engine g_rng(0); // seed 0 to fix pseudo-randomness
+
+// --------------------- Gold (reference) definitions --------------------------
+
+// The gold runs each stage separately over the whole image in double precision, as the sequence of unfused
+// operators (ConvertTo, Normalize, BrightnessContrast, ColorTwist, Reformat, ...) would, the fused operator must
+// match it up to float rounding
+
+static GoldStage GoldConvertTo(double alpha, double beta)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+            for (double &v : p) v = v * alpha + beta;
+    };
+}
+
+static GoldStage GoldNormalize(std::array<double, 4> base, std::array<double, 4> stddev)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+            for (int c = 0; c < 4; ++c) p[c] = (p[c] - base[c]) / stddev[c];
+    };
+}
+
+static GoldStage GoldBrightnessContrast(double brightness, double contrast, double contrastCenter)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+            for (double &v : p) v = (v - contrastCenter) * contrast + contrastCenter + brightness;
+    };
+}
+
+static GoldStage GoldColorTwist(std::array<std::array<double, 4>, 3> twist)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+        {
+            GoldPixel q = p;
+            for (int r = 0; r < 3; ++r)
+            {
+                q[r] = twist[r][0] * p[0] + twist[r][1] * p[1] + twist[r][2] * p[2] + twist[r][3];
+            }
+            p = q;
+        }
+    };
+}
+
+static GoldStage GoldGamma(double gamma, double range)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+            for (double &v : p) v = range * std::pow(std::max(v, 0.0) / range, gamma);
+    };
+}
+
+static GoldStage GoldClamp(double low, double high)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+            for (double &v : p) v = std::clamp(v, low, high);
+    };
+}
+
+static GoldStage GoldChannelReorder(std::array<int, 4> map, int numChannels, double fill)
+{
+    return [=](GoldImage &img)
+    {
+        for (GoldPixel &p : img)
+        {
+            GoldPixel q;
+            for (int c = 0; c < 4; ++c)
+            {
+                q[c] = map[c] < numChannels ? p[map[c]] : fill;
+            }
+            p = q;
+        }
+    };
+}
+
+template<typename T>
+static T GoldSaturate(double v)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return static_cast<T>(v);
+    }
+    else
+    {
+        return static_cast<T>(std::clamp(std::nearbyint(v), static_cast<double>(std::numeric_limits<T>::min()),
+                                         static_cast<double>(std::numeric_limits<T>::max())));
+    }
+}
+
+// --------------------- Fused steps definitions -------------------------------
+
+static NVCVPointwiseStep ScaleShift(std::array<float, 4> scale, std::array<float, 4> shift)
+{
+    NVCVPointwiseStep step{};
+    step.type = NVCV_POINTWISE_SCALE_SHIFT;
+    std::copy(scale.begin(), scale.end(), step.scale);
+    std::copy(shift.begin(), shift.end(), step.shift);
+    return step;
+}
+
+static NVCVPointwiseStep Uniform(float scale, float shift)
+{
+    return ScaleShift({scale, scale, scale, scale}, {shift, shift, shift, shift});
+}
+
+static NVCVPointwiseStep Clamp(float low, float high)
+{
+    NVCVPointwiseStep step{};
+    step.type = NVCV_POINTWISE_CLAMP;
+    step.low  = low;
+    step.high = high;
+    return step;
+}
+
+static NVCVPointwiseStep Swizzle(std::array<int32_t, 4> map)
+{
+    NVCVPointwiseStep step{};
+    step.type = NVCV_POINTWISE_SWIZZLE;
+    std::copy(map.begin(), map.end(), step.map);
+    return step;
+}
+
+static NVCVPointwiseStep Twist(std::array<std::array<double, 4>, 3> twist)
+{
+    NVCVPointwiseStep step{};
+    step.type = NVCV_POINTWISE_MATRIX;
+    for (int r = 0; r < 3; ++r)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            step.matrix[r * 4 + k] = static_cast<float>(twist[r][k]);
+        }
+        step.shift[r] = static_cast<float>(twist[r][3]);
+    }
+    step.matrix[15] = 1.f;
+    return step;
+}
+
+static NVCVPointwiseStep Gamma(float gamma, float range)
+{
+    NVCVPointwiseStep step{};
+    step.type  = NVCV_POINTWISE_GAMMA;
+    step.gamma = gamma;
+    step.range = range;
+    return step;
+}
+
+// --------------------- Test runner -------------------------------------------
+
+template<typename SrcT, typename DstT>
+static void RunPointwiseChainTest(nvcv::ImageFormat inFormat, nvcv::ImageFormat outFormat, int numSamples,
+                                  int width, int height, const std::vector<NVCVPointwiseStep> &steps,
+                                  const std::vector<GoldStage> &goldStages, double tolerance)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor inTensor  = util::CreateTensor(numSamples, width, height, inFormat);
+    nvcv::Tensor outTensor = util::CreateTensor(numSamples, width, height, outFormat);
+
+    int srcC      = inFormat.numChannels();
+    int dstC      = outFormat.numChannels();
+    int numPixels = width * height;
+
+    bool dstPlanar = outTensor.layout() == nvcv::TENSOR_NCHW || outTensor.layout() == nvcv::TENSOR_CHW;
+
+    using Dist = std::conditional_t<std::is_floating_point_v<SrcT>, std::uniform_real_distribution<SrcT>,
+                                    std::uniform_int_distribution<int>>;
+
+    Dist rand(std::is_floating_point_v<SrcT> ? SrcT{0} : std::numeric_limits<SrcT>::min(),
+              std::is_floating_point_v<SrcT> ? SrcT{255} : std::numeric_limits<SrcT>::max());
+
+    std::vector<std::vector<SrcT>> inImages(numSamples, std::vector<SrcT>(numPixels * srcC));
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        std::generate(inImages[i].begin(), inImages[i].end(), [&]() { return static_cast<SrcT>(rand(g_rng)); });
+        ASSERT_NO_THROW(util::SetImageTensorFromVector<SrcT>(inTensor.exportData(), inImages[i], i));
+    }
+
+    cvcuda::PointwiseChain op;
+    EXPECT_NO_THROW(op(stream, inTensor, outTensor, steps));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        GoldImage gold(numPixels, GoldPixel{0, 0, 0, 0});
+        for (int p = 0; p < numPixels; ++p)
+        {
+            for (int c = 0; c < srcC; ++c)
+            {
+                gold[p][c] = inImages[i][p * srcC + c];
+            }
+        }
+        for (const GoldStage &stage : goldStages)
+        {
+            stage(gold);
+        }
+
+        std::vector<DstT> outImage;
+        ASSERT_NO_THROW(util::GetImageVectorFromTensor(outTensor.exportData(), i, outImage));
+        ASSERT_EQ(outImage.size(), static_cast<size_t>(numPixels * dstC));
+
+        for (int p = 0; p < numPixels; ++p)
+        {
+            for (int c = 0; c < dstC; ++c)
+            {
+                DstT test = outImage[dstPlanar ? c * numPixels + p : p * dstC + c];
+                DstT want = GoldSaturate<DstT>(gold[p][c]);
+
+                ASSERT_NEAR(static_cast<double>(test), static_cast<double>(want), tolerance)
+                    << "At sample " << i << " pixel " << p << " channel " << c;
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+// --------------------- Tests -------------------------------------------------
+
+TEST(OpPointwiseChain, preprocess_u8_to_planar_f32)
+{
+    // ConvertTo -> Normalize -> clamp -> RGB to BGR -> Reformat to planar
+    std::array<float, 4> mean{0.485f, 0.456f, 0.406f, 0.f}, stddev{0.229f, 0.224f, 0.225f, 1.f};
+
+    std::vector<NVCVPointwiseStep> steps{
+        Uniform(1.f / 255, 0.f),
+        ScaleShift({1 / stddev[0], 1 / stddev[1], 1 / stddev[2], 1.f},
+                   {-mean[0] / stddev[0], -mean[1] / stddev[1], -mean[2] / stddev[2], 0.f}),
+        Clamp(-2.f, 2.f),
+        Swizzle({2, 1, 0, 3}),
+    };
+    std::vector<GoldStage> gold{
+        GoldConvertTo(1.0 / 255, 0.0),
+        GoldNormalize({mean[0], mean[1], mean[2], 0}, {stddev[0], stddev[1], stddev[2], 1}),
+        GoldClamp(-2, 2),
+        GoldChannelReorder({2, 1, 0, 3}, 4, 0),
+    };
+
+    RunPointwiseChainTest<uint8_t, float>(nvcv::FMT_RGB8, nvcv::FMT_RGBf32p, 3, 67, 35, steps, gold, 1e-4);
+}
+
+TEST(OpPointwiseChain, color_u8_to_u8_with_alpha)
+{
+    // BrightnessContrast -> ColorTwist (adding an opaque alpha channel) -> GammaContrast
+    std::array<std::array<double, 4>, 3> twist{
+        {{0.9, 0.1, 0.0, 5.0}, {0.05, 0.9, 0.05, -3.0}, {0.0, 0.2, 0.8, 1.0}}
+    };
+
+    NVCVPointwiseStep twistStep = Twist(twist);
+    twistStep.matrix[15]        = 0.f;
+    twistStep.shift[3]          = 255.f;
+
+    std::vector<NVCVPointwiseStep> steps{
+        Uniform(1.25f, 10.f - 128.f * 0.25f),
+        twistStep,
+        Gamma(0.8f, 255.f),
+    };
+    std::vector<GoldStage> gold{
+        GoldBrightnessContrast(10, 1.25, 128),
+        GoldColorTwist(twist),
+        [](GoldImage &img)
+        {
+            for (GoldPixel &p : img) p[3] = 255;
+        },
+        GoldGamma(0.8, 255),
+    };
+
+    RunPointwiseChainTest<uint8_t, uint8_t>(nvcv::FMT_RGB8, nvcv::FMT_RGBA8, 2, 128, 31, steps, gold, 1);
+}
+
+TEST(OpPointwiseChain, gray_s16_to_rgb_u8)
+{
+    // ConvertTo with saturation then a broadcast of the single channel to three
+    std::vector<NVCVPointwiseStep> steps{
+        Uniform(1.f / 256, 128.f),
+        Swizzle({0, 0, 0, 0}),
+    };
+    std::vector<GoldStage> gold{
+        GoldConvertTo(1.0 / 256, 128),
+        GoldChannelReorder({0, 0, 0, 0}, 1, 0),
+    };
+
+    RunPointwiseChainTest<int16_t, uint8_t>(nvcv::FMT_S16, nvcv::FMT_RGB8, 2, 33, 17, steps, gold, 1);
+}
+
+TEST(OpPointwiseChain, empty_chain_converts_u16_to_f32)
+{
+    RunPointwiseChainTest<uint16_t, float>(nvcv::FMT_U16, nvcv::FMT_F32, 4, 19, 23, {}, {}, 0);
+}
+
+TEST(OpPointwiseChain, f32_to_planar_f32_with_matrix)
+{
+    std::array<std::array<double, 4>, 3> twist{
+        {{0.299, 0.587, 0.114, 0.0}, {-0.169, -0.331, 0.5, 128.0}, {0.5, -0.419, -0.081, 128.0}}
+    };
+
+    RunPointwiseChainTest<float, float>(nvcv::FMT_RGBf32, nvcv::FMT_RGBf32p, 2, 40, 40, {Twist(twist)},
+                                        {GoldColorTwist(twist)}, 1e-3);
+}
+
+TEST(OpPointwiseChain, invalid_arguments)
+{
+    nvcv::Tensor in      = util::CreateTensor(2, 32, 16, nvcv::FMT_RGB8);
+    nvcv::Tensor out     = util::CreateTensor(2, 32, 16, nvcv::FMT_RGBf32p);
+    nvcv::Tensor outBig  = util::CreateTensor(2, 33, 16, nvcv::FMT_RGB8);
+    nvcv::Tensor outN    = util::CreateTensor(3, 32, 16, nvcv::FMT_RGB8);
+    nvcv::Tensor outF64  = util::CreateTensor(2, 32, 16, nvcv::FMT_F64);
+    nvcv::Tensor inPlane = util::CreateTensor(2, 32, 16, nvcv::FMT_RGBf32p);
+
+    cvcuda::PointwiseChain op;
+
+    NVCVPointwiseStep badType = Uniform(1.f, 0.f);
+    badType.type              = static_cast<NVCVPointwiseStepType>(99);
+
+#define NVCV_TEST_INVALID(...) \
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { op(nullptr, __VA_ARGS__); }))
+
+    NVCV_TEST_INVALID(in, outBig, {});
+    NVCV_TEST_INVALID(in, outN, {});
+    NVCV_TEST_INVALID(in, outF64, {});
+    NVCV_TEST_INVALID(inPlane, out, {});
+    NVCV_TEST_INVALID(in, out, std::vector<NVCVPointwiseStep>(17, Uniform(1.f, 0.f)));
+    NVCV_TEST_INVALID(in, out, {badType});
+    NVCV_TEST_INVALID(in, out, {Swizzle({0, 1, 4, 3})});
+    NVCV_TEST_INVALID(in, out, {Gamma(2.f, 0.f)});
+
+#undef NVCV_TEST_INVALID
+
+    NVCVPointwiseStep step = Uniform(1.f, 0.f);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaPointwiseChainSubmit(op.handle(), nullptr, in.handle(), out.handle(), nullptr, 1));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaPointwiseChainSubmit(op.handle(), nullptr, in.handle(), out.handle(), &step, -1));
+}
+
+TEST(OpPointwiseChain_Negative, create_null_handle)
+{
+    EXPECT_EQ(cvcudaPointwiseChainCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
+}
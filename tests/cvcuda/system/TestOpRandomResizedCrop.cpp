@@ -23,6 +23,7 @@
 #include <common/ValueTests.hpp>
 #include <cvcuda/OpRandomResizedCrop.hpp>
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
+#include <cvcuda/cuda_tools/Philox.hpp>
 #include <cvcuda/cuda_tools/SaturateCast.hpp>
 #include <nvcv/Image.hpp>
 #include <nvcv/ImageBatch.hpp>
@@ -36,9 +37,9 @@ namespace cuda = nvcv::cuda;
 namespace test = nvcv::test;
 namespace t    = ::testing;
 
-static void GetCropParams(std::mt19937 &generator, double minScale, double maxScale, double minRatio, double maxRatio,
-                          int input_rows, int input_cols, int *top_indices, int *left_indices, int *crop_rows,
-                          int *crop_cols)
+static void GetCropParams(uint32_t seed, uint32_t epoch, int sample, double minScale, double maxScale, double minRatio,
+                          double maxRatio, int input_rows, int input_cols, int *top_indices, int *left_indices,
+                          int *crop_rows, int *crop_cols)
 {
     int          rows          = input_rows;
     int          cols          = input_cols;
@@ -46,25 +47,22 @@ static void GetCropParams(std::mt19937 &generator, double minScale, double maxSc
     const double log_min_ratio = std::log(minRatio);
     const double log_max_ratio = std::log(maxRatio);
 
-    std::uniform_real_distribution<double> scale_dist(minScale, maxScale);
-    std::uniform_real_distribution<double> ratio_dist(log_min_ratio, log_max_ratio);
-    bool                                   got_params = false;
+    cuda::Philox rng(seed, sample, 0, epoch);
+    bool         got_params = false;
     for (int i = 0; i < 10; ++i)
     {
         if (got_params)
             return;
-        int    target_area  = area * scale_dist(generator);
-        double aspect_ratio = std::exp(ratio_dist(generator));
+        int    target_area  = area * (minScale + (maxScale - minScale) * rng.uniformDouble());
+        double aspect_ratio = std::exp(log_min_ratio + (log_max_ratio - log_min_ratio) * rng.uniformDouble());
 
         *crop_cols = int(std::round(std::sqrt(target_area * aspect_ratio)));
         *crop_rows = int(std::round(std::sqrt(target_area / aspect_ratio)));
 
         if (*crop_cols > 0 && *crop_cols <= cols && *crop_rows > 0 && *crop_rows <= rows)
         {
-            std::uniform_int_distribution<int> row_uni(0, rows - *crop_rows);
-            std::uniform_int_distribution<int> col_uni(0, cols - *crop_cols);
-            *top_indices  = row_uni(generator);
-            *left_indices = col_uni(generator);
+            *top_indices  = rng.uniformInt(0, rows - *crop_rows);
+            *left_indices = rng.uniformInt(0, cols - *crop_cols);
             got_params    = true;
         }
     }
@@ -186,8 +184,6 @@ TEST_P(OpRandomResizedCrop, tensor_correct_output)
 
     int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
 
-    std::mt19937 generator(seed);
-
     for (int i = 0; i < numberOfImages; ++i)
     {
         SCOPED_TRACE(i);
@@ -201,8 +197,8 @@ TEST_P(OpRandomResizedCrop, tensor_correct_output)
                                dstHeight, cudaMemcpyDeviceToHost));
 
         int top, left, crop_rows, crop_cols;
-        GetCropParams(generator, minScale, maxScale, minRatio, maxRatio, srcHeight, srcWidth, &top, &left, &crop_rows,
-                      &crop_cols);
+        GetCropParams(seed, 0, i, minScale, maxScale, minRatio, maxRatio, srcHeight, srcWidth, &top, &left,
+                      &crop_rows, &crop_cols);
 
         std::vector<uint8_t> goldVec(dstHeight * dstVecRowStride);
 
@@ -302,8 +298,6 @@ TEST_P(OpRandomResizedCrop, varshape_correct_output)
     EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
     EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 
-    std::mt19937 generator(seed);
-
     // Check test data against gold
     for (int i = 0; i < numberOfImages; ++i)
     {
@@ -331,8 +325,8 @@ TEST_P(OpRandomResizedCrop, varshape_correct_output)
                                dstHeight, cudaMemcpyDeviceToHost));
 
         int top, left, crop_rows, crop_cols;
-        GetCropParams(generator, minScale, maxScale, minRatio, maxRatio, srcHeight, srcWidth, &top, &left, &crop_rows,
-                      &crop_cols);
+        GetCropParams(seed, 0, i, minScale, maxScale, minRatio, maxRatio, srcHeight, srcWidth, &top, &left,
+                      &crop_rows, &crop_cols);
 
         std::vector<uint8_t> goldVec(dstHeight * dstRowStride);
 
@@ -377,6 +371,228 @@ TEST(OpRandomResizedCrop_negative, createWithInvalidRatio)
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaRandomResizedCropCreate(&opHandle, 0.2, 1.0, 1.3, 0.8, 2, 0));
 }
 
+static std::vector<int4> GetCrops(const nvcv::Tensor &crops)
+{
+    auto              data = crops.exportData<nvcv::TensorDataStridedCuda>();
+    std::vector<int4> vec(data->shape(0));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data->basePtr(), vec.size() * sizeof(int4), cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+TEST(OpRandomResizedCrop, tensor_exported_crops_follow_seed_and_call)
+{
+    int srcWidth = 320, srcHeight = 240, numberOfImages = 5;
+
+    double minScale = 0.08;
+    double maxScale = 1.0;
+    double minRatio = 3.0 / 4;
+    double maxRatio = 4.0 / 3;
+
+    nvcv::Tensor imgSrc = nvcv::util::CreateTensor(numberOfImages, srcWidth, srcHeight, nvcv::FMT_RGB8);
+    nvcv::Tensor imgDst = nvcv::util::CreateTensor(numberOfImages, 64, 64, nvcv::FMT_RGB8);
+    nvcv::Tensor crops({{numberOfImages}, "N"}, nvcv::TYPE_4S32);
+
+    uint32_t                  seed = 123;
+    cvcuda::RandomResizedCrop randomResizedCropOp(minScale, maxScale, minRatio, maxRatio, numberOfImages, seed);
+
+    // Each call draws new crops, the exported crops are the ones the host reference draws for that call
+    for (uint32_t epoch = 0; epoch < 2; ++epoch)
+    {
+        SCOPED_TRACE(epoch);
+
+        EXPECT_NO_THROW(randomResizedCropOp(nullptr, imgSrc, imgDst, NVCV_INTERP_LINEAR, nvcv::NullOpt, crops));
+        ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+        std::vector<int4> testCrops = GetCrops(crops);
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            int top, left, crop_rows, crop_cols;
+            GetCropParams(seed, epoch, i, minScale, maxScale, minRatio, maxRatio, srcHeight, srcWidth, &top, &left,
+                          &crop_rows, &crop_cols);
+
+            EXPECT_EQ(testCrops[i].x, left);
+            EXPECT_EQ(testCrops[i].y, top);
+            EXPECT_EQ(testCrops[i].z, crop_cols);
+            EXPECT_EQ(testCrops[i].w, crop_rows);
+        }
+    }
+}
+
+TEST(OpRandomResizedCrop, tensor_user_crops)
+{
+    int srcWidth = 97, srcHeight = 61, dstWidth = 40, dstHeight = 30, numberOfImages = 3;
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc = nvcv::util::CreateTensor(numberOfImages, srcWidth, srcHeight, fmt);
+    nvcv::Tensor imgDst = nvcv::util::CreateTensor(numberOfImages, dstWidth, dstHeight, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(srcData && dstData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess && dstAccess);
+
+    int srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        srcVec[i].resize(srcHeight * srcVecRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    // The last crop goes past the image and is clipped to it
+    std::vector<int4> userCrops{{10, 5, 50, 40}, {0, 0, 97, 61}, {80, 50, 40, 30}};
+    std::vector<int4> clippedCrops{{10, 5, 50, 40}, {0, 0, 97, 61}, {80, 50, 17, 11}};
+
+    nvcv::Tensor inCrops({{numberOfImages, 4}, "NC"}, nvcv::TYPE_S32);
+    nvcv::Tensor outCrops({{numberOfImages, 4}, "NC"}, nvcv::TYPE_S32);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inCrops.exportData<nvcv::TensorDataStridedCuda>()->basePtr(), userCrops.data(),
+                                      userCrops.size() * sizeof(int4), cudaMemcpyHostToDevice));
+
+    cvcuda::RandomResizedCrop randomResizedCropOp(0.08, 1.0, 3.0 / 4, 4.0 / 3, numberOfImages, 1);
+    EXPECT_NO_THROW(randomResizedCropOp(nullptr, imgSrc, imgDst, NVCV_INTERP_LINEAR, inCrops, outCrops));
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+    std::vector<int4> testCrops = GetCrops(outCrops);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const int4 &crop = clippedCrops[i];
+        EXPECT_EQ(testCrops[i].x, crop.x);
+        EXPECT_EQ(testCrops[i].y, crop.y);
+        EXPECT_EQ(testCrops[i].z, crop.z);
+        EXPECT_EQ(testCrops[i].w, crop.w);
+
+        std::vector<uint8_t> testVec(dstHeight * dstVecRowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), dstVecRowStride, dstAccess->sampleData(i),
+                                            dstAccess->rowStride(), dstVecRowStride, dstHeight,
+                                            cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(dstHeight * dstVecRowStride);
+        test::ResizedCrop(goldVec, dstVecRowStride, {dstWidth, dstHeight}, srcVec[i], srcVecRowStride,
+                          {srcWidth, srcHeight}, crop.y, crop.x, crop.w, crop.z, fmt, NVCV_INTERP_LINEAR);
+
+        std::vector<int> mae(testVec.size());
+        for (size_t j = 0; j < mae.size(); ++j)
+        {
+            mae[j] = abs(static_cast<int>(goldVec[j]) - static_cast<int>(testVec[j]));
+        }
+        EXPECT_THAT(mae, t::Each(t::Le(1)));
+    }
+}
+
+TEST(OpRandomResizedCrop, tensor_streams_sharing_operator)
+{
+    int srcWidth = 97, srcHeight = 61, dstWidth = 40, dstHeight = 30, numberOfImages = 3;
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc = nvcv::util::CreateTensor(numberOfImages, srcWidth, srcHeight, fmt);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::vector<uint8_t> srcVec(srcHeight * srcWidth * fmt.planePixelStrideBytes(0));
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_NO_THROW(nvcv::util::SetImageTensorFromVector<uint8_t>(imgSrc.exportData(), srcVec, i));
+    }
+
+    // Each stream resizes its own crops, the crop parameters computed for one stream must not be overwritten by the
+    // other stream before its resize kernel reads them
+    constexpr int kNumStreams = 2, kNumCalls = 20;
+
+    std::vector<std::vector<int4>> userCrops{
+        {{10, 5, 50, 40}, {0, 0, 97, 61}, {30, 20, 17, 11}},
+        {{60, 30, 37, 31}, {5, 7, 20, 50}, {0, 40, 97, 21}}
+    };
+
+    std::vector<nvcv::Tensor> inCrops, imgDst, imgGold;
+    for (int k = 0; k < kNumStreams; ++k)
+    {
+        inCrops.emplace_back(nvcv::TensorShape{{numberOfImages, 4}, "NC"}, nvcv::TYPE_S32);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy(inCrops[k].exportData<nvcv::TensorDataStridedCuda>()->basePtr(), userCrops[k].data(),
+                             userCrops[k].size() * sizeof(int4), cudaMemcpyHostToDevice));
+
+        imgDst.push_back(nvcv::util::CreateTensor(numberOfImages, dstWidth, dstHeight, fmt));
+        imgGold.push_back(nvcv::util::CreateTensor(numberOfImages, dstWidth, dstHeight, fmt));
+
+        cvcuda::RandomResizedCrop goldOp(0.08, 1.0, 3.0 / 4, 4.0 / 3, numberOfImages, 1);
+        EXPECT_NO_THROW(goldOp(nullptr, imgSrc, imgGold[k], NVCV_INTERP_LINEAR, inCrops[k], nvcv::NullOpt));
+    }
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+    cudaStream_t streams[kNumStreams];
+    for (auto &stream : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    }
+
+    cvcuda::RandomResizedCrop randomResizedCropOp(0.08, 1.0, 3.0 / 4, 4.0 / 3, numberOfImages, 1);
+    for (int call = 0; call < kNumCalls; ++call)
+    {
+        for (int k = 0; k < kNumStreams; ++k)
+        {
+            EXPECT_NO_THROW(
+                randomResizedCropOp(streams[k], imgSrc, imgDst[k], NVCV_INTERP_LINEAR, inCrops[k], nvcv::NullOpt));
+        }
+    }
+
+    for (auto &stream : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    }
+
+    for (int k = 0; k < kNumStreams; ++k)
+    {
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            SCOPED_TRACE(k * numberOfImages + i);
+
+            std::vector<uint8_t> testVec, goldVec;
+            ASSERT_NO_THROW(nvcv::util::GetImageVectorFromTensor(imgDst[k].exportData(), i, testVec));
+            ASSERT_NO_THROW(nvcv::util::GetImageVectorFromTensor(imgGold[k].exportData(), i, goldVec));
+            EXPECT_EQ(goldVec, testVec);
+        }
+    }
+}
+
+TEST(OpRandomResizedCrop_negative, invalidCrops)
+{
+    nvcv::Tensor imgSrc = nvcv::util::CreateTensor(2, 24, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor imgDst = nvcv::util::CreateTensor(2, 12, 12, nvcv::FMT_RGB8);
+
+    nvcv::Tensor wrongSamples({{3}, "N"}, nvcv::TYPE_4S32);
+    nvcv::Tensor wrongType({{2}, "N"}, nvcv::TYPE_4F32);
+    nvcv::Tensor wrongElements({{2, 3}, "NC"}, nvcv::TYPE_S32);
+
+    cvcuda::RandomResizedCrop randomResizedCropOp(0.08, 1.0, 3.0 / 4, 4.0 / 3, 2, 1);
+    for (const nvcv::Tensor *crops : {&wrongSamples, &wrongType, &wrongElements})
+    {
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+                  nvcv::ProtectCall([&]
+                                    { randomResizedCropOp(nullptr, imgSrc, imgDst, NVCV_INTERP_LINEAR, *crops, {}); }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+                  nvcv::ProtectCall([&]
+                                    { randomResizedCropOp(nullptr, imgSrc, imgDst, NVCV_INTERP_LINEAR, {}, *crops); }));
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpRandomResizedCrop_negative, nvcv::test::ValueList<std::string, nvcv::DataType, std::string, nvcv::DataType, NVCVInterpolationType, int>
 {
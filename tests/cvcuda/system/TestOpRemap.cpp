@@ -28,6 +28,10 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <cuda_fp16.h>
+
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -384,6 +388,354 @@ TYPED_TEST(OpRemap, varshape_correct_output)
     }
 }
 
+// Compact map formats tests ---------------------------------------------------
+
+// Host reference of the fixed-point map encoding: integer {x, y} position plus a fractional index (fy << 5 | fx).
+static short3 EncodeFixedPointMap(const float2 &v)
+{
+    int x = static_cast<int>(std::nearbyint(v.x * 32.f));
+    int y = static_cast<int>(std::nearbyint(v.y * 32.f));
+
+    return short3{static_cast<short>(std::clamp(x >> 5, -32768, 32767)),
+                  static_cast<short>(std::clamp(y >> 5, -32768, 32767)),
+                  static_cast<short>(((y & 31) << 5) | (x & 31))};
+}
+
+static float2 DecodeFixedPointMap(const short3 &v)
+{
+    return float2{v.x + (v.z & 31) / 32.f, v.y + ((v.z >> 5) & 31) / 32.f};
+}
+
+template<NVCVInterpolationType SI, NVCVInterpolationType MI>
+void TestCompactMap(const int3 &shape, NVCVRemapMapValueType mapValueType, bool halfMap)
+{
+    using ValueType = uchar3;
+
+    constexpr NVCVBorderType kBorderType  = NVCV_BORDER_REPLICATE;
+    const float4             borderValue  = nvcv::cuda::SetAll<float4>(0.f);
+    const bool               alignCorners = false;
+
+    nvcv::Tensor srcTensor = nvcv::util::CreateTensor(shape.z, shape.x, shape.y, nvcv::FMT_RGB8);
+    nvcv::Tensor dstTensor = nvcv::util::CreateTensor(shape.z, shape.x, shape.y, nvcv::FMT_RGB8);
+    nvcv::Tensor mapTensor = halfMap ? nvcv::util::CreateTensor(shape.z, shape.x, shape.y, nvcv::FMT_2F16)
+                                     : nvcv::Tensor({{shape.z, shape.y, shape.x, 3}, "NHWC"}, nvcv::TYPE_S16);
+
+    auto srcData = srcTensor.exportData<nvcv::TensorDataStridedCuda>();
+    auto dstData = dstTensor.exportData<nvcv::TensorDataStridedCuda>();
+    auto mapData = mapTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(srcData && dstData && mapData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto mapAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*mapData);
+    ASSERT_TRUE(srcAccess && mapAccess);
+
+    long3 srcStrides{srcAccess->sampleStride(), srcAccess->rowStride(), srcAccess->colStride()};
+    long3 mapStrides{mapAccess->sampleStride(), mapAccess->rowStride(), mapAccess->colStride()};
+
+    // The reference map holds the decoded float2 values in a dense buffer
+    const long kMapElemSize = sizeof(float2);
+    long3      refMapStrides{shape.y * shape.x * kMapElemSize, shape.x * kMapElemSize, kMapElemSize};
+
+    std::vector<uint8_t> srcVec(srcStrides.x * shape.z);
+    std::vector<uint8_t> dstVec(srcStrides.x * shape.z);
+    std::vector<uint8_t> refVec(srcStrides.x * shape.z);
+    std::vector<uint8_t> mapVec(mapStrides.x * shape.z);
+    std::vector<uint8_t> refMapVec(refMapStrides.x * shape.z);
+
+    std::uniform_int_distribution<int> randu8(0, 255);
+    std::uniform_int_distribution<int> randFrac(0, 31);
+    std::uniform_int_distribution<int> randX(-2, shape.x + 1);
+    std::uniform_int_distribution<int> randY(-2, shape.y + 1);
+    std::uniform_int_distribution<int> randHalf(-1024, 1024);
+
+    for (int z = 0; z < shape.z; ++z)
+    {
+        for (int y = 0; y < shape.y; ++y)
+        {
+            for (int x = 0; x < shape.x; ++x)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    cuda::GetElement(test::ValueAt<ValueType>(srcVec, srcStrides, int3{x, y, z}), k) = randu8(g_rng);
+                }
+
+                float2 &refValue = test::ValueAt<float2>(refMapVec, refMapStrides, int3{x, y, z});
+
+                if (halfMap)
+                {
+                    // Multiples of 1/1024 in [-1, 1] are exact in half precision
+                    refValue = float2{randHalf(g_rng) / 1024.f, randHalf(g_rng) / 1024.f};
+
+                    __half_raw hx = __float2half(refValue.x), hy = __float2half(refValue.y);
+
+                    test::ValueAt<ushort2>(mapVec, mapStrides, int3{x, y, z}) = ushort2{hx.x, hy.x};
+                }
+                else
+                {
+                    short3 value{static_cast<short>(randX(g_rng)), static_cast<short>(randY(g_rng)),
+                                 static_cast<short>((randFrac(g_rng) << 5) | randFrac(g_rng))};
+
+                    refValue = DecodeFixedPointMap(value);
+
+                    test::ValueAt<short3>(mapVec, mapStrides, int3{x, y, z}) = value;
+                }
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(mapData->basePtr(), mapVec.data(), mapVec.size(), cudaMemcpyHostToDevice));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Remap op;
+    EXPECT_NO_THROW(op(stream, srcTensor, dstTensor, mapTensor, SI, MI, mapValueType, alignCorners, kBorderType,
+                       borderValue));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(dstVec.data(), dstData->basePtr(), dstVec.size(), cudaMemcpyDeviceToHost));
+
+    Remap<SI, MI, kBorderType, ValueType>(srcVec, refVec, refMapVec, srcStrides, srcStrides, refMapStrides, shape,
+                                          shape, shape, mapValueType, alignCorners, borderValue);
+
+    VEC_EXPECT_NEAR(dstVec, refVec, 1);
+}
+
+TEST(OpRemap_CompactMap, fixed_point_nearest_map)
+{
+    TestCompactMap<NVCV_INTERP_LINEAR, NVCV_INTERP_NEAREST>(int3{37, 29, 2}, NVCV_REMAP_ABSOLUTE, false);
+}
+
+TEST(OpRemap_CompactMap, fixed_point_linear_map)
+{
+    TestCompactMap<NVCV_INTERP_CUBIC, NVCV_INTERP_LINEAR>(int3{37, 29, 2}, NVCV_REMAP_ABSOLUTE, false);
+}
+
+TEST(OpRemap_CompactMap, half_relative_map)
+{
+    TestCompactMap<NVCV_INTERP_LINEAR, NVCV_INTERP_LINEAR>(int3{41, 23, 1}, NVCV_REMAP_RELATIVE_NORMALIZED, true);
+}
+
+TEST(OpRemap_CompactMap, half_absolute_normalized_map)
+{
+    TestCompactMap<NVCV_INTERP_NEAREST, NVCV_INTERP_CUBIC>(int3{41, 23, 3}, NVCV_REMAP_ABSOLUTE_NORMALIZED, true);
+}
+
+// Make map tests --------------------------------------------------------------
+
+// Host reference of the remap models, in double precision.
+static double2 RemapModelGold(const NVCVRemapModel &model, double px, double py)
+{
+    const float *M = model.matrix;
+
+    if (model.type == NVCV_REMAP_MODEL_PERSPECTIVE)
+    {
+        double m[9];
+        for (int i = 0; i < 9; ++i)
+        {
+            m[i] = M[i];
+        }
+
+        if (!model.inverseMap)
+        {
+            double det = m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6])
+                       + m[2] * (m[3] * m[7] - m[4] * m[6]);
+
+            double inv[9] = {(m[4] * m[8] - m[5] * m[7]) / det, (m[2] * m[7] - m[1] * m[8]) / det,
+                             (m[1] * m[5] - m[2] * m[4]) / det, (m[5] * m[6] - m[3] * m[8]) / det,
+                             (m[0] * m[8] - m[2] * m[6]) / det, (m[2] * m[3] - m[0] * m[5]) / det,
+                             (m[3] * m[7] - m[4] * m[6]) / det, (m[1] * m[6] - m[0] * m[7]) / det,
+                             (m[0] * m[4] - m[1] * m[3]) / det};
+
+            std::copy(inv, inv + 9, m);
+        }
+
+        double w = m[6] * px + m[7] * py + m[8];
+
+        return double2{(m[0] * px + m[1] * py + m[2]) / w, (m[3] * px + m[4] * py + m[5]) / w};
+    }
+
+    const float *N = model.newCamera;
+    const float *d = model.distortion;
+
+    double x  = (px - N[2]) / N[0];
+    double y  = (py - N[5]) / N[4];
+    double r2 = x * x + y * y;
+    double qx, qy;
+
+    if (model.type == NVCV_REMAP_MODEL_PINHOLE)
+    {
+        double kr = 1 + d[0] * r2 + d[1] * r2 * r2 + d[4] * r2 * r2 * r2;
+
+        qx = x * kr + 2 * d[2] * x * y + d[3] * (r2 + 2 * x * x);
+        qy = y * kr + d[2] * (r2 + 2 * y * y) + 2 * d[3] * x * y;
+    }
+    else
+    {
+        double r      = std::sqrt(r2);
+        double theta  = std::atan(r);
+        double t2     = theta * theta;
+        double thetaD = theta * (1 + d[0] * t2 + d[1] * t2 * t2 + d[2] * t2 * t2 * t2 + d[3] * t2 * t2 * t2 * t2);
+        double scale  = r > 1e-8 ? thetaD / r : 1;
+
+        qx = x * scale;
+        qy = y * scale;
+    }
+
+    return double2{M[0] * qx + M[1] * qy + M[2], M[4] * qy + M[5]};
+}
+
+static NVCVRemapModel MakeTestModel(NVCVRemapModelType type, bool inverseMap)
+{
+    NVCVRemapModel model{};
+
+    model.type       = type;
+    model.inverseMap = inverseMap;
+
+    if (type == NVCV_REMAP_MODEL_PERSPECTIVE)
+    {
+        const float xform[9] = {0.9f, 0.1f, 3.f, -0.05f, 1.1f, -2.f, 0.0005f, 0.0002f, 1.f};
+        std::copy(xform, xform + 9, model.matrix);
+    }
+    else
+    {
+        const float camera[9]    = {60.f, 0.f, 32.f, 0.f, 58.f, 24.f, 0.f, 0.f, 1.f};
+        const float newCamera[9] = {50.f, 0.f, 31.5f, 0.f, 50.f, 23.5f, 0.f, 0.f, 1.f};
+        const float pinhole[5]   = {-0.2f, 0.05f, 0.001f, -0.002f, 0.01f};
+        const float fisheye[5]   = {0.05f, -0.01f, 0.002f, -0.0005f, 0.f};
+
+        std::copy(camera, camera + 9, model.matrix);
+        std::copy(newCamera, newCamera + 9, model.newCamera);
+        std::copy(type == NVCV_REMAP_MODEL_PINHOLE ? pinhole : fisheye,
+                  (type == NVCV_REMAP_MODEL_PINHOLE ? pinhole : fisheye) + 5, model.distortion);
+    }
+
+    return model;
+}
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpRemap_MakeMap, test::ValueList<NVCVRemapModelType, bool, bool>{
+    // modelType, inverseMap, fixedPoint
+    {NVCV_REMAP_MODEL_PERSPECTIVE, false, false},
+    {NVCV_REMAP_MODEL_PERSPECTIVE,  true, false},
+    {NVCV_REMAP_MODEL_PERSPECTIVE, false,  true},
+    {    NVCV_REMAP_MODEL_PINHOLE, false, false},
+    {    NVCV_REMAP_MODEL_PINHOLE, false,  true},
+    {    NVCV_REMAP_MODEL_FISHEYE, false, false},
+    {    NVCV_REMAP_MODEL_FISHEYE, false,  true},
+});
+
+// clang-format on
+
+TEST_P(OpRemap_MakeMap, correct_output)
+{
+    const NVCVRemapModelType modelType  = GetParamValue<0>();
+    const bool               inverseMap = GetParamValue<1>();
+    const bool               fixedPoint = GetParamValue<2>();
+
+    const int3 shape{64, 48, 2};
+
+    const NVCVRemapModel model = MakeTestModel(modelType, inverseMap);
+
+    nvcv::Tensor mapTensor = fixedPoint ? nvcv::Tensor({{shape.z, shape.y, shape.x, 3}, "NHWC"}, nvcv::TYPE_S16)
+                                        : nvcv::util::CreateTensor(shape.z, shape.x, shape.y, nvcv::FMT_2F32);
+
+    auto mapData = mapTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(mapData);
+
+    auto mapAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*mapData);
+    ASSERT_TRUE(mapAccess);
+
+    long3 mapStrides{mapAccess->sampleStride(), mapAccess->rowStride(), mapAccess->colStride()};
+
+    std::vector<uint8_t> mapVec(mapStrides.x * shape.z);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Remap op;
+    EXPECT_NO_THROW(op.makeMap(stream, mapTensor, model));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(mapVec.data(), mapData->basePtr(), mapVec.size(), cudaMemcpyDeviceToHost));
+
+    // Fixed-point maps may differ from the reference by half of the fractional step, plus float error
+    const double tolerance = fixedPoint ? 0.5 / 32 + 1e-2 : 1e-2;
+
+    for (int z = 0; z < shape.z; ++z)
+    {
+        for (int y = 0; y < shape.y; ++y)
+        {
+            for (int x = 0; x < shape.x; ++x)
+            {
+                double2 gold = RemapModelGold(model, x, y);
+
+                float2 value = fixedPoint
+                                 ? DecodeFixedPointMap(test::ValueAt<short3>(mapVec, mapStrides, int3{x, y, z}))
+                                 : test::ValueAt<float2>(mapVec, mapStrides, int3{x, y, z});
+
+                ASSERT_NEAR(value.x, gold.x, tolerance) << "at " << x << ", " << y << ", " << z;
+                ASSERT_NEAR(value.y, gold.y, tolerance) << "at " << x << ", " << y << ", " << z;
+            }
+        }
+    }
+}
+
+TEST(OpRemap_MakeMap, fixed_point_encoding_matches_host_reference)
+{
+    const int3 shape{32, 16, 1};
+
+    const NVCVRemapModel model = MakeTestModel(NVCV_REMAP_MODEL_PERSPECTIVE, true);
+
+    nvcv::Tensor floatMap = nvcv::util::CreateTensor(shape.z, shape.x, shape.y, nvcv::FMT_2F32);
+    nvcv::Tensor fixedMap({{shape.z, shape.y, shape.x, 3}, "NHWC"}, nvcv::TYPE_S16);
+
+    auto floatData = floatMap.exportData<nvcv::TensorDataStridedCuda>();
+    auto fixedData = fixedMap.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(floatData && fixedData);
+
+    auto floatAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*floatData);
+    auto fixedAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*fixedData);
+    ASSERT_TRUE(floatAccess && fixedAccess);
+
+    long3 floatStrides{floatAccess->sampleStride(), floatAccess->rowStride(), floatAccess->colStride()};
+    long3 fixedStrides{fixedAccess->sampleStride(), fixedAccess->rowStride(), fixedAccess->colStride()};
+
+    std::vector<uint8_t> floatVec(floatStrides.x * shape.z);
+    std::vector<uint8_t> fixedVec(fixedStrides.x * shape.z);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Remap op;
+    EXPECT_NO_THROW(op.makeMap(stream, floatMap, model));
+    EXPECT_NO_THROW(op.makeMap(stream, fixedMap, model));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(floatVec.data(), floatData->basePtr(), floatVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(fixedVec.data(), fixedData->basePtr(), fixedVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int y = 0; y < shape.y; ++y)
+    {
+        for (int x = 0; x < shape.x; ++x)
+        {
+            short3 gold  = EncodeFixedPointMap(test::ValueAt<float2>(floatVec, floatStrides, int3{x, y, 0}));
+            short3 value = test::ValueAt<short3>(fixedVec, fixedStrides, int3{x, y, 0});
+
+            EXPECT_EQ(value.x, gold.x) << "at " << x << ", " << y;
+            EXPECT_EQ(value.y, gold.y) << "at " << x << ", " << y;
+            EXPECT_EQ(value.z, gold.z) << "at " << x << ", " << y;
+        }
+    }
+}
+
 #define NVCV_IMAGE_FORMAT_INVALID_MAP NVCV_DETAIL_MAKE_NONCOLOR_FMT2(PL, FLOAT, XYZW, ASSOCIATED, X32_Y32, X32_Y32)
 
 // clang-format off
@@ -396,6 +748,7 @@ NVCV_TEST_SUITE_P(OpRemap_Negative, test::ValueList<int, int, int, int, int, int
     {42, 42, 1, 42, 42, 1, 2, 2, 1, nvcv::FMT_RGB8p, nvcv::FMT_RGB8p, nvcv::FMT_2F32, NVCV_INTERP_NEAREST, NVCV_INTERP_NEAREST, NVCV_BORDER_CONSTANT},
     {42, 42, 1, 42, 42, 1, 2, 2, 1, nvcv::FMT_RGB8, nvcv::FMT_RGBf32, nvcv::FMT_2F32, NVCV_INTERP_NEAREST, NVCV_INTERP_NEAREST, NVCV_BORDER_CONSTANT},
     {42, 42, 1, 42, 42, 1, 2, 2, 1, nvcv::FMT_RGB8, nvcv::FMT_RGB8, nvcv::FMT_RGBf32, NVCV_INTERP_NEAREST, NVCV_INTERP_NEAREST, NVCV_BORDER_CONSTANT},
+    {42, 42, 1, 42, 42, 1, 2, 2, 1, nvcv::FMT_RGB8, nvcv::FMT_RGB8, nvcv::FMT_2S16, NVCV_INTERP_NEAREST, NVCV_INTERP_NEAREST, NVCV_BORDER_CONSTANT},
     {42, 42, 1, 42, 42, 1, 2, 2, 1, nvcv::FMT_RGBf16, nvcv::FMT_RGBf16, nvcv::FMT_2F32, NVCV_INTERP_NEAREST, NVCV_INTERP_NEAREST, NVCV_BORDER_CONSTANT},
 #ifndef ENABLE_SANITIZER
     {42, 42, 1, 42, 42, 1, 2, 2, 1, nvcv::FMT_RGB8, nvcv::FMT_RGB8, nvcv::FMT_2F32, NVCV_INTERP_NEAREST, NVCV_INTERP_NEAREST, static_cast<NVCVBorderType>(255)},
@@ -606,4 +959,57 @@ TEST(OpOpRemap_Negative, create_null_handle)
     EXPECT_EQ(cvcudaRemapCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
 }
 
+TEST(OpRemap_Negative, compact_map_wrong_value_type)
+{
+    nvcv::Tensor srcTensor = nvcv::util::CreateTensor(1, 24, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor dstTensor = nvcv::util::CreateTensor(1, 24, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor fixedMap({{1, 24, 24, 3}, "NHWC"}, nvcv::TYPE_S16);
+    nvcv::Tensor halfMap = nvcv::util::CreateTensor(1, 24, 24, nvcv::FMT_2F16);
+
+    const float4 borderValue = nvcv::cuda::SetAll<float4>(0.f);
+
+    cvcuda::Remap op;
+
+    // Fixed-point maps hold absolute positions and half maps hold normalized values
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall(
+                                               [&]
+                                               {
+                                                   op(nullptr, srcTensor, dstTensor, fixedMap, NVCV_INTERP_NEAREST,
+                                                      NVCV_INTERP_NEAREST, NVCV_REMAP_RELATIVE_NORMALIZED, false,
+                                                      NVCV_BORDER_CONSTANT, borderValue);
+                                               }));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall(
+                                               [&]
+                                               {
+                                                   op(nullptr, srcTensor, dstTensor, halfMap, NVCV_INTERP_NEAREST,
+                                                      NVCV_INTERP_NEAREST, NVCV_REMAP_ABSOLUTE, false,
+                                                      NVCV_BORDER_CONSTANT, borderValue);
+                                               }));
+}
+
+TEST(OpRemap_Negative, make_map_invalid)
+{
+    nvcv::Tensor floatMap = nvcv::util::CreateTensor(1, 24, 24, nvcv::FMT_2F32);
+    nvcv::Tensor halfMap  = nvcv::util::CreateTensor(1, 24, 24, nvcv::FMT_2F16);
+
+    NVCVRemapModel model = MakeTestModel(NVCV_REMAP_MODEL_PERSPECTIVE, false);
+
+    cvcuda::Remap op;
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaRemapMakeMapSubmit(op.handle(), nullptr, floatMap.handle(), nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaRemapMakeMapSubmit(op.handle(), nullptr, halfMap.handle(), &model));
+
+    NVCVRemapModel singular = model;
+    std::fill(singular.matrix, singular.matrix + 9, 0.f);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaRemapMakeMapSubmit(op.handle(), nullptr, floatMap.handle(), &singular));
+
+    NVCVRemapModel noFocal = MakeTestModel(NVCV_REMAP_MODEL_PINHOLE, false);
+    noFocal.newCamera[0]   = 0.f;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaRemapMakeMapSubmit(op.handle(), nullptr, floatMap.handle(), &noFocal));
+
+    NVCVRemapModel badType = model;
+    badType.type           = static_cast<NVCVRemapModelType>(255);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaRemapMakeMapSubmit(op.handle(), nullptr, floatMap.handle(), &badType));
+}
+
 #undef NVCV_IMAGE_FORMAT_INVALID_MAP
@@ -22,6 +22,7 @@
 #include <common/TensorDataUtils.hpp>
 #include <common/TypedTests.hpp>
 #include <common/ValueTests.hpp>
+#include <cvcuda/OpBuildPyramid.hpp>
 #include <cvcuda/OpSIFT.hpp>
 #include <cvcuda/cuda_tools/MathOps.hpp>
 #include <cvcuda/cuda_tools/TypeTraits.hpp>
@@ -1061,6 +1062,172 @@ TEST(OpSIFT, no_linear_system_solution)
     ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
 
+TEST(OpSIFT, pyramid_matches_internal)
+{
+    int3  inShape{48, 40, 2};
+    int   numOctaveLayers = 3;
+    float initSigma       = 1.6f;
+    long  capacity        = 500;
+
+    nvcv::Tensor src = nvcv::util::CreateTensor(inShape.z, inShape.x, inShape.y, kInFormat);
+
+    auto srcData = src.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(srcData);
+
+    long srcBufSize = srcData->stride(0) * inShape.z;
+
+    RawBufferType srcVec(srcBufSize);
+
+    std::uniform_int_distribution<VT> rg(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rg(g_rng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcBufSize, cudaMemcpyHostToDevice));
+
+    // clang-format off
+
+    nvcv::Tensor featCoords[2], featMetadata[2], featDescriptors[2], numFeatures[2];
+
+    for (int i = 0; i < 2; ++i)
+    {
+        featCoords[i] = nvcv::Tensor({{inShape.z, capacity}, "NM"}, nvcv::TYPE_4F32);
+        featMetadata[i] = nvcv::Tensor({{inShape.z, capacity}, "NM"}, nvcv::TYPE_3F32);
+        featDescriptors[i] = nvcv::Tensor({{inShape.z, capacity, 128}, "NMD"}, nvcv::TYPE_U8);
+        numFeatures[i] = nvcv::Tensor({{inShape.z}, "N"}, nvcv::TYPE_S32);
+    }
+
+    // clang-format on
+
+    for (bool expandInput : {false, true})
+    {
+        int3 baseShape = expandInput ? int3{inShape.x * 2, inShape.y * 2, inShape.z} : inShape;
+        int  numLevels = std::round(std::log2(std::min(baseShape.x, baseShape.y)) - 2) + 1; // same as SIFT octaves
+
+        cudaStream_t stream;
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+        cvcuda::SIFT         op(baseShape, numOctaveLayers);
+        cvcuda::BuildPyramid buildOp(baseShape);
+
+        nvcv::TensorBatch pyramid = cvcuda::BuildPyramid::CreatePyramid(baseShape, numLevels, numOctaveLayers);
+
+        NVCVPyramidInfo pyramidInfo;
+
+        EXPECT_NO_THROW(op(stream, src, featCoords[0], featMetadata[0], featDescriptors[0], numFeatures[0],
+                           numOctaveLayers, 0.04f, 10.f, initSigma,
+                           expandInput ? NVCV_SIFT_USE_EXPANDED_INPUT : NVCV_SIFT_USE_ORIGINAL_INPUT));
+        EXPECT_NO_THROW(pyramidInfo = buildOp(stream, src, pyramid, initSigma, expandInput));
+        EXPECT_NO_THROW(op(stream, pyramid, pyramidInfo, featCoords[1], featMetadata[1], featDescriptors[1],
+                           numFeatures[1], 0.04f, 10.f));
+
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+        // Both paths compute the same pyramids, their features only differ in the order they are stored
+
+        std::vector<int>                                     testNumFeatures[2];
+        std::vector<std::vector<std::tuple<float4, float3>>> testFeatures[2];
+
+        for (int i = 0; i < 2; ++i)
+        {
+            testNumFeatures[i].resize(inShape.z);
+            testFeatures[i].resize(inShape.z);
+
+            auto numFeaturesData = numFeatures[i].exportData<nvcv::TensorDataStridedCuda>();
+            ASSERT_TRUE(numFeaturesData);
+            ASSERT_EQ(cudaSuccess, cudaMemcpy(testNumFeatures[i].data(), numFeaturesData->basePtr(),
+                                              inShape.z * sizeof(int), cudaMemcpyDeviceToHost));
+
+            auto featCoordsData   = featCoords[i].exportData<nvcv::TensorDataStridedCuda>();
+            auto featMetadataData = featMetadata[i].exportData<nvcv::TensorDataStridedCuda>();
+            ASSERT_TRUE(featCoordsData && featMetadataData);
+
+            for (int z = 0; z < inShape.z; ++z)
+            {
+                int num = std::min((int)capacity, testNumFeatures[i][z]);
+
+                std::vector<float4> coords(num);
+                std::vector<float3> metadata(num);
+
+                ASSERT_EQ(cudaSuccess,
+                          cudaMemcpy(coords.data(), featCoordsData->basePtr() + z * featCoordsData->stride(0),
+                                     num * sizeof(float4), cudaMemcpyDeviceToHost));
+                ASSERT_EQ(cudaSuccess,
+                          cudaMemcpy(metadata.data(), featMetadataData->basePtr() + z * featMetadataData->stride(0),
+                                     num * sizeof(float3), cudaMemcpyDeviceToHost));
+
+                for (int f = 0; f < num; ++f)
+                {
+                    testFeatures[i][z].emplace_back(coords[f], metadata[f]);
+                }
+
+                std::sort(testFeatures[i][z].begin(), testFeatures[i][z].end(),
+                          [](const auto &f1, const auto &f2)
+                          {
+                              const float4 &c1 = std::get<0>(f1), &c2 = std::get<0>(f2);
+                              const float3 &m1 = std::get<1>(f1), &m2 = std::get<1>(f2);
+                              return std::make_tuple(c1.z, c1.w, c1.y, c1.x, m1.x, m1.y, m1.z)
+                                   < std::make_tuple(c2.z, c2.w, c2.y, c2.x, m2.x, m2.y, m2.z);
+                          });
+            }
+        }
+
+        EXPECT_EQ(pyramidInfo.numLevels, numLevels);
+        EXPECT_EQ(testNumFeatures[0], testNumFeatures[1]);
+        EXPECT_EQ(testFeatures[0], testFeatures[1]);
+    }
+}
+
+TEST(OpSIFT_Negative, invalid_pyramid)
+{
+    int3 baseShape{32, 32, 1};
+
+    nvcv::Tensor src = nvcv::util::CreateTensor(baseShape.z, baseShape.x, baseShape.y, kInFormat);
+
+    nvcv::Tensor featCoords({{1, 10}, "NM"}, nvcv::TYPE_4F32);
+    nvcv::Tensor featMetadata({{1, 10}, "NM"}, nvcv::TYPE_3F32);
+    nvcv::Tensor featDescriptors({{1, 10, 128}, "NMD"}, nvcv::TYPE_U8);
+    nvcv::Tensor numFeatures({{1}, "N"}, nvcv::TYPE_S32);
+
+    cvcuda::BuildPyramid buildOp(baseShape);
+
+    nvcv::TensorBatch pyramid     = cvcuda::BuildPyramid::CreatePyramid(baseShape, 2, 4);
+    NVCVPyramidInfo   pyramidInfo = buildOp(nullptr, src, pyramid, 1.6f, false);
+
+    cvcuda::SIFT op(baseShape, 4), smallOp(int3{16, 16, 1}, 4), fewLayersOp(baseShape, 3);
+
+    EXPECT_EQ(NVCV_SUCCESS, nvcv::ProtectCall(
+                                [&] {
+                                    op(nullptr, pyramid, pyramidInfo, featCoords, featMetadata, featDescriptors,
+                                       numFeatures, 0.04f, 10.f);
+                                }));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall(
+                  [&] {
+                      smallOp(nullptr, pyramid, pyramidInfo, featCoords, featMetadata, featDescriptors, numFeatures,
+                              0.04f, 10.f);
+                  }));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall(
+                  [&] {
+                      fewLayersOp(nullptr, pyramid, pyramidInfo, featCoords, featMetadata, featDescriptors,
+                                  numFeatures, 0.04f, 10.f);
+                  }));
+
+    pyramidInfo.numLevels = 3; // not matching the number of tensors in the pyramid
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall(
+                  [&] {
+                      op(nullptr, pyramid, pyramidInfo, featCoords, featMetadata, featDescriptors, numFeatures, 0.04f,
+                         10.f);
+                  }));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaSIFTPyramidSubmit(op.handle(), nullptr, pyramid.handle(), nullptr, featCoords.handle(),
+                                      featMetadata.handle(), featDescriptors.handle(), numFeatures.handle(), 0.04f,
+                                      10.f));
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpSIFT_Negative, test::ValueList<nvcv::ImageFormat, int, int, int, float, float, float, int, int, int, nvcv::DataType, int, int, nvcv::DataType, int, int, int, nvcv::DataType, int, nvcv::DataType>{
     // inFmt            ,inShape     , initSigma, contrastThreshold, edgeThreshold, numOctaveLayers, {featCoords}          , {featMetadata}        , {featDescriptors}        , {numFeatures}
@@ -26,7 +26,9 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <array>
 #include <cmath>
+#include <cstdlib>
 #include <random>
 
 namespace nvcvcuda = nvcv::cuda;
@@ -665,6 +667,347 @@ TEST_P(OpWarpAffine, varshape_correct_output)
     }
 }
 
+TEST_P(OpWarpAffine, tensor_matrix_tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int srcWidth  = GetParamValue<0>();
+    int srcHeight = GetParamValue<1>();
+    int dstWidth  = GetParamValue<2>();
+    int dstHeight = GetParamValue<3>();
+
+    const NVCVAffineTransform xform = {GetParamValue<4>(), GetParamValue<5>(), GetParamValue<6>(),
+                                       GetParamValue<7>(), GetParamValue<8>(), GetParamValue<9>()};
+
+    NVCVInterpolationType interpolation = GetParamValue<10>();
+
+    NVCVBorderType borderMode = GetParamValue<11>();
+
+    const float4 borderValue = {GetParamValue<12>(), GetParamValue<13>(), GetParamValue<14>(), GetParamValue<15>()};
+
+    int numberOfImages = GetParamValue<16>();
+
+    bool inverseMap = GetParamValue<17>();
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    const int flags = interpolation | (inverseMap ? NVCV_WARP_INVERSE_MAP : 0);
+
+    // Generate input
+    nvcv::Tensor imgSrc(numberOfImages, {srcWidth, srcHeight}, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+
+    ASSERT_NE(nullptr, srcData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+    int                               srcVecStride = srcWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine randEng;
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+        srcVec[i].resize(srcHeight * srcVecStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+
+        // Copy input data to the GPU
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(), srcVecStride,
+                               srcVecStride, // vec has no padding
+                               srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    // One [2, 3] matrix per image, each image shifted by a different amount
+    std::vector<std::array<float, 6>> transMatrixHostVec(numberOfImages);
+
+    nvcv::Tensor transMatrixTensor({{numberOfImages, 2, 3}, "NHW"}, nvcv::TYPE_F32);
+
+    auto transMatrixData = transMatrixTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, transMatrixData);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::copy(xform, xform + 6, transMatrixHostVec[i].begin());
+        transMatrixHostVec[i][2] += i;
+        transMatrixHostVec[i][5] -= i;
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(transMatrixData->basePtr() + i * transMatrixData->stride(0), transMatrixData->stride(1),
+                               transMatrixHostVec[i].data(), 3 * sizeof(float), 3 * sizeof(float), 2,
+                               cudaMemcpyHostToDevice));
+    }
+
+    // Generate test result
+    nvcv::Tensor imgDst(numberOfImages, {dstWidth, dstHeight}, nvcv::FMT_RGBA8);
+
+    cvcuda::WarpAffine warpAffineOp(0);
+    EXPECT_NO_THROW(warpAffineOp(stream, imgSrc, imgDst, transMatrixTensor, flags, borderMode, borderValue));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    // Check result
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, dstData);
+
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int dstVecStride = dstWidth * fmt.planePixelStrideBytes(0);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(dstHeight * dstVecStride);
+
+        // Copy output data to Host
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(testVec.data(), dstVecStride, dstAccess->sampleData(i), dstAccess->rowStride(),
+                               dstVecStride, // vec has no padding
+                               dstHeight, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(dstHeight * dstVecStride);
+
+        // Generate gold result
+        WarpAffineGold<uint8_t>(goldVec, dstVecStride, {dstWidth, dstHeight}, srcVec[i], srcVecStride,
+                                {srcWidth, srcHeight}, fmt, transMatrixHostVec[i].data(), flags, borderMode,
+                                borderValue);
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
+
+TEST_P(OpWarpAffine, varshape_matrix_tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int srcWidth  = GetParamValue<0>();
+    int srcHeight = GetParamValue<1>();
+    int dstWidth  = GetParamValue<2>();
+    int dstHeight = GetParamValue<3>();
+
+    const NVCVAffineTransform xform = {GetParamValue<4>(), GetParamValue<5>(), GetParamValue<6>(),
+                                       GetParamValue<7>(), GetParamValue<8>(), GetParamValue<9>()};
+
+    NVCVInterpolationType interpolation = GetParamValue<10>();
+
+    NVCVBorderType borderMode = GetParamValue<11>();
+
+    const float4 borderValue = {GetParamValue<12>(), GetParamValue<13>(), GetParamValue<14>(), GetParamValue<15>()};
+
+    int numberOfImages = GetParamValue<16>();
+
+    bool inverseMap = GetParamValue<17>();
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    const int flags = interpolation | (inverseMap ? NVCV_WARP_INVERSE_MAP : 0);
+
+    // One [2, 3] matrix per image, each image shifted by a different amount
+    std::vector<std::array<float, 6>> transMatrixHostVec(numberOfImages);
+
+    nvcv::Tensor transMatrixTensor({{numberOfImages, 2, 3}, "NHW"}, nvcv::TYPE_F32);
+
+    auto transMatrixData = transMatrixTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, transMatrixData);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::copy(xform, xform + 6, transMatrixHostVec[i].begin());
+        transMatrixHostVec[i][2] += i;
+        transMatrixHostVec[i][5] -= i;
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(transMatrixData->basePtr() + i * transMatrixData->stride(0), transMatrixData->stride(1),
+                               transMatrixHostVec[i].data(), 3 * sizeof(float), 3 * sizeof(float), 2,
+                               cudaMemcpyHostToDevice));
+    }
+
+    // Create and populate input and output
+    std::default_random_engine randEng;
+
+    std::vector<nvcv::Image>          imgSrc, imgDst;
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+
+    int srcStride = srcWidth * fmt.planePixelStrideBytes(0);
+    int dstStride = dstWidth * fmt.planePixelStrideBytes(0);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        imgSrc.emplace_back(nvcv::Size2D{srcWidth, srcHeight}, fmt);
+        imgDst.emplace_back(nvcv::Size2D{dstWidth, dstHeight}, fmt);
+
+        const auto srcData = imgSrc[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(nullptr, srcData);
+
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+        srcVec[i].resize(srcHeight * srcStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+
+        // Copy input data to the GPU
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(), srcStride,
+                               srcStride, // vec has no padding
+                               srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numberOfImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(numberOfImages);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    // Generate test result
+    cvcuda::WarpAffine warpAffineOp(numberOfImages);
+    EXPECT_NO_THROW(warpAffineOp(stream, batchSrc, batchDst, transMatrixTensor, flags, borderMode, borderValue));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    // Check test data against gold
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto dstData = imgDst[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(nullptr, dstData);
+
+        std::vector<uint8_t> testVec(dstHeight * dstStride);
+
+        // Copy output data to Host
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(testVec.data(), dstStride, dstData->plane(0).basePtr, dstData->plane(0).rowStride,
+                               dstStride, // vec has no padding
+                               dstHeight, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(dstHeight * dstStride);
+
+        // Generate gold result
+        WarpAffineGold<uint8_t>(goldVec, dstStride, {dstWidth, dstHeight}, srcVec[i], srcStride, {srcWidth, srcHeight},
+                                fmt, transMatrixHostVec[i].data(), flags, borderMode, borderValue);
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
+
+// Identity, translations, axis-aligned scales and right angle rotations run on dedicated kernels, they must match
+// the general kernel that CVCUDA_WARP_ALGO=general forces
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpWarpAffineFastPath, test::ValueList<int, int, float, float, float, float, float, float, NVCVInterpolationType, NVCVBorderType, bool>
+{
+    // dstWidth, dstHeight,    transformation_matrix,        interpolation,              borderType, inverseAffine
+    {        37,        23,      1,  0,  0,  0,  1,  0,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        30,        20,      1,  0,  0,  0,  1,  0,   NVCV_INTERP_LINEAR,   NVCV_BORDER_REPLICATE,  true},
+    {        40,        30,      1,  0,  3,  0,  1, -2,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        40,        30,      1,  0,  3,  0,  1, -2,    NVCV_INTERP_CUBIC,     NVCV_BORDER_REFLECT, false},
+    {        40,        30,      2,  0, -3,  0, .5,  1,  NVCV_INTERP_NEAREST,        NVCV_BORDER_WRAP,  true},
+    {        40,        30,      2,  0, -3,  0, .5,  1,   NVCV_INTERP_LINEAR,  NVCV_BORDER_REFLECT101,  true},
+    {        40,        30,     -1,  0, 36,  0,  1,  0,   NVCV_INTERP_LINEAR,    NVCV_BORDER_CONSTANT,  true},
+    {        23,        37,      0,  1,  0, -1,  0, 36,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        23,        37,      0,  1,  0, -1,  0, 36,    NVCV_INTERP_CUBIC,   NVCV_BORDER_REPLICATE, false},
+    {        40,        30,      0, -1, 22,  1,  0,  0,   NVCV_INTERP_LINEAR,    NVCV_BORDER_CONSTANT,  true},
+    {        37,        23,     -1,  0, 36,  0, -1, 22,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        40,        30,     -1,  0, 38,  0, -1, 24,   NVCV_INTERP_LINEAR,        NVCV_BORDER_WRAP, false},
+});
+
+// clang-format on
+
+TEST_P(OpWarpAffineFastPath, matches_general_path)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int srcWidth = 37, srcHeight = 23, numberOfImages = 3;
+
+    int dstWidth  = GetParamValue<0>();
+    int dstHeight = GetParamValue<1>();
+
+    NVCVAffineTransform xform = {GetParamValue<2>(), GetParamValue<3>(), GetParamValue<4>(),
+                                 GetParamValue<5>(), GetParamValue<6>(), GetParamValue<7>()};
+
+    NVCVInterpolationType interpolation = GetParamValue<8>();
+    NVCVBorderType        borderMode    = GetParamValue<9>();
+    bool                  inverseMap    = GetParamValue<10>();
+
+    const float4 borderValue = {1, 2, 3, 4};
+    const int    flags       = interpolation | (inverseMap ? NVCV_WARP_INVERSE_MAP : 0);
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc(numberOfImages, {srcWidth, srcHeight}, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, srcData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    int srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::vector<uint8_t> srcVec(srcHeight * srcVecRowStride);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec.data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor imgFast(numberOfImages, {dstWidth, dstHeight}, fmt);
+    nvcv::Tensor imgGeneral(numberOfImages, {dstWidth, dstHeight}, fmt);
+
+    // The override is read when the operator is created
+    cvcuda::WarpAffine fastOp(0);
+
+    setenv("CVCUDA_WARP_ALGO", "general", 1);
+    cvcuda::WarpAffine generalOp(0);
+    unsetenv("CVCUDA_WARP_ALGO");
+
+    EXPECT_NO_THROW(fastOp(stream, imgSrc, imgFast, xform, flags, borderMode, borderValue));
+    EXPECT_NO_THROW(generalOp(stream, imgSrc, imgGeneral, xform, flags, borderMode, borderValue));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    auto fastData    = imgFast.exportData<nvcv::TensorDataStridedCuda>();
+    auto generalData = imgGeneral.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, fastData);
+    ASSERT_NE(nullptr, generalData);
+
+    auto fastAccess    = nvcv::TensorDataAccessStridedImagePlanar::Create(*fastData);
+    auto generalAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*generalData);
+    ASSERT_TRUE(fastAccess && generalAccess);
+
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> fastVec(dstHeight * dstVecRowStride), generalVec(dstHeight * dstVecRowStride);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(fastVec.data(), dstVecRowStride, fastAccess->sampleData(i),
+                                            fastAccess->rowStride(), dstVecRowStride, dstHeight,
+                                            cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(generalVec.data(), dstVecRowStride, generalAccess->sampleData(i),
+                                            generalAccess->rowStride(), dstVecRowStride, dstHeight,
+                                            cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(generalVec, fastVec);
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpWarpAffine_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat>{
     // input format, output format,
@@ -764,6 +1107,62 @@ TEST(OpWarpAffine_Negative, create_null_handle)
     EXPECT_EQ(cvcudaWarpAffineCreate(nullptr, 2), NVCV_ERROR_INVALID_ARGUMENT);
 }
 
+TEST(OpWarpAffine_Negative, invalid_matrix_tensor)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int    flags       = NVCV_INTERP_NEAREST;
+    const float4 borderValue = {0, 0, 0, 0};
+
+    nvcv::Tensor imgSrc(3, {5, 4}, nvcv::FMT_RGBA8);
+    nvcv::Tensor imgDst(3, {5, 4}, nvcv::FMT_RGBA8);
+
+    std::vector<nvcv::Image> imgSrcVec, imgDstVec;
+    for (int i = 0; i < 3; ++i)
+    {
+        imgSrcVec.emplace_back(nvcv::Size2D{5, 4}, nvcv::FMT_RGBA8);
+        imgDstVec.emplace_back(nvcv::Size2D{5, 4}, nvcv::FMT_RGBA8);
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(3);
+    batchSrc.pushBack(imgSrcVec.begin(), imgSrcVec.end());
+
+    nvcv::ImageBatchVarShape batchDst(3);
+    batchDst.pushBack(imgDstVec.begin(), imgDstVec.end());
+
+    cvcuda::WarpAffine warpAffineOp(3);
+
+    std::vector<std::pair<const char *, nvcv::Tensor>> invalidMatrices;
+    // fewer matrices than images
+    invalidMatrices.emplace_back("few matrices", nvcv::Tensor({{2, 2, 3}, "NHW"}, nvcv::TYPE_F32));
+    // perspective sized matrices
+    invalidMatrices.emplace_back("3x3 matrices", nvcv::Tensor({{3, 3, 3}, "NHW"}, nvcv::TYPE_F32));
+    invalidMatrices.emplace_back("9 element matrices", nvcv::Tensor({{3, 9}, "NW"}, nvcv::TYPE_F32));
+    // not float
+    invalidMatrices.emplace_back("int matrices", nvcv::Tensor({{3, 2, 3}, "NHW"}, nvcv::TYPE_S32));
+
+    for (const auto &[name, matrices] : invalidMatrices)
+    {
+        SCOPED_TRACE(name);
+
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+                  nvcv::ProtectCall(
+                      [&] {
+                          warpAffineOp(stream, imgSrc, imgDst, matrices, flags, NVCV_BORDER_CONSTANT, borderValue);
+                      }));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+                  nvcv::ProtectCall(
+                      [&] {
+                          warpAffineOp(stream, batchSrc, batchDst, matrices, flags, NVCV_BORDER_CONSTANT,
+                                       borderValue);
+                      }));
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST(OpWarpAffineVarshape_Negative, different_format_varshape)
 {
     std::vector<std::pair<nvcv::ImageFormat, nvcv::ImageFormat>> extraFmts{
@@ -27,6 +27,7 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <array>
 #include <cmath>
 #include <map>
 #include <random>
@@ -568,6 +569,134 @@ TEST_P(OpWarpPerspective, tensor_correct_output)
     }
 }
 
+TEST_P(OpWarpPerspective, tensor_matrix_tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int srcWidth  = GetParamValue<0>();
+    int srcHeight = GetParamValue<1>();
+    int dstWidth  = GetParamValue<2>();
+    int dstHeight = GetParamValue<3>();
+
+    NVCVPerspectiveTransform transMatrix;
+    transMatrix[0] = GetParamValue<4>();
+    transMatrix[1] = GetParamValue<5>();
+    transMatrix[2] = GetParamValue<6>();
+    transMatrix[3] = GetParamValue<7>();
+    transMatrix[4] = GetParamValue<8>();
+    transMatrix[5] = GetParamValue<9>();
+    transMatrix[6] = GetParamValue<10>();
+    transMatrix[7] = GetParamValue<11>();
+    transMatrix[8] = GetParamValue<12>();
+
+    NVCVInterpolationType interpolation = GetParamValue<13>();
+
+    NVCVBorderType borderMode = GetParamValue<14>();
+
+    const float4 borderValue = {GetParamValue<15>(), GetParamValue<16>(), GetParamValue<17>(), GetParamValue<18>()};
+
+    int numberOfImages = GetParamValue<19>();
+
+    bool inverseMap = GetParamValue<20>();
+
+    const nvcv::ImageFormat fmt           = nvcv::FMT_RGBA8;
+    const int               bytesPerPixel = 4;
+
+    const int flags = interpolation | (inverseMap ? NVCV_WARP_INVERSE_MAP : 0);
+
+    // Generate input
+    nvcv::Tensor imgSrc(numberOfImages, {srcWidth, srcHeight}, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+
+    ASSERT_NE(nullptr, srcData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+    int                               srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine randEng;
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+        srcVec[i].resize(srcHeight * srcVecRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+
+        // Copy input data to the GPU
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(), srcVecRowStride,
+                               srcVecRowStride, // vec has no padding
+                               srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    // One matrix per image laid out like the FindHomography output, each image shifted by a different amount
+    std::vector<std::array<float, 9>> transMatrixHostVec(numberOfImages);
+
+    nvcv::Tensor transMatrixTensor({{numberOfImages, 3, 3}, "NHW"}, nvcv::TYPE_F32);
+
+    auto transMatrixData = transMatrixTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, transMatrixData);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::copy(transMatrix, transMatrix + 9, transMatrixHostVec[i].begin());
+        transMatrixHostVec[i][2] += i;
+        transMatrixHostVec[i][5] -= i;
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(transMatrixData->basePtr() + i * transMatrixData->stride(0), transMatrixData->stride(1),
+                               transMatrixHostVec[i].data(), 3 * sizeof(float), 3 * sizeof(float), 3,
+                               cudaMemcpyHostToDevice));
+    }
+
+    // Generate test result
+    nvcv::Tensor imgDst(numberOfImages, {dstWidth, dstHeight}, nvcv::FMT_RGBA8);
+
+    cvcuda::WarpPerspective warpPerspectiveOp(0);
+    EXPECT_NO_THROW(warpPerspectiveOp(stream, imgSrc, imgDst, transMatrixTensor, flags, borderMode, borderValue));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    // Check result
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, dstData);
+
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(dstHeight * dstVecRowStride);
+
+        // Copy output data to Host
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(testVec.data(), dstVecRowStride, dstAccess->sampleData(i), dstAccess->rowStride(),
+                               dstVecRowStride, // vec has no padding
+                               dstHeight, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(dstHeight * dstVecRowStride);
+        std::generate(goldVec.begin(), goldVec.end(), [&]() { return 0; });
+
+        // Generate gold result
+        WarpPerspectiveGold(goldVec, dstVecRowStride, {dstWidth, dstHeight}, srcVec[i], srcVecRowStride,
+                            {srcWidth, srcHeight}, fmt, transMatrixHostVec[i].data(), flags, borderMode, borderValue);
+
+        printVec(goldVec, dstHeight, dstVecRowStride, bytesPerPixel, "golden output");
+        printVec(testVec, dstHeight, dstVecRowStride, bytesPerPixel, "warped output");
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
+
 TEST_P(OpWarpPerspective, varshape_correct_output)
 {
     cudaStream_t stream;
@@ -761,6 +890,118 @@ TEST_P(OpWarpPerspective, varshape_correct_output)
     }
 }
 
+// Perspective matrices with a last row of (0, 0, w) that reduce to identity, translations, axis-aligned scales and
+// right angle rotations run on dedicated kernels, they must match the general kernel that CVCUDA_WARP_ALGO=general
+// forces. The affine part is given divided by w, w is a power of two so that the scaled matrix is exact.
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpWarpPerspectiveFastPath, test::ValueList<int, int, float, float, float, float, float, float, float, NVCVInterpolationType, NVCVBorderType, bool>
+{
+    // dstWidth, dstHeight,    transformation_matrix / w,   w,        interpolation,              borderType, inverseMap
+    {        37,        23,      1,  0,  0,  0,  1,  0,     1,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        30,        20,      1,  0,  0,  0,  1,  0,     2,   NVCV_INTERP_LINEAR,   NVCV_BORDER_REPLICATE, false},
+    {        40,        30,      1,  0,  3,  0,  1, -2,   0.5,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        40,        30,      1,  0,  3,  0,  1, -2,     1,    NVCV_INTERP_CUBIC,     NVCV_BORDER_REFLECT, false},
+    {        40,        30,      2,  0, -3,  0, .5,  1,     4,  NVCV_INTERP_NEAREST,        NVCV_BORDER_WRAP,  true},
+    {        40,        30,      2,  0, -3,  0, .5,  1,    -1,   NVCV_INTERP_LINEAR,  NVCV_BORDER_REFLECT101,  true},
+    {        23,        37,      0,  1,  0, -1,  0, 36,     2,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        23,        37,      0,  1,  0, -1,  0, 36,     1,    NVCV_INTERP_CUBIC,   NVCV_BORDER_REPLICATE, false},
+    {        40,        30,      0, -1, 22,  1,  0,  0,   0.5,   NVCV_INTERP_LINEAR,    NVCV_BORDER_CONSTANT,  true},
+    {        37,        23,     -1,  0, 36,  0, -1, 22,     1,  NVCV_INTERP_NEAREST,    NVCV_BORDER_CONSTANT,  true},
+    {        40,        30,     -1,  0, 38,  0, -1, 24,     2,   NVCV_INTERP_LINEAR,        NVCV_BORDER_WRAP, false},
+});
+
+// clang-format on
+
+TEST_P(OpWarpPerspectiveFastPath, matches_general_path)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int srcWidth = 37, srcHeight = 23, numberOfImages = 3;
+
+    int   dstWidth  = GetParamValue<0>();
+    int   dstHeight = GetParamValue<1>();
+    float w         = GetParamValue<8>();
+
+    NVCVPerspectiveTransform transMatrix
+        = {GetParamValue<2>() * w, GetParamValue<3>() * w, GetParamValue<4>() * w, GetParamValue<5>() * w,
+           GetParamValue<6>() * w, GetParamValue<7>() * w, 0, 0, w};
+
+    NVCVInterpolationType interpolation = GetParamValue<9>();
+    NVCVBorderType        borderMode    = GetParamValue<10>();
+    bool                  inverseMap    = GetParamValue<11>();
+
+    const float4 borderValue = {1, 2, 3, 4};
+    const int    flags       = interpolation | (inverseMap ? NVCV_WARP_INVERSE_MAP : 0);
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc(numberOfImages, {srcWidth, srcHeight}, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, srcData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    int srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::vector<uint8_t> srcVec(srcHeight * srcVecRowStride);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec.data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor imgFast(numberOfImages, {dstWidth, dstHeight}, fmt);
+    nvcv::Tensor imgGeneral(numberOfImages, {dstWidth, dstHeight}, fmt);
+
+    // The override is read when the operator is created
+    cvcuda::WarpPerspective fastOp(0);
+
+    setenv("CVCUDA_WARP_ALGO", "general", 1);
+    cvcuda::WarpPerspective generalOp(0);
+    unsetenv("CVCUDA_WARP_ALGO");
+
+    EXPECT_NO_THROW(fastOp(stream, imgSrc, imgFast, transMatrix, flags, borderMode, borderValue));
+    EXPECT_NO_THROW(generalOp(stream, imgSrc, imgGeneral, transMatrix, flags, borderMode, borderValue));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    auto fastData    = imgFast.exportData<nvcv::TensorDataStridedCuda>();
+    auto generalData = imgGeneral.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, fastData);
+    ASSERT_NE(nullptr, generalData);
+
+    auto fastAccess    = nvcv::TensorDataAccessStridedImagePlanar::Create(*fastData);
+    auto generalAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*generalData);
+    ASSERT_TRUE(fastAccess && generalAccess);
+
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> fastVec(dstHeight * dstVecRowStride), generalVec(dstHeight * dstVecRowStride);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(fastVec.data(), dstVecRowStride, fastAccess->sampleData(i),
+                                            fastAccess->rowStride(), dstVecRowStride, dstHeight,
+                                            cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(generalVec.data(), dstVecRowStride, generalAccess->sampleData(i),
+                                            generalAccess->rowStride(), dstVecRowStride, dstHeight,
+                                            cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(generalVec, fastVec);
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpWarpPerspective_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat>{
     // input format, output format,
@@ -917,3 +1158,46 @@ TEST(OpWarpPerspectiveVarshape_Negative, different_format_varshape)
         EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
     }
 }
+
+TEST(OpWarpPerspective_Negative, invalid_matrix_tensor)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int flags = NVCV_INTERP_NEAREST;
+
+    nvcv::Tensor imgSrc(3, {5, 4}, nvcv::FMT_RGBA8);
+    nvcv::Tensor imgDst(3, {5, 4}, nvcv::FMT_RGBA8);
+
+    cvcuda::WarpPerspective warpPerspectiveOp(0);
+
+    // fewer matrices than images
+    nvcv::Tensor fewMatrices({{2, 3, 3}, "NHW"}, nvcv::TYPE_F32);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall(
+                  [&] {
+                      warpPerspectiveOp(stream, imgSrc, imgDst, fewMatrices, flags, NVCV_BORDER_CONSTANT,
+                                        float4{0, 0, 0, 0});
+                  }));
+
+    // affine sized matrices
+    nvcv::Tensor affineMatrices({{3, 6}, "NW"}, nvcv::TYPE_F32);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall(
+                  [&] {
+                      warpPerspectiveOp(stream, imgSrc, imgDst, affineMatrices, flags, NVCV_BORDER_CONSTANT,
+                                        float4{0, 0, 0, 0});
+                  }));
+
+    // not float
+    nvcv::Tensor intMatrices({{3, 9}, "NW"}, nvcv::TYPE_S32);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall(
+                  [&] {
+                      warpPerspectiveOp(stream, imgSrc, imgDst, intMatrices, flags, NVCV_BORDER_CONSTANT,
+                                        float4{0, 0, 0, 0});
+                  }));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -0,0 +1,576 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpAdvCvtColor.hpp>
+#include <cvcuda/OpYUVResizeCropNormalize.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <cuda_fp16.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+static std::default_random_engine g_rng(0); // seed 0 to fix pseudo-randomness
+
+// --------------------- Gold (reference) definitions --------------------------
+
+// Fixed-point YUV -> RGB coefficients (U2B, U2G, V2G, V2R) scaled by 1 << 14, as used by AdvCvtColor
+static std::array<int, 4> YUV2RGBCoefs(nvcv::ColorSpec spec)
+{
+    switch (spec)
+    {
+    case NVCV_COLOR_SPEC_BT709:
+        return {30402, -3069, -7670, 25802};
+    case NVCV_COLOR_SPEC_BT2020:
+        return {30825, -2696, -9361, 24160};
+    default:
+        return {29032, -5636, -11698, 22970};
+    }
+}
+
+struct YUVLayout
+{
+    bool semiPlanar;
+    int  uidx;
+    bool bgr;
+};
+
+static YUVLayout GetLayout(NVCVColorConversionCode code)
+{
+    switch (code)
+    {
+    case NVCV_COLOR_YUV2RGB_NV12:
+        return {true, 0, false};
+    case NVCV_COLOR_YUV2BGR_NV12:
+        return {true, 0, true};
+    case NVCV_COLOR_YUV2RGB_NV21:
+        return {true, 1, false};
+    case NVCV_COLOR_YUV2BGR_NV21:
+        return {true, 1, true};
+    case NVCV_COLOR_YUV2RGB_I420:
+        return {false, 0, false};
+    case NVCV_COLOR_YUV2BGR_I420:
+        return {false, 0, true};
+    case NVCV_COLOR_YUV2RGB_YV12:
+        return {false, 1, false};
+    default:
+        return {false, 1, true};
+    }
+}
+
+static int Descale(int x)
+{
+    return (x + (1 << 13)) >> 14;
+}
+
+static uint8_t Sat(int v)
+{
+    return static_cast<uint8_t>(std::clamp(v, 0, 255));
+}
+
+// Converts a YUV420 image (Y plane followed by the chroma rows) to interleaved RGB, in RGB order
+static std::vector<uint8_t> GoldToRGB(const std::vector<uint8_t> &yuv, int width, int height, const YUVLayout &layout,
+                                      nvcv::ColorSpec spec)
+{
+    const auto coef = YUV2RGBCoefs(spec);
+
+    std::vector<uint8_t> rgb(width * height * 3);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            int U, V;
+            if (layout.semiPlanar)
+            {
+                const uint8_t *uv = &yuv[(height + y / 2) * width + (x & ~1)];
+                U                 = uv[layout.uidx];
+                V                 = uv[layout.uidx ^ 1];
+            }
+            else
+            {
+                // each chroma plane has height / 2 rows of width / 2 samples
+                const int      chromaIdx = (y / 2) * (width / 2) + x / 2;
+                const uint8_t *planeU    = &yuv[height * width + layout.uidx * (width / 2) * (height / 2)];
+                const uint8_t *planeV    = &yuv[height * width + (layout.uidx ^ 1) * (width / 2) * (height / 2)];
+                U                        = planeU[chromaIdx];
+                V                        = planeV[chromaIdx];
+            }
+            const int Y = yuv[y * width + x];
+
+            uint8_t *px = &rgb[(y * width + x) * 3];
+            px[0]       = Sat(Y + Descale((V - 128) * coef[3]));
+            px[1]       = Sat(Y + Descale((U - 128) * coef[1] + (V - 128) * coef[2]));
+            px[2]       = Sat(Y + Descale((U - 128) * coef[0]));
+        }
+    }
+    return rgb;
+}
+
+// Resizes, crops and normalizes an RGB image, the result is CHW in output channel order
+static std::vector<float> GoldResizeCropNormalize(const std::vector<uint8_t> &rgb, int width, int height,
+                                                  NVCVSize2D resizeDim, int2 crop, int outW, int outH,
+                                                  NVCVInterpolationType interp, bool bgr, float3 mean, float3 stddev)
+{
+    const float scaleW = static_cast<float>(width) / resizeDim.w;
+    const float scaleH = static_cast<float>(height) / resizeDim.h;
+
+    const float meanC[3] = {mean.x, mean.y, mean.z};
+    const float stdC[3]  = {stddev.x, stddev.y, stddev.z};
+
+    auto px = [&](int x, int y, int c) -> float
+    {
+        return rgb[(y * width + x) * 3 + c];
+    };
+
+    std::vector<float> out(3 * outH * outW);
+    for (int dy = 0; dy < outH; ++dy)
+    {
+        for (int dx = 0; dx < outW; ++dx)
+        {
+            float val[3];
+            if (interp == NVCV_INTERP_NEAREST)
+            {
+                int sx = std::floor(scaleW * (dx + crop.x + 0.5f));
+                int sy = std::floor(scaleH * (dy + crop.y + 0.5f));
+                for (int c = 0; c < 3; ++c)
+                {
+                    val[c] = px(sx, sy, c);
+                }
+            }
+            else
+            {
+                float fx  = scaleW * (dx + crop.x + 0.5f) - 0.5f;
+                float fy  = scaleH * (dy + crop.y + 0.5f) - 0.5f;
+                int   sx0 = std::floor(fx);
+                int   sy0 = std::floor(fy);
+                int   sx1 = std::min(sx0 + 1, width - 1);
+                int   sy1 = std::min(sy0 + 1, height - 1);
+                fx -= sx0;
+                fy -= sy0;
+                sx0 = std::max(0, sx0);
+                sy0 = std::max(0, sy0);
+                for (int c = 0; c < 3; ++c)
+                {
+                    val[c] = (1 - fy) * ((1 - fx) * px(sx0, sy0, c) + fx * px(sx1, sy0, c))
+                           + fy * ((1 - fx) * px(sx0, sy1, c) + fx * px(sx1, sy1, c));
+                }
+            }
+            for (int c = 0; c < 3; ++c)
+            {
+                const int src                     = bgr ? 2 - c : c;
+                out[(c * outH + dy) * outW + dx] = (val[src] - meanC[c]) / stdC[c];
+            }
+        }
+    }
+    return out;
+}
+
+// ----------------------------- Test helpers ----------------------------------
+
+static std::vector<uint8_t> RandomYUV(int width, int height)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<uint8_t> yuv(width * height * 3 / 2);
+    std::generate(yuv.begin(), yuv.end(), [&]() { return static_cast<uint8_t>(dist(g_rng)); });
+    return yuv;
+}
+
+static nvcv::Tensor CreateOutput(int numImages, int width, int height, bool planar, nvcv::DataType dtype)
+{
+    if (planar)
+    {
+        return nvcv::Tensor({{numImages, 3, height, width}, "NCHW"}, dtype);
+    }
+    return nvcv::Tensor({{numImages, height, width, 3}, "NHWC"}, dtype);
+}
+
+// Reads sample n of the output back as CHW float
+static std::vector<float> ReadOutput(const nvcv::Tensor &tensor, int n)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    EXPECT_TRUE(data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    EXPECT_TRUE(access);
+
+    const int    width     = access->numCols();
+    const int    height    = access->numRows();
+    const bool   planar    = access->numPlanes() > 1;
+    const bool   half      = data->dtype() == nvcv::TYPE_F16;
+    const size_t elemSize  = half ? sizeof(__half) : sizeof(float);
+    const int    numPlanes = planar ? 3 : 1;
+    const int    rowElems  = planar ? width : width * 3;
+
+    std::vector<float>   out(3 * width * height);
+    std::vector<uint8_t> row(rowElems * elemSize);
+    for (int p = 0; p < numPlanes; ++p)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            const nvcv::Byte *src = access->sampleData(n) + p * access->planeStride() + y * access->rowStride();
+            EXPECT_EQ(cudaSuccess, cudaMemcpy(row.data(), src, row.size(), cudaMemcpyDeviceToHost));
+            for (int i = 0; i < rowElems; ++i)
+            {
+                float v;
+                if (half)
+                {
+                    __half h;
+                    std::memcpy(&h, &row[i * elemSize], sizeof(h));
+                    v = __half2float(h);
+                }
+                else
+                {
+                    std::memcpy(&v, &row[i * elemSize], sizeof(v));
+                }
+                const int x = planar ? i : i / 3;
+                const int c = planar ? p : i % 3;
+                out[(c * height + y) * width + x] = v;
+            }
+        }
+    }
+    return out;
+}
+
+static void CompareOutput(const std::vector<float> &test, const std::vector<float> &gold, bool half)
+{
+    ASSERT_EQ(test.size(), gold.size());
+    for (size_t i = 0; i < gold.size(); ++i)
+    {
+        const float tol = half ? 2e-3f * std::max(1.f, std::abs(gold[i])) : 1e-3f;
+        ASSERT_NEAR(test[i], gold[i], tol) << "at index " << i;
+    }
+}
+
+static const float3 kMean{123.675f, 116.28f, 103.53f};
+static const float3 kStddev{58.395f, 57.12f, 57.375f};
+
+// ---------------------------------- Tests ------------------------------------
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpYUVResizeCropNormalize, test::ValueList<int, int, int, NVCVColorConversionCode, NVCVColorSpec, int, int, int, int, int, int, NVCVInterpolationType, bool, NVCVDataType>
+{
+    // width, height, numImages,                     code,                  spec, resizeW, resizeH, cropX, cropY, outW, outH,       interpolation, planar,           dtype
+    {     64,     48,         1,  NVCV_COLOR_YUV2RGB_NV12, NVCV_COLOR_SPEC_BT601,     32,      24,     0,     0,   32,   24,  NVCV_INTERP_LINEAR,   true, NVCV_DATA_TYPE_F32},
+    {    320,    240,         3,  NVCV_COLOR_YUV2BGR_NV12, NVCV_COLOR_SPEC_BT709,    256,     192,    16,    16,  224,  160,  NVCV_INTERP_LINEAR,   true, NVCV_DATA_TYPE_F32},
+    {    126,     90,         2,  NVCV_COLOR_YUV2RGB_NV21, NVCV_COLOR_SPEC_BT2020,   200,     150,    10,     5,  150,  100,  NVCV_INTERP_LINEAR,   true, NVCV_DATA_TYPE_F16},
+    {    100,     60,         2,  NVCV_COLOR_YUV2BGR_NV21, NVCV_COLOR_SPEC_BT601,     50,      30,     2,     3,   40,   20, NVCV_INTERP_NEAREST,  false, NVCV_DATA_TYPE_F32},
+    {     64,     64,         2,  NVCV_COLOR_YUV2RGB_I420, NVCV_COLOR_SPEC_BT601,     48,      40,     4,     4,   40,   32,  NVCV_INTERP_LINEAR,   true, NVCV_DATA_TYPE_F32},
+    {    128,     96,         1,  NVCV_COLOR_YUV2BGR_I420, NVCV_COLOR_SPEC_BT709,    128,      96,     0,     0,  128,   96, NVCV_INTERP_NEAREST,   true, NVCV_DATA_TYPE_F16},
+    {     80,     40,         4,  NVCV_COLOR_YUV2RGB_YV12, NVCV_COLOR_SPEC_BT2020,    60,      30,     6,     3,   50,   24,  NVCV_INTERP_LINEAR,  false, NVCV_DATA_TYPE_F16},
+    {    640,    480,         2,  NVCV_COLOR_YUV2BGR_YV12, NVCV_COLOR_SPEC_BT601,    224,     224,     0,     0,  224,  224,  NVCV_INTERP_LINEAR,   true, NVCV_DATA_TYPE_F32},
+});
+
+// clang-format on
+
+TEST_P(OpYUVResizeCropNormalize, tensor_correct_output)
+{
+    const int                     width     = GetParamValue<0>();
+    const int                     height    = GetParamValue<1>();
+    const int                     numImages = GetParamValue<2>();
+    const NVCVColorConversionCode code      = GetParamValue<3>();
+    const nvcv::ColorSpec         spec      = GetParamValue<4>();
+    const NVCVSize2D              resizeDim{GetParamValue<5>(), GetParamValue<6>()};
+    const int2                    crop{GetParamValue<7>(), GetParamValue<8>()};
+    const int                     outW   = GetParamValue<9>();
+    const int                     outH   = GetParamValue<10>();
+    const NVCVInterpolationType   interp = GetParamValue<11>();
+    const bool                    planar = GetParamValue<12>();
+    const nvcv::DataType          dtype{GetParamValue<13>()};
+
+    const YUVLayout layout = GetLayout(code);
+
+    nvcv::Tensor src(numImages, {width, height * 3 / 2}, nvcv::FMT_Y8);
+    nvcv::Tensor dst = CreateOutput(numImages, outW, outH, planar, dtype);
+
+    auto srcData = src.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> yuv(numImages);
+    for (int n = 0; n < numImages; ++n)
+    {
+        yuv[n] = RandomYUV(width, height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(n), srcAccess->rowStride(), yuv[n].data(), width,
+                                            width, height * 3 / 2, cudaMemcpyHostToDevice));
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::YUVResizeCropNormalize op;
+    EXPECT_NO_THROW(op(stream, src, dst, code, spec, resizeDim, interp, crop, kMean, kStddev));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int n = 0; n < numImages; ++n)
+    {
+        SCOPED_TRACE(n);
+        std::vector<uint8_t> rgb  = GoldToRGB(yuv[n], width, height, layout, spec);
+        std::vector<float>   gold = GoldResizeCropNormalize(rgb, width, height, resizeDim, crop, outW, outH, interp,
+                                                            layout.bgr, kMean, kStddev);
+        CompareOutput(ReadOutput(dst, n), gold, dtype == nvcv::TYPE_F16);
+    }
+}
+
+TEST_P(OpYUVResizeCropNormalize, varshape_correct_output)
+{
+    const int                     width     = GetParamValue<0>();
+    const int                     height    = GetParamValue<1>();
+    const int                     numImages = GetParamValue<2>();
+    const NVCVColorConversionCode code      = GetParamValue<3>();
+    const nvcv::ColorSpec         spec      = GetParamValue<4>();
+    const NVCVSize2D              resizeDim{GetParamValue<5>(), GetParamValue<6>()};
+    const int2                    crop{GetParamValue<7>(), GetParamValue<8>()};
+    const int                     outW   = GetParamValue<9>();
+    const int                     outH   = GetParamValue<10>();
+    const NVCVInterpolationType   interp = GetParamValue<11>();
+    const bool                    planar = GetParamValue<12>();
+    const nvcv::DataType          dtype{GetParamValue<13>()};
+
+    const YUVLayout layout = GetLayout(code);
+
+    nvcv::ImageBatchVarShape          src(numImages);
+    std::vector<std::vector<uint8_t>> yuv(numImages);
+    std::vector<nvcv::Size2D>         sizes(numImages);
+    for (int n = 0; n < numImages; ++n)
+    {
+        // shrink the images by a multiple of 4 to keep valid YUV420 sizes for all formats
+        sizes[n] = nvcv::Size2D{width - 4 * n, height - 4 * n};
+        yuv[n]   = RandomYUV(sizes[n].w, sizes[n].h);
+
+        nvcv::Image img({sizes[n].w, sizes[n].h * 3 / 2}, nvcv::FMT_Y8);
+        auto        imgData = img.exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_TRUE(imgData);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, yuv[n].data(),
+                                            sizes[n].w, sizes[n].w, sizes[n].h * 3 / 2, cudaMemcpyHostToDevice));
+        src.pushBack(img);
+    }
+
+    nvcv::Tensor dst = CreateOutput(numImages, outW, outH, planar, dtype);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::YUVResizeCropNormalize op;
+    EXPECT_NO_THROW(op(stream, src, dst, code, spec, resizeDim, interp, crop, kMean, kStddev));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int n = 0; n < numImages; ++n)
+    {
+        SCOPED_TRACE(n);
+        std::vector<uint8_t> rgb  = GoldToRGB(yuv[n], sizes[n].w, sizes[n].h, layout, spec);
+        std::vector<float>   gold = GoldResizeCropNormalize(rgb, sizes[n].w, sizes[n].h, resizeDim, crop, outW, outH,
+                                                            interp, layout.bgr, kMean, kStddev);
+        CompareOutput(ReadOutput(dst, n), gold, dtype == nvcv::TYPE_F16);
+    }
+}
+
+// Without resize and normalization the fused operator must reproduce AdvCvtColor exactly
+TEST(OpYUVResizeCropNormalize_AdvCvtColor, same_conversion)
+{
+    const int width = 96, height = 64, numImages = 2;
+
+    nvcv::Tensor src(numImages, {width, height * 3 / 2}, nvcv::FMT_Y8);
+    nvcv::Tensor rgb(numImages, {width, height}, nvcv::FMT_RGB8);
+    nvcv::Tensor dst = CreateOutput(numImages, width, height, true, nvcv::TYPE_F32);
+
+    auto srcData   = src.exportData<nvcv::TensorDataStridedCuda>();
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+    for (int n = 0; n < numImages; ++n)
+    {
+        std::vector<uint8_t> yuv = RandomYUV(width, height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(n), srcAccess->rowStride(), yuv.data(), width, width,
+                                            height * 3 / 2, cudaMemcpyHostToDevice));
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::AdvCvtColor            cvtColor;
+    cvcuda::YUVResizeCropNormalize op;
+    for (nvcv::ColorSpec spec : {NVCV_COLOR_SPEC_BT601, NVCV_COLOR_SPEC_BT709, NVCV_COLOR_SPEC_BT2020})
+    {
+        EXPECT_NO_THROW(cvtColor(stream, src, rgb, NVCV_COLOR_YUV2RGB_NV12, spec));
+        EXPECT_NO_THROW(op(stream, src, dst, NVCV_COLOR_YUV2RGB_NV12, spec, {width, height}, NVCV_INTERP_NEAREST,
+                           int2{0, 0}, float3{0, 0, 0}, float3{1, 1, 1}));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        auto rgbData   = rgb.exportData<nvcv::TensorDataStridedCuda>();
+        auto rgbAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*rgbData);
+        ASSERT_TRUE(rgbAccess);
+        for (int n = 0; n < numImages; ++n)
+        {
+            std::vector<uint8_t> gold(width * height * 3);
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(gold.data(), width * 3, rgbAccess->sampleData(n),
+                                                rgbAccess->rowStride(), width * 3, height, cudaMemcpyDeviceToHost));
+
+            std::vector<float> test = ReadOutput(dst, n);
+            for (int i = 0; i < width * height; ++i)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    ASSERT_EQ(test[c * width * height + i], gold[i * 3 + c]);
+                }
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+// The output pixels may be further apart than 3 elements, e.g. the RGB channels of an RGBA tensor
+TEST(OpYUVResizeCropNormalize, tensor_padded_pixel_output)
+{
+    const int width = 64, height = 48, numImages = 2, outW = 32, outH = 24;
+
+    nvcv::Tensor src(numImages, {width, height * 3 / 2}, nvcv::FMT_Y8);
+    nvcv::Tensor dst = CreateOutput(numImages, outW, outH, false, nvcv::TYPE_F32);
+    nvcv::Tensor rgba({{numImages, outH, outW, 4}, "NHWC"}, nvcv::TYPE_F32);
+
+    auto srcData   = src.exportData<nvcv::TensorDataStridedCuda>();
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+    for (int n = 0; n < numImages; ++n)
+    {
+        std::vector<uint8_t> yuv = RandomYUV(width, height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(n), srcAccess->rowStride(), yuv.data(), width, width,
+                                            height * 3 / 2, cudaMemcpyHostToDevice));
+    }
+
+    auto rgbaData = rgba.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(rgbaData);
+    ASSERT_EQ(cudaSuccess, cudaMemset(rgbaData->basePtr(), 0xFF, rgbaData->stride(0) * numImages));
+
+    nvcv::TensorDataStridedCuda::Buffer buf;
+    for (int d = 0; d < rgbaData->rank(); ++d)
+    {
+        buf.strides[d] = rgbaData->stride(d);
+    }
+    buf.basePtr = reinterpret_cast<NVCVByte *>(rgbaData->basePtr());
+
+    nvcv::Tensor rgb = nvcv::TensorWrapData(
+        nvcv::TensorDataStridedCuda(nvcv::TensorShape{{numImages, outH, outW, 3}, "NHWC"}, nvcv::TYPE_F32, buf));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::YUVResizeCropNormalize op;
+    for (const nvcv::Tensor &out : {dst, rgb})
+    {
+        EXPECT_NO_THROW(op(stream, src, out, NVCV_COLOR_YUV2RGB_NV12, NVCV_COLOR_SPEC_BT601, {outW, outH},
+                           NVCV_INTERP_LINEAR, int2{0, 0}, kMean, kStddev));
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int n = 0; n < numImages; ++n)
+    {
+        SCOPED_TRACE(n);
+
+        std::vector<float> gold = ReadOutput(dst, n);
+
+        std::vector<uint32_t> test(outH * outW * 4);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(test.data(), outW * 4 * sizeof(float), rgbaData->basePtr() + n * rgbaData->stride(0),
+                               rgbaData->stride(1), outW * 4 * sizeof(float), outH, cudaMemcpyDeviceToHost));
+
+        for (int y = 0; y < outH; ++y)
+        {
+            for (int x = 0; x < outW; ++x)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    float v;
+                    std::memcpy(&v, &test[(y * outW + x) * 4 + c], sizeof(v));
+                    ASSERT_EQ(v, gold[(c * outH + y) * outW + x]) << "at y=" << y << " x=" << x << " c=" << c;
+                }
+                // The fourth channel is left untouched
+                ASSERT_EQ(test[(y * outW + x) * 4 + 3], 0xFFFFFFFFu) << "at y=" << y << " x=" << x;
+            }
+        }
+    }
+}
+
+TEST(OpYUVResizeCropNormalize_Negative, invalid_arguments)
+{
+    const int width = 64, height = 48;
+
+    nvcv::Tensor src(1, {width, height * 3 / 2}, nvcv::FMT_Y8);
+    nvcv::Tensor dst = CreateOutput(1, 32, 32, true, nvcv::TYPE_F32);
+
+    cvcuda::YUVResizeCropNormalize op;
+
+    auto run = [&](const nvcv::Tensor &in, const nvcv::Tensor &out, NVCVColorConversionCode code,
+                   nvcv::ColorSpec spec, NVCVSize2D resizeDim, NVCVInterpolationType interp, int2 crop,
+                   float3 stddev)
+    {
+        return nvcv::ProtectCall([&] { op(nullptr, in, out, code, spec, resizeDim, interp, crop, kMean, stddev); });
+    };
+
+    const auto code = NVCV_COLOR_YUV2RGB_NV12;
+    const auto spec = NVCV_COLOR_SPEC_BT601;
+
+    // unsupported conversion code and color spec
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              run(src, dst, NVCV_COLOR_YUV2RGB_UYVY, spec, {32, 32}, NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              run(src, dst, code, NVCV_COLOR_SPEC_sRGB, {32, 32}, NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    // unsupported interpolation
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, run(src, dst, code, spec, {32, 32}, NVCV_INTERP_CUBIC, {0, 0}, kStddev));
+    // crop outside of the resized image
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, run(src, dst, code, spec, {40, 40}, NVCV_INTERP_LINEAR, {10, 0}, kStddev));
+    // zero standard deviation
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              run(src, dst, code, spec, {32, 32}, NVCV_INTERP_LINEAR, {0, 0}, float3{1, 0, 1}));
+    // odd number of rows for a YUV420 image
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, run(nvcv::Tensor(1, {width, 71}, nvcv::FMT_Y8), dst, code, spec, {32, 32},
+                                               NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    // interleaved 3-channel input
+    EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE, run(nvcv::Tensor(1, {width, height}, nvcv::FMT_RGB8), dst, code, spec,
+                                             {32, 32}, NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    // unsupported output data type and channels
+    EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE, run(src, CreateOutput(1, 32, 32, true, nvcv::TYPE_U8), code, spec, {32, 32},
+                                             NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE, run(src, nvcv::Tensor(1, {32, 32}, nvcv::FMT_RGBAf32), code, spec, {32, 32},
+                                             NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    // different number of samples
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, run(src, CreateOutput(2, 32, 32, true, nvcv::TYPE_F32), code, spec,
+                                               {32, 32}, NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+    // more samples than the grid z dimension allows
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              run(nvcv::Tensor(65536, {2, 3}, nvcv::FMT_Y8), CreateOutput(65536, 2, 2, true, nvcv::TYPE_F32), code,
+                  spec, {2, 2}, NVCV_INTERP_LINEAR, {0, 0}, kStddev));
+}
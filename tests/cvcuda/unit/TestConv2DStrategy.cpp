@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/Conv2DStrategy.hpp>
+
+namespace cv2d = cvcuda::priv::conv2d;
+
+TEST(Conv2DStrategy, small_kernels_stay_direct)
+{
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({3, 3}, 1, 8));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({7, 7}, 4, 9));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({11, 11}, 1, 8));
+}
+
+TEST(Conv2DStrategy, large_kernels_use_tensor_cores)
+{
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({13, 13}, 1, 8));
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({15, 15}, 4, 8));
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({31, 31}, 1, 9));
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({31, 31}, 4, 8));
+}
+
+TEST(Conv2DStrategy, threshold_on_width_and_area)
+{
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({12, 31}, 1, 8));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({31, 5}, 1, 8));
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({31, 6}, 1, 8));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({13, 12}, 1, 8));
+}
+
+TEST(Conv2DStrategy, needs_tf32_mma)
+{
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({31, 31}, 1, 7));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({31, 31}, 1, 7, cv2d::Algo::TENSOR_CORE));
+}
+
+TEST(Conv2DStrategy, tile_must_fit_shared_memory)
+{
+    EXPECT_LE(cv2d::SharedMemBytes({31, 31}, true), cv2d::kMaxSharedMemBytes);
+    EXPECT_GT(cv2d::SharedMemBytes({63, 63}, true), cv2d::kMaxSharedMemBytes);
+
+    // 8-bit inputs are exact in TF32 and keep a single tile, so larger kernels still fit
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({45, 45}, 1, 8));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({45, 45}, 4, 8));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({63, 63}, 4, 8, cv2d::Algo::TENSOR_CORE));
+}
+
+TEST(Conv2DStrategy, request_overrides_heuristic)
+{
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::Select({31, 31}, 1, 8, cv2d::Algo::DIRECT));
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::Select({3, 3}, 1, 8, cv2d::Algo::TENSOR_CORE));
+}
+
+TEST(Conv2DStrategy, parse_algo)
+{
+    EXPECT_EQ(cv2d::Algo::AUTO, cv2d::ParseAlgo(nullptr));
+    EXPECT_EQ(cv2d::Algo::AUTO, cv2d::ParseAlgo(""));
+    EXPECT_EQ(cv2d::Algo::AUTO, cv2d::ParseAlgo("fft"));
+    EXPECT_EQ(cv2d::Algo::DIRECT, cv2d::ParseAlgo("direct"));
+    EXPECT_EQ(cv2d::Algo::TENSOR_CORE, cv2d::ParseAlgo("tensorcore"));
+}
+
+TEST(Conv2DStrategy, tile_geometry)
+{
+    EXPECT_EQ(32, cv2d::TileInputCols(13));
+    EXPECT_EQ(48, cv2d::TileInputCols(31));
+    EXPECT_EQ(40, cv2d::TileStride(13));
+    EXPECT_EQ(48, cv2d::TileStride(31));
+    EXPECT_EQ(94, cv2d::TileInputRows(31));
+}
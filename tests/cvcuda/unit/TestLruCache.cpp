@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/util/LruCache.hpp>
+
+#include <memory>
+#include <string>
+
+namespace {
+using Cache = nvcv::util::LruCache<int, std::string>;
+} // namespace
+
+TEST(LruCacheTest, GetOrCreate)
+{
+    Cache cache(4);
+    EXPECT_EQ(cache.get(1), nullptr);
+
+    int  numCreated = 0;
+    auto create     = [&]()
+    {
+        numCreated++;
+        return std::make_unique<std::string>("one");
+    };
+
+    auto a = cache.getOrCreate(1, create);
+    auto b = cache.getOrCreate(1, create);
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(*a, "one");
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(numCreated, 1);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(LruCacheTest, PutKeepsExisting)
+{
+    Cache cache(4);
+    auto  first  = cache.put(1, std::make_shared<std::string>("first"));
+    auto  second = cache.put(1, std::make_shared<std::string>("second"));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(*cache.get(1), "first");
+}
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed)
+{
+    Cache cache(3);
+    EXPECT_EQ(cache.capacity(), 3u);
+    cache.put(1, std::make_shared<std::string>("1"));
+    cache.put(2, std::make_shared<std::string>("2"));
+    cache.put(3, std::make_shared<std::string>("3"));
+
+    // touching 1 makes 2 the least recently used entry
+    EXPECT_NE(cache.get(1), nullptr);
+    cache.put(4, std::make_shared<std::string>("4"));
+
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_EQ(cache.get(2), nullptr);
+    EXPECT_NE(cache.get(1), nullptr);
+    EXPECT_NE(cache.get(3), nullptr);
+    EXPECT_NE(cache.get(4), nullptr);
+}
+
+TEST(LruCacheTest, EvictedValueOutlivesCache)
+{
+    Cache cache(1);
+    auto  held = cache.put(1, std::make_shared<std::string>("held"));
+    cache.put(2, std::make_shared<std::string>("other"));
+    EXPECT_EQ(cache.get(1), nullptr);
+    EXPECT_EQ(*held, "held");
+    EXPECT_EQ(held.use_count(), 1);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.get(2), nullptr);
+}
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/MemoryPlanner.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// Checks that blocks live at the same time never share memory and that every block is aligned and fits the arena
+void CheckPlan(const std::vector<cvcuda::MemoryBlock> &blocks, const cvcuda::MemoryPlan &plan)
+{
+    ASSERT_EQ(plan.offsets.size(), blocks.size());
+    EXPECT_GE(plan.arenaSize, plan.peakLiveSize);
+    EXPECT_LE(plan.arenaSize, plan.unaliasedSize);
+    EXPECT_EQ(plan.arenaSize % plan.alignment, 0u);
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        EXPECT_EQ(plan.offsets[i] % blocks[i].alignment, 0u) << "Block " << i << " is misaligned";
+        EXPECT_LE(plan.offsets[i] + blocks[i].size, plan.arenaSize) << "Block " << i << " exceeds the arena";
+
+        for (size_t j = i + 1; j < blocks.size(); ++j)
+        {
+            bool liveTogether = blocks[i].firstUse <= blocks[j].lastUse && blocks[j].firstUse <= blocks[i].lastUse;
+            bool disjoint     = plan.offsets[i] + blocks[i].size <= plan.offsets[j]
+                         || plan.offsets[j] + blocks[j].size <= plan.offsets[i];
+            if (liveTogether && blocks[i].size > 0 && blocks[j].size > 0)
+            {
+                EXPECT_TRUE(disjoint) << "Blocks " << i << " and " << j << " overlap";
+            }
+        }
+    }
+}
+
+// Memory of the intermediate tensors of a decode -> resize -> [crop ->] normalize -> reformat chain, where the
+// reformatted output is given by the user and stays out of the plan
+std::vector<cvcuda::MemoryBlock> ChainBlocks(int64_t batch, int64_t srcW, int64_t srcH, int64_t dstW, int64_t dstH,
+                                             bool crop)
+{
+    const size_t kAlign = 256;
+
+    int64_t resizeW = crop ? dstW * 8 / 7 : dstW, resizeH = crop ? dstH * 8 / 7 : dstH;
+
+    std::vector<cvcuda::MemoryBlock> blocks;
+    int                              step = 0;
+
+    // Decoded and resized images are U8 NHWC, the resize also needs a small workspace
+    blocks.push_back({size_t(batch * srcH * srcW * 3), kAlign, step, step + 1});
+    ++step;
+    blocks.push_back({size_t(batch * resizeH * resizeW * 3), kAlign, step, step + 1});
+    blocks.push_back({size_t(batch * 1024), kAlign, step, step});
+    ++step;
+    if (crop)
+    {
+        blocks.push_back({size_t(batch * dstH * dstW * 3), kAlign, step, step + 1});
+        ++step;
+    }
+    // Normalized images are F32 NHWC
+    blocks.push_back({size_t(batch * dstH * dstW * 3 * 4), kAlign, step, step + 1});
+    return blocks;
+}
+
+} // namespace
+
+TEST(MemoryPlannerTest, Empty)
+{
+    cvcuda::MemoryPlan plan = cvcuda::PlanMemory({});
+    EXPECT_TRUE(plan.offsets.empty());
+    EXPECT_EQ(plan.arenaSize, 0u);
+    EXPECT_EQ(plan.unaliasedSize, 0u);
+    EXPECT_EQ(plan.peakLiveSize, 0u);
+}
+
+TEST(MemoryPlannerTest, DisjointLifetimesAlias)
+{
+    std::vector<cvcuda::MemoryBlock> blocks = {
+        {100, 4, 0, 0},
+        {300, 4, 1, 1},
+        {200, 4, 2, 2},
+    };
+    cvcuda::MemoryPlan plan = cvcuda::PlanMemory(blocks);
+    CheckPlan(blocks, plan);
+
+    EXPECT_EQ(plan.offsets, std::vector<size_t>({0, 0, 0}));
+    EXPECT_EQ(plan.arenaSize, 300u);
+    EXPECT_EQ(plan.unaliasedSize, 600u);
+    EXPECT_EQ(plan.peakLiveSize, 300u);
+}
+
+TEST(MemoryPlannerTest, OverlappingLifetimesDoNotAlias)
+{
+    std::vector<cvcuda::MemoryBlock> blocks = {
+        { 10,  1, 0, 2},
+        {100, 64, 1, 3},
+        { 30, 16, 2, 2},
+    };
+    cvcuda::MemoryPlan plan = cvcuda::PlanMemory(blocks);
+    CheckPlan(blocks, plan);
+
+    EXPECT_EQ(plan.alignment, 64u);
+    EXPECT_EQ(plan.offsets[1], 0u);   // largest block goes first
+    EXPECT_EQ(plan.offsets[2], 112u); // after the largest block, aligned to 16
+    EXPECT_EQ(plan.offsets[0], 100u); // in the gap left by the alignment of the second block
+    EXPECT_EQ(plan.arenaSize, 192u);
+}
+
+TEST(MemoryPlannerTest, FillsGapsLeftByDeadBlocks)
+{
+    // Block 2 is produced after block 0 died, so it reuses the memory of block 0
+    std::vector<cvcuda::MemoryBlock> blocks = {
+        {100, 4, 0, 1},
+        {200, 4, 1, 3},
+        { 60, 4, 2, 3},
+    };
+    cvcuda::MemoryPlan plan = cvcuda::PlanMemory(blocks);
+    CheckPlan(blocks, plan);
+
+    EXPECT_EQ(plan.offsets[1], 0u);
+    EXPECT_EQ(plan.offsets[0], 200u);
+    EXPECT_EQ(plan.offsets[2], 200u);
+    EXPECT_EQ(plan.arenaSize, 300u);
+}
+
+TEST(MemoryPlannerTest, ZeroSizedBlocks)
+{
+    std::vector<cvcuda::MemoryBlock> blocks = {
+        { 0, 8, 0, 1},
+        {16, 8, 0, 1},
+    };
+    cvcuda::MemoryPlan plan = cvcuda::PlanMemory(blocks);
+    CheckPlan(blocks, plan);
+    EXPECT_EQ(plan.arenaSize, 16u);
+}
+
+TEST(MemoryPlannerTest, InvalidBlocks)
+{
+    EXPECT_THROW(cvcuda::PlanMemory({{16, 0, 0, 0}}), nvcv::Exception);
+    EXPECT_THROW(cvcuda::PlanMemory({{16, 24, 0, 0}}), nvcv::Exception);
+    EXPECT_THROW(cvcuda::PlanMemory({{16, 8, 2, 1}}), nvcv::Exception);
+}
+
+TEST(MemoryPlannerTest, RandomLifetimes)
+{
+    std::vector<cvcuda::MemoryBlock> blocks;
+
+    uint32_t state = 12345;
+    auto     next  = [&state]()
+    {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    };
+
+    for (int i = 0; i < 200; ++i)
+    {
+        int first = next() % 50;
+        blocks.push_back({next() % 4096, size_t(1) << (next() % 9), first, first + int(next() % 10)});
+    }
+    cvcuda::MemoryPlan plan = cvcuda::PlanMemory(blocks);
+    CheckPlan(blocks, plan);
+}
+
+class MemoryPlannerChainTest
+    : public ::testing::TestWithParam<std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t, bool>>
+{
+};
+
+TEST_P(MemoryPlannerChainTest, PeakMemorySavings)
+{
+    auto [batch, srcW, srcH, dstW, dstH, crop] = GetParam();
+
+    std::vector<cvcuda::MemoryBlock> blocks = ChainBlocks(batch, srcW, srcH, dstW, dstH, crop);
+    cvcuda::MemoryPlan               plan   = cvcuda::PlanMemory(blocks);
+    CheckPlan(blocks, plan);
+
+    // In a linear chain every intermediate dies one step after it is produced, so the arena reaches the lower bound
+    EXPECT_EQ(plan.arenaSize, plan.peakLiveSize);
+    EXPECT_LT(plan.arenaSize, plan.unaliasedSize);
+
+    double savings = 1.0 - double(plan.arenaSize) / double(plan.unaliasedSize);
+    RecordProperty("unaliasedBytes", std::to_string(plan.unaliasedSize));
+    RecordProperty("arenaBytes", std::to_string(plan.arenaSize));
+    RecordProperty("savingsPercent", std::to_string(100.0 * savings));
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(_, MemoryPlannerChainTest, ::testing::Values(
+    std::make_tuple(32, 1920, 1080, 224, 224, false),
+    std::make_tuple(32, 1920, 1080, 224, 224, true),
+    std::make_tuple(64, 1280,  720, 320, 320, false),
+    std::make_tuple(8,  3840, 2160, 448, 448, true)
+));
+// clang-format on
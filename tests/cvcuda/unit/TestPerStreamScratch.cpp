@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/util/PerStreamScratch.hpp>
+#include <cvcuda/util/Stream.hpp>
+
+namespace nvcv::util {
+
+TEST(PerStreamScratch, ReuseOnSameStream)
+{
+    PerStreamScratch scratch;
+    CudaStream       stream = CudaStream::Create(true);
+
+    void *ptr = nullptr;
+    {
+        auto lease = scratch.acquire(1000, stream.get());
+        ASSERT_NE(lease.data(), nullptr);
+        EXPECT_GE(lease.size(), 1000u);
+        ptr = lease.data();
+    }
+    {
+        // Smaller requests can be served by the same buffer
+        auto lease = scratch.acquire(500, stream.get());
+        EXPECT_EQ(lease.data(), ptr);
+    }
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream.get()));
+}
+
+TEST(PerStreamScratch, LiveLeasesAreDistinct)
+{
+    PerStreamScratch scratch;
+    CudaStream       stream = CudaStream::Create(true);
+
+    auto lease1 = scratch.acquire(256, stream.get());
+    auto lease2 = scratch.acquire(256, stream.get());
+    EXPECT_NE(lease1.data(), lease2.data());
+}
+
+TEST(PerStreamScratch, OtherStreamWaitsForCompletion)
+{
+    PerStreamScratch scratch;
+    CudaStream       stream1 = CudaStream::Create(true);
+    CudaStream       stream2 = CudaStream::Create(true);
+
+    size_t hogSize = 64 << 20;
+    void  *hog     = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&hog, hogSize));
+
+    void *ptr = nullptr;
+    {
+        auto lease = scratch.acquire(4096, stream1.get());
+        ptr        = lease.data();
+        // Keep stream1 busy so that the buffer is still in use when released
+        for (int i = 0; i < 100; i++)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemsetAsync(hog, i, hogSize, stream1.get()));
+        }
+    }
+    {
+        auto lease = scratch.acquire(4096, stream2.get());
+        EXPECT_NE(lease.data(), ptr) << "A buffer still in use on another stream must not be handed out";
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream1.get()));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream2.get()));
+    {
+        // Both buffers are idle now, any of them can be reused on any stream
+        auto lease1 = scratch.acquire(4096, stream2.get());
+        auto lease2 = scratch.acquire(4096, stream2.get());
+        EXPECT_TRUE(lease1.data() == ptr || lease2.data() == ptr);
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream2.get()));
+    ASSERT_EQ(cudaSuccess, cudaFree(hog));
+}
+
+} // namespace nvcv::util
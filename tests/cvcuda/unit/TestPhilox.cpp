@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/cuda_tools/Philox.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace nvcv::cuda {
+
+TEST(Philox, KnownAnswers)
+{
+    // Reference vectors of the Random123 Philox4x32-10 implementation
+    uint4 out = Philox4x32(uint4{0, 0, 0, 0}, uint2{0, 0});
+    EXPECT_EQ(out.x, 0x6627e8d5u);
+    EXPECT_EQ(out.y, 0xe169c58du);
+    EXPECT_EQ(out.z, 0xbc57ac4cu);
+    EXPECT_EQ(out.w, 0x9b00dbd8u);
+
+    out = Philox4x32(uint4{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, uint2{0xffffffff, 0xffffffff});
+    EXPECT_EQ(out.x, 0x408f276du);
+    EXPECT_EQ(out.y, 0x41c83b0eu);
+    EXPECT_EQ(out.z, 0xa20bc7c6u);
+    EXPECT_EQ(out.w, 0x6d5451fdu);
+
+    out = Philox4x32(uint4{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, uint2{0xa4093822, 0x299f31d0});
+    EXPECT_EQ(out.x, 0xd16cfe09u);
+    EXPECT_EQ(out.y, 0x94fdccebu);
+    EXPECT_EQ(out.z, 0x5001e420u);
+    EXPECT_EQ(out.w, 0x24126ea1u);
+}
+
+TEST(Philox, StreamsAreReproducibleAndDistinct)
+{
+    auto draw = [](Philox rng)
+    {
+        std::vector<uint32_t> words(10);
+        for (uint32_t &w : words)
+        {
+            w = rng();
+        }
+        return words;
+    };
+
+    EXPECT_EQ(draw(Philox(42, 3, 7)), draw(Philox(42, 3, 7)));
+
+    EXPECT_NE(draw(Philox(42, 3, 7)), draw(Philox(43, 3, 7)));
+    EXPECT_NE(draw(Philox(42, 3, 7)), draw(Philox(42, 4, 7)));
+    EXPECT_NE(draw(Philox(42, 3, 7)), draw(Philox(42, 3, 8)));
+    EXPECT_NE(draw(Philox(42, 3, 7)), draw(Philox(42, 3, 7, 1)));
+
+    // The upper half of the seed is part of the key too
+    EXPECT_NE(draw(Philox(42, 3, 7)), draw(Philox(42 + (1ull << 32), 3, 7)));
+}
+
+TEST(Philox, Distributions)
+{
+    constexpr int kNumDraws = 100000;
+
+    double uniformSum = 0, normalSum = 0, normalSqSum = 0;
+
+    for (int i = 0; i < kNumDraws; ++i)
+    {
+        Philox rng(1234, 0, i);
+
+        float u = rng.uniform();
+        ASSERT_GE(u, 0.f);
+        ASSERT_LT(u, 1.f);
+        uniformSum += u;
+
+        double d = rng.uniformDouble();
+        ASSERT_GE(d, 0.0);
+        ASSERT_LT(d, 1.0);
+
+        int k = rng.uniformInt(-3, 5);
+        ASSERT_GE(k, -3);
+        ASSERT_LE(k, 5);
+
+        float n = rng.normal();
+        ASSERT_TRUE(std::isfinite(n));
+        normalSum += n;
+        normalSqSum += n * n;
+    }
+
+    double normalMean = normalSum / kNumDraws;
+
+    EXPECT_NEAR(uniformSum / kNumDraws, 0.5, 0.01);
+    EXPECT_NEAR(normalMean, 0.0, 0.02);
+    EXPECT_NEAR(normalSqSum / kNumDraws - normalMean * normalMean, 1.0, 0.02);
+}
+
+} // namespace nvcv::cuda
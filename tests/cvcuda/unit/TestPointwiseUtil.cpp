@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/PointwiseUtil.hpp>
+
+#include <algorithm>
+
+namespace pw = cvcuda::priv::pointwise;
+
+namespace {
+
+NVCVPointwiseStep MakeStep(NVCVPointwiseStepType type)
+{
+    NVCVPointwiseStep step{};
+    step.type = type;
+    return step;
+}
+
+void ExpectNear(float4 a, float4 b, float tol = 1e-5f)
+{
+    EXPECT_NEAR(a.x, b.x, tol);
+    EXPECT_NEAR(a.y, b.y, tol);
+    EXPECT_NEAR(a.z, b.z, tol);
+    EXPECT_NEAR(a.w, b.w, tol);
+}
+
+} // namespace
+
+TEST(PointwiseUtil, scale_shift)
+{
+    NVCVPointwiseStep step = MakeStep(NVCV_POINTWISE_SCALE_SHIFT);
+    for (int c = 0; c < 4; ++c)
+    {
+        step.scale[c] = c + 1.f;
+        step.shift[c] = -c;
+    }
+    ExpectNear(pw::ApplyStep(step, float4{1, 2, 3, 4}), float4{1, 3, 7, 13});
+}
+
+TEST(PointwiseUtil, clamp)
+{
+    NVCVPointwiseStep step = MakeStep(NVCV_POINTWISE_CLAMP);
+    step.low               = 0.f;
+    step.high              = 1.f;
+    ExpectNear(pw::ApplyStep(step, float4{-2, 0.5f, 1, 7}), float4{0, 0.5f, 1, 1});
+}
+
+TEST(PointwiseUtil, swizzle)
+{
+    NVCVPointwiseStep step = MakeStep(NVCV_POINTWISE_SWIZZLE);
+    int32_t           map[4]{2, 1, 0, 0};
+    std::copy(map, map + 4, step.map);
+    ExpectNear(pw::ApplyStep(step, float4{1, 2, 3, 4}), float4{3, 2, 1, 1});
+}
+
+TEST(PointwiseUtil, matrix)
+{
+    NVCVPointwiseStep step = MakeStep(NVCV_POINTWISE_MATRIX);
+    // Row 0 sums the first three channels, the others pass through with an offset in the last one
+    step.matrix[0] = step.matrix[1] = step.matrix[2] = 1.f;
+    step.matrix[5] = step.matrix[10] = step.matrix[15] = 1.f;
+    step.shift[3]                                      = 10.f;
+    ExpectNear(pw::ApplyStep(step, float4{1, 2, 3, 4}), float4{6, 2, 3, 14});
+}
+
+TEST(PointwiseUtil, gamma)
+{
+    NVCVPointwiseStep step = MakeStep(NVCV_POINTWISE_GAMMA);
+    step.gamma             = 2.f;
+    step.range             = 255.f;
+    ExpectNear(pw::ApplyStep(step, float4{-5, 0, 127.5f, 255}), float4{0, 0, 63.75f, 255}, 1e-3f);
+}
+
+TEST(PointwiseUtil, chain_applies_steps_in_order)
+{
+    pw::Chain chain{};
+    chain.numSteps = 2;
+
+    chain.steps[0] = MakeStep(NVCV_POINTWISE_SCALE_SHIFT);
+    chain.steps[1] = MakeStep(NVCV_POINTWISE_CLAMP);
+    for (int c = 0; c < 4; ++c)
+    {
+        chain.steps[0].scale[c] = 2.f;
+    }
+    chain.steps[1].low  = 0.f;
+    chain.steps[1].high = 5.f;
+
+    ExpectNear(pw::Apply(chain, float4{1, 2, 3, -1}), float4{2, 4, 5, 0});
+
+    chain.numSteps = 0;
+    ExpectNear(pw::Apply(chain, float4{1, 2, 3, -1}), float4{1, 2, 3, -1});
+}
@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/WarpClassifier.hpp>
+
+#include <cmath>
+
+namespace warp = cvcuda::priv::warp;
+
+using warp::WarpClass;
+
+static void ExpectMap(const warp::WarpMap &map, WarpClass type, std::initializer_list<float> xform)
+{
+    EXPECT_EQ(type, map.type);
+
+    int i = 0;
+    for (float v : xform)
+    {
+        EXPECT_FLOAT_EQ(v, map.xform[i]) << "coefficient " << i;
+        ++i;
+    }
+}
+
+TEST(WarpClassifier, identity)
+{
+    float affine[6]      = {1, 0, 0, 0, 1, 0};
+    float perspective[9] = {2, 0, 0, 0, 2, 0, 0, 0, 2};
+
+    ExpectMap(warp::Classify(affine, false, true), WarpClass::IDENTITY, {1, 0, 0, 0, 1, 0});
+    ExpectMap(warp::Classify(affine, false, false), WarpClass::IDENTITY, {1, 0, 0, 0, 1, 0});
+    ExpectMap(warp::Classify(perspective, true, true), WarpClass::IDENTITY, {1, 0, 0, 0, 1, 0});
+}
+
+TEST(WarpClassifier, translate)
+{
+    float affine[6] = {1, 0, 3, 0, 1, -2};
+
+    // The map is from destination to source, so a forward matrix is negated
+    ExpectMap(warp::Classify(affine, false, true), WarpClass::TRANSLATE, {1, 0, -3, 0, 1, 2});
+    ExpectMap(warp::Classify(affine, false, false), WarpClass::TRANSLATE, {1, 0, 3, 0, 1, -2});
+}
+
+TEST(WarpClassifier, fractional_translate_is_scale)
+{
+    float affine[6] = {1, 0, 0.5f, 0, 1, 0};
+
+    ExpectMap(warp::Classify(affine, false, false), WarpClass::SCALE, {1, 0, 0.5f, 0, 1, 0});
+}
+
+TEST(WarpClassifier, scale)
+{
+    // Letterboxing 1920x1080 into 640x640
+    float letterbox[6] = {1.f / 3, 0, 0, 0, 1.f / 3, 140};
+
+    ExpectMap(warp::Classify(letterbox, false, true), WarpClass::SCALE, {3, 0, 0, 0, 3, -420});
+
+    float perspective[9] = {2, 0, 1, 0, 0.5f, 3, 0, 0, 1};
+
+    ExpectMap(warp::Classify(perspective, true, true), WarpClass::SCALE, {0.5f, 0, -0.5f, 0, 2, -6});
+
+    // Flips have a negative scale
+    float flip[6] = {-1, 0, 4, 0, 1, 0};
+
+    ExpectMap(warp::Classify(flip, false, false), WarpClass::SCALE, {-1, 0, 4, 0, 1, 0});
+}
+
+TEST(WarpClassifier, rotations)
+{
+    // Clockwise rotation of a 10x6 image, destination is 6x10 and dst(x, y) = src(y, 5 - x)
+    float cw[6] = {0, 1, 0, -1, 0, 5};
+    ExpectMap(warp::Classify(cw, false, false), WarpClass::ROTATE_90, {0, 1, 0, -1, 0, 5});
+
+    // Same rotation given as the forward map, src(x, y) goes to dst(5 - y, x)
+    float cwForward[6] = {0, -1, 5, 1, 0, 0};
+    ExpectMap(warp::Classify(cwForward, false, true), WarpClass::ROTATE_90, {0, 1, 0, -1, 0, 5});
+
+    float ccw[6] = {0, -1, 9, 1, 0, 0};
+    ExpectMap(warp::Classify(ccw, false, false), WarpClass::ROTATE_270, {0, -1, 9, 1, 0, 0});
+
+    float half[9] = {-1, 0, 9, 0, -1, 5, 0, 0, 1};
+    ExpectMap(warp::Classify(half, true, false), WarpClass::ROTATE_180, {-1, 0, 9, 0, -1, 5});
+}
+
+TEST(WarpClassifier, float_rotation_matrices)
+{
+    // Rotation about the center of a 1920x1080 image built in float, as cv2.getRotationMatrix2D would
+    const double angle = M_PI / 2, cx = 959.5, cy = 539.5;
+    const float  c = static_cast<float>(std::cos(angle)), s = static_cast<float>(std::sin(angle));
+
+    float rot[6] = {c, s, static_cast<float>((1 - c) * cx - s * cy), -s, c, static_cast<float>(s * cx + (1 - c) * cy)};
+
+    warp::WarpMap map = warp::Classify(rot, false, true);
+    EXPECT_EQ(WarpClass::ROTATE_270, map.type);
+    EXPECT_EQ(0.f, map.xform[0]);
+    EXPECT_EQ(0.f, map.xform[4]);
+    EXPECT_EQ(std::round(map.xform[2]), map.xform[2]);
+    EXPECT_EQ(std::round(map.xform[5]), map.xform[5]);
+}
+
+TEST(WarpClassifier, general)
+{
+    float shear[6]     = {1, 0.5f, 0, 0, 1, 0};
+    float rotate45[6]  = {0.70710678f, -0.70710678f, 0, 0.70710678f, 0.70710678f, 0};
+    float transpose[6] = {0, 1, 0, 1, 0, 0};
+    float halfPixel[6] = {0, 1, 0.5f, -1, 0, 5};
+    float singular[6]  = {0, 0, 1, 0, 0, 1};
+    float tilted[9]    = {1, 0, 0, 0, 1, 0, 1e-4f, 0, 1};
+
+    EXPECT_EQ(WarpClass::GENERAL, warp::Classify(shear, false, true).type);
+    EXPECT_EQ(WarpClass::GENERAL, warp::Classify(rotate45, false, true).type);
+    EXPECT_EQ(WarpClass::GENERAL, warp::Classify(transpose, false, false).type);
+    EXPECT_EQ(WarpClass::GENERAL, warp::Classify(halfPixel, false, false).type);
+    EXPECT_EQ(WarpClass::GENERAL, warp::Classify(singular, false, true).type);
+    EXPECT_EQ(WarpClass::GENERAL, warp::Classify(tilted, true, true).type);
+}
+
+TEST(WarpClassifier, fast_path_override)
+{
+    EXPECT_TRUE(warp::FastPathEnabled(nullptr));
+    EXPECT_TRUE(warp::FastPathEnabled(""));
+    EXPECT_TRUE(warp::FastPathEnabled("fast"));
+    EXPECT_FALSE(warp::FastPathEnabled("general"));
+}
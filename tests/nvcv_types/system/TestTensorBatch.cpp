@@ -199,6 +199,53 @@ TEST(TensorBatch, push_in_parts)
     }
 }
 
+TEST(TensorBatch, shared_staging_memory)
+{
+    const int32_t             numBatches = 256;
+    const int32_t             capacity   = 4;
+    std::mt19937              rg{321};
+    std::vector<nvcv::Tensor> tensors(capacity);
+    for (auto &t : tensors)
+    {
+        t = GetRandomTensor(rg, nvcv::FMT_RGB8);
+    }
+
+    CUstream stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    {
+        std::vector<nvcv::TensorBatch> batches;
+        for (int32_t i = 0; i < numBatches; ++i)
+        {
+            batches.emplace_back(capacity);
+            batches.back().pushBack(tensors.begin(), tensors.end());
+        }
+
+        // Batches only hold staging memory while their uploads are in flight
+        for (auto &tb : batches)
+        {
+            CheckTensorBatchData(tb.exportData(stream), tensors.begin(), tensors.end(), stream);
+        }
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        auto stats = nvcv::TensorBatch::GetStagingStats();
+        EXPECT_GT(stats.reservedBytes, 0);
+        EXPECT_EQ(stats.pendingBytes, 0);
+        EXPECT_GE(stats.peakReservedBytes, stats.reservedBytes);
+
+        // Completed uploads free their staging memory for the next ones
+        for (auto &tb : batches)
+        {
+            tb.setTensor(0, tensors[1]);
+            tb.exportData(stream);
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        }
+        EXPECT_EQ(nvcv::TensorBatch::GetStagingStats().reservedBytes, stats.reservedBytes);
+    }
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchGetStagingStats(nullptr));
+}
+
 TEST(TensorBatch, push_the_same_tensor)
 {
     const int                 numMul = 32;